@@ -0,0 +1,171 @@
+
+#include "common.hpp"
+#include "filebuf.hpp"
+#include "ddstxt16.hpp"
+#include "bcnenc.hpp"
+
+#include "bcnenc.cpp"
+#include "common.cpp"
+#include "ddstxt16.cpp"
+#include "filebuf.cpp"
+#include "simdfunc.cpp"
+#include "threadpool.cpp"
+
+#include <random>
+
+// Usage: bcntest
+// Round trip test of BCnEncoder: compresses synthetic images to BC1, BC7 and
+// BC6H_UF16 with each quality setting, decodes them with DDSTexture16, and
+// prints the RMS error. The BC6H images are an HDR gradient, and one with
+// blocks covering a wide range of values (0.06 to 2048). Returns 1 if the
+// error is larger with a higher quality setting than with a lower one.
+// Build: g++ -std=c++20 -O2 -march=native -I../src bcntest.cpp
+//            ../src/bits.c ../src/bptc-tables.c ../src/decompress-bptc*.c
+
+static const int  imageWidth = 64;
+static const int  imageHeight = 64;
+
+// returns the RMS error of the decoded image compared to src, in the scale
+// of the input (0 to 255 for BC1 and BC7)
+static double roundTripTest(const std::vector< std::uint32_t >& src,
+                            unsigned char dxgiFmt, int quality)
+{
+  std::vector< unsigned char >  buf(148 + BCnEncoder::getBlockSize(dxgiFmt)
+                                          * size_t(imageWidth >> 2)
+                                          * size_t(imageHeight >> 2));
+  (void) FileBuffer::writeDDSHeader(buf.data(), dxgiFmt,
+                                    imageWidth, imageHeight, 1);
+  size_t  n = BCnEncoder::compressImage(buf.data() + 148, src.data(),
+                                        imageWidth, imageHeight,
+                                        size_t(imageWidth), dxgiFmt, quality);
+  if ((n + 148) != buf.size())
+    errorMessage("unexpected compressed image size");
+  DDSTexture16  t(buf.data(), buf.size());
+  bool    isHDR = (dxgiFmt == 0x5F);
+  int     channelCnt = (dxgiFmt == 0x62 ? 4 : 3);
+  double  err = 0.0;
+  for (int y = 0; y < imageHeight; y++)
+  {
+    for (int x = 0; x < imageWidth; x++)
+    {
+      std::uint32_t c = src[size_t(y) * size_t(imageWidth) + size_t(x)];
+      FloatVector4  a(isHDR ? FloatVector4::convertR9G9B9E5(c)
+                            : FloatVector4(c));
+      FloatVector4  b(FloatVector4::convertFloat16(t.getPixelN(x, y, 0)));
+      if (!isHDR)
+        b *= 255.0f;
+      for (int i = 0; i < channelCnt; i++)
+      {
+        double  d = double(a[i]) - double(b[i]);
+        err += (d * d);
+      }
+    }
+  }
+  return std::sqrt(err / double(imageWidth * imageHeight * channelCnt));
+}
+
+static void createLDRImage(std::vector< std::uint32_t >& buf)
+{
+  std::mt19937  rndGen(1U);
+  buf.resize(size_t(imageWidth) * size_t(imageHeight));
+  for (int y = 0; y < imageHeight; y++)
+  {
+    for (int x = 0; x < imageWidth; x++)
+    {
+      // gradient with noise
+      FloatVector4  c(float(x * 4), float(y * 4), float((x + y) * 2),
+                      float(255 - y * 2));
+      c += FloatVector4(std::uint32_t(rndGen()) & 0x1F1F1F1FU);
+      c.maxValues(FloatVector4(0.0f));
+      c.minValues(FloatVector4(255.0f));
+      buf[size_t(y) * size_t(imageWidth) + size_t(x)] = std::uint32_t(c);
+    }
+  }
+}
+
+static void createHDRGradient(std::vector< std::uint32_t >& buf)
+{
+  buf.resize(size_t(imageWidth) * size_t(imageHeight));
+  for (int y = 0; y < imageHeight; y++)
+  {
+    for (int x = 0; x < imageWidth; x++)
+    {
+      float   t = float(x + y) * (1.0f / float(imageWidth + imageHeight - 2));
+      FloatVector4  c(float(std::exp2(t * 16.0f - 6.0f)),
+                      float(std::exp2(t * 8.0f - 4.0f)),
+                      float(std::exp2(4.0f - t * 12.0f)), 0.0f);
+      buf[size_t(y) * size_t(imageWidth) + size_t(x)] =
+          c.convertToR9G9B9E5();
+    }
+  }
+}
+
+static void createHDRWideRange(std::vector< std::uint32_t >& buf)
+{
+  std::mt19937  rndGen(2U);
+  buf.resize(size_t(imageWidth) * size_t(imageHeight));
+  for (size_t i = 0; i < buf.size(); i++)
+  {
+    // red from 0.06 to 2048, green and blue near zero
+    float   r = float(std::exp2(float(rndGen() % 1024U) * (15.0f / 1024.0f)
+                                - 4.0f));
+    float   g = float(rndGen() % 1024U) * (1.0f / 8192.0f);
+    FloatVector4  c(r, g, g * 0.5f, 0.0f);
+    buf[i] = c.convertToR9G9B9E5();
+  }
+}
+
+int main()
+{
+  static const char *qualityNames[3] = { "fast", "normal", "high" };
+  bool    failed = false;
+  try
+  {
+    std::vector< std::uint32_t >  ldrImage;
+    std::vector< std::uint32_t >  hdrGradient;
+    std::vector< std::uint32_t >  hdrWideRange;
+    createLDRImage(ldrImage);
+    createHDRGradient(hdrGradient);
+    createHDRWideRange(hdrWideRange);
+    for (int i = 0; i < 4; i++)
+    {
+      const std::vector< std::uint32_t >  *src = &ldrImage;
+      unsigned char dxgiFmt = 0x47;
+      const char    *testName = "BC1, LDR gradient with noise";
+      if (i == 1)
+      {
+        dxgiFmt = 0x62;
+        testName = "BC7, LDR gradient with noise";
+      }
+      else if (i == 2)
+      {
+        src = &hdrGradient;
+        dxgiFmt = 0x5F;
+        testName = "BC6H, HDR gradient";
+      }
+      else if (i == 3)
+      {
+        src = &hdrWideRange;
+        dxgiFmt = 0x5F;
+        testName = "BC6H, HDR wide range";
+      }
+      std::printf("%s:\n", testName);
+      double  prvErr = 0.0;
+      for (int q = 0; q < 3; q++)
+      {
+        double  err = roundTripTest(*src, dxgiFmt, q);
+        bool    isWorse = (q > 0 && err > prvErr);
+        std::printf("  %-8s RMSE = %10.6f%s\n",
+                    qualityNames[q], err, (isWorse ? " (WORSE)" : ""));
+        failed = failed || isWorse;
+        prvErr = err;
+      }
+    }
+  }
+  catch (std::exception& e)
+  {
+    std::fprintf(stderr, "bcntest: %s\n", e.what());
+    return 1;
+  }
+  return int(failed);
+}
@@ -0,0 +1,324 @@
+
+#include "common.hpp"
+#include "filebuf.hpp"
+#include "ddstxt.hpp"
+
+#include "common.cpp"
+#include "filebuf.cpp"
+#include "ddstxt.cpp"
+#include "simdfunc.cpp"
+
+#include <chrono>
+#include <random>
+
+// Usage: ddsbench [FILENAME.DDS|-WIDTHxHEIGHT[BC1|BC7] [SAMPLE_COUNT]]
+// Compares DDSTexture sampling performance with linear and tiled layout,
+// and with one or 8 samples per call.
+// If no file name (or "-") is specified, a 2048x2048 R8G8B8A8 noise texture
+// is used, -WIDTHxHEIGHT selects a noise texture of different dimensions
+// (these do not need to be power of two), optionally in BC1 or BC7 format
+// with a complete mipmap chain.
+// For block compressed textures with a complete mipmap chain, sampling with
+// the texture kept in BCn format is also tested.
+// Build: g++ -std=c++20 -O2 -march=native -I../src ddsbench.cpp
+//            ../src/bits.c ../src/bptc-tables.c ../src/decompress-bptc*.c
+
+// dxgiFmt = 0x1D (R8G8B8A8_UNORM_SRGB), 0x47 (BC1_UNORM) or 0x62 (BC7_UNORM)
+static void createNoiseTexture(std::vector< unsigned char >& buf,
+                               int w, int h, bool isCubeMap = false,
+                               unsigned char dxgiFmt = 0x1D)
+{
+  size_t  faceDataSize = size_t(w) * size_t(h) * 4;
+  int     mipCnt = 1;
+  if (dxgiFmt != 0x1D)
+  {
+    faceDataSize = 0;
+    for (int i = 0; true; i++)
+    {
+      size_t  bw = std::max(size_t(w) >> i, size_t(1));
+      size_t  bh = std::max(size_t(h) >> i, size_t(1));
+      faceDataSize += ((bw + 3) >> 2) * ((bh + 3) >> 2)
+                      * (dxgiFmt == 0x47 ? 8 : 16);
+      if ((bw | bh) == 1)
+        break;
+      mipCnt++;
+    }
+  }
+  buf.resize(148 + faceDataSize * (!isCubeMap ? 1 : 6));
+  (void) FileBuffer::writeDDSHeader(buf.data(), dxgiFmt, w, h, mipCnt,
+                                    isCubeMap);
+  std::mt19937  rndGen(1U);
+  for (size_t i = 148; i < buf.size(); i = i + 4)
+    FileBuffer::writeUInt32Fast(buf.data() + i, std::uint32_t(rndGen()));
+}
+
+struct SamplePositions
+{
+  // X, Y, Z (cube maps only) and mip level in separate arrays
+  std::vector< float >  v[4];
+  inline size_t size() const
+  {
+    return v[0].size();
+  }
+};
+
+// testType = 0: random, 1: rotated scan lines, 2: random cube map vectors
+static void createSamplePositions(
+    SamplePositions& v, size_t n, int w, int testType, float angle)
+{
+  for (int i = 0; i < 4; i++)
+    v.v[i].resize(n);
+  std::mt19937  rndGen(2U);
+  if (testType != 1)
+  {
+    for (size_t i = 0; i < n; i++)
+    {
+      for (int j = 0; j < 3; j++)
+      {
+        float   tmp = float(int(rndGen() & 0xFFFFFF)) * (1.0f / 16777216.0f);
+        v.v[j][i] = (!testType ? tmp : (tmp * 2.0f - 1.0f));
+      }
+      v.v[3][i] = float(int(rndGen() & 0xFF)) * (1.5f / 256.0f);
+    }
+    return;
+  }
+  // scan lines rotated by 'angle' degrees, one sample per texel
+  float   dx = float(std::cos(angle * (3.14159265f / 180.0f))) / float(w);
+  float   dy = float(std::sin(angle * (3.14159265f / 180.0f))) / float(w);
+  for (size_t i = 0; i < n; i++)
+  {
+    float   x = float(int(i % size_t(w)));
+    float   y = float(int(i / size_t(w)));
+    v.v[0][i] = x * dx - y * dy;
+    v.v[1][i] = x * dy + y * dx;
+    v.v[2][i] = 0.0f;
+    v.v[3][i] = 0.25f;
+  }
+}
+
+// samplingMode = 0: wrap, 1: clamp, 2: mirror, 3: cube map
+static inline FloatVector4 getSample(
+    const DDSTexture& t, float x, float y, float z, float m, int samplingMode)
+{
+  switch (samplingMode)
+  {
+    case 0:
+      return t.getPixelT(x, y, m);
+    case 1:
+      return t.getPixelTC(x, y, m);
+    case 2:
+      return t.getPixelTM(x, y, m);
+    default:
+      return t.cubeMap(x, y, z, m);
+  }
+}
+
+static inline void getSamples8(
+    FloatVector8 *c, const DDSTexture& t, const SamplePositions& v, size_t i,
+    int samplingMode)
+{
+  FloatVector8  x(v.v[0].data() + i);
+  FloatVector8  y(v.v[1].data() + i);
+  FloatVector8  m(v.v[3].data() + i);
+  switch (samplingMode)
+  {
+    case 0:
+      t.getPixelT8(c, x, y, m);
+      break;
+    case 1:
+      t.getPixelTC8(c, x, y, m);
+      break;
+    case 2:
+      t.getPixelTM8(c, x, y, m);
+      break;
+    default:
+      t.cubeMap8(c, x, y, FloatVector8(v.v[2].data() + i), m);
+      break;
+  }
+}
+
+static double runTest(FloatVector4& sum, const DDSTexture& t,
+                      const SamplePositions& v, int samplingMode)
+{
+  FloatVector4  s(0.0f);
+  std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < v.size(); i++)
+  {
+    s += getSample(t, v.v[0][i], v.v[1][i], v.v[2][i], v.v[3][i],
+                   samplingMode);
+  }
+  std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+  sum = s;
+  return (std::chrono::duration< double >(t1 - t0).count() * 1.0e9
+          / double(v.size()));
+}
+
+static double runTest8(const DDSTexture& t,
+                       const SamplePositions& v, int samplingMode)
+{
+  FloatVector8  s(0.0f);
+  size_t  n = v.size() & ~size_t(7);
+  std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < n; i = i + 8)
+  {
+    FloatVector8  c[4];
+    getSamples8(c, t, v, i, samplingMode);
+    s += c[0] + c[1] + c[2] + c[3];
+  }
+  std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+  if (s.dotProduct(FloatVector8(1.0f)) < 0.0f)  // never true
+    std::printf("\n");
+  return (std::chrono::duration< double >(t1 - t0).count() * 1.0e9
+          / double(n));
+}
+
+// returns the maximum difference between single and batched sampling
+static float compareResults(const DDSTexture& t, const SamplePositions& v,
+                            int samplingMode)
+{
+  float   maxDiff = 0.0f;
+  size_t  n = std::min(v.size(), size_t(65536)) & ~size_t(7);
+  for (size_t i = 0; i < n; i = i + 8)
+  {
+    FloatVector8  c[4];
+    getSamples8(c, t, v, i, samplingMode);
+    for (size_t j = 0; j < 8; j++)
+    {
+      FloatVector4  tmp =
+          getSample(t, v.v[0][i + j], v.v[1][i + j], v.v[2][i + j],
+                    v.v[3][i + j], samplingMode);
+      for (size_t k = 0; k < 4; k++)
+        maxDiff = std::max(maxDiff, float(std::fabs(tmp[k] - c[k][j])));
+    }
+  }
+  return maxDiff;
+}
+
+// compares sampling a texture decoded at load time (t1) and kept in BCn
+// format (t2)
+static void runTestsCompressed(const DDSTexture& t1, const DDSTexture& t2,
+                               const SamplePositions& v, const char *testName,
+                               int samplingMode)
+{
+  static const char *modeNames[3] = { "wrap", "clamp", "mirror" };
+  FloatVector4  s1, s2;
+  double  nsDecoded = runTest(s1, t1, v, samplingMode);
+  double  nsCompressed = runTest(s2, t2, v, samplingMode);
+  double  nsCompressed8 = runTest8(t2, v, samplingMode);
+  float   maxDiff = 0.0f;
+  for (size_t i = 0; i < std::min(v.size(), size_t(65536)); i++)
+  {
+    FloatVector4  c1 = getSample(t1, v.v[0][i], v.v[1][i], 0.0f, v.v[3][i],
+                                 samplingMode);
+    FloatVector4  c2 = getSample(t2, v.v[0][i], v.v[1][i], 0.0f, v.v[3][i],
+                                 samplingMode);
+    for (int k = 0; k < 4; k++)
+      maxDiff = std::max(maxDiff, float(std::fabs(c1[k] - c2[k])));
+  }
+  std::printf("%-11s %-6s decoded: %7.3f ns, BCn: %7.3f ns, "
+              "BCn x8: %7.3f ns, max. diff: %g\n",
+              testName, modeNames[samplingMode],
+              nsDecoded, nsCompressed, nsCompressed8, maxDiff);
+}
+
+static void runTests(const DDSTexture& t1, const DDSTexture& t2,
+                     const SamplePositions& v, const char *testName,
+                     int samplingMode)
+{
+  static const char *modeNames[4] = { "wrap", "clamp", "mirror", "cube" };
+  FloatVector4  s1, s2;
+  double  nsLinear = runTest(s1, t1, v, samplingMode);
+  double  nsTiled = runTest(s2, t2, v, samplingMode);
+  double  nsLinear8 = runTest8(t1, v, samplingMode);
+  double  nsTiled8 = runTest8(t2, v, samplingMode);
+  std::printf("%-11s %-6s linear: %7.3f ns, tiled: %7.3f ns, "
+              "x8: %7.3f ns, tiled x8: %7.3f ns, max. diff: %g%s\n",
+              testName, modeNames[samplingMode],
+              nsLinear, nsTiled, nsLinear8, nsTiled8,
+              compareResults(t1, v, samplingMode),
+              (s1[0] == s2[0] && s1[1] == s2[1] && s1[2] == s2[2]
+               && s1[3] == s2[3] ? "" : " (MISMATCH)"));
+}
+
+int main(int argc, char **argv)
+{
+  try
+  {
+    std::vector< unsigned char >  fileBuf;
+    int     w = 2048;
+    int     h = 2048;
+    int     len = 0;
+    if (argc > 1 && std::sscanf(argv[1], "-%dx%d%n", &w, &h, &len) == 2)
+    {
+      if (w < 1 || w > 32768 || h < 1 || h > 32768)
+        errorMessage("invalid texture dimensions");
+      const char    *fmtName = argv[1] + len;
+      unsigned char dxgiFmt = 0x1D;
+      if (std::strcmp(fmtName, "BC1") == 0 || std::strcmp(fmtName, "bc1") == 0)
+        dxgiFmt = 0x47;
+      else if (std::strcmp(fmtName, "BC7") == 0 ||
+               std::strcmp(fmtName, "bc7") == 0)
+        dxgiFmt = 0x62;
+      else if (*fmtName)
+        errorMessage("invalid texture format");
+      createNoiseTexture(fileBuf, w, h, false, dxgiFmt);
+    }
+    else if (argc > 1 && std::strcmp(argv[1], "-") != 0)
+    {
+      FileBuffer  f(argv[1]);
+      fileBuf.resize(f.size());
+      std::memcpy(fileBuf.data(), f.data(), f.size());
+    }
+    else
+    {
+      createNoiseTexture(fileBuf, w, h);
+    }
+    size_t  n = 16777216;
+    if (argc > 2)
+      n = size_t(parseInteger(argv[2], 0, "invalid sample count", 8, 1L << 30));
+    DDSTexture  t1(fileBuf.data(), fileBuf.size(), 0, false);
+    DDSTexture  t2(fileBuf.data(), fileBuf.size(), 0, true);
+    std::printf("%s, %dx%d, %d mip levels\n", t1.getFormatName(),
+                t1.getWidth(), t1.getHeight(), t1.getMaxMipLevel() + 1);
+    static const char *testNames[4] =
+    {
+      "random", "rotated 0", "rotated 30", "rotated 90"
+    };
+    static const float  angles[4] = { 0.0f, 0.0f, 30.0f, 90.0f };
+    SamplePositions v;
+    for (int i = 0; i < 4; i++)
+    {
+      createSamplePositions(v, n, t1.getWidth(), (!i ? 0 : 1), angles[i]);
+      for (int m = 0; m < 3; m++)
+        runTests(t1, t2, v, testNames[i], m);
+    }
+    DDSTexture  t5(fileBuf.data(), fileBuf.size(), 0, false, true);
+    if (t5.getIsBlockCompressed())
+    {
+      std::printf("decoded size: %lu bytes, BCn size: %lu bytes\n",
+                  (unsigned long) (t1.size() * sizeof(std::uint32_t)),
+                  (unsigned long) (t5.size() * sizeof(std::uint32_t)));
+      for (int i = 0; i < 4; i++)
+      {
+        createSamplePositions(v, n, t1.getWidth(), (!i ? 0 : 1), angles[i]);
+        for (int m = 0; m < 3; m++)
+          runTestsCompressed(t1, t5, v, testNames[i], m);
+      }
+    }
+    if (!t1.getIsCubeMap())
+    {
+      // use a 512x512 noise cube map for the cube map test
+      createNoiseTexture(fileBuf, 512, 512, true);
+    }
+    DDSTexture  t3(fileBuf.data(), fileBuf.size(), 0, false);
+    DDSTexture  t4(fileBuf.data(), fileBuf.size(), 0, true);
+    createSamplePositions(v, n, t3.getWidth(), 2, 0.0f);
+    runTests(t3, t4, v, "random", 3);
+  }
+  catch (std::exception& e)
+  {
+    std::fprintf(stderr, "ddsbench: %s\n", e.what());
+    return 1;
+  }
+  return 0;
+}
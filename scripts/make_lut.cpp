@@ -1,67 +1,92 @@
-
 #include "common.hpp"
 #include "filebuf.hpp"
 #include "pbr_lut.hpp"
 
-int main()
+// Usage:
+//   make_lut > ../src/pbr_ltbl.cpp
+//       generate the embedded default table (requires zopfli)
+//   make_lut -verify [WIDTH [NSPEC [CACHEDIR]]]
+//       compare the embedded or cached table against the runtime generator
+
+static int verifyTable(int argc, char **argv)
+{
+  int     width = 512;
+  int     nSpec = 4096;
+  const char  *cacheDir = nullptr;
+  if (argc > 2)
+    width = int(parseInteger(argv[2], 10, "invalid width", 16, 4096));
+  if (argc > 3)
+    nSpec = int(parseInteger(argv[3], 10, "invalid sample count", 8, 65536));
+  if (argc > 4)
+    cacheDir = argv[4];
+  SF_PBR_Tables t(width, nSpec, cacheDir);
+  float   maxDiff = t.verifyImageData();
+  std::printf("%dx%d, %d samples: maximum difference = %g\n",
+              width, width, nSpec, maxDiff);
+  return (maxDiff < (1.0f / 1024.0f) ? 0 : 1);
+}
+
+int main(int argc, char **argv)
 {
-  SF_PBR_Tables t(512);
-  const std::vector< unsigned char >& buf = t.getImageData();
-  std::FILE *f = std::fopen("brdf_1.dds", "wb");
-  std::fwrite(buf.data(), 1, buf.size(), f);
-  std::fclose(f);
-  f = std::fopen("brdf_2.dds", "wb");
-  std::fwrite(buf.data(), 1, 148, f);
-  size_t  n = (buf.size() - 148) / sizeof(std::uint32_t);
-  unsigned char prvByte = 0;
-  for (size_t i = 0; i < (n * sizeof(std::uint32_t)); i++)
+  try
   {
-    std::uint32_t c =
-        FileBuffer::readUInt32Fast(buf.data() + 148 + ((i & (n - 1)) << 2));
-    unsigned char b;
-    if (i < n)
+    if (argc > 1 && std::strcmp(argv[1], "-verify") == 0)
+      return verifyTable(argc, argv);
+    std::vector< unsigned char >  buf(size_t(512 * 512) * 8 + 148);
+    SF_PBR_Tables::generateImageData(buf.data(), 512, 4096);
+    // DDS header, then the low and high bytes of the difference of each
+    // 16-bit channel from the pixel on its left, as separate planes
+    std::FILE *f = std::fopen("brdf_2.dds", "wb");
+    if (!f)
+      errorMessage("error opening output file");
+    std::fwrite(buf.data(), 1, 148, f);
+    for (size_t c = 0; c < 8; c++)
     {
-      b = (unsigned char) (c & 0xFF);
+      std::uint16_t prv = 0;
+      for (size_t i = 0; i < (512 * 512); i++)
+      {
+        if (!(i & 511))
+          prv = 0;
+        std::uint16_t tmp =
+            FileBuffer::readUInt16Fast(buf.data() + (148 + (i * 8)
+                                                     + ((c >> 1) << 1)));
+        std::uint16_t d = std::uint16_t(tmp - prv);
+        prv = tmp;
+        std::fputc(int(!(c & 1) ? (d & 0xFF) : (d >> 8)), f);
+      }
     }
-    else if (i < (n * 2))
+    std::fclose(f);
+    std::remove("brdf_2.dds.zlib");
+    std::system("zopfli --zlib --i100 brdf_2.dds");
+    FileBuffer  inFile("brdf_2.dds.zlib");
+    std::printf("\n#ifndef PBR_LTBL_CPP_INCLUDED\n"
+                "#define PBR_LTBL_CPP_INCLUDED\n\n");
+    std::printf("// generated by scripts/make_lut.cpp\n\n");
+    std::printf("static const size_t pbr_lut_data_size = %u;\n\n",
+                (unsigned int) buf.size());
+    std::printf("static const unsigned char pbr_lut_data_zlib[%u] =\n{\n",
+                (unsigned int) inFile.size());
+    std::string lineBuf;
+    for (size_t i = 0; i < inFile.size(); i++)
     {
-      b = (unsigned char) ((c >> 10) & 0xFF);
+      if (lineBuf.empty())
+        printToString(lineBuf, "  %u", (unsigned int) inFile[i]);
+      else
+        printToString(lineBuf, ", %u", (unsigned int) inFile[i]);
+      if (lineBuf.size() > 72 || (i + 1) >= inFile.size())
+      {
+        lineBuf += ((i + 1) < inFile.size() ? ",\n" : "\n");
+        std::fwrite(lineBuf.c_str(), 1, lineBuf.length(), stdout);
+        lineBuf.clear();
+      }
     }
-    else if (i < (n * 3))
-    {
-      b = (unsigned char) ((c >> 20) & 0xFF);
-    }
-    else
-    {
-      b = (unsigned char) (((c >> 8) & 0x03) | ((c >> 16) & 0x0C)
-                           | ((c >> 24) & 0xF0));
-    }
-    std::fputc((b - prvByte) & 0xFF, f);
-    prvByte = b;
+    std::printf("};\n\n#endif\n\n");
   }
-  std::fclose(f);
-  std::remove("brdf_2.dds.zlib");
-  std::system("zopfli --zlib --i100 brdf_2.dds");
-  FileBuffer  inFile("brdf_2.dds.zlib");
-  std::printf("static const size_t pbr_lut_data_size = %u;\n",
-              (unsigned int) buf.size());
-  std::printf("static const unsigned char pbr_lut_data_zlib[%u] = {\n",
-              (unsigned int) inFile.size());
-  std::string lineBuf;
-  for (size_t i = 0; i < inFile.size(); i++)
+  catch (std::exception& e)
   {
-    if (lineBuf.empty())
-      printToString(lineBuf, "\t%u", (unsigned int) inFile[i]);
-    else
-      printToString(lineBuf, ", %u", (unsigned int) inFile[i]);
-    if (lineBuf.size() > 70 || (i + 1) >= inFile.size())
-    {
-      lineBuf += ((i + 1) < inFile.size() ? ",\n" : "\n");
-      std::fwrite(lineBuf.c_str(), 1, lineBuf.length(), stdout);
-      lineBuf.clear();
-    }
+    std::fprintf(stderr, "make_lut: %s\n", e.what());
+    return 1;
   }
-  std::printf("};\n");
   return 0;
 }
 
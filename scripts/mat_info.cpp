@@ -15,6 +15,8 @@
 #include "mat_dump.cpp"
 #include "mat_json.cpp"
 #include "mat_list.cpp"
+#include "simdfunc.cpp"
+#include "threadpool.cpp"
 #include "zlib.cpp"
 
 #if defined(_WIN32) || defined(_WIN64)
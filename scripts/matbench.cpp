@@ -0,0 +1,143 @@
+
+#include "common.hpp"
+#include "ba2file.hpp"
+#include "material.hpp"
+#include "bsmatcdb.hpp"
+
+#include "ba2file.cpp"
+#include "bsmatcdb.cpp"
+#include "bsrefl.cpp"
+#include "common.cpp"
+#include "filebuf.cpp"
+#include "jsonread.cpp"
+#include "matcomps.cpp"
+#include "material.cpp"
+#include "mat_dump.cpp"
+#include "mat_json.cpp"
+#include "mat_list.cpp"
+#include "simdfunc.cpp"
+#include "threadpool.cpp"
+#include "zlib.cpp"
+
+#include <chrono>
+#include <thread>
+
+// Usage: matbench ARCHIVEPATH [MAXTHREADS [ITERATIONS]]
+// Compares the time needed to load all materials with loadMaterial() and
+// with compileAllMaterials(), then measures CE2MaterialDB::loadMaterial()
+// throughput with 1 to MAXTHREADS threads (default: number of CPUs) after
+// all materials have been loaded, i.e. the cost of looking up already
+// compiled materials.
+// Build: g++ -std=c++20 -O2 -march=native -I../src matbench.cpp
+
+static bool archiveFilterFunction(
+    [[maybe_unused]] void *p, const std::string_view& s)
+{
+  return (s.ends_with(".cdb") || s.ends_with(".mat"));
+}
+
+static void loadMaterials(CE2MaterialDB& materials,
+                          const std::vector< std::string_view >& matPaths,
+                          size_t threadNum, size_t threadCnt, int iterations,
+                          size_t& loadCnt)
+{
+  size_t  n = 0;
+  for (int i = 0; i < iterations; i++)
+  {
+    // each thread starts at a different position
+    size_t  k = matPaths.size() * threadNum / threadCnt;
+    for (size_t j = 0; j < matPaths.size(); j++, k++)
+    {
+      if (k >= matPaths.size())
+        k = 0;
+      n += size_t(bool(materials.loadMaterial(matPaths[k])));
+    }
+  }
+  loadCnt = n;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc < 2 || argc > 4)
+  {
+    std::fprintf(stderr,
+                 "Usage: matbench ARCHIVEPATH [MAXTHREADS [ITERATIONS]]\n");
+    return 1;
+  }
+  try
+  {
+    size_t  maxThreads = std::thread::hardware_concurrency();
+    if (argc > 2)
+      maxThreads = size_t(parseInteger(argv[2], 10, "invalid thread count",
+                                       1, 256));
+    int     iterations = 10;
+    if (argc > 3)
+      iterations = int(parseInteger(argv[3], 10, "invalid iteration count",
+                                    1, 1000000));
+    maxThreads = std::max< size_t >(maxThreads, 1);
+    BA2File ba2File(argv[1], &archiveFilterFunction);
+    CE2MaterialDB materials;
+    materials.loadArchives(ba2File);
+    std::set< std::string_view >  matPathSet;
+    AllocBuffers  stringBuf;
+    materials.getMaterialList(matPathSet, stringBuf);
+    std::vector< std::string_view > matPaths(matPathSet.begin(),
+                                             matPathSet.end());
+    if (matPaths.empty())
+      errorMessage("no materials found");
+    // compile all materials
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    size_t  loadCnt = 0;
+    loadMaterials(materials, matPaths, 0, 1, 1, loadCnt);
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+    std::printf("%lu materials, %lu loaded in %.3f s\n",
+                (unsigned long) matPaths.size(), (unsigned long) loadCnt,
+                std::chrono::duration< double >(t1 - t0).count());
+    {
+      CE2MaterialDB materials2;
+      materials2.loadArchives(ba2File);
+      t0 = std::chrono::steady_clock::now();
+      materials2.compileAllMaterials(int(maxThreads));
+      t1 = std::chrono::steady_clock::now();
+      size_t  loadCnt2 = 0;
+      loadMaterials(materials2, matPaths, 0, 1, 1, loadCnt2);
+      std::printf("compileAllMaterials() with %d threads: %.3f s, "
+                  "%lu materials loaded%s\n",
+                  int(maxThreads),
+                  std::chrono::duration< double >(t1 - t0).count(),
+                  (unsigned long) loadCnt2,
+                  (loadCnt2 == loadCnt ? "" : " (MISMATCH)"));
+    }
+    for (size_t threadCnt = 1; threadCnt <= maxThreads; threadCnt <<= 1)
+    {
+      std::vector< std::thread >  threads(threadCnt);
+      std::vector< size_t > loadCnts(threadCnt, 0);
+      t0 = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < threadCnt; i++)
+      {
+        threads[i] = std::thread(loadMaterials, std::ref(materials),
+                                 std::cref(matPaths), i, threadCnt,
+                                 iterations, std::ref(loadCnts[i]));
+      }
+      for (size_t i = 0; i < threadCnt; i++)
+        threads[i].join();
+      t1 = std::chrono::steady_clock::now();
+      double  t = std::chrono::duration< double >(t1 - t0).count();
+      double  callCnt = double(matPaths.size()) * double(iterations)
+                        * double(threadCnt);
+      std::printf("%3lu threads: %8.3f ns per call, %8.3f M calls/s\n",
+                  (unsigned long) threadCnt, t * 1.0e9 * double(threadCnt)
+                                             / callCnt,
+                  callCnt * 1.0e-6 / t);
+      if (threadCnt < maxThreads && (threadCnt << 1) > maxThreads)
+        threadCnt = maxThreads >> 1;
+    }
+  }
+  catch (std::exception& e)
+  {
+    std::fprintf(stderr, "matbench: %s\n", e.what());
+    return 1;
+  }
+  return 0;
+}
+
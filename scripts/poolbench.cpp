@@ -0,0 +1,149 @@
+
+#include "common.hpp"
+#include "downsamp.hpp"
+#include "threadpool.hpp"
+
+#include "common.cpp"
+#include "downsamp.cpp"
+#include "simdfunc.cpp"
+#include "threadpool.cpp"
+
+#include <chrono>
+
+// Usage: poolbench [THREADS [ITERATIONS]]
+// Measures the per-call overhead of running an empty parallel loop by
+// creating and joining std::threads, as the library did before ThreadPool
+// was added, and with ThreadPool::parallelFor(). Then compares the time
+// needed by downsample2xFilter() for a 1920x1080 image with the two methods.
+// Build: g++ -std=c++20 -O2 -march=native -I../src poolbench.cpp
+
+static void emptyThreadFunction([[maybe_unused]] int i0,
+                                [[maybe_unused]] int i1)
+{
+}
+
+static void downsampleThreadFunction(
+    std::uint32_t *outBuf, const std::uint32_t *inBuf, int w, int h,
+    int y0, int y1)
+{
+  for (int y = y0; y < y1; y = y + 2)
+  {
+    downsample2xFilter_Line(outBuf + (size_t(y >> 1) * size_t(w >> 1)),
+                            inBuf, w, h, y);
+  }
+}
+
+static void downsampleWithThreads(
+    std::uint32_t *outBuf, const std::uint32_t *inBuf, int w, int h,
+    int threadCnt)
+{
+  std::thread *threads[64];
+  int     y0 = 0;
+  for (int i = 0; i < threadCnt; i++)
+  {
+    int     y1 = ((h * (i + 1)) / threadCnt) & ~1;
+    threads[i] = new std::thread(downsampleThreadFunction,
+                                 outBuf, inBuf, w, h, y0, y1);
+    y0 = y1;
+  }
+  for (int i = 0; i < threadCnt; i++)
+  {
+    threads[i]->join();
+    delete threads[i];
+  }
+}
+
+static double getTime(std::chrono::steady_clock::time_point t0)
+{
+  std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration< double >(t1 - t0).count();
+}
+
+int main(int argc, char **argv)
+{
+  if (argc > 3)
+  {
+    std::fprintf(stderr, "Usage: poolbench [THREADS [ITERATIONS]]\n");
+    return 1;
+  }
+  try
+  {
+    int     threadCnt = int(std::thread::hardware_concurrency());
+    if (argc > 1)
+      threadCnt = int(parseInteger(argv[1], 10, "invalid thread count", 1, 64));
+    threadCnt = std::min(std::max(threadCnt, 1), 64);
+    int     iterations = 1000;
+    if (argc > 2)
+    {
+      iterations = int(parseInteger(argv[2], 10, "invalid iteration count",
+                                    1, 1000000));
+    }
+    ThreadPool  pool(threadCnt);
+    std::printf("%d threads, %d iterations\n", threadCnt, iterations);
+
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    for (int n = 0; n < iterations; n++)
+    {
+      std::thread *threads[64];
+      for (int i = 0; i < threadCnt; i++)
+        threads[i] = new std::thread(emptyThreadFunction, i, i + 1);
+      for (int i = 0; i < threadCnt; i++)
+      {
+        threads[i]->join();
+        delete threads[i];
+      }
+    }
+    double  t1 = getTime(t0);
+    // the first call starts the worker threads
+    pool.parallelFor(0, threadCnt, 1, &emptyThreadFunction);
+    t0 = std::chrono::steady_clock::now();
+    for (int n = 0; n < iterations; n++)
+      pool.parallelFor(0, threadCnt, 1, &emptyThreadFunction);
+    double  t2 = getTime(t0);
+    std::printf("empty loop:    std::thread %8.2f us, ThreadPool %8.2f us "
+                "per call\n",
+                t1 * 1.0e6 / double(iterations),
+                t2 * 1.0e6 / double(iterations));
+
+    int     w = 1920;
+    int     h = 1080;
+    std::vector< std::uint32_t >  inBuf(size_t(w) * size_t(h));
+    std::vector< std::uint32_t >  outBuf(size_t(w >> 1) * size_t(h >> 1));
+    std::uint32_t tmp = 0x12345678U;
+    for (size_t i = 0; i < inBuf.size(); i++)
+    {
+      tmp = tmp * 1664525U + 1013904223U;
+      inBuf[i] = tmp;
+    }
+    iterations = std::max(iterations / 10, 1);
+    t0 = std::chrono::steady_clock::now();
+    for (int n = 0; n < iterations; n++)
+      downsampleWithThreads(outBuf.data(), inBuf.data(), w, h, threadCnt);
+    t1 = getTime(t0);
+    std::uint32_t *outBufPtr = outBuf.data();
+    const std::uint32_t *inBufPtr = inBuf.data();
+    t0 = std::chrono::steady_clock::now();
+    for (int n = 0; n < iterations; n++)
+    {
+      pool.parallelFor(
+          0, h >> 1, 8,
+          [=](int y0, int y1)
+          {
+            downsampleThreadFunction(outBufPtr, inBufPtr, w, h,
+                                     y0 << 1, y1 << 1);
+          });
+    }
+    t2 = getTime(t0);
+    std::printf("downsample2x:  std::thread %8.2f us, ThreadPool %8.2f us "
+                "per call\n",
+                t1 * 1.0e6 / double(iterations),
+                t2 * 1.0e6 / double(iterations));
+  }
+  catch (std::exception& e)
+  {
+    std::fprintf(stderr, "poolbench: %s\n", e.what());
+    return 1;
+  }
+  return 0;
+}
+
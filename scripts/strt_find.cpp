@@ -10,6 +10,7 @@
 #include "common.cpp"
 #include "esmfile.cpp"
 #include "filebuf.cpp"
+#include "simdfunc.cpp"
 #include "zlib.cpp"
 
 static void loadStrings(std::set< std::string >& cdbStrings, FileBuffer& buf)
@@ -0,0 +1,669 @@
+
+#include "common.hpp"
+#include "bcnenc.hpp"
+#include "filebuf.hpp"
+#include "threadpool.hpp"
+
+// interpolation weights for 4-bit indices (BC6H and BC7)
+static const unsigned char  bptcWeights4[16] =
+{
+  0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64
+};
+
+static const float  bptcWeights4Float[16] =
+{
+  0.0f / 64.0f, 4.0f / 64.0f, 9.0f / 64.0f, 13.0f / 64.0f,
+  17.0f / 64.0f, 21.0f / 64.0f, 26.0f / 64.0f, 30.0f / 64.0f,
+  34.0f / 64.0f, 38.0f / 64.0f, 43.0f / 64.0f, 47.0f / 64.0f,
+  51.0f / 64.0f, 55.0f / 64.0f, 60.0f / 64.0f, 64.0f / 64.0f
+};
+
+// BC6H one region modes in order of decreasing endpoint precision:
+//   endpoint bits, delta bits (10 = not transformed), mode bits
+static const unsigned char  bc6hModeTable[12] =
+{
+  16, 4, 0x0F,          // mode 14
+  12, 8, 0x0B,          // mode 13
+  11, 9, 0x07,          // mode 12
+  10, 10, 0x03          // mode 11
+};
+
+static inline void putBits(std::uint64_t *b, int pos, int n, std::uint64_t v)
+{
+  v = v & ((std::uint64_t(1) << n) - 1U);
+  b[pos >> 6] = b[pos >> 6] | (v << (pos & 63));
+  if (((pos & 63) + n) > 64)
+    b[1] = b[1] | (v >> (64 - (pos & 63)));
+}
+
+// try changing each element of the quantized endpoints q by +/-1, and keep
+// the changes that reduce the error returned by evalFunc(indices, q)
+template< typename T >
+static float searchNeighbors(int *q, const int *qMax, int n,
+                             unsigned char *indices, float err,
+                             const T& evalFunc)
+{
+  unsigned char tmpIndices[16];
+  for (int i = 0; i < n; i++)
+  {
+    for (int d = -1; d <= 1; d = d + 2)
+    {
+      int     prv = q[i];
+      q[i] = prv + d;
+      if (q[i] >= 0 && q[i] <= qMax[i])
+      {
+        float   tmp = evalFunc(tmpIndices, q);
+        if (tmp < err)
+        {
+          err = tmp;
+          std::memcpy(indices, tmpIndices, sizeof(tmpIndices));
+          break;
+        }
+      }
+      q[i] = prv;
+    }
+  }
+  return err;
+}
+
+void BCnEncoder::getPrincipalAxisEndpoints(
+    FloatVector4& e0, FloatVector4& e1, const FloatVector4 *p)
+{
+  FloatVector4  m(0.0f);
+  FloatVector4  minValue(p[0]);
+  FloatVector4  maxValue(p[0]);
+  for (int i = 0; i < 16; i++)
+  {
+    m += p[i];
+    minValue.minValues(p[i]);
+    maxValue.maxValues(p[i]);
+  }
+  m *= (1.0f / 16.0f);
+  // covariance matrix, one row per channel
+  FloatVector4  c0(0.0f);
+  FloatVector4  c1(0.0f);
+  FloatVector4  c2(0.0f);
+  FloatVector4  c3(0.0f);
+  for (int i = 0; i < 16; i++)
+  {
+    FloatVector4  d(p[i] - m);
+    c0 += (d * d[0]);
+    c1 += (d * d[1]);
+    c2 += (d * d[2]);
+    c3 += (d * d[3]);
+  }
+  // find the principal axis with power iteration, starting from the diagonal
+  // of the bounding box
+  FloatVector4  v(maxValue - minValue);
+  float   d = v.dotProduct(v);
+  if (!(d > 0.0f))
+  {
+    e0 = m;
+    e1 = m;
+    return;
+  }
+  v *= (1.0f / float(std::sqrt(d)));
+  for (int i = 0; i < 8; i++)
+  {
+    FloatVector4  tmp((c0 * v[0]) + (c1 * v[1]) + (c2 * v[2]) + (c3 * v[3]));
+    d = tmp.dotProduct(tmp);
+    if (!(d > 1.0e-12f))
+      break;
+    v = tmp * (1.0f / float(std::sqrt(d)));
+  }
+  float   tMin = 0.0f;
+  float   tMax = 0.0f;
+  for (int i = 0; i < 16; i++)
+  {
+    float   t = (p[i] - m).dotProduct(v);
+    tMin = std::min(tMin, t);
+    tMax = std::max(tMax, t);
+  }
+  // the endpoints can be outside the range of the pixels in some channels,
+  // limit them to the bounding box
+  e0 = m + (v * tMin);
+  e0.maxValues(minValue);
+  e0.minValues(maxValue);
+  e1 = m + (v * tMax);
+  e1.maxValues(minValue);
+  e1.minValues(maxValue);
+}
+
+void BCnEncoder::refineEndpoints(
+    FloatVector4& e0, FloatVector4& e1, const FloatVector4 *p,
+    const unsigned char *indices, const float *t)
+{
+  float   a = 0.0f;
+  float   b = 0.0f;
+  float   c = 0.0f;
+  FloatVector4  x(0.0f);
+  FloatVector4  y(0.0f);
+  FloatVector4  minValue(p[0]);
+  FloatVector4  maxValue(p[0]);
+  for (int i = 0; i < 16; i++)
+  {
+    minValue.minValues(p[i]);
+    maxValue.maxValues(p[i]);
+    float   t1 = t[indices[i]];
+    float   t0 = 1.0f - t1;
+    a += (t0 * t0);
+    b += (t0 * t1);
+    c += (t1 * t1);
+    x += (p[i] * t0);
+    y += (p[i] * t1);
+  }
+  float   d = a * c - b * b;
+  if (!(d > 1.0e-6f))
+    return;                     // all pixels use the same index
+  d = 1.0f / d;
+  e0 = ((x * c) - (y * b)) * d;
+  e0.maxValues(minValue);
+  e0.minValues(maxValue);
+  e1 = ((y * a) - (x * b)) * d;
+  e1.maxValues(minValue);
+  e1.minValues(maxValue);
+}
+
+float BCnEncoder::findIndices(unsigned char *indices, const FloatVector4 *p,
+                              const FloatVector4 *palette, int n)
+{
+  FloatVector4  d(palette[n - 1] - palette[0]);
+  float   s = d.dotProduct(d);
+  s = (s > 0.0f ? (float(n - 1) / s) : 0.0f);
+  float   err = 0.0f;
+  for (int i = 0; i < 16; i++)
+  {
+    // project the pixel onto the line between the endpoints, then check the
+    // neighbors, because the palette is not evenly spaced after rounding
+    int     k = roundFloat((p[i] - palette[0]).dotProduct(d) * s);
+    k = std::min< int >(std::max< int >(k, 0), n - 1);
+    FloatVector4  tmp(p[i] - palette[k]);
+    float   minErr = tmp.dotProduct(tmp);
+    int     j0 = std::max< int >(k - 1, 0);
+    int     j1 = std::min< int >(k + 1, n - 1);
+    for (int j = j0; j <= j1; j++)
+    {
+      tmp = p[i] - palette[j];
+      float   e = tmp.dotProduct(tmp);
+      if (e < minErr)
+      {
+        minErr = e;
+        k = j;
+      }
+    }
+    indices[i] = (unsigned char) k;
+    err += minErr;
+  }
+  return err;
+}
+
+float BCnEncoder::findIndicesFullSearch(
+    unsigned char *indices, const FloatVector4 *p,
+    const FloatVector4 *palette, int n)
+{
+  float   err = 0.0f;
+  for (int i = 0; i < 16; i++)
+  {
+    FloatVector4  tmp(p[i] - palette[0]);
+    float   minErr = tmp.dotProduct(tmp);
+    int     k = 0;
+    for (int j = 1; j < n; j++)
+    {
+      tmp = p[i] - palette[j];
+      float   e = tmp.dotProduct(tmp);
+      if (e < minErr)
+      {
+        minErr = e;
+        k = j;
+      }
+    }
+    indices[i] = (unsigned char) k;
+    err += minErr;
+  }
+  return err;
+}
+
+void BCnEncoder::encodeBlock_BC1(unsigned char *dst, const std::uint32_t *src,
+                                 int quality)
+{
+  static const float  t[4] = { 0.0f, 1.0f / 3.0f, 2.0f / 3.0f, 1.0f };
+  static const int    qMax[6] = { 31, 63, 31, 31, 63, 31 };
+  FloatVector4  p[16];
+  for (int i = 0; i < 16; i++)
+  {
+    p[i] = FloatVector4(src + i);
+    p[i][3] = 0.0f;
+  }
+  FloatVector4  e0, e1;
+  getPrincipalAxisEndpoints(e0, e1, p);
+  // q: R0, G0, B0, R1, G1, B1 in 5:6:5 bits format
+  auto    quantizeFunc =
+      [](int *q, FloatVector4 e0, FloatVector4 e1)
+      {
+        for (int i = 0; i < 6; i++)
+        {
+          float   c = (i < 3 ? e0[i] : e1[i - 3]);
+          q[i] = roundFloat(c * float(qMax[i]) * (1.0f / 255.0f));
+          q[i] = std::min< int >(std::max< int >(q[i], 0), qMax[i]);
+        }
+      };
+  auto    evalFunc =
+      [&p](unsigned char *indices, const int *q)
+      {
+        FloatVector4  palette[4];
+        palette[0] = FloatVector4(float((q[0] << 3) | (q[0] >> 2)),
+                                  float((q[1] << 2) | (q[1] >> 4)),
+                                  float((q[2] << 3) | (q[2] >> 2)), 0.0f);
+        palette[3] = FloatVector4(float((q[3] << 3) | (q[3] >> 2)),
+                                  float((q[4] << 2) | (q[4] >> 4)),
+                                  float((q[5] << 3) | (q[5] >> 2)), 0.0f);
+        palette[1] = (palette[0] * 2.0f + palette[3]) * (1.0f / 3.0f);
+        palette[2] = (palette[0] + palette[3] * 2.0f) * (1.0f / 3.0f);
+        return findIndices(indices, p, palette, 4);
+      };
+  int     q[6];
+  unsigned char indices[16];
+  quantizeFunc(q, e0, e1);
+  float   err = evalFunc(indices, q);
+  for (int n = (quality >= qualityNormal ? 2 : 0); n > 0; n--)
+  {
+    int     tmpQ[6];
+    unsigned char tmpIndices[16];
+    refineEndpoints(e0, e1, p, indices, t);
+    quantizeFunc(tmpQ, e0, e1);
+    float   tmp = evalFunc(tmpIndices, tmpQ);
+    if (!(tmp < err))
+      break;
+    err = tmp;
+    std::memcpy(q, tmpQ, sizeof(q));
+    std::memcpy(indices, tmpIndices, sizeof(indices));
+  }
+  if (quality >= qualityHigh)
+    (void) searchNeighbors(q, qMax, 6, indices, err, evalFunc);
+
+  std::uint32_t c0 = std::uint32_t((q[0] << 11) | (q[1] << 5) | q[2]);
+  std::uint32_t c1 = std::uint32_t((q[3] << 11) | (q[4] << 5) | q[5]);
+  // the 4 color mode requires c0 > c1, indices are in the order c0, c1,
+  // (c0 * 2 + c1) / 3, (c0 + c1 * 2) / 3
+  std::uint32_t indexMap = 0x78U;       // 0, 2, 3, 1
+  if (c0 < c1)
+  {
+    std::swap(c0, c1);
+    indexMap = 0x2DU;                   // 1, 3, 2, 0
+  }
+  else if (c0 == c1)
+  {
+    indexMap = 0U;
+  }
+  std::uint32_t tmp = 0U;
+  for (int i = 0; i < 16; i++)
+    tmp = tmp | (((indexMap >> (indices[i] << 1)) & 3U) << (i << 1));
+  FileBuffer::writeUInt32Fast(dst, c0 | (c1 << 16));
+  FileBuffer::writeUInt32Fast(dst + 4, tmp);
+}
+
+void BCnEncoder::encodeBlock_BC7(unsigned char *dst, const std::uint32_t *src,
+                                 int quality)
+{
+  static const int    qMax[10] =
+  {
+    127, 127, 127, 127, 127, 127, 127, 127, 1, 1
+  };
+  FloatVector4  p[16];
+  for (int i = 0; i < 16; i++)
+    p[i] = FloatVector4(src + i);
+  FloatVector4  e0, e1;
+  getPrincipalAxisEndpoints(e0, e1, p);
+  // q: R0, G0, B0, A0, R1, G1, B1, A1 (7 bits), P0, P1
+  auto    quantizeFunc =
+      [](int *q, FloatVector4 e0, FloatVector4 e1)
+      {
+        for (int i = 0; i < 2; i++)
+        {
+          FloatVector4  e(i == 0 ? e0 : e1);
+          float   minErr = 1.0e30f;
+          for (int pBit = 0; pBit < 2; pBit++)
+          {
+            int     tmp[4];
+            float   err = 0.0f;
+            for (int c = 0; c < 4; c++)
+            {
+              tmp[c] = roundFloat((e[c] - float(pBit)) * 0.5f);
+              tmp[c] = std::min< int >(std::max< int >(tmp[c], 0), 127);
+              float   d = float(tmp[c] * 2 + pBit) - e[c];
+              err += (d * d);
+            }
+            if (err < minErr)
+            {
+              minErr = err;
+              for (int c = 0; c < 4; c++)
+                q[i * 4 + c] = tmp[c];
+              q[i + 8] = pBit;
+            }
+          }
+        }
+      };
+  auto    evalFunc =
+      [&p](unsigned char *indices, const int *q)
+      {
+        FloatVector4  palette[16];
+        int     c0[4], c1[4];
+        for (int c = 0; c < 4; c++)
+        {
+          c0[c] = q[c] * 2 + q[8];
+          c1[c] = q[c + 4] * 2 + q[9];
+        }
+        for (int k = 0; k < 16; k++)
+        {
+          int     w = bptcWeights4[k];
+          for (int c = 0; c < 4; c++)
+            palette[k][c] = float(((64 - w) * c0[c] + w * c1[c] + 32) >> 6);
+        }
+        return findIndices(indices, p, palette, 16);
+      };
+  int     q[10];
+  unsigned char indices[16];
+  quantizeFunc(q, e0, e1);
+  float   err = evalFunc(indices, q);
+  for (int n = (quality >= qualityNormal ? 2 : 0); n > 0; n--)
+  {
+    int     tmpQ[10];
+    unsigned char tmpIndices[16];
+    refineEndpoints(e0, e1, p, indices, bptcWeights4Float);
+    quantizeFunc(tmpQ, e0, e1);
+    float   tmp = evalFunc(tmpIndices, tmpQ);
+    if (!(tmp < err))
+      break;
+    err = tmp;
+    std::memcpy(q, tmpQ, sizeof(q));
+    std::memcpy(indices, tmpIndices, sizeof(indices));
+  }
+  if (quality >= qualityHigh)
+    (void) searchNeighbors(q, qMax, 10, indices, err, evalFunc);
+
+  // the most significant bit of the index of the first pixel must be zero
+  if (indices[0] >= 8)
+  {
+    for (int c = 0; c < 4; c++)
+      std::swap(q[c], q[c + 4]);
+    std::swap(q[8], q[9]);
+    for (int i = 0; i < 16; i++)
+      indices[i] = (unsigned char) (15 - indices[i]);
+  }
+  std::uint64_t b[2] = { 0U, 0U };
+  putBits(b, 0, 7, 0x40U);              // mode 6
+  for (int c = 0; c < 4; c++)
+  {
+    putBits(b, c * 14 + 7, 7, std::uint64_t(q[c]));
+    putBits(b, c * 14 + 14, 7, std::uint64_t(q[c + 4]));
+  }
+  putBits(b, 63, 1, std::uint64_t(q[8]));
+  putBits(b, 64, 1, std::uint64_t(q[9]));
+  putBits(b, 65, 3, indices[0]);
+  for (int i = 1; i < 16; i++)
+    putBits(b, i * 4 + 64, 4, indices[i]);
+  FileBuffer::writeUInt64Fast(dst, b[0]);
+  FileBuffer::writeUInt64Fast(dst + 8, b[1]);
+}
+
+void BCnEncoder::encodeBlock_BC6H(unsigned char *dst, const FloatVector4 *src,
+                                  int quality)
+{
+  // f: pixels clamped to the range of BC6H_UF16, the error of candidate
+  //    endpoints is measured in this linear space, because the FP16 bit
+  //    patterns would give near zero channels the same weight as the
+  //    brightest ones
+  // u: pixels in the interpolation space of the decoder, before the final
+  //    conversion to FP16 (h = u * 31 / 64, where h is the bit pattern)
+  FloatVector4  f[16];
+  FloatVector4  u[16];
+  for (int i = 0; i < 16; i++)
+  {
+    FloatVector4  c(src[i]);
+    c.maxValues(FloatVector4(0.0f));
+    c.minValues(FloatVector4(65504.0f));
+    c[3] = 0.0f;
+    f[i] = c;
+    std::uint64_t tmp = c.convertToFloat16();
+    u[i] = FloatVector4(float(std::uint16_t(tmp)),
+                        float(std::uint16_t(tmp >> 16)),
+                        float(std::uint16_t(tmp >> 32)), 0.0f);
+    u[i] = (u[i] + FloatVector4(0.5f, 0.5f, 0.5f, 0.0f)) * (64.0f / 31.0f);
+  }
+  FloatVector4  e0, e1;
+  getPrincipalAxisEndpoints(e0, e1, u);
+  // q: R0, G0, B0, R1, G1, B1 quantized to the endpoint precision of the mode
+  // returns false if the delta between the endpoints had to be limited
+  int     mode = 3;
+  auto    quantizeFunc =
+      [](int *q, FloatVector4 e0, FloatVector4 e1, int m)
+      {
+        bool    deltaValid = true;
+        int     b = bc6hModeTable[m * 3];
+        int     d = bc6hModeTable[m * 3 + 1];
+        float   s = float(1 << b) * (1.0f / 65536.0f);
+        for (int i = 0; i < 6; i++)
+        {
+          float   c = (i < 3 ? e0[i] : e1[i - 3]);
+          c = std::min(std::max(c, 0.0f), 65535.0f);
+          q[i] = (b < 16 ? int(c * s) : roundFloat(c));
+          q[i] = std::min< int >(q[i], (1 << b) - 1);
+        }
+        if (d < 10)
+        {
+          // limit the difference between the endpoints to the delta range
+          int     dMax = (1 << (d - 1)) - 1;
+          for (int i = 0; i < 3; i++)
+          {
+            int     tmp = std::min< int >(std::max< int >(q[i + 3],
+                                                          q[i] - dMax),
+                                          q[i] + dMax);
+            deltaValid = deltaValid && (tmp == q[i + 3]);
+            q[i + 3] = tmp;
+          }
+        }
+        return deltaValid;
+      };
+  auto    evalFunc =
+      [&f, &mode](unsigned char *indices, const int *q)
+      {
+        int     b = bc6hModeTable[mode * 3];
+        int     d = bc6hModeTable[mode * 3 + 1];
+        int     c0[3], c1[3];
+        for (int i = 0; i < 6; i++)
+        {
+          // unquantize endpoints
+          int     c = q[i];
+          if (b < 16)
+          {
+            if (c == ((1 << b) - 1))
+              c = 0xFFFF;
+            else if (c)
+              c = ((c << 16) + 0x8000) >> b;
+          }
+          if (i < 3)
+            c0[i] = c;
+          else
+            c1[i - 3] = c;
+        }
+        // decode the palette to linear values, it is not evenly spaced in
+        // this space, so all colors are checked for each pixel
+        FloatVector4  palette[16];
+        for (int k = 0; k < 16; k++)
+        {
+          int     w = bptcWeights4[k];
+          std::uint64_t tmp = 0U;
+          for (int i = 0; i < 3; i++)
+          {
+            int     c = ((64 - w) * c0[i] + w * c1[i] + 32) >> 6;
+            tmp = tmp | (std::uint64_t((c * 31) >> 6) << (i << 4));
+          }
+          palette[k] = FloatVector4::convertFloat16(tmp);
+        }
+        float   err = findIndicesFullSearch(indices, f, palette, 16);
+        if (d < 10)
+        {
+          // the endpoints are swapped if the index of the first pixel is
+          // >= 8, check if the delta is still in range after that
+          int     dMin = -(1 << (d - 1));
+          int     dMax = (1 << (d - 1)) - 1;
+          for (int i = 0; i < 3; i++)
+          {
+            int     tmp = q[i + 3] - q[i];
+            if (indices[0] >= 8)
+              tmp = -tmp;
+            if (tmp < dMin || tmp > dMax)
+              return 1.0e30f;
+          }
+        }
+        return err;
+      };
+  // find the most precise mode that can represent the endpoints, or the one
+  // with the lowest error (also trying limited deltas) if quality is at least
+  // qualityNormal
+  auto    selectModeFunc =
+      [&](int *q, unsigned char *indices, FloatVector4 e0, FloatVector4 e1)
+      {
+        float   minErr = 1.0e30f;
+        int     bestMode = 3;
+        for (mode = 0; mode < 4; mode++)
+        {
+          int     tmpQ[6];
+          unsigned char tmpIndices[16];
+          if (!quantizeFunc(tmpQ, e0, e1, mode) && quality < qualityNormal)
+            continue;
+          float   err = evalFunc(tmpIndices, tmpQ);
+          if (err < minErr)
+          {
+            minErr = err;
+            bestMode = mode;
+            std::memcpy(q, tmpQ, sizeof(tmpQ));
+            std::memcpy(indices, tmpIndices, sizeof(tmpIndices));
+            if (quality < qualityNormal)
+              break;
+          }
+        }
+        mode = bestMode;
+        return minErr;
+      };
+  int     q[6];
+  unsigned char indices[16];
+  float   err = selectModeFunc(q, indices, e0, e1);
+  for (int n = (quality >= qualityNormal ? 2 : 0); n > 0; n--)
+  {
+    int     tmpQ[6];
+    unsigned char tmpIndices[16];
+    int     prvMode = mode;
+    refineEndpoints(e0, e1, u, indices, bptcWeights4Float);
+    float   tmp = selectModeFunc(tmpQ, tmpIndices, e0, e1);
+    if (!(tmp < err))
+    {
+      mode = prvMode;
+      break;
+    }
+    err = tmp;
+    std::memcpy(q, tmpQ, sizeof(q));
+    std::memcpy(indices, tmpIndices, sizeof(indices));
+  }
+  if (quality >= qualityHigh)
+  {
+    int     qMax[6];
+    for (int i = 0; i < 6; i++)
+      qMax[i] = (1 << bc6hModeTable[mode * 3]) - 1;
+    (void) searchNeighbors(q, qMax, 6, indices, err, evalFunc);
+  }
+
+  // the most significant bit of the index of the first pixel must be zero
+  if (indices[0] >= 8)
+  {
+    for (int i = 0; i < 3; i++)
+      std::swap(q[i], q[i + 3]);
+    for (int i = 0; i < 16; i++)
+      indices[i] = (unsigned char) (15 - indices[i]);
+  }
+  int     b = bc6hModeTable[mode * 3];
+  int     d = bc6hModeTable[mode * 3 + 1];
+  std::uint64_t bits[2] = { 0U, 0U };
+  putBits(bits, 0, 5, bc6hModeTable[mode * 3 + 2]);
+  for (int i = 0; i < 3; i++)
+  {
+    // bits 0 to 9 of the first endpoint
+    putBits(bits, i * 10 + 5, 10, std::uint64_t(q[i]));
+    // second endpoint or delta, followed by the remaining bits of the first
+    // endpoint in reverse order
+    if (d >= 10)
+      putBits(bits, i * 10 + 35, 10, std::uint64_t(q[i + 3]));
+    else
+      putBits(bits, i * 10 + 35, d, std::uint64_t(q[i + 3] - q[i]));
+    for (int k = 10; k < b; k++)
+      putBits(bits, i * 10 + 54 - k, 1, std::uint64_t(q[i] >> k));
+  }
+  putBits(bits, 65, 3, indices[0]);
+  for (int i = 1; i < 16; i++)
+    putBits(bits, i * 4 + 64, 4, indices[i]);
+  FileBuffer::writeUInt64Fast(dst, bits[0]);
+  FileBuffer::writeUInt64Fast(dst + 8, bits[1]);
+}
+
+size_t BCnEncoder::getBlockSize(unsigned char dxgiFmt)
+{
+  switch (dxgiFmt)
+  {
+    case 0x47:                  // DXGI_FORMAT_BC1_UNORM
+    case 0x48:                  // DXGI_FORMAT_BC1_UNORM_SRGB
+      return 8;
+    case 0x5F:                  // DXGI_FORMAT_BC6H_UF16
+    case 0x62:                  // DXGI_FORMAT_BC7_UNORM
+    case 0x63:                  // DXGI_FORMAT_BC7_UNORM_SRGB
+      return 16;
+  }
+  return 0;
+}
+
+size_t BCnEncoder::compressImage(
+    unsigned char *dst, const std::uint32_t *src, int w, int h, size_t pitch,
+    unsigned char dxgiFmt, int quality)
+{
+  size_t  blockSize = getBlockSize(dxgiFmt);
+  if (!blockSize || w < 1 || h < 1)
+    return 0;
+  int     blkW = (w + 3) >> 2;
+  int     blkH = (h + 3) >> 2;
+  ThreadPool::getDefaultPool().parallelFor(
+      0, blkH, std::max< int >(64 / blkW, 1),
+      [&](int y0, int y1)
+      {
+        std::uint32_t tmp[16];
+        FloatVector4  c[16];
+        for (int y = y0; y < y1; y++)
+        {
+          unsigned char *p = dst + (size_t(y) * size_t(blkW) * blockSize);
+          for (int x = 0; x < blkW; x++, p = p + blockSize)
+          {
+            // pixels outside the image are replaced with the nearest edge
+            for (int i = 0; i < 16; i++)
+            {
+              int     xc = std::min< int >((x << 2) + (i & 3), w - 1);
+              int     yc = std::min< int >((y << 2) + (i >> 2), h - 1);
+              tmp[i] = src[size_t(yc) * pitch + size_t(xc)];
+            }
+            if (blockSize == 8)
+            {
+              encodeBlock_BC1(p, tmp, quality);
+            }
+            else if (dxgiFmt != 0x5F)
+            {
+              encodeBlock_BC7(p, tmp, quality);
+            }
+            else
+            {
+              for (int i = 0; i < 16; i++)
+                c[i] = FloatVector4::convertR9G9B9E5(tmp[i]);
+              encodeBlock_BC6H(p, c, quality);
+            }
+          }
+        }
+      });
+  return size_t(blkW) * size_t(blkH) * blockSize;
+}
+
@@ -0,0 +1,68 @@
+
+#ifndef BCNENC_HPP_INCLUDED
+#define BCNENC_HPP_INCLUDED
+
+#include "common.hpp"
+#include "fp32vec4.hpp"
+
+// Block compression to BC1, BC6H_UF16 and BC7. All encoders use a single
+// subset per block: BC7 blocks are encoded in mode 6, and BC6H blocks in the
+// one region mode (11 to 14) with the highest precision that can represent
+// the endpoints. The endpoints are initialized from the principal axis of the
+// colors in the block. Each quality setting only accepts a change of the
+// endpoints if it reduces the error of the decoded block (for BC6H, measured
+// on the linear values), so a higher setting is never worse than a lower one.
+class BCnEncoder
+{
+ public:
+  enum
+  {
+    qualityFast = 0,    // principal axis endpoints
+    qualityNormal = 1,  // least squares refinement of the endpoints
+    qualityHigh = 2     // also search neighbors of the quantized endpoints
+  };
+ protected:
+  // sets e0 and e1 to the range of the pixels along their principal axis
+  static void getPrincipalAxisEndpoints(FloatVector4& e0, FloatVector4& e1,
+                                        const FloatVector4 *p);
+  // least squares fit of e0 and e1 to the pixels, with the weight of e1
+  // being t[indices[i]] for pixel i
+  static void refineEndpoints(FloatVector4& e0, FloatVector4& e1,
+                              const FloatVector4 *p,
+                              const unsigned char *indices, const float *t);
+  // find the nearest of n palette colors (in the order of increasing weight
+  // of the second endpoint) for each pixel, returns the sum of squared errors
+  static float findIndices(unsigned char *indices, const FloatVector4 *p,
+                           const FloatVector4 *palette, int n);
+  // same as findIndices(), but compares each pixel with all palette colors,
+  // for palettes that are not evenly spaced along a line
+  static float findIndicesFullSearch(unsigned char *indices,
+                                     const FloatVector4 *p,
+                                     const FloatVector4 *palette, int n);
+ public:
+  // src: 4x4 block of R8G8B8A8 pixels (alpha is ignored), dst: 8 bytes
+  static void encodeBlock_BC1(unsigned char *dst, const std::uint32_t *src,
+                              int quality = qualityNormal);
+  // src: 4x4 block of R8G8B8A8 pixels, dst: 16 bytes
+  static void encodeBlock_BC7(unsigned char *dst, const std::uint32_t *src,
+                              int quality = qualityNormal);
+  // src: 4x4 block of RGB pixels (alpha is ignored), values are clamped to
+  // the range 0.0 to 65504.0, dst: 16 bytes
+  static void encodeBlock_BC6H(unsigned char *dst, const FloatVector4 *src,
+                               int quality = qualityNormal);
+  // returns the size of a compressed block in bytes,
+  // or 0 if dxgiFmt is not supported by compressImage()
+  static size_t getBlockSize(unsigned char dxgiFmt);
+  // Compress a w * h image using the default thread pool. The input format is
+  // R8G8B8A8 for BC1 (DXGI codes 0x47 and 0x48) and BC7 (0x62 and 0x63), and
+  // R9G9B9E5_SHAREDEXP for BC6H_UF16 (0x5F). 'pitch' is the number of pixels
+  // per line in src. Returns the number of bytes written to dst, or 0 if the
+  // format is not supported.
+  static size_t compressImage(unsigned char *dst, const std::uint32_t *src,
+                              int w, int h, size_t pitch,
+                              unsigned char dxgiFmt,
+                              int quality = qualityNormal);
+};
+
+#endif
+
@@ -1,9 +1,17 @@
 
 #include "common.hpp"
 #include "bsmatcdb.hpp"
+#include "threadpool.hpp"
 
+#include <charconv>
 #include <new>
 
+#if defined(_WIN32) || defined(_WIN64)
+#  include <direct.h>
+#else
+#  include <sys/stat.h>
+#endif
+
 #define CDB_COMPONENTS_SORTED   0
 #define CDB_JSON_QUOTE_NUMBERS  1
 #define CDB_SORT_STRUCT_MEMBERS 1
@@ -172,7 +180,8 @@ void BSMaterialsCDB::CDBObject_Compound::insertMapItem(
 }
 
 BSMaterialsCDB::MaterialComponent& BSMaterialsCDB::findComponent(
-    MaterialObject& o, std::uint32_t key, std::uint32_t className)
+    MaterialObject& o, std::uint32_t key, std::uint32_t className,
+    ChunkThreadData *threadData)
 {
   MaterialComponent *prv = nullptr;
   MaterialComponent *i = o.components;
@@ -184,7 +193,10 @@ BSMaterialsCDB::MaterialComponent& BSMaterialsCDB::findComponent(
     prv = i;
   if (i && i->key == key)
     return *i;
-  MaterialComponent *p = allocateObjects< MaterialComponent >(1);
+  MaterialComponent *p =
+      reinterpret_cast< MaterialComponent * >(
+          allocateSpace(sizeof(MaterialComponent), alignof(MaterialComponent),
+                        threadData));
   p->key = key;
   p->className = className;
   p->o = nullptr;
@@ -241,7 +253,8 @@ const std::uint8_t BSMaterialsCDB::cdbObjectSizeAlignTable[38] =
 };
 
 BSMaterialsCDB::CDBObject * BSMaterialsCDB::allocateObject(
-    std::uint32_t itemType, const CDBClassDef *classDef, size_t elementCnt)
+    std::uint32_t itemType, const CDBClassDef *classDef, size_t elementCnt,
+    ChunkThreadData *threadData)
 {
   size_t  dataSize, alignSize;
   size_t  childCnt = 0;
@@ -268,7 +281,8 @@ BSMaterialsCDB::CDBObject * BSMaterialsCDB::allocateObject(
     alignSize = cdbObjectSizeAlignTable[(itemType << 1) + 1];
   }
   CDBObject *o =
-      reinterpret_cast< CDBObject * >(allocateSpace(dataSize, alignSize));
+      reinterpret_cast< CDBObject * >(
+          allocateSpace(dataSize, alignSize, threadData));
   o->type = std::uint16_t(itemType);
   o->childCnt = std::uint16_t(childCnt);
   if (itemType == BSReflStream::String_String)
@@ -288,7 +302,7 @@ BSMaterialsCDB::CDBObject * BSMaterialsCDB::allocateObject(
 
 void BSMaterialsCDB::copyObject(CDBObject& o)
 {
-  o.refCnt++;
+  addObjectRef(o);
   CDBObject **p = o.children();
   for (CDBObject **endp = p + o.childCnt; p < endp; p++)
   {
@@ -410,8 +424,7 @@ void BSMaterialsCDB::deleteObject(CDBObject& o)
     if (o.children()[i])
       deleteObject(*(o.children()[i]));
   }
-  if (o.refCnt)
-    o.refCnt--;
+  (void) releaseObjectRef(o);
 }
 
 void BSMaterialsCDB::deleteObject(MaterialObject& o)
@@ -425,11 +438,10 @@ void BSMaterialsCDB::deleteObject(MaterialObject& o)
 
 void BSMaterialsCDB::loadItem(
     CDBObject*& o, BSReflStream& cdbFile, BSReflStream::Chunk& chunkBuf,
-    bool isDiff, std::uint32_t itemType)
+    bool isDiff, std::uint32_t itemType, ChunkThreadData *threadData)
 {
-  if (o && o->refCnt)
+  if (o && releaseObjectRef(*o))
   {
-    o->refCnt--;
     size_t  dataSize, alignSize;
     if (o->type > BSReflStream::String_Unknown)
     {
@@ -445,7 +457,8 @@ void BSMaterialsCDB::loadItem(
     if (childCnt > 1)
       dataSize += (sizeof(CDBObject *) * (childCnt - 1));
     CDBObject *p =
-        reinterpret_cast< CDBObject * >(allocateSpace(dataSize, alignSize));
+        reinterpret_cast< CDBObject * >(
+            allocateSpace(dataSize, alignSize, threadData));
     std::memcpy(p, o, dataSize);
     o = p;
     o->refCnt = 0;
@@ -462,7 +475,7 @@ void BSMaterialsCDB::loadItem(
     if (!(itemType == BSReflStream::String_List ||
           itemType == BSReflStream::String_Map))
     {
-      o = allocateObject(itemType, classDef, 0);
+      o = allocateObject(itemType, classDef, 0, threadData);
     }
   }
   if (itemType > BSReflStream::String_Unknown)
@@ -494,7 +507,7 @@ void BSMaterialsCDB::loadItem(
              userBuf.getFieldNumber(n, nMax, isDiff); )
         {
           loadItem(o->children()[n], cdbFile, userBuf, isDiff,
-                   classDef->fields[n].type);
+                   classDef->fields[n].type, threadData);
         }
       }
       else if (className2 < BSReflStream::String_Unknown)
@@ -507,7 +520,8 @@ void BSMaterialsCDB::loadItem(
         unsigned int  n = 0U;
         do
         {
-          loadItem(o->children()[n], cdbFile, userBuf, isDiff, className2);
+          loadItem(o->children()[n], cdbFile, userBuf, isDiff, className2,
+                   threadData);
           className2 = cdbFile.findString(userBuf.readUInt32());
         }
         while (++n < nMax && className2 < BSReflStream::String_Unknown);
@@ -532,7 +546,7 @@ void BSMaterialsCDB::loadItem(
     for (unsigned int n = 0U - 1U; chunkBuf.getFieldNumber(n, nMax, isDiff); )
     {
       loadItem(o->children()[n], cdbFile, chunkBuf, isDiff,
-               classDef->fields[n].type);
+               classDef->fields[n].type, threadData);
     }
     return;
   }
@@ -548,7 +562,15 @@ void BSMaterialsCDB::loadItem(
         buf2.setPosition(buf2.getPosition() + len);
         if (len > 0 && s[len - 1] == '\0')
           len--;
-        static_cast< CDBObject_String * >(o)->value = storeString(s, len);
+        if (!threadData) [[likely]]
+        {
+          static_cast< CDBObject_String * >(o)->value = storeString(s, len);
+        }
+        else
+        {
+          std::unique_lock< std::mutex >  lock(*(threadData->stringMutex));
+          static_cast< CDBObject_String * >(o)->value = storeString(s, len);
+        }
       }
       break;
     case BSReflStream::String_List:
@@ -593,7 +615,8 @@ void BSMaterialsCDB::loadItem(
         {
           if (listSize > 0xFFFFU)
             errorMessage("invalid list or map size in CDB file");
-          CDBObject *p = allocateObject(itemType, classDef, size_t(listSize));
+          CDBObject *p = allocateObject(itemType, classDef, size_t(listSize),
+                                        threadData);
           if (appendingItems)
           {
             std::uint32_t prvSize = o->childCnt;
@@ -608,7 +631,8 @@ void BSMaterialsCDB::loadItem(
         {
           CDBObject_Compound  *p = static_cast< CDBObject_Compound * >(o);
           CDBObject *value = nullptr;
-          loadItem(value, cdbFile, listBuf, isDiff, classNames[n & 1U]);
+          loadItem(value, cdbFile, listBuf, isDiff, classNames[n & 1U],
+                   threadData);
           if (!isMap)
             p->insertListItem(value, listSize);
           else if (!(n & 1U))
@@ -622,7 +646,8 @@ void BSMaterialsCDB::loadItem(
     case BSReflStream::String_Ref:
       {
         std::uint32_t refType = cdbFile.findString(buf2.readUInt32());
-        loadItem(o->children()[0], cdbFile, chunkBuf, isDiff, refType);
+        loadItem(o->children()[0], cdbFile, chunkBuf, isDiff, refType,
+                 threadData);
         return;
       }
       break;
@@ -669,10 +694,165 @@ void BSMaterialsCDB::loadItem(
   }
 }
 
+struct BSMaterialsCDB::ComponentChunk
+{
+  // position and chunksRemaining of cdbFile before reading the chunk
+  size_t  filePos;
+  unsigned int  chunksRemaining;
+  bool    isDiff;
+  std::uint32_t key;
+  std::uint32_t className;
+  MaterialObject  *o;
+};
+
+void BSMaterialsCDB::loadComponentChunk(
+    BSReflStream& cdbFile, const ComponentChunk& c, ChunkThreadData *threadData)
+{
+  cdbFile.setPosition(c.filePos);
+  cdbFile.chunksRemaining = c.chunksRemaining;
+  BSReflStream::Chunk chunkBuf;
+  (void) cdbFile.readChunk(chunkBuf);
+  (void) chunkBuf.readUInt32Fast();     // class name
+  MaterialObject  *i = c.o;
+  if (i->baseObject && i->baseObject->baseObject)
+    copyBaseObject(*i);
+  loadItem(findComponent(*i, c.key, c.className, threadData).o,
+           cdbFile, chunkBuf, c.isDiff, c.className, threadData);
+}
+
+void BSMaterialsCDB::loadComponentsThread(
+    BSMaterialsCDB *cdb, const BSReflStream *cdbFile,
+    ChunkThreadData *threadData,
+    const std::vector< std::pair< size_t, size_t > > *objectRanges,
+    const std::vector< ComponentChunk > *chunks,
+    std::atomic< size_t > *nextRange, std::exception_ptr *err)
+{
+  try
+  {
+    BSReflStream  tmpFile(cdbFile->data(), cdbFile->size());
+    while (true)
+    {
+      size_t  n = nextRange->fetch_add(1);
+      if (n >= objectRanges->size())
+        break;
+      for (size_t i = (*objectRanges)[n].first;
+           i < (*objectRanges)[n].second; i++)
+      {
+        cdb->loadComponentChunk(tmpFile, (*chunks)[i], threadData);
+      }
+    }
+  }
+  catch (...)
+  {
+    *err = std::current_exception();
+    // make the other threads stop
+    nextRange->store(objectRanges->size());
+  }
+}
+
+void BSMaterialsCDB::loadComponents(
+    BSReflStream& cdbFile, std::vector< ComponentChunk >& chunks,
+    int threadCnt)
+{
+  size_t  savedPos = cdbFile.getPosition();
+  unsigned int  savedChunksRemaining = cdbFile.chunksRemaining;
+  ThreadPool& threadPool = ThreadPool::getDefaultPool();
+  if (threadCnt <= 0)
+    threadCnt = threadPool.getThreadCount();
+  threadCnt = std::min< int >(threadCnt, 64);
+  if (chunks.size() < 1024)
+    threadCnt = 1;
+  // 1: the object has chunks in this batch, 2: it is loaded serially
+  std::vector< unsigned char >  objectFlags;
+  if (threadCnt > 1)
+  {
+    objectFlags.resize(objectTableSize, 0);
+    for (size_t i = 0; i < chunks.size(); i++)
+      objectFlags[chunks[i].o->dbID] = 1;
+    for (size_t i = 0; i < chunks.size(); i++)
+    {
+      // objects that copy the data of their base objects need to be loaded
+      // in file order, together with all bases that also have chunks, so
+      // that the data copied is the same as with a single thread
+      const MaterialObject  *o = chunks[i].o;
+      if (!(o->baseObject && o->baseObject->baseObject))
+        continue;
+      for ( ; o; o = o->baseObject)
+      {
+        if (findObject(o->dbID) == o && objectFlags[o->dbID])
+          objectFlags[o->dbID] = 2;
+      }
+    }
+    // the remaining objects are independent, and are loaded in parallel
+    std::vector< ComponentChunk > parallelChunks;
+    for (size_t i = 0; i < chunks.size(); i++)
+    {
+      if (objectFlags[chunks[i].o->dbID] == 1)
+        parallelChunks.push_back(chunks[i]);
+    }
+    std::stable_sort(parallelChunks.begin(), parallelChunks.end(),
+                     [](const ComponentChunk& a, const ComponentChunk& b)
+                     {
+                       return (a.o->dbID < b.o->dbID);
+                     });
+    std::vector< std::pair< size_t, size_t > >  objectRanges;
+    for (size_t i = 0; i < parallelChunks.size(); )
+    {
+      size_t  j = i + 1;
+      while (j < parallelChunks.size() &&
+             parallelChunks[j].o == parallelChunks[i].o)
+      {
+        j++;
+      }
+      objectRanges.emplace_back(i, j);
+      i = j;
+    }
+    std::mutex  stringMutex;
+    std::vector< ChunkThreadData >  threadData((unsigned int) threadCnt);
+    std::vector< std::exception_ptr > errs((unsigned int) threadCnt);
+    std::atomic< size_t > nextRange(0);
+    for (int i = 0; i < threadCnt; i++)
+      threadData[i].stringMutex = &stringMutex;
+    // each index of the loop is a worker with its own object buffers
+    threadPool.parallelFor(
+        0, threadCnt, 1,
+        [&](int i0, int i1)
+        {
+          for (int i = i0; i < i1; i++)
+          {
+            loadComponentsThread(this, &cdbFile, &(threadData[i]),
+                                 &objectRanges, &parallelChunks, &nextRange,
+                                 &(errs[i]));
+          }
+        });
+    for (int i = 0; i < threadCnt; i++)
+    {
+      for (size_t j = 0; j < 3; j++)
+        objectBuffers[j].moveBuffers(threadData[i].objectBuffers[j]);
+    }
+    for (int i = 0; i < threadCnt; i++)
+    {
+      if (errs[i])
+        std::rethrow_exception(errs[i]);
+    }
+  }
+  for (size_t i = 0; i < chunks.size(); i++)
+  {
+    if (threadCnt <= 1 || objectFlags[chunks[i].o->dbID] == 2)
+      loadComponentChunk(cdbFile, chunks[i]);
+  }
+  chunks.clear();
+  cdbFile.setPosition(savedPos);
+  cdbFile.chunksRemaining = savedChunksRemaining;
+}
+
 void BSMaterialsCDB::readAllChunks(BSReflStream& cdbFile)
 {
   std::vector< MaterialObject * > objectTable;
   std::vector< std::pair< std::uint32_t, std::uint32_t > >  componentInfo;
+  // OBJT and DIFF chunks are indexed first, and decoded in loadComponents()
+  std::vector< ComponentChunk > componentChunks;
+  int     threadCnt = 0;
   BSReflStream::Chunk chunkBuf;
   unsigned int  chunkType;
   unsigned int  objectInfoSize = 21;
@@ -680,8 +860,12 @@ void BSMaterialsCDB::readAllChunks(BSReflStream& cdbFile)
   size_t  componentCnt = 0;
   if (cdbFile.size() > 0x03FFFFFF && storedStrings.hashMask < 0x000FFFFF)
     storedStrings.expandBuffer(0x000FFFFF);
-  while ((chunkType = cdbFile.readChunk(chunkBuf)) != 0U)
+  while (true)
   {
+    size_t  chunkPos = cdbFile.getPosition();
+    unsigned int  chunksRemaining = cdbFile.chunksRemaining;
+    if (!(chunkType = cdbFile.readChunk(chunkBuf)))
+      break;
     std::uint32_t className = BSReflStream::String_None;
     if (chunkType != BSReflStream::ChunkType_TYPE &&
         chunkBuf.size() >= 4) [[likely]]
@@ -700,15 +884,33 @@ void BSMaterialsCDB::readAllChunks(BSReflStream& cdbFile)
         MaterialObject  *i = findObject(dbID);
         if (i && className > BSReflStream::String_Unknown)
         {
-          if (i->baseObject && i->baseObject->baseObject)
-            copyBaseObject(*i);
-          loadItem(findComponent(*i, key, className).o,
-                   cdbFile, chunkBuf, isDiff, className);
+          ComponentChunk& c = componentChunks.emplace_back();
+          c.filePos = chunkPos;
+          c.chunksRemaining = chunksRemaining;
+          c.isDiff = isDiff;
+          c.key = key;
+          c.className = className;
+          c.o = i;
         }
         componentID++;
       }
       continue;
     }
+    if (!componentChunks.empty()) [[unlikely]]
+    {
+      // class definitions and index lists change the state used by
+      // loadItem(), so the components indexed so far are loaded first
+      if (chunkType == BSReflStream::ChunkType_TYPE ||
+          (chunkType == BSReflStream::ChunkType_LIST &&
+           std::uint32_t(className
+                         - BSReflStream::String_BSComponentDB2_DBFileIndex)
+           <= 4U))
+      {
+        loadComponents(cdbFile, componentChunks, threadCnt);
+        // only the first batch is guaranteed to contain no shared data
+        threadCnt = 1;
+      }
+    }
     if (chunkType == BSReflStream::ChunkType_TYPE) [[unlikely]]
     {
       for (size_t classCnt = chunkBuf.readUInt32(); classCnt > 0; classCnt--)
@@ -870,6 +1072,8 @@ void BSMaterialsCDB::readAllChunks(BSReflStream& cdbFile)
       }
     }
   }
+  if (!componentChunks.empty())
+    loadComponents(cdbFile, componentChunks, threadCnt);
   for (MaterialObject *p : objectTable)
   {
     if (!p)
@@ -891,6 +1095,7 @@ void BSMaterialsCDB::clear()
         deleteObject(*(matFileObjectMap.buf[i]));
     }
     parentDB = nullptr;
+    isOverlay = false;
   }
   classes = nullptr;
   objectTablePtr = nullptr;
@@ -943,7 +1148,7 @@ BSMaterialsCDB::MatObjectHashMap::MatObjectHashMap()
     hashMask(0),
     size(0)
 {
-  expandBuffer();
+  expandBuffer(0x0FFF);
 }
 
 BSMaterialsCDB::MatObjectHashMap::~MatObjectHashMap()
@@ -992,9 +1197,9 @@ const BSMaterialsCDB::MaterialObject *
   return nullptr;
 }
 
-void BSMaterialsCDB::MatObjectHashMap::expandBuffer()
+void BSMaterialsCDB::MatObjectHashMap::expandBuffer(size_t minMask)
 {
-  size_t  m = (hashMask << 1) | 0x001FFFFF;
+  size_t  m = (hashMask << 1) | minMask;
   MaterialObject  **newBuf = reinterpret_cast< MaterialObject ** >(
                                  std::calloc(m + 1, sizeof(MaterialObject *)));
   if (!newBuf)
@@ -1082,12 +1287,104 @@ void BSMaterialsCDB::JSONMaterialHashMap::expandBuffer()
   hashMask = m;
 }
 
+static inline void appendJSONIndent(std::string& s, int indentCnt)
+{
+  s += '\n';
+  s.append(size_t(indentCnt), ' ');
+}
+
+// names from BSReflStream::stringTable never need to be escaped
+static inline void appendJSONName(std::string& s, const char *name)
+{
+  s += '"';
+  s += name;
+  s += '"';
+}
+
+static void appendJSONString(std::string& s, const char *p)
+{
+  s += '"';
+  while (true)
+  {
+    // copy the longest run of characters that do not need escaping at once
+    size_t  n = 0;
+    while ((unsigned char) p[n] >= 0x20 && p[n] != '"' && p[n] != '\\')
+      n++;
+    s.append(p, n);
+    p = p + n;
+    char    c = *p;
+    if (!c)
+      break;
+    p++;
+    s += '\\';
+    switch (c)
+    {
+      case '\b':
+        c = 'b';
+        break;
+      case '\t':
+        c = 't';
+        break;
+      case '\n':
+        c = 'n';
+        break;
+      case '\f':
+        c = 'f';
+        break;
+      case '\r':
+        c = 'r';
+        break;
+      default:
+        if ((unsigned char) c < 0x20)
+        {
+          s += "u00";
+          s += "0123456789ABCDEF"[(unsigned char) c >> 4];
+          c = "0123456789ABCDEF"[c & 15];
+        }
+        break;
+    }
+    s += c;
+  }
+  s += '"';
+}
+
+static void appendJSONResourceID(std::string& s,
+                                 const BSMaterialsCDB::BSResourceID& id)
+{
+  char    tmpBuf[32];
+  std::memcpy(tmpBuf, "\"res:", 5);
+  char    *p = tmpBuf + 5;
+  std::uint32_t v[3] = { id.dir, id.file, id.ext };
+  for (int i = 0; i < 3; i++)
+  {
+    for (int j = 28; j >= 0; j = j - 4)
+      *(p++) = "0123456789ABCDEF"[(v[i] >> j) & 15U];
+    *(p++) = (i < 2 ? ':' : '"');
+  }
+  s.append(tmpBuf, 32);
+}
+
+// floating point values are printed in the shortest form that converts back
+// to the same value
+template< typename T >
+static inline void appendJSONNumber(std::string& s, T n, bool quoted)
+{
+  char    tmpBuf[48];
+  char    *p = tmpBuf;
+  if (quoted)
+    *(p++) = '"';
+  p = std::to_chars(p, tmpBuf + 47, n).ptr;
+  if (quoted)
+    *(p++) = '"';
+  s.append(tmpBuf, size_t(p - tmpBuf));
+}
+
 void BSMaterialsCDB::dumpObject(
     std::string& s, const CDBObject *o, int indentCnt) const
 {
   if (!o)
   {
-    printToString(s, "null");
+    s += "null";
     return;
   }
   if (o->type > BSReflStream::String_Unknown)
@@ -1100,21 +1397,16 @@ void BSMaterialsCDB::dumpObject(
           classDef->fields[0].type == BSReflStream::String_UInt32)
       {
         if (!p)
-        {
-          printToString(s, "\"\"");
-        }
+          s += "\"\"";
         else
-        {
-          printToString(s, "\"res:%08X:%08X:%08X\"",
-                        (unsigned int) p->persistentID.dir,
-                        (unsigned int) p->persistentID.file,
-                        (unsigned int) p->persistentID.ext);
-        }
+          appendJSONResourceID(s, p->persistentID);
         return;
       }
     }
     // structure
-    printToString(s, "{\n%*s\"Data\": {", indentCnt + 2, "");
+    s += '{';
+    appendJSONIndent(s, indentCnt + 2);
+    s += "\"Data\": {";
 #if CDB_SORT_STRUCT_MEMBERS
     int     prvFieldNameID = -1;
     while (true)
@@ -1137,10 +1429,11 @@ void BSMaterialsCDB::dumpObject(
       if (fieldNum < 0)
         break;
       prvFieldNameID = fieldNameID;
-      printToString(s, "\n%*s\"%s\": ",
-                    indentCnt + 4, "", BSReflStream::stringTable[fieldNameID]);
+      appendJSONIndent(s, indentCnt + 4);
+      appendJSONName(s, BSReflStream::stringTable[fieldNameID]);
+      s += ": ";
       dumpObject(s, o->children()[fieldNum], indentCnt + 4);
-      printToString(s, ",");
+      s += ',';
     }
 #else
     for (std::uint32_t fieldNum = 0U; fieldNum < o->childCnt; fieldNum++)
@@ -1153,76 +1446,48 @@ void BSMaterialsCDB::dumpObject(
         fieldNameStr =
             BSReflStream::stringTable[classDef->fields[fieldNum].name];
       }
-      printToString(s, "\n%*s\"%s\": ", indentCnt + 4, "", fieldNameStr);
+      appendJSONIndent(s, indentCnt + 4);
+      appendJSONName(s, fieldNameStr);
+      s += ": ";
       dumpObject(s, o->children()[fieldNum], indentCnt + 4);
-      printToString(s, ",");
+      s += ',';
     }
 #endif
     if (s.ends_with(','))
     {
       s[s.length() - 1] = '\n';
-      printToString(s, "%*s", indentCnt + 2, "");
+      s.append(size_t(indentCnt + 2), ' ');
     }
-    printToString(s, "},\n%*s\"Type\": \"%s\"\n",
-                  indentCnt + 2, "", BSReflStream::stringTable[o->type]);
-    printToString(s, "%*s}", indentCnt, "");
+    s += "},";
+    appendJSONIndent(s, indentCnt + 2);
+    s += "\"Type\": ";
+    appendJSONName(s, BSReflStream::stringTable[o->type]);
+    appendJSONIndent(s, indentCnt);
+    s += '}';
     return;
   }
   switch (o->type)
   {
     case BSReflStream::String_None:
-      printToString(s, "null");
+      s += "null";
       break;
     case BSReflStream::String_String:
-      s += '"';
-      for (size_t i = 0; o->stringValue()[i]; i++)
-      {
-        char    c = o->stringValue()[i];
-        if ((unsigned char) c < 0x20 || c == '"' || c == '\\')
-        {
-          s += '\\';
-          switch (c)
-          {
-            case '\b':
-              c = 'b';
-              break;
-            case '\t':
-              c = 't';
-              break;
-            case '\n':
-              c = 'n';
-              break;
-            case '\f':
-              c = 'f';
-              break;
-            case '\r':
-              c = 'r';
-              break;
-            default:
-              if ((unsigned char) c < 0x20)
-              {
-                printToString(s, "u%04X", (unsigned int) c);
-                continue;
-              }
-              break;
-          }
-        }
-        s += c;
-      }
-      s += '"';
+      appendJSONString(s, o->stringValue());
       break;
     case BSReflStream::String_List:
-      printToString(s, "{\n%*s\"Data\": [", indentCnt + 2, "");
+      s += '{';
+      appendJSONIndent(s, indentCnt + 2);
+      s += "\"Data\": [";
       for (std::uint32_t i = 0U; i < o->childCnt; i++)
       {
-        printToString(s, "\n%*s", indentCnt + 4, "");
+        appendJSONIndent(s, indentCnt + 4);
         dumpObject(s, o->children()[i], indentCnt + 4);
         if ((i + 1U) < o->childCnt)
-          printToString(s, ",");
+          s += ',';
         else
-          printToString(s, "\n%*s", indentCnt + 2, "");
+          appendJSONIndent(s, indentCnt + 2);
       }
-      printToString(s, "],\n");
+      s += "],\n";
       if (o->childCnt)
       {
         std::uint32_t elementType = 0U;
@@ -1234,98 +1499,95 @@ void BSMaterialsCDB::dumpObject(
           elementTypeStr = (elementType == BSReflStream::String_String ?
                             "BSFixedString" : "<collection>");
         }
-        printToString(s, "%*s\"ElementType\": \"%s\",\n",
-                      indentCnt + 2, "", elementTypeStr);
+        s.append(size_t(indentCnt + 2), ' ');
+        s += "\"ElementType\": ";
+        appendJSONName(s, elementTypeStr);
+        s += ",\n";
       }
-      printToString(s, "%*s\"Type\": \"<collection>\"\n", indentCnt + 2, "");
-      printToString(s, "%*s}", indentCnt, "");
+      s.append(size_t(indentCnt + 2), ' ');
+      s += "\"Type\": \"<collection>\"";
+      appendJSONIndent(s, indentCnt);
+      s += '}';
       break;
     case BSReflStream::String_Map:
-      printToString(s, "{\n%*s\"Data\": [", indentCnt + 2, "");
+      s += '{';
+      appendJSONIndent(s, indentCnt + 2);
+      s += "\"Data\": [";
       for (std::uint32_t i = 0U; i < o->childCnt; i++)
       {
-        printToString(s, "\n%*s{", indentCnt + 4, "");
-        printToString(s, "\n%*s\"Data\": {", indentCnt + 6, "");
-        printToString(s, "\n%*s\"Key\": ", indentCnt + 8, "");
+        appendJSONIndent(s, indentCnt + 4);
+        s += '{';
+        appendJSONIndent(s, indentCnt + 6);
+        s += "\"Data\": {";
+        appendJSONIndent(s, indentCnt + 8);
+        s += "\"Key\": ";
         dumpObject(s, o->children()[i], indentCnt + 8);
         i++;
-        printToString(s, ",\n%*s\"Value\": ", indentCnt + 8, "");
+        s += ',';
+        appendJSONIndent(s, indentCnt + 8);
+        s += "\"Value\": ";
         dumpObject(s, o->children()[i], indentCnt + 8);
-        printToString(s, "\n%*s},", indentCnt + 6, "");
-        printToString(s, "\n%*s\"Type\": \"StdMapType::Pair\"\n",
-                      indentCnt + 6, "");
-        printToString(s, "%*s}", indentCnt + 4, "");
+        appendJSONIndent(s, indentCnt + 6);
+        s += "},";
+        appendJSONIndent(s, indentCnt + 6);
+        s += "\"Type\": \"StdMapType::Pair\"";
+        appendJSONIndent(s, indentCnt + 4);
+        s += '}';
         if ((i + 1U) < o->childCnt)
-          printToString(s, ",");
+          s += ',';
         else
-          printToString(s, "\n%*s", indentCnt + 2, "");
+          appendJSONIndent(s, indentCnt + 2);
       }
-      printToString(s, "],\n%*s\"ElementType\": \"StdMapType::Pair\",\n",
-                    indentCnt + 2, "");
-      printToString(s, "%*s\"Type\": \"<collection>\"\n", indentCnt + 2, "");
-      printToString(s, "%*s}", indentCnt, "");
+      s += "],";
+      appendJSONIndent(s, indentCnt + 2);
+      s += "\"ElementType\": \"StdMapType::Pair\",";
+      appendJSONIndent(s, indentCnt + 2);
+      s += "\"Type\": \"<collection>\"";
+      appendJSONIndent(s, indentCnt);
+      s += '}';
       break;
     case BSReflStream::String_Ref:
-      printToString(s, "{\n%*s\"Data\": ", indentCnt + 2, "");
+      s += '{';
+      appendJSONIndent(s, indentCnt + 2);
+      s += "\"Data\": ";
       dumpObject(s, o->children()[0], indentCnt + 2);
-      printToString(s, ",\n%*s\"Type\": \"<ref>\"\n", indentCnt + 2, "");
-      printToString(s, "%*s}", indentCnt, "");
+      s += ',';
+      appendJSONIndent(s, indentCnt + 2);
+      s += "\"Type\": \"<ref>\"";
+      appendJSONIndent(s, indentCnt);
+      s += '}';
       break;
-#if CDB_JSON_QUOTE_NUMBERS
     case BSReflStream::String_Int8:
     case BSReflStream::String_Int16:
     case BSReflStream::String_Int32:
-      printToString(s, "\"%d\"", int(o->intValue()));
+      appendJSONNumber(s, o->intValue(), bool(CDB_JSON_QUOTE_NUMBERS));
       break;
     case BSReflStream::String_UInt8:
     case BSReflStream::String_UInt16:
     case BSReflStream::String_UInt32:
-      printToString(s, "\"%u\"", (unsigned int) o->uintValue());
+      appendJSONNumber(s, o->uintValue(), bool(CDB_JSON_QUOTE_NUMBERS));
       break;
     case BSReflStream::String_Int64:
-      printToString(s, "\"%lld\"", (long long) o->int64Value());
+      appendJSONNumber(s, o->int64Value(), true);
       break;
     case BSReflStream::String_UInt64:
-      printToString(s, "\"%llu\"", (unsigned long long) o->uint64Value());
+      appendJSONNumber(s, o->uint64Value(), true);
       break;
     case BSReflStream::String_Bool:
-      printToString(s, "%s", (!o->boolValue() ? "\"false\"" : "\"true\""));
-      break;
-    case BSReflStream::String_Float:
-      printToString(s, "\"%.7g\"", o->floatValue());
-      break;
-    case BSReflStream::String_Double:
-      printToString(s, "\"%.14g\"", o->doubleValue());
-      break;
+#if CDB_JSON_QUOTE_NUMBERS
+      s += (!o->boolValue() ? "\"false\"" : "\"true\"");
 #else
-    case BSReflStream::String_Int8:
-    case BSReflStream::String_Int16:
-    case BSReflStream::String_Int32:
-      printToString(s, "%d", int(o->intValue()));
-      break;
-    case BSReflStream::String_UInt8:
-    case BSReflStream::String_UInt16:
-    case BSReflStream::String_UInt32:
-      printToString(s, "%u", (unsigned int) o->uintValue());
-      break;
-    case BSReflStream::String_Int64:
-      printToString(s, "\"%lld\"", (long long) o->int64Value());
-      break;
-    case BSReflStream::String_UInt64:
-      printToString(s, "\"%llu\"", (unsigned long long) o->uint64Value());
-      break;
-    case BSReflStream::String_Bool:
-      printToString(s, "%s", (!o->boolValue() ? "false" : "true"));
+      s += (!o->boolValue() ? "false" : "true");
+#endif
       break;
     case BSReflStream::String_Float:
-      printToString(s, "%.7g", o->floatValue());
+      appendJSONNumber(s, o->floatValue(), bool(CDB_JSON_QUOTE_NUMBERS));
       break;
     case BSReflStream::String_Double:
-      printToString(s, "%.14g", o->doubleValue());
+      appendJSONNumber(s, o->doubleValue(), bool(CDB_JSON_QUOTE_NUMBERS));
       break;
-#endif
     default:
-      printToString(s, "\"<unknown>\"");
+      s += "\"<unknown>\"";
       break;
   }
 }
@@ -1333,7 +1595,7 @@ void BSMaterialsCDB::dumpObject(
 void BSMaterialsCDB::dumpObject(std::string& jsonBuf, const MaterialObject *o,
                                 BSResourceID matObjectID) const
 {
-  printToString(jsonBuf, "    {\n      \"Components\": [\n");
+  jsonBuf += "    {\n      \"Components\": [\n";
   for (const MaterialComponent *i = o->components; i; i = i->next)
   {
     jsonBuf += "        ";
@@ -1343,20 +1605,20 @@ void BSMaterialsCDB::dumpObject(std::string& jsonBuf, const MaterialObject *o,
     size_t  n = jsonBuf.rfind("\n          \"Type\"");
     if (n != std::string::npos && n > prvLen)
     {
-      char    tmpBuf[32];
-      (void) std::snprintf(tmpBuf, 32, "\n          \"Index\": %u,",
-                           (unsigned int) (i->key & 0xFFFFU));
+      std::string tmpBuf("\n          \"Index\": ");
+      appendJSONNumber(tmpBuf, (unsigned int) (i->key & 0xFFFFU), false);
+      tmpBuf += ',';
       jsonBuf.insert(n, tmpBuf);
-      printToString(jsonBuf, ",\n");
+      jsonBuf += ",\n";
     }
 #else
     dumpObject(jsonBuf, i->o, 8);
     if (jsonBuf.ends_with("\n        }"))
     {
       jsonBuf.resize(jsonBuf.length() - 10);
-      printToString(jsonBuf, ",\n          \"Index\": %u\n",
-                    (unsigned int) (i->key & 0xFFFFU));
-      printToString(jsonBuf, "        },\n");
+      jsonBuf += ",\n          \"Index\": ";
+      appendJSONNumber(jsonBuf, (unsigned int) (i->key & 0xFFFFU), false);
+      jsonBuf += "\n        },\n";
     }
 #endif
   }
@@ -1365,34 +1627,27 @@ void BSMaterialsCDB::dumpObject(std::string& jsonBuf, const MaterialObject *o,
     jsonBuf.resize(jsonBuf.length() - 1);
     jsonBuf[jsonBuf.length() - 1] = '\n';
   }
-  printToString(jsonBuf, "      ],\n");
+  jsonBuf += "      ],\n";
   if (o->parent)
   {
-    printToString(jsonBuf, "      \"Edges\": [\n");
-    printToString(jsonBuf, "        {\n");
-    printToString(jsonBuf, "          \"EdgeIndex\": 0,\n");
+    jsonBuf += "      \"Edges\": [\n"
+               "        {\n"
+               "          \"EdgeIndex\": 0,\n"
+               "          \"To\": ";
     if (o->parent->persistentID == matObjectID)
-    {
-      printToString(jsonBuf, "          \"To\": \"<this>\",\n");
-    }
+      jsonBuf += "\"<this>\"";
     else
-    {
-      printToString(jsonBuf, "          \"To\": \"res:%08X:%08X:%08X\",\n",
-                    (unsigned int) o->parent->persistentID.dir,
-                    (unsigned int) o->parent->persistentID.file,
-                    (unsigned int) o->parent->persistentID.ext);
-    }
-    printToString(jsonBuf,
-                  "          \"Type\": \"BSComponentDB2::OuterEdge\"\n");
-    printToString(jsonBuf, "        }\n");
-    printToString(jsonBuf, "      ],\n");
+      appendJSONResourceID(jsonBuf, o->parent->persistentID);
+    jsonBuf += ",\n"
+               "          \"Type\": \"BSComponentDB2::OuterEdge\"\n"
+               "        }\n"
+               "      ],\n";
   }
   if (o->persistentID != matObjectID)
   {
-    printToString(jsonBuf, "      \"ID\": \"res:%08X:%08X:%08X\",\n",
-                  (unsigned int) o->persistentID.dir,
-                  (unsigned int) o->persistentID.file,
-                  (unsigned int) o->persistentID.ext);
+    jsonBuf += "      \"ID\": ";
+    appendJSONResourceID(jsonBuf, o->persistentID);
+    jsonBuf += ",\n";
   }
   const MaterialObject  *p = o->baseObject;
   const char  *parentStr = "";
@@ -1411,7 +1666,9 @@ void BSMaterialsCDB::dumpObject(std::string& jsonBuf, const MaterialObject *o,
     else if (p->persistentID.file == 0x4298BB09U)
       parentStr = "materials\\\\layered\\\\root\\\\uvstreams.mat";
   }
-  printToString(jsonBuf, "      \"Parent\": \"%s\"\n    },\n", parentStr);
+  jsonBuf += "      \"Parent\": ";
+  appendJSONName(jsonBuf, parentStr);
+  jsonBuf += "\n    },\n";
 }
 
 void BSMaterialsCDB::getMaterials(
@@ -1423,23 +1680,43 @@ void BSMaterialsCDB::getMaterials(
     if (o && o->persistentID.ext == 0x0074616D && !o->parent)   // "mat\0"
       materials.push_back(o);
   }
+  if (isOverlay)
+  {
+    // add the materials of the parent database that are not overridden
+    size_t  n = materials.size();
+    parentDB->getMaterials(materials);
+    size_t  j = n;
+    for (size_t i = n; i < materials.size(); i++)
+    {
+      if (!matFileObjectMap.findObject(materials[i]->persistentID))
+        materials[j++] = materials[i];
+    }
+    materials.resize(j);
+  }
 }
 
-void BSMaterialsCDB::getJSONMaterial(
-    std::string& jsonBuf, const std::string_view& materialPath) const
+bool BSMaterialsCDB::writeJSONMaterial(
+    std::string& jsonBuf, const std::string_view& materialPath,
+    JSONWriteFunction writeFunc, void *writeFuncData) const
 {
   jsonBuf.clear();
   if (materialPath.empty())
-    return;
+    return false;
   BSResourceID  matObjectID(materialPath);
   const MaterialObject  *i = getMaterial(matObjectID);
   if (!i)
-    return;
+    return false;
   std::map< BSResourceID, const MaterialObject * >  jsonObjects;
   jsonBuf = "{\n  \"Objects\": [\n";
   for ( ; i; i = i->getNextChildObject())
   {
     dumpObject(jsonBuf, i, matObjectID);
+    // the separator after the last object is removed at the end
+    if (writeFunc && jsonBuf.length() >= 16384)
+    {
+      writeFunc(writeFuncData, jsonBuf.c_str(), jsonBuf.length() - 2);
+      jsonBuf.erase(0, jsonBuf.length() - 2);
+    }
     jsonObjects[i->persistentID] = nullptr;
     for (const MaterialComponent *j = i->components; j; j = j->next)
     {
@@ -1463,11 +1740,209 @@ void BSMaterialsCDB::getJSONMaterial(
   // dump objects that have been referenced but have no edges to this material
   for (auto j : jsonObjects)
   {
-    if (j.second)
-      dumpObject(jsonBuf, j.second, matObjectID);
+    if (!j.second)
+      continue;
+    dumpObject(jsonBuf, j.second, matObjectID);
+    if (writeFunc && jsonBuf.length() >= 16384)
+    {
+      writeFunc(writeFuncData, jsonBuf.c_str(), jsonBuf.length() - 2);
+      jsonBuf.erase(0, jsonBuf.length() - 2);
+    }
   }
   jsonBuf.resize(jsonBuf.length() - 2);
   jsonBuf += "\n  ],\n  \"Version\": 1\n}";
+  if (writeFunc)
+  {
+    writeFunc(writeFuncData, jsonBuf.c_str(), jsonBuf.length());
+    jsonBuf.clear();
+  }
+  return true;
+}
+
+static void writeJSONToOutputFile(void *p, const char *buf, size_t nBytes)
+{
+  reinterpret_cast< OutputFile * >(p)->writeData(buf, nBytes);
+}
+
+void BSMaterialsCDB::getJSONMaterial(
+    std::string& jsonBuf, const std::string_view& materialPath) const
+{
+  (void) writeJSONMaterial(jsonBuf, materialPath, nullptr, nullptr);
+}
+
+bool BSMaterialsCDB::getJSONMaterial(
+    JSONWriteFunction writeFunc, void *writeFuncData,
+    const std::string_view& materialPath) const
+{
+  std::string jsonBuf;
+  return writeJSONMaterial(jsonBuf, materialPath, writeFunc, writeFuncData);
+}
+
+bool BSMaterialsCDB::getJSONMaterial(
+    OutputFile& f, const std::string_view& materialPath) const
+{
+  std::string jsonBuf;
+  return writeJSONMaterial(jsonBuf, materialPath,
+                           &writeJSONToOutputFile, &f);
+}
+
+// returns false if the relative path p (with '/' as separator) could refer
+// to a file outside of the directory it is appended to
+static bool isSafeRelativePath(const std::string_view& p)
+{
+  if (p.empty() || p.starts_with('/') || p.find(':') != std::string_view::npos)
+    return false;
+  for (size_t i = 0; i < p.length(); i++)
+  {
+    size_t  j = p.find('/', i);
+    if (j == std::string_view::npos)
+      j = p.length();
+    // "..", and names that Windows would also convert to "." or ".."
+    if (j > i && p.substr(i, j - i).find_first_not_of(". ")
+                 == std::string_view::npos)
+    {
+      return false;
+    }
+    i = j;
+  }
+  return true;
+}
+
+void BSMaterialsCDB::exportJSONMaterialsThread(
+    const BSMaterialsCDB *cdb, const std::string_view *materialPaths,
+    size_t fileCnt, const char *outputDir, std::atomic< size_t > *nextFile,
+    size_t *writeCnt, std::exception_ptr *err)
+{
+  std::string jsonBuf;
+  std::string fileName;
+  try
+  {
+    while (true)
+    {
+      size_t  i = nextFile->fetch_add(1, std::memory_order_relaxed);
+      if (i >= fileCnt)
+        break;
+      const std::string_view& materialPath = materialPaths[i];
+      if (materialPath.empty() || !cdb->getMaterial(materialPath))
+        continue;
+      fileName = outputDir;
+      if (!fileName.empty() && !fileName.ends_with('/'))
+        fileName += '/';
+      size_t  baseNameOffs = fileName.length();
+      for (char c : materialPath)
+      {
+        if (c >= 'A' && c <= 'Z')
+          c = c + ('a' - 'A');
+        else if (c == '\\')
+          c = '/';
+        fileName += c;
+      }
+      if (!isSafeRelativePath(std::string_view(fileName).substr(baseNameOffs)))
+        continue;
+      OutputFile  *f = nullptr;
+      try
+      {
+        f = new OutputFile(fileName.c_str(), 16384);
+      }
+      catch (FO76UtilsError&)
+      {
+        // create missing directories and try again
+        size_t  pathOffs = 1;
+        while ((pathOffs = fileName.find('/', pathOffs))
+               != std::string::npos)
+        {
+          fileName[pathOffs] = '\0';
+#if defined(_WIN32) || defined(_WIN64)
+          (void) _mkdir(fileName.c_str());
+#else
+          (void) mkdir(fileName.c_str(), 0755);
+#endif
+          fileName[pathOffs] = '/';
+          pathOffs++;
+        }
+        f = new OutputFile(fileName.c_str(), 16384);
+      }
+      try
+      {
+        (void) cdb->writeJSONMaterial(jsonBuf, materialPath,
+                                      &writeJSONToOutputFile, f);
+        f->writeByte('\n');
+        f->flush();
+      }
+      catch (...)
+      {
+        delete f;
+        throw;
+      }
+      delete f;
+      (*writeCnt)++;
+    }
+  }
+  catch (...)
+  {
+    *err = std::current_exception();
+  }
+}
+
+size_t BSMaterialsCDB::exportJSONMaterials(
+    const std::vector< std::string_view >& materialPaths,
+    const char *outputDir, int threadCnt) const
+{
+  if (!outputDir)
+    outputDir = "";
+  ThreadPool& threadPool = ThreadPool::getDefaultPool();
+  if (threadCnt <= 0)
+    threadCnt = threadPool.getThreadCount();
+  threadCnt = std::min(std::max(threadCnt, 1), 64);
+  size_t  fileCnt = materialPaths.size();
+  int     n = int(std::min(size_t(threadCnt), fileCnt));
+  std::atomic< size_t > nextFile(0);
+  size_t  writeCnts[64];
+  std::exception_ptr  errs[64];
+  for (int i = 0; i < n; i++)
+    writeCnts[i] = 0;
+  threadPool.parallelFor(
+      0, n, 1,
+      [&](int i0, int i1)
+      {
+        for (int i = i0; i < i1; i++)
+        {
+          exportJSONMaterialsThread(this, materialPaths.data(), fileCnt,
+                                    outputDir, &nextFile, writeCnts + i,
+                                    errs + i);
+        }
+      });
+  size_t  writeCnt = 0;
+  for (int i = 0; i < n; i++)
+    writeCnt = writeCnt + writeCnts[i];
+  for (int i = 0; i < n; i++)
+  {
+    if (errs[i])
+      std::rethrow_exception(errs[i]);
+  }
+  return writeCnt;
+}
+
+BSMaterialsCDB::MaterialObject * BSMaterialsCDB::copyMaterialObject(
+    const MaterialObject& r)
+{
+  MaterialObject  *o = allocateObjects< MaterialObject >(1);
+  *o = r;
+  o->components = nullptr;
+  MaterialComponent **prv = &(o->components);
+  for (const MaterialComponent *j = r.components; j; j = j->next)
+  {
+    MaterialComponent *tmp = allocateObjects< MaterialComponent >(1);
+    tmp->key = j->key;
+    tmp->className = j->className;
+    tmp->o = j->o;
+    if (tmp->o) [[likely]]
+      copyObject(*(tmp->o));
+    tmp->next = nullptr;
+    *prv = tmp;
+    prv = &(tmp->next);
+  }
+  return o;
 }
 
 void BSMaterialsCDB::copyFrom(BSMaterialsCDB& r)
@@ -1478,25 +1953,8 @@ void BSMaterialsCDB::copyFrom(BSMaterialsCDB& r)
   for (size_t i = 0; i <= r.matFileObjectMap.hashMask; i++)
   {
     MaterialObject  *p = r.matFileObjectMap.buf[i];
-    if (!p)
-      continue;
-    MaterialObject  *o = allocateObjects< MaterialObject >(1);
-    *o = *p;
-    o->components = nullptr;
-    MaterialComponent **prv = &(o->components);
-    for (MaterialComponent *j = p->components; j; j = j->next)
-    {
-      MaterialComponent *tmp = allocateObjects< MaterialComponent >(1);
-      tmp->key = j->key;
-      tmp->className = j->className;
-      tmp->o = j->o;
-      if (tmp->o) [[likely]]
-        copyObject(*(tmp->o));
-      tmp->next = nullptr;
-      *prv = tmp;
-      prv = &(tmp->next);
-    }
-    matFileObjectMap.storeObject(o);
+    if (p)
+      matFileObjectMap.storeObject(copyMaterialObject(*p));
   }
   for (size_t i = 0; i <= matFileObjectMap.hashMask; i++)
   {
@@ -1514,3 +1972,468 @@ void BSMaterialsCDB::copyFrom(BSMaterialsCDB& r)
   }
 }
 
+void BSMaterialsCDB::createOverlay(BSMaterialsCDB& r)
+{
+  clear();
+  parentDB = &r;
+  isOverlay = true;
+  std::memcpy(classes, r.classes, sizeof(CDBClassDef) * (classHashMask + 1));
+}
+
+BSMaterialsCDB::MaterialObject * BSMaterialsCDB::getWritableObject(
+    const MaterialObject *o)
+{
+  if (!(o && isOverlay))
+    return const_cast< MaterialObject * >(o);
+  const MaterialObject  *p = matFileObjectMap.findObject(o->persistentID);
+  if (p)
+    return const_cast< MaterialObject * >(p);
+  // copy the tree of objects that o belongs to
+  const MaterialObject  *rootObject = o;
+  while (rootObject->parent)
+    rootObject = rootObject->parent;
+  std::map< const MaterialObject *, MaterialObject * >  objectMap;
+  std::vector< const MaterialObject * > objectStack(1, rootObject);
+  while (!objectStack.empty())
+  {
+    p = objectStack.back();
+    objectStack.pop_back();
+    MaterialObject  *q =
+        const_cast< MaterialObject * >(
+            matFileObjectMap.findObject(p->persistentID));
+    if (!q)
+      q = copyMaterialObject(*p);
+    objectMap[p] = q;
+    for (const MaterialObject *i = p->children; i; i = i->next)
+      objectStack.push_back(i);
+  }
+  for (std::map< const MaterialObject *, MaterialObject * >::iterator
+           i = objectMap.begin(); i != objectMap.end(); i++)
+  {
+    MaterialObject  *q = i->second;
+    if (matFileObjectMap.findObject(q->persistentID) == q)
+      continue;                 // already owned by this database
+    std::map< const MaterialObject *, MaterialObject * >::iterator  j;
+    if (q->baseObject && (j = objectMap.find(q->baseObject)) != objectMap.end())
+      q->baseObject = j->second;
+    if (q->parent && (j = objectMap.find(q->parent)) != objectMap.end())
+      q->parent = j->second;
+    if (q->children && (j = objectMap.find(q->children)) != objectMap.end())
+      q->children = j->second;
+    if (q->next && (j = objectMap.find(q->next)) != objectMap.end())
+      q->next = j->second;
+    if (q->persistentID)
+      storeMatFileObject(q);
+  }
+  return objectMap[o];
+}
+
+// Snapshot file format (native byte order, pointer size and structure
+// layout, see getSnapshotLayoutID()):
+//   SnapshotHeader
+//   data image (dataSize bytes), with pointers stored as offsets from the
+//   beginning of the image, 0 is nullptr
+//   relocationCnt * uint64_t offsets of non-null pointers in the image
+
+namespace
+{
+
+struct SnapshotHeader
+{
+  std::uint32_t magic;                  // "CDBS"
+  std::uint32_t version;
+  std::uint64_t inputHash;
+  std::uint32_t layoutID;
+  std::uint32_t reserved;
+  std::uint64_t dataSize;
+  std::uint64_t relocationCnt;
+  std::uint64_t classesOffs;            // CDBClassDef[classHashMask + 1]
+  std::uint64_t objectsOffs;            // MaterialObject *[objectCnt]
+  std::uint64_t objectCnt;
+  std::uint64_t stringsOffs;            // const char *[stringCnt]
+  std::uint64_t stringCnt;
+  std::uint64_t jsonMaterialsOffs;      // BSResourceID[jsonMaterialCnt]
+  std::uint64_t jsonMaterialCnt;
+};
+
+}       // namespace
+
+static const std::uint32_t  snapshotMagic = 0x53424443U;
+static const std::uint32_t  snapshotVersion = 1U;
+
+static inline std::uint32_t getSnapshotLayoutID()
+{
+  return std::uint32_t(sizeof(void *)
+                       | (sizeof(BSMaterialsCDB::CDBObject_Compound) << 8)
+                       | (sizeof(BSMaterialsCDB::MaterialObject) << 16)
+                       | (sizeof(BSMaterialsCDB::CDBClassDef) << 24));
+}
+
+template< typename T, typename U >
+static inline size_t getFieldOffset(const T *o, const U *fieldPtr)
+{
+  return size_t(reinterpret_cast< const unsigned char * >(fieldPtr)
+                - reinterpret_cast< const unsigned char * >(o));
+}
+
+struct BSMaterialsCDB::SnapshotBuffer
+{
+  std::vector< unsigned char >  buf;
+  std::vector< std::uint64_t >  relocations;
+  std::map< const void *, std::uint64_t > offsetMap;
+  // material objects allocated, but not written yet
+  std::vector< std::pair< const MaterialObject *, std::uint64_t > >
+      objectQueue;
+  SnapshotBuffer()
+  {
+    buf.resize(16);             // offset 0 is reserved for nullptr
+  }
+  std::uint64_t allocateSpace(size_t nBytes, size_t alignBytes)
+  {
+    size_t  offs = (buf.size() + (alignBytes - 1)) & ~(alignBytes - 1);
+    buf.resize(offs + nBytes, 0);
+    return offs;
+  }
+  template< typename T >
+  inline void writeValue(std::uint64_t offs, const T& v)
+  {
+    std::memcpy(buf.data() + offs, &v, sizeof(T));
+  }
+  void writePointer(std::uint64_t offs, std::uint64_t targetOffs)
+  {
+    writeValue(offs, std::uintptr_t(targetOffs));
+    if (targetOffs)
+      relocations.push_back(offs);
+  }
+  std::uint64_t storeString(const char *s);
+  std::uint64_t storeObject(const CDBObject *o);
+  std::uint64_t storeMaterialObject(const MaterialObject *o);
+  void writeMaterialObjects();
+};
+
+std::uint64_t BSMaterialsCDB::SnapshotBuffer::storeString(const char *s)
+{
+  if (!s)
+    return 0;
+  std::map< const void *, std::uint64_t >::iterator i = offsetMap.find(s);
+  if (i != offsetMap.end())
+    return i->second;
+  size_t  len = std::strlen(s);
+  // strings are stored with a 4-byte length prefix as in StoredStringHashMap
+  std::uint64_t offs = allocateSpace(len + 5, 4) + 4;
+  FileBuffer::writeUInt32Fast(buf.data() + (offs - 4), std::uint32_t(len));
+  std::memcpy(buf.data() + offs, s, len);
+  offsetMap[s] = offs;
+  return offs;
+}
+
+std::uint64_t BSMaterialsCDB::SnapshotBuffer::storeObject(const CDBObject *o)
+{
+  if (!o)
+    return 0;
+  std::map< const void *, std::uint64_t >::iterator i = offsetMap.find(o);
+  if (i != offsetMap.end())
+    return i->second;
+  unsigned int  t = o->type;
+  size_t  nBytes;
+  size_t  alignBytes;
+  bool    isCompound = false;
+  if (t == BSReflStream::String_BSComponentDB2_ID)
+  {
+    nBytes = sizeof(CDBObject_Link);
+    alignBytes = alignof(CDBObject_Link);
+  }
+  else if (t > BSReflStream::String_Unknown ||
+           (t >= BSReflStream::String_List && t <= BSReflStream::String_Ref))
+  {
+    nBytes = sizeof(CDBObject_Compound)
+             + (sizeof(CDBObject *) * std::max< size_t >(o->childCnt, 1))
+             - sizeof(CDBObject *);
+    alignBytes = alignof(CDBObject_Compound);
+    isCompound = true;
+  }
+  else
+  {
+    nBytes = cdbObjectSizeAlignTable[t * 2U];
+    alignBytes = cdbObjectSizeAlignTable[t * 2U + 1U];
+  }
+  std::uint64_t offs = allocateSpace(nBytes, alignBytes);
+  offsetMap[o] = offs;
+  std::memcpy(buf.data() + offs, o, (!isCompound ? nBytes : sizeof(CDBObject)));
+  if (t == BSReflStream::String_String)
+  {
+    const CDBObject_String  *p = static_cast< const CDBObject_String * >(o);
+    writePointer(offs + getFieldOffset(p, &(p->value)), storeString(p->value));
+  }
+  else if (t == BSReflStream::String_BSComponentDB2_ID)
+  {
+    const CDBObject_Link  *p = static_cast< const CDBObject_Link * >(o);
+    writePointer(offs + getFieldOffset(p, &(p->objectPtr)),
+                 storeMaterialObject(p->objectPtr));
+  }
+  else if (isCompound)
+  {
+    const CDBObject_Compound  *p = static_cast< const CDBObject_Compound * >(o);
+    std::uint64_t childrenOffs = offs + getFieldOffset(p, &(p->children[0]));
+    for (size_t j = 0; j < o->childCnt; j++)
+    {
+      std::uint64_t childOffs = storeObject(p->children[j]);
+      writePointer(childrenOffs + (j * sizeof(CDBObject *)), childOffs);
+    }
+  }
+  return offs;
+}
+
+std::uint64_t BSMaterialsCDB::SnapshotBuffer::storeMaterialObject(
+    const MaterialObject *o)
+{
+  if (!o)
+    return 0;
+  std::map< const void *, std::uint64_t >::iterator i = offsetMap.find(o);
+  if (i != offsetMap.end())
+    return i->second;
+  std::uint64_t offs =
+      allocateSpace(sizeof(MaterialObject), alignof(MaterialObject));
+  offsetMap[o] = offs;
+  // the object is written later by writeMaterialObjects() to avoid deep
+  // recursion on long lists of linked objects
+  objectQueue.emplace_back(o, offs);
+  return offs;
+}
+
+void BSMaterialsCDB::SnapshotBuffer::writeMaterialObjects()
+{
+  for (size_t i = 0; i < objectQueue.size(); i++)
+  {
+    const MaterialObject  *o = objectQueue[i].first;
+    std::uint64_t offs = objectQueue[i].second;
+    writeValue(offs, *o);
+    writePointer(offs + getFieldOffset(o, &(o->baseObject)),
+                 storeMaterialObject(o->baseObject));
+    writePointer(offs + getFieldOffset(o, &(o->parent)),
+                 storeMaterialObject(o->parent));
+    writePointer(offs + getFieldOffset(o, &(o->children)),
+                 storeMaterialObject(o->children));
+    writePointer(offs + getFieldOffset(o, &(o->next)),
+                 storeMaterialObject(o->next));
+    std::uint64_t prvOffs = offs + getFieldOffset(o, &(o->components));
+    for (const MaterialComponent *p = o->components; p; p = p->next)
+    {
+      std::uint64_t componentOffs = allocateSpace(sizeof(MaterialComponent),
+                                                  alignof(MaterialComponent));
+      writeValue(componentOffs, *p);
+      writePointer(componentOffs + getFieldOffset(p, &(p->o)),
+                   storeObject(p->o));
+      writePointer(prvOffs, componentOffs);
+      prvOffs = componentOffs + getFieldOffset(p, &(p->next));
+    }
+    writePointer(prvOffs, 0);
+  }
+  objectQueue.clear();
+}
+
+void BSMaterialsCDB::saveSnapshot(
+    const char *fileName, std::uint64_t inputHash) const
+{
+  if (isOverlay)
+    errorMessage("BSMaterialsCDB::saveSnapshot(): cannot save overlay");
+  SnapshotBuffer  buf;
+  SnapshotHeader  hdr;
+  std::memset(&hdr, 0, sizeof(SnapshotHeader));
+  hdr.magic = snapshotMagic;
+  hdr.version = snapshotVersion;
+  hdr.inputHash = inputHash;
+  hdr.layoutID = getSnapshotLayoutID();
+  // class definitions
+  hdr.classesOffs = buf.allocateSpace(sizeof(CDBClassDef) * (classHashMask + 1),
+                                      alignof(CDBClassDef));
+  for (size_t i = 0; i <= classHashMask; i++)
+  {
+    const CDBClassDef&  c = classes[i];
+    std::uint64_t offs = hdr.classesOffs + (i * sizeof(CDBClassDef));
+    buf.writeValue(offs, c);
+    std::uint64_t fieldsOffs = 0;
+    if (c.className && c.fieldCnt && c.fields)
+    {
+      size_t  nBytes = sizeof(CDBClassDef::Field) * c.fieldCnt;
+      fieldsOffs = buf.allocateSpace(nBytes, alignof(CDBClassDef::Field));
+      std::memcpy(buf.buf.data() + fieldsOffs, c.fields, nBytes);
+    }
+    buf.writePointer(offs + getFieldOffset(&c, &(c.fields)), fieldsOffs);
+  }
+  // material objects, including the ones that are only referenced by links
+  std::vector< std::uint64_t >  tmpOffsets;
+  for (size_t i = 0; i <= matFileObjectMap.hashMask; i++)
+  {
+    if (matFileObjectMap.buf[i])
+      tmpOffsets.push_back(buf.storeMaterialObject(matFileObjectMap.buf[i]));
+  }
+  hdr.objectCnt = tmpOffsets.size();
+  hdr.objectsOffs = buf.allocateSpace(sizeof(MaterialObject *) * hdr.objectCnt,
+                                      alignof(MaterialObject *));
+  for (size_t i = 0; i < tmpOffsets.size(); i++)
+  {
+    buf.writePointer(hdr.objectsOffs + (i * sizeof(MaterialObject *)),
+                     tmpOffsets[i]);
+  }
+  buf.writeMaterialObjects();
+  // strings, needed for rebuilding storedStrings
+  tmpOffsets.clear();
+  for (size_t i = 0; i <= storedStrings.hashMask; i++)
+  {
+    if (storedStrings.buf[i])
+      tmpOffsets.push_back(buf.storeString(storedStrings.buf[i]));
+  }
+  hdr.stringCnt = tmpOffsets.size();
+  hdr.stringsOffs = buf.allocateSpace(sizeof(const char *) * hdr.stringCnt,
+                                      alignof(const char *));
+  for (size_t i = 0; i < tmpOffsets.size(); i++)
+  {
+    buf.writePointer(hdr.stringsOffs + (i * sizeof(const char *)),
+                     tmpOffsets[i]);
+  }
+  // list of JSON materials loaded
+  hdr.jsonMaterialsOffs = buf.allocateSpace(0, alignof(BSResourceID));
+  for (size_t i = 0; i <= jsonMaterialsLoaded.hashMask; i++)
+  {
+    if (jsonMaterialsLoaded.buf[i])
+    {
+      buf.writeValue(buf.allocateSpace(sizeof(BSResourceID),
+                                       alignof(BSResourceID)),
+                     jsonMaterialsLoaded.buf[i]);
+      hdr.jsonMaterialCnt++;
+    }
+  }
+  // pad the image to a multiple of 16 bytes
+  (void) buf.allocateSpace(0, 16);
+  hdr.dataSize = buf.buf.size();
+  hdr.relocationCnt = buf.relocations.size();
+
+  std::string tmpFileName(fileName);
+  tmpFileName += ".tmp";
+  try
+  {
+    OutputFile  f(tmpFileName.c_str(), 65536);
+    f.writeData(&hdr, sizeof(SnapshotHeader));
+    f.writeData(buf.buf.data(), buf.buf.size());
+    f.writeData(buf.relocations.data(),
+                buf.relocations.size() * sizeof(std::uint64_t));
+    f.flush();
+  }
+  catch (...)
+  {
+    (void) std::remove(tmpFileName.c_str());
+    throw;
+  }
+  if (std::rename(tmpFileName.c_str(), fileName) != 0)
+  {
+    // on Windows, rename() fails if the output file already exists
+    (void) std::remove(fileName);
+    if (std::rename(tmpFileName.c_str(), fileName) != 0)
+    {
+      (void) std::remove(tmpFileName.c_str());
+      throw FO76UtilsError("error renaming snapshot file %s",
+                           tmpFileName.c_str());
+    }
+  }
+}
+
+bool BSMaterialsCDB::loadSnapshot(const char *fileName, std::uint64_t inputHash)
+{
+  {
+    std::FILE *tmp = std::fopen(fileName, "rb");
+    if (!tmp)
+      return false;
+    std::fclose(tmp);
+  }
+  FileBuffer  inFile(fileName);
+  SnapshotHeader  hdr;
+  if (inFile.size() < sizeof(SnapshotHeader))
+    return false;
+  std::memcpy(&hdr, inFile.data(), sizeof(SnapshotHeader));
+  if (hdr.magic != snapshotMagic || hdr.version != snapshotVersion ||
+      hdr.inputHash != inputHash || hdr.layoutID != getSnapshotLayoutID())
+  {
+    return false;
+  }
+  // validate the image before clearing the database
+  size_t  dataSize = inFile.size() - sizeof(SnapshotHeader);
+  if (hdr.dataSize > dataSize || hdr.dataSize < 16 || (hdr.dataSize & 15) ||
+      hdr.relocationCnt != ((dataSize - hdr.dataSize) / sizeof(std::uint64_t))
+      || ((dataSize - hdr.dataSize) % sizeof(std::uint64_t)) != 0)
+  {
+    throw FO76UtilsError("invalid material database snapshot file %s",
+                         fileName);
+  }
+  dataSize = size_t(hdr.dataSize);
+  if (hdr.classesOffs > dataSize ||
+      (dataSize - hdr.classesOffs) < (sizeof(CDBClassDef) * (classHashMask + 1))
+      || hdr.objectsOffs > dataSize || hdr.objectCnt > (dataSize >> 3) ||
+      (dataSize - hdr.objectsOffs) < (hdr.objectCnt * sizeof(void *)) ||
+      hdr.stringsOffs > dataSize || hdr.stringCnt > (dataSize >> 3) ||
+      (dataSize - hdr.stringsOffs) < (hdr.stringCnt * sizeof(void *)) ||
+      hdr.jsonMaterialsOffs > dataSize || hdr.jsonMaterialCnt > dataSize ||
+      (dataSize - hdr.jsonMaterialsOffs)
+      < (hdr.jsonMaterialCnt * sizeof(BSResourceID)))
+  {
+    throw FO76UtilsError("invalid material database snapshot file %s",
+                         fileName);
+  }
+  const unsigned char *srcData = inFile.data() + sizeof(SnapshotHeader);
+  const unsigned char *relocationTable = srcData + dataSize;
+  for (size_t i = 0; i < hdr.relocationCnt; i++)
+  {
+    std::uint64_t offs;
+    std::memcpy(&offs, relocationTable + (i * 8), sizeof(std::uint64_t));
+    std::uintptr_t  p = std::uintptr_t(dataSize);
+    if (offs <= (dataSize - sizeof(std::uintptr_t)) &&
+        !(offs & (sizeof(std::uintptr_t) - 1)))
+    {
+      std::memcpy(&p, srcData + offs, sizeof(std::uintptr_t));
+    }
+    if (p >= dataSize)
+      throw FO76UtilsError("invalid material database snapshot file %s",
+                           fileName);
+  }
+
+  clear();
+  unsigned char *baseAddr =
+      reinterpret_cast< unsigned char * >(allocateSpace(dataSize, 16));
+  std::memcpy(baseAddr, srcData, dataSize);
+  // convert offsets to pointers
+  for (size_t i = 0; i < hdr.relocationCnt; i++)
+  {
+    std::uint64_t offs;
+    std::memcpy(&offs, relocationTable + (i * 8), sizeof(std::uint64_t));
+    unsigned char *p = baseAddr + offs;
+    std::uintptr_t  tmp;
+    std::memcpy(&tmp, p, sizeof(std::uintptr_t));
+    tmp = tmp + reinterpret_cast< std::uintptr_t >(baseAddr);
+    std::memcpy(p, &tmp, sizeof(std::uintptr_t));
+  }
+  classes = reinterpret_cast< CDBClassDef * >(baseAddr + hdr.classesOffs);
+  MaterialObject  **objects =
+      reinterpret_cast< MaterialObject ** >(baseAddr + hdr.objectsOffs);
+  for (size_t i = 0; i < hdr.objectCnt; i++)
+    matFileObjectMap.storeObject(objects[i]);
+  const char  **strings =
+      reinterpret_cast< const char ** >(baseAddr + hdr.stringsOffs);
+  while ((hdr.stringCnt * 3U) > (storedStrings.hashMask * 2U))
+    storedStrings.expandBuffer();
+  for (size_t i = 0; i < hdr.stringCnt; i++)
+  {
+    const char  *s = strings[i];
+    size_t  m = storedStrings.hashMask;
+    size_t  h = hashFunctionUInt32(s, FileBuffer::readUInt32Fast(s - 4)) & m;
+    while (storedStrings.buf[h])
+      h = (h + 1) & m;
+    storedStrings.buf[h] = s;
+    storedStrings.size++;
+  }
+  const BSResourceID  *jsonMaterials =
+      reinterpret_cast< const BSResourceID * >(baseAddr
+                                               + hdr.jsonMaterialsOffs);
+  for (size_t i = 0; i < hdr.jsonMaterialCnt; i++)
+    jsonMaterialsLoaded.insert(jsonMaterials[i]);
+  return true;
+}
@@ -8,6 +8,9 @@
 #include "jsonread.hpp"
 #include "ba2file.hpp"
 
+#include <atomic>
+#include <mutex>
+
 class BSMaterialsCDB
 {
   friend class CE2MaterialDB;
@@ -73,6 +76,10 @@ class BSMaterialsCDB
     // For maps, childCnt = 2 * elements, and data.children[N * 2] and
     // data.children[N * 2 + 1] contain the key and value for element N.
     std::uint16_t childCnt;
+    // number of other references to a shared object, it is copied before
+    // being modified if this is not zero. Overlays of the same database may
+    // update it from multiple threads, and it is only accessed with
+    // addObjectRef() and releaseObjectRef().
     std::uint32_t refCnt;
     // for type == BSReflStream::String_Bool
     inline bool boolValue() const;
@@ -206,7 +213,7 @@ class BSMaterialsCDB
     void clear();
     void storeObject(MaterialObject *o);
     const MaterialObject *findObject(BSResourceID objectID) const;
-    void expandBuffer();
+    void expandBuffer(size_t minMask = 0x001FFFFF);
   };
   struct JSONMaterialHashMap
   {
@@ -219,6 +226,20 @@ class BSMaterialsCDB
     bool insert(BSResourceID objectID);
     void expandBuffer();
   };
+  // used by saveSnapshot()
+  struct SnapshotBuffer;
+  // used by loadJSONFiles()
+  struct JSONFileData;
+  // per-thread data used by readAllChunks() when decoding components in
+  // parallel, objects are allocated from objectBuffers, and the buffers are
+  // moved to the database after all threads have finished
+  struct ChunkThreadData
+  {
+    AllocBuffers  objectBuffers[3];
+    std::mutex    *stringMutex;
+  };
+  // OBJT or DIFF chunk indexed by readAllChunks()
+  struct ComponentChunk;
   static const std::uint8_t cdbObjectSizeAlignTable[38];
   CDBClassDef     *classes;             // classHashMask + 1 elements
   MaterialObject  **objectTablePtr;
@@ -226,19 +247,30 @@ class BSMaterialsCDB
   StoredStringHashMap storedStrings;
   MatObjectHashMap    matFileObjectMap;
   AllocBuffers    objectBuffers[3];     // for align bytes <= 2, 4 and >= 8
-  BSMaterialsCDB  *parentDB = nullptr;  // valid if copyFrom() was called
+  // valid if copyFrom() or createOverlay() was called
+  BSMaterialsCDB  *parentDB = nullptr;
+  // true if objects not found in matFileObjectMap are searched in parentDB
+  bool            isOverlay = false;
   const BA2File   *ba2File;
   JSONMaterialHashMap jsonMaterialsLoaded;
   MaterialComponent& findComponent(MaterialObject& o,
-                                   std::uint32_t key, std::uint32_t className);
+                                   std::uint32_t key, std::uint32_t className,
+                                   ChunkThreadData *threadData = nullptr);
   inline MaterialObject *findObject(std::uint32_t dbID);
   inline const MaterialObject *findObject(std::uint32_t dbID) const;
-  inline void *allocateSpace(size_t nBytes, size_t alignBytes = 16)
+  inline void *allocateSpace(size_t nBytes, size_t alignBytes,
+                             ChunkThreadData *threadData)
   {
     size_t  n = size_t(std::bit_width(std::uintptr_t(alignBytes)));
     n = std::min< size_t >(std::max< size_t >(n, 2), 4) - 2;
+    if (threadData) [[unlikely]]
+      return threadData->objectBuffers[n].allocateSpace(nBytes, alignBytes);
     return objectBuffers[n].allocateSpace(nBytes, alignBytes);
   }
+  inline void *allocateSpace(size_t nBytes, size_t alignBytes = 16)
+  {
+    return allocateSpace(nBytes, alignBytes, nullptr);
+  }
   template< typename T >
   inline T *allocateObjects(size_t n)
   {
@@ -250,7 +282,26 @@ class BSMaterialsCDB
     return new(allocateObjects< T >(1)) T();
   }
   CDBObject *allocateObject(std::uint32_t itemType, const CDBClassDef *classDef,
-                            size_t elementCnt = 0);
+                            size_t elementCnt = 0,
+                            ChunkThreadData *threadData = nullptr);
+  static inline void addObjectRef(CDBObject& o)
+  {
+    std::atomic_ref< std::uint32_t >  n(o.refCnt);
+    n.fetch_add(1U, std::memory_order_relaxed);
+  }
+  // decrement the reference count, returns false if it is already zero
+  static inline bool releaseObjectRef(CDBObject& o)
+  {
+    std::atomic_ref< std::uint32_t >  n(o.refCnt);
+    std::uint32_t tmp = n.load(std::memory_order_relaxed);
+    do
+    {
+      if (!tmp)
+        return false;
+    }
+    while (!n.compare_exchange_weak(tmp, tmp - 1U, std::memory_order_relaxed));
+    return true;
+  }
   void copyObject(CDBObject& o);
   void copyBaseObject(MaterialObject& o);
   // decrement the reference count of all child objects
@@ -262,7 +313,22 @@ class BSMaterialsCDB
   }
   void loadItem(CDBObject*& o,
                 BSReflStream& cdbFile, BSReflStream::Chunk& chunkBuf,
-                bool isDiff, std::uint32_t itemType);
+                bool isDiff, std::uint32_t itemType,
+                ChunkThreadData *threadData = nullptr);
+  void loadComponentChunk(BSReflStream& cdbFile, const ComponentChunk& c,
+                          ChunkThreadData *threadData = nullptr);
+  static void loadComponentsThread(
+      BSMaterialsCDB *cdb, const BSReflStream *cdbFile,
+      ChunkThreadData *threadData,
+      const std::vector< std::pair< size_t, size_t > > *objectRanges,
+      const std::vector< ComponentChunk > *chunks,
+      std::atomic< size_t > *nextRange, std::exception_ptr *err);
+  // decode and clear the components indexed by readAllChunks(), if
+  // threadCnt != 1, the chunks of independent objects are decoded in
+  // parallel on ThreadPool::getDefaultPool() (threadCnt <= 0: use all
+  // threads of the pool)
+  void loadComponents(BSReflStream& cdbFile,
+                      std::vector< ComponentChunk >& chunks, int threadCnt);
   void readAllChunks(BSReflStream& cdbFile);
   CDBClassDef& allocateClassDef(std::uint32_t className);
   inline void storeMatFileObject(MaterialObject *o)
@@ -272,8 +338,21 @@ class BSMaterialsCDB
   inline const MaterialObject *findMatFileObject(
       const BSResourceID& objectID) const
   {
-    return matFileObjectMap.findObject(objectID);
+    const MaterialObject  *o = matFileObjectMap.findObject(objectID);
+    if (!o && isOverlay) [[unlikely]]
+      o = parentDB->findMatFileObject(objectID);
+    return o;
+  }
+  // returns true if o is not owned by the parent database of an overlay
+  inline bool isOwnObject(const MaterialObject *o) const
+  {
+    return (!isOverlay || matFileObjectMap.findObject(o->persistentID) == o);
   }
+  MaterialObject *copyMaterialObject(const MaterialObject& r);
+  // returns o, or its copy in this database if o is owned by the parent of
+  // an overlay; all objects connected to o by parent/child edges are copied
+  // as well, so that the links between them remain consistent
+  MaterialObject *getWritableObject(const MaterialObject *o);
   void dumpObject(std::string& s, const CDBObject *o, int indentCnt) const;
   void dumpObject(std::string& jsonBuf, const MaterialObject *o,
                   BSResourceID matObjectID) const;
@@ -281,6 +360,38 @@ class BSMaterialsCDB
   void loadJSONItem(CDBObject*& o, const JSONReader::JSONItem *jsonItem,
                     std::uint32_t itemType, MaterialObject *materialObject,
                     std::map< BSResourceID, MaterialObject * >& objectMap);
+  // returns the size of the file, or 0 if it is not found. A file from a
+  // packed archive of parentDB is skipped if objectID is already defined,
+  // unless isPackedParentFile is not nullptr, in that case the file is
+  // extracted, *isPackedParentFile is set to true, and the caller needs to
+  // check getMaterial(objectID) before loading it
+  size_t extractJSONFile(const unsigned char*& jsonData,
+                         BA2File::UCharArray& jsonBuf,
+                         const std::string_view& materialPath,
+                         BSResourceID objectID,
+                         bool *isPackedParentFile = nullptr) const;
+  static void loadJSONFilesThread(const BSMaterialsCDB *cdb,
+                                  JSONFileData *fileData,
+                                  const std::string_view *materialPaths,
+                                  size_t fileCnt,
+                                  std::atomic< size_t > *nextFile);
+ public:
+  // function called by the streaming versions of getJSONMaterial() with
+  // each block of the output, buf is not null-terminated
+  typedef void (*JSONWriteFunction)(void *p, const char *buf, size_t nBytes);
+ protected:
+  // if writeFunc is not nullptr, the output is passed to it in blocks of
+  // at least 16 KB and jsonBuf is only used as a temporary buffer
+  bool writeJSONMaterial(std::string& jsonBuf,
+                         const std::string_view& materialPath,
+                         JSONWriteFunction writeFunc,
+                         void *writeFuncData) const;
+  static void exportJSONMaterialsThread(const BSMaterialsCDB *cdb,
+                                        const std::string_view *materialPaths,
+                                        size_t fileCnt, const char *outputDir,
+                                        std::atomic< size_t > *nextFile,
+                                        size_t *writeCnt,
+                                        std::exception_ptr *err);
  public:
   void loadCDBFile(const unsigned char *fileData, size_t fileSize)
   {
@@ -314,17 +425,44 @@ class BSMaterialsCDB
   // clone an existing material database
   // clear() must be called to remove references to 'r' before &r is deleted
   void copyFrom(BSMaterialsCDB& r);
+  // Create an empty overlay on top of an existing database. Objects not
+  // found in the overlay are looked up in 'r', and are only copied to the
+  // overlay when they are modified by loadJSONFile(). 'r' must not be
+  // changed or deleted while the overlay exists.
+  // Multiple overlays of the same database can be used and modified on
+  // different threads, and 'r' can be read concurrently, but each overlay
+  // must only be accessed by one thread at a time. Copying objects only
+  // changes their reference counts in 'r', which are updated atomically.
+  void createOverlay(BSMaterialsCDB& r);
   void loadJSONFile(const JSONReader& matFile,
                     const std::string_view& materialPath);
   void loadJSONFile(const unsigned char *fileData, size_t fileSize,
                     const std::string_view& materialPath);
   void loadJSONFile(const char *fileName, const std::string_view& materialPath);
+  // Save the database in a format that can be loaded with loadSnapshot()
+  // without parsing the CDB and JSON files again. inputHash identifies the
+  // source files, and is stored in the snapshot. The file is written to a
+  // temporary file first, and then renamed.
+  void saveSnapshot(const char *fileName, std::uint64_t inputHash) const;
+  // Returns false if the file does not exist, or was created from different
+  // input files or with an incompatible version or architecture. Otherwise
+  // the database is cleared and replaced with the contents of the snapshot,
+  // and true is returned.
+  bool loadSnapshot(const char *fileName, std::uint64_t inputHash);
   // Load .mat file from archives, the return value is true on success.
   // flags & 1: ignore missing file
   // flags & 2: ignore errors
   // flags & 4: skip file if loading it was previously attempted
   bool loadJSONFile(const std::string_view& materialPath, BSResourceID objectID,
                     int flags = 0);
+  // Load multiple .mat files, with the same flags as loadJSONFile().
+  // The files are extracted and parsed in parallel on at most threadCnt
+  // threads of ThreadPool::getDefaultPool() (<= 0: use all threads of the
+  // pool), but the objects are added to the database in the order of
+  // materialPaths, so the results do not depend on thread scheduling.
+  // Returns the number of files loaded successfully.
+  size_t loadJSONFiles(const std::vector< std::string_view >& materialPaths,
+                       int flags = 0, int threadCnt = 0);
   void clear();
   const CDBClassDef *getClassDef(std::uint32_t type) const;
   const MaterialObject *getMaterial(BSResourceID objectID) const
@@ -338,6 +476,24 @@ class BSMaterialsCDB
   void getMaterials(std::vector< const MaterialObject * >& materials) const;
   void getJSONMaterial(std::string& jsonBuf,
                        const std::string_view& materialPath) const;
+  // Write the material to writeFunc or f without storing all of it in
+  // memory. Returns false if the material is not found, nothing is written
+  // in this case.
+  bool getJSONMaterial(JSONWriteFunction writeFunc, void *writeFuncData,
+                       const std::string_view& materialPath) const;
+  bool getJSONMaterial(OutputFile& f,
+                       const std::string_view& materialPath) const;
+  // Export materials in parallel to .mat files under outputDir, the file
+  // names are the material paths converted to lower case, with '/' as the
+  // path separator. Missing directories are created, and materials that are
+  // not found are skipped. Paths that are absolute, have a drive prefix or
+  // contain ".." components are also skipped, so that no files are written
+  // outside outputDir. At most threadCnt threads of
+  // ThreadPool::getDefaultPool() are used (<= 0: all threads of the pool).
+  // Returns the number of files written.
+  size_t exportJSONMaterials(
+      const std::vector< std::string_view >& materialPaths,
+      const char *outputDir, int threadCnt = 0) const;
   inline void setArchives(const BA2File *archive)
   {
     ba2File = archive;
@@ -1,6 +1,7 @@
 
 #include "common.hpp"
 #include "filebuf.hpp"
+#include "simdfunc.hpp"
 
 #include <new>
 
@@ -112,97 +113,19 @@ double parseFloat(const char *s, const char *errMsg,
   return tmp;
 }
 
-#if ENABLE_X86_64_SIMD >= 2
-template< typename T > static inline void memset_YMM(T *p, T c, size_t n)
-{
-  unsigned char *q = reinterpret_cast< unsigned char * >(p);
-  unsigned char *endPtr = q + (n * sizeof(T));
-  for ( ; reinterpret_cast< std::uintptr_t >(q) & 31U; q = q + sizeof(T))
-  {
-    if (q >= endPtr) [[unlikely]]
-      return;
-    *(reinterpret_cast< T * >(q)) = c;
-  }
-  T   tmp __attribute__ ((__vector_size__ (32)));
-#  if ENABLE_X86_64_SIMD >= 4
-  tmp[0] = c;
-  if (sizeof(T) == 8)
-    __asm__ ("vpbroadcastq %x0, %t0" : "+x" (tmp));
-  else
-    __asm__ ("vpbroadcastd %x0, %t0" : "+x" (tmp));
-#  else
-  for (size_t i = 0; i < (size_t(32) / sizeof(T)); i++)
-    tmp[i] = c;
-#  endif
-  n = size_t(endPtr - q) & 63;
-  unsigned char *r = endPtr - n;
-  for ( ; q < r; q = q + 64) [[likely]]
-  {
-    __asm__ ("vmovdqa %t1, %0" : "=m" (q[0]) : "x" (tmp));
-    __asm__ ("vmovdqa %t1, %0" : "=m" (q[32]) : "x" (tmp));
-  }
-  if (n & 32)
-  {
-    __asm__ ("vmovdqa %t1, %0" : "=m" (*q) : "x" (tmp));
-    q = q + 32;
-  }
-  if (n & 16)
-  {
-    __asm__ ("vmovdqa %x1, %0" : "=m" (*q) : "x" (tmp));
-    q = q + 16;
-  }
-  if (n & 8)
-  {
-    __asm__ ("vmovq %x1, %0" : "=m" (*q) : "x" (tmp));
-    q = q + 8;
-  }
-  if (sizeof(T) < 8 && (n & 4))
-    __asm__ ("vmovd %x1, %0" : "=m" (*q) : "x" (tmp));
-}
-#endif
-
 void memsetUInt32(std::uint32_t *p, std::uint32_t c, size_t n)
 {
-#if ENABLE_X86_64_SIMD >= 2
-  memset_YMM< std::uint32_t >(p, c, n);
-#else
-  if (c == ((c & 0xFFU) * 0x01010101U))
-  {
-    std::memset(p, int(c & 0xFFU), n * sizeof(std::uint32_t));
-  }
-  else
-  {
-    for (size_t i = 0; i < n; i++)
-      p[i] = c;
-  }
-#endif
+  SIMDFunctions::get().memsetUInt32(p, c, n);
 }
 
 void memsetUInt64(std::uint64_t *p, std::uint64_t c, size_t n)
 {
-#if ENABLE_X86_64_SIMD >= 2
-  memset_YMM< std::uint64_t >(p, c, n);
-#else
-  if (c == ((c & 0xFFU) * 0x0101010101010101ULL))
-  {
-    std::memset(p, int(c & 0xFFU), n * sizeof(std::uint64_t));
-  }
-  else
-  {
-    for (size_t i = 0; i < n; i++)
-      p[i] = c;
-  }
-#endif
+  SIMDFunctions::get().memsetUInt64(p, c, n);
 }
 
 void memsetFloat(float *p, float c, size_t n)
 {
-#if ENABLE_X86_64_SIMD >= 2
-  memset_YMM< float >(p, c, n);
-#else
-  for (size_t i = 0; i < n; i++)
-    p[i] = c;
-#endif
+  SIMDFunctions::get().memsetFloat(p, c, n);
 }
 
 #ifdef __GNUC__
@@ -457,6 +380,27 @@ void AllocBuffers::clear()
   }
 }
 
+void AllocBuffers::moveBuffers(AllocBuffers& r)
+{
+  if (!r.lastBuf->prv)
+    return;
+  DataBuf *p = r.lastBuf;
+  while (p->prv->prv)
+    p = p->prv;
+  if (lastBuf->prv)
+  {
+    // insert the buffers of 'r' before the last one, so that allocation
+    // continues from the current buffer
+    p->prv = lastBuf->prv;
+    lastBuf->prv = r.lastBuf;
+  }
+  else
+  {
+    lastBuf = r.lastBuf;
+  }
+  r.lastBuf = const_cast< DataBuf * >(&emptyBuf);
+}
+
 #if ENABLE_X86_64_SIMD >= 1
 static inline XMM_UInt8 convert8CharsToXMMUInt16(const void *p)
 {
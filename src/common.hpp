@@ -333,6 +333,8 @@ class AllocBuffers
   ~AllocBuffers();
   void *allocateSpace(size_t nBytes, size_t alignBytes = 16);
   void clear();
+  // move all buffers of 'r' to this object, 'r' is left empty
+  void moveBuffers(AllocBuffers& r);
   template< typename T > inline T *allocateObject()
   {
     return reinterpret_cast< T * >(allocateSpace(sizeof(T), alignof(T)));
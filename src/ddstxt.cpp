@@ -4,6 +4,7 @@
 #include "fp32vec8.hpp"
 
 #include <new>
+#include <atomic>
 
 const DDSTexture::DXGIFormatInfo DDSTexture::dxgiFormatInfoTable[32] =
 {
@@ -304,9 +305,12 @@ size_t DDSTexture::decodeBlock_BC6U(
     std::uint32_t *dst, const unsigned char *src, unsigned int w)
 {
   std::uint64_t tmp[16];
-  (void) detexDecompressBlockBPTC_FLOAT(
+  if (!detexDecompressBlockBPTC_FLOAT(
              reinterpret_cast< const std::uint8_t * >(src), 0xFFFFFFFFU, 0U,
-             reinterpret_cast< std::uint8_t * >(&(tmp[0])));
+             reinterpret_cast< std::uint8_t * >(&(tmp[0])))) [[unlikely]]
+  {
+    std::memset(tmp, 0, sizeof(tmp));   // reserved mode
+  }
   for (unsigned int i = 0; i < 16; i++)
   {
     FloatVector4  c(FloatVector4::convertFloat16(tmp[i]));
@@ -324,9 +328,12 @@ size_t DDSTexture::decodeBlock_BC6S(
     std::uint32_t *dst, const unsigned char *src, unsigned int w)
 {
   std::uint64_t tmp[16];
-  (void) detexDecompressBlockBPTC_SIGNED_FLOAT(
+  if (!detexDecompressBlockBPTC_SIGNED_FLOAT(
              reinterpret_cast< const std::uint8_t * >(src), 0xFFFFFFFFU, 0U,
-             reinterpret_cast< std::uint8_t * >(&(tmp[0])));
+             reinterpret_cast< std::uint8_t * >(&(tmp[0])))) [[unlikely]]
+  {
+    std::memset(tmp, 0, sizeof(tmp));   // reserved mode
+  }
   for (unsigned int i = 0; i < 16; i++)
   {
     FloatVector4  c(FloatVector4::convertFloat16(tmp[i]));
@@ -341,9 +348,12 @@ size_t DDSTexture::decodeBlock_BC7(
     std::uint32_t *dst, const unsigned char *src, unsigned int w)
 {
   std::uint32_t tmp[16];
-  (void) detexDecompressBlockBPTC(
+  if (!detexDecompressBlockBPTC(
              reinterpret_cast< const std::uint8_t * >(src), 0xFFFFFFFFU, 0U,
-             reinterpret_cast< std::uint8_t * >(&(tmp[0])));
+             reinterpret_cast< std::uint8_t * >(&(tmp[0])))) [[unlikely]]
+  {
+    std::memset(tmp, 0, sizeof(tmp));   // reserved mode
+  }
   for (unsigned int i = 0; i < 16; i++)
     dst[(i >> 2) * w + (i & 3)] = tmp[i];
   return 16;
@@ -488,8 +498,8 @@ void DDSTexture::loadTextureData(
   for (int i = 0; i < 19; i++)
   {
     std::uint32_t *p = textureData[i] + dataOffs;
-    unsigned int  w = (xMaskMip0 >> (unsigned char) i) + 1U;
-    unsigned int  h = (yMaskMip0 >> (unsigned char) i) + 1U;
+    unsigned int  w = getMipDimension(xMaskMip0, i);
+    unsigned int  h = getMipDimension(yMaskMip0, i);
     if (i <= int(maxMipLevel))
     {
       if (!isCompressed)
@@ -498,8 +508,9 @@ void DDSTexture::loadTextureData(
         for (unsigned int y = 0; y < h; y++)
           srcPtr = srcPtr + decodeFunction(p + (y * w), srcPtr, w);
       }
-      else if (w < 4 || h < 4)
+      else if ((w | h) & 3U)
       {
+        // partial blocks at the right or bottom edge
         std::uint32_t tmpBuf[16];
         for (unsigned int y = 0; y < h; y = y + 4)
         {
@@ -528,17 +539,17 @@ void DDSTexture::loadTextureData(
       // generate missing mipmaps
       const std::uint32_t *p2 =
           textureData[i - 1] + (size_t(textureDataSize) * size_t(n));
-      unsigned int  xMask = xMaskMip0 >> (unsigned char) (i - 1);
-      unsigned int  yMask = yMaskMip0 >> (unsigned char) (i - 1);
-      size_t  w2 = size_t(xMask + 1U);
+      unsigned int  xMax = getMipDimension(xMaskMip0, i - 1) - 1U;
+      unsigned int  yMax = getMipDimension(yMaskMip0, i - 1) - 1U;
+      size_t  w2 = size_t(xMax + 1U);
       for (unsigned int y = 0; y < h; y++)
       {
-        size_t  offsY2 = size_t((y << 1) & yMask) * w2;
-        size_t  offsY2p1 = size_t(((y << 1) + 1U) & yMask) * w2;
+        size_t  offsY2 = size_t(std::min(y << 1, yMax)) * w2;
+        size_t  offsY2p1 = size_t(std::min((y << 1) + 1U, yMax)) * w2;
         for (unsigned int x = 0; x < w; x++)
         {
-          size_t  offsX2 = (x << 1) & xMask;
-          size_t  offsX2p1 = ((x << 1) + 1U) & xMask;
+          size_t  offsX2 = std::min(x << 1, xMax);
+          size_t  offsX2p1 = std::min((x << 1) + 1U, xMax);
           FloatVector4  c(p2 + (offsY2 + offsX2));
           c += FloatVector4(p2 + (offsY2 + offsX2p1));
           c += FloatVector4(p2 + (offsY2p1 + offsX2));
@@ -550,7 +561,68 @@ void DDSTexture::loadTextureData(
   }
 }
 
-void DDSTexture::loadTexture(FileBuffer& buf, int mipOffset)
+// per-thread cache of decoded blocks of compressed textures, the texture ID
+// prevents reusing stale entries if a texture is deleted and its memory is
+// reallocated
+struct DDSBlockCacheEntry
+{
+  const unsigned char *blockPtr;
+  std::uint32_t textureID;
+  std::uint32_t texels[16];
+};
+
+static thread_local DDSBlockCacheEntry  ddsBlockCache[256];
+static std::atomic< std::uint32_t > ddsBlockCacheNextID(0U);
+
+bool DDSTexture::loadCompressedTextureData(
+    const unsigned char *srcPtr, size_t srcSize, int mipOffset)
+{
+  if (getMipDimension(xMaskMip0, int(maxMipLevel)) != 1U ||
+      getMipDimension(yMaskMip0, int(maxMipLevel)) != 1U ||
+      mipOffset > int(maxMipLevel))
+  {
+    // incomplete mipmap chain
+    return false;
+  }
+  size_t  blockSize = dxgiFormatInfoTable[dxgiFormatMap[dxgiFormat]].blockSize;
+  size_t  offs = 0;
+  for ( ; mipOffset > 0; mipOffset--, maxMipLevel--)
+  {
+    offs = offs + (size_t((xMaskMip0 + 4U) >> 2)
+                   * size_t((yMaskMip0 + 4U) >> 2) * blockSize);
+    xMaskMip0 = getMipDimension(xMaskMip0, 1) - 1U;
+    yMaskMip0 = getMipDimension(yMaskMip0, 1) - 1U;
+  }
+  size_t  faceDataSize = srcSize - offs;
+  unsigned char *buf = reinterpret_cast< unsigned char * >(
+                           std::malloc(faceDataSize * (maxTextureNum + 1U)));
+  if (!buf)
+    throw std::bad_alloc();
+  for (size_t i = 0; i <= maxTextureNum; i++)
+  {
+    std::memcpy(buf + (i * faceDataSize), srcPtr + (i * srcSize + offs),
+                faceDataSize);
+  }
+  offs = 0;
+  for (int i = 0; i < 19; i++)
+  {
+    textureData[i] = reinterpret_cast< std::uint32_t * >(buf + offs);
+    if (i < int(maxMipLevel))
+    {
+      offs = offs + (size_t((getMipDimension(xMaskMip0, i) + 3U) >> 2)
+                     * size_t((getMipDimension(yMaskMip0, i) + 3U) >> 2)
+                     * blockSize);
+    }
+  }
+  textureDataSize = std::uint32_t(faceDataSize / sizeof(std::uint32_t));
+  genericSampling = true;
+  blockCompressed = true;
+  blockCacheID = ++ddsBlockCacheNextID;
+  return true;
+}
+
+void DDSTexture::loadTexture(FileBuffer& buf, int mipOffset,
+                             bool keepCompressed)
 {
   buf.setPosition(0);
   if (buf.size() < 148 || !FileBuffer::checkType(buf.readUInt32(), "DDS "))
@@ -565,14 +637,16 @@ void DDSTexture::loadTexture(FileBuffer& buf, int mipOffset)
   channelCnt = 0;
   maxTextureNum = 0;
   dxgiFormat = 0;
+  tiledLayout = false;
+  blockCompressed = false;
+  blockCacheID = 0U;
   yMaskMip0 = buf.readUInt32() - 1U;
   xMaskMip0 = buf.readUInt32() - 1U;
-  // width and height must be power of two and in the range 1 to 32768
-  if (((xMaskMip0 | yMaskMip0) & ~0x7FFFU) ||
-      ((xMaskMip0 & (xMaskMip0 + 1U)) | (yMaskMip0 & (yMaskMip0 + 1U))) != 0U)
-  {
+  // width and height must be in the range 1 to 32768
+  if ((xMaskMip0 | yMaskMip0) & ~0x7FFFU)
     errorMessage("invalid or unsupported texture dimensions");
-  }
+  genericSampling =
+      ((xMaskMip0 & (xMaskMip0 + 1U)) | (yMaskMip0 & (yMaskMip0 + 1U))) != 0U;
   buf.setPosition(buf.getPosition() + 8);       // dwPitchOrLinearSize, dwDepth
   if (flags & 0x00020000)               // DDSD_MIPMAPCOUNT
   {
@@ -669,10 +743,10 @@ void DDSTexture::loadTexture(FileBuffer& buf, int mipOffset)
   size_t  sizeRequired = 0;
   if (!isCompressed)
   {
-    for (unsigned int i = 0; i <= maxMipLevel; i++)
+    for (int i = 0; i <= int(maxMipLevel); i++)
     {
-      unsigned int  w = (xMaskMip0 >> i) + 1U;
-      unsigned int  h = (yMaskMip0 >> i) + 1U;
+      unsigned int  w = getMipDimension(xMaskMip0, i);
+      unsigned int  h = getMipDimension(yMaskMip0, i);
       sizeRequired = sizeRequired + (size_t(w) * h * blockSize);
     }
   }
@@ -680,8 +754,8 @@ void DDSTexture::loadTexture(FileBuffer& buf, int mipOffset)
   {
     for (int i = 0; i <= int(maxMipLevel); i++)
     {
-      unsigned int  w = (xMaskMip0 >> (i + 2)) + 1U;
-      unsigned int  h = (yMaskMip0 >> (i + 2)) + 1U;
+      unsigned int  w = (getMipDimension(xMaskMip0, i) + 3U) >> 2;
+      unsigned int  h = (getMipDimension(yMaskMip0, i) + 3U) >> 2;
       sizeRequired = sizeRequired + (size_t(w) * h * blockSize);
     }
   }
@@ -697,6 +771,11 @@ void DDSTexture::loadTexture(FileBuffer& buf, int mipOffset)
     errorMessage("DDS file is shorter than expected");
   }
   const unsigned char *srcPtr = buf.data() + dataOffs;
+  if (keepCompressed && isCompressed && maxTextureNum < 5)
+  {
+    if (loadCompressedTextureData(srcPtr, sizeRequired, mipOffset))
+      return;
+  }
   for ( ; mipOffset > 0 && maxMipLevel; mipOffset--, maxMipLevel--)
   {
     unsigned int  w = xMaskMip0 + 1U;
@@ -705,24 +784,24 @@ void DDSTexture::loadTexture(FileBuffer& buf, int mipOffset)
       srcPtr = srcPtr + (size_t(w) * h * blockSize);
     else
       srcPtr = srcPtr + (size_t((w + 3) >> 2) * ((h + 3) >> 2) * blockSize);
-    xMaskMip0 = xMaskMip0 >> 1;
-    yMaskMip0 = yMaskMip0 >> 1;
+    xMaskMip0 = getMipDimension(xMaskMip0, 1) - 1U;
+    yMaskMip0 = getMipDimension(yMaskMip0, 1) - 1U;
   }
   size_t  dataOffsets[19];
   size_t  bufSize = 0;
-  unsigned int  xMask = (xMaskMip0 << 1) | 1U;
-  unsigned int  yMask = (yMaskMip0 << 1) | 1U;
-  for (unsigned int i = 0; i < 19; i++)
+  unsigned int  w = 0U;
+  unsigned int  h = 0U;
+  for (int i = 0; i < 19; i++)
   {
-    if (!(xMask | yMask))
+    if ((w | h) == 1U)
     {
       dataOffsets[i] = dataOffsets[i - 1];
       continue;
     }
-    xMask = xMask >> 1;
-    yMask = yMask >> 1;
+    w = getMipDimension(xMaskMip0, i);
+    h = getMipDimension(yMaskMip0, i);
     dataOffsets[i] = bufSize;
-    bufSize = bufSize + (size_t(xMask + 1U) * (yMask + 1U));
+    bufSize = bufSize + (size_t(w) * h);
   }
   textureDataSize = std::uint32_t(bufSize);
   size_t  totalDataSize =
@@ -756,8 +835,8 @@ void DDSTexture::loadTexture(FileBuffer& buf, int mipOffset)
   {
     mipOffset = (mipOffset < 18 ? mipOffset : 18);
     size_t  offs = dataOffsets[mipOffset];
-    xMaskMip0 = xMaskMip0 >> (unsigned char) mipOffset;
-    yMaskMip0 = yMaskMip0 >> (unsigned char) mipOffset;
+    xMaskMip0 = getMipDimension(xMaskMip0, mipOffset) - 1U;
+    yMaskMip0 = getMipDimension(yMaskMip0, mipOffset) - 1U;
     totalDataSize = totalDataSize - (offs * sizeof(std::uint32_t));
     std::memmove(textureData[0], textureData[mipOffset], totalDataSize);
     textureDataBuf = reinterpret_cast< std::uint32_t * >(
@@ -772,38 +851,80 @@ void DDSTexture::loadTexture(FileBuffer& buf, int mipOffset)
   }
 }
 
-inline FloatVector4 DDSTexture::getPixelB_2(
+void DDSTexture::convertToTiledLayout()
+{
+  if (genericSampling)
+    return;
+  std::vector< std::uint32_t >  tmpBuf;
+  for (size_t n = 0; n <= maxTextureNum; n++)
+  {
+    for (int i = 0; i < 19; i++)
+    {
+      unsigned int  xMask = xMaskMip0 >> (unsigned char) i;
+      unsigned int  yMask = yMaskMip0 >> (unsigned char) i;
+      if (!(xMask & yMask & 2U))
+        break;
+      std::uint32_t *p = textureData[i] + (size_t(textureDataSize) * n);
+      size_t  w = size_t(xMask + 1U);
+      size_t  h = size_t(yMask + 1U);
+      tmpBuf.resize(w * h);
+      std::memcpy(tmpBuf.data(), p, w * h * sizeof(std::uint32_t));
+      for (size_t y = 0; y < h; y = y + 4)
+      {
+        const std::uint32_t *src = tmpBuf.data() + (y * w);
+        for (size_t x = 0; x < w; x = x + 4, p = p + 16)
+        {
+          for (size_t j = 0; j < 4; j++)
+            std::memcpy(p + (j << 2), src + (j * w + x), 16);
+        }
+      }
+    }
+  }
+  tiledLayout = true;
+}
+
+template< bool isTiled > inline FloatVector4 DDSTexture::getPixelB_2(
     const std::uint32_t *p1, const std::uint32_t *p2, int x0, int y0,
     float xf, float yf, unsigned int xMask, unsigned int yMask)
 {
-  unsigned int  w = xMask + 1U;
   unsigned int  x0u = (unsigned int) x0;
   unsigned int  y0u = (unsigned int) y0;
   unsigned int  x1 = (x0u + 1U) & xMask;
   unsigned int  y1 = (y0u + 1U) & yMask;
   x0u = x0u & xMask;
   y0u = y0u & yMask;
-  return FloatVector4(p1 + (y0u * w + x0u), p2 + (y0u * w + x0u),
-                      p1 + (y0u * w + x1), p2 + (y0u * w + x1),
-                      p1 + (y1 * w + x0u), p2 + (y1 * w + x0u),
-                      p1 + (y1 * w + x1), p2 + (y1 * w + x1), xf, yf);
+  unsigned int  offs0 = getTexelOffset< isTiled >(x0u, y0u, xMask, yMask);
+  unsigned int  offs1 = getTexelOffset< isTiled >(x1, y0u, xMask, yMask);
+  unsigned int  offs2 = getTexelOffset< isTiled >(x0u, y1, xMask, yMask);
+  unsigned int  offs3 = getTexelOffset< isTiled >(x1, y1, xMask, yMask);
+  return FloatVector4(p1 + offs0, p2 + offs0, p1 + offs1, p2 + offs1,
+                      p1 + offs2, p2 + offs2, p1 + offs3, p2 + offs3, xf, yf);
 }
 
-DDSTexture::DDSTexture(const char *fileName, int mipOffset)
+DDSTexture::DDSTexture(const char *fileName, int mipOffset, bool tiled,
+                       bool keepCompressed)
 {
   FileBuffer  tmpBuf(fileName);
-  loadTexture(tmpBuf, mipOffset);
+  loadTexture(tmpBuf, mipOffset, keepCompressed);
+  if (tiled)
+    convertToTiledLayout();
 }
 
-DDSTexture::DDSTexture(const unsigned char *buf, size_t bufSize, int mipOffset)
+DDSTexture::DDSTexture(const unsigned char *buf, size_t bufSize, int mipOffset,
+                       bool tiled, bool keepCompressed)
 {
   FileBuffer  tmpBuf(buf, bufSize);
-  loadTexture(tmpBuf, mipOffset);
+  loadTexture(tmpBuf, mipOffset, keepCompressed);
+  if (tiled)
+    convertToTiledLayout();
 }
 
-DDSTexture::DDSTexture(FileBuffer& buf, int mipOffset)
+DDSTexture::DDSTexture(FileBuffer& buf, int mipOffset, bool tiled,
+                       bool keepCompressed)
 {
-  loadTexture(buf, mipOffset);
+  loadTexture(buf, mipOffset, keepCompressed);
+  if (tiled)
+    convertToTiledLayout();
 }
 
 DDSTexture::DDSTexture(std::uint32_t c, bool srgbColor)
@@ -815,7 +936,11 @@ DDSTexture::DDSTexture(std::uint32_t c, bool srgbColor)
     isSRGB(srgbColor),
     channelCnt(4),
     maxTextureNum(0),
-    dxgiFormat(0)
+    dxgiFormat(0),
+    tiledLayout(false),
+    genericSampling(false),
+    blockCompressed(false),
+    blockCacheID(0U)
 {
 #if ENABLE_X86_64_SIMD >= 2
   std::uintptr_t  tmp1 =
@@ -840,6 +965,160 @@ DDSTexture::~DDSTexture()
     std::free(textureData[0]);
 }
 
+inline int DDSTexture::convertTexelCoord_Generic(int x, int w, int addrMode)
+{
+  if (addrMode == 2)
+    return std::min(std::max(x, 0), w - 1);
+  int     n = (!addrMode ? w : (w << 1));
+  x = x % n;
+  x = (x >= 0 ? x : (x + n));
+  return (x < w ? x : (n - (x + 1)));
+}
+
+const std::uint32_t * DDSTexture::decodeBlockCached(
+    const unsigned char *p) const
+{
+  std::uint32_t h = blockCacheID;
+  hashFunctionUInt32(h, std::uint32_t(std::uintptr_t(p) >> 3));
+  DDSBlockCacheEntry& e = ddsBlockCache[h & 0xFFU];
+  if (e.blockPtr != p || e.textureID != blockCacheID) [[unlikely]]
+  {
+    (void) dxgiFormatInfoTable[dxgiFormatMap[dxgiFormat]].decodeFunction(
+               e.texels, p, 4);
+    e.blockPtr = p;
+    e.textureID = blockCacheID;
+  }
+  return e.texels;
+}
+
+inline const std::uint32_t * DDSTexture::getBlock_Generic(
+    int x, int y, int mipLevel, size_t n) const
+{
+  const unsigned char *p = reinterpret_cast< const unsigned char * >(
+                               textureData[mipLevel]
+                               + (size_t(textureDataSize) * n));
+  size_t  blockSize = dxgiFormatInfoTable[dxgiFormatMap[dxgiFormat]].blockSize;
+  size_t  w = (getMipDimension(xMaskMip0, mipLevel) + 3U) >> 2;
+  return decodeBlockCached(p + ((size_t(y >> 2) * w + size_t(x >> 2))
+                                * blockSize));
+}
+
+inline const std::uint32_t& DDSTexture::getTexel_Generic(
+    int x, int y, int mipLevel, size_t n) const
+{
+  if (!blockCompressed)
+  {
+    size_t  w = getMipDimension(xMaskMip0, mipLevel);
+    return textureData[mipLevel][size_t(textureDataSize) * n
+                                 + (size_t(y) * w + size_t(x))];
+  }
+  return getBlock_Generic(x, y, mipLevel, n)[((y & 3) << 2) | (x & 3)];
+}
+
+template< bool isClamped > inline FloatVector4 DDSTexture::getPixelB_Generic(
+    float x, float y, int mipLevel) const
+{
+  unsigned int  w = getMipDimension(xMaskMip0, mipLevel);
+  unsigned int  h = getMipDimension(yMaskMip0, mipLevel);
+  x = x * float(int(w)) - 0.5f;
+  y = y * float(int(h)) - 0.5f;
+  float   xf = float(std::floor(x));
+  float   yf = float(std::floor(y));
+  int     x0 = int(xf);
+  int     y0 = int(yf);
+  xf = x - xf;
+  yf = y - yf;
+  int     x1, y1;
+  if (isClamped)
+  {
+    x1 = std::min< int >(std::max< int >(x0 + 1, 0), int(w - 1U));
+    y1 = std::min< int >(std::max< int >(y0 + 1, 0), int(h - 1U));
+    x0 = std::min< int >(std::max< int >(x0, 0), int(w - 1U));
+    y0 = std::min< int >(std::max< int >(y0, 0), int(h - 1U));
+  }
+  else
+  {
+    x0 = convertTexelCoord_Generic(x0, int(w), 0);
+    y0 = convertTexelCoord_Generic(y0, int(h), 0);
+    x1 = ((x0 + 1) < int(w) ? (x0 + 1) : 0);
+    y1 = ((y0 + 1) < int(h) ? (y0 + 1) : 0);
+  }
+  std::uint32_t c[4];
+  if (!blockCompressed)
+  {
+    c[0] = getTexel_Generic(x0, y0, mipLevel, 0);
+    c[1] = getTexel_Generic(x1, y0, mipLevel, 0);
+    c[2] = getTexel_Generic(x0, y1, mipLevel, 0);
+    c[3] = getTexel_Generic(x1, y1, mipLevel, 0);
+  }
+  else
+  {
+    // all four texels are in the same block in most cases, the decoded
+    // texels are copied because later fetches may overwrite the cache entry
+    const std::uint32_t *b = getBlock_Generic(x0, y0, mipLevel, 0);
+    c[0] = b[((y0 & 3) << 2) | (x0 & 3)];
+    c[1] = b[((y0 & 3) << 2) | (x1 & 3)];
+    c[2] = b[((y1 & 3) << 2) | (x0 & 3)];
+    c[3] = b[((y1 & 3) << 2) | (x1 & 3)];
+    bool    sameBlockX = ((x0 >> 2) == (x1 >> 2));
+    bool    sameBlockY = ((y0 >> 2) == (y1 >> 2));
+    if (!sameBlockX) [[unlikely]]
+      c[1] = getTexel_Generic(x1, y0, mipLevel, 0);
+    if (!sameBlockY) [[unlikely]]
+      c[2] = getTexel_Generic(x0, y1, mipLevel, 0);
+    if (!(sameBlockX && sameBlockY)) [[unlikely]]
+      c[3] = getTexel_Generic(x1, y1, mipLevel, 0);
+  }
+  return FloatVector4(&(c[0]), &(c[1]), &(c[2]), &(c[3]), xf, yf);
+}
+
+const std::uint32_t& DDSTexture::getPixelN_Generic(
+    int x, int y, int mipLevel, int n, int addrMode) const
+{
+  int     w = int(getMipDimension(xMaskMip0, mipLevel));
+  int     h = int(getMipDimension(yMaskMip0, mipLevel));
+  x = convertTexelCoord_Generic(x, w, addrMode);
+  y = convertTexelCoord_Generic(y, h, addrMode);
+  return getTexel_Generic(x, y, mipLevel, size_t(n));
+}
+
+FloatVector4 DDSTexture::getPixelT_Generic(
+    float x, float y, float mipLevel, int addrMode) const
+{
+  if (addrMode == 1)
+  {
+    float   xf = float(std::floor(x));
+    float   yf = float(std::floor(y));
+    x = x - xf;
+    y = y - yf;
+    x = (!(int(xf) & 1) ? x : (1.0f - x));
+    y = (!(int(yf) & 1) ? y : (1.0f - y));
+  }
+  mipLevel = std::max(mipLevel, 0.0f);
+  int     m0 = int(mipLevel);
+  unsigned int  w = getMipDimension(xMaskMip0, m0);
+  unsigned int  h = getMipDimension(yMaskMip0, m0);
+  if ((w | h) == 1U) [[unlikely]]
+    return FloatVector4(&(getTexel_Generic(0, 0, m0, 0)));
+  FloatVector4  c0;
+  if (!addrMode)
+    c0 = getPixelB_Generic< false >(x, y, m0);
+  else
+    c0 = getPixelB_Generic< true >(x, y, m0);
+  float   mf = float(m0);
+  if (mf != mipLevel) [[likely]]
+  {
+    mf = mipLevel - mf;
+    FloatVector4  c1;
+    if (!addrMode)
+      c1 = getPixelB_Generic< false >(x, y, m0 + 1);
+    else
+      c1 = getPixelB_Generic< true >(x, y, m0 + 1);
+    c0 = (c0 * (1.0f - mf)) + (c1 * mf);
+  }
+  return c0;
+}
+
 FloatVector4 DDSTexture::getPixelB(float x, float y, int mipLevel) const
 {
   return getPixelB_Inline(x, y, mipLevel);
@@ -850,8 +1129,8 @@ FloatVector4 DDSTexture::getPixelT(float x, float y, float mipLevel) const
   return getPixelT_Inline(x, y, mipLevel);
 }
 
-FloatVector4 DDSTexture::getPixelT_2(float x, float y, float mipLevel,
-                                     const DDSTexture& t) const
+template< bool isTiled > FloatVector4 DDSTexture::getPixelT_2_Impl(
+    float x, float y, float mipLevel, const DDSTexture& t) const
 {
   mipLevel = std::max(mipLevel, 0.0f);
   int     m0 = int(mipLevel);
@@ -861,13 +1140,16 @@ FloatVector4 DDSTexture::getPixelT_2(float x, float y, float mipLevel,
   unsigned int  yMask = yMaskMip0;
   unsigned int  xMask2 = t.xMaskMip0;
   unsigned int  yMask2 = t.yMaskMip0;
-  if (!(xMask2 == xMask && yMask2 == yMask)) [[unlikely]]
+  if (!(xMask2 == xMask && yMask2 == yMask && t.tiledLayout == isTiled))
+      [[unlikely]]
   {
-    if (xMask2 == (xMask >> 1) && yMask2 == (yMask >> 1) && m0 > 0)
+    if (xMask2 == (xMask >> 1) && yMask2 == (yMask >> 1) && m0 > 0 &&
+        t.tiledLayout == isTiled)
     {
       t2--;
     }
-    else if ((xMask2 >> 1) == xMask && (yMask2 >> 1) == yMask)
+    else if ((xMask2 >> 1) == xMask && (yMask2 >> 1) == yMask &&
+             t.tiledLayout == isTiled)
     {
       t2++;
     }
@@ -884,20 +1166,40 @@ FloatVector4 DDSTexture::getPixelT_2(float x, float y, float mipLevel,
   float   xf, yf;
   if (!convertTexCoord(x0, y0, xf, yf, xMask, yMask, x, y, m0)) [[unlikely]]
     return FloatVector4(t1[0], t2[0]);
-  FloatVector4  c0(getPixelB_2(t1[0], t2[0], x0, y0, xf, yf, xMask, yMask));
+  FloatVector4  c0(getPixelB_2< isTiled >(t1[0], t2[0], x0, y0, xf, yf,
+                                          xMask, yMask));
   float   mf = float(m0);
   if (mf != mipLevel) [[likely]]
   {
     mf = mipLevel - mf;
     getNextMipTexCoord(x0, y0, xf, yf);
-    FloatVector4  c1(getPixelB_2(t1[1], t2[1], x0, y0, xf, yf,
-                                 xMask >> 1, yMask >> 1));
+    FloatVector4  c1(getPixelB_2< isTiled >(t1[1], t2[1], x0, y0, xf, yf,
+                                            xMask >> 1, yMask >> 1));
     c0 = (c0 * (1.0f - mf)) + (c1 * mf);
   }
   return c0;
 }
 
-FloatVector4 DDSTexture::getPixelT_N(float x, float y, float mipLevel) const
+FloatVector4 DDSTexture::getPixelT_2(float x, float y, float mipLevel,
+                                     const DDSTexture& t) const
+{
+  if (tiledLayout | genericSampling | t.genericSampling) [[unlikely]]
+  {
+    if (genericSampling | t.genericSampling)
+    {
+      FloatVector4  tmp1(getPixelT(x, y, mipLevel));
+      FloatVector4  tmp2(t.getPixelT(x, y, mipLevel));
+      tmp1[2] = tmp2[0];
+      tmp1[3] = tmp2[1];
+      return tmp1;
+    }
+    return getPixelT_2_Impl< true >(x, y, mipLevel, t);
+  }
+  return getPixelT_2_Impl< false >(x, y, mipLevel, t);
+}
+
+template< bool isTiled > FloatVector4 DDSTexture::getPixelT_N_Impl(
+    float x, float y, float mipLevel) const
 {
   mipLevel = std::max(mipLevel, 0.0f);
   int     m0 = int(mipLevel);
@@ -913,26 +1215,44 @@ FloatVector4 DDSTexture::getPixelT_N(float x, float y, float mipLevel) const
   int     y0 = int(yf);
   xf = x - xf;
   yf = y - yf;
-  FloatVector4  c0(getPixelB_Wrap(textureData[m0], x0, y0, xf, yf,
-                                  xMask, yMask));
+  FloatVector4  c0(getPixelB_Wrap< isTiled >(textureData[m0], x0, y0, xf, yf,
+                                             xMask, yMask));
   float   mf = float(m0);
   if (mf != mipLevel) [[likely]]
   {
     mf = mipLevel - mf;
     getNextMipTexCoord(x0, y0, xf, yf);
-    FloatVector4  c1(getPixelB_Wrap(textureData[m0 + 1], x0, y0, xf, yf,
-                                    xMask >> 1, yMask >> 1));
+    FloatVector4  c1(getPixelB_Wrap< isTiled >(textureData[m0 + 1], x0, y0,
+                                               xf, yf, xMask >> 1, yMask >> 1));
     c0 = (c0 * (1.0f - mf)) + (c1 * mf);
   }
   return c0;
 }
 
+FloatVector4 DDSTexture::getPixelT_N(float x, float y, float mipLevel) const
+{
+  if (tiledLayout | genericSampling) [[unlikely]]
+  {
+    if (genericSampling)
+    {
+      // convert to normalized texture coordinates
+      int     m0 = int(std::max(mipLevel, 0.0f));
+      x = x / float(int(getMipDimension(xMaskMip0, m0)));
+      y = y / float(int(getMipDimension(yMaskMip0, m0)));
+      return getPixelT_Generic(x, y, mipLevel, 0);
+    }
+    return getPixelT_N_Impl< true >(x, y, mipLevel);
+  }
+  return getPixelT_N_Impl< false >(x, y, mipLevel);
+}
+
 FloatVector4 DDSTexture::getPixelBM(float x, float y, int mipLevel) const
 {
   return getPixelBM_Inline(x, y, mipLevel);
 }
 
-FloatVector4 DDSTexture::getPixelTM(float x, float y, float mipLevel) const
+template< bool isTiled > FloatVector4 DDSTexture::getPixelTM_Impl(
+    float x, float y, float mipLevel) const
 {
   mipLevel = std::max(mipLevel, 0.0f);
   int     m0 = int(mipLevel);
@@ -946,26 +1266,39 @@ FloatVector4 DDSTexture::getPixelTM(float x, float y, float mipLevel) const
   unsigned int  xMask, yMask;
   if (!convertTexCoord(x0, y0, xf, yf, xMask, yMask, x, y, m0)) [[unlikely]]
     return FloatVector4(textureData[m0]);
-  FloatVector4  c0(getPixelB_Clamp(textureData[m0], x0, y0, xf, yf,
-                                   xMask, yMask));
+  FloatVector4  c0(getPixelB_Clamp< isTiled >(textureData[m0], x0, y0, xf, yf,
+                                              xMask, yMask));
   float   mf = float(m0);
   if (mf != mipLevel) [[likely]]
   {
     mf = mipLevel - mf;
     getNextMipTexCoord(x0, y0, xf, yf);
-    FloatVector4  c1(getPixelB_Clamp(textureData[m0 + 1], x0, y0, xf, yf,
-                                     xMask >> 1, yMask >> 1));
+    FloatVector4  c1(getPixelB_Clamp< isTiled >(textureData[m0 + 1], x0, y0,
+                                                xf, yf,
+                                                xMask >> 1, yMask >> 1));
     c0 = (c0 * (1.0f - mf)) + (c1 * mf);
   }
   return c0;
 }
 
+FloatVector4 DDSTexture::getPixelTM(float x, float y, float mipLevel) const
+{
+  if (tiledLayout | genericSampling) [[unlikely]]
+  {
+    if (genericSampling)
+      return getPixelT_Generic(x, y, mipLevel, 1);
+    return getPixelTM_Impl< true >(x, y, mipLevel);
+  }
+  return getPixelTM_Impl< false >(x, y, mipLevel);
+}
+
 FloatVector4 DDSTexture::getPixelBC(float x, float y, int mipLevel) const
 {
   return getPixelBC_Inline(x, y, mipLevel);
 }
 
-FloatVector4 DDSTexture::getPixelTC(float x, float y, float mipLevel) const
+template< bool isTiled > FloatVector4 DDSTexture::getPixelTC_Impl(
+    float x, float y, float mipLevel) const
 {
   mipLevel = std::max(mipLevel, 0.0f);
   int     m0 = int(mipLevel);
@@ -974,20 +1307,32 @@ FloatVector4 DDSTexture::getPixelTC(float x, float y, float mipLevel) const
   unsigned int  xMask, yMask;
   if (!convertTexCoord(x0, y0, xf, yf, xMask, yMask, x, y, m0)) [[unlikely]]
     return FloatVector4(textureData[m0]);
-  FloatVector4  c0(getPixelB_Clamp(textureData[m0], x0, y0, xf, yf,
-                                   xMask, yMask));
+  FloatVector4  c0(getPixelB_Clamp< isTiled >(textureData[m0], x0, y0, xf, yf,
+                                              xMask, yMask));
   float   mf = float(m0);
   if (mf != mipLevel) [[likely]]
   {
     mf = mipLevel - mf;
     getNextMipTexCoord(x0, y0, xf, yf);
-    FloatVector4  c1(getPixelB_Clamp(textureData[m0 + 1], x0, y0, xf, yf,
-                                     xMask >> 1, yMask >> 1));
+    FloatVector4  c1(getPixelB_Clamp< isTiled >(textureData[m0 + 1], x0, y0,
+                                                xf, yf,
+                                                xMask >> 1, yMask >> 1));
     c0 = (c0 * (1.0f - mf)) + (c1 * mf);
   }
   return c0;
 }
 
+FloatVector4 DDSTexture::getPixelTC(float x, float y, float mipLevel) const
+{
+  if (tiledLayout | genericSampling) [[unlikely]]
+  {
+    if (genericSampling)
+      return getPixelT_Generic(x, y, mipLevel, 2);
+    return getPixelTC_Impl< true >(x, y, mipLevel);
+  }
+  return getPixelTC_Impl< false >(x, y, mipLevel);
+}
+
 const unsigned char DDSTexture::cubeWrapTable[24] =
 {
   // value = new_face + mirror_U * 0x20 + mirror_V * 0x40 + swap_UV * 0x80
@@ -1016,7 +1361,7 @@ inline bool DDSTexture::convertTexCoord_Cube(
   return bool(xMask);
 }
 
-inline void DDSTexture::getPixel_CubeWrap(
+template< bool isTiled > inline void DDSTexture::getPixel_CubeWrap(
     FloatVector4& c, float& scale, float weight,
     const std::uint32_t *p, int x, int y, int n, size_t faceDataSize,
     unsigned int xMask)
@@ -1027,11 +1372,13 @@ inline void DDSTexture::getPixel_CubeWrap(
     return;
   }
   c += (FloatVector4(p + ((size_t(n) * faceDataSize)
-                          + ((unsigned int) y * (xMask + 1U)
-                          + (unsigned int) x))) * weight);
+                          + getTexelOffset< isTiled >((unsigned int) x,
+                                                      (unsigned int) y,
+                                                      xMask, xMask)))
+        * weight);
 }
 
-FloatVector4 DDSTexture::getPixelB_CubeWrap(
+template< bool isTiled > FloatVector4 DDSTexture::getPixelB_CubeWrap(
     const std::uint32_t *p, int x0, int y0, int n, size_t faceDataSize,
     float xf, float yf, unsigned int xMask)
 {
@@ -1043,35 +1390,65 @@ FloatVector4 DDSTexture::getPixelB_CubeWrap(
   float   weight0 = (1.0f - xf) - weight2;
   int     x1 = x0 + 1;
   int     y1 = y0 + 1;
-  getPixel_CubeWrap(c, scale, weight0, p, x0, y0, n, faceDataSize, xMask);
-  getPixel_CubeWrap(c, scale, weight1, p, x1, y0, n, faceDataSize, xMask);
-  getPixel_CubeWrap(c, scale, weight2, p, x0, y1, n, faceDataSize, xMask);
-  getPixel_CubeWrap(c, scale, weight3, p, x1, y1, n, faceDataSize, xMask);
+  getPixel_CubeWrap< isTiled >(c, scale, weight0, p, x0, y0, n, faceDataSize,
+                               xMask);
+  getPixel_CubeWrap< isTiled >(c, scale, weight1, p, x1, y0, n, faceDataSize,
+                               xMask);
+  getPixel_CubeWrap< isTiled >(c, scale, weight2, p, x0, y1, n, faceDataSize,
+                               xMask);
+  getPixel_CubeWrap< isTiled >(c, scale, weight3, p, x1, y1, n, faceDataSize,
+                               xMask);
   return (c * scale);
 }
 
-inline FloatVector4 DDSTexture::getPixelB_Cube(
+template< bool isTiled > inline FloatVector4 DDSTexture::getPixelB_Cube(
     const std::uint32_t *p, int x0, int y0, int n, size_t faceDataSize,
     float xf, float yf, unsigned int xMask)
 {
   if ((x0 | y0 | (x0 + 1) | (y0 + 1)) & ~(int(xMask))) [[unlikely]]
-    return getPixelB_CubeWrap(p, x0, y0, n, faceDataSize, xf, yf, xMask);
-  int     x1 = x0 + 1;
-  int     y1 = y0 + 1;
-  unsigned int  w = xMask + 1U;
-  FloatVector4  c0(p + ((size_t(n) * faceDataSize)
-                        + ((unsigned int) y0 * w + (unsigned int) x0)));
-  FloatVector4  c1(p + ((size_t(n) * faceDataSize)
-                        + ((unsigned int) y0 * w + (unsigned int) x1)));
-  FloatVector4  c2(p + ((size_t(n) * faceDataSize)
-                        + ((unsigned int) y1 * w + (unsigned int) x0)));
-  FloatVector4  c3(p + ((size_t(n) * faceDataSize)
-                        + ((unsigned int) y1 * w + (unsigned int) x1)));
+  {
+    return getPixelB_CubeWrap< isTiled >(p, x0, y0, n, faceDataSize, xf, yf,
+                                         xMask);
+  }
+  unsigned int  x0u = (unsigned int) x0;
+  unsigned int  y0u = (unsigned int) y0;
+  unsigned int  x1u = x0u + 1U;
+  unsigned int  y1u = y0u + 1U;
+  p = p + (size_t(n) * faceDataSize);
+  FloatVector4  c0(p + getTexelOffset< isTiled >(x0u, y0u, xMask, xMask));
+  FloatVector4  c1(p + getTexelOffset< isTiled >(x1u, y0u, xMask, xMask));
+  FloatVector4  c2(p + getTexelOffset< isTiled >(x0u, y1u, xMask, xMask));
+  FloatVector4  c3(p + getTexelOffset< isTiled >(x1u, y1u, xMask, xMask));
   c0 = (c0 * (1.0f - xf)) + (c1 * xf);
   c2 = (c2 * (1.0f - xf)) + (c3 * xf);
   return (c0 + ((c2 - c0) * yf));
 }
 
+template< bool isTiled > FloatVector4 DDSTexture::cubeMap_Impl(
+    size_t n, float x, float y, float mipLevel) const
+{
+  mipLevel = std::max(mipLevel, 0.0f);
+  int     m0 = int(mipLevel);
+  float   mf = float(m0);
+  int     x0, y0;
+  float   xf, yf;
+  unsigned int  xMask;
+  if (!convertTexCoord_Cube(x0, y0, xf, yf, xMask, x, y, m0)) [[unlikely]]
+    mipLevel = mf;
+  FloatVector4  c0(getPixelB_Cube< isTiled >(textureData[m0], x0, y0, int(n),
+                                             textureDataSize, xf, yf, xMask));
+  if (mf != mipLevel) [[likely]]
+  {
+    mf = mipLevel - mf;
+    getNextMipTexCoord(x0, y0, xf, yf);
+    FloatVector4  c1(getPixelB_Cube< isTiled >(textureData[m0 + 1], x0, y0,
+                                               int(n), textureDataSize,
+                                               xf, yf, xMask >> 1));
+    c0 = (c0 * (1.0f - mf)) + (c1 * mf);
+  }
+  return c0;
+}
+
 FloatVector4 DDSTexture::cubeMap(float x, float y, float z,
                                  float mipLevel) const
 {
@@ -1114,27 +1491,263 @@ FloatVector4 DDSTexture::cubeMap(float x, float y, float z,
     x = x * tmp * 0.5f + 0.5f;
     y = y * tmp * -0.5f + 0.5f;
   }
-  if (maxTextureNum < 5 || xMaskMip0 != yMaskMip0) [[unlikely]]
+  // non-power of two cube maps are sampled as 2D textures
+  if (maxTextureNum < 5 || xMaskMip0 != yMaskMip0 || genericSampling)
+      [[unlikely]]
     return getPixelTC(x, y, mipLevel);
-  mipLevel = std::max(mipLevel, 0.0f);
-  int     m0 = int(mipLevel);
-  float   mf = float(m0);
-  int     x0, y0;
-  float   xf, yf;
-  unsigned int  xMask;
-  if (!convertTexCoord_Cube(x0, y0, xf, yf, xMask, x, y, m0)) [[unlikely]]
-    mipLevel = mf;
-  FloatVector4  c0(getPixelB_Cube(textureData[m0], x0, y0, n,
-                                  textureDataSize, xf, yf, xMask));
-  if (mf != mipLevel) [[likely]]
+  if (tiledLayout) [[unlikely]]
+    return cubeMap_Impl< true >(n, x, y, mipLevel);
+  return cubeMap_Impl< false >(n, x, y, mipLevel);
+}
+
+static inline void transposeFloatVector4x8(FloatVector8 *c,
+                                           const FloatVector4 *p)
+{
+  for (size_t i = 0; i < 4; i++)
   {
-    mf = mipLevel - mf;
-    getNextMipTexCoord(x0, y0, xf, yf);
-    FloatVector4  c1(getPixelB_Cube(textureData[m0 + 1], x0, y0, n,
-                                    textureDataSize, xf, yf, xMask >> 1));
-    c0 = (c0 * (1.0f - mf)) + (c1 * mf);
+    c[i] = FloatVector8(p[0][i], p[1][i], p[2][i], p[3][i],
+                        p[4][i], p[5][i], p[6][i], p[7][i]);
   }
-  return c0;
+}
+
+// convert 8 normalized texture coordinates to integer and fractional parts
+// at mip levels m0 and m0 + 1, w and h are the dimensions of mip level 0
+static inline void convertTexCoord8(
+    std::int32_t *x0, std::int32_t *y0, float *xf, float *yf,
+    std::int32_t *x1, std::int32_t *y1, float *xf1, float *yf1,
+    const FloatVector8& x, const FloatVector8& y, const FloatVector8& m0,
+    float w, float h)
+{
+  FloatVector8  mipScale(m0 * -1.0f);
+  mipScale.exp2V();
+  FloatVector8  xc(mipScale * w);
+  FloatVector8  yc(mipScale * h);
+  xc = x * xc.maxValues(FloatVector8(1.0f)) - 0.5f;
+  yc = y * yc.maxValues(FloatVector8(1.0f)) - 0.5f;
+  FloatVector8  xi(xc);
+  FloatVector8  yi(yc);
+  xi.floorValues();
+  yi.floorValues();
+  xi.convertToInt32(x0);
+  yi.convertToInt32(y0);
+  (xc - xi).convertToFloats(xf);
+  (yc - yi).convertToFloats(yf);
+  xc = xc * 0.5f - 0.25f;
+  yc = yc * 0.5f - 0.25f;
+  xi = xc;
+  yi = yc;
+  xi.floorValues();
+  yi.floorValues();
+  xi.convertToInt32(x1);
+  yi.convertToInt32(y1);
+  (xc - xi).convertToFloats(xf1);
+  (yc - yi).convertToFloats(yf1);
+}
+
+template< bool isTiled, bool isClamped > void DDSTexture::getPixelT8_Impl(
+    FloatVector8 *c, const FloatVector8& x, const FloatVector8& y,
+    const FloatVector8& mipLevel) const
+{
+  FloatVector8  m(mipLevel);
+  m.maxValues(FloatVector8(0.0f)).minValues(FloatVector8(17.0f));
+  FloatVector8  m0(m);
+  m0.floorValues();
+  std::int32_t  mipNums[8];
+  float   mf[8];
+  m0.convertToInt32(mipNums);
+  (m - m0).convertToFloats(mf);
+  std::int32_t  x0[8], y0[8], x1[8], y1[8];
+  float   xf[8], yf[8], xf1[8], yf1[8];
+  convertTexCoord8(x0, y0, xf, yf, x1, y1, xf1, yf1, x, y, m0,
+                   float(int(xMaskMip0 + 1U)), float(int(yMaskMip0 + 1U)));
+  FloatVector4  tmp[8];
+  for (size_t i = 0; i < 8; i++)
+  {
+    int     m0i = mipNums[i];
+    unsigned int  xMask = xMaskMip0 >> (unsigned char) m0i;
+    unsigned int  yMask = yMaskMip0 >> (unsigned char) m0i;
+    const std::uint32_t *p = textureData[m0i];
+    if (!isClamped)
+      tmp[i] = getPixelB_Wrap< isTiled >(p, x0[i], y0[i], xf[i], yf[i],
+                                         xMask, yMask);
+    else
+      tmp[i] = getPixelB_Clamp< isTiled >(p, x0[i], y0[i], xf[i], yf[i],
+                                          xMask, yMask);
+    if (mf[i] != 0.0f && (xMask | yMask)) [[likely]]
+    {
+      FloatVector4  c1;
+      p = textureData[m0i + 1];
+      if (!isClamped)
+        c1 = getPixelB_Wrap< isTiled >(p, x1[i], y1[i], xf1[i], yf1[i],
+                                       xMask >> 1, yMask >> 1);
+      else
+        c1 = getPixelB_Clamp< isTiled >(p, x1[i], y1[i], xf1[i], yf1[i],
+                                        xMask >> 1, yMask >> 1);
+      tmp[i] = (tmp[i] * (1.0f - mf[i])) + (c1 * mf[i]);
+    }
+  }
+  transposeFloatVector4x8(c, tmp);
+}
+
+void DDSTexture::getPixelT8_Generic(
+    FloatVector8 *c, const FloatVector8& x, const FloatVector8& y,
+    const FloatVector8& mipLevel, int addrMode) const
+{
+  FloatVector4  tmp[8];
+  for (size_t i = 0; i < 8; i++)
+    tmp[i] = getPixelT_Generic(x[i], y[i], mipLevel[i], addrMode);
+  transposeFloatVector4x8(c, tmp);
+}
+
+void DDSTexture::getPixelT8(
+    FloatVector8 *c, const FloatVector8& x, const FloatVector8& y,
+    const FloatVector8& mipLevel) const
+{
+  if (tiledLayout | genericSampling) [[unlikely]]
+  {
+    if (genericSampling)
+      getPixelT8_Generic(c, x, y, mipLevel, 0);
+    else
+      getPixelT8_Impl< true, false >(c, x, y, mipLevel);
+  }
+  else
+  {
+    getPixelT8_Impl< false, false >(c, x, y, mipLevel);
+  }
+}
+
+void DDSTexture::getPixelTM8(
+    FloatVector8 *c, const FloatVector8& x, const FloatVector8& y,
+    const FloatVector8& mipLevel) const
+{
+  if (genericSampling) [[unlikely]]
+  {
+    getPixelT8_Generic(c, x, y, mipLevel, 1);
+    return;
+  }
+  FloatVector8  xi(x);
+  FloatVector8  yi(y);
+  xi.floorValues();
+  yi.floorValues();
+  FloatVector8  xm(x - xi);
+  FloatVector8  ym(y - yi);
+  // 1.0 if the integer part is odd, 0.0 otherwise
+  xi = xi - ((xi * 0.5f).floorValues() * 2.0f);
+  yi = yi - ((yi * 0.5f).floorValues() * 2.0f);
+  xm = (xm * (FloatVector8(1.0f) - xi)) + ((FloatVector8(1.0f) - xm) * xi);
+  ym = (ym * (FloatVector8(1.0f) - yi)) + ((FloatVector8(1.0f) - ym) * yi);
+  if (tiledLayout) [[unlikely]]
+    getPixelT8_Impl< true, true >(c, xm, ym, mipLevel);
+  else
+    getPixelT8_Impl< false, true >(c, xm, ym, mipLevel);
+}
+
+void DDSTexture::getPixelTC8(
+    FloatVector8 *c, const FloatVector8& x, const FloatVector8& y,
+    const FloatVector8& mipLevel) const
+{
+  if (tiledLayout | genericSampling) [[unlikely]]
+  {
+    if (genericSampling)
+      getPixelT8_Generic(c, x, y, mipLevel, 2);
+    else
+      getPixelT8_Impl< true, true >(c, x, y, mipLevel);
+  }
+  else
+  {
+    getPixelT8_Impl< false, true >(c, x, y, mipLevel);
+  }
+}
+
+template< bool isTiled > void DDSTexture::cubeMap8_Impl(
+    FloatVector8 *c, const unsigned char *n, const FloatVector8& x,
+    const FloatVector8& y, const FloatVector8& mipLevel) const
+{
+  FloatVector8  m(mipLevel);
+  m.maxValues(FloatVector8(0.0f)).minValues(FloatVector8(17.0f));
+  FloatVector8  m0(m);
+  m0.floorValues();
+  std::int32_t  mipNums[8];
+  float   mf[8];
+  m0.convertToInt32(mipNums);
+  (m - m0).convertToFloats(mf);
+  std::int32_t  x0[8], y0[8], x1[8], y1[8];
+  float   xf[8], yf[8], xf1[8], yf1[8];
+  float   w = float(int(xMaskMip0 + 1U));
+  convertTexCoord8(x0, y0, xf, yf, x1, y1, xf1, yf1, x, y, m0, w, w);
+  FloatVector4  tmp[8];
+  for (size_t i = 0; i < 8; i++)
+  {
+    int     m0i = mipNums[i];
+    unsigned int  xMask = xMaskMip0 >> (unsigned char) m0i;
+    tmp[i] = getPixelB_Cube< isTiled >(textureData[m0i], x0[i], y0[i], n[i],
+                                       textureDataSize, xf[i], yf[i], xMask);
+    if (mf[i] != 0.0f && xMask) [[likely]]
+    {
+      FloatVector4  c1(getPixelB_Cube< isTiled >(
+                           textureData[m0i + 1], x1[i], y1[i], n[i],
+                           textureDataSize, xf1[i], yf1[i], xMask >> 1));
+      tmp[i] = (tmp[i] * (1.0f - mf[i])) + (c1 * mf[i]);
+    }
+  }
+  transposeFloatVector4x8(c, tmp);
+}
+
+void DDSTexture::cubeMap8(
+    FloatVector8 *c, const FloatVector8& x, const FloatVector8& y,
+    const FloatVector8& z, const FloatVector8& mipLevel) const
+{
+  float   xv[8], yv[8], zv[8];
+  x.convertToFloats(xv);
+  y.convertToFloats(yv);
+  z.convertToFloats(zv);
+  FloatVector8  xm(x);
+  FloatVector8  ym(y);
+  FloatVector8  zm(z);
+  xm.maxValues(x * -1.0f);
+  ym.maxValues(y * -1.0f);
+  zm.maxValues(z * -1.0f);
+  // bit N of maskX (maskY) is set if X (Y) is the major axis of sample N
+  std::uint32_t maskX =
+      ~((xm - ym).getSignMask() | (xm - zm).getSignMask()) & 0xFFU;
+  std::uint32_t maskY =
+      ~((ym - xm).getSignMask() | (ym - zm).getSignMask() | maskX) & 0xFFU;
+  // select face, and map the other two coordinates to s, t (-ma to ma)
+  unsigned char n[8];
+  float   s[8], t[8];
+  for (size_t i = 0; i < 8; i++)
+  {
+    if (maskX & (1U << i))              // +X (0), -X (1)
+    {
+      n[i] = (unsigned char) (xv[i] < 0.0f);
+      s[i] = (xv[i] < 0.0f ? zv[i] : -(zv[i]));
+      t[i] = -(yv[i]);
+    }
+    else if (maskY & (1U << i))         // +Y (2), -Y (3)
+    {
+      n[i] = (unsigned char) (2 + int(yv[i] < 0.0f));
+      s[i] = xv[i];
+      t[i] = (yv[i] < 0.0f ? -(zv[i]) : zv[i]);
+    }
+    else                                // +Z (4), -Z (5)
+    {
+      n[i] = (unsigned char) (4 + int(zv[i] < 0.0f));
+      s[i] = (zv[i] < 0.0f ? -(xv[i]) : xv[i]);
+      t[i] = -(yv[i]);
+    }
+  }
+  FloatVector8  ma(xm);
+  ma.maxValues(ym).maxValues(zm);
+  ma = FloatVector8(0.5f) / ma;
+  FloatVector8  u(FloatVector8(s) * ma + 0.5f);
+  FloatVector8  v(FloatVector8(t) * ma + 0.5f);
+  if (maxTextureNum < 5 || xMaskMip0 != yMaskMip0 || genericSampling)
+      [[unlikely]]
+    getPixelTC8(c, u, v, mipLevel);
+  else if (tiledLayout) [[unlikely]]
+    cubeMap8_Impl< true >(c, n, u, v, mipLevel);
+  else
+    cubeMap8_Impl< false >(c, n, u, v, mipLevel);
 }
 
 FloatVector4 DDSTexture::calculateAvgLevelFP16(
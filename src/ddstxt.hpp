@@ -5,6 +5,7 @@
 #include "common.hpp"
 #include "filebuf.hpp"
 #include "fp32vec4.hpp"
+#include "fp32vec8.hpp"
 
 class DDSTexture
 {
@@ -22,15 +23,25 @@ class DDSTexture
   static const DXGIFormatInfo dxgiFormatInfoTable[32];
   static const unsigned char  dxgiFormatMap[128];
   static const unsigned char  cubeWrapTable[24];
-  unsigned int  xMaskMip0;              // width - 1
-  unsigned int  yMaskMip0;              // height - 1
+  // width - 1 and height - 1, these can be used as masks for wrapping
+  // texture coordinates only if genericSampling is false
+  unsigned int  xMaskMip0;
+  unsigned int  yMaskMip0;
   std::uint32_t maxMipLevel;
-  std::uint32_t textureDataSize;        // total data size / (maxTextureNum + 1)
+  // total data size / (maxTextureNum + 1), in 32-bit words
+  std::uint32_t textureDataSize;
   std::uint32_t textureColor;           // for 1x1 texture without allocation
   bool          isSRGB;
   unsigned char channelCnt;
   unsigned char maxTextureNum;
   unsigned char dxgiFormat;             // 0 if constructed from a color
+  bool          tiledLayout;            // mipmaps stored as 4x4 texel tiles
+  // true if the texture has non-power of two dimensions, or is stored in
+  // block compressed format, getPixel*_Generic() are used for sampling
+  bool          genericSampling;
+  // mipmaps stored in BCn format, textureData[] points to the raw blocks
+  bool          blockCompressed;
+  std::uint32_t blockCacheID;           // unique ID if blockCompressed is true
   std::uint32_t *textureData[19];
   static size_t decodeBlock_BC1(
       std::uint32_t *dst, const unsigned char *src, unsigned int w);
@@ -76,39 +87,104 @@ class DDSTexture
                        size_t (*decodeFunction)(std::uint32_t *,
                                                 const unsigned char *,
                                                 unsigned int));
-  void loadTexture(FileBuffer& buf, int mipOffset);
+  void loadTexture(FileBuffer& buf, int mipOffset, bool keepCompressed);
+  // returns true if the texture data has been stored in compressed format
+  bool loadCompressedTextureData(const unsigned char *srcPtr, size_t srcSize,
+                                 int mipOffset);
+  // reorder mip levels of at least 4x4 texels to 4x4 tiles (64 bytes each)
+  void convertToTiledLayout();
+  // width or height of mip level 'mipLevel', n = mip 0 width or height - 1
+  static inline unsigned int getMipDimension(unsigned int n, int mipLevel)
+  {
+    return std::max< unsigned int >((n + 1U) >> (unsigned char) mipLevel, 1U);
+  }
+  // offset of texel x, y (already wrapped or clamped to xMask, yMask) from
+  // the start of the mip level, with linear or tiled (isTiled = true) layout
+  template< bool isTiled > static inline unsigned int getTexelOffset(
+      unsigned int x, unsigned int y, unsigned int xMask, unsigned int yMask);
+  inline unsigned int getTexelOffset(
+      unsigned int x, unsigned int y,
+      unsigned int xMask, unsigned int yMask) const;
   // X, Y coordinates are scaled to -0.5 to xMask + 0.5, -0.5 to yMask + 0.5
   inline bool convertTexCoord(
       int& x0, int& y0, float& xf, float& yf,
       unsigned int& xMask, unsigned int& yMask,
       float x, float y, int mipLevel) const;
   static inline void getNextMipTexCoord(int& x0, int& y0, float& xf, float& yf);
-  static inline FloatVector4 getPixelB_Wrap(
+  template< bool isTiled > static inline FloatVector4 getPixelB_Wrap(
       const std::uint32_t *p, int x0, int y0,
       float xf, float yf, unsigned int xMask, unsigned int yMask);
-  static inline FloatVector4 getPixelB_Clamp(
+  template< bool isTiled > static inline FloatVector4 getPixelB_Clamp(
       const std::uint32_t *p, int x0, int y0,
       float xf, float yf, unsigned int xMask, unsigned int yMask);
-  static inline FloatVector4 getPixelB_2(
+  template< bool isTiled > static inline FloatVector4 getPixelB_2(
       const std::uint32_t *p1, const std::uint32_t *p2, int x0, int y0,
       float xf, float yf, unsigned int xMask, unsigned int yMask);
   inline bool convertTexCoord_Cube(
       int& x0, int& y0, float& xf, float& yf,
       unsigned int& xMask, float x, float y, int mipLevel) const;
-  static inline void getPixel_CubeWrap(
+  template< bool isTiled > static inline void getPixel_CubeWrap(
       FloatVector4& c, float& scale, float weight,
       const std::uint32_t *p, int x, int y, int n, size_t faceDataSize,
       unsigned int xMask);
-  static FloatVector4 getPixelB_CubeWrap(
+  template< bool isTiled > static FloatVector4 getPixelB_CubeWrap(
       const std::uint32_t *p, int x0, int y0, int n, size_t faceDataSize,
       float xf, float yf, unsigned int xMask);
-  static inline FloatVector4 getPixelB_Cube(
+  template< bool isTiled > static inline FloatVector4 getPixelB_Cube(
       const std::uint32_t *p, int x0, int y0, int n, size_t faceDataSize,
       float xf, float yf, unsigned int xMask);
+  template< bool isTiled > inline FloatVector4 getPixelT_Impl(
+      float x, float y, float mipLevel) const;
+  template< bool isTiled > FloatVector4 getPixelT_2_Impl(
+      float x, float y, float mipLevel, const DDSTexture& t) const;
+  template< bool isTiled > FloatVector4 getPixelT_N_Impl(
+      float x, float y, float mipLevel) const;
+  template< bool isTiled > FloatVector4 getPixelTM_Impl(
+      float x, float y, float mipLevel) const;
+  template< bool isTiled > FloatVector4 getPixelTC_Impl(
+      float x, float y, float mipLevel) const;
+  template< bool isTiled > FloatVector4 cubeMap_Impl(
+      size_t n, float x, float y, float mipLevel) const;
+  template< bool isTiled, bool isClamped > void getPixelT8_Impl(
+      FloatVector8 *c, const FloatVector8& x, const FloatVector8& y,
+      const FloatVector8& mipLevel) const;
+  template< bool isTiled > void cubeMap8_Impl(
+      FloatVector8 *c, const unsigned char *n, const FloatVector8& x,
+      const FloatVector8& y, const FloatVector8& mipLevel) const;
+  // decode a 4x4 block using a per-thread cache of recently decoded blocks
+  const std::uint32_t *decodeBlockCached(const unsigned char *p) const;
+  // sampling functions for textures with non-power of two dimensions or
+  // block compressed data, addrMode = 0: wrap, 1: mirror, 2: clamp
+  static inline int convertTexelCoord_Generic(int x, int w, int addrMode);
+  // x and y must be in the range 0 to width - 1 and height - 1
+  inline const std::uint32_t *getBlock_Generic(int x, int y, int mipLevel,
+                                               size_t n) const;
+  inline const std::uint32_t& getTexel_Generic(int x, int y, int mipLevel,
+                                               size_t n) const;
+  template< bool isClamped > inline FloatVector4 getPixelB_Generic(
+      float x, float y, int mipLevel) const;
+  const std::uint32_t& getPixelN_Generic(int x, int y, int mipLevel, int n,
+                                         int addrMode) const;
+  FloatVector4 getPixelT_Generic(float x, float y, float mipLevel,
+                                 int addrMode) const;
+  void getPixelT8_Generic(FloatVector8 *c, const FloatVector8& x,
+                          const FloatVector8& y, const FloatVector8& mipLevel,
+                          int addrMode) const;
  public:
-  DDSTexture(const char *fileName, int mipOffset = 0);
-  DDSTexture(const unsigned char *buf, size_t bufSize, int mipOffset = 0);
-  DDSTexture(FileBuffer& buf, int mipOffset = 0);
+  // if tiledLayout is true, mip levels with a size of at least 4x4 are stored
+  // as 4x4 texel tiles instead of in row-major order, this improves cache
+  // locality when the texture is not sampled along horizontal lines
+  // textures with non-power of two dimensions are supported, but use slower
+  // sampling functions, and are always stored in linear layout
+  // if keepCompressed is true, BC1 to BC7 textures that are not cube maps and
+  // have a complete mipmap chain are stored in compressed format, and blocks
+  // are decoded as needed when sampling the texture (tiledLayout is ignored)
+  DDSTexture(const char *fileName, int mipOffset = 0, bool tiledLayout = false,
+             bool keepCompressed = false);
+  DDSTexture(const unsigned char *buf, size_t bufSize, int mipOffset = 0,
+             bool tiledLayout = false, bool keepCompressed = false);
+  DDSTexture(FileBuffer& buf, int mipOffset = 0, bool tiledLayout = false,
+             bool keepCompressed = false);
   // create 1x1 texture of color c without allocating memory
   DDSTexture(std::uint32_t c, bool srgbColor = false);
   ~DDSTexture();
@@ -148,7 +224,17 @@ class DDSTexture
   {
     return dxgiFormatInfoTable[dxgiFormatMap[dxgiFormat]].name;
   }
-  // get pointer to raw texture data and its total size
+  inline bool getIsTiled() const
+  {
+    return tiledLayout;
+  }
+  inline bool getIsBlockCompressed() const
+  {
+    return blockCompressed;
+  }
+  // get pointer to raw texture data and its total size in 32-bit words
+  // (the data is in 4x4 tiles if getIsTiled() returns true, and in the
+  // original BCn format if getIsBlockCompressed() returns true)
   inline const std::uint32_t *data() const
   {
     return textureData[0];
@@ -158,42 +244,54 @@ class DDSTexture
     return (size_t(textureDataSize) * (maxTextureNum + 1U));
   }
   // no interpolation, returns color in RGBA format (LSB = red, MSB = alpha)
+  // if the texture is block compressed, the reference is only valid until
+  // the next call to a sampling function on the same thread
   inline const std::uint32_t& getPixelN(int x, int y, int mipLevel) const
   {
+    if (genericSampling) [[unlikely]]
+      return getPixelN_Generic(x, y, mipLevel, 0, 0);
     unsigned int  xMask = xMaskMip0 >> (unsigned char) mipLevel;
     unsigned int  yMask = yMaskMip0 >> (unsigned char) mipLevel;
-    return textureData[mipLevel][((unsigned int) y & yMask) * (xMask + 1U)
-                                 + ((unsigned int) x & xMask)];
+    return textureData[mipLevel][getTexelOffset((unsigned int) x & xMask,
+                                                (unsigned int) y & yMask,
+                                                xMask, yMask)];
   }
   inline const std::uint32_t& getPixelN(int x, int y, int mipLevel, int n) const
   {
+    if (genericSampling) [[unlikely]]
+      return getPixelN_Generic(x, y, mipLevel, n, 0);
     unsigned int  xMask = xMaskMip0 >> (unsigned char) mipLevel;
     unsigned int  yMask = yMaskMip0 >> (unsigned char) mipLevel;
     const std::uint32_t *p =
         textureData[mipLevel] + (size_t(textureDataSize) * size_t(n));
-    return p[((unsigned int) y & yMask) * (xMask + 1U)
-             + ((unsigned int) x & xMask)];
+    return p[getTexelOffset((unsigned int) x & xMask, (unsigned int) y & yMask,
+                            xMask, yMask)];
   }
   // getPixelN() with mirrored instead of wrapped texture coordinates
   inline const std::uint32_t& getPixelM(int x, int y, int mipLevel) const
   {
+    if (genericSampling) [[unlikely]]
+      return getPixelN_Generic(x, y, mipLevel, 0, 1);
     unsigned int  xMask = xMaskMip0 >> (unsigned char) mipLevel;
     unsigned int  yMask = yMaskMip0 >> (unsigned char) mipLevel;
     unsigned int  xc = (unsigned int) x;
     unsigned int  yc = (unsigned int) y;
     xc = (!(xc & (xMask + 1U)) ? xc : ~xc) & xMask;
     yc = (!(yc & (yMask + 1U)) ? yc : ~yc) & yMask;
-    return textureData[mipLevel][yc * (xMask + 1U) + xc];
+    return textureData[mipLevel][getTexelOffset(xc, yc, xMask, yMask)];
   }
   // getPixelN() with clamped texture coordinates
   inline const std::uint32_t& getPixelC(int x, int y, int mipLevel) const
   {
+    if (genericSampling) [[unlikely]]
+      return getPixelN_Generic(x, y, mipLevel, 0, 2);
     unsigned int  xMask = xMaskMip0 >> (unsigned char) mipLevel;
     unsigned int  yMask = yMaskMip0 >> (unsigned char) mipLevel;
     x = (x > 0 ? (x < int(xMask) ? x : int(xMask)) : 0);
     y = (y > 0 ? (y < int(yMask) ? y : int(yMask)) : 0);
     const std::uint32_t *p = textureData[mipLevel];
-    return p[(unsigned int) y * (xMask + 1U) + (unsigned int) x];
+    return p[getTexelOffset((unsigned int) x, (unsigned int) y,
+                            xMask, yMask)];
   }
   // bilinear filtering (getPixelB/getPixelT use normalized texture coordinates)
   FloatVector4 getPixelB(float x, float y, int mipLevel) const;
@@ -222,6 +320,17 @@ class DDSTexture
   // y = -1.0 to 1.0: S to N
   // z = -1.0 to 1.0: bottom to top
   FloatVector4 cubeMap(float x, float y, float z, float mipLevel) const;
+  // Batched versions of getPixelT(), getPixelTM(), getPixelTC() and cubeMap()
+  // that filter 8 samples per call. The output is stored in c[0] to c[3] as
+  // the red, green, blue and alpha channels of the 8 samples (SoA format).
+  void getPixelT8(FloatVector8 *c, const FloatVector8& x,
+                  const FloatVector8& y, const FloatVector8& mipLevel) const;
+  void getPixelTM8(FloatVector8 *c, const FloatVector8& x,
+                   const FloatVector8& y, const FloatVector8& mipLevel) const;
+  void getPixelTC8(FloatVector8 *c, const FloatVector8& x,
+                   const FloatVector8& y, const FloatVector8& mipLevel) const;
+  void cubeMap8(FloatVector8 *c, const FloatVector8& x, const FloatVector8& y,
+                const FloatVector8& z, const FloatVector8& mipLevel) const;
   // Wrap cube map texture coordinates for seamless filtering (n = face number
   // from 0 to 5, xMask = face width - 1). If x and y are both out of range,
   // false is returned, and x, y and n are not changed (the sample should be
@@ -266,22 +375,43 @@ inline void DDSTexture::getNextMipTexCoord(
   yf = yf - yi;
 }
 
-inline FloatVector4 DDSTexture::getPixelB_Wrap(
+template< bool isTiled > inline unsigned int DDSTexture::getTexelOffset(
+    unsigned int x, unsigned int y, unsigned int xMask, unsigned int yMask)
+{
+  if (!isTiled || !(xMask & yMask & 2U))
+    return (y * (xMask + 1U) + x);
+  // 4x4 tiles in row-major order, 16 texels in row-major order per tile
+  return (((y & ~3U) * (xMask + 1U) + ((y & 3U) << 2))
+          + (((x & ~3U) << 2) + (x & 3U)));
+}
+
+inline unsigned int DDSTexture::getTexelOffset(
+    unsigned int x, unsigned int y,
+    unsigned int xMask, unsigned int yMask) const
+{
+  if (!tiledLayout) [[likely]]
+    return getTexelOffset< false >(x, y, xMask, yMask);
+  return getTexelOffset< true >(x, y, xMask, yMask);
+}
+
+template< bool isTiled > inline FloatVector4 DDSTexture::getPixelB_Wrap(
     const std::uint32_t *p, int x0, int y0,
     float xf, float yf, unsigned int xMask, unsigned int yMask)
 {
-  unsigned int  w = xMask + 1U;
   unsigned int  x0u = (unsigned int) x0;
   unsigned int  y0u = (unsigned int) y0;
   unsigned int  x1 = (x0u + 1U) & xMask;
   unsigned int  y1 = (y0u + 1U) & yMask;
   x0u = x0u & xMask;
   y0u = y0u & yMask;
-  return FloatVector4(p + (y0u * w + x0u), p + (y0u * w + x1),
-                      p + (y1 * w + x0u), p + (y1 * w + x1), xf, yf);
+  return FloatVector4(p + getTexelOffset< isTiled >(x0u, y0u, xMask, yMask),
+                      p + getTexelOffset< isTiled >(x1, y0u, xMask, yMask),
+                      p + getTexelOffset< isTiled >(x0u, y1, xMask, yMask),
+                      p + getTexelOffset< isTiled >(x1, y1, xMask, yMask),
+                      xf, yf);
 }
 
-inline FloatVector4 DDSTexture::getPixelB_Clamp(
+template< bool isTiled > inline FloatVector4 DDSTexture::getPixelB_Clamp(
     const std::uint32_t *p, int x0, int y0,
     float xf, float yf, unsigned int xMask, unsigned int yMask)
 {
@@ -289,11 +419,15 @@ inline FloatVector4 DDSTexture::getPixelB_Clamp(
   int     y1 = std::min< int >(std::max< int >(y0 + 1, 0), int(yMask));
   x0 = std::min< int >(std::max< int >(x0, 0), int(xMask));
   y0 = std::min< int >(std::max< int >(y0, 0), int(yMask));
-  unsigned int  w = xMask + 1U;
-  return FloatVector4(p + ((unsigned int) y0 * w + (unsigned int) x0),
-                      p + ((unsigned int) y0 * w + (unsigned int) x1),
-                      p + ((unsigned int) y1 * w + (unsigned int) x0),
-                      p + ((unsigned int) y1 * w + (unsigned int) x1), xf, yf);
+  unsigned int  x0u = (unsigned int) x0;
+  unsigned int  y0u = (unsigned int) y0;
+  unsigned int  x1u = (unsigned int) x1;
+  unsigned int  y1u = (unsigned int) y1;
+  return FloatVector4(p + getTexelOffset< isTiled >(x0u, y0u, xMask, yMask),
+                      p + getTexelOffset< isTiled >(x1u, y0u, xMask, yMask),
+                      p + getTexelOffset< isTiled >(x0u, y1u, xMask, yMask),
+                      p + getTexelOffset< isTiled >(x1u, y1u, xMask, yMask),
+                      xf, yf);
 }
 
 inline FloatVector4 DDSTexture::getPixelB_Inline(
@@ -304,10 +438,18 @@ inline FloatVector4 DDSTexture::getPixelB_Inline(
   float   xf, yf;
   unsigned int  xMask, yMask;
   (void) convertTexCoord(x0, y0, xf, yf, xMask, yMask, x, y, mipLevel);
-  return getPixelB_Wrap(textureData[mipLevel], x0, y0, xf, yf, xMask, yMask);
+  if (tiledLayout | genericSampling) [[unlikely]]
+  {
+    if (genericSampling)
+      return getPixelT_Generic(x, y, float(mipLevel), 0);
+    return getPixelB_Wrap< true >(textureData[mipLevel], x0, y0, xf, yf,
+                                  xMask, yMask);
+  }
+  return getPixelB_Wrap< false >(textureData[mipLevel], x0, y0, xf, yf,
+                                 xMask, yMask);
 }
 
-inline FloatVector4 DDSTexture::getPixelT_Inline(
+template< bool isTiled > inline FloatVector4 DDSTexture::getPixelT_Impl(
     float x, float y, float mipLevel) const
 {
   mipLevel = std::max(mipLevel, 0.0f);
@@ -317,23 +459,37 @@ inline FloatVector4 DDSTexture::getPixelT_Inline(
   unsigned int  xMask, yMask;
   if (!convertTexCoord(x0, y0, xf, yf, xMask, yMask, x, y, m0)) [[unlikely]]
     return FloatVector4(textureData[m0]);
-  FloatVector4  c0(getPixelB_Wrap(textureData[m0], x0, y0, xf, yf,
-                                  xMask, yMask));
+  FloatVector4  c0(getPixelB_Wrap< isTiled >(textureData[m0], x0, y0, xf, yf,
+                                             xMask, yMask));
   float   mf = float(m0);
   if (mf != mipLevel) [[likely]]
   {
     mf = mipLevel - mf;
     getNextMipTexCoord(x0, y0, xf, yf);
-    FloatVector4  c1(getPixelB_Wrap(textureData[m0 + 1], x0, y0, xf, yf,
-                                    xMask >> 1, yMask >> 1));
+    FloatVector4  c1(getPixelB_Wrap< isTiled >(textureData[m0 + 1], x0, y0,
+                                               xf, yf, xMask >> 1, yMask >> 1));
     c0 = (c0 * (1.0f - mf)) + (c1 * mf);
   }
   return c0;
 }
 
+inline FloatVector4 DDSTexture::getPixelT_Inline(
+    float x, float y, float mipLevel) const
+{
+  if (tiledLayout | genericSampling) [[unlikely]]
+  {
+    if (genericSampling)
+      return getPixelT_Generic(x, y, mipLevel, 0);
+    return getPixelT_Impl< true >(x, y, mipLevel);
+  }
+  return getPixelT_Impl< false >(x, y, mipLevel);
+}
+
 inline FloatVector4 DDSTexture::getPixelBM_Inline(
     float x, float y, int mipLevel) const
 {
+  if (genericSampling) [[unlikely]]
+    return getPixelT_Generic(x, y, float(mipLevel), 1);
   mipLevel = (mipLevel > 0 ? mipLevel : 0);
   int     x0, y0;
   float   xf = float(std::floor(x));
@@ -344,7 +500,13 @@ inline FloatVector4 DDSTexture::getPixelBM_Inline(
   y = (!(int(yf) & 1) ? y : (1.0f - y));
   unsigned int  xMask, yMask;
   (void) convertTexCoord(x0, y0, xf, yf, xMask, yMask, x, y, mipLevel);
-  return getPixelB_Clamp(textureData[mipLevel], x0, y0, xf, yf, xMask, yMask);
+  if (tiledLayout) [[unlikely]]
+  {
+    return getPixelB_Clamp< true >(textureData[mipLevel], x0, y0, xf, yf,
+                                   xMask, yMask);
+  }
+  return getPixelB_Clamp< false >(textureData[mipLevel], x0, y0, xf, yf,
+                                  xMask, yMask);
 }
 
 inline FloatVector4 DDSTexture::getPixelBC_Inline(
@@ -355,7 +517,15 @@ inline FloatVector4 DDSTexture::getPixelBC_Inline(
   float   xf, yf;
   unsigned int  xMask, yMask;
   (void) convertTexCoord(x0, y0, xf, yf, xMask, yMask, x, y, mipLevel);
-  return getPixelB_Clamp(textureData[mipLevel], x0, y0, xf, yf, xMask, yMask);
+  if (tiledLayout | genericSampling) [[unlikely]]
+  {
+    if (genericSampling)
+      return getPixelT_Generic(x, y, float(mipLevel), 2);
+    return getPixelB_Clamp< true >(textureData[mipLevel], x0, y0, xf, yf,
+                                   xMask, yMask);
+  }
+  return getPixelB_Clamp< false >(textureData[mipLevel], x0, y0, xf, yf,
+                                  xMask, yMask);
 }
 
 inline bool DDSTexture::wrapCubeMapCoord(int& x, int& y, int& n, int xMask)
@@ -1,6 +1,7 @@
 
 #include "common.hpp"
 #include "ddstxt16.hpp"
+#include "simdfunc.hpp"
 
 #include <new>
 
@@ -314,9 +315,12 @@ size_t DDSTexture16::decodeBlock_BC6U(
     std::uint64_t *dst, const unsigned char *src, unsigned int w)
 {
   std::uint64_t tmp[16];
-  (void) detexDecompressBlockBPTC_FLOAT(
+  if (!detexDecompressBlockBPTC_FLOAT(
              reinterpret_cast< const std::uint8_t * >(src), 0xFFFFFFFFU, 0U,
-             reinterpret_cast< std::uint8_t * >(&(tmp[0])));
+             reinterpret_cast< std::uint8_t * >(&(tmp[0])))) [[unlikely]]
+  {
+    std::memset(tmp, 0, sizeof(tmp));   // reserved mode
+  }
   for (unsigned int i = 0; i < 16; i++)
   {
     FloatVector4  c(FloatVector4::convertFloat16(tmp[i]));
@@ -330,9 +334,12 @@ size_t DDSTexture16::decodeBlock_BC6S(
     std::uint64_t *dst, const unsigned char *src, unsigned int w)
 {
   std::uint64_t tmp[16];
-  (void) detexDecompressBlockBPTC_SIGNED_FLOAT(
+  if (!detexDecompressBlockBPTC_SIGNED_FLOAT(
              reinterpret_cast< const std::uint8_t * >(src), 0xFFFFFFFFU, 0U,
-             reinterpret_cast< std::uint8_t * >(&(tmp[0])));
+             reinterpret_cast< std::uint8_t * >(&(tmp[0])))) [[unlikely]]
+  {
+    std::memset(tmp, 0, sizeof(tmp));   // reserved mode
+  }
   for (unsigned int i = 0; i < 16; i++)
   {
     FloatVector4  c(FloatVector4::convertFloat16(tmp[i]));
@@ -346,9 +353,12 @@ size_t DDSTexture16::decodeBlock_BC7(
     std::uint64_t *dst, const unsigned char *src, unsigned int w)
 {
   std::uint32_t tmp[16];
-  (void) detexDecompressBlockBPTC(
+  if (!detexDecompressBlockBPTC(
              reinterpret_cast< const std::uint8_t * >(src), 0xFFFFFFFFU, 0U,
-             reinterpret_cast< std::uint8_t * >(&(tmp[0])));
+             reinterpret_cast< std::uint8_t * >(&(tmp[0])))) [[unlikely]]
+  {
+    std::memset(tmp, 0, sizeof(tmp));   // reserved mode
+  }
   for (unsigned int i = 0; i < 16; i++)
   {
     dst[(i >> 2) * w + (i & 3)] =
@@ -357,248 +367,88 @@ size_t DDSTexture16::decodeBlock_BC7(
   return 16;
 }
 
-static inline FloatVector4 bgraToRGBA(FloatVector4 c)
-{
-  return FloatVector4(c[2], c[1], c[0], c[3]);
-}
-
 size_t DDSTexture16::decodeLine_RGB(
     std::uint64_t *dst, const unsigned char *src, unsigned int w)
 {
-  unsigned int  x = 0;
-  for ( ; (x + 1U) < w; x++, dst++, src = src + 3)
-  {
-    std::uint32_t b = FileBuffer::readUInt32Fast(src) | 0xFF000000U;
-    *dst = (FloatVector4(b) * (1.0f / 255.0f)).convertToFloat16();
-  }
-  if (x < w) [[likely]]
-  {
-    std::uint32_t r = src[0];
-    std::uint32_t g = src[1];
-    std::uint32_t b = src[2];
-    b = r | (g << 8) | (b << 16) | 0xFF000000U;
-    *dst = (FloatVector4(b) * (1.0f / 255.0f)).convertToFloat16();
-  }
-  return (size_t(w) * 3);
+  return SIMDFunctions::get().decodeLine_RGB(dst, src, w);
 }
 
 size_t DDSTexture16::decodeLine_BGR(
     std::uint64_t *dst, const unsigned char *src, unsigned int w)
 {
-  unsigned int  x = 0;
-  for ( ; (x + 1U) < w; x++, dst++, src = src + 3)
-  {
-    std::uint32_t b = FileBuffer::readUInt32Fast(src) | 0xFF000000U;
-    *dst = (bgraToRGBA(FloatVector4(b)) * (1.0f / 255.0f)).convertToFloat16();
-  }
-  if (x < w) [[likely]]
-  {
-    std::uint32_t b = src[0];
-    std::uint32_t g = src[1];
-    std::uint32_t r = src[2];
-    b = r | (g << 8) | (b << 16) | 0xFF000000U;
-    *dst = (FloatVector4(b) * (1.0f / 255.0f)).convertToFloat16();
-  }
-  return (size_t(w) * 3);
+  return SIMDFunctions::get().decodeLine_BGR(dst, src, w);
 }
 
 size_t DDSTexture16::decodeLine_RGB32(
     std::uint64_t *dst, const unsigned char *src, unsigned int w)
 {
-  for (unsigned int x = 0; x < w; x++, dst++, src = src + 4)
-  {
-    std::uint32_t b = FileBuffer::readUInt32Fast(src) | 0xFF000000U;
-    *dst = (FloatVector4(b) * (1.0f / 255.0f)).convertToFloat16();
-  }
-  return (size_t(w) << 2);
+  return SIMDFunctions::get().decodeLine_RGB32(dst, src, w);
 }
 
 size_t DDSTexture16::decodeLine_BGR32(
     std::uint64_t *dst, const unsigned char *src, unsigned int w)
 {
-  for (unsigned int x = 0; x < w; x++, dst++, src = src + 4)
-  {
-    std::uint32_t b = FileBuffer::readUInt32Fast(src) | 0xFF000000U;
-    *dst = (bgraToRGBA(FloatVector4(b)) * (1.0f / 255.0f)).convertToFloat16();
-  }
-  return (size_t(w) << 2);
+  return SIMDFunctions::get().decodeLine_BGR32(dst, src, w);
 }
 
 size_t DDSTexture16::decodeLine_RGBA(
     std::uint64_t *dst, const unsigned char *src, unsigned int w)
 {
-  for (unsigned int x = 0; x < w; x++, dst++, src = src + 4)
-  {
-    std::uint32_t b = FileBuffer::readUInt32Fast(src);
-    *dst = (FloatVector4(b) * (1.0f / 255.0f)).convertToFloat16();
-  }
-  return (size_t(w) << 2);
+  return SIMDFunctions::get().decodeLine_RGBA(dst, src, w);
 }
 
 size_t DDSTexture16::decodeLine_BGRA(
     std::uint64_t *dst, const unsigned char *src, unsigned int w)
 {
-  for (unsigned int x = 0; x < w; x++, dst++, src = src + 4)
-  {
-    std::uint32_t b = FileBuffer::readUInt32Fast(src);
-    *dst = (bgraToRGBA(FloatVector4(b)) * (1.0f / 255.0f)).convertToFloat16();
-  }
-  return (size_t(w) << 2);
+  return SIMDFunctions::get().decodeLine_BGRA(dst, src, w);
 }
 
 size_t DDSTexture16::decodeLine_R8G8(
     std::uint64_t *dst, const unsigned char *src, unsigned int w)
 {
-  unsigned int  x = 0;
-  for ( ; (x + 2U) <= w; x = x + 2U, dst = dst + 2, src = src + 4)
-  {
-    FloatVector4  c(FileBuffer::readUInt32Fast(src));
-    c *= (1.0f / 255.0f);
-    dst[0] = FloatVector4(c[0], c[1], 0.0f, 1.0f).convertToFloat16();
-    dst[1] = FloatVector4(c[2], c[3], 0.0f, 1.0f).convertToFloat16();
-  }
-  if (x < w)
-  {
-    std::uint32_t b = 0xFF000000U | FileBuffer::readUInt16Fast(src);
-    *dst = (FloatVector4(b) * (1.0f / 255.0f)).convertToFloat16();
-  }
-  return (size_t(w) << 1);
+  return SIMDFunctions::get().decodeLine_R8G8(dst, src, w);
 }
 
 size_t DDSTexture16::decodeLine_R8(
     std::uint64_t *dst, const unsigned char *src, unsigned int w)
 {
-  unsigned int  x = 0;
-  for ( ; (x + 4U) <= w; x = x + 4U, dst = dst + 4, src = src + 4)
-  {
-    FloatVector4  c(FileBuffer::readUInt32Fast(src));
-    c *= (1.0f / 255.0f);
-    FloatVector4  c0(c[0]);
-    FloatVector4  c1(c[1]);
-    FloatVector4  c2(c[2]);
-    FloatVector4  c3(c[3]);
-    c0[3] = 1.0f;
-    c1[3] = 1.0f;
-    c2[3] = 1.0f;
-    c3[3] = 1.0f;
-    dst[0] = c0.convertToFloat16();
-    dst[1] = c1.convertToFloat16();
-    dst[2] = c2.convertToFloat16();
-    dst[3] = c3.convertToFloat16();
-  }
-  for ( ; x < w; x++, dst++, src++)
-  {
-    std::uint32_t b = (std::uint32_t(*src) * 0x00010101U) | 0xFF000000U;
-    *dst = (FloatVector4(b) * (1.0f / 255.0f)).convertToFloat16();
-  }
-  return size_t(w);
+  return SIMDFunctions::get().decodeLine_R8(dst, src, w);
 }
 
 size_t DDSTexture16::decodeLine_RGBA64F(
     std::uint64_t *dst, const unsigned char *src, unsigned int w)
 {
-  for (unsigned int x = 0; x < w; x++, dst++, src = src + 8)
-  {
-    std::uint64_t b = FileBuffer::readUInt64Fast(src);
-    FloatVector4  c(FloatVector4::convertFloat16(b));
-    c.maxValues(FloatVector4(-65504.0f)).minValues(FloatVector4(65504.0f));
-    *dst = c.convertToFloat16();
-  }
-  return (size_t(w) << 3);
+  return SIMDFunctions::get().decodeLine_RGBA64F(dst, src, w);
 }
 
 size_t DDSTexture16::decodeLine_RGB9E5(
     std::uint64_t *dst, const unsigned char *src, unsigned int w)
 {
-  for (unsigned int x = 0; x < w; x++, dst++, src = src + 4)
-  {
-    std::uint32_t b = FileBuffer::readUInt32Fast(src);
-    *dst = FloatVector4::convertR9G9B9E5(b).convertToFloat16();
-  }
-  return (size_t(w) << 2);
+  return SIMDFunctions::get().decodeLine_RGB9E5(dst, src, w);
 }
 
 size_t DDSTexture16::decodeLine_R10G10B10A2(
     std::uint64_t *dst, const unsigned char *src, unsigned int w)
 {
-  for (unsigned int x = 0; x < w; x++, dst++, src = src + 4)
-  {
-    std::uint32_t b = FileBuffer::readUInt32Fast(src);
-    FloatVector4  c(FloatVector4::convertA2R10G10B10(b));
-    *dst = (c * (1.0f / 255.0f)).shuffleValues(0xC6).convertToFloat16();
-  }
-  return (size_t(w) << 2);
+  return SIMDFunctions::get().decodeLine_R10G10B10A2(dst, src, w);
 }
 
 size_t DDSTexture16::decodeLine_R8G8S(
     std::uint64_t *dst, const unsigned char *src, unsigned int w)
 {
-  unsigned int  x = 0;
-  for ( ; (x + 2U) <= w; x = x + 2U, dst = dst + 2, src = src + 4)
-  {
-    std::uint32_t b = FileBuffer::readUInt32Fast(src) ^ 0x80808080U;
-    FloatVector4  c(b);
-    c = c * (1.0f / 127.5f) - 1.0f;
-    dst[0] = FloatVector4(c[0], c[1], 0.0f, 1.0f).convertToFloat16();
-    dst[1] = FloatVector4(c[2], c[3], 0.0f, 1.0f).convertToFloat16();
-  }
-  if (x < w)
-  {
-    std::uint32_t b = 0xFF808080U ^ FileBuffer::readUInt16Fast(src);
-    *dst = (FloatVector4(b) * (1.0f / 127.5f) - 1.0f).convertToFloat16();
-  }
-  return (size_t(w) << 1);
+  return SIMDFunctions::get().decodeLine_R8G8S(dst, src, w);
 }
 
 size_t DDSTexture16::decodeLine_RGBA32S(
     std::uint64_t *dst, const unsigned char *src, unsigned int w)
 {
-  for (unsigned int x = 0; x < w; x++, dst++, src = src + 4)
-  {
-    std::uint32_t b = FileBuffer::readUInt32Fast(src) ^ 0x80808080U;
-    *dst = (FloatVector4(b) * (1.0f / 127.5f) - 1.0f).convertToFloat16();
-  }
-  return (size_t(w) << 2);
+  return SIMDFunctions::get().decodeLine_RGBA32S(dst, src, w);
 }
 
 size_t DDSTexture16::decodeLine_RGBA64(
     std::uint64_t *dst, const unsigned char *src, unsigned int w)
 {
-  for (unsigned int x = 0; x < w; x++, dst++, src = src + 8)
-  {
-    std::uint64_t b = FileBuffer::readUInt64Fast(src) ^ 0x8000800080008000ULL;
-    FloatVector4  c(FloatVector4::convertInt16(b));
-    *dst = ((c + 32768.0f) * float(1.0 / 65535.0)).convertToFloat16();
-  }
-  return (size_t(w) << 3);
-}
-
-static void srgbExpandBlock(void *buf, int w, int h, int pitch)
-{
-#if ENABLE_X86_64_SIMD >= 3
-  if (!(w & 1)) [[likely]]
-  {
-    std::uint16_t *p = reinterpret_cast< std::uint16_t * >(buf);
-    for ( ; h > 0; h--, p = p + (pitch << 2))
-    {
-      for (int x = 0; (x + 2) <= w; x = x + 2)
-      {
-        FloatVector8  c(p + (x << 2), false);
-        DDSTexture16::srgbExpand(c).convertToFloat16(p + (x << 2));
-      }
-    }
-    return;
-  }
-#endif
-  std::uint64_t *p = reinterpret_cast< std::uint64_t * >(buf);
-  for ( ; h > 0; h--, p = p + pitch)
-  {
-    for (int x = 0; x < w; x++)
-    {
-      FloatVector4  c(FloatVector4::convertFloat16(p[x]));
-      p[x] = DDSTexture16::srgbExpand(c).convertToFloat16();
-    }
-  }
+  return SIMDFunctions::get().decodeLine_RGBA64(dst, src, w);
 }
 
 void DDSTexture16::loadTextureData(
@@ -608,6 +458,7 @@ void DDSTexture16::loadTextureData(
   size_t  (*decodeFunction)(std::uint64_t *,
                             const unsigned char *, unsigned int) =
       formatInfo.decodeFunction;
+  const SIMDFunctions&  simdFunctions = SIMDFunctions::get();
   bool    isCompressed = formatInfo.isCompressed;
   bool    isSRGB = false;
   if (!noSRGBExpand)
@@ -627,7 +478,7 @@ void DDSTexture16::loadTextureData(
         {
           srcPtr = srcPtr + decodeFunction(p + (y * w), srcPtr, w);
           if (isSRGB)
-            srgbExpandBlock(p + (y * w), int(w), 1, int(w));
+            simdFunctions.srgbExpandBlock(p + (y * w), int(w), 1, int(w));
         }
       }
       else if (w < 4 || h < 4)
@@ -639,7 +490,7 @@ void DDSTexture16::loadTextureData(
           {
             srcPtr = srcPtr + decodeFunction(tmpBuf, srcPtr, 4);
             if (isSRGB)
-              srgbExpandBlock(tmpBuf, 4, 4, 4);
+              simdFunctions.srgbExpandBlock(tmpBuf, 4, 4, 4);
             for (unsigned int j = 0; j < 16; j++)
             {
               if ((y + (j >> 2)) < h && (x + (j & 3)) < w)
@@ -656,7 +507,7 @@ void DDSTexture16::loadTextureData(
           {
             srcPtr = srcPtr + decodeFunction(p + (y * w + x), srcPtr, w);
             if (isSRGB)
-              srgbExpandBlock(p + (y * w + x), 4, 4, int(w));
+              simdFunctions.srgbExpandBlock(p + (y * w + x), 4, 4, int(w));
           }
         }
       }
@@ -673,16 +524,8 @@ void DDSTexture16::loadTextureData(
       {
         const std::uint64_t *p2y2 = p2 + (size_t(y << 1) * w2);
         const std::uint64_t *p2y2p1 = (yMask >= h ? p2y2 + w2 : p2y2);
-        for (unsigned int x = 0; x < w; x++)
-        {
-          size_t  offsX2 = x << 1;
-          size_t  offsX2p1 = offsX2 + size_t(w2 > w);
-          FloatVector4  c(FloatVector4::convertFloat16(p2y2[offsX2]));
-          c += FloatVector4::convertFloat16(p2y2[offsX2p1]);
-          c += FloatVector4::convertFloat16(p2y2p1[offsX2]);
-          c += FloatVector4::convertFloat16(p2y2p1[offsX2p1]);
-          p[y * w + x] = (c * 0.25f).convertToFloat16();
-        }
+        simdFunctions.downsampleLine_RGBA64F(p + (y * w), p2y2, p2y2p1,
+                                             w, (unsigned int) w2);
       }
     }
   }
@@ -1174,3 +1017,116 @@ FloatVector4 DDSTexture16::cubeMap(float x, float y, float z,
   return c0;
 }
 
+void DDSTexture16::cubeMap8(
+    FloatVector8 *c, const FloatVector8& x, const FloatVector8& y,
+    const FloatVector8& z, const FloatVector8& mipLevel) const
+{
+  float   xv[8], yv[8], zv[8];
+  x.convertToFloats(xv);
+  y.convertToFloats(yv);
+  z.convertToFloats(zv);
+  FloatVector8  xm(x);
+  FloatVector8  ym(y);
+  FloatVector8  zm(z);
+  xm.maxValues(x * -1.0f);
+  ym.maxValues(y * -1.0f);
+  zm.maxValues(z * -1.0f);
+  // bit N of maskX (maskY) is set if X (Y) is the major axis of sample N
+  std::uint32_t maskX =
+      ~((xm - ym).getSignMask() | (xm - zm).getSignMask()) & 0xFFU;
+  std::uint32_t maskY =
+      ~((ym - xm).getSignMask() | (ym - zm).getSignMask() | maskX) & 0xFFU;
+  // select face, and map the other two coordinates to s, t (-ma to ma)
+  unsigned char n[8];
+  float   s[8], t[8];
+  for (size_t i = 0; i < 8; i++)
+  {
+    if (maskX & (1U << i))              // +X (0), -X (1)
+    {
+      n[i] = (unsigned char) (xv[i] < 0.0f);
+      s[i] = (xv[i] < 0.0f ? zv[i] : -(zv[i]));
+      t[i] = -(yv[i]);
+    }
+    else if (maskY & (1U << i))         // +Y (2), -Y (3)
+    {
+      n[i] = (unsigned char) (2 + int(yv[i] < 0.0f));
+      s[i] = xv[i];
+      t[i] = (yv[i] < 0.0f ? -(zv[i]) : zv[i]);
+    }
+    else                                // +Z (4), -Z (5)
+    {
+      n[i] = (unsigned char) (4 + int(zv[i] < 0.0f));
+      s[i] = (zv[i] < 0.0f ? -(xv[i]) : xv[i]);
+      t[i] = -(yv[i]);
+    }
+  }
+  FloatVector8  ma(xm);
+  ma.maxValues(ym).maxValues(zm);
+  ma = FloatVector8(0.5f) / ma;
+  FloatVector8  u(FloatVector8(s) * ma + 0.5f);
+  FloatVector8  v(FloatVector8(t) * ma + 0.5f);
+  FloatVector8  m(mipLevel);
+  m.maxValues(FloatVector8(0.0f)).minValues(FloatVector8(17.0f));
+  FloatVector4  tmp[8];
+  if (!(channelCntFlags & 0x80)) [[unlikely]]
+  {
+    for (size_t i = 0; i < 8; i++)
+      tmp[i] = getPixelTC(u[i], v[i], m[i]);
+  }
+  else
+  {
+    FloatVector8  m0(m);
+    m0.floorValues();
+    std::int32_t  mipNums[8];
+    float   mf[8];
+    m0.convertToInt32(mipNums);
+    (m - m0).convertToFloats(mf);
+    // texel coordinates at mip levels m0 and m0 + 1
+    FloatVector8  mipScale(m0 * -1.0f);
+    mipScale.exp2V();
+    mipScale *= float(int(xMaskMip0 + 1U));
+    mipScale.maxValues(FloatVector8(1.0f));
+    u = u * mipScale - 0.5f;
+    v = v * mipScale - 0.5f;
+    std::int32_t  x0[8], y0[8], x1[8], y1[8];
+    float   xf[8], yf[8], xf1[8], yf1[8];
+    FloatVector8  ui(u);
+    FloatVector8  vi(v);
+    ui.floorValues();
+    vi.floorValues();
+    ui.convertToInt32(x0);
+    vi.convertToInt32(y0);
+    (u - ui).convertToFloats(xf);
+    (v - vi).convertToFloats(yf);
+    u = u * 0.5f - 0.25f;
+    v = v * 0.5f - 0.25f;
+    ui = u;
+    vi = v;
+    ui.floorValues();
+    vi.floorValues();
+    ui.convertToInt32(x1);
+    vi.convertToInt32(y1);
+    (u - ui).convertToFloats(xf1);
+    (v - vi).convertToFloats(yf1);
+    for (size_t i = 0; i < 8; i++)
+    {
+      int     m0i = mipNums[i];
+      unsigned int  xMask = xMaskMip0 >> (unsigned char) m0i;
+      tmp[i] = getPixelB_Cube(textureData[m0i], x0[i], y0[i], n[i],
+                              textureDataSize, xf[i], yf[i], xMask);
+      if (mf[i] != 0.0f && xMask) [[likely]]
+      {
+        FloatVector4  c1(getPixelB_Cube(textureData[m0i + 1], x1[i], y1[i],
+                                        n[i], textureDataSize,
+                                        xf1[i], yf1[i], xMask >> 1));
+        tmp[i] = (tmp[i] * (1.0f - mf[i])) + (c1 * mf[i]);
+      }
+    }
+  }
+  for (size_t i = 0; i < 4; i++)
+  {
+    c[i] = FloatVector8(tmp[0][i], tmp[1][i], tmp[2][i], tmp[3][i],
+                        tmp[4][i], tmp[5][i], tmp[6][i], tmp[7][i]);
+  }
+}
+
@@ -227,6 +227,11 @@ class DDSTexture16
   // y = -1.0 to 1.0: S to N
   // z = -1.0 to 1.0: bottom to top
   FloatVector4 cubeMap(float x, float y, float z, float mipLevel) const;
+  // batched version of cubeMap() that filters 8 samples per call, the output
+  // is stored in c[0] to c[3] as the red, green, blue and alpha channels of
+  // the 8 samples (SoA format)
+  void cubeMap8(FloatVector8 *c, const FloatVector8& x, const FloatVector8& y,
+                const FloatVector8& z, const FloatVector8& mipLevel) const;
   // Wrap cube map texture coordinates for seamless filtering (n = face number
   // from 0 to 5, xMask = face width - 1). If x and y are both out of range,
   // false is returned, and x, y and n are not changed (the sample should be
@@ -2,6 +2,8 @@
 #include "common.hpp"
 #include "filebuf.hpp"
 
+#include <chrono>
+
 #if defined(_WIN32) || defined(_WIN64)
 #  include <windows.h>
 #  include <io.h>
@@ -620,6 +622,37 @@ void OutputFile::flush()
     flushBuffer();
 }
 
+bool OutputFile::writeFileAtomic(const char *fileName, const void *p, size_t n)
+{
+  std::uint64_t tmpID = std::uint64_t(
+                            std::chrono::steady_clock::now().time_since_epoch()
+                            .count());
+  tmpID = tmpID ^ std::uint64_t(std::uintptr_t(p));
+  std::string tmpFileName(fileName);
+  printToString(tmpFileName, ".%016llX.tmp", (unsigned long long) tmpID);
+  try
+  {
+    OutputFile  f(tmpFileName.c_str(), 0);
+    f.writeData(p, n);
+  }
+  catch (std::exception&)
+  {
+    (void) std::remove(tmpFileName.c_str());
+    return false;
+  }
+  if (std::rename(tmpFileName.c_str(), fileName) != 0)
+  {
+    // on Windows, rename() fails if the output file already exists
+    (void) std::remove(fileName);
+    if (std::rename(tmpFileName.c_str(), fileName) != 0)
+    {
+      (void) std::remove(tmpFileName.c_str());
+      return false;
+    }
+  }
+  return true;
+}
+
 void DDSInputFile::readDDSHeader(int& width, int& height, int& pixelFormat,
                                  unsigned int *hdrReserved)
 {
@@ -259,6 +259,10 @@ class OutputFile
       flushBuffer();
   }
   void flush();
+  // Write n bytes from p to a temporary file with a unique name, and then
+  // rename it to fileName, so that other processes never see a partially
+  // written file. Returns false on error, no exceptions are thrown.
+  static bool writeFileAtomic(const char *fileName, const void *p, size_t n);
 };
 
 class DDSInputFile : public FileBuffer
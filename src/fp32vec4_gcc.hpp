@@ -239,14 +239,27 @@ inline FloatVector4& FloatVector4::clearV3()
 
 inline FloatVector4& FloatVector4::shuffleValues(unsigned char mask)
 {
+#ifdef __OPTIMIZE__
   v = __builtin_ia32_shufps(v, v, mask);
+#else
+  // the builtin requires an immediate, which mask is not without inlining
+  const XMM_Int32 tmp = { mask & 3, (mask >> 2) & 3, (mask >> 4) & 3,
+                          (mask >> 6) & 3 };
+  v = __builtin_shuffle(v, tmp);
+#endif
   return (*this);
 }
 
 inline FloatVector4& FloatVector4::blendValues(
     const FloatVector4& r, unsigned char mask)
 {
+#ifdef __OPTIMIZE__
   v = __builtin_ia32_blendps(v, r.v, mask);
+#else
+  const XMM_Int32 tmp = { (mask & 1) << 2, ((mask & 2) << 1) | 1,
+                          (mask & 4) | 2, ((mask & 8) >> 1) | 3 };
+  v = __builtin_shuffle(v, r.v, tmp);
+#endif
   return (*this);
 }
 
@@ -249,14 +249,31 @@ inline FloatVector8 FloatVector8::operator/(const float& r) const
 
 inline FloatVector8& FloatVector8::shuffleValues(unsigned char mask)
 {
+#ifdef __OPTIMIZE__
   v = __builtin_ia32_shufps256(v, v, mask);
+#else
+  // the builtin requires an immediate, which mask is not without inlining
+  int     i0 = mask & 3;
+  int     i1 = (mask >> 2) & 3;
+  int     i2 = (mask >> 4) & 3;
+  int     i3 = (mask >> 6) & 3;
+  const YMM_Int32 tmp = { i0, i1, i2, i3, i0 + 4, i1 + 4, i2 + 4, i3 + 4 };
+  v = __builtin_shuffle(v, tmp);
+#endif
   return (*this);
 }
 
 inline FloatVector8& FloatVector8::blendValues(
     const FloatVector8& r, unsigned char mask)
 {
+#ifdef __OPTIMIZE__
   v = __builtin_ia32_blendps256(v, r.v, mask);
+#else
+  YMM_Int32 tmp;
+  for (int i = 0; i < 8; i++)
+    tmp[i] = i + (((mask >> i) & 1) << 3);
+  v = __builtin_shuffle(v, r.v, tmp);
+#endif
   return (*this);
 }
 
@@ -2,297 +2,355 @@
 #include "common.hpp"
 #include "jsonread.hpp"
 
-std::string& JSONReader::readToken()
+#include <new>
+#include <type_traits>
+
+void JSONReader::parseError(const char *msg, size_t offs) const
 {
-  curToken.clear();
-  bool    skippingWhitespace = true;
-  bool    readingQuotedString = false;
-  while (filePos < fileBufSize) [[likely]]
+  const unsigned char *endp = fileBuf + std::min(offs, fileBufSize);
+  size_t  lineNum = 1;
+  for (const unsigned char *p = fileBuf; p < endp; p++)
+    lineNum += size_t(*p == '\n');
+  throw FO76UtilsError(msg, (unsigned long) lineNum);
+}
+
+int JSONReader::readToken(std::string_view& t)
+{
+  size_t  pos = filePos;
+  unsigned char c;
+  while (true)
   {
-    char    c = char(fileBuf[filePos]);
-    filePos++;
-    if ((unsigned char) c <= 0x20)
+    if (pos >= fileBufSize) [[unlikely]]
     {
-      if (!c)
-      {
-        throw FO76UtilsError("invalid character in JSON file at line %lu",
-                             (unsigned long) curLine);
-      }
-      if (readingQuotedString)
+      filePos = pos;
+      t = std::string_view();
+      return Token_EOF;
+    }
+    c = fileBuf[pos];
+    if (c > 0x20)
+      break;
+    if (!c)
+      parseError("invalid character in JSON file at line %lu", pos);
+    pos++;
+  }
+  size_t  startPos = pos;
+  pos++;
+  if (c == '"')
+  {
+    bool    haveEscapes = false;
+    while (true)
+    {
+#if ENABLE_X86_64_SIMD
+      // find the next '"', '\\' or control character, 16 bytes at a time
+      for ( ; (pos + 16) <= fileBufSize; pos = pos + 16)
       {
-        if (c == '\n')
+        std::uint8_t  v __attribute__ ((__vector_size__ (16)));
+        std::memcpy(&v, fileBuf + pos, 16);
+        char    m __attribute__ ((__vector_size__ (16))) =
+            (char __attribute__ ((__vector_size__ (16)))) ((v == '"')
+                                                           | (v == '\\')
+                                                           | (v < 0x20));
+        unsigned int  mask = (unsigned int) __builtin_ia32_pmovmskb128(m);
+        if (mask)
         {
-          throw FO76UtilsError("unexpected end of line %lu in JSON file",
-                               (unsigned long) curLine);
-        }
-        else if (!(c == '\t' || c == ' '))
-        {
-          throw FO76UtilsError("invalid character in JSON file at line %lu",
-                               (unsigned long) curLine);
+          pos = pos + size_t(std::countr_zero(mask));
+          break;
         }
-        curToken += c;
-        continue;
       }
-      if (!skippingWhitespace)
+#endif
+      if (pos >= fileBufSize) [[unlikely]]
+        parseError("unexpected end of JSON file at line %lu", pos);
+      c = fileBuf[pos];
+      if (c == '"')
+        break;
+      pos++;
+      if (c == '\\')
+      {
+        // the escaped character is checked by decodeString()
+        haveEscapes = true;
+        pos = pos + size_t(pos < fileBufSize);
+      }
+      else if (c < 0x20 && c != '\t')
       {
         if (c == '\n')
-          filePos--;
-        return curToken;
+          parseError("unexpected end of line %lu in JSON file", pos - 1);
+        parseError("invalid character in JSON file at line %lu", pos - 1);
       }
-      if (c == '\n')
-        curLine++;
-      continue;
     }
-    if (skippingWhitespace)
+    filePos = pos + 1;
+    if (!haveEscapes)
     {
-      skippingWhitespace = false;
-      readingQuotedString = (c == '"');
+      t = std::string_view(reinterpret_cast< const char * >(fileBuf)
+                           + (startPos + 1), pos - (startPos + 1));
     }
-    else if (c == '"')
+    else
     {
-      if (!readingQuotedString)
-      {
-        throw FO76UtilsError("syntax error in JSON file at line %lu",
-                             (unsigned long) curLine);
-      }
-      curToken += c;
-      return curToken;
+      t = decodeString(startPos + 1, pos);
     }
-    if (!readingQuotedString)
+    return Token_String;
+  }
+  if (c == ',' || c == ':' || c == '[' || c == ']' || c == '{' || c == '}')
+  {
+    filePos = pos;
+    t = std::string_view(reinterpret_cast< const char * >(fileBuf) + startPos,
+                         1);
+    return int(c);
+  }
+  for ( ; pos < fileBufSize; pos++)
+  {
+    c = fileBuf[pos];
+    if (c <= 0x20 ||
+        c == ',' || c == ':' || c == '[' || c == ']' || c == '{' || c == '}')
     {
-      if (c == ',' || c == ':' || c == '[' || c == ']' || c == '{' || c == '}')
-      {
-        if (curToken.empty())
-          curToken = c;
-        else
-          filePos--;
-        return curToken;
-      }
+      if (!c)
+        parseError("invalid character in JSON file at line %lu", pos);
+      break;
+    }
+    if (c == '"')
+      parseError("syntax error in JSON file at line %lu", pos);
+  }
+  filePos = pos;
+  t = std::string_view(reinterpret_cast< const char * >(fileBuf) + startPos,
+                       pos - startPos);
+  return Token_Other;
+}
+
+std::string_view JSONReader::decodeString(size_t startPos, size_t endPos)
+{
+  stringBuf.clear();
+  for (size_t pos = startPos; pos < endPos; )
+  {
+    char    c = char(fileBuf[pos]);
+    pos++;
+    if (c != '\\')
+    {
+      stringBuf += c;
+      continue;
     }
-    else if (c == '\\')
+    c = char(fileBuf[pos]);
+    pos++;
+    switch (c)
     {
-      c = '\0';
-      if (filePos < fileBufSize) [[likely]]
-      {
-        c = char(fileBuf[filePos]);
-        filePos++;
-      }
-      switch (c)
-      {
-        case 'b':
-          c = '\b';
-          break;
-        case 'f':
-          c = '\f';
-          break;
-        case 'n':
-          c = '\n';
-          break;
-        case 'r':
-          c = '\r';
-          break;
-        case 't':
-          c = '\t';
-          break;
-        case 'u':
+      case 'b':
+        c = '\b';
+        break;
+      case 'f':
+        c = '\f';
+        break;
+      case 'n':
+        c = '\n';
+        break;
+      case 'r':
+        c = '\r';
+        break;
+      case 't':
+        c = '\t';
+        break;
+      case 'u':
+        {
+          unsigned int  tmp = 0U;
+          for (int i = 0; i < 4; i++, pos++)
           {
-            unsigned int  tmp = 0U;
-            for (int i = 0; i < 4; i++)
+            if (pos >= endPos)
+              parseError("syntax error in JSON file at line %lu", pos);
+            c = char(fileBuf[pos]);
+            if (c >= '0' && c <= '9')
             {
-              if (filePos >= fileBufSize)
-              {
-                throw FO76UtilsError("unexpected end of JSON file at line %lu",
-                                     (unsigned long) curLine);
-              }
-              c = char(fileBuf[filePos]);
-              filePos++;
-              if (c >= '0' && c <= '9')
-              {
-                tmp = (tmp << 4) | (unsigned int) (c & 0x0F);
-              }
-              else if ((c >= 'A' && c <= 'F') || (c >= 'a' && c <= 'f'))
-              {
-                tmp = (tmp << 4) | (unsigned int) ((c & 0x0F) + 9);
-              }
-              else
-              {
-                throw FO76UtilsError("syntax error in JSON file at line %lu",
-                                     (unsigned long) curLine);
-              }
+              tmp = (tmp << 4) | (unsigned int) (c & 0x0F);
             }
-            if (!tmp)
+            else if ((c >= 'A' && c <= 'F') || (c >= 'a' && c <= 'f'))
             {
-              throw FO76UtilsError("invalid character in JSON file at line %lu",
-                                   (unsigned long) curLine);
+              tmp = (tmp << 4) | (unsigned int) ((c & 0x0F) + 9);
             }
-            if (tmp >= 0x0080U)
+            else
             {
-              // encode UTF-8 character
-              if (tmp >= 0x0800U)
-              {
-                curToken += char(((tmp >> 12) & 0x000FU) | 0x00E0U);
-                curToken += char(((tmp >> 6) & 0x003FU) | 0x0080U);
-              }
-              else
-              {
-                curToken += char(((tmp >> 6) & 0x001FU) | 0x00C0U);
-              }
-              tmp = (tmp & 0x003FU) | 0x0080U;
+              parseError("syntax error in JSON file at line %lu", pos);
             }
-            c = char(tmp);
           }
-          break;
-        case '"':
-        case '/':
-        case '\\':
-          break;
-        default:
-          throw FO76UtilsError("syntax error in JSON file at line %lu",
-                               (unsigned long) curLine);
-      }
+          if (!tmp)
+            parseError("invalid character in JSON file at line %lu", pos);
+          if (tmp >= 0x0080U)
+          {
+            // encode UTF-8 character
+            if (tmp >= 0x0800U)
+            {
+              stringBuf += char(((tmp >> 12) & 0x000FU) | 0x00E0U);
+              stringBuf += char(((tmp >> 6) & 0x003FU) | 0x0080U);
+            }
+            else
+            {
+              stringBuf += char(((tmp >> 6) & 0x001FU) | 0x00C0U);
+            }
+            tmp = (tmp & 0x003FU) | 0x0080U;
+          }
+          c = char(tmp);
+        }
+        break;
+      case '"':
+      case '/':
+      case '\\':
+        break;
+      default:
+        parseError("syntax error in JSON file at line %lu", pos - 1);
     }
-    curToken += c;
+    stringBuf += c;
   }
-  return curToken;
+  return std::string_view(stringBuf);
 }
 
-bool JSONReader::parseJSONValue(JSONItem*& o, const std::string& s)
+template< typename T >
+inline T * JSONReader::allocateItem(int type)
 {
-  if (s.empty())
-    return false;
-  if (s.starts_with("\"") && s.ends_with("\""))
+  T       *p;
+  if constexpr (std::is_trivially_destructible_v< T >)
   {
-    // string
-    JSONString  *p = new JSONString;
-    o = p;
-    p->type = JSONItemType_String;
-    if (s.length() > 2)
-      p->value = std::string(s, 1, s.length() - 2);
+    p = objectBuf.allocateObject< T >();
   }
-  else if (s == "{")
+  else
   {
-    // structure
-    JSONObject  *p = new JSONObject;
-    o = p;
-    p->type = JSONItemType_Object;
-    const JSONItem  **curItem = nullptr;
-    bool    braceExpected = true;
-    bool    commaExpected = false;
-    while (true)
-    {
-      std::string&  t = readToken();
-      if (t.empty())
-      {
-        throw FO76UtilsError("unexpected end of JSON file at line %lu",
-                             (unsigned long) curLine);
-      }
-      if (!curItem)
-      {
-        if (t == "}" && braceExpected)
-          break;
-        if (t == "," && commaExpected)
-        {
-          braceExpected = false;
-          commaExpected = false;
-          continue;
-        }
-        if (!((t.starts_with("\"") && t.ends_with("\"") && t.length() >= 2) ||
-              t == "null"))
-        {
-          throw FO76UtilsError("syntax error in JSON file at line %lu",
-                               (unsigned long) curLine);
-        }
-        if (t[0] == '"' && t.length() > 2)
-          curItem = &(p->children[std::string(t, 1, t.length() - 2)]);
-        else
-          curItem = &(p->children[std::string()]);
-      }
-      else
-      {
-        if (t == ":")
-        {
-          if (parseJSONValue(*(const_cast< JSONItem ** >(curItem)),
-                             readToken()))
-          {
-            curItem = nullptr;
-            braceExpected = true;
-            commaExpected = true;
-            continue;
-          }
-        }
-        throw FO76UtilsError("syntax error in JSON file at line %lu",
-                             (unsigned long) curLine);
-      }
-    }
+    destructItems.push_back(nullptr);
+    p = objectBuf.constructObject< T >();
+    destructItems.back() = p;
   }
-  else if (s == "[")
+  p->type = type;
+  return p;
+}
+
+JSONReader::JSONItem * JSONReader::parseJSONValue(
+    int tokenType, const std::string_view& t)
+{
+  switch (tokenType)
   {
-    // array
-    JSONArray *p = new JSONArray;
-    o = p;
-    p->type = JSONItemType_Array;
-    bool    bracketExpected = true;
-    bool    commaExpected = false;
-    while (true)
-    {
-      std::string&  t = readToken();
-      if (t.empty())
+    case Token_String:
       {
-        throw FO76UtilsError("unexpected end of JSON file at line %lu",
-                             (unsigned long) curLine);
+        JSONString  *p = allocateItem< JSONString >(JSONItemType_String);
+        p->value = t;
+        return p;
       }
-      if (t == "]" && bracketExpected)
-        break;
-      if ((t == ",") != commaExpected)
-      {
-        throw FO76UtilsError("syntax error in JSON file at line %lu",
-                             (unsigned long) curLine);
-      }
-      bracketExpected = !commaExpected;
-      commaExpected = !commaExpected;
-      if (!commaExpected)
-        continue;
-      p->children.push_back(nullptr);
-      (void) parseJSONValue(*(const_cast< JSONItem ** >(&(p->children.back()))),
-                            t);
-    }
+    case '{':
+      return parseJSONObject();
+    case '[':
+      return parseJSONArray();
+    case Token_Other:
+      break;
+    default:
+      parseError("syntax error in JSON file at line %lu", filePos);
   }
-  else if ((s[0] >= '0' && s[0] <= '9') ||
-           s[0] == '+' || s[0] == '-' || s[0] == '.')
+  char    c0 = t[0];
+  if ((c0 >= '0' && c0 <= '9') || c0 == '+' || c0 == '-' || c0 == '.')
   {
     // number
-    char    *endp = nullptr;
-    double  tmp = std::strtod(s.c_str(), &endp);
-    if (endp != (s.c_str() + s.length()))
+    double  tmp = 0.0;
+    bool    isInteger = false;
+    size_t  i = size_t(c0 == '-');
+    if (t.length() > i && (t.length() - i) <= 15)
     {
-      throw FO76UtilsError("invalid number syntax in JSON file at line %lu",
-                           (unsigned long) curLine);
+      // integers that can be represented exactly do not need strtod()
+      std::uint64_t n = 0U;
+      for ( ; i < t.length() && t[i] >= '0' && t[i] <= '9'; i++)
+        n = (n * 10U) + std::uint64_t(t[i] & 0x0F);
+      tmp = (c0 != '-' ? double(n) : -double(n));
+      isInteger = (i >= t.length());
     }
-    JSONNumber  *p = new JSONNumber;
-    o = p;
-    p->type = JSONItemType_Number;
+    if (!isInteger)
+    {
+      stringBuf = t;
+      char    *endp = nullptr;
+      tmp = std::strtod(stringBuf.c_str(), &endp);
+      if (endp != (stringBuf.c_str() + stringBuf.length()))
+      {
+        parseError("invalid number syntax in JSON file at line %lu",
+                   filePos);
+      }
+    }
+    JSONNumber  *p = allocateItem< JSONNumber >(JSONItemType_Number);
     p->value = tmp;
+    return p;
   }
-  else if (s == "false" || s == "true")
+  if (t == "false" || t == "true")
   {
     // boolean
-    JSONBoolean *p = new JSONBoolean;
-    o = p;
-    p->type = JSONItemType_Boolean;
-    p->value = (s[0] == 't');
+    JSONBoolean *p = allocateItem< JSONBoolean >(JSONItemType_Boolean);
+    p->value = (c0 == 't');
+    return p;
   }
-  else if (s == "null")
+  if (t == "null")
   {
     // null
-    o = new JSONItem;
-    o->type = JSONItemType_Null;
+    JSONItem  *p = allocateItem< JSONItem >(JSONItemType_Null);
+    return p;
   }
-  else
+  parseError("syntax error in JSON file at line %lu", filePos);
+}
+
+JSONReader::JSONItem * JSONReader::parseJSONObject()
+{
+  JSONObject  *p = allocateItem< JSONObject >(JSONItemType_Object);
+  bool    braceExpected = true;
+  bool    commaExpected = false;
+  while (true)
+  {
+    std::string_view  t;
+    int     tokenType = readToken(t);
+    if (tokenType == Token_EOF)
+      parseError("unexpected end of JSON file at line %lu", filePos);
+    if (tokenType == '}' && braceExpected)
+      break;
+    if (tokenType == ',' && commaExpected)
+    {
+      braceExpected = false;
+      commaExpected = false;
+      continue;
+    }
+    if (!(tokenType == Token_String ||
+          (tokenType == Token_Other && t == "null")))
+    {
+      parseError("syntax error in JSON file at line %lu", filePos);
+    }
+    // the key is copied before parsing the value, which may reuse
+    // stringBuf; if a key is not unique, only the last value is stored
+    const JSONItem  **curItem =
+        &(p->children[tokenType == Token_String ? std::string(t)
+                                                : std::string()]);
+    if (readToken(t) != ':')
+      parseError("syntax error in JSON file at line %lu", filePos);
+    tokenType = readToken(t);
+    if (tokenType == Token_EOF)
+      parseError("syntax error in JSON file at line %lu", filePos);
+    *curItem = parseJSONValue(tokenType, t);
+    braceExpected = true;
+    commaExpected = true;
+  }
+  return p;
+}
+
+JSONReader::JSONItem * JSONReader::parseJSONArray()
+{
+  JSONArray *p = allocateItem< JSONArray >(JSONItemType_Array);
+  size_t  stackPos = itemStack.size();
+  bool    bracketExpected = true;
+  bool    commaExpected = false;
+  while (true)
   {
-    throw FO76UtilsError("syntax error in JSON file at line %lu",
-                         (unsigned long) curLine);
+    std::string_view  t;
+    int     tokenType = readToken(t);
+    if (tokenType == Token_EOF)
+      parseError("unexpected end of JSON file at line %lu", filePos);
+    if (tokenType == ']' && bracketExpected)
+      break;
+    if ((tokenType == ',') != commaExpected)
+      parseError("syntax error in JSON file at line %lu", filePos);
+    bracketExpected = !commaExpected;
+    commaExpected = !commaExpected;
+    if (!commaExpected)
+      continue;
+    itemStack.push_back(parseJSONValue(tokenType, t));
   }
-  return true;
+  // the elements are collected first so that the vector is allocated once
+  p->children.assign(itemStack.begin() + std::ptrdiff_t(stackPos),
+                     itemStack.end());
+  itemStack.resize(stackPos);
+  return p;
 }
 
 void JSONReader::parseJSONData()
@@ -303,54 +361,37 @@ void JSONReader::parseJSONData()
   {
     filePos = 3;
   }
-  if (rootObject)
-  {
-    deleteJSONObjects(rootObject);
-    rootObject = nullptr;
-  }
-  curLine = 1;
-  (void) parseJSONValue(rootObject, readToken());
+  clearJSONData();
+  itemStack.clear();
+  std::string_view  t;
+  int     tokenType = readToken(t);
+  if (tokenType != Token_EOF)
+    rootObject = parseJSONValue(tokenType, t);
 }
 
-void JSONReader::deleteJSONObjects(JSONItem *p)
+void JSONReader::clearJSONData()
 {
-  switch (p->type)
+  rootObject = nullptr;
+  for (size_t i = destructItems.size(); i-- > 0; )
   {
-    case JSONItemType_Boolean:
-      delete static_cast< JSONBoolean * >(p);
-      break;
-    case JSONItemType_Number:
-      delete static_cast< JSONNumber * >(p);
-      break;
-    case JSONItemType_String:
-      delete static_cast< JSONString * >(p);
-      break;
-    case JSONItemType_Object:
-      {
-        JSONObject& o = *(static_cast< JSONObject * >(p));
-        for (auto& i : o.children)
-        {
-          if (i.second)
-            deleteJSONObjects(const_cast< JSONItem * >(i.second));
-        }
-        delete &o;
-      }
-      break;
-    case JSONItemType_Array:
-      {
-        JSONArray&  o = *(static_cast< JSONArray * >(p));
-        for (auto& i : o.children)
-        {
-          if (i)
-            deleteJSONObjects(const_cast< JSONItem * >(i));
-        }
-        delete &o;
-      }
-      break;
-    default:
-      delete p;
-      break;
+    JSONItem  *p = destructItems[i];
+    if (!p)
+      continue;
+    switch (p->type)
+    {
+      case JSONItemType_String:
+        static_cast< JSONString * >(p)->~JSONString();
+        break;
+      case JSONItemType_Object:
+        static_cast< JSONObject * >(p)->~JSONObject();
+        break;
+      case JSONItemType_Array:
+        static_cast< JSONArray * >(p)->~JSONArray();
+        break;
+    }
   }
+  destructItems.clear();
+  objectBuf.clear();
 }
 
 JSONReader::JSONReader(const char *fileName)
@@ -363,8 +404,7 @@ JSONReader::JSONReader(const char *fileName)
   }
   catch (...)
   {
-    if (rootObject)
-      deleteJSONObjects(rootObject);
+    clearJSONData();
     throw;
   }
 }
@@ -379,15 +419,12 @@ JSONReader::JSONReader(const unsigned char *fileData, size_t fileSize)
   }
   catch (...)
   {
-    if (rootObject)
-      deleteJSONObjects(rootObject);
+    clearJSONData();
     throw;
   }
 }
 
 JSONReader::~JSONReader()
 {
-  if (rootObject)
-    deleteJSONObjects(rootObject);
+  clearJSONData();
 }
-
@@ -43,15 +43,34 @@ class JSONReader : public FileBuffer
     std::vector< const JSONItem * > children;
   };
  protected:
+  // all JSONItem objects are allocated from objectBuf, the ones that have
+  // a destructor (strings, objects and arrays) are also stored in
+  // destructItems, and are destroyed by clearJSONData()
+  AllocBuffers  objectBuf;
+  std::vector< JSONItem * > destructItems;
   JSONItem  *rootObject;
-  size_t    curLine;
-  std::string curToken;
-  // returns empty string on EOF
-  std::string& readToken();
-  // returns false if s is empty
-  bool parseJSONValue(JSONItem*& o, const std::string& s);
+  // temporary storage for the elements of arrays being parsed
+  std::vector< const JSONItem * > itemStack;
+  std::string stringBuf;
+  enum
+  {
+    // token types returned by readToken(), in addition to single characters
+    Token_EOF = 0,
+    Token_String = 1,
+    Token_Other = 2                     // number, boolean or null
+  };
+  [[noreturn]] void parseError(const char *msg, size_t offs) const;
+  // returns the token type, and the string or other value in t, which
+  // points to the file data or to stringBuf
+  int readToken(std::string_view& t);
+  // decodes escape sequences to stringBuf
+  std::string_view decodeString(size_t startPos, size_t endPos);
+  template< typename T > T *allocateItem(int type);
+  JSONItem *parseJSONValue(int tokenType, const std::string_view& t);
+  JSONItem *parseJSONObject();
+  JSONItem *parseJSONArray();
   void parseJSONData();
-  void deleteJSONObjects(JSONItem *p);
+  void clearJSONData();
  public:
   JSONReader(const char *fileName);
   JSONReader(const unsigned char *fileData, size_t fileSize);
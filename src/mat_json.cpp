@@ -1,6 +1,7 @@
 
 #include "common.hpp"
 #include "bsmatcdb.hpp"
+#include "threadpool.hpp"
 
 std::uint32_t BSMaterialsCDB::findJSONItemType(const std::string& s)
 {
@@ -77,9 +78,8 @@ void BSMaterialsCDB::loadJSONItem(
     MaterialObject *materialObject,
     std::map< BSResourceID, MaterialObject * >& objectMap)
 {
-  if (o && o->refCnt)
+  if (o && releaseObjectRef(*o))
   {
-    o->refCnt--;
     size_t  dataSize, alignSize;
     if (o->type > BSReflStream::String_Unknown)
     {
@@ -593,8 +593,7 @@ void BSMaterialsCDB::loadJSONFile(
     {
       continue;
     }
-    MaterialObject  *o =
-        const_cast< MaterialObject * >(findMatFileObject(objectID));
+    MaterialObject  *o = getWritableObject(findMatFileObject(objectID));
     if (o && o->parent)
     {
       // remove old edges from this object ID
@@ -707,7 +706,8 @@ void BSMaterialsCDB::loadJSONFile(
         continue;
       MaterialObject  *r =
           const_cast< MaterialObject * >(q->o->children()[0]->linkedObject());
-      if (r && !r->baseObject)
+      // objects owned by the parent database of an overlay are not changed
+      if (r && !r->baseObject && isOwnObject(r))
       {
         std::uint32_t baseObjectName = 0;
         switch (q->className)
@@ -804,9 +804,10 @@ void BSMaterialsCDB::loadJSONFile(
            i = objectMap.begin(); i != objectMap.end(); i++)
   {
     MaterialObject  *o = i->second;
-    MaterialObject  *q = const_cast< MaterialObject * >(o->parent);
+    MaterialObject  *q = getWritableObject(o->parent);
     if (q)
     {
+      o->parent = q;
       o->next = q->children;
       q->children = o;
     }
@@ -830,6 +831,33 @@ void BSMaterialsCDB::loadJSONFile(
       (!materialPath.empty() ? materialPath : std::string_view(fileName)));
 }
 
+size_t BSMaterialsCDB::extractJSONFile(
+    const unsigned char*& jsonData, BA2File::UCharArray& jsonBuf,
+    const std::string_view& materialPath, BSResourceID objectID,
+    bool *isPackedParentFile) const
+{
+  size_t  jsonSize = 0;
+  const BA2File::FileInfo *fd;
+  if (ba2File && (fd = ba2File->findFile(materialPath)) != nullptr)
+    jsonSize = ba2File->extractFile(jsonData, jsonBuf, materialPath);
+  if (parentDB && jsonSize < 1)
+  {
+    const BA2File *ba2File2 = parentDB->ba2File;
+    if (ba2File2 && (fd = ba2File2->findFile(materialPath)) != nullptr)
+    {
+      if (fd->archiveType >= 0)
+      {
+        if (isPackedParentFile)
+          *isPackedParentFile = true;
+        else if (getMaterial(objectID))
+          return 0;
+      }
+      jsonSize = ba2File2->extractFile(jsonData, jsonBuf, materialPath);
+    }
+  }
+  return jsonSize;
+}
+
 bool BSMaterialsCDB::loadJSONFile(
     const std::string_view& materialPath, BSResourceID objectID, int flags)
 {
@@ -846,21 +874,9 @@ bool BSMaterialsCDB::loadJSONFile(
   BA2File::UCharArray jsonBuf;
   const unsigned char *jsonData = nullptr;
   size_t  jsonSize = 0;
-  const BA2File::FileInfo *fd;
-  const MaterialObject  *p = getMaterial(objectID);
   try
   {
-    if (ba2File && (fd = ba2File->findFile(materialPath)) != nullptr)
-      jsonSize = ba2File->extractFile(jsonData, jsonBuf, materialPath);
-    if (parentDB && jsonSize < 1)
-    {
-      const BA2File *ba2File2 = parentDB->ba2File;
-      if (ba2File2 && (fd = ba2File2->findFile(materialPath)) != nullptr &&
-          (fd->archiveType < 0 || !p))
-      {
-        jsonSize = ba2File2->extractFile(jsonData, jsonBuf, materialPath);
-      }
-    }
+    jsonSize = extractJSONFile(jsonData, jsonBuf, materialPath, objectID);
     if (jsonSize > 0)
       loadJSONFile(jsonData, jsonSize, materialPath);
   }
@@ -880,3 +896,138 @@ bool BSMaterialsCDB::loadJSONFile(
   return true;
 }
 
+struct BSMaterialsCDB::JSONFileData
+{
+  BSResourceID  objectID;
+  bool    isLoaded;             // false if the file should be skipped
+  // true if the file is from a packed archive of parentDB, and should only
+  // be loaded if objectID is not defined at the time of adding it
+  bool    isPackedParentFile;
+  BA2File::UCharArray jsonBuf;
+  JSONReader  *matFile;         // nullptr if the file is not found
+  std::exception_ptr  err;
+  JSONFileData()
+    : isLoaded(false),
+      isPackedParentFile(false),
+      matFile(nullptr)
+  {
+  }
+  ~JSONFileData()
+  {
+    delete matFile;
+  }
+};
+
+void BSMaterialsCDB::loadJSONFilesThread(
+    const BSMaterialsCDB *cdb, JSONFileData *fileData,
+    const std::string_view *materialPaths, size_t fileCnt,
+    std::atomic< size_t > *nextFile)
+{
+  while (true)
+  {
+    size_t  i = nextFile->fetch_add(1, std::memory_order_relaxed);
+    if (i >= fileCnt)
+      break;
+    JSONFileData& d = fileData[i];
+    if (!d.isLoaded)
+      continue;
+    try
+    {
+      const unsigned char *jsonData = nullptr;
+      size_t  jsonSize =
+          cdb->extractJSONFile(jsonData, d.jsonBuf, materialPaths[i],
+                               d.objectID, &(d.isPackedParentFile));
+      if (jsonSize > 0)
+        d.matFile = new JSONReader(jsonData, jsonSize);
+    }
+    catch (...)
+    {
+      d.err = std::current_exception();
+    }
+  }
+}
+
+size_t BSMaterialsCDB::loadJSONFiles(
+    const std::vector< std::string_view >& materialPaths, int flags,
+    int threadCnt)
+{
+  ThreadPool& threadPool = ThreadPool::getDefaultPool();
+  if (threadCnt <= 0)
+    threadCnt = threadPool.getThreadCount();
+  threadCnt = std::min(std::max(threadCnt, 1), 64);
+  size_t  loadCnt = 0;
+  // files are processed in batches to limit memory usage
+  const size_t  batchSize = 1024;
+  for (size_t i0 = 0; i0 < materialPaths.size(); i0 = i0 + batchSize)
+  {
+    size_t  fileCnt = std::min(materialPaths.size() - i0, batchSize);
+    const std::string_view  *paths = materialPaths.data() + i0;
+    std::vector< JSONFileData > fileData(fileCnt);
+    for (size_t i = 0; i < fileCnt; i++)
+    {
+      JSONFileData& d = fileData[i];
+      if (!paths[i].empty())
+        d.objectID = BSResourceID(paths[i]);
+      else
+        d.objectID = BSResourceID(0U, 0U, 0U);
+      if (!d.objectID)
+      {
+        if (flags & 1)
+          continue;
+        errorMessage("BSMaterialsCDB::loadJSONFiles(): empty file name");
+      }
+      d.isLoaded = (jsonMaterialsLoaded.insert(d.objectID) || !(flags & 4));
+    }
+    // extract and parse the files in parallel
+    std::atomic< size_t > nextFile(0);
+    int     n = int(std::min(size_t(threadCnt), fileCnt));
+    threadPool.parallelFor(
+        0, n, 1,
+        [&](int j0, int j1)
+        {
+          for (int j = j0; j < j1; j++)
+          {
+            loadJSONFilesThread(this, fileData.data(), paths, fileCnt,
+                                &nextFile);
+          }
+        });
+    // add the objects to the database in the original order of the files
+    for (size_t i = 0; i < fileCnt; i++)
+    {
+      JSONFileData& d = fileData[i];
+      if (!d.isLoaded)
+        continue;
+      if (d.isPackedParentFile && getMaterial(d.objectID))
+      {
+        // defined by the parent database or by an earlier file, this is
+        // checked here so that the result is the same as with loadJSONFile()
+        delete d.matFile;
+        d.matFile = nullptr;
+        d.err = nullptr;
+      }
+      try
+      {
+        if (d.err)
+          std::rethrow_exception(d.err);
+        if (d.matFile)
+          loadJSONFile(*(d.matFile), paths[i]);
+      }
+      catch (FO76UtilsError&)
+      {
+        if (flags & 2)
+          continue;
+        throw;
+      }
+      if (!d.matFile)
+      {
+        if (flags & 1)
+          continue;
+        throw FO76UtilsError("BSMaterialsCDB::loadJSONFiles(): cannot find %s",
+                             std::string(paths[i]).c_str());
+      }
+      loadCnt++;
+    }
+  }
+  return loadCnt;
+}
+
@@ -1208,30 +1208,81 @@ static const unsigned char  matDirNamesZLib[14363] =
   0xFD, 0x00, 0x5D, 0xE9, 0xFF, 0xFD, 0x1F, 0xFD, 0x06, 0x9B, 0x25
 };
 
-static void getStarfieldMaterialDirMap(
-    std::map< std::uint32_t, std::string >& dirNameMap)
+namespace
+{
+
+// hash table of the known material directory names, decompressed and built
+// only once, on first use
+class MatDirNameTable
+{
+ protected:
+  // NUL separated directory names with '/' appended
+  std::vector< char > nameBuf;
+  // (CRC32 << 32) | (offset + 1), 0 for empty entries
+  std::vector< std::uint64_t >  hashTable;
+  std::uint32_t hashMask;
+  MatDirNameTable();
+ public:
+  static const MatDirNameTable& getTable()
+  {
+    static const MatDirNameTable  t;
+    return t;
+  }
+  const char *find(std::uint32_t dirHash) const;
+};
+
+MatDirNameTable::MatDirNameTable()
 {
   std::vector< unsigned char >  tmpBuf(matDirNamesSize + 1, 0);
   (void) ZLibDecompressor::decompressData(tmpBuf.data(), matDirNamesSize,
                                           matDirNamesZLib,
                                           sizeof(matDirNamesZLib));
-  std::string tmp;
+  size_t  dirCnt = 0;
+  for (size_t i = 0; i < matDirNamesSize; i++)
+    dirCnt += size_t(!tmpBuf[i]);
+  hashMask = 0xFFU;
+  while ((size_t(hashMask) + 1) < (dirCnt * 2))
+    hashMask = (hashMask << 1) | 1U;
+  hashTable.resize(size_t(hashMask) + 1, 0U);
+  nameBuf.reserve(matDirNamesSize + dirCnt + 1);
   for (size_t i = 0; i < matDirNamesSize; i++)
   {
-    tmp = reinterpret_cast< char * >(tmpBuf.data() + i);
+    std::uint64_t offs = nameBuf.size();
     std::uint32_t h = 0U;
     for ( ; tmpBuf[i]; i++)
     {
       unsigned char c = tmpBuf[i];
+      nameBuf.push_back(char(c));
       if (c == '/')
         c = '\\';
       hashFunctionCRC32(h, c);
     }
-    tmp += '/';
-    dirNameMap[h] = tmp;
+    nameBuf.push_back('/');
+    nameBuf.push_back('\0');
+    std::uint32_t j = h & hashMask;
+    for ( ; hashTable[j]; j = (j + 1U) & hashMask)
+    {
+      if (std::uint32_t(hashTable[j] >> 32) == h)
+        break;
+    }
+    // if there are duplicate hashes, the last name is used
+    hashTable[j] = (std::uint64_t(h) << 32) | (offs + 1U);
+  }
+}
+
+const char * MatDirNameTable::find(std::uint32_t dirHash) const
+{
+  for (std::uint32_t j = dirHash & hashMask; hashTable[j];
+       j = (j + 1U) & hashMask)
+  {
+    if (std::uint32_t(hashTable[j] >> 32) == dirHash)
+      return nameBuf.data() + (std::uint32_t(hashTable[j]) - 1U);
   }
+  return nullptr;
 }
 
+}       // namespace
+
 #if ENABLE_UNKNOWN_MAT_DIRS
 static std::uint64_t findDirNameForHash(
     std::uint32_t prefixHash, std::uint32_t dirHash, std::uint64_t prefixStr)
@@ -1290,34 +1341,24 @@ static std::map< std::uint32_t, std::string >::const_iterator
 }
 #endif
 
-struct MatFileFilterData
-{
-  std::set< std::string_view >  *materialPaths;
-  bool    (*fileFilterFunc)(void *p, const std::string_view& s);
-  void    *fileFilterFuncData;
-  inline bool addFile(const std::string_view& s)
-  {
-    if (!fileFilterFunc || fileFilterFunc(fileFilterFuncData, s))
-      materialPaths->insert(s);
-    return false;
-  }
-};
-
 static bool matFileScanFunc(void *p, const BA2File::FileInfo& fd)
 {
   if (fd.fileName.ends_with(".mat") && fd.fileName.starts_with("materials/"))
-    return reinterpret_cast< MatFileFilterData * >(p)->addFile(fd.fileName);
+  {
+    reinterpret_cast< std::vector< std::string_view > * >(p)->push_back(
+        fd.fileName);
+  }
   return false;
 }
 
-void CE2MaterialDB::getMaterialList(
-    std::set< std::string_view >& materialPaths, AllocBuffers& buf,
-    bool excludeJSONMaterials,
-    bool (*fileFilterFunc)(void *p, const std::string_view& s),
-    void *fileFilterFuncData) const
+void CE2MaterialDB::updateMaterialListCache() const
 {
-  std::map< std::uint32_t, std::string >  dirNameMap;
-  getStarfieldMaterialDirMap(dirNameMap);
+  materialListCache.clear();
+  materialListBuf.clear();
+  const MatDirNameTable&  dirNameTable = MatDirNameTable::getTable();
+#if ENABLE_UNKNOWN_MAT_DIRS
+  std::map< std::uint32_t, std::string >  unknownDirMap;
+#endif
   std::vector< const BSMaterialsCDB::MaterialObject * > matObjects;
   BSMaterialsCDB::getMaterials(matObjects);
   std::string tmp;
@@ -1343,13 +1384,17 @@ void CE2MaterialDB::getMaterialList(
       }
       if (!(baseName && *baseName))
         continue;
-      std::map< std::uint32_t, std::string >::const_iterator  j =
-          dirNameMap.find(o->persistentID.dir);
-      if (j == dirNameMap.end())
+      const char  *dirName = dirNameTable.find(o->persistentID.dir);
+      if (!dirName)
       {
 #if ENABLE_UNKNOWN_MAT_DIRS
-        j = findUnknownMatDir(dirNameMap, o->persistentID.dir, baseName);
-        if (j == dirNameMap.end())
+        std::map< std::uint32_t, std::string >::const_iterator  j =
+            unknownDirMap.find(o->persistentID.dir);
+        if (j == unknownDirMap.end())
+          j = findUnknownMatDir(unknownDirMap, o->persistentID.dir, baseName);
+        if (j != unknownDirMap.end())
+          dirName = j->second.c_str();
+        else
 #endif
           continue;
       }
@@ -1363,22 +1408,82 @@ void CE2MaterialDB::getMaterialList(
       }
       if (h != o->persistentID.file)
         continue;
-      tmp.insert(0, j->second);
+      tmp.insert(0, dirName);
       tmp += ".mat";
-      if (fileFilterFunc && !fileFilterFunc(fileFilterFuncData, tmp))
+      char    *s = materialListBuf.allocateObjects< char >(tmp.length() + 1);
+      std::memcpy(s, tmp.c_str(), tmp.length() + 1);
+      materialListCache.emplace_back(o->persistentID,
+                                     std::string_view(s, tmp.length()));
+    }
+  }
+  std::sort(materialListCache.begin(), materialListCache.end(),
+            [](const MaterialListEntry& a, const MaterialListEntry& b)
+            {
+              return (a.second < b.second);
+            });
+  materialListValid = true;
+}
+
+void CE2MaterialDB::getMaterialList(
+    std::vector< std::string_view >& materialPaths,
+    bool excludeJSONMaterials,
+    bool (*fileFilterFunc)(void *p, const std::string_view& s),
+    void *fileFilterFuncData) const
+{
+  materialPaths.clear();
+  {
+    std::unique_lock< std::mutex >  lock(materialListMutex);
+    if (!materialListValid)
+      updateMaterialListCache();
+    materialPaths.reserve(materialListCache.size());
+    for (size_t i = 0; i < materialListCache.size(); i++)
+    {
+      // skip materials that have been replaced with .mat files
+      const BSMaterialsCDB::MaterialObject  *o =
+          findMatFileObject(materialListCache[i].first);
+      if (!o || o->isJSON())
         continue;
-      char    *s = buf.allocateObjects< char >(tmp.length() + 1);
-      std::memcpy(s, tmp.c_str(), tmp.length());
-      materialPaths.emplace(s, tmp.length());
+      const std::string_view& s = materialListCache[i].second;
+      if (!fileFilterFunc || fileFilterFunc(fileFilterFuncData, s))
+        materialPaths.push_back(s);
     }
   }
-  if (excludeJSONMaterials)
+  if (excludeJSONMaterials || !ba2File)
     return;
-  MatFileFilterData filterData;
-  filterData.materialPaths = &materialPaths;
-  filterData.fileFilterFunc = fileFilterFunc;
-  filterData.fileFilterFuncData = fileFilterFuncData;
-  if (ba2File)
-    ba2File->scanFileList(&matFileScanFunc, &filterData);
+  std::vector< std::string_view > jsonPaths;
+  ba2File->scanFileList(&matFileScanFunc, &jsonPaths);
+  size_t  n = materialPaths.size();
+  for (size_t i = 0; i < jsonPaths.size(); i++)
+  {
+    const std::string_view& s = jsonPaths[i];
+    if (!fileFilterFunc || fileFilterFunc(fileFilterFuncData, s))
+      materialPaths.push_back(s);
+  }
+  if (materialPaths.size() == n)
+    return;
+  std::sort(materialPaths.begin() + std::ptrdiff_t(n), materialPaths.end());
+  std::inplace_merge(materialPaths.begin(),
+                     materialPaths.begin() + std::ptrdiff_t(n),
+                     materialPaths.end());
+  materialPaths.erase(std::unique(materialPaths.begin(), materialPaths.end()),
+                      materialPaths.end());
 }
 
+void CE2MaterialDB::getMaterialList(
+    std::set< std::string_view >& materialPaths, AllocBuffers& buf,
+    bool excludeJSONMaterials,
+    bool (*fileFilterFunc)(void *p, const std::string_view& s),
+    void *fileFilterFuncData) const
+{
+  std::vector< std::string_view > tmpPaths;
+  getMaterialList(tmpPaths, excludeJSONMaterials,
+                  fileFilterFunc, fileFilterFuncData);
+  for (size_t i = 0; i < tmpPaths.size(); i++)
+  {
+    const std::string_view& s = tmpPaths[i];
+    char    *t = buf.allocateObjects< char >(s.length() + 1);
+    std::memcpy(t, s.data(), s.length());
+    t[s.length()] = '\0';
+    materialPaths.emplace_hint(materialPaths.end(), t, s.length());
+  }
+}
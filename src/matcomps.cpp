@@ -298,8 +298,16 @@ bool CE2MaterialDB::ComponentInfo::readPath(
     const char  *t = p->children()[fieldNum]->stringValue();
     FileBuffer  tmpBuf(reinterpret_cast< const unsigned char * >(t),
                        std::strlen(t) + 1, 0);
-    tmpBuf.readPath(cdb.stringBuf, std::string::npos, prefix, suffix);
-    s = cdb.storeStdString(cdb.stringBuf);
+    if (!threadData)
+    {
+      tmpBuf.readPath(cdb.stringBuf, std::string::npos, prefix, suffix);
+      s = cdb.storeStdString(cdb.stringBuf);
+      return true;
+    }
+    std::string&  stringBuf = threadData->stringBuf;
+    tmpBuf.readPath(stringBuf, std::string::npos, prefix, suffix);
+    std::unique_lock< std::mutex >  lock(cdb.stringBufMutex);
+    s = cdb.storeStdString(stringBuf);
     return true;
   }
   return false;
@@ -405,7 +413,7 @@ void CE2MaterialDB::ComponentInfo::readLayeredEmissivityComponent(
     return;
   CE2Material *m = static_cast< CE2Material * >(o);
   CE2Material::LayeredEmissiveSettings  *sp =
-      cdb.constructObject< CE2Material::LayeredEmissiveSettings >();
+      constructObject< CE2Material::LayeredEmissiveSettings >();
   m->layeredEmissiveSettings = sp;
   bool    tmp;
   if (readBool(tmp, p, 0))
@@ -508,7 +516,7 @@ void CE2MaterialDB::ComponentInfo::readEmissiveSettingsComponent(
     return;
   CE2Material *m = static_cast< CE2Material * >(o);
   CE2Material::EmissiveSettings *sp =
-      cdb.constructObject< CE2Material::EmissiveSettings >();
+      constructObject< CE2Material::EmissiveSettings >();
   m->emissiveSettings = sp;
   bool    tmp;
   if (readBool(tmp, p, 0))
@@ -685,7 +693,7 @@ void CE2MaterialDB::ComponentInfo::readDecalSettingsComponent(
     return;
   CE2Material *m = static_cast< CE2Material * >(o);
   CE2Material::DecalSettings  *sp =
-      cdb.constructObject< CE2Material::DecalSettings >();
+      constructObject< CE2Material::DecalSettings >();
   m->decalSettings = sp;
   bool    tmp;
   if (readBool(tmp, p, 0))
@@ -747,7 +755,7 @@ void CE2MaterialDB::ComponentInfo::readWaterSettingsComponent(
     return;
   CE2Material *m = static_cast< CE2Material * >(o);
   CE2Material::WaterSettings  *sp =
-      cdb.constructObject< CE2Material::WaterSettings >();
+      constructObject< CE2Material::WaterSettings >();
   m->setFlags(CE2Material::Flag_IsWater | CE2Material::Flag_AlphaBlending,
               true);
   m->waterSettings = sp;
@@ -862,7 +870,7 @@ void CE2MaterialDB::ComponentInfo::readEffectSettingsComponent(
     return;
   CE2Material *m = static_cast< CE2Material * >(o);
   CE2Material::EffectSettings *sp =
-      cdb.constructObject< CE2Material::EffectSettings >();
+      constructObject< CE2Material::EffectSettings >();
   m->setFlags(CE2Material::Flag_IsEffect | CE2Material::Flag_AlphaBlending,
               true);
   m->effectSettings = sp;
@@ -959,7 +967,7 @@ void CE2MaterialDB::ComponentInfo::readGlobalLayerDataComponent(
     return;
   CE2Material *m = static_cast< CE2Material * >(o);
   CE2Material::GlobalLayerData  *sp =
-      cdb.constructObject< CE2Material::GlobalLayerData >();
+      constructObject< CE2Material::GlobalLayerData >();
   m->globalLayerData = sp;
   m->setFlags(CE2Material::Flag_GlobalLayerData, true);
   readFloat(sp->texcoordScaleXY, p, 0);
@@ -1430,8 +1438,11 @@ bool CE2MaterialDB::ComponentInfo::readBSComponentDB2ID(
       p->children()[0] &&
       p->children()[0]->type == BSReflStream::String_BSComponentDB2_ID)
   {
-    const CE2MaterialObject *tmp =
-        cdb.findMaterialObject(p->children()[0]->linkedObject());
+    const CE2MaterialObject *tmp;
+    if (!threadData)
+      tmp = cdb.findMaterialObject(p->children()[0]->linkedObject());
+    else
+      tmp = cdb.findLoadedObject(p->children()[0]->linkedObject());
     if (typeRequired && tmp && tmp->type != typeRequired)
       tmp = nullptr;
     linkedObject = tmp;
@@ -1499,7 +1510,7 @@ void CE2MaterialDB::ComponentInfo::readLayeredEdgeFalloffComponent(
     return;
   CE2Material *m = static_cast< CE2Material * >(o);
   CE2Material::LayeredEdgeFalloff *sp =
-      cdb.constructObject< CE2Material::LayeredEdgeFalloff >();
+      constructObject< CE2Material::LayeredEdgeFalloff >();
   m->layeredEdgeFalloff = sp;
   for (size_t i = 0; i < 4; i++)
   {
@@ -1552,7 +1563,7 @@ void CE2MaterialDB::ComponentInfo::readVegetationSettingsComponent(
     return;
   CE2Material *m = static_cast< CE2Material * >(o);
   CE2Material::VegetationSettings *sp =
-      cdb.constructObject< CE2Material::VegetationSettings >();
+      constructObject< CE2Material::VegetationSettings >();
   m->vegetationSettings = sp;
   bool    tmp;
   if (readBool(tmp, p, 0))
@@ -1814,7 +1825,7 @@ void CE2MaterialDB::ComponentInfo::readDetailBlenderSettingsComponent(
     return;
   CE2Material *m = static_cast< CE2Material * >(o);
   CE2Material::DetailBlenderSettings  *sp =
-      cdb.constructObject< CE2Material::DetailBlenderSettings >();
+      constructObject< CE2Material::DetailBlenderSettings >();
   m->detailBlenderSettings = sp;
   if (p && p->type > BSReflStream::String_Unknown && p->childCnt >= 1)
     readDetailBlenderSettings(p->children()[0]);
@@ -1881,7 +1892,7 @@ void CE2MaterialDB::ComponentInfo::readTranslucencySettingsComponent(
     return;
   CE2Material *m = static_cast< CE2Material * >(o);
   CE2Material::TranslucencySettings *sp =
-      cdb.constructObject< CE2Material::TranslucencySettings >();
+      constructObject< CE2Material::TranslucencySettings >();
   m->translucencySettings = sp;
   bool    tmp;
   if (readBool(tmp, p, 0))
@@ -2172,7 +2183,7 @@ void CE2MaterialDB::ComponentInfo::readHairSettingsComponent(
     return;
   CE2Material *m = static_cast< CE2Material * >(o);
   CE2Material::HairSettings *sp =
-      cdb.constructObject< CE2Material::HairSettings >();
+      constructObject< CE2Material::HairSettings >();
   m->hairSettings = sp;
   bool    tmp;
   if (readBool(tmp, p, 0))
@@ -2,6 +2,7 @@
 #include "common.hpp"
 #include "material.hpp"
 #include "bsmatcdb.hpp"
+#include "threadpool.hpp"
 
 #include <new>
 
@@ -260,6 +261,41 @@ inline const CE2MaterialObject *
   return nullptr;
 }
 
+void CE2MaterialDB::CE2MatObjectHashMap::removeObject(BSResourceID objectID)
+{
+  size_t  m = hashMask;
+  size_t  i = objectID.hashFunction() & m;
+  const CE2MaterialObject *p;
+  for ( ; (p = buf[i]) != nullptr; i = (i + 1) & m)
+  {
+    if (p->cdbObject->persistentID == objectID)
+      break;
+  }
+  if (!p)
+    return;
+  // move back any following objects that would not be found after the
+  // empty slot
+  for (size_t j = i; true; )
+  {
+    buf[i] = nullptr;
+    while (true)
+    {
+      j = (j + 1) & m;
+      p = buf[j];
+      if (!p)
+      {
+        size--;
+        return;
+      }
+      size_t  k = p->cdbObject->persistentID.hashFunction() & m;
+      if (i <= j ? (k <= i || k > j) : (k <= i && k > j))
+        break;
+    }
+    buf[i] = p;
+    i = j;
+  }
+}
+
 void CE2MaterialDB::CE2MatObjectHashMap::expandBuffer()
 {
   size_t  m = (hashMask << 1) | 0x0FFF;
@@ -290,16 +326,116 @@ void CE2MaterialDB::CE2MatObjectHashMap::expandBuffer()
   hashMask = m;
 }
 
-CE2MaterialObject * CE2MaterialDB::findMaterialObject(
-    const BSMaterialsCDB::MaterialObject *p)
+CE2MaterialDB::CE2MatObjectAtomicMap::CE2MatObjectAtomicMap()
+  : curTable(nullptr),
+    size(0)
 {
-  if (!p) [[unlikely]]
-    return nullptr;
+  expandBuffer();
+}
+
+CE2MaterialDB::CE2MatObjectAtomicMap::~CE2MatObjectAtomicMap()
+{
+  for (Table *t = curTable.load(std::memory_order_relaxed); t; )
   {
-    const CE2MaterialObject *o = materialObjectMap.findObject(p->persistentID);
-    if (o)
-      return const_cast< CE2MaterialObject * >(o);
+    Table   *prv = t->prv;
+    delete[] t->buf;
+    delete t;
+    t = prv;
+  }
+}
+
+void CE2MaterialDB::CE2MatObjectAtomicMap::clear()
+{
+  Table   *t = curTable.load(std::memory_order_relaxed);
+  while (t->prv)
+  {
+    Table   *prv = t->prv;
+    delete[] t->buf;
+    delete t;
+    t = prv;
+  }
+  for (size_t i = 0; i <= t->hashMask; i++)
+    t->buf[i].store(nullptr, std::memory_order_relaxed);
+  curTable.store(t, std::memory_order_release);
+  size = 0;
+}
+
+void CE2MaterialDB::CE2MatObjectAtomicMap::storeObject(
+    const CE2MaterialObject *o)
+{
+  Table   *t = curTable.load(std::memory_order_relaxed);
+  BSResourceID  objectID(o->cdbObject->persistentID);
+  size_t  m = t->hashMask;
+  size_t  i = objectID.hashFunction() & m;
+  const CE2MaterialObject *p;
+  for ( ; (p = t->buf[i].load(std::memory_order_relaxed)) != nullptr;
+        i = (i + 1) & m)
+  {
+    if (p->cdbObject->persistentID == objectID)
+      return;
   }
+  // the release store makes the loaded object visible to findObject()
+  t->buf[i].store(o, std::memory_order_release);
+  size++;
+  if ((size * std::uint64_t(3)) > (m * std::uint64_t(2))) [[unlikely]]
+    expandBuffer();
+}
+
+inline const CE2MaterialObject *
+    CE2MaterialDB::CE2MatObjectAtomicMap::findObject(
+        BSResourceID objectID) const
+{
+  const Table *t = curTable.load(std::memory_order_acquire);
+  size_t  m = t->hashMask;
+  size_t  i = objectID.hashFunction() & m;
+  const CE2MaterialObject *o;
+  for ( ; (o = t->buf[i].load(std::memory_order_acquire)) != nullptr;
+        i = (i + 1) & m)
+  {
+    if (o->cdbObject->persistentID == objectID)
+      return o;
+  }
+  return nullptr;
+}
+
+void CE2MaterialDB::CE2MatObjectAtomicMap::expandBuffer()
+{
+  Table   *t = curTable.load(std::memory_order_relaxed);
+  size_t  m = (!t ? 0x0FFF : ((t->hashMask << 1) | 1));
+  Table   *newTable = new Table;
+  try
+  {
+    // value-initialized to nullptr
+    newTable->buf = new std::atomic< const CE2MaterialObject * >[m + 1];
+  }
+  catch (...)
+  {
+    delete newTable;
+    throw;
+  }
+  newTable->hashMask = m;
+  newTable->prv = t;
+  if (t)
+  {
+    for (size_t i = 0; i <= t->hashMask; i++)
+    {
+      const CE2MaterialObject *o = t->buf[i].load(std::memory_order_relaxed);
+      if (!o)
+        continue;
+      size_t  h = o->cdbObject->persistentID.hashFunction() & m;
+      while (newTable->buf[h].load(std::memory_order_relaxed))
+        h = (h + 1) & m;
+      newTable->buf[h].store(o, std::memory_order_relaxed);
+    }
+  }
+  // tables are not deleted until clear(), as other threads may still be
+  // searching the previous one
+  curTable.store(newTable, std::memory_order_release);
+}
+
+CE2MaterialObject * CE2MaterialDB::constructMaterialObject(
+    const BSMaterialsCDB::MaterialObject *p)
+{
   CE2MaterialObject *o = nullptr;
   {
     const BSMaterialsCDB::MaterialObject  *q = p;
@@ -333,10 +469,27 @@ CE2MaterialObject * CE2MaterialDB::findMaterialObject(
         break;
     }
   }
+  if (o) [[likely]]
+  {
+    o->cdbObject = p;
+    o->name = BSMaterialsCDB::storeString(nullptr, 0);
+  }
+  return o;
+}
+
+CE2MaterialObject * CE2MaterialDB::findMaterialObject(
+    const BSMaterialsCDB::MaterialObject *p)
+{
+  if (!p) [[unlikely]]
+    return nullptr;
+  {
+    const CE2MaterialObject *o = materialObjectMap.findObject(p->persistentID);
+    if (o)
+      return const_cast< CE2MaterialObject * >(o);
+  }
+  CE2MaterialObject *o = constructMaterialObject(p);
   if (!o) [[unlikely]]
     return nullptr;
-  o->cdbObject = p;
-  o->name = BSMaterialsCDB::storeString(nullptr, 0);
   materialObjectMap.storeObject(o);
   o->parent = findMaterialObject(p->parent);
   // load components
@@ -349,13 +502,161 @@ CE2MaterialObject * CE2MaterialDB::findMaterialObject(
   return o;
 }
 
+const CE2MaterialObject * CE2MaterialDB::findLoadedObject(
+    const BSMaterialsCDB::MaterialObject *p) const
+{
+  if (!p) [[unlikely]]
+    return nullptr;
+  return materialObjectMap.findObject(p->persistentID);
+}
+
+static void findLinkedObjects(
+    std::vector< const BSMaterialsCDB::MaterialObject * >& objects,
+    const BSMaterialsCDB::CDBObject *p)
+{
+  if (!p)
+    return;
+  if (p->type == BSReflStream::String_BSComponentDB2_ID)
+  {
+    objects.push_back(p->linkedObject());
+    return;
+  }
+  for (std::uint32_t i = 0U; i < p->childCnt; i++)
+    findLinkedObjects(objects, p->children()[i]);
+}
+
+void CE2MaterialDB::compileMaterialsThread(
+    CE2MaterialDB *cdb, CompileThreadData *threadData,
+    std::vector< CE2MaterialObject * > *objects,
+    std::atomic< size_t > *nextObject, std::exception_ptr *err)
+{
+  try
+  {
+    while (true)
+    {
+      size_t  i0 = nextObject->fetch_add(64, std::memory_order_relaxed);
+      if (i0 >= objects->size())
+        break;
+      size_t  i1 = std::min(i0 + 64, objects->size());
+      for (size_t i = i0; i < i1; i++)
+      {
+        CE2MaterialObject *o = (*objects)[i];
+        const BSMaterialsCDB::MaterialObject  *p = o->cdbObject;
+        o->parent = cdb->findLoadedObject(p->parent);
+        ComponentInfo componentInfo(*cdb, o, threadData);
+        for (const BSMaterialsCDB::MaterialComponent *
+                 q = p->components; q; q = q->next)
+        {
+          componentInfo.loadComponent(q);
+        }
+      }
+    }
+  }
+  catch (...)
+  {
+    *err = std::current_exception();
+    // make the other threads stop
+    nextObject->store(objects->size(), std::memory_order_relaxed);
+  }
+}
+
+void CE2MaterialDB::compileAllMaterials(int threadCnt)
+{
+  materialDBMutex.lock();
+  // construct all objects and store them in materialObjectMap first, so
+  // that the threads only need to search the map for linked objects
+  std::vector< CE2MaterialObject * >  objects;
+  bool    compileDone = false;
+  try
+  {
+    std::vector< const BSMaterialsCDB::MaterialObject * > objectStack;
+    BSMaterialsCDB::getMaterials(objectStack);
+    while (!objectStack.empty())
+    {
+      const BSMaterialsCDB::MaterialObject  *p = objectStack.back();
+      objectStack.pop_back();
+      if (!p || materialObjectMap.findObject(p->persistentID))
+        continue;
+      CE2MaterialObject *o = constructMaterialObject(p);
+      if (o)
+      {
+        materialObjectMap.storeObject(o);
+        objects.push_back(o);
+        objectStack.push_back(p->parent);
+        for (const BSMaterialsCDB::MaterialComponent *
+                 q = p->components; q; q = q->next)
+        {
+          findLinkedObjects(objectStack, q->o);
+        }
+      }
+      for (const BSMaterialsCDB::MaterialObject *
+               q = p->children; q; q = q->next)
+      {
+        objectStack.push_back(q);
+      }
+    }
+    ThreadPool& threadPool = ThreadPool::getDefaultPool();
+    if (threadCnt <= 0)
+      threadCnt = threadPool.getThreadCount();
+    threadCnt = std::min(std::max(threadCnt, 1), 64);
+    threadCnt = int(std::min(size_t(threadCnt), (objects.size() >> 6) + 1));
+    size_t  n = size_t(threadCnt);
+    std::vector< CompileThreadData >  threadData(n);
+    std::vector< std::exception_ptr > errors(n);
+    compileAllocBuffers.reserve(compileAllocBuffers.size() + n);
+    for (size_t i = 0; i < n; i++)
+    {
+      threadData[i].allocBuf = new AllocBuffers();
+      compileAllocBuffers.push_back(threadData[i].allocBuf);
+    }
+    // each index of the loop is a worker with its own allocation buffer
+    std::atomic< size_t > nextObject(0);
+    threadPool.parallelFor(
+        0, threadCnt, 1,
+        [&](int i0, int i1)
+        {
+          for (int i = i0; i < i1; i++)
+          {
+            compileMaterialsThread(this, &(threadData[i]), &objects,
+                                   &nextObject, &(errors[i]));
+          }
+        });
+    for (int i = 0; i < threadCnt; i++)
+    {
+      if (errors[i])
+        std::rethrow_exception(errors[i]);
+    }
+    compileDone = true;
+    for (size_t i = 0; i < objects.size(); i++)
+    {
+      if (objects[i]->type == 1)
+        loadedMaterialMap.storeObject(objects[i]);
+    }
+  }
+  catch (...)
+  {
+    // partially compiled objects must not be found by findMaterialObject()
+    if (!compileDone)
+    {
+      for (size_t i = 0; i < objects.size(); i++)
+        materialObjectMap.removeObject(objects[i]->cdbObject->persistentID);
+    }
+    materialDBMutex.unlock();
+    throw;
+  }
+  materialDBMutex.unlock();
+}
+
 CE2MaterialDB::CE2MaterialDB()
+  : materialListValid(false)
 {
   clear();
 }
 
 CE2MaterialDB::~CE2MaterialDB()
 {
+  for (size_t i = 0; i < compileAllocBuffers.size(); i++)
+    delete compileAllocBuffers[i];
 }
 
 static bool cdbFileNameFilterFunc(
@@ -364,7 +665,59 @@ static bool cdbFileNameFilterFunc(
   return (s.ends_with(".cdb") && s.starts_with("materials/"));
 }
 
-void CE2MaterialDB::loadArchives(const BA2File& archive)
+static void hashCDBFileData(std::uint64_t& h,
+                            const unsigned char *p, size_t nBytes)
+{
+  hashFunctionUInt64(h, nBytes);
+  while (nBytes > 0)
+  {
+    size_t  n = std::min< size_t >(nBytes, 0x00100000);
+    hashFunctionUInt64(h, hashFunctionUInt32(p, n));
+    p = p + n;
+    nBytes = nBytes - n;
+  }
+}
+
+// returns a hash of the names and contents of the CDB files
+static std::uint64_t getCDBInputHash(
+    const BA2File& ba2File, const std::vector< std::string_view >& cdbPaths)
+{
+  std::uint64_t h = 0xFFFFFFFFFFFFFFFFULL;
+  BA2File::UCharArray cdbBuf;
+  for (size_t i = 0; i < cdbPaths.size(); i++)
+  {
+    hashFunctionUInt64(h, hashFunctionUInt32(cdbPaths[i].data(),
+                                             cdbPaths[i].length()));
+    const BA2File::FileInfo *fd = ba2File.findFile(cdbPaths[i]);
+    if (!fd) [[unlikely]]
+      continue;
+    if (fd->archiveType < 0)
+    {
+      // loose file
+      std::string fullPath(reinterpret_cast< const char * >(fd->fileData),
+                           fd->packedSize);
+      FileBuffer  f(fullPath.c_str());
+      hashCDBFileData(h, f.data(), f.size());
+    }
+    else if (fd->archiveType == 0)
+    {
+      // BA2 archive, compressed data can be hashed without extracting it
+      hashFunctionUInt64(h, fd->unpackedSize);
+      hashCDBFileData(h, fd->fileData,
+                      (fd->packedSize ? fd->packedSize : fd->unpackedSize));
+    }
+    else
+    {
+      const unsigned char *cdbData = nullptr;
+      size_t  cdbSize = ba2File.extractFile(cdbData, cdbBuf, cdbPaths[i]);
+      hashCDBFileData(h, cdbData, cdbSize);
+    }
+  }
+  return h;
+}
+
+void CE2MaterialDB::loadArchives(const BA2File& archive,
+                                 const char *snapshotFileName)
 {
   if (ba2File && !parentDB)
     clear();
@@ -372,6 +725,10 @@ void CE2MaterialDB::loadArchives(const BA2File& archive)
   try
   {
     ba2File = &archive;
+    {
+      std::unique_lock< std::mutex >  lock(materialListMutex);
+      materialListValid = false;
+    }
     if (!ba2File) [[unlikely]]
     {
       materialDBMutex.unlock();
@@ -388,6 +745,28 @@ void CE2MaterialDB::loadArchives(const BA2File& archive)
         break;
       }
     }
+    bool    useSnapshot = (snapshotFileName && *snapshotFileName &&
+                           !parentDB && !matFileObjectMap.size);
+    std::uint64_t inputHash = 0;
+    if (useSnapshot)
+    {
+      inputHash = getCDBInputHash(archive, cdbPaths);
+      bool    snapshotLoaded = false;
+      try
+      {
+        snapshotLoaded = loadSnapshot(snapshotFileName, inputHash);
+      }
+      catch (FO76UtilsError&)
+      {
+        // invalid snapshot files are ignored, and replaced below
+      }
+      if (snapshotLoaded)
+      {
+        ba2File = &archive;
+        materialDBMutex.unlock();
+        return;
+      }
+    }
     for (size_t j = 0; j < cdbPaths.size(); j++)
     {
       const unsigned char *cdbData = nullptr;
@@ -395,6 +774,17 @@ void CE2MaterialDB::loadArchives(const BA2File& archive)
       if (cdbSize > 0)
         BSMaterialsCDB::loadCDBFile(cdbData, cdbSize);
     }
+    if (useSnapshot)
+    {
+      try
+      {
+        saveSnapshot(snapshotFileName, inputHash);
+      }
+      catch (FO76UtilsError&)
+      {
+        // the snapshot is only a cache, errors are not fatal
+      }
+    }
   }
   catch (...)
   {
@@ -404,24 +794,15 @@ void CE2MaterialDB::loadArchives(const BA2File& archive)
   materialDBMutex.unlock();
 }
 
-const CE2Material * CE2MaterialDB::loadMaterial(
-    const std::string_view& materialPath)
+size_t CE2MaterialDB::loadJSONFiles(
+    const std::vector< std::string_view >& materialPaths, int flags,
+    int threadCnt)
 {
-  if (materialPath.empty()) [[unlikely]]
-    return nullptr;
-  BSMaterialsCDB::BSResourceID  objectID(materialPath);
-  const CE2MaterialObject *o = nullptr;
+  size_t  loadCnt = 0;
   materialDBMutex.lock();
   try
   {
-    o = materialObjectMap.findObject(objectID);
-    if (!o) [[unlikely]]
-    {
-      const MaterialObject  *p = findMatFileObject(objectID);
-      if (!(p && p->isJSON()))
-        loadJSONFile(materialPath, objectID, 1);
-      o = findMaterialObject(BSMaterialsCDB::getMaterial(objectID));
-    }
+    loadCnt = BSMaterialsCDB::loadJSONFiles(materialPaths, flags, threadCnt);
   }
   catch (...)
   {
@@ -429,6 +810,41 @@ const CE2Material * CE2MaterialDB::loadMaterial(
     throw;
   }
   materialDBMutex.unlock();
+  return loadCnt;
+}
+
+const CE2Material * CE2MaterialDB::loadMaterial(
+    const std::string_view& materialPath)
+{
+  if (materialPath.empty()) [[unlikely]]
+    return nullptr;
+  BSMaterialsCDB::BSResourceID  objectID(materialPath);
+  const CE2MaterialObject *o = loadedMaterialMap.findObject(objectID);
+  if (!o) [[unlikely]]
+  {
+    materialDBMutex.lock();
+    try
+    {
+      o = materialObjectMap.findObject(objectID);
+      if (!o) [[unlikely]]
+      {
+        const MaterialObject  *p = findMatFileObject(objectID);
+        if (!(p && p->isJSON()))
+          loadJSONFile(materialPath, objectID, 1);
+        o = findMaterialObject(BSMaterialsCDB::getMaterial(objectID));
+      }
+      // findMaterialObject() has returned, so all objects referenced by
+      // 'o' are fully loaded
+      if (o)
+        loadedMaterialMap.storeObject(o);
+    }
+    catch (...)
+    {
+      materialDBMutex.unlock();
+      throw;
+    }
+    materialDBMutex.unlock();
+  }
   if (!(o && o->type == 1)) [[unlikely]]
     return nullptr;
   return static_cast< const CE2Material * >(o);
@@ -442,7 +858,17 @@ void CE2MaterialDB::clear()
     bool    constructFlag = !storedStdStrings.buf;
     storedStdStrings.clear();
     materialObjectMap.clear();
+    loadedMaterialMap.clear();
+    for (size_t i = 0; i < compileAllocBuffers.size(); i++)
+      delete compileAllocBuffers[i];
+    compileAllocBuffers.clear();
     stringBuf.clear();
+    {
+      std::unique_lock< std::mutex >  lock(materialListMutex);
+      materialListValid = false;
+      materialListCache.clear();
+      materialListBuf.clear();
+    }
     if (!constructFlag)
       BSMaterialsCDB::clear();
   }
@@ -7,6 +7,7 @@
 #include "bsmatcdb.hpp"
 
 #include <mutex>
+#include <atomic>
 
 // CE2Material (.mat file), object type 1
 //   |
@@ -528,11 +529,25 @@ struct CE2Material : public CE2MaterialObject   // object type 1
 class CE2MaterialDB : public BSMaterialsCDB
 {
  protected:
+  // per-thread data used by compileAllMaterials()
+  struct CompileThreadData
+  {
+    AllocBuffers  *allocBuf;
+    std::string stringBuf;
+  };
   struct ComponentInfo
   {
     CE2MaterialDB&  cdb;
     CE2MaterialObject *o;
     const BSMaterialsCDB::MaterialComponent *componentData;
+    // nullptr if not loading in parallel with compileAllMaterials()
+    CompileThreadData *threadData;
+    template< typename T > inline T *constructObject()
+    {
+      if (!threadData)
+        return cdb.constructObject< T >();
+      return threadData->allocBuf->constructObject< T >();
+    }
     inline bool readBool(bool& n,
                          const BSMaterialsCDB::CDBObject *p, size_t fieldNum);
     inline bool readUInt8(unsigned char& n,
@@ -662,9 +677,11 @@ class CE2MaterialDB : public BSMaterialsCDB
     void readLODMaterialID(const BSMaterialsCDB::CDBObject *p);
     void readMipBiasSetting(const BSMaterialsCDB::CDBObject *p);
     void loadComponent(const BSMaterialsCDB::MaterialComponent *p);
-    ComponentInfo(CE2MaterialDB& p, CE2MaterialObject *q)
+    ComponentInfo(CE2MaterialDB& p, CE2MaterialObject *q,
+                  CompileThreadData *t = nullptr)
       : cdb(p),
-        o(q)
+        o(q),
+        threadData(t)
     {
     }
   };
@@ -689,24 +706,96 @@ class CE2MaterialDB : public BSMaterialsCDB
     void clear();
     void storeObject(const CE2MaterialObject *o);
     inline const CE2MaterialObject *findObject(BSResourceID objectID) const;
+    void removeObject(BSResourceID objectID);
+    void expandBuffer();
+  };
+  // table of fully loaded materials that can be searched without locking
+  // materialDBMutex, new objects are stored with the mutex locked
+  struct CE2MatObjectAtomicMap
+  {
+    struct Table
+    {
+      std::atomic< const CE2MaterialObject * >  *buf;
+      size_t  hashMask;
+      // previous (smaller) table, readers may still be using it until clear()
+      Table   *prv;
+    };
+    std::atomic< Table * >  curTable;
+    size_t  size;
+    CE2MatObjectAtomicMap();
+    ~CE2MatObjectAtomicMap();
+    void clear();
+    void storeObject(const CE2MaterialObject *o);
+    inline const CE2MaterialObject *findObject(BSResourceID objectID) const;
     void expandBuffer();
   };
   std::mutex  materialDBMutex;
+  // locked by compileAllMaterials() threads when storing strings
+  std::mutex  stringBufMutex;
   CE2MatObjectHashMap materialObjectMap;
+  CE2MatObjectAtomicMap loadedMaterialMap;
   StoredStdStringHashMap  storedStdStrings;
   std::string stringBuf;
+  // buffers allocated by compileAllMaterials(), deleted by clear()
+  std::vector< AllocBuffers * > compileAllocBuffers;
+  // materials in the CDB files with known paths, sorted by path,
+  // created on the first call to getMaterialList()
+  typedef std::pair< BSResourceID, std::string_view > MaterialListEntry;
+  mutable std::mutex  materialListMutex;
+  mutable bool  materialListValid;
+  mutable std::vector< MaterialListEntry >  materialListCache;
+  mutable AllocBuffers  materialListBuf;
+  // defined in mat_list.cpp, requires materialListMutex to be locked
+  void updateMaterialListCache() const;
   inline const std::string_view *storeStdString(const std::string& s)
   {
     return storedStdStrings.insert(*this, s);
   }
+  // allocate object and initialize with defaults,
+  // returns nullptr if 'p' is not a supported material object type
+  CE2MaterialObject *constructMaterialObject(
+      const BSMaterialsCDB::MaterialObject *p);
   CE2MaterialObject *findMaterialObject(
       const BSMaterialsCDB::MaterialObject *p);
+  // returns an already constructed object without loading it
+  const CE2MaterialObject *findLoadedObject(
+      const BSMaterialsCDB::MaterialObject *p) const;
+  static void compileMaterialsThread(
+      CE2MaterialDB *cdb, CompileThreadData *threadData,
+      std::vector< CE2MaterialObject * > *objects,
+      std::atomic< size_t > *nextObject, std::exception_ptr *err);
  public:
   CE2MaterialDB();
   ~CE2MaterialDB();
-  void loadArchives(const BA2File& archive);
+  // If snapshotFileName is not nullptr, the CDB files are loaded from a
+  // snapshot (see BSMaterialsCDB::saveSnapshot()) when it exists and matches
+  // the current CDB files, otherwise the snapshot is created or updated
+  // after loading the CDB files. This is only done if the database is empty.
+  void loadArchives(const BA2File& archive,
+                    const char *snapshotFileName = nullptr);
+  // Load loose .mat files in parallel, see BSMaterialsCDB::loadJSONFiles().
+  // This locks materialDBMutex, so it can be used while other threads are
+  // calling loadMaterial().
+  size_t loadJSONFiles(const std::vector< std::string_view >& materialPaths,
+                       int flags = 0, int threadCnt = 0);
+  // loadMaterial() is thread-safe, and does not lock materialDBMutex if the
+  // material has already been loaded. clear() and loadArchives() must not be
+  // called while other threads are using the database
   const CE2Material *loadMaterial(const std::string_view& materialPath);
+  // load all materials from the database on at most threadCnt threads of
+  // ThreadPool::getDefaultPool() (threadCnt <= 0: use the number of threads
+  // of the pool), as an alternative to loading them individually with
+  // loadMaterial() when most are needed. Use scripts/matbench.cpp to compare
+  // the two on a given set of archives.
+  void compileAllMaterials(int threadCnt = 0);
   void clear();
+  // returns a sorted list of unique material paths, the strings are valid
+  // until the database is cleared or the archives are deleted
+  void getMaterialList(
+      std::vector< std::string_view >& materialPaths,
+      bool excludeJSONMaterials = false,
+      bool (*fileFilterFunc)(void *p, const std::string_view& s) = nullptr,
+      void *fileFilterFuncData = nullptr) const;
   // returns a set of null-terminated material paths, using 'buf' for storage
   void getMaterialList(
       std::set< std::string_view >& materialPaths, AllocBuffers& buf,
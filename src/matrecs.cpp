@@ -0,0 +1,188 @@
+
+#include "common.hpp"
+#include "matrecs.hpp"
+
+void CE2MaterialRecords::convertUVStream(
+    UVTransform& t, const CE2Material::UVStream *uvStream)
+{
+  if (!uvStream)
+    uvStream = &(CE2Material::defaultUVStream);
+  uvStream->scaleAndOffset.convertToFloats(t.scaleAndOffset);
+  t.textureAddressMode = uvStream->textureAddressMode;
+  t.channel = uvStream->channel;
+  t.padding[0] = 0;
+  t.padding[1] = 0;
+}
+
+std::uint32_t CE2MaterialRecords::findTexture(
+    const std::string_view *path, std::uint32_t replacementColor,
+    bool hasReplacement)
+{
+  TextureKey  k;
+  k.path = (path ? *path : std::string_view());
+  k.replacementColor = (hasReplacement ? replacementColor : 0U);
+  k.hasReplacement = hasReplacement;
+  if (k.path.empty() && !hasReplacement)
+    return 0U;
+  std::map< TextureKey, std::uint32_t >::const_iterator i =
+      textureMap.find(k);
+  if (i != textureMap.end())
+    return i->second;
+  std::uint32_t n = std::uint32_t(textures.size());
+  TextureRecord t;
+  std::memset(&t, 0, sizeof(TextureRecord));
+  if (!k.path.empty())
+  {
+    // CE2MaterialDB stores all paths as null-terminated strings
+    t.path = k.path.data();
+    t.pathLength = std::uint32_t(k.path.length());
+  }
+  t.replacementColor = k.replacementColor;
+  t.hasReplacement = hasReplacement;
+  textures.push_back(t);
+  textureMap.emplace(k, n);
+  return n;
+}
+
+CE2MaterialRecords::CE2MaterialRecords()
+{
+  clear();
+}
+
+int CE2MaterialRecords::addMaterial(const CE2Material *m)
+{
+  if (!m)
+    return -1;
+  std::map< const CE2Material *, std::uint32_t >::const_iterator  i =
+      materialMap.find(m);
+  if (i != materialMap.end())
+    return int(i->second);
+
+  MaterialRecord  r;
+  std::memset(&r, 0, sizeof(MaterialRecord));
+  r.flags = m->flags;
+  r.layerMask = m->layerMask;
+  r.firstLayer = std::uint32_t(layers.size());
+  r.firstBlender = std::uint32_t(blenders.size());
+  r.shaderModel = m->shaderModel;
+  r.shaderRoute = m->shaderRoute;
+  r.alphaSourceLayer = m->alphaSourceLayer;
+  r.alphaBlendMode = m->alphaBlendMode;
+  r.alphaVertexColorChannel = m->alphaVertexColorChannel;
+  r.physicsMaterialType = m->physicsMaterialType;
+  r.alphaThreshold = m->alphaThreshold;
+  r.alphaHeightBlendThreshold = m->alphaHeightBlendThreshold;
+  r.alphaHeightBlendFactor = m->alphaHeightBlendFactor;
+  r.alphaPosition = m->alphaPosition;
+  r.alphaContrast = m->alphaContrast;
+  r.specularOpacityOverride = m->specularOpacityOverride;
+  convertUVStream(r.alphaUVTransform, m->alphaUVStream);
+
+  for (size_t l = 0; l < CE2Material::maxLayers; l++)
+  {
+    if (!((m->layerMask >> l) & 1U))
+      continue;
+    const CE2Material::Layer  *layer = m->layers[l];
+    if (!layer)
+      layer = &(CE2Material::defaultLayer);
+    const CE2Material::Material *material = layer->material;
+    if (!material)
+      material = &(CE2Material::defaultMaterial);
+    const CE2Material::TextureSet *txtSet = material->textureSet;
+    if (!txtSet)
+      txtSet = &(CE2Material::defaultTextureSet);
+    LayerRecord q;
+    std::memset(&q, 0, sizeof(LayerRecord));
+    convertUVStream(q.uvTransform, layer->uvStream);
+    material->color.convertToFloats(q.color);
+    q.normalMapIntensity = txtSet->floatParam;
+    q.flipbookFPS = material->flipbookFPS;
+    for (size_t j = 0; j < maxTextures; j++)
+    {
+      q.textureIndices[j] =
+          findTexture(((txtSet->texturePathMask >> j) & 1U) ?
+                      txtSet->texturePaths[j] : nullptr,
+                      txtSet->textureReplacements[j],
+                      bool((txtSet->textureReplacementMask >> j) & 1U));
+    }
+    q.colorModeFlags = material->colorModeFlags;
+    q.flipbookFlags = material->flipbookFlags;
+    q.flipbookColumns = material->flipbookColumns;
+    q.flipbookRows = material->flipbookRows;
+    q.resolutionHint = txtSet->resolutionHint;
+    q.disableMipBiasHint = txtSet->disableMipBiasHint;
+    q.layerNum = (unsigned char) l;
+    layers.push_back(q);
+    r.layerCnt++;
+  }
+
+  for (size_t l = 0; l < CE2Material::maxBlenders; l++)
+  {
+    const CE2Material::Blender  *blender = m->blenders[l];
+    if (!blender)
+      continue;
+    BlenderRecord q;
+    std::memset(&q, 0, sizeof(BlenderRecord));
+    convertUVStream(q.uvTransform, blender->uvStream);
+    for (size_t j = 0; j < CE2Material::Blender::maxFloatParams; j++)
+      q.floatParams[j] = blender->floatParams[j];
+    q.textureIndex = findTexture(blender->texturePath,
+                                 blender->textureReplacement,
+                                 blender->textureReplacementEnabled);
+    for (size_t j = 0; j < CE2Material::Blender::maxBoolParams; j++)
+      q.boolParams |= (unsigned char) (int(blender->boolParams[j]) << j);
+    q.blendMode = blender->blendMode;
+    q.colorChannel = blender->colorChannel;
+    q.blenderNum = (unsigned char) l;
+    blenders.push_back(q);
+    r.blenderCnt++;
+  }
+
+  std::uint32_t n = std::uint32_t(materials.size());
+  materials.push_back(r);
+  sourceMaterials.push_back(m);
+  materialMap.emplace(m, n);
+  return int(n);
+}
+
+size_t CE2MaterialRecords::addMaterials(
+    CE2MaterialDB& materialDB,
+    const std::vector< std::string_view >& materialPaths,
+    std::vector< int > *materialIndices)
+{
+  size_t  n = 0;
+  if (materialIndices)
+    materialIndices->resize(materialPaths.size());
+  for (size_t i = 0; i < materialPaths.size(); i++)
+  {
+    int     k = addMaterial(materialDB.loadMaterial(materialPaths[i]));
+    if (materialIndices)
+      (*materialIndices)[i] = k;
+    n += size_t(k >= 0);
+  }
+  return n;
+}
+
+int CE2MaterialRecords::findMaterial(const CE2Material *m) const
+{
+  std::map< const CE2Material *, std::uint32_t >::const_iterator  i =
+      materialMap.find(m);
+  if (i == materialMap.end())
+    return -1;
+  return int(i->second);
+}
+
+void CE2MaterialRecords::clear()
+{
+  materialMap.clear();
+  textureMap.clear();
+  materials.clear();
+  layers.clear();
+  blenders.clear();
+  textures.clear();
+  sourceMaterials.clear();
+  TextureRecord t;
+  std::memset(&t, 0, sizeof(TextureRecord));
+  textures.push_back(t);
+}
+
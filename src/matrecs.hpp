@@ -0,0 +1,146 @@
+
+#ifndef MATRECS_HPP_INCLUDED
+#define MATRECS_HPP_INCLUDED
+
+#include "common.hpp"
+#include "material.hpp"
+
+// Flattened, render-ready copy of compiled CE2Material objects. Each material
+// is converted to a fixed size POD record, and its layers and blenders are
+// stored in contiguous arrays, with texture paths and replacement colors
+// resolved to indices into a deduplicated texture table. The material, layer
+// and blender records contain only numbers and indices, and can be copied
+// directly to GPU or other renderer buffers. The texture table contains host
+// pointers to the path strings, and is only intended for loading textures on
+// the CPU side. The strings remain owned by the CE2MaterialDB the materials
+// were loaded from, and are valid until the database is cleared or destroyed.
+class CE2MaterialRecords
+{
+ public:
+  enum
+  {
+    maxTextures = CE2Material::TextureSet::maxTexturePaths
+  };
+  struct UVTransform
+  {
+    // U scale, V scale, U offset, V offset
+    float   scaleAndOffset[4];
+    // 0 = "Wrap", 1 = "Clamp", 2 = "Mirror", 3 = "Border"
+    unsigned char textureAddressMode;
+    // 1 = "One" (default), 2 = "Two"
+    unsigned char channel;
+    unsigned char padding[2];
+  };
+  struct TextureRecord
+  {
+    // null-terminated path, or nullptr if there is no texture file
+    const char  *path;
+    std::uint32_t pathLength;
+    // R8G8B8A8 color to use if the texture file is missing or cannot be
+    // loaded, valid if hasReplacement is true
+    std::uint32_t replacementColor;
+    bool    hasReplacement;
+    unsigned char padding[7];
+  };
+  struct LayerRecord
+  {
+    UVTransform uvTransform;
+    float   color[4];                   // CE2Material::Material::color
+    float   normalMapIntensity;         // CE2Material::TextureSet::floatParam
+    float   flipbookFPS;
+    // indices into textures, 0 if the texture is not present,
+    // see CE2Material::TextureSet::texturePaths for the meaning of each slot
+    std::uint32_t textureIndices[maxTextures];
+    unsigned char colorModeFlags;
+    unsigned char flipbookFlags;
+    unsigned char flipbookColumns;
+    unsigned char flipbookRows;
+    unsigned char resolutionHint;
+    bool    disableMipBiasHint;
+    // index of the layer in CE2Material::layers
+    unsigned char layerNum;
+    unsigned char padding;
+  };
+  struct BlenderRecord
+  {
+    UVTransform uvTransform;
+    float   floatParams[CE2Material::Blender::maxFloatParams];
+    std::uint32_t textureIndex;
+    // bit N = CE2Material::Blender::boolParams[N]
+    unsigned char boolParams;
+    unsigned char blendMode;
+    unsigned char colorChannel;
+    // index of the blender in CE2Material::blenders
+    unsigned char blenderNum;
+  };
+  struct MaterialRecord
+  {
+    std::uint32_t flags;                // CE2Material::flags
+    std::uint32_t layerMask;
+    // index of the first layer in layers, followed by layerCnt more
+    std::uint32_t firstLayer;
+    std::uint32_t firstBlender;
+    unsigned char layerCnt;
+    unsigned char blenderCnt;
+    unsigned char shaderModel;
+    unsigned char shaderRoute;
+    unsigned char alphaSourceLayer;
+    unsigned char alphaBlendMode;
+    unsigned char alphaVertexColorChannel;
+    unsigned char physicsMaterialType;
+    float   alphaThreshold;
+    float   alphaHeightBlendThreshold;
+    float   alphaHeightBlendFactor;
+    float   alphaPosition;
+    float   alphaContrast;
+    float   specularOpacityOverride;
+    UVTransform alphaUVTransform;
+  };
+ protected:
+  struct TextureKey
+  {
+    std::string_view  path;
+    std::uint32_t replacementColor;
+    bool    hasReplacement;
+    inline bool operator<(const TextureKey& r) const
+    {
+      if (path != r.path)
+        return (path < r.path);
+      if (hasReplacement != r.hasReplacement)
+        return r.hasReplacement;
+      return (hasReplacement && replacementColor < r.replacementColor);
+    }
+  };
+  std::map< const CE2Material *, std::uint32_t >  materialMap;
+  std::map< TextureKey, std::uint32_t > textureMap;
+  static void convertUVStream(UVTransform& t,
+                              const CE2Material::UVStream *uvStream);
+  std::uint32_t findTexture(const std::string_view *path,
+                            std::uint32_t replacementColor,
+                            bool hasReplacement);
+ public:
+  // the following arrays can be accessed directly, element i of materials
+  // is the record of sourceMaterials[i]
+  std::vector< MaterialRecord > materials;
+  std::vector< LayerRecord >    layers;
+  std::vector< BlenderRecord >  blenders;
+  // textures[0] is a dummy entry with no path and no replacement color
+  std::vector< TextureRecord >  textures;
+  std::vector< const CE2Material * >  sourceMaterials;
+  CE2MaterialRecords();
+  // returns the index of the material record, or -1 if m is nullptr;
+  // materials that have already been added are not converted again
+  int addMaterial(const CE2Material *m);
+  // load and add all materials in materialPaths, returns the number of
+  // materials found, the indices are stored in materialIndices if it is
+  // not nullptr (-1 for materials that cannot be loaded)
+  size_t addMaterials(CE2MaterialDB& materialDB,
+                      const std::vector< std::string_view >& materialPaths,
+                      std::vector< int > *materialIndices = nullptr);
+  // returns -1 if the material has not been added
+  int findMaterial(const CE2Material *m) const;
+  void clear();
+};
+
+#endif
+
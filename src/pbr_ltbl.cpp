@@ -0,0 +1,6152 @@
+
+#ifndef PBR_LTBL_CPP_INCLUDED
+#define PBR_LTBL_CPP_INCLUDED
+
+// generated by scripts/make_lut.cpp
+
+static const size_t pbr_lut_data_size = 2097300;
+
+static const unsigned char pbr_lut_data_zlib[101236] =
+{
+  120, 218, 236, 189, 119, 116, 214, 215, 185, 46, 8, 184, 231, 36, 206, 153,
+  249, 227, 222, 153, 53, 107, 205, 186, 231, 143, 59, 107, 205, 154, 187,
+  214, 189, 51, 179, 166, 159, 147, 158, 115, 210, 155, 83, 237, 20, 199, 177,
+  227, 56, 137, 123, 1, 7, 140, 193, 166, 247, 142, 0, 129, 64, 136, 222, 213,
+  11, 2, 129, 104, 146, 64, 32, 64, 168, 162, 250, 73, 95, 239, 69, 18, 117,
+  118, 223, 239, 187, 247, 254, 125, 194, 105, 39, 51, 199, 178, 12, 137, 209,
+  239, 147, 248, 158, 253, 190, 251, 173, 207, 243, 165, 47, 61, 245, 31, 102,
+  77, 153, 50, 229, 211, 127, 63, 109, 202, 20, 242, 201, 254, 253, 251, 41,
+  236, 99, 234, 148, 143, 246, 241, 31, 200, 191, 15, 147, 127, 191, 244, 227,
+  255, 249, 191, 184, 254, 252, 241, 191, 255, 156, 245, 223, 62, 65, 254,
+  125, 104, 10, 254, 126, 153, 64, 48, 24, 12, 5, 67, 225, 80, 56, 28, 142,
+  144, 143, 104, 36, 26, 141, 197, 162, 241, 88, 44, 78, 62, 18, 244, 35, 153,
+  72, 38, 147, 169, 100, 138, 124, 164, 83, 105, 250, 145, 201, 144, 207, 76,
+  146, 62, 26, 162, 15, 178, 71, 217, 147, 228, 89, 254, 100, 60, 17, 23, 79,
+  138, 103, 211, 252, 97, 246, 36, 253, 8, 211, 103, 209, 195, 236, 233, 56,
+  253, 39, 193, 158, 22, 143, 243, 239, 76, 158, 21, 143, 211, 23, 136, 4,
+  249, 247, 86, 207, 211, 199, 213, 11, 168, 159, 156, 127, 123, 244, 253,
+  195, 126, 191, 63, 224, 15, 6, 2, 236, 175, 13, 95, 0, 252, 248, 177, 4,
+  250, 171, 199, 135, 125, 62, 223, 200, 200, 200, 232, 136, 127, 148, 62,
+  30, 8, 4, 196, 183, 39, 143, 71, 194, 234, 187, 243, 191, 122, 160, 191,
+  127, 96, 96, 96, 112, 112, 104, 104, 104, 88, 62, 56, 58, 74, 191, 107, 32,
+  24, 144, 239, 117, 36, 50, 216, 213, 213, 221, 221, 211, 211, 123, 243, 230,
+  205, 190, 62, 246, 132, 122, 128, 125, 249, 208, 229, 182, 182, 171, 215,
+  174, 95, 191, 113, 227, 70, 71, 39, 249, 210, 238, 94, 242, 165, 125, 244,
+  181, 123, 27, 207, 158, 59, 119, 161, 169, 165, 229, 98, 107, 43, 249, 162,
+  107, 215, 218, 219, 59, 58, 170, 75, 43, 42, 171, 106, 235, 234, 79, 158,
+  58, 125, 230, 236, 249, 166, 242, 141, 91, 182, 109, 47, 217, 179, 255, 224,
+  209, 210, 99, 175, 189, 51, 115, 238, 130, 101, 171, 55, 124, 237, 243, 223,
+  248, 209, 179, 191, 123, 123, 206, 226, 117, 91, 247, 148, 214, 157, 189,
+  220, 53, 28, 201, 125, 140, 255, 223, 42, 254, 131, 87, 62, 198, 255, 99,
+  252, 63, 198, 255, 99, 255, 255, 49, 254, 255, 127, 199, 191, 191, 239, 99,
+  252, 63, 198, 255, 95, 3, 255, 116, 208, 192, 159, 225, 240, 49, 254, 255,
+  86, 240, 79, 133, 248, 59, 105, 226, 47, 222, 198, 143, 241, 255, 235, 224,
+  79, 31, 153, 4, 127, 246, 165, 127, 20, 254, 175, 191, 237, 141, 127, 146,
+  252, 60, 10, 197, 143, 241, 255, 55, 135, 127, 34, 12, 222, 7, 133, 191,
+  122, 27, 63, 198, 255, 207, 142, 127, 40, 248, 209, 241, 239, 234, 252, 19,
+  240, 47, 125, 45, 15, 254, 177, 72, 72, 191, 145, 145, 112, 244, 99, 252,
+  63, 18, 254, 4, 202, 143, 134, 63, 117, 183, 31, 9, 255, 246, 246, 63, 51,
+  254, 239, 188, 15, 241, 15, 199, 66, 242, 32, 179, 163, 28, 253, 24, 255,
+  191, 33, 252, 175, 93, 101, 248, 119, 118, 230, 197, 255, 250, 245, 63, 30,
+  255, 96, 156, 252, 45, 68, 252, 71, 255, 38, 15, 136, 63, 3, 241, 223, 8,
+  254, 169, 228, 223, 22, 254, 131, 61, 103, 206, 156, 59, 127, 190, 185, 153,
+  226, 127, 229, 202, 213, 171, 10, 255, 234, 154, 186, 19, 39, 92, 248, 207,
+  154, 195, 240, 255, 194, 55, 126, 248, 203, 223, 50, 252, 247, 30, 19, 248,
+  143, 36, 195, 33, 241, 23, 241, 196, 31, 160, 240, 49, 254, 127, 26, 254,
+  234, 167, 254, 107, 224, 191, 99, 167, 3, 255, 223, 189, 141, 240, 31, 76,
+  71, 36, 252, 240, 125, 84, 32, 38, 226, 73, 111, 252, 3, 252, 29, 12, 69,
+  254, 82, 248, 99, 207, 243, 111, 16, 127, 122, 183, 187, 241, 191, 208, 4,
+  240, 39, 33, 2, 199, 255, 120, 253, 71, 196, 255, 102, 54, 74, 255, 22, 228,
+  39, 10, 69, 92, 248, 199, 19, 222, 248, 39, 196, 59, 40, 223, 131, 7, 198,
+  63, 157, 253, 87, 198, 159, 2, 24, 248, 35, 240, 103, 192, 60, 56, 254, 195,
+  67, 31, 1, 255, 193, 129, 63, 13, 255, 178, 114, 132, 127, 193, 102, 141,
+  255, 59, 51, 231, 44, 92, 234, 198, 191, 43, 23, 11, 135, 194, 162, 252,
+  67, 195, 63, 47, 16, 255, 100, 252, 181, 3, 127, 80, 252, 147, 137, 255,
+  207, 225, 79, 191, 57, 196, 223, 55, 252, 209, 241, 103, 95, 79, 240, 167,
+  208, 254, 105, 248, 151, 236, 150, 248, 207, 93, 64, 240, 255, 250, 231,
+  57, 254, 75, 214, 106, 252, 175, 143, 199, 35, 194, 251, 3, 28, 98, 252,
+  175, 194, 223, 5, 9, 162, 184, 133, 255, 198, 241, 143, 199, 254, 12, 248,
+  163, 208, 247, 1, 240, 103, 63, 253, 159, 138, 63, 123, 226, 79, 198, 255,
+  100, 3, 194, 255, 208, 17, 132, 63, 205, 255, 9, 254, 219, 246, 72, 252,
+  91, 111, 199, 163, 225, 176, 126, 23, 34, 232, 109, 76, 124, 20, 252, 229,
+  123, 240, 175, 130, 127, 52, 242, 199, 225, 15, 2, 159, 63, 14, 127, 22,
+  251, 184, 240, 31, 26, 180, 240, 15, 6, 44, 252, 123, 123, 62, 58, 254, 189,
+  141, 2, 255, 75, 151, 242, 224, 191, 101, 43, 199, 191, 236, 152, 192, 127,
+  227, 215, 190, 240, 117, 94, 255, 97, 248, 159, 107, 165, 248, 95, 184, 155,
+  140, 134, 133, 245, 115, 71, 22, 137, 169, 191, 9, 199, 95, 190, 137, 14,
+  252, 145, 15, 252, 11, 225, 159, 74, 254, 133, 240, 15, 5, 31, 0, 127, 242,
+  19, 60, 40, 254, 242, 242, 113, 226, 79, 2, 71, 136, 63, 121, 195, 62, 18,
+  254, 228, 107, 39, 193, 191, 166, 148, 224, 79, 243, 127, 142, 127, 197,
+  70, 138, 255, 158, 125, 4, 127, 145, 255, 175, 218, 168, 242, 63, 138, 255,
+  241, 179, 151, 59, 9, 254, 167, 239, 167, 162, 81, 13, 191, 42, 255, 193,
+  119, 145, 188, 9, 12, 132, 100, 154, 131, 152, 193, 248, 203, 26, 232, 71,
+  192, 63, 147, 253, 11, 225, 175, 27, 151, 241, 191, 61, 252, 213, 99, 44,
+  214, 30, 98, 69, 253, 94, 209, 213, 243, 194, 159, 228, 118, 55, 58, 58,
+  36, 254, 125, 116, 82, 132, 224, 127, 246, 172, 137, 127, 103, 53, 192, 159,
+  156, 142, 10, 158, 255, 115, 252, 73, 252, 71, 227, 127, 121, 255, 203, 250,
+  15, 197, 255, 248, 148, 116, 156, 252, 229, 195, 16, 67, 110, 70, 102, 16,
+  68, 223, 68, 254, 30, 102, 210, 60, 135, 75, 216, 157, 99, 137, 127, 44,
+  225, 192, 63, 149, 118, 224, 15, 146, 199, 191, 28, 254, 250, 103, 207, 139,
+  127, 44, 250, 160, 248, 83, 75, 6, 223, 222, 198, 159, 68, 115, 4, 255, 225,
+  225, 63, 5, 127, 94, 255, 207, 139, 255, 101, 150, 36, 96, 252, 27, 27, 53,
+  254, 56, 254, 227, 254, 31, 225, 95, 49, 45, 27, 39, 65, 127, 56, 162, 99,
+  56, 110, 5, 113, 227, 254, 79, 229, 199, 95, 116, 14, 64, 232, 248, 215,
+  195, 31, 70, 96, 15, 142, 63, 232, 123, 139, 147, 15, 111, 190, 201, 241,
+  215, 93, 179, 112, 94, 252, 71, 72, 62, 55, 226, 196, 191, 187, 171, 167,
+  155, 226, 79, 81, 125, 16, 252, 111, 246, 146, 175, 28, 232, 87, 248, 95,
+  188, 40, 240, 39, 119, 68, 39, 168, 255, 50, 252, 117, 254, 87, 198, 252,
+  63, 193, 255, 27, 212, 254, 127, 75, 239, 127, 30, 255, 83, 252, 15, 63,
+  148, 75, 198, 168, 3, 136, 136, 119, 49, 34, 156, 160, 126, 23, 237, 252,
+  47, 163, 240, 55, 223, 3, 233, 58, 116, 234, 144, 144, 0, 254, 107, 224,
+  175, 66, 87, 55, 254, 242, 244, 78, 138, 191, 143, 193, 40, 240, 39, 113,
+  252, 36, 248, 15, 48, 52, 13, 252, 3, 126, 141, 63, 125, 138, 225, 79, 140,
+  90, 88, 181, 200, 24, 242, 224, 79, 142, 10, 197, 31, 214, 255, 21, 254,
+  29, 102, 254, 199, 239, 127, 22, 255, 151, 241, 250, 207, 170, 141, 202,
+  255, 203, 248, 127, 40, 146, 219, 243, 240, 120, 146, 58, 128, 72, 4, 69,
+  81, 56, 9, 214, 241, 31, 194, 63, 142, 222, 3, 35, 3, 151, 161, 227, 95,
+  25, 127, 116, 114, 31, 20, 127, 71, 228, 139, 66, 159, 143, 134, 127, 176,
+  111, 64, 88, 243, 16, 192, 95, 248, 13, 128, 127, 87, 151, 133, 63, 11, 24,
+  4, 254, 195, 178, 255, 219, 206, 240, 103, 174, 162, 143, 247, 127, 64, 254,
+  103, 225, 175, 227, 63, 120, 255, 67, 251, 103, 254, 95, 226, 95, 244, 232,
+  68, 42, 30, 99, 7, 32, 226, 120, 23, 89, 253, 79, 220, 255, 8, 67, 10, 97,
+  28, 103, 208, 238, 212, 193, 129, 63, 1, 16, 224, 111, 92, 60, 127, 41, 252,
+  211, 169, 73, 241, 199, 157, 15, 144, 250, 8, 252, 71, 101, 28, 111, 226,
+  143, 187, 230, 8, 127, 223, 112, 30, 252, 89, 82, 231, 196, 159, 124, 155,
+  97, 93, 255, 55, 230, 191, 110, 54, 154, 249, 63, 193, 223, 140, 255, 93,
+  254, 95, 222, 255, 107, 217, 253, 223, 74, 241, 223, 248, 216, 237, 116,
+  130, 192, 38, 208, 55, 194, 127, 240, 38, 202, 247, 80, 247, 127, 179, 241,
+  160, 5, 97, 204, 196, 63, 145, 116, 157, 157, 191, 25, 252, 89, 229, 219,
+  27, 127, 241, 188, 3, 255, 96, 208, 53, 53, 197, 46, 159, 32, 137, 230, 6,
+  65, 253, 223, 7, 227, 6, 27, 127, 48, 255, 61, 72, 47, 12, 246, 141, 40,
+  254, 94, 249, 63, 193, 223, 142, 255, 9, 254, 226, 254, 231, 241, 127, 165,
+  240, 255, 4, 255, 242, 87, 69, 252, 111, 216, 63, 193, 63, 154, 93, 249,
+  248, 157, 12, 185, 0, 162, 81, 86, 250, 5, 238, 223, 104, 255, 193, 28, 10,
+  230, 127, 65, 213, 57, 252, 35, 240, 15, 134, 255, 186, 248, 211, 87, 8,
+  115, 7, 174, 74, 113, 33, 252, 2, 30, 248, 115, 24, 45, 252, 157, 83, 179,
+  65, 143, 254, 15, 255, 174, 172, 232, 100, 226, 111, 247, 127, 70, 3, 67,
+  147, 226, 207, 226, 63, 133, 191, 190, 255, 105, 252, 87, 73, 236, 159, 251,
+  255, 210, 114, 150, 255, 17, 251, 255, 38, 193, 95, 218, 191, 140, 255, 22,
+  62, 113, 55, 75, 46, 128, 88, 36, 42, 172, 31, 161, 144, 231, 14, 87, 247,
+  63, 126, 15, 204, 210, 129, 133, 191, 152, 29, 201, 10, 252, 225, 225, 249,
+  51, 225, 111, 30, 63, 246, 124, 242, 79, 193, 63, 33, 96, 100, 247, 178,
+  42, 228, 193, 191, 187, 10, 155, 201, 195, 121, 240, 151, 69, 71, 250, 45,
+  135, 59, 141, 250, 143, 217, 255, 113, 228, 127, 162, 254, 195, 250, 191,
+  40, 254, 187, 209, 105, 248, 127, 102, 255, 220, 255, 151, 75, 255, 47, 240,
+  159, 205, 237, 255, 12, 195, 255, 253, 39, 238, 141, 165, 18, 36, 2, 136,
+  178, 55, 128, 221, 224, 174, 38, 74, 202, 137, 127, 48, 100, 197, 255, 24,
+  127, 248, 44, 170, 29, 102, 51, 104, 236, 36, 130, 2, 207, 252, 248, 211,
+  79, 137, 127, 56, 244, 0, 248, 235, 239, 159, 74, 103, 194, 163, 147, 224,
+  31, 143, 61, 32, 254, 198, 214, 132, 3, 127, 187, 254, 175, 231, 63, 9, 254,
+  50, 255, 115, 231, 255, 50, 254, 51, 242, 63, 242, 133, 240, 254, 87, 241,
+  31, 181, 255, 42, 128, 191, 182, 255, 10, 130, 63, 141, 255, 55, 124, 139,
+  225, 255, 150, 180, 127, 118, 255, 191, 243, 119, 247, 198, 211, 201, 120,
+  60, 170, 62, 98, 238, 247, 64, 250, 127, 101, 195, 89, 134, 63, 116, 225,
+  38, 254, 114, 116, 192, 136, 29, 76, 252, 81, 223, 225, 175, 133, 127, 16,
+  116, 112, 88, 238, 235, 76, 32, 13, 252, 141, 254, 63, 190, 251, 84, 239,
+  48, 168, 243, 127, 103, 255, 39, 40, 240, 199, 241, 95, 191, 133, 191, 246,
+  255, 32, 254, 167, 249, 159, 125, 255, 19, 252, 107, 75, 145, 255, 175, 146,
+  247, 255, 145, 178, 138, 87, 133, 255, 71, 248, 215, 18, 255, 79, 240, 127,
+  249, 239, 166, 76, 100, 82, 228, 167, 142, 69, 165, 243, 135, 215, 191, 209,
+  254, 231, 46, 84, 248, 224, 108, 12, 216, 191, 222, 28, 50, 60, 120, 126,
+  252, 67, 225, 60, 248, 243, 254, 191, 39, 254, 250, 252, 192, 10, 92, 94,
+  252, 211, 41, 130, 127, 192, 111, 224, 31, 49, 202, 87, 234, 239, 110, 225,
+  111, 213, 127, 93, 243, 191, 50, 254, 215, 249, 191, 89, 255, 99, 71, 46,
+  111, 252, 143, 241, 55, 239, 127, 236, 255, 249, 253, 95, 139, 237, 191,
+  106, 35, 139, 255, 185, 253, 11, 252, 191, 253, 249, 175, 75, 252, 119, 83,
+  251, 167, 248, 63, 255, 201, 169, 183, 178, 228, 2, 136, 51, 199, 47, 225,
+  135, 239, 161, 44, 255, 235, 20, 218, 233, 255, 117, 14, 100, 149, 14, 13,
+  223, 33, 241, 7, 135, 39, 28, 5, 239, 160, 21, 61, 2, 252, 51, 105, 55, 254,
+  209, 200, 131, 225, 207, 227, 127, 129, 63, 238, 94, 98, 7, 146, 128, 163,
+  47, 31, 109, 254, 35, 168, 188, 57, 204, 255, 80, 253, 135, 214, 255, 134,
+  59, 173, 253, 31, 25, 255, 179, 252, 207, 119, 217, 227, 254, 31, 232, 147,
+  246, 175, 253, 255, 141, 78, 211, 254, 153, 255, 103, 241, 191, 192, 127,
+  213, 134, 239, 124, 254, 27, 63, 96, 248, 175, 97, 247, 63, 241, 255, 225,
+  220, 51, 159, 156, 118, 59, 71, 47, 128, 88, 44, 166, 208, 247, 124, 15,
+  209, 248, 71, 38, 22, 68, 87, 184, 3, 65, 19, 255, 84, 70, 61, 156, 13, 217,
+  193, 67, 52, 255, 183, 246, 196, 31, 157, 62, 1, 159, 141, 63, 255, 225,
+  249, 252, 23, 192, 63, 108, 135, 175, 22, 254, 121, 235, 63, 232, 246, 137,
+  79, 22, 255, 43, 167, 103, 221, 255, 32, 254, 163, 247, 140, 143, 218, 255,
+  85, 85, 255, 129, 247, 63, 177, 255, 115, 60, 254, 7, 254, 31, 217, 255,
+  133, 106, 229, 255, 75, 43, 222, 120, 155, 227, 255, 93, 106, 255, 191, 21,
+  248, 215, 50, 251, 207, 126, 239, 147, 15, 221, 25, 75, 51, 7, 64, 15, 64,
+  12, 92, 161, 70, 10, 167, 83, 104, 89, 194, 179, 253, 63, 61, 64, 241, 152,
+  85, 63, 117, 228, 142, 54, 254, 145, 216, 159, 21, 127, 199, 0, 41, 192,
+  63, 255, 252, 95, 76, 251, 190, 4, 192, 223, 179, 254, 99, 212, 255, 30,
+  16, 127, 228, 255, 97, 252, 231, 27, 229, 254, 95, 218, 63, 247, 255, 188,
+  254, 67, 235, 255, 218, 254, 117, 255, 167, 163, 78, 196, 255, 204, 254,
+  207, 53, 85, 243, 248, 159, 249, 127, 137, 255, 247, 62, 255, 245, 31, 60,
+  251, 91, 18, 255, 175, 45, 220, 115, 148, 198, 255, 131, 145, 236, 87, 62,
+  245, 240, 157, 241, 108, 138, 56, 0, 122, 0, 16, 252, 250, 45, 76, 224, 244,
+  79, 186, 240, 104, 208, 57, 57, 46, 111, 112, 43, 255, 131, 189, 35, 7, 254,
+  147, 184, 111, 88, 62, 54, 241, 55, 199, 183, 92, 3, 36, 16, 255, 201, 250,
+  191, 198, 252, 191, 17, 255, 123, 213, 127, 20, 254, 3, 253, 86, 255, 207,
+  140, 255, 53, 254, 186, 254, 131, 227, 63, 98, 255, 30, 254, 191, 191, 145,
+  219, 191, 140, 255, 152, 255, 103, 248, 215, 168, 251, 223, 198, 127, 245,
+  250, 167, 62, 71, 252, 63, 177, 255, 69, 28, 127, 98, 255, 225, 220, 103,
+  158, 124, 248, 222, 56, 185, 0, 18, 226, 0, 72, 4, 140, 25, 108, 108, 194,
+  2, 194, 104, 8, 219, 63, 138, 255, 249, 251, 239, 153, 59, 66, 252, 241,
+  240, 152, 85, 190, 113, 148, 143, 254, 28, 248, 91, 253, 31, 103, 255, 151,
+  5, 160, 102, 252, 239, 204, 255, 84, 238, 16, 130, 247, 63, 236, 255, 201,
+  199, 184, 197, 248, 12, 255, 47, 239, 127, 141, 63, 181, 127, 21, 255, 203,
+  254, 15, 121, 105, 195, 254, 121, 252, 119, 92, 227, 79, 239, 255, 154, 130,
+  205, 12, 127, 122, 255, 191, 73, 240, 159, 79, 240, 255, 62, 179, 255, 183,
+  102, 19, 255, 191, 155, 225, 79, 236, 255, 127, 251, 212, 35, 247, 39, 114,
+  153, 84, 66, 28, 128, 184, 97, 254, 222, 24, 100, 51, 209, 96, 208, 12, 160,
+  245, 230, 168, 81, 127, 177, 241, 23, 239, 159, 53, 60, 248, 192, 248, 163,
+  195, 103, 155, 175, 153, 64, 58, 241, 55, 235, 191, 238, 254, 159, 71, 252,
+  143, 203, 87, 202, 123, 133, 12, 255, 111, 215, 255, 89, 252, 239, 233, 255,
+  197, 253, 63, 2, 237, 95, 197, 255, 212, 255, 83, 251, 39, 241, 191, 186,
+  255, 153, 253, 83, 252, 171, 132, 255, 39, 246, 95, 187, 81, 227, 255, 214,
+  219, 127, 96, 254, 95, 226, 191, 72, 224, 223, 49, 20, 206, 254, 79, 79,
+  62, 50, 229, 214, 88, 134, 54, 185, 232, 1, 136, 75, 235, 143, 35, 15, 232,
+  74, 255, 50, 217, 136, 217, 64, 85, 49, 16, 242, 255, 114, 116, 68, 221,
+  29, 172, 253, 151, 53, 130, 199, 63, 5, 127, 35, 255, 131, 227, 71, 234,
+  251, 3, 252, 63, 122, 253, 15, 197, 127, 15, 16, 255, 171, 252, 63, 207,
+  253, 239, 235, 156, 204, 255, 27, 246, 175, 252, 255, 128, 244, 255, 60,
+  254, 231, 246, 95, 47, 241, 231, 241, 95, 29, 201, 255, 182, 115, 252, 203,
+  223, 22, 246, 255, 195, 207, 73, 252, 137, 255, 175, 229, 248, 255, 195,
+  147, 143, 78, 185, 61, 158, 77, 147, 191, 100, 60, 193, 144, 139, 197, 227,
+  186, 246, 235, 12, 255, 41, 0, 116, 132, 47, 162, 223, 64, 150, 193, 225,
+  209, 1, 143, 213, 1, 209, 59, 202, 100, 100, 246, 5, 235, 191, 49, 71, 245,
+  248, 163, 227, 175, 226, 191, 36, 140, 63, 197, 11, 68, 92, 245, 159, 73,
+  234, 127, 201, 97, 171, 254, 159, 39, 254, 55, 252, 191, 125, 255, 11, 252,
+  149, 253, 163, 248, 95, 249, 127, 106, 255, 215, 174, 106, 251, 23, 241,
+  31, 249, 194, 254, 51, 103, 180, 255, 151, 246, 47, 240, 63, 126, 82, 226,
+  191, 101, 43, 201, 255, 216, 253, 207, 241, 95, 181, 225, 71, 4, 255, 95,
+  112, 252, 119, 51, 252, 7, 195, 217, 127, 255, 228, 99, 83, 238, 140, 147,
+  11, 128, 96, 197, 174, 128, 184, 130, 31, 121, 112, 48, 65, 167, 34, 248,
+  176, 99, 252, 215, 101, 63, 78, 231, 145, 9, 25, 254, 27, 85, 223, 172, 206,
+  211, 71, 198, 223, 200, 93, 148, 3, 138, 56, 243, 127, 115, 124, 201, 129,
+  191, 171, 254, 239, 236, 255, 186, 253, 255, 40, 188, 54, 232, 67, 35, 94,
+  246, 47, 252, 255, 168, 202, 255, 109, 251, 87, 247, 127, 43, 61, 36, 44,
+  254, 63, 129, 241, 63, 206, 252, 63, 207, 255, 166, 191, 197, 240, 95, 255,
+  19, 138, 255, 75, 2, 255, 26, 142, 255, 167, 158, 124, 108, 234, 93, 18,
+  0, 164, 233, 1, 136, 171, 15, 101, 254, 142, 9, 42, 61, 193, 129, 199, 63,
+  156, 249, 147, 215, 253, 159, 205, 200, 77, 120, 60, 60, 228, 88, 223, 120,
+  16, 252, 221, 249, 159, 43, 254, 139, 120, 229, 127, 121, 242, 127, 175,
+  251, 223, 29, 255, 133, 251, 84, 252, 143, 234, 191, 70, 253, 199, 180, 127,
+  22, 255, 129, 250, 223, 136, 244, 255, 237, 48, 254, 167, 246, 207, 241,
+  191, 192, 238, 127, 238, 255, 201, 151, 156, 192, 254, 191, 158, 224, 79,
+  237, 159, 226, 63, 131, 220, 255, 20, 255, 103, 62, 247, 53, 138, 255, 123,
+  20, 255, 35, 181, 103, 46, 81, 252, 31, 122, 242, 241, 169, 119, 111, 141,
+  101, 137, 117, 80, 7, 144, 16, 224, 195, 251, 91, 12, 255, 154, 21, 92, 18,
+  193, 187, 43, 248, 113, 123, 116, 4, 223, 255, 34, 254, 83, 214, 167, 28,
+  168, 25, 125, 77, 142, 191, 179, 254, 231, 110, 32, 224, 251, 63, 152, 119,
+  254, 223, 200, 95, 31, 228, 254, 143, 168, 179, 19, 134, 246, 175, 30, 180,
+  252, 255, 8, 137, 255, 243, 218, 191, 168, 255, 104, 255, 223, 35, 236, 127,
+  80, 224, 79, 243, 63, 129, 255, 141, 206, 19, 34, 254, 23, 248, 159, 160,
+  248, 115, 251, 47, 255, 195, 91, 51, 223, 167, 248, 255, 236, 179, 95, 255,
+  62, 195, 127, 53, 197, 191, 145, 226, 159, 25, 255, 244, 227, 211, 238, 221,
+  26, 207, 102, 210, 52, 206, 73, 72, 236, 181, 247, 215, 30, 20, 79, 127,
+  88, 29, 60, 199, 230, 80, 190, 224, 33, 131, 162, 47, 135, 247, 208, 221,
+  163, 73, 241, 55, 234, 63, 22, 254, 121, 239, 127, 107, 254, 207, 204, 255,
+  200, 227, 192, 255, 79, 126, 255, 135, 251, 100, 252, 167, 234, 63, 40, 254,
+  23, 254, 127, 180, 83, 197, 255, 55, 93, 246, 63, 170, 226, 127, 232, 255,
+  105, 252, 175, 240, 167, 241, 159, 184, 255, 59, 26, 74, 203, 43, 24, 254,
+  167, 78, 81, 252, 79, 114, 252, 153, 253, 207, 124, 139, 216, 255, 146, 85,
+  235, 127, 241, 89, 106, 255, 111, 190, 183, 112, 205, 22, 129, 127, 40, 19,
+  123, 242, 137, 105, 247, 111, 147, 0, 128, 166, 0, 9, 238, 2, 18, 188, 249,
+  1, 238, 191, 148, 203, 130, 77, 252, 241, 252, 92, 194, 246, 255, 108, 117,
+  64, 197, 127, 202, 18, 220, 213, 183, 56, 252, 238, 147, 225, 239, 28, 223,
+  231, 7, 200, 138, 255, 188, 234, 255, 220, 132, 173, 249, 47, 54, 251, 224,
+  236, 255, 185, 102, 31, 232, 179, 134, 253, 123, 249, 255, 145, 174, 46,
+  149, 255, 27, 246, 207, 227, 12, 27, 127, 158, 255, 15, 12, 158, 61, 227,
+  196, 95, 222, 255, 36, 255, 187, 208, 160, 241, 47, 127, 79, 224, 255, 236,
+  231, 190, 246, 253, 159, 19, 252, 23, 173, 222, 178, 235, 104, 77, 227, 165,
+  27, 4, 255, 225, 79, 63, 254, 240, 253, 219, 19, 228, 2, 72, 139, 3, 160,
+  209, 199, 230, 111, 86, 255, 181, 7, 119, 52, 96, 193, 232, 8, 123, 56, 9,
+  106, 199, 34, 254, 203, 243, 180, 142, 190, 244, 228, 201, 3, 227, 63, 201,
+  254, 103, 228, 65, 246, 191, 205, 248, 207, 211, 255, 227, 252, 159, 223,
+  255, 17, 117, 255, 27, 241, 31, 246, 255, 163, 210, 255, 247, 138, 252, 159,
+  198, 255, 192, 254, 57, 254, 226, 254, 231, 241, 127, 175, 240, 255, 103,
+  101, 254, 119, 137, 227, 79, 227, 191, 83, 20, 127, 238, 255, 41, 254, 167,
+  0, 254, 179, 9, 254, 243, 150, 174, 92, 255, 171, 207, 125, 149, 225, 191,
+  144, 224, 127, 132, 227, 159, 238, 122, 242, 137, 135, 239, 223, 157, 24,
+  163, 17, 160, 60, 0, 9, 241, 119, 103, 111, 159, 236, 253, 1, 4, 196, 245,
+  159, 86, 17, 188, 81, 254, 117, 142, 142, 25, 167, 39, 155, 6, 180, 51, 176,
+  250, 102, 90, 31, 63, 62, 184, 124, 224, 129, 127, 44, 250, 160, 248, 127,
+  132, 253, 31, 246, 252, 100, 254, 31, 117, 175, 34, 147, 218, 63, 59, 53,
+  254, 78, 51, 254, 3, 247, 63, 253, 242, 54, 3, 127, 17, 255, 19, 255, 127,
+  246, 236, 89, 11, 255, 211, 220, 255, 19, 251, 39, 254, 255, 92, 211, 233,
+  141, 155, 4, 254, 199, 42, 230, 188, 245, 135, 247, 231, 47, 89, 185, 254,
+  215, 159, 37, 248, 255, 134, 224, 191, 138, 226, 127, 250, 210, 141, 129,
+  80, 166, 245, 211, 79, 60, 60, 229, 238, 45, 118, 1, 144, 247, 57, 33, 79,
+  64, 18, 156, 126, 97, 128, 216, 2, 73, 196, 96, 215, 79, 212, 0, 151, 231,
+  248, 175, 190, 61, 130, 94, 209, 183, 89, 125, 55, 130, 15, 246, 60, 196,
+  63, 2, 187, 79, 110, 252, 65, 243, 42, 242, 128, 243, 159, 176, 254, 151,
+  28, 22, 240, 187, 253, 63, 234, 125, 199, 41, 254, 253, 176, 254, 227, 97,
+  255, 16, 127, 224, 255, 181, 253, 99, 252, 187, 84, 252, 63, 48, 120, 158,
+  248, 255, 243, 2, 127, 154, 36, 80, 255, 223, 72, 240, 175, 170, 173, 149,
+  246, 127, 102, 3, 179, 255, 189, 212, 254, 231, 190, 253, 46, 193, 127, 213,
+  186, 151, 62, 243, 181, 167, 126, 254, 155, 55, 24, 254, 135, 107, 78, 95,
+  36, 248, 167, 207, 60, 249, 196, 35, 83, 238, 221, 154, 200, 17, 60, 211,
+  73, 118, 0, 146, 2, 127, 13, 191, 9, 32, 191, 192, 83, 142, 1, 12, 119, 2,
+  47, 146, 71, 125, 255, 147, 167, 211, 186, 254, 99, 12, 143, 25, 217, 23,
+  14, 62, 36, 254, 129, 96, 200, 192, 223, 57, 190, 109, 205, 127, 102, 34,
+  198, 252, 215, 3, 213, 127, 116, 255, 79, 60, 237, 240, 255, 170, 246, 253,
+  160, 246, 223, 5, 241, 135, 254, 223, 199, 238, 153, 64, 155, 184, 255, 25,
+  254, 32, 255, 163, 248, 83, 255, 223, 196, 235, 63, 2, 255, 51, 20, 127,
+  233, 255, 207, 53, 157, 37, 248, 23, 81, 251, 63, 92, 90, 62, 239, 173, 119,
+  153, 253, 255, 238, 179, 95, 249, 254, 207, 8, 254, 11, 86, 109, 41, 57,
+  82, 77, 240, 239, 15, 165, 107, 158, 252, 196, 195, 211, 238, 222, 166, 23,
+  0, 191, 1, 196, 9, 72, 98, 248, 213, 253, 13, 22, 120, 83, 86, 1, 198, 177,
+  57, 228, 30, 255, 183, 188, 135, 185, 190, 111, 181, 158, 140, 241, 17, 137,
+  63, 174, 31, 153, 47, 224, 154, 255, 176, 226, 63, 73, 124, 98, 70, 32, 112,
+  126, 201, 163, 255, 231, 152, 125, 35, 207, 70, 5, 254, 32, 255, 119, 218,
+  127, 87, 151, 72, 234, 56, 254, 124, 99, 20, 196, 127, 87, 69, 254, 103,
+  227, 127, 1, 216, 63, 171, 255, 16, 252, 207, 42, 252, 169, 255, 191, 112,
+  94, 224, 127, 128, 248, 255, 249, 28, 255, 117, 175, 126, 230, 171, 79, 17,
+  252, 103, 45, 88, 181, 185, 228, 48, 195, 63, 152, 62, 252, 233, 39, 30,
+  153, 118, 239, 54, 185, 0, 178, 20, 255, 84, 82, 156, 0, 241, 169, 131, 63,
+  53, 191, 33, 19, 184, 108, 194, 163, 128, 111, 149, 79, 28, 227, 159, 244,
+  254, 119, 71, 95, 142, 232, 27, 167, 15, 14, 252, 117, 255, 56, 31, 254,
+  160, 254, 51, 9, 255, 131, 217, 255, 247, 136, 255, 96, 253, 7, 228, 127,
+  81, 20, 255, 13, 171, 252, 223, 176, 255, 128, 196, 95, 196, 127, 86, 252,
+  127, 149, 184, 246, 171, 34, 254, 199, 254, 191, 137, 227, 223, 44, 253,
+  63, 197, 255, 252, 49, 122, 255, 215, 50, 252, 207, 144, 236, 128, 220, 255,
+  69, 204, 255, 31, 43, 95, 68, 240, 159, 71, 240, 127, 227, 51, 95, 253, 222,
+  207, 126, 243, 58, 195, 255, 80, 245, 233, 22, 130, 127, 170, 228, 201, 39,
+  30, 157, 122, 255, 206, 173, 241, 177, 108, 54, 205, 114, 128, 84, 130, 159,
+  1, 109, 253, 112, 254, 78, 87, 255, 178, 9, 123, 250, 207, 46, 255, 169,
+  240, 209, 232, 29, 11, 251, 23, 254, 63, 26, 113, 45, 158, 232, 248, 79,
+  193, 39, 159, 55, 236, 95, 118, 31, 162, 174, 217, 21, 15, 252, 31, 108,
+  255, 75, 224, 239, 25, 255, 133, 172, 249, 79, 101, 255, 78, 255, 31, 80,
+  246, 239, 129, 255, 176, 252, 250, 192, 53, 118, 255, 171, 252, 175, 91,
+  227, 223, 76, 45, 252, 130, 180, 127, 94, 35, 58, 207, 237, 255, 184, 192,
+  191, 105, 227, 230, 194, 237, 197, 196, 254, 137, 255, 95, 250, 38, 193,
+  127, 241, 202, 117, 211, 255, 233, 43, 79, 253, 244, 197, 55, 102, 46, 88,
+  185, 121, 231, 225, 170, 211, 45, 237, 253, 129, 244, 38, 130, 255, 180,
+  251, 119, 111, 145, 11, 128, 70, 0, 194, 3, 232, 15, 13, 191, 182, 95, 126,
+  253, 103, 227, 218, 125, 122, 0, 232, 120, 251, 85, 241, 200, 17, 61, 160,
+  251, 31, 77, 143, 232, 235, 71, 184, 143, 48, 232, 222, 193, 238, 83, 244,
+  65, 240, 207, 127, 255, 59, 250, 127, 41, 93, 198, 197, 241, 159, 61, 251,
+  30, 87, 247, 255, 208, 144, 51, 255, 83, 246, 31, 234, 244, 194, 223, 199,
+  227, 204, 235, 194, 254, 137, 255, 239, 160, 248, 179, 250, 31, 195, 191,
+  5, 227, 207, 236, 191, 169, 180, 172, 178, 170, 154, 196, 255, 39, 233, 253,
+  127, 161, 105, 19, 181, 255, 93, 212, 255, 151, 47, 127, 107, 6, 195, 255,
+  15, 255, 244, 149, 239, 253, 236, 215, 175, 19, 252, 55, 149, 28, 170, 58,
+  213, 210, 222, 23, 72, 173, 120, 242, 19, 143, 60, 52, 133, 5, 0, 44, 2,
+  72, 39, 213, 9, 72, 25, 222, 31, 222, 223, 4, 192, 108, 204, 11, 64, 252,
+  246, 165, 220, 227, 127, 41, 212, 63, 55, 174, 111, 227, 250, 72, 90, 238,
+  39, 172, 227, 255, 8, 246, 255, 147, 225, 31, 253, 99, 238, 127, 134, 162,
+  15, 247, 255, 236, 248, 79, 124, 115, 251, 254, 71, 251, 95, 210, 231, 120,
+  226, 47, 243, 191, 118, 96, 255, 252, 254, 239, 21, 248, 95, 148, 248, 95,
+  20, 249, 31, 193, 191, 185, 180, 76, 218, 63, 197, 191, 121, 51, 195, 127,
+  239, 193, 195, 199, 202, 87, 189, 249, 238, 108, 138, 255, 251, 255, 244,
+  47, 223, 251, 41, 193, 127, 222, 202, 77, 59, 9, 254, 205, 4, 255, 228, 135,
+  79, 126, 226, 81, 138, 63, 187, 0, 72, 76, 199, 60, 64, 74, 130, 207, 99,
+  111, 24, 126, 233, 254, 13, 29, 255, 178, 0, 180, 216, 63, 18, 41, 247, 248,
+  7, 136, 30, 29, 188, 3, 174, 209, 35, 148, 255, 135, 131, 65, 187, 127, 252,
+  192, 248, 79, 62, 255, 101, 120, 160, 145, 124, 246, 143, 235, 191, 228,
+  31, 149, 255, 73, 251, 215, 251, 63, 224, 212, 134, 121, 254, 7, 226, 191,
+  65, 30, 255, 203, 251, 255, 198, 21, 97, 255, 204, 255, 119, 113, 252, 233,
+  164, 240, 224, 37, 136, 191, 176, 255, 139, 12, 127, 114, 255, 19, 251, 63,
+  67, 240, 223, 186, 169, 144, 226, 127, 128, 224, 191, 238, 205, 25, 4, 255,
+  21, 235, 230, 253, 227, 191, 124, 239, 153, 95, 191, 254, 135, 249, 43, 54,
+  237, 60, 88, 213, 208, 124, 157, 224, 63, 131, 225, 127, 239, 14, 191, 0,
+  104, 120, 199, 15, 64, 74, 161, 207, 82, 39, 35, 252, 102, 248, 71, 212,
+  240, 71, 216, 163, 127, 239, 29, 191, 103, 51, 73, 123, 253, 199, 233, 62,
+  156, 227, 3, 200, 255, 155, 188, 133, 15, 136, 255, 71, 201, 255, 71, 28,
+  247, 63, 24, 126, 192, 245, 95, 129, 127, 254, 251, 63, 18, 9, 25, 249, 159,
+  141, 127, 91, 91, 27, 176, 127, 118, 255, 223, 100, 187, 165, 173, 44, 254,
+  107, 66, 248, 183, 30, 147, 248, 51, 251, 111, 42, 34, 246, 95, 204, 241,
+  223, 72, 240, 255, 144, 224, 191, 248, 31, 255, 249, 187, 63, 125, 225, 53,
+  130, 127, 65, 241, 161, 202, 134, 166, 235, 125, 254, 228, 203, 20, 255,
+  169, 247, 72, 0, 48, 78, 46, 0, 22, 2, 166, 5, 236, 218, 248, 149, 247, 149,
+  227, 151, 244, 250, 39, 62, 24, 88, 143, 179, 127, 11, 222, 254, 180, 57,
+  254, 149, 204, 75, 255, 99, 177, 247, 228, 193, 31, 230, 127, 248, 0, 169,
+  0, 50, 105, 224, 79, 27, 248, 129, 144, 115, 255, 199, 65, 125, 145, 76,
+  141, 184, 226, 127, 175, 250, 95, 156, 198, 255, 86, 252, 103, 223, 255,
+  194, 166, 229, 252, 151, 133, 127, 135, 240, 255, 252, 254, 239, 2, 254,
+  255, 50, 177, 127, 134, 255, 165, 214, 86, 137, 255, 101, 106, 255, 228,
+  254, 231, 248, 159, 111, 222, 65, 236, 191, 120, 247, 222, 3, 135, 142, 149,
+  111, 121, 131, 224, 191, 104, 197, 186, 21, 4, 255, 103, 94, 120, 237, 221,
+  121, 4, 255, 3, 20, 255, 155, 163, 201, 95, 125, 234, 19, 143, 62, 76, 240,
+  191, 61, 49, 78, 28, 64, 54, 35, 14, 0, 127, 199, 148, 231, 198, 181, 31,
+  110, 254, 153, 144, 147, 61, 197, 209, 61, 115, 182, 127, 146, 118, 243,
+  216, 181, 121, 98, 150, 15, 197, 15, 144, 31, 127, 87, 1, 81, 158, 64, 167,
+  253, 71, 242, 38, 176, 4, 255, 7, 181, 127, 246, 183, 239, 179, 226, 127,
+  22, 255, 161, 252, 143, 28, 0, 125, 255, 223, 36, 94, 125, 144, 247, 255,
+  84, 254, 55, 26, 232, 4, 254, 191, 83, 196, 127, 172, 83, 56, 216, 214, 72,
+  236, 255, 2, 207, 255, 174, 92, 225, 248, 183, 113, 251, 87, 248, 151, 108,
+  218, 194, 237, 255, 104, 121, 209, 27, 51, 222, 35, 248, 175, 93, 255, 255,
+  252, 243, 119, 158, 121, 225, 213, 119, 63, 92, 177, 177, 248, 64, 197, 201,
+  230, 171, 4, 255, 31, 51, 252, 239, 223, 189, 51, 65, 35, 64, 126, 3, 164,
+  83, 248, 35, 141, 222, 124, 97, 254, 180, 253, 231, 185, 126, 235, 141, 159,
+  58, 63, 9, 49, 254, 25, 9, 59, 199, 191, 172, 233, 13, 156, 255, 135, 205,
+  233, 93, 136, 127, 204, 57, 188, 168, 241, 55, 227, 127, 239, 4, 70, 254,
+  4, 163, 106, 254, 203, 29, 255, 99, 239, 163, 243, 63, 102, 206, 98, 112,
+  76, 199, 127, 226, 41, 65, 234, 15, 252, 63, 197, 127, 68, 229, 127, 93,
+  28, 255, 235, 218, 255, 11, 251, 31, 184, 202, 238, 127, 229, 255, 175, 82,
+  252, 175, 81, 252, 171, 107, 105, 252, 119, 154, 122, 135, 61, 196, 254,
+  119, 236, 162, 246, 95, 182, 147, 225, 191, 124, 109, 193, 103, 190, 252,
+  157, 167, 95, 120, 229, 221, 15, 151, 111, 220, 65, 240, 191, 112, 173, 119,
+  52, 241, 77, 138, 255, 180, 251, 247, 110, 147, 11, 96, 44, 155, 203, 136,
+  3, 144, 214, 216, 3, 248, 117, 244, 150, 165, 237, 31, 99, 252, 38, 166,
+  200, 127, 188, 217, 215, 84, 249, 47, 27, 247, 48, 223, 188, 219, 155, 202,
+  1, 133, 13, 255, 107, 224, 143, 194, 55, 76, 32, 30, 245, 107, 3, 126, 208,
+  254, 95, 106, 116, 24, 246, 127, 221, 249, 191, 182, 127, 137, 255, 160,
+  172, 255, 195, 115, 35, 220, 30, 121, 170, 75, 52, 117, 209, 253, 47, 237,
+  127, 52, 16, 232, 106, 51, 252, 191, 178, 255, 107, 194, 255, 183, 72, 255,
+  127, 253, 70, 71, 187, 196, 159, 216, 255, 25, 98, 255, 251, 54, 21, 110,
+  43, 222, 181, 135, 226, 191, 231, 141, 233, 20, 255, 53, 5, 95, 254, 242,
+  183, 159, 126, 254, 149, 25, 31, 46, 219, 184, 253, 64, 249, 201, 11, 87,
+  123, 70, 227, 95, 248, 212, 19, 143, 61, 60, 141, 5, 128, 227, 99, 36, 5,
+  200, 210, 119, 152, 190, 85, 34, 234, 19, 192, 201, 218, 139, 142, 254, 178,
+  73, 245, 230, 121, 173, 111, 25, 221, 23, 108, 255, 113, 143, 241, 15, 28,
+  62, 26, 229, 35, 141, 127, 64, 170, 22, 133, 140, 249, 33, 132, 191, 99,
+  128, 36, 10, 22, 184, 96, 2, 235, 21, 255, 113, 252, 77, 255, 31, 192, 213,
+  35, 20, 255, 199, 7, 188, 240, 247, 3, 218, 184, 72, 68, 212, 127, 60, 240,
+  247, 251, 187, 218, 174, 208, 254, 15, 49, 127, 158, 255, 107, 251, 111,
+  167, 248, 51, 255, 127, 137, 216, 127, 27, 63, 35, 2, 255, 122, 98, 255,
+  36, 254, 111, 58, 84, 64, 240, 47, 217, 187, 255, 240, 209, 178, 131, 175,
+  79, 127, 239, 3, 138, 255, 215, 191, 252, 237, 159, 252, 234, 149, 25, 31,
+  44, 219, 176, 125, 127, 249, 137, 243, 87, 123, 70, 226, 255, 7, 193, 255,
+  17, 138, 255, 109, 114, 1, 176, 8, 64, 121, 128, 180, 188, 248, 129, 245,
+  235, 219, 63, 155, 208, 211, 55, 174, 241, 61, 49, 125, 97, 164, 127, 170,
+  252, 147, 141, 185, 139, 47, 147, 76, 111, 169, 250, 15, 180, 63, 81, 189,
+  211, 7, 40, 150, 136, 231, 195, 31, 20, 112, 157, 5, 12, 59, 254, 27, 197,
+  243, 127, 96, 254, 51, 100, 231, 255, 158, 248, 195, 248, 143, 60, 212, 45,
+  236, 159, 223, 255, 253, 44, 99, 16, 1, 3, 247, 255, 12, 127, 121, 255, 203,
+  80, 145, 30, 148, 27, 18, 127, 226, 255, 47, 183, 241, 67, 210, 89, 86, 86,
+  206, 240, 231, 246, 223, 116, 148, 225, 79, 236, 255, 104, 217, 177, 215,
+  167, 207, 250, 96, 33, 193, 255, 123, 95, 250, 214, 79, 126, 245, 242, 140,
+  185, 203, 214, 111, 223, 87, 94, 127, 190, 173, 103, 36, 246, 159, 4, 254,
+  119, 217, 5, 64, 35, 128, 44, 51, 116, 14, 59, 132, 95, 198, 110, 2, 126,
+  10, 96, 216, 251, 250, 159, 44, 253, 7, 248, 227, 203, 55, 127, 246, 38,
+  95, 32, 228, 153, 255, 199, 189, 238, 127, 87, 254, 7, 11, 136, 214, 252,
+  167, 113, 255, 51, 255, 47, 231, 184, 2, 65, 59, 254, 83, 207, 14, 66, 252,
+  135, 85, 226, 32, 120, 99, 196, 212, 107, 36, 220, 211, 213, 205, 141, 90,
+  216, 191, 216, 24, 83, 248, 119, 115, 252, 233, 253, 15, 252, 63, 125, 229,
+  14, 238, 255, 185, 253, 95, 225, 254, 191, 163, 162, 172, 162, 146, 227,
+  79, 9, 128, 40, 1, 240, 182, 29, 187, 246, 236, 39, 248, 87, 48, 252, 151,
+  173, 217, 248, 244, 23, 191, 245, 227, 231, 94, 158, 62, 119, 233, 250, 162,
+  125, 101, 245, 231, 175, 244, 248, 162, 255, 192, 240, 39, 9, 0, 189, 0,
+  72, 10, 72, 67, 64, 238, 1, 210, 28, 121, 109, 252, 18, 126, 129, 127, 212,
+  184, 59, 173, 203, 51, 79, 251, 134, 46, 143, 98, 234, 216, 136, 199, 246,
+  134, 218, 60, 199, 249, 67, 200, 168, 222, 170, 246, 51, 36, 174, 126, 96,
+  252, 49, 1, 137, 35, 129, 240, 3, 24, 221, 243, 159, 240, 254, 31, 148, 245,
+  63, 103, 252, 175, 238, 255, 73, 240, 247, 247, 210, 208, 238, 154, 142,
+  255, 217, 151, 178, 250, 79, 123, 227, 217, 11, 77, 205, 42, 255, 163, 36,
+  97, 29, 157, 149, 204, 254, 235, 78, 156, 108, 104, 60, 115, 246, 194, 133,
+  74, 138, 127, 9, 195, 191, 242, 205, 119, 102, 205, 165, 248, 255, 236, 139,
+  223, 250, 209, 115, 191, 159, 62, 103, 233, 250, 109, 251, 202, 142, 159,
+  107, 235, 242, 69, 255, 253, 39, 25, 254, 36, 1, 96, 23, 0, 13, 1, 105, 18,
+  32, 79, 128, 254, 200, 128, 203, 63, 67, 227, 132, 136, 49, 124, 105, 113,
+  63, 33, 247, 173, 142, 145, 244, 255, 81, 76, 29, 59, 121, 245, 22, 221,
+  255, 161, 160, 99, 122, 215, 164, 174, 192, 5, 36, 175, 252, 223, 238, 64,
+  218, 246, 239, 87, 245, 223, 124, 243, 223, 242, 199, 31, 20, 249, 191, 219,
+  254, 21, 254, 189, 204, 255, 195, 251, 63, 31, 254, 194, 254, 193, 253, 79,
+  227, 191, 43, 87, 132, 72, 88, 71, 167, 97, 255, 101, 26, 255, 178, 215,
+  57, 254, 27, 190, 255, 197, 111, 18, 252, 223, 153, 187, 132, 224, 95, 122,
+  252, 220, 149, 238, 225, 232, 39, 41, 254, 15, 77, 153, 66, 240, 103, 17,
+  32, 137, 0, 88, 12, 200, 76, 21, 131, 47, 93, 55, 179, 254, 108, 38, 108,
+  21, 223, 162, 104, 117, 48, 233, 36, 127, 82, 103, 40, 234, 85, 254, 203,
+  27, 189, 1, 255, 111, 163, 135, 79, 160, 78, 223, 209, 13, 100, 217, 191,
+  200, 64, 157, 244, 149, 242, 121, 63, 174, 255, 120, 220, 255, 116, 248,
+  133, 62, 60, 4, 241, 247, 249, 188, 241, 215, 246, 207, 41, 67, 88, 252,
+  55, 44, 26, 13, 1, 27, 255, 94, 49, 41, 114, 67, 225, 47, 252, 63, 137, 16,
+  59, 171, 88, 252, 39, 236, 255, 124, 83, 21, 19, 0, 160, 248, 151, 86, 188,
+  69, 240, 95, 176, 108, 245, 198, 103, 190, 240, 141, 31, 253, 242, 247, 111,
+  207, 89, 178, 110, 219, 222, 210, 186, 115, 84, 0, 96, 42, 195, 127, 234,
+  125, 30, 0, 176, 8, 32, 203, 98, 0, 238, 3, 50, 105, 29, 248, 167, 149, 245,
+  83, 252, 211, 40, 116, 18, 188, 81, 241, 7, 188, 190, 121, 245, 120, 146,
+  242, 175, 190, 63, 236, 252, 33, 100, 222, 191, 32, 0, 149, 240, 185, 7,
+  200, 189, 243, 63, 215, 4, 146, 168, 31, 250, 31, 164, 254, 163, 238, 255,
+  33, 22, 204, 13, 234, 249, 47, 55, 254, 55, 101, 252, 103, 251, 127, 22,
+  103, 244, 81, 219, 190, 126, 77, 225, 223, 45, 191, 146, 223, 255, 140, 0,
+  130, 197, 127, 204, 255, 119, 148, 151, 213, 212, 212, 176, 250, 31, 179,
+  255, 90, 42, 0, 196, 5, 0, 42, 222, 21, 2, 48, 191, 250, 2, 35, 0, 147, 4,
+  192, 140, 0, 138, 227, 79, 3, 64, 114, 1, 48, 7, 144, 203, 240, 3, 144, 225,
+  192, 107, 227, 151, 149, 31, 134, 127, 50, 140, 67, 39, 77, 253, 147, 103,
+  122, 59, 47, 254, 110, 226, 33, 80, 188, 5, 227, 99, 102, 244, 174, 173,
+  215, 186, 129, 242, 228, 127, 176, 255, 31, 141, 120, 21, 16, 83, 210, 254,
+  71, 173, 249, 15, 204, 125, 42, 119, 159, 133, 253, 227, 253, 31, 227, 254,
+  39, 15, 245, 33, 255, 223, 175, 55, 198, 132, 255, 239, 191, 194, 234, 255,
+  84, 0, 20, 224, 79, 153, 98, 186, 27, 21, 254, 173, 236, 139, 104, 252, 95,
+  73, 5, 160, 136, 253, 55, 54, 158, 161, 249, 95, 125, 129, 18, 0, 168, 152,
+  253, 246, 204, 185, 243, 151, 173, 218, 240, 251, 207, 113, 2, 152, 69, 148,
+  0, 168, 150, 17, 0, 132, 5, 254, 247, 9, 254, 210, 1, 208, 36, 128, 195,
+  173, 176, 87, 190, 159, 129, 79, 241, 79, 32, 230, 28, 61, 58, 97, 4, 223,
+  169, 164, 115, 118, 148, 93, 31, 102, 244, 102, 12, 143, 218, 241, 163, 126,
+  1, 115, 253, 15, 228, 127, 94, 248, 227, 250, 95, 48, 24, 52, 213, 43, 28,
+  252, 15, 50, 128, 240, 107, 26, 31, 131, 255, 27, 44, 63, 42, 218, 228, 225,
+  126, 199, 253, 15, 251, 63, 220, 107, 244, 203, 164, 158, 70, 117, 250, 196,
+  144, 15, 94, 47, 28, 148, 119, 59, 39, 128, 224, 71, 133, 49, 5, 245, 156,
+  97, 11, 128, 45, 130, 0, 86, 16, 192, 9, 1, 48, 70, 0, 218, 116, 177, 97,
+  243, 150, 162, 29, 130, 0, 110, 158, 32, 0, 121, 139, 45, 128, 190, 41, 23,
+  64, 233, 2, 200, 224, 223, 81, 252, 73, 2, 120, 143, 6, 0, 19, 99, 227, 57,
+  18, 2, 102, 249, 1, 144, 103, 0, 160, 47, 173, 159, 166, 127, 97, 203, 247,
+  194, 232, 221, 197, 189, 12, 210, 191, 44, 158, 189, 49, 185, 3, 208, 242,
+  104, 210, 30, 63, 8, 73, 33, 69, 27, 61, 68, 255, 110, 213, 255, 51, 121,
+  227, 127, 175, 253, 85, 127, 62, 254, 127, 139, 251, 208, 215, 47, 178, 121,
+  238, 206, 125, 216, 254, 213, 173, 49, 192, 135, 186, 105, 254, 223, 167,
+  70, 70, 132, 253, 143, 248, 153, 0, 24, 16, 128, 232, 150, 2, 0, 228, 181,
+  111, 158, 177, 5, 64, 58, 235, 176, 0, 64, 221, 198, 45, 219, 247, 238, 221,
+  123, 128, 218, 255, 98, 190, 0, 188, 126, 54, 91, 0, 99, 11, 64, 116, 1,
+  228, 98, 199, 64, 240, 134, 192, 255, 254, 93, 126, 1, 16, 252, 115, 60,
+  6, 228, 71, 32, 173, 126, 129, 206, 159, 124, 68, 100, 237, 71, 25, 111,
+  52, 142, 106, 239, 152, 251, 199, 12, 255, 178, 30, 181, 87, 84, 254, 179,
+  203, 63, 242, 21, 242, 208, 255, 184, 34, 80, 192, 63, 230, 133, 127, 158,
+  9, 228, 84, 50, 96, 205, 127, 6, 242, 168, 38, 251, 112, 254, 135, 240, 7,
+  246, 63, 208, 173, 253, 191, 164, 140, 230, 15, 140, 142, 72, 2, 32, 37,
+  0, 137, 4, 0, 250, 93, 4, 176, 39, 32, 1, 16, 91, 0, 99, 4, 96, 71, 43, 43,
+  42, 87, 190, 195, 241, 95, 248, 217, 175, 209, 5, 128, 89, 11, 87, 111, 230,
+  3, 224, 253, 193, 22, 137, 255, 61, 113, 1, 208, 3, 192, 110, 128, 108, 38,
+  35, 189, 64, 38, 131, 66, 63, 242, 111, 46, 3, 130, 127, 39, 245, 90, 190,
+  240, 79, 117, 143, 28, 190, 55, 150, 143, 188, 93, 141, 15, 78, 70, 255,
+  239, 242, 32, 10, 127, 24, 255, 57, 9, 4, 173, 254, 127, 224, 129, 246, 127,
+  101, 252, 59, 98, 228, 255, 156, 208, 117, 52, 224, 135, 109, 35, 130, 63,
+  191, 255, 213, 252, 7, 176, 127, 198, 23, 231, 195, 4, 176, 128, 0, 114,
+  16, 19, 192, 113, 252, 79, 225, 5, 224, 211, 5, 155, 21, 1, 192, 188, 121,
+  31, 124, 184, 104, 233, 234, 245, 171, 62, 247, 85, 186, 0, 32, 6, 128, 79,
+  209, 1, 192, 83, 159, 96, 248, 211, 4, 128, 93, 0, 36, 2, 28, 203, 9, 15,
+  32, 125, 0, 255, 53, 171, 239, 126, 242, 145, 10, 235, 210, 175, 46, 189,
+  97, 233, 13, 16, 189, 91, 225, 95, 218, 243, 189, 143, 229, 33, 111, 83,
+  254, 31, 182, 127, 61, 51, 80, 231, 0, 81, 108, 52, 96, 228, 127, 230, 25,
+  116, 76, 32, 5, 96, 252, 239, 15, 96, 254, 39, 147, 255, 133, 225, 63, 8,
+  241, 31, 149, 196, 1, 8, 255, 65, 21, 255, 221, 132, 245, 255, 97, 113, 94,
+  248, 2, 176, 147, 0, 138, 46, 0, 89, 4, 0, 141, 120, 1, 240, 60, 88, 0, 93,
+  76, 23, 192, 11, 10, 10, 54, 125, 158, 216, 255, 139, 111, 204, 154, 191,
+  138, 13, 0, 54, 95, 239, 243, 87, 74, 252, 105, 5, 136, 93, 0, 252, 6, 224,
+  105, 160, 60, 2, 89, 81, 245, 145, 248, 231, 178, 9, 68, 188, 131, 92, 47,
+  90, 29, 117, 13, 255, 208, 215, 77, 229, 39, 111, 49, 151, 55, 141, 246,
+  79, 198, 189, 254, 99, 172, 255, 58, 127, 134, 24, 14, 224, 61, 5, 4, 19,
+  48, 128, 8, 186, 250, 191, 78, 237, 163, 56, 182, 127, 95, 30, 252, 135,
+  16, 254, 253, 42, 99, 80, 243, 66, 87, 144, 0, 4, 196, 255, 188, 177, 0,
+  76, 241, 63, 135, 23, 192, 154, 10, 244, 2, 216, 74, 182, 0, 182, 106, 253,
+  252, 159, 255, 240, 199, 191, 124, 137, 224, 79, 7, 0, 43, 27, 154, 175,
+  223, 28, 61, 240, 119, 143, 19, 252, 31, 154, 66, 3, 192, 59, 183, 168, 3,
+  32, 41, 0, 11, 1, 114, 226, 0, 168, 99, 160, 108, 159, 30, 128, 40, 10, 254,
+  108, 230, 93, 23, 245, 46, 196, 63, 25, 202, 147, 254, 79, 122, 129, 164,
+  209, 248, 199, 36, 244, 159, 24, 255, 168, 232, 223, 5, 242, 16, 8, 130,
+  249, 63, 222, 193, 8, 218, 245, 159, 0, 238, 255, 242, 195, 195, 207, 206,
+  40, 152, 255, 195, 251, 31, 8, 255, 97, 129, 127, 175, 202, 255, 48, 1, 144,
+  159, 238, 127, 200, 252, 79, 44, 128, 210, 85, 113, 186, 0, 112, 22, 47,
+  128, 81, 252, 217, 0, 112, 141, 24, 0, 62, 127, 161, 121, 11, 193, 191, 152,
+  47, 0, 173, 231, 11, 0, 235, 151, 127, 230, 171, 79, 189, 53, 99, 198, 251,
+  11, 9, 254, 7, 43, 27, 154, 174, 245, 142, 238, 248, 4, 195, 159, 216, 63,
+  193, 159, 94, 0, 36, 5, 24, 227, 33, 64, 46, 43, 110, 123, 129, 189, 70,
+  159, 252, 145, 214, 139, 51, 222, 121, 101, 188, 246, 232, 141, 230, 254,
+  99, 227, 95, 225, 143, 48, 188, 101, 216, 127, 218, 213, 254, 177, 233, 255,
+  93, 3, 100, 81, 110, 191, 218, 128, 67, 166, 7, 177, 245, 63, 82, 65, 103,
+  253, 7, 86, 15, 96, 253, 199, 47, 171, 185, 104, 254, 83, 222, 255, 170,
+  237, 61, 210, 37, 5, 192, 220, 2, 32, 1, 69, 0, 37, 234, 255, 122, 1, 180,
+  197, 177, 0, 212, 162, 22, 0, 216, 0, 120, 243, 54, 61, 0, 190, 233, 173,
+  119, 103, 211, 5, 144, 181, 116, 0, 252, 197, 215, 215, 172, 95, 95, 88,
+  66, 240, 191, 112, 173, 103, 100, 3, 197, 255, 225, 105, 180, 0, 192, 47,
+  0, 234, 0, 244, 1, 144, 71, 128, 131, 47, 124, 63, 249, 55, 13, 222, 119,
+  57, 248, 101, 84, 222, 237, 236, 31, 134, 255, 9, 139, 122, 203, 180, 127,
+  92, 63, 194, 23, 72, 10, 59, 111, 123, 252, 223, 163, 2, 157, 202, 152, 249,
+  63, 244, 65, 246, 254, 191, 116, 32, 65, 145, 149, 35, 254, 63, 167, 246,
+  41, 117, 29, 163, 174, 252, 79, 247, 255, 217, 177, 137, 112, 252, 123, 242,
+  8, 192, 250, 219, 76, 2, 32, 213, 41, 104, 129, 11, 224, 194, 254, 91, 152,
+  253, 243, 1, 96, 58, 0, 42, 241, 167, 3, 160, 108, 1, 96, 197, 186, 229,
+  4, 255, 159, 190, 248, 250, 204, 249, 43, 43, 15, 31, 173, 110, 104, 186,
+  218, 51, 178, 236, 9, 137, 63, 9, 0, 201, 5, 112, 107, 156, 135, 128, 50,
+  6, 16, 31, 200, 246, 201, 103, 210, 225, 253, 39, 141, 254, 33, 254, 113,
+  119, 248, 159, 103, 250, 23, 217, 191, 72, 255, 141, 2, 2, 218, 222, 137,
+  187, 7, 200, 152, 253, 35, 0, 243, 181, 32, 196, 11, 132, 188, 248, 127,
+  67, 144, 190, 90, 254, 5, 70, 1, 255, 135, 35, 255, 15, 138, 191, 248, 136,
+  88, 234, 176, 252, 191, 16, 140, 225, 11, 64, 26, 127, 73, 0, 211, 63, 56,
+  116, 241, 172, 65, 0, 64, 7, 128, 197, 2, 136, 88, 0, 104, 42, 102, 3, 192,
+  20, 255, 178, 109, 98, 0, 120, 227, 63, 254, 203, 119, 127, 250, 194, 235,
+  127, 152, 183, 178, 96, 103, 227, 153, 51, 205, 215, 122, 124, 115, 63, 241,
+  248, 163, 4, 127, 150, 0, 210, 12, 144, 165, 128, 60, 4, 80, 46, 32, 139,
+  192, 103, 255, 53, 6, 82, 63, 253, 198, 139, 208, 125, 50, 247, 47, 199,
+  63, 188, 180, 91, 188, 147, 55, 96, 255, 112, 120, 207, 240, 32, 152, 254,
+  209, 88, 32, 195, 254, 63, 79, 9, 26, 158, 193, 144, 171, 255, 99, 207, 255,
+  136, 250, 149, 95, 213, 255, 64, 254, 167, 230, 134, 212, 169, 25, 69, 2,
+  48, 170, 255, 39, 10, 134, 228, 219, 92, 135, 11, 192, 104, 1, 144, 47, 0,
+  180, 208, 254, 191, 194, 255, 234, 49, 129, 191, 24, 0, 167, 3, 128, 197,
+  108, 0, 176, 188, 132, 15, 0, 175, 221, 244, 37, 54, 0, 250, 135, 15, 217,
+  0, 112, 199, 141, 246, 155, 190, 233, 79, 80, 252, 105, 1, 152, 86, 128,
+  68, 4, 40, 146, 64, 112, 2, 114, 8, 253, 92, 86, 23, 126, 163, 154, 51, 92,
+  7, 222, 222, 224, 165, 69, 44, 25, 53, 184, 59, 141, 221, 125, 167, 241,
+  234, 249, 211, 164, 187, 253, 167, 58, 16, 121, 46, 33, 158, 255, 9, 250,
+  159, 96, 216, 209, 255, 87, 13, 68, 125, 140, 195, 158, 241, 159, 73, 95,
+  75, 79, 95, 0, 220, 255, 195, 170, 254, 43, 190, 175, 230, 76, 243, 155,
+  254, 127, 64, 204, 127, 137, 252, 143, 45, 128, 224, 5, 240, 94, 241, 149,
+  151, 229, 2, 0, 243, 255, 172, 71, 212, 121, 189, 84, 12, 0, 55, 208, 1,
+  160, 11, 77, 7, 244, 0, 232, 65, 62, 0, 184, 182, 224, 219, 116, 0, 240,
+  213, 25, 98, 0, 180, 41, 57, 52, 242, 242, 19, 143, 177, 248, 111, 234, 253,
+  123, 180, 2, 192, 34, 64, 134, 191, 184, 2, 114, 2, 116, 253, 27, 253, 143,
+  41, 36, 23, 167, 236, 206, 224, 221, 198, 196, 11, 112, 117, 44, 147, 141,
+  132, 242, 58, 239, 252, 211, 223, 153, 100, 48, 104, 113, 207, 185, 214,
+  63, 236, 35, 36, 235, 191, 88, 254, 51, 236, 86, 62, 85, 241, 159, 137, 63,
+  246, 255, 166, 246, 65, 80, 220, 255, 180, 254, 47, 252, 255, 8, 154, 255,
+  0, 11, 224, 106, 254, 67, 9, 64, 13, 203, 254, 159, 191, 163, 205, 129, 63,
+  179, 255, 54, 190, 0, 196, 7, 192, 217, 0, 224, 141, 142, 235, 229, 21, 149,
+  114, 1, 140, 226, 127, 116, 211, 22, 138, 63, 29, 0, 44, 123, 99, 250, 44,
+  54, 0, 248, 147, 47, 127, 235, 39, 207, 191, 204, 6, 0, 15, 148, 159, 184,
+  112, 117, 44, 250, 220, 19, 194, 255, 79, 185, 199, 2, 128, 219, 19, 183,
+  132, 3, 224, 30, 64, 250, 128, 156, 6, 159, 124, 198, 181, 92, 156, 17, 252,
+  57, 176, 115, 100, 127, 148, 59, 18, 14, 255, 233, 16, 210, 93, 64, 48, 111,
+  16, 166, 60, 15, 135, 247, 81, 249, 47, 230, 28, 255, 2, 247, 63, 31, 196,
+  11, 26, 4, 20, 17, 123, 130, 89, 254, 12, 97, 99, 254, 207, 192, 31, 240,
+  191, 9, 2, 80, 163, 254, 11, 5, 64, 212, 83, 65, 40, 0, 58, 160, 243, 127,
+  53, 0, 222, 33, 251, 63, 96, 1, 152, 15, 0, 95, 151, 11, 32, 23, 21, 254,
+  55, 196, 0, 232, 201, 147, 167, 78, 177, 6, 96, 5, 195, 159, 13, 0, 86, 190,
+  243, 206, 123, 115, 23, 46, 95, 179, 241, 133, 47, 126, 235, 199, 191, 98,
+  3, 96, 219, 247, 149, 157, 56, 223, 214, 59, 237, 199, 79, 60, 198, 240,
+  167, 9, 32, 193, 95, 57, 0, 158, 4, 136, 3, 144, 203, 170, 127, 232, 103,
+  46, 7, 238, 126, 92, 250, 113, 144, 198, 218, 196, 17, 52, 154, 52, 87, 135,
+  29, 221, 63, 239, 2, 66, 54, 225, 240, 255, 134, 124, 128, 186, 65, 140,
+  32, 52, 10, 9, 60, 130, 158, 4, 212, 184, 4, 25, 241, 217, 243, 223, 22,
+  251, 141, 154, 255, 10, 209, 100, 78, 47, 0, 75, 65, 63, 57, 55, 206, 190,
+  107, 132, 46, 128, 118, 91, 4, 208, 195, 128, 0, 144, 45, 0, 136, 1, 112,
+  33, 0, 105, 13, 128, 178, 1, 96, 182, 0, 112, 163, 179, 188, 180, 66, 13,
+  128, 158, 111, 106, 169, 222, 92, 168, 240, 127, 239, 157, 89, 31, 44, 88,
+  182, 102, 227, 107, 124, 0, 104, 206, 210, 117, 69, 123, 203, 142, 159, 191,
+  210, 51, 242, 173, 199, 31, 123, 236, 97, 114, 255, 79, 229, 1, 32, 117,
+  0, 234, 6, 192, 39, 64, 129, 159, 205, 101, 192, 221, 15, 99, 255, 184, 131,
+  54, 206, 237, 254, 51, 222, 204, 11, 147, 245, 15, 232, 17, 74, 184, 135,
+  119, 221, 229, 95, 156, 65, 198, 144, 255, 119, 9, 16, 192, 4, 18, 225, 207,
+  247, 127, 3, 249, 241, 23, 4, 112, 131, 158, 246, 175, 252, 127, 72, 246,
+  255, 176, 0, 240, 176, 202, 23, 123, 240, 2, 112, 183, 174, 255, 117, 138,
+  5, 144, 22, 56, 0, 88, 133, 7, 0, 171, 55, 22, 238, 216, 69, 9, 0, 8, 254,
+  243, 166, 243, 1, 160, 89, 116, 0, 136, 14, 128, 172, 219, 202, 6, 128, 186,
+  71, 190, 72, 237, 255, 33, 86, 0, 230, 21, 0, 122, 1, 200, 27, 64, 29, 128,
+  156, 130, 158, 125, 36, 164, 84, 40, 144, 139, 138, 65, 239, 15, 153, 67,
+  108, 226, 8, 98, 254, 41, 61, 186, 239, 28, 30, 183, 123, 119, 168, 252,
+  155, 176, 202, 255, 222, 71, 40, 133, 7, 72, 99, 126, 45, 255, 148, 119,
+  4, 73, 197, 127, 228, 241, 200, 176, 131, 255, 201, 156, 30, 81, 248, 71,
+  44, 255, 63, 138, 5, 0, 197, 55, 213, 4, 144, 20, 213, 254, 65, 147, 0, 162,
+  151, 215, 127, 204, 5, 32, 114, 184, 122, 72, 254, 47, 253, 191, 26, 0, 58,
+  206, 7, 64, 216, 0, 224, 217, 243, 77, 245, 108, 0, 104, 207, 190, 195, 229,
+  21, 85, 75, 103, 208, 1, 192, 213, 27, 22, 127, 129, 43, 64, 45, 90, 187,
+  117, 207, 81, 170, 0, 60, 252, 127, 61, 241, 216, 35, 143, 8, 251, 215, 23,
+  0, 58, 0, 99, 240, 4, 176, 143, 104, 20, 135, 126, 86, 240, 151, 176, 137,
+  67, 240, 242, 64, 202, 53, 252, 129, 135, 255, 149, 249, 39, 205, 245, 83,
+  161, 60, 23, 242, 154, 64, 74, 120, 237, 15, 243, 251, 31, 209, 127, 122,
+  197, 127, 152, 63, 44, 162, 105, 220, 109, 253, 87, 75, 251, 52, 170, 240,
+  215, 124, 110, 34, 255, 135, 4, 144, 17, 147, 0, 10, 198, 127, 244, 235,
+  111, 94, 209, 247, 191, 137, 255, 89, 130, 112, 211, 69, 81, 255, 225, 248,
+  159, 44, 67, 10, 144, 167, 129, 2, 224, 194, 233, 243, 22, 44, 38, 247, 255,
+  122, 170, 0, 244, 146, 102, 0, 239, 28, 254, 207, 143, 11, 251, 103, 248,
+  179, 11, 128, 71, 0, 226, 0, 112, 23, 160, 221, 0, 253, 63, 105, 133, 190,
+  1, 63, 8, 254, 140, 232, 79, 143, 143, 243, 66, 114, 2, 189, 241, 88, 117,
+  210, 185, 252, 133, 174, 16, 169, 60, 232, 24, 64, 117, 69, 239, 136, 127,
+  202, 137, 191, 215, 2, 161, 252, 33, 162, 168, 254, 155, 111, 254, 155, 177,
+  231, 139, 110, 238, 32, 244, 255, 136, 55, 134, 127, 211, 30, 214, 212, 229,
+  11, 160, 122, 1, 88, 221, 255, 116, 0, 76, 45, 0, 118, 117, 1, 87, 65, 21,
+  64, 206, 169, 1, 0, 65, 18, 210, 121, 26, 42, 192, 158, 107, 186, 32, 21,
+  0, 8, 254, 171, 24, 3, 248, 134, 194, 162, 47, 127, 243, 71, 84, 1, 96, 225,
+  234, 66, 198, 0, 217, 57, 244, 31, 31, 167, 246, 79, 226, 63, 150, 0, 176,
+  11, 224, 22, 77, 1, 38, 104, 8, 200, 130, 64, 112, 2, 196, 47, 82, 44, 50,
+  166, 6, 238, 37, 110, 74, 48, 40, 153, 178, 42, 119, 105, 56, 61, 28, 211,
+  155, 59, 168, 129, 228, 209, 253, 129, 218, 65, 244, 254, 143, 5, 109, 246,
+  96, 195, 255, 35, 250, 41, 64, 95, 22, 83, 243, 59, 174, 5, 2, 92, 255, 81,
+  175, 16, 245, 25, 250, 79, 129, 96, 158, 249, 159, 24, 143, 255, 68, 254,
+  111, 10, 192, 203, 189, 135, 72, 184, 183, 219, 94, 0, 148, 3, 224, 52, 206,
+  24, 16, 4, 0, 106, 0, 88, 83, 5, 138, 1, 160, 139, 90, 1, 182, 163, 243,
+  44, 31, 0, 150, 10, 96, 205, 91, 52, 3, 232, 38, 209, 0, 44, 248, 236, 83,
+  207, 189, 248, 242, 219, 239, 83, 6, 216, 35, 213, 167, 47, 221, 24, 252,
+  239, 30, 127, 84, 218, 63, 13, 0, 217, 5, 160, 110, 0, 117, 7, 168, 51, 64,
+  63, 179, 72, 41, 82, 221, 218, 40, 247, 51, 205, 223, 112, 255, 217, 104,
+  216, 102, 110, 3, 225, 191, 123, 116, 87, 103, 144, 81, 7, 120, 49, 204,
+  62, 232, 26, 32, 21, 241, 63, 40, 255, 162, 36, 20, 252, 133, 12, 6, 130,
+  168, 94, 203, 117, 236, 255, 25, 252, 15, 124, 1, 116, 208, 16, 128, 21,
+  4, 64, 172, 0, 36, 188, 198, 77, 23, 1, 132, 28, 0, 39, 199, 101, 176, 77,
+  197, 127, 98, 0, 140, 14, 0, 177, 64, 225, 44, 176, 127, 169, 0, 119, 142,
+  14, 0, 28, 175, 175, 111, 160, 3, 96, 231, 154, 154, 183, 11, 252, 15, 151,
+  150, 239, 160, 12, 112, 139, 87, 173, 219, 252, 53, 202, 0, 55, 119, 209,
+  178, 117, 133, 20, 255, 139, 237, 3, 255, 21, 193, 159, 197, 255, 52, 1,
+  188, 119, 135, 149, 128, 110, 201, 27, 128, 224, 79, 75, 193, 250, 8, 176,
+  223, 146, 49, 109, 252, 218, 250, 141, 224, 79, 146, 71, 164, 93, 209, 127,
+  54, 27, 14, 187, 154, 63, 94, 213, 127, 99, 250, 131, 45, 15, 4, 221, 235,
+  167, 174, 9, 68, 36, 63, 17, 5, 243, 123, 224, 10, 177, 43, 72, 48, 8, 141,
+  105, 253, 55, 59, 254, 195, 228, 145, 244, 81, 156, 255, 25, 2, 208, 170,
+  109, 20, 237, 19, 245, 95, 143, 5, 64, 62, 0, 134, 226, 127, 153, 0, 12,
+  157, 231, 4, 0, 80, 1, 76, 52, 128, 216, 0, 208, 57, 90, 29, 222, 181, 133,
+  224, 191, 139, 225, 191, 95, 48, 64, 109, 250, 49, 111, 0, 45, 40, 220, 189,
+  255, 88, 13, 101, 0, 123, 236, 241, 71, 31, 225, 246, 47, 2, 192, 59, 20,
+  127, 154, 2, 0, 15, 32, 175, 1, 254, 91, 76, 163, 111, 57, 127, 144, 116,
+  37, 77, 226, 144, 116, 70, 79, 145, 120, 76, 110, 186, 42, 136, 46, 238,
+  216, 168, 38, 255, 53, 213, 99, 29, 236, 159, 232, 254, 143, 168, 251, 219,
+  165, 31, 108, 236, 255, 200, 87, 136, 25, 252, 79, 65, 3, 127, 184, 255,
+  67, 194, 207, 1, 201, 255, 194, 6, 64, 96, 254, 143, 6, 64, 251, 161, 0,
+  136, 166, 12, 241, 169, 1, 32, 48, 0, 218, 213, 221, 165, 184, 130, 201,
+  23, 94, 96, 3, 64, 23, 121, 252, 47, 20, 32, 90, 53, 3, 36, 107, 0, 239,
+  221, 90, 68, 21, 160, 104, 3, 184, 252, 205, 119, 89, 3, 104, 211, 175, 255,
+  229, 187, 207, 252, 250, 53, 198, 0, 116, 178, 225, 220, 197, 246, 190, 187,
+  24, 127, 98, 255, 44, 2, 20, 7, 96, 204, 56, 1, 244, 51, 29, 213, 58, 145,
+  50, 241, 211, 214, 175, 107, 174, 122, 232, 74, 176, 70, 234, 232, 47, 155,
+  118, 213, 93, 81, 243, 223, 24, 254, 54, 250, 199, 17, 12, 30, 218, 254,
+  53, 247, 135, 172, 250, 15, 156, 223, 206, 63, 64, 166, 236, 63, 238, 220,
+  255, 246, 138, 255, 19, 3, 218, 254, 125, 106, 115, 192, 16, 128, 39, 63,
+  248, 160, 94, 0, 239, 55, 22, 192, 193, 0, 128, 28, 0, 162, 95, 171, 78,
+  202, 69, 61, 0, 196, 89, 226, 136, 143, 184, 6, 26, 192, 148, 1, 234, 0,
+  109, 0, 238, 57, 120, 232, 104, 105, 121, 213, 187, 12, 255, 181, 5, 239,
+  252, 243, 119, 158, 126, 225, 213, 119, 231, 45, 167, 13, 160, 182, 246,
+  142, 158, 12, 45, 255, 145, 248, 111, 154, 196, 159, 214, 128, 181, 3, 0,
+  46, 128, 159, 129, 177, 92, 2, 168, 132, 170, 187, 63, 158, 128, 169, 159,
+  114, 255, 46, 222, 160, 12, 155, 30, 244, 136, 187, 243, 182, 110, 244, 29,
+  18, 14, 217, 187, 187, 174, 230, 29, 90, 64, 148, 246, 111, 142, 255, 60,
+  0, 127, 116, 28, 237, 255, 226, 249, 143, 136, 133, 127, 124, 8, 246, 127,
+  196, 193, 177, 5, 32, 35, 67, 104, 1, 180, 31, 110, 140, 178, 1, 112, 202,
+  0, 122, 205, 86, 0, 163, 175, 221, 10, 27, 192, 228, 139, 110, 208, 24, 129,
+  49, 192, 215, 138, 6, 240, 249, 230, 82, 198, 0, 65, 25, 96, 170, 106, 230,
+  204, 124, 159, 218, 127, 193, 124, 192, 0, 81, 113, 242, 130, 255, 74, 72,
+  224, 207, 11, 0, 172, 2, 0, 29, 128, 56, 0, 192, 9, 100, 98, 49, 172, 19,
+  105, 168, 5, 225, 210, 143, 149, 252, 113, 247, 159, 180, 22, 55, 162, 206,
+  18, 162, 133, 191, 56, 68, 97, 51, 119, 179, 238, 16, 107, 127, 16, 248,
+  127, 127, 222, 241, 47, 87, 18, 154, 48, 244, 31, 177, 255, 176, 146, 135,
+  225, 126, 251, 254, 247, 219, 254, 127, 88, 197, 127, 96, 1, 4, 14, 140,
+  180, 107, 5, 240, 142, 46, 196, 0, 124, 133, 213, 255, 240, 0, 64, 103, 57,
+  93, 0, 97, 246, 79, 25, 96, 154, 107, 10, 68, 1, 248, 88, 89, 229, 156, 233,
+  179, 151, 44, 91, 181, 126, 211, 218, 47, 127, 231, 39, 191, 122, 101, 250,
+  7, 203, 214, 111, 223, 95, 86, 127, 174, 121, 104, 128, 226, 79, 253, 255,
+  212, 251, 83, 238, 233, 11, 128, 135, 128, 234, 0, 112, 252, 217, 175, 64,
+  36, 18, 184, 202, 56, 212, 139, 192, 156, 193, 142, 232, 47, 27, 159, 196,
+  116, 141, 171, 219, 74, 33, 141, 229, 95, 200, 62, 229, 96, 159, 78, 2, 10,
+  43, 39, 254, 222, 227, 223, 194, 9, 37, 124, 30, 252, 127, 168, 254, 167,
+  238, 48, 159, 202, 255, 135, 124, 86, 252, 167, 253, 255, 72, 151, 90, 0,
+  81, 241, 159, 90, 0, 131, 13, 64, 27, 255, 171, 172, 0, 216, 204, 7, 0, 68,
+  144, 216, 89, 89, 86, 81, 121, 252, 56, 141, 255, 78, 211, 1, 128, 134, 2,
+  214, 0, 98, 27, 224, 75, 166, 207, 154, 187, 112, 249, 218, 162, 237, 95,
+  253, 238, 51, 207, 115, 6, 128, 189, 165, 117, 13, 167, 186, 110, 64, 252,
+  239, 223, 189, 203, 35, 64, 238, 0, 68, 18, 160, 93, 192, 56, 51, 255, 184,
+  188, 246, 117, 172, 109, 194, 143, 21, 3, 204, 228, 143, 166, 127, 216, 253,
+  71, 157, 238, 223, 42, 33, 97, 229, 17, 139, 252, 71, 205, 238, 230, 27,
+  32, 141, 224, 252, 207, 67, 63, 26, 143, 255, 82, 252, 241, 254, 151, 209,
+  62, 212, 45, 76, 246, 221, 125, 124, 1, 20, 231, 127, 96, 1, 44, 44, 7, 64,
+  164, 255, 183, 23, 128, 216, 125, 209, 105, 249, 127, 57, 0, 112, 67, 55,
+  128, 101, 146, 208, 209, 89, 75, 240, 39, 254, 191, 254, 84, 35, 253, 211,
+  166, 243, 5, 133, 114, 3, 188, 98, 195, 219, 188, 1, 80, 248, 165, 31, 60,
+  255, 210, 235, 51, 62, 88, 186, 110, 219, 158, 35, 21, 213, 173, 93, 151,
+  30, 21, 248, 79, 209, 1, 192, 109, 145, 2, 176, 3, 192, 162, 64, 225, 3,
+  200, 103, 66, 25, 126, 76, 9, 197, 41, 231, 159, 240, 162, 140, 214, 171,
+  227, 28, 255, 72, 72, 207, 143, 122, 87, 110, 16, 245, 63, 228, 142, 77,
+  135, 108, 234, 46, 199, 8, 178, 51, 133, 196, 241, 63, 90, 98, 116, 233,
+  199, 74, 252, 71, 180, 21, 27, 248, 59, 196, 15, 71, 6, 236, 252, 127, 212,
+  220, 27, 138, 68, 2, 54, 254, 131, 168, 1, 200, 240, 111, 215, 3, 192, 218,
+  254, 187, 52, 3, 20, 99, 128, 97, 71, 228, 132, 100, 128, 106, 160, 13, 192,
+  230, 150, 45, 140, 1, 102, 255, 193, 163, 165, 149, 219, 223, 97, 18, 208,
+  27, 182, 252, 224, 27, 63, 124, 246, 229, 121, 139, 150, 175, 223, 186, 107,
+  111, 89, 99, 107, 71, 163, 137, 63, 43, 1, 177, 11, 128, 133, 0, 19, 210,
+  3, 240, 3, 144, 142, 11, 125, 208, 56, 68, 95, 121, 91, 97, 180, 73, 196,
+  27, 103, 116, 254, 233, 135, 125, 115, 71, 227, 174, 197, 189, 164, 139,
+  123, 150, 105, 7, 4, 45, 246, 161, 104, 204, 61, 253, 143, 212, 31, 68, 252,
+  143, 218, 63, 249, 228, 95, 248, 1, 96, 246, 63, 34, 237, 223, 85, 255, 7,
+  249, 63, 249, 254, 35, 142, 254, 255, 168, 33, 0, 70, 158, 10, 10, 2, 56,
+  176, 0, 136, 20, 160, 253, 61, 138, 1, 26, 12, 0, 51, 252, 123, 93, 13, 192,
+  211, 36, 254, 147, 248, 159, 37, 7, 96, 91, 209, 246, 226, 93, 156, 1, 224,
+  32, 149, 0, 94, 178, 106, 195, 230, 23, 249, 6, 224, 242, 109, 69, 219, 142,
+  213, 54, 94, 236, 168, 125, 244, 17, 129, 63, 43, 0, 221, 147, 248, 203,
+  27, 128, 226, 79, 107, 193, 252, 8, 140, 197, 227, 88, 35, 82, 27, 127, 34,
+  137, 67, 127, 187, 244, 163, 241, 79, 11, 179, 9, 71, 245, 212, 173, 17,
+  254, 185, 230, 71, 48, 119, 120, 158, 233, 31, 195, 123, 163, 14, 98, 68,
+  153, 175, 71, 254, 111, 133, 33, 210, 255, 143, 170, 245, 31, 191, 155, 61,
+  64, 221, 255, 163, 3, 253, 168, 255, 227, 38, 0, 143, 132, 229, 0, 120, 95,
+  31, 90, 0, 81, 248, 223, 108, 131, 12, 144, 61, 64, 1, 114, 64, 217, 63,
+  103, 128, 96, 27, 192, 103, 202, 202, 217, 2, 24, 103, 0, 184, 208, 82, 188,
+  121, 219, 246, 189, 251, 14, 82, 255, 95, 69, 55, 128, 150, 172, 92, 191,
+  249, 221, 175, 62, 245, 243, 23, 95, 159, 249, 225, 226, 245, 229, 85, 245,
+  103, 46, 181, 31, 101, 229, 191, 135, 88, 252, 79, 43, 192, 188, 4, 72, 15,
+  192, 132, 136, 1, 101, 16, 64, 79, 64, 138, 11, 68, 10, 149, 64, 45, 20,
+  6, 50, 63, 139, 49, 220, 190, 253, 233, 244, 112, 222, 226, 159, 199, 236,
+  175, 186, 69, 82, 186, 246, 226, 234, 254, 184, 203, 63, 48, 254, 131, 234,
+  111, 121, 22, 136, 245, 133, 54, 60, 130, 172, 56, 0, 212, 35, 35, 54, 254,
+  1, 40, 0, 59, 12, 243, 127, 20, 255, 71, 240, 0, 32, 136, 255, 132, 2, 204,
+  128, 205, 0, 41, 20, 224, 6, 249, 0, 8, 31, 0, 146, 52, 113, 77, 101, 92,
+  2, 146, 42, 128, 211, 232, 112, 31, 109, 0, 237, 222, 119, 152, 252, 231,
+  154, 217, 51, 153, 4, 204, 166, 165, 95, 249, 238, 79, 95, 120, 229, 237,
+  247, 87, 22, 236, 60, 116, 190, 249, 114, 251, 30, 154, 254, 9, 252, 121,
+  2, 64, 51, 0, 30, 1, 112, 7, 32, 211, 0, 242, 145, 77, 72, 163, 71, 42, 129,
+  137, 164, 182, 126, 27, 126, 51, 247, 167, 225, 63, 26, 219, 180, 230, 118,
+  243, 204, 15, 73, 238, 96, 199, 232, 190, 35, 134, 176, 211, 255, 116, 38,
+  236, 100, 255, 119, 214, 127, 116, 3, 33, 233, 3, 252, 15, 1, 189, 199, 43,
+  239, 127, 131, 253, 62, 104, 10, 0, 203, 252, 63, 136, 8, 64, 34, 170, 255,
+  3, 23, 0, 128, 253, 15, 107, 252, 59, 186, 0, 3, 200, 32, 45, 0, 106, 6,
+  136, 43, 130, 1, 176, 181, 180, 188, 74, 74, 192, 83, 231, 112, 148, 227,
+  79, 37, 64, 142, 47, 122, 111, 46, 149, 128, 218, 84, 248, 47, 223, 254,
+  201, 179, 191, 21, 20, 176, 141, 189, 55, 182, 210, 242, 31, 207, 255, 105,
+  7, 136, 250, 255, 187, 183, 69, 4, 160, 14, 128, 60, 1, 201, 120, 66, 225,
+  14, 52, 34, 97, 217, 7, 131, 6, 199, 254, 52, 252, 44, 252, 135, 230, 239,
+  176, 92, 139, 183, 25, 190, 78, 194, 213, 186, 141, 198, 92, 220, 77, 198,
+  16, 18, 194, 223, 99, 5, 201, 225, 255, 147, 102, 252, 143, 217, 227, 204,
+  254, 79, 72, 231, 127, 64, 57, 220, 182, 255, 94, 102, 211, 61, 55, 241,
+  2, 128, 94, 0, 26, 225, 3, 64, 28, 255, 78, 208, 0, 24, 28, 108, 162, 245,
+  63, 230, 255, 117, 3, 160, 141, 110, 0, 242, 1, 16, 186, 1, 214, 82, 190,
+  181, 104, 71, 9, 199, 191, 106, 241, 187, 243, 151, 44, 95, 181, 126, 211,
+  182, 239, 125, 253, 71, 172, 0, 68, 41, 32, 235, 207, 246, 174, 99, 246,
+  175, 241, 191, 119, 247, 14, 112, 0, 183, 164, 3, 96, 103, 32, 45, 165, 1,
+  181, 219, 87, 96, 201, 120, 77, 135, 236, 41, 155, 55, 140, 71, 255, 116,
+  121, 76, 231, 237, 170, 139, 108, 187, 127, 71, 246, 199, 231, 7, 227, 48,
+  116, 11, 71, 141, 14, 98, 194, 80, 143, 193, 135, 40, 108, 169, 191, 120,
+  241, 71, 199, 65, 26, 2, 166, 184, 96, 253, 24, 136, 159, 130, 0, 36, 17,
+  210, 249, 223, 176, 15, 44, 128, 194, 1, 80, 26, 183, 222, 36, 246, 223,
+  173, 7, 192, 172, 1, 32, 127, 155, 182, 127, 184, 1, 70, 190, 242, 18, 221,
+  0, 98, 254, 95, 227, 127, 67, 75, 192, 80, 9, 176, 150, 138, 45, 91, 139,
+  247, 236, 61, 64, 27, 192, 85, 235, 232, 6, 192, 134, 130, 205, 133, 207,
+  126, 247, 233, 231, 95, 158, 49, 119, 233, 250, 109, 123, 75, 107, 79, 156,
+  91, 250, 8, 199, 127, 218, 20, 86, 0, 160, 254, 159, 71, 128, 60, 4, 4, 87,
+  192, 68, 86, 137, 3, 38, 128, 76, 32, 16, 10, 195, 214, 159, 74, 91, 156,
+  177, 194, 254, 51, 138, 114, 11, 214, 254, 173, 209, 63, 47, 225, 33, 193,
+  29, 9, 186, 127, 134, 246, 131, 199, 244, 31, 47, 68, 70, 28, 248, 135, 81,
+  251, 199, 53, 132, 98, 230, 127, 160, 254, 167, 50, 16, 253, 3, 68, 240,
+  252, 15, 180, 255, 128, 102, 29, 139, 68, 251, 186, 61, 23, 0, 249, 192,
+  248, 85, 30, 218, 137, 1, 0, 89, 43, 166, 29, 224, 54, 41, 1, 199, 7, 128,
+  217, 6, 88, 103, 69, 57, 218, 0, 56, 94, 64, 55, 64, 246, 31, 163, 125, 129,
+  173, 239, 206, 254, 112, 225, 178, 85, 155, 119, 191, 250, 125, 114, 255,
+  79, 159, 179, 100, 221, 214, 221, 135, 75, 235, 47, 127, 64, 241, 159, 246,
+  16, 176, 127, 134, 255, 29, 134, 255, 45, 153, 4, 176, 3, 192, 12, 42, 161,
+  228, 1, 161, 227, 79, 152, 98, 49, 128, 50, 24, 240, 134, 81, 251, 207, 177,
+  240, 47, 18, 182, 150, 199, 204, 209, 63, 115, 123, 4, 148, 144, 163, 230,
+  228, 86, 196, 181, 252, 229, 238, 32, 135, 117, 249, 199, 109, 255, 113,
+  71, 252, 7, 240, 87, 244, 1, 6, 255, 51, 8, 64, 18, 145, 126, 69, 231, 14,
+  5, 192, 213, 131, 180, 237, 76, 31, 235, 239, 102, 246, 127, 211, 30, 0,
+  21, 231, 229, 186, 104, 0, 118, 224, 13, 80, 74, 1, 73, 241, 87, 18, 64,
+  98, 72, 164, 174, 92, 73, 0, 80, 10, 232, 70, 53, 1, 94, 85, 179, 109, 230,
+  156, 15, 151, 172, 92, 91, 176, 237, 247, 207, 188, 240, 210, 107, 51, 230,
+  46, 89, 179, 185, 184, 164, 182, 177, 245, 93, 158, 254, 49, 252, 169, 253,
+  223, 19, 37, 192, 59, 183, 68, 21, 72, 28, 128, 137, 113, 174, 13, 168, 197,
+  1, 129, 227, 215, 104, 1, 139, 77, 165, 205, 203, 95, 152, 127, 46, 142,
+  162, 191, 24, 168, 219, 185, 139, 191, 214, 0, 73, 196, 12, 221, 188, 91,
+  8, 88, 61, 86, 250, 127, 84, 254, 205, 39, 64, 32, 239, 255, 81, 31, 196,
+  223, 31, 244, 234, 255, 241, 31, 32, 42, 155, 121, 130, 0, 0, 120, 14, 72,
+  0, 22, 25, 20, 67, 29, 230, 253, 47, 11, 192, 129, 142, 54, 180, 1, 174,
+  7, 0, 6, 187, 4, 254, 45, 98, 3, 244, 26, 173, 17, 156, 42, 171, 172, 172,
+  81, 20, 224, 77, 205, 91, 4, 5, 228, 145, 210, 138, 162, 153, 31, 204, 95,
+  188, 98, 77, 193, 246, 25, 223, 125, 250, 183, 179, 222, 251, 112, 241, 170,
+  117, 37, 71, 107, 78, 95, 124, 141, 152, 63, 177, 255, 169, 172, 1, 124,
+  95, 225, 207, 111, 0, 17, 2, 176, 60, 48, 45, 101, 161, 18, 248, 83, 70,
+  200, 41, 35, 239, 79, 1, 222, 192, 172, 34, 141, 100, 107, 68, 81, 156, 114,
+  69, 29, 219, 35, 249, 151, 71, 195, 216, 253, 187, 107, 72, 110, 245, 240,
+  116, 24, 180, 239, 189, 39, 8, 204, 50, 196, 168, 207, 174, 255, 65, 246,
+  72, 220, 255, 141, 202, 253, 255, 33, 184, 255, 103, 16, 192, 240, 6, 144,
+  84, 0, 215, 249, 63, 104, 0, 5, 186, 37, 3, 164, 46, 0, 138, 6, 240, 77,
+  222, 0, 144, 27, 0, 156, 2, 174, 145, 53, 128, 56, 254, 180, 0, 180, 147,
+  224, 207, 38, 0, 143, 85, 28, 124, 123, 230, 156, 21, 171, 215, 109, 220,
+  58, 247, 235, 63, 248, 197, 43, 179, 87, 44, 221, 88, 180, 247, 104, 205,
+  169, 150, 23, 121, 250, 199, 237, 255, 254, 189, 251, 119, 89, 6, 112, 231,
+  182, 40, 2, 49, 7, 64, 241, 207, 112, 89, 40, 245, 145, 192, 34, 113, 64,
+  43, 6, 38, 254, 142, 203, 63, 155, 203, 228, 97, 142, 208, 67, 119, 160,
+  133, 140, 133, 3, 201, 11, 133, 48, 245, 91, 4, 175, 32, 39, 188, 201, 159,
+  200, 139, 132, 2, 238, 246, 191, 83, 190, 88, 57, 162, 209, 17, 57, 255,
+  239, 161, 255, 13, 197, 3, 19, 81, 168, 255, 98, 229, 255, 26, 255, 17, 164,
+  0, 220, 15, 23, 192, 249, 253, 223, 195, 103, 59, 48, 3, 12, 189, 42, 134,
+  6, 206, 242, 13, 64, 89, 0, 102, 5, 160, 102, 18, 232, 241, 1, 16, 94, 0,
+  58, 176, 69, 106, 0, 87, 84, 189, 67, 11, 64, 171, 183, 22, 173, 249, 198,
+  247, 127, 250, 252, 203, 179, 86, 109, 223, 127, 168, 188, 182, 177, 233,
+  231, 15, 107, 255, 127, 95, 7, 0, 58, 2, 224, 30, 32, 203, 213, 96, 146,
+  232, 12, 164, 108, 219, 55, 212, 34, 56, 107, 36, 226, 13, 203, 101, 83,
+  112, 236, 31, 188, 231, 246, 242, 88, 210, 61, 64, 148, 177, 174, 255, 24,
+  226, 126, 202, 227, 69, 50, 233, 16, 8, 255, 140, 242, 143, 17, 137, 192,
+  50, 196, 168, 29, 255, 153, 243, 191, 128, 125, 60, 166, 235, 127, 62, 80,
+  57, 194, 4, 16, 228, 49, 63, 26, 0, 148, 3, 96, 62, 49, 0, 74, 30, 232, 147,
+  13, 32, 17, 255, 233, 6, 208, 32, 49, 127, 41, 1, 166, 54, 0, 46, 235, 2,
+  16, 197, 191, 185, 98, 115, 225, 118, 161, 1, 90, 53, 239, 93, 70, 1, 80,
+  80, 248, 157, 167, 158, 253, 237, 27, 179, 22, 172, 220, 119, 168, 244, 212,
+  249, 11, 63, 120, 152, 165, 255, 211, 232, 0, 160, 14, 0, 239, 222, 190,
+  163, 28, 0, 117, 1, 89, 122, 129, 38, 165, 50, 24, 7, 62, 165, 176, 55, 209,
+  79, 153, 132, 225, 128, 60, 38, 71, 174, 255, 72, 216, 105, 254, 208, 233,
+  26, 107, 27, 248, 250, 79, 27, 145, 155, 181, 62, 234, 189, 130, 156, 206,
+  4, 97, 247, 199, 197, 31, 227, 88, 255, 73, 165, 252, 122, 138, 195, 201,
+  255, 136, 239, 255, 248, 0, 170, 255, 88, 243, 159, 50, 255, 15, 116, 235,
+  1, 112, 205, 0, 60, 172, 20, 128, 2, 3, 226, 254, 111, 7, 12, 144, 60, 84,
+  28, 106, 230, 20, 192, 151, 100, 3, 128, 82, 0, 182, 151, 49, 10, 32, 70,
+  1, 70, 249, 65, 234, 55, 179, 9, 64, 74, 1, 81, 181, 154, 105, 192, 172,
+  222, 176, 237, 43, 63, 121, 233, 149, 183, 102, 205, 95, 89, 176, 183, 174,
+  182, 190, 241, 27, 212, 252, 149, 255, 23, 248, 75, 7, 32, 14, 192, 68, 46,
+  45, 180, 32, 146, 80, 28, 78, 255, 99, 40, 5, 233, 166, 15, 8, 253, 51, 138,
+  60, 34, 42, 223, 177, 8, 190, 253, 45, 167, 139, 129, 211, 212, 145, 41,
+  71, 228, 230, 26, 254, 196, 244, 129, 226, 20, 5, 45, 241, 199, 124, 252,
+  49, 242, 37, 252, 35, 154, 254, 201, 239, 80, 15, 70, 251, 223, 148, 1, 220,
+  41, 0, 143, 4, 32, 169, 4, 156, 92, 0, 133, 12, 224, 67, 130, 107, 148, 126,
+  163, 65, 230, 255, 69, 254, 143, 24, 160, 232, 4, 144, 164, 0, 109, 147,
+  254, 191, 179, 178, 92, 172, 0, 179, 9, 128, 139, 103, 182, 108, 227, 248,
+  31, 45, 175, 220, 54, 125, 214, 156, 5, 203, 215, 110, 220, 246, 179, 111,
+  63, 253, 187, 89, 115, 22, 174, 220, 184, 125, 239, 185, 234, 179, 95, 4,
+  248, 223, 231, 9, 0, 43, 1, 41, 252, 201, 9, 96, 138, 16, 41, 37, 10, 148,
+  212, 159, 201, 20, 186, 247, 83, 74, 49, 0, 82, 70, 131, 194, 47, 219, 33,
+  197, 73, 27, 106, 218, 227, 214, 127, 210, 146, 157, 229, 175, 149, 12, 121,
+  40, 255, 160, 214, 45, 110, 33, 43, 167, 20, 116, 138, 255, 185, 229, 195,
+  245, 21, 18, 208, 73, 188, 197, 255, 38, 246, 127, 161, 124, 201, 16, 199,
+  127, 216, 32, 128, 51, 250, 127, 145, 176, 176, 127, 115, 0, 84, 37, 128,
+  62, 225, 255, 219, 105, 253, 15, 225, 63, 116, 213, 152, 0, 103, 49, 226,
+  113, 54, 1, 86, 95, 79, 11, 0, 52, 60, 216, 180, 157, 22, 0, 15, 28, 58,
+  86, 90, 185, 239, 29, 166, 1, 178, 177, 240, 205, 111, 253, 248, 185, 223,
+  147, 88, 112, 99, 209, 174, 221, 109, 151, 254, 111, 142, 255, 212, 105,
+  83, 166, 10, 252, 101, 6, 192, 82, 0, 130, 254, 109, 193, 4, 13, 78, 128,
+  64, 61, 233, 80, 9, 75, 89, 132, 241, 16, 126, 138, 127, 42, 162, 28, 174,
+  85, 251, 137, 59, 162, 63, 139, 58, 40, 147, 240, 102, 126, 183, 195, 63,
+  51, 137, 8, 58, 201, 191, 157, 236, 175, 224, 254, 247, 139, 248, 207, 239,
+  86, 143, 6, 221, 67, 118, 2, 135, 101, 253, 207, 18, 128, 128, 253, 255,
+  72, 164, 91, 197, 255, 110, 252, 253, 87, 174, 182, 73, 255, 47, 241, 231,
+  27, 224, 67, 237, 231, 184, 4, 136, 160, 128, 100, 65, 66, 215, 169, 138,
+  138, 106, 80, 0, 106, 222, 94, 184, 109, 7, 235, 0, 146, 184, 96, 250, 204,
+  15, 22, 44, 91, 189, 161, 112, 49, 229, 0, 127, 107, 246, 134, 45, 133, 197,
+  165, 39, 186, 255, 151, 135, 57, 254, 83, 121, 3, 16, 92, 0, 28, 255, 219,
+  19, 156, 2, 50, 173, 68, 129, 82, 166, 60, 156, 148, 138, 82, 113, 95, 26,
+  242, 197, 43, 250, 48, 73, 31, 145, 176, 120, 163, 80, 237, 199, 194, 205,
+  94, 31, 136, 27, 205, 191, 136, 204, 254, 140, 9, 18, 196, 30, 47, 95, 38,
+  96, 222, 255, 15, 36, 31, 27, 128, 253, 127, 83, 61, 200, 234, 255, 197,
+  125, 178, 152, 99, 17, 128, 7, 0, 1, 80, 36, 170, 231, 63, 250, 0, 103, 140,
+  198, 63, 112, 141, 39, 128, 44, 255, 211, 13, 64, 26, 41, 116, 82, 128, 165,
+  4, 140, 156, 0, 58, 91, 198, 41, 96, 69, 1, 160, 101, 31, 77, 0, 246, 236,
+  63, 70, 242, 130, 234, 121, 179, 230, 82, 14, 232, 45, 69, 95, 251, 193,
+  207, 127, 243, 250, 204, 15, 86, 28, 60, 84, 90, 219, 246, 63, 42, 252, 167,
+  168, 4, 64, 93, 0, 228, 8, 140, 49, 54, 120, 110, 206, 82, 18, 72, 74, 131,
+  165, 176, 72, 88, 42, 13, 226, 126, 155, 48, 92, 114, 199, 68, 109, 230,
+  144, 88, 220, 158, 251, 55, 138, 63, 176, 135, 20, 133, 55, 55, 104, 33,
+  25, 215, 136, 179, 136, 144, 209, 228, 15, 193, 201, 22, 8, 192, 0, 97, 16,
+  210, 127, 250, 209, 250, 183, 11, 255, 17, 212, 255, 25, 65, 4, 48, 106,
+  110, 56, 18, 142, 246, 138, 250, 47, 26, 0, 135, 248, 223, 144, 248, 223,
+  0, 12, 32, 84, 2, 102, 176, 87, 80, 0, 43, 10, 32, 26, 36, 180, 148, 211,
+  9, 176, 250, 147, 13, 162, 0, 116, 140, 23, 0, 14, 29, 41, 171, 174, 93,
+  195, 240, 95, 191, 185, 232, 231, 223, 123, 230, 133, 151, 223, 154, 191,
+  106, 19, 249, 218, 186, 127, 160, 240, 67, 252, 89, 5, 128, 151, 0, 8, 252,
+  146, 11, 58, 35, 5, 65, 82, 80, 26, 76, 73, 132, 1, 145, 48, 44, 22, 130,
+  156, 63, 195, 63, 131, 224, 23, 23, 174, 73, 28, 4, 203, 118, 41, 107, 130,
+  40, 18, 50, 169, 195, 45, 241, 1, 60, 135, 14, 212, 131, 210, 38, 249, 83,
+  126, 252, 165, 128, 85, 96, 4, 211, 127, 6, 144, 252, 184, 37, 30, 57, 170,
+  226, 63, 69, 0, 138, 9, 32, 69, 3, 168, 175, 11, 46, 128, 12, 34, 5, 8, 94,
+  0, 188, 10, 6, 64, 186, 192, 6, 240, 96, 223, 185, 115, 138, 2, 86, 172,
+  9, 118, 116, 94, 41, 149, 19, 96, 108, 2, 176, 185, 110, 11, 229, 128, 102,
+  43, 128, 85, 133, 239, 127, 184, 112, 233, 202, 245, 155, 182, 189, 241,
+  173, 31, 61, 251, 218, 187, 243, 150, 111, 220, 94, 83, 221, 248, 223, 208,
+  238, 143, 194, 95, 84, 128, 233, 16, 8, 253, 16, 106, 0, 89, 73, 5, 174,
+  101, 161, 244, 49, 80, 216, 131, 126, 15, 142, 252, 50, 128, 56, 46, 151,
+  77, 70, 34, 81, 108, 180, 120, 237, 35, 145, 116, 237, 142, 163, 245, 17,
+  72, 219, 99, 243, 79, 90, 213, 191, 36, 210, 175, 245, 107, 237, 111, 103,
+  16, 105, 203, 7, 209, 215, 8, 90, 244, 47, 128, 128, 200, 38, 15, 242, 247,
+  195, 248, 95, 49, 135, 195, 193, 1, 246, 211, 15, 112, 5, 240, 94, 188, 0,
+  162, 24, 128, 89, 1, 80, 52, 128, 37, 254, 189, 114, 87, 252, 28, 69, 184,
+  69, 53, 0, 216, 150, 80, 71, 105, 133, 228, 0, 166, 13, 128, 139, 167, 233,
+  4, 40, 231, 128, 173, 44, 121, 119, 206, 146, 229, 171, 215, 109, 218, 250,
+  254, 183, 159, 166, 35, 192, 75, 214, 108, 62, 112, 161, 233, 239, 31, 18,
+  229, 31, 54, 0, 114, 255, 30, 204, 0, 5, 21, 52, 60, 0, 166, 50, 24, 50,
+  124, 224, 250, 211, 22, 99, 52, 191, 252, 41, 115, 156, 102, 142, 193, 185,
+  127, 60, 97, 82, 182, 88, 201, 63, 167, 162, 13, 161, 192, 93, 179, 144,
+  196, 49, 251, 124, 210, 226, 126, 52, 236, 63, 236, 193, 31, 231, 232, 32,
+  5, 25, 36, 154, 254, 49, 96, 220, 255, 70, 247, 32, 48, 224, 20, 128, 240,
+  195, 189, 65, 250, 109, 7, 209, 2, 8, 92, 0, 22, 7, 166, 143, 166, 246, 215,
+  218, 219, 209, 6, 104, 31, 251, 202, 102, 70, 1, 218, 204, 41, 160, 197,
+  6, 64, 87, 165, 224, 128, 23, 28, 160, 103, 10, 183, 23, 239, 218, 75, 252,
+  255, 177, 242, 170, 99, 51, 222, 251, 96, 225, 58, 226, 255, 215, 127, 251,
+  39, 191, 252, 221, 155, 179, 152, 8, 96, 251, 99, 34, 253, 227, 241, 63,
+  187, 255, 197, 16, 8, 157, 247, 226, 27, 223, 89, 168, 7, 33, 96, 86, 168,
+  131, 98, 31, 22, 10, 114, 195, 159, 11, 59, 121, 163, 242, 154, 191, 49,
+  65, 150, 134, 186, 15, 238, 213, 95, 237, 186, 205, 235, 63, 21, 112, 144,
+  191, 56, 240, 55, 42, 200, 33, 131, 254, 193, 92, 31, 66, 252, 223, 9, 58,
+  0, 50, 40, 170, 249, 6, 1, 32, 35, 0, 82, 126, 195, 71, 242, 63, 168, 0,
+  36, 226, 63, 109, 255, 3, 240, 254, 87, 5, 96, 86, 42, 190, 68, 253, 127,
+  83, 11, 15, 0, 185, 147, 232, 236, 58, 78, 252, 127, 13, 91, 1, 32, 9, 32,
+  113, 15, 91, 11, 183, 237, 220, 187, 255, 224, 97, 114, 47, 212, 254, 129,
+  4, 0, 203, 215, 108, 45, 222, 249, 237, 31, 17, 251, 231, 34, 80, 205, 247,
+  232, 242, 31, 173, 255, 77, 225, 5, 96, 97, 255, 183, 32, 11, 88, 54, 171,
+  79, 128, 244, 1, 25, 195, 234, 145, 80, 16, 8, 252, 97, 226, 159, 227, 217,
+  95, 212, 225, 253, 81, 240, 111, 50, 199, 128, 232, 159, 41, 15, 185, 179,
+  63, 249, 222, 163, 9, 162, 164, 57, 136, 156, 10, 32, 242, 135, 144, 197,
+  65, 224, 216, 254, 79, 9, 251, 183, 214, 127, 225, 252, 7, 208, 255, 73,
+  196, 195, 72, 0, 220, 7, 152, 99, 192, 253, 79, 62, 70, 180, 2, 108, 31,
+  226, 12, 150, 5, 227, 225, 171, 82, 2, 168, 67, 200, 69, 115, 95, 65, 110,
+  151, 54, 182, 1, 112, 81, 104, 64, 210, 2, 32, 185, 35, 26, 104, 3, 128,
+  81, 0, 176, 21, 176, 230, 61, 133, 76, 4, 242, 232, 49, 226, 23, 102, 207,
+  162, 5, 192, 130, 173, 251, 158, 251, 57, 157, 0, 88, 76, 69, 128, 170, 163,
+  148, 254, 111, 154, 142, 255, 40, 254, 124, 252, 91, 80, 128, 80, 61, 24,
+  77, 6, 47, 85, 129, 148, 56, 152, 130, 222, 16, 10, 194, 87, 191, 184, 251,
+  115, 140, 57, 46, 138, 103, 254, 17, 115, 136, 107, 101, 203, 92, 31, 74,
+  132, 156, 202, 131, 142, 217, 95, 228, 254, 249, 207, 152, 10, 104, 237,
+  95, 239, 9, 66, 131, 196, 52, 197, 236, 127, 20, 210, 63, 27, 47, 128, 221,
+  71, 34, 204, 251, 255, 90, 0, 12, 16, 64, 5, 64, 223, 200, 223, 141, 7, 0,
+  7, 192, 200, 48, 59, 47, 35, 84, 1, 68, 55, 128, 186, 123, 116, 175, 176,
+  93, 106, 192, 93, 230, 20, 112, 108, 74, 224, 44, 211, 0, 58, 193, 38, 192,
+  104, 0, 200, 18, 0, 198, 1, 80, 93, 179, 132, 248, 127, 90, 0, 216, 249,
+  252, 111, 126, 255, 6, 157, 0, 40, 220, 117, 184, 236, 230, 99, 124, 1, 128,
+  225, 63, 229, 62, 13, 253, 110, 211, 21, 240, 137, 91, 227, 19, 154, 6, 80,
+  145, 193, 107, 81, 32, 9, 121, 58, 163, 255, 113, 40, 197, 100, 0, 107, 40,
+  125, 33, 201, 28, 21, 243, 246, 254, 73, 99, 132, 84, 182, 145, 228, 8, 73,
+  28, 8, 207, 122, 244, 16, 221, 244, 1, 244, 71, 76, 6, 176, 246, 147, 199,
+  246, 143, 169, 96, 21, 26, 113, 249, 127, 180, 254, 13, 239, 255, 200, 128,
+  196, 82, 215, 255, 112, 230, 200, 239, 255, 128, 218, 234, 150, 13, 224,
+  65, 220, 0, 30, 21, 12, 224, 212, 182, 25, 5, 188, 210, 0, 31, 236, 58, 43,
+  19, 0, 74, 1, 35, 104, 2, 154, 249, 4, 224, 9, 182, 1, 64, 254, 180, 102,
+  11, 39, 129, 63, 82, 86, 94, 189, 110, 206, 135, 139, 8, 254, 91, 182, 191,
+  249, 253, 231, 222, 123, 127, 254, 178, 181, 133, 37, 7, 247, 94, 124, 236,
+  49, 177, 0, 192, 234, 63, 119, 239, 137, 249, 255, 9, 229, 0, 212, 1, 0,
+  130, 32, 105, 83, 29, 12, 96, 111, 73, 133, 0, 222, 200, 92, 10, 192, 31,
+  141, 99, 204, 172, 5, 18, 143, 1, 226, 40, 232, 253, 226, 177, 237, 88, 194,
+  169, 62, 97, 225, 143, 187, 191, 186, 26, 105, 92, 34, 224, 52, 134, 80,
+  250, 15, 239, 255, 136, 29, 255, 37, 226, 81, 113, 151, 171, 254, 15, 94,
+  0, 13, 170, 217, 69, 124, 255, 139, 154, 49, 103, 0, 225, 223, 235, 154,
+  160, 128, 162, 11, 128, 136, 2, 136, 22, 0, 46, 240, 2, 48, 11, 0, 121, 145,
+  232, 138, 152, 0, 59, 117, 170, 145, 18, 68, 181, 156, 220, 194, 56, 0, 14,
+  209, 0, 160, 248, 221, 247, 23, 175, 92, 67, 240, 95, 250, 212, 207, 126,
+  253, 222, 130, 101, 5, 69, 187, 246, 237, 59, 254, 24, 95, 0, 153, 58, 77,
+  227, 127, 135, 77, 255, 43, 18, 168, 156, 58, 0, 224, 4, 40, 97, 168, 180,
+  45, 18, 5, 74, 126, 144, 52, 150, 188, 200, 88, 204, 65, 27, 151, 176, 199,
+  254, 0, 99, 151, 189, 60, 28, 14, 67, 233, 49, 155, 182, 17, 87, 255, 140,
+  53, 196, 36, 110, 222, 217, 35, 4, 118, 13, 129, 254, 52, 97, 31, 220, 254,
+  6, 246, 47, 228, 231, 141, 248, 47, 46, 234, 191, 98, 254, 95, 50, 199, 107,
+  226, 96, 49, 0, 20, 1, 10, 80, 104, 0, 84, 6, 0, 129, 246, 171, 156, 2, 70,
+  196, 255, 189, 26, 127, 62, 1, 208, 220, 124, 73, 36, 0, 237, 215, 73, 252,
+  119, 181, 92, 76, 128, 52, 16, 252, 73, 2, 120, 97, 107, 81, 113, 201, 238,
+  253, 52, 1, 172, 42, 157, 49, 123, 222, 226, 85, 84, 21, 228, 169, 159, 190,
+  240, 218, 236, 53, 107, 55, 237, 44, 169, 62, 248, 24, 88, 0, 96, 20, 64,
+  119, 229, 254, 23, 96, 129, 227, 248, 231, 50, 82, 23, 44, 11, 0, 199, 234,
+  112, 58, 236, 67, 240, 11, 242, 184, 172, 120, 167, 32, 111, 152, 177, 60,
+  158, 242, 162, 14, 81, 55, 10, 74, 219, 243, 176, 71, 56, 233, 35, 226, 160,
+  250, 63, 137, 132, 85, 210, 229, 255, 17, 123, 32, 174, 31, 169, 18, 52,
+  121, 154, 243, 255, 170, 253, 143, 17, 91, 56, 154, 59, 158, 222, 46, 49,
+  0, 124, 211, 190, 255, 217, 19, 157, 87, 37, 5, 124, 7, 163, 128, 7, 179,
+  66, 77, 130, 3, 90, 172, 128, 176, 67, 114, 189, 130, 81, 0, 156, 164, 28,
+  224, 103, 233, 120, 24, 201, 255, 233, 10, 24, 45, 0, 212, 206, 161, 36,
+  224, 107, 10, 74, 118, 255, 230, 167, 191, 126, 101, 198, 220, 194, 205,
+  155, 118, 85, 21, 18, 247, 255, 200, 67, 24, 255, 59, 183, 177, 3, 128, 30,
+  64, 197, 1, 88, 26, 76, 9, 69, 217, 174, 31, 192, 79, 162, 255, 168, 81,
+  247, 53, 119, 62, 172, 219, 223, 90, 31, 74, 155, 209, 63, 174, 254, 192,
+  230, 159, 99, 129, 36, 166, 135, 191, 204, 229, 15, 115, 14, 25, 110, 33,
+  132, 71, 140, 241, 175, 80, 208, 185, 61, 40, 127, 136, 65, 192, 255, 229,
+  115, 224, 47, 47, 142, 126, 57, 0, 0, 25, 192, 244, 196, 112, 32, 208, 203,
+  55, 192, 110, 192, 2, 160, 248, 202, 75, 10, 127, 45, 2, 217, 85, 193, 10,
+  192, 245, 13, 180, 0, 68, 111, 135, 162, 162, 157, 123, 73, 248, 119, 132,
+  174, 134, 173, 164, 19, 0, 107, 54, 110, 45, 158, 249, 236, 139, 175, 78,
+  159, 179, 176, 112, 199, 190, 125, 203, 30, 123, 4, 44, 0, 128, 5, 64, 17,
+  1, 142, 143, 43, 26, 80, 37, 6, 144, 201, 106, 89, 40, 240, 139, 67, 38,
+  8, 94, 253, 57, 22, 253, 155, 240, 91, 177, 191, 21, 252, 155, 51, 100, 156,
+  59, 34, 108, 22, 127, 28, 155, 191, 142, 53, 116, 130, 127, 0, 152, 63, 236,
+  254, 199, 204, 5, 82, 85, 254, 167, 4, 160, 34, 134, 211, 235, 127, 46, 246,
+  24, 21, 255, 39, 6, 141, 253, 223, 17, 199, 252, 31, 189, 55, 6, 193, 0,
+  136, 32, 13, 98, 156, 1, 234, 1, 81, 0, 32, 208, 202, 0, 64, 145, 69, 94,
+  101, 20, 48, 205, 58, 1, 164, 9, 64, 29, 235, 0, 157, 100, 19, 96, 231, 154,
+  154, 46, 238, 222, 186, 163, 100, 223, 129, 163, 148, 27, 186, 118, 211,
+  251, 212, 254, 55, 22, 238, 152, 255, 163, 87, 222, 152, 62, 251, 195, 149,
+  7, 15, 20, 189, 247, 40, 31, 0, 159, 58, 141, 207, 127, 136, 4, 64, 51, 64,
+  140, 161, 3, 0, 36, 97, 50, 234, 42, 200, 102, 128, 80, 20, 82, 137, 66,
+  198, 159, 203, 101, 160, 245, 139, 21, 242, 132, 89, 176, 53, 64, 131, 35,
+  164, 236, 165, 227, 230, 181, 141, 154, 136, 198, 8, 145, 69, 64, 28, 133,
+  189, 123, 85, 253, 131, 221, 63, 172, 96, 41, 238, 144, 136, 32, 113, 5,
+  235, 191, 150, 252, 23, 188, 62, 134, 245, 252, 23, 98, 14, 193, 243, 127,
+  145, 200, 48, 95, 0, 18, 248, 179, 11, 64, 111, 128, 211, 175, 31, 150, 27,
+  32, 55, 204, 21, 224, 161, 235, 172, 1, 44, 38, 192, 88, 7, 128, 224, 223,
+  40, 87, 0, 196, 130, 224, 145, 194, 162, 29, 123, 246, 29, 62, 74, 175, 133,
+  189, 116, 5, 128, 38, 0, 235, 127, 248, 139, 87, 102, 189, 183, 120, 237,
+  166, 210, 61, 47, 63, 10, 6, 192, 165, 253, 11, 7, 0, 121, 64, 115, 250,
+  14, 200, 101, 244, 61, 128, 113, 207, 100, 177, 231, 199, 232, 231, 114,
+  201, 168, 236, 213, 128, 161, 15, 60, 174, 49, 249, 246, 104, 52, 108, 78,
+  126, 70, 29, 117, 36, 220, 252, 209, 248, 71, 130, 38, 119, 139, 131, 131,
+  200, 92, 32, 75, 73, 251, 247, 88, 255, 142, 154, 241, 127, 98, 24, 239,
+  255, 162, 254, 127, 144, 15, 158, 176, 131, 55, 138, 25, 0, 225, 6, 40, 143,
+  24, 71, 174, 74, 10, 96, 161, 1, 163, 3, 128, 78, 26, 225, 177, 248, 159,
+  77, 0, 242, 49, 193, 150, 114, 209, 1, 34, 14, 128, 58, 135, 106, 26, 0,
+  238, 221, 127, 232, 88, 85, 237, 137, 242, 57, 243, 232, 4, 216, 230, 237,
+  37, 79, 63, 253, 220, 75, 243, 151, 174, 221, 84, 84, 251, 243, 71, 36, 254,
+  116, 1, 252, 62, 196, 95, 19, 1, 143, 75, 6, 72, 94, 10, 202, 169, 91, 0,
+  127, 26, 142, 31, 251, 254, 49, 198, 27, 12, 172, 223, 197, 28, 148, 194,
+  13, 59, 231, 242, 120, 4, 14, 237, 88, 209, 191, 199, 234, 151, 154, 32,
+  14, 123, 13, 255, 217, 203, 255, 176, 134, 20, 65, 237, 31, 56, 198, 23,
+  14, 187, 200, 35, 70, 148, 0, 16, 152, 255, 50, 227, 63, 242, 152, 159, 199,
+  255, 120, 3, 92, 6, 0, 236, 155, 113, 118, 79, 93, 0, 208, 1, 64, 175, 228,
+  128, 191, 44, 38, 192, 41, 254, 215, 25, 7, 8, 37, 1, 103, 42, 240, 45, 13,
+  116, 2, 108, 207, 129, 131, 71, 75, 43, 106, 106, 22, 46, 94, 66, 19, 192,
+  162, 157, 175, 254, 240, 151, 47, 79, 95, 176, 118, 229, 230, 202, 111, 61,
+  42, 7, 192, 167, 224, 5, 80, 137, 255, 132, 162, 1, 205, 97, 73, 24, 32,
+  12, 149, 113, 73, 68, 153, 198, 63, 70, 146, 127, 69, 26, 170, 102, 53, 12,
+  238, 16, 163, 241, 163, 251, 9, 106, 134, 48, 19, 182, 116, 199, 163, 49,
+  179, 247, 107, 101, 255, 106, 17, 53, 108, 239, 126, 57, 214, 208, 172, 1,
+  242, 168, 197, 254, 234, 150, 255, 146, 73, 200, 168, 178, 127, 45, 0, 235,
+  55, 22, 71, 232, 99, 129, 30, 189, 0, 134, 72, 35, 20, 101, 240, 245, 171,
+  18, 218, 46, 65, 23, 44, 87, 128, 135, 148, 8, 244, 101, 65, 20, 77, 125,
+  68, 133, 32, 129, 229, 59, 160, 205, 44, 1, 220, 123, 128, 114, 64, 84, 215,
+  190, 55, 127, 245, 218, 245, 155, 8, 254, 115, 158, 126, 238, 247, 111, 206,
+  252, 96, 227, 206, 210, 207, 62, 98, 225, 47, 247, 255, 56, 3, 200, 248,
+  196, 152, 214, 131, 81, 151, 64, 78, 192, 156, 201, 90, 31, 90, 36, 8, 194,
+  79, 201, 67, 99, 70, 232, 103, 195, 143, 22, 200, 220, 230, 159, 10, 163,
+  189, 47, 167, 246, 156, 25, 254, 129, 50, 66, 136, 218, 46, 102, 15, 117,
+  74, 24, 26, 37, 228, 168, 15, 179, 63, 57, 228, 223, 229, 248, 23, 59, 133,
+  126, 89, 255, 245, 65, 2, 48, 11, 255, 72, 24, 16, 192, 184, 11, 0, 29, 87,
+  181, 6, 152, 44, 0, 48, 17, 248, 193, 161, 102, 53, 1, 112, 185, 141, 175,
+  128, 147, 24, 161, 158, 216, 63, 87, 129, 111, 100, 26, 241, 59, 11, 105,
+  3, 224, 224, 145, 210, 202, 170, 218, 229, 179, 63, 92, 81, 176, 169, 104,
+  251, 174, 13, 79, 255, 242, 165, 87, 223, 156, 191, 254, 192, 129, 255, 34,
+  247, 63, 17, 254, 240, 2, 152, 24, 7, 7, 96, 44, 11, 37, 97, 128, 52, 148,
+  250, 95, 57, 47, 244, 115, 233, 152, 17, 250, 97, 123, 77, 56, 42, 127, 14,
+  238, 136, 132, 85, 251, 3, 209, 4, 34, 33, 196, 19, 228, 26, 127, 180, 187,
+  231, 36, 160, 183, 233, 131, 162, 146, 253, 111, 52, 224, 156, 31, 68, 211,
+  131, 228, 167, 8, 12, 74, 254, 111, 21, 255, 139, 250, 47, 156, 255, 96,
+  19, 96, 170, 254, 3, 36, 192, 212, 200, 104, 32, 208, 163, 53, 224, 58, 17,
+  5, 216, 224, 96, 171, 156, 0, 101, 35, 224, 124, 74, 160, 187, 177, 146,
+  139, 128, 48, 21, 88, 130, 255, 17, 74, 2, 72, 11, 0, 229, 149, 53, 155,
+  223, 39, 1, 224, 250, 29, 197, 187, 119, 62, 243, 203, 223, 189, 58, 107,
+  209, 170, 162, 195, 255, 32, 174, 127, 141, 255, 61, 190, 254, 131, 72, 224,
+  198, 198, 21, 17, 52, 86, 132, 209, 160, 35, 129, 40, 236, 249, 5, 111, 112,
+  28, 112, 198, 198, 93, 148, 193, 110, 226, 168, 52, 30, 35, 138, 121, 11,
+  79, 91, 147, 223, 14, 250, 16, 107, 247, 203, 67, 126, 24, 6, 145, 28, 127,
+  211, 255, 59, 243, 63, 137, 127, 144, 181, 255, 21, 255, 183, 23, 1, 72,
+  52, 210, 219, 99, 51, 128, 194, 6, 64, 160, 31, 22, 0, 186, 165, 8, 228,
+  64, 63, 121, 249, 107, 231, 152, 8, 232, 37, 41, 2, 69, 59, 128, 221, 77,
+  116, 5, 156, 221, 255, 172, 3, 212, 82, 199, 119, 0, 143, 80, 117, 248, 221,
+  51, 223, 159, 79, 18, 128, 226, 253, 7, 158, 121, 225, 119, 51, 102, 47,
+  88, 179, 165, 252, 191, 230, 251, 127, 211, 196, 252, 167, 76, 0, 238, 168,
+  229, 47, 73, 2, 136, 228, 32, 178, 57, 160, 9, 164, 175, 251, 172, 58, 24,
+  26, 255, 49, 9, 127, 198, 160, 139, 199, 204, 81, 112, 139, 204, 24, 250,
+  87, 154, 65, 172, 151, 20, 193, 181, 63, 67, 122, 210, 228, 253, 51, 71,
+  8, 211, 60, 116, 51, 217, 131, 35, 30, 195, 159, 60, 253, 75, 166, 25, 254,
+  58, 253, 243, 160, 127, 137, 234, 233, 145, 208, 128, 212, 127, 212, 251,
+  191, 6, 1, 16, 127, 174, 175, 167, 7, 48, 128, 225, 1, 64, 208, 1, 150, 1,
+  0, 154, 0, 234, 144, 43, 64, 42, 0, 36, 1, 192, 229, 138, 106, 106, 255,
+  13, 162, 3, 216, 114, 78, 116, 0, 143, 148, 85, 85, 151, 209, 10, 240, 202,
+  13, 133, 59, 14, 255, 250, 215, 175, 206, 92, 176, 108, 237, 150, 61, 15,
+  137, 235, 95, 205, 127, 243, 225, 47, 225, 0, 38, 104, 17, 104, 98, 28, 113,
+  193, 107, 31, 128, 149, 161, 178, 24, 250, 172, 252, 66, 73, 30, 158, 136,
+  197, 244, 184, 31, 156, 247, 198, 51, 127, 58, 96, 135, 211, 4, 186, 151,
+  28, 206, 147, 252, 155, 163, 95, 136, 137, 130, 159, 37, 59, 252, 183, 170,
+  255, 166, 120, 28, 125, 149, 168, 50, 97, 39, 253, 143, 177, 255, 79, 241,
+  31, 132, 252, 191, 96, 115, 28, 45, 0, 71, 35, 3, 106, 0, 176, 15, 51, 0,
+  74, 251, 247, 195, 2, 0, 228, 128, 26, 28, 234, 61, 7, 68, 224, 174, 138,
+  49, 177, 246, 178, 202, 234, 186, 227, 82, 4, 160, 169, 165, 101, 7, 219,
+  1, 164, 50, 64, 85, 117, 239, 207, 89, 64, 151, 192, 183, 238, 124, 249,
+  173, 233, 51, 231, 172, 216, 184, 181, 56, 131, 246, 63, 49, 1, 128, 114,
+  0, 154, 9, 154, 82, 64, 27, 162, 64, 226, 16, 64, 133, 40, 246, 235, 152,
+  186, 248, 217, 63, 217, 168, 77, 24, 29, 79, 232, 153, 15, 131, 61, 0, 239,
+  252, 232, 73, 130, 116, 190, 232, 47, 158, 240, 92, 31, 23, 246, 159, 10,
+  56, 221, 63, 150, 126, 142, 227, 225, 63, 250, 58, 49, 153, 194, 251, 29,
+  226, 225, 17, 155, 60, 50, 108, 243, 191, 57, 132, 35, 200, 115, 67, 70,
+  254, 47, 115, 70, 45, 25, 115, 13, 21, 0, 122, 192, 4, 192, 160, 160, 128,
+  80, 5, 96, 246, 53, 85, 52, 1, 96, 5, 96, 74, 2, 221, 210, 178, 79, 238,
+  128, 149, 85, 213, 44, 251, 112, 193, 146, 21, 107, 55, 20, 238, 124, 251,
+  217, 247, 230, 47, 88, 178, 122, 103, 241, 232, 195, 78, 252, 229, 242, 151,
+  224, 1, 158, 144, 4, 128, 82, 15, 4, 8, 194, 100, 193, 191, 70, 204, 39,
+  224, 103, 188, 209, 9, 228, 251, 141, 158, 175, 89, 248, 67, 183, 63, 28,
+  37, 201, 37, 20, 113, 164, 123, 129, 36, 233, 221, 251, 165, 248, 39, 241,
+  236, 151, 61, 252, 21, 115, 11, 208, 68, 71, 71, 244, 246, 79, 112, 178,
+  241, 255, 120, 34, 170, 201, 28, 134, 71, 140, 252, 31, 120, 142, 104, 196,
+  167, 240, 151, 18, 128, 67, 50, 254, 19, 79, 220, 208, 20, 32, 154, 3, 146,
+  47, 11, 94, 144, 246, 47, 87, 64, 40, 254, 39, 120, 2, 216, 112, 234, 44,
+  155, 0, 185, 84, 90, 180, 131, 217, 255, 177, 178, 202, 154, 194, 89, 243,
+  151, 174, 88, 83, 176, 181, 120, 237, 143, 158, 155, 185, 118, 205, 218,
+  130, 93, 29, 112, 255, 135, 51, 192, 73, 252, 1, 13, 236, 4, 164, 1, 206,
+  233, 64, 48, 199, 132, 194, 115, 166, 64, 148, 97, 250, 244, 51, 139, 172,
+  63, 129, 66, 63, 197, 30, 2, 208, 79, 101, 240, 206, 151, 204, 49, 226, 104,
+  240, 39, 143, 251, 183, 181, 135, 233, 107, 37, 208, 234, 175, 61, 65, 238,
+  88, 254, 98, 37, 228, 40, 158, 254, 193, 243, 35, 142, 252, 63, 14, 230,
+  191, 70, 16, 255, 19, 190, 255, 35, 163, 124, 0, 216, 100, 128, 212, 241,
+  95, 160, 139, 251, 255, 14, 78, 1, 37, 69, 0, 233, 4, 24, 75, 0, 46, 48,
+  14, 192, 203, 109, 106, 4, 244, 140, 76, 0, 78, 159, 97, 12, 113, 117, 91,
+  139, 233, 8, 240, 225, 163, 229, 21, 53, 71, 254, 48, 103, 222, 234, 245,
+  4, 255, 221, 191, 120, 246, 165, 15, 214, 109, 221, 188, 166, 73, 132, 127,
+  38, 254, 154, 4, 242, 150, 226, 0, 52, 212, 32, 160, 40, 16, 14, 246, 149,
+  84, 140, 176, 253, 28, 231, 141, 213, 29, 31, 73, 30, 134, 173, 31, 19, 71,
+  57, 114, 63, 30, 254, 225, 210, 175, 73, 30, 226, 57, 67, 198, 94, 44, 110,
+  11, 127, 217, 61, 100, 123, 130, 56, 29, 17, 20, 14, 80, 252, 197, 28, 31,
+  71, 211, 195, 176, 254, 3, 237, 31, 20, 31, 216, 115, 1, 208, 212, 135, 18,
+  176, 170, 100, 20, 236, 225, 26, 176, 144, 2, 234, 38, 103, 11, 24, 186,
+  38, 2, 64, 37, 2, 67, 59, 128, 77, 148, 4, 242, 56, 47, 0, 157, 107, 186,
+  120, 233, 28, 245, 255, 7, 14, 82, 251, 175, 174, 157, 67, 73, 0, 182, 144,
+  140, 112, 214, 207, 127, 243, 250, 226, 141, 59, 54, 212, 61, 44, 211, 63,
+  136, 63, 219, 255, 190, 133, 89, 64, 225, 9, 144, 114, 32, 250, 42, 24, 131,
+  208, 171, 152, 143, 161, 47, 205, 31, 20, 125, 64, 222, 143, 9, 195, 93,
+  240, 235, 166, 82, 142, 86, 255, 112, 199, 62, 106, 77, 144, 99, 22, 210,
+  52, 230, 142, 142, 233, 217, 63, 83, 128, 196, 33, 64, 148, 80, 63, 88, 212,
+  156, 254, 129, 243, 35, 81, 27, 255, 196, 224, 32, 158, 255, 52, 238, 127,
+  57, 255, 17, 13, 41, 6, 72, 204, 0, 164, 240, 15, 244, 113, 255, 223, 193,
+  39, 128, 101, 1, 152, 114, 64, 12, 118, 210, 9, 32, 166, 2, 221, 170, 236,
+  191, 243, 42, 221, 1, 167, 43, 128, 180, 0, 116, 190, 169, 165, 117, 123,
+  49, 247, 255, 229, 149, 85, 117, 235, 222, 159, 191, 100, 197, 186, 109,
+  59, 119, 111, 250, 217, 11, 175, 206, 88, 185, 126, 231, 33, 62, 255, 45,
+  249, 31, 238, 235, 233, 255, 219, 154, 6, 216, 166, 130, 215, 130, 48, 242,
+  8, 140, 161, 79, 229, 247, 197, 47, 9, 68, 25, 157, 208, 117, 186, 7, 128,
+  95, 231, 126, 172, 250, 7, 231, 126, 162, 249, 181, 71, 173, 232, 63, 27,
+  149, 240, 219, 226, 1, 81, 87, 21, 9, 225, 239, 10, 255, 60, 180, 35, 19,
+  67, 131, 96, 255, 211, 88, 0, 135, 254, 63, 194, 251, 191, 55, 251, 28, 18,
+  80, 28, 255, 1, 148, 255, 179, 21, 192, 155, 172, 0, 56, 52, 120, 147, 77,
+  0, 181, 136, 14, 16, 223, 19, 236, 234, 18, 50, 208, 84, 5, 146, 81, 196,
+  237, 46, 218, 189, 103, 31, 173, 0, 87, 214, 214, 237, 126, 127, 62, 37,
+  129, 40, 218, 123, 224, 197, 231, 95, 126, 235, 189, 21, 133, 69, 114, 253,
+  219, 216, 255, 190, 173, 24, 128, 60, 14, 128, 58, 2, 74, 24, 10, 90, 189,
+  118, 252, 236, 35, 3, 92, 191, 246, 253, 218, 85, 67, 238, 24, 144, 250,
+  89, 183, 63, 165, 142, 138, 96, 243, 143, 187, 201, 99, 140, 189, 111, 233,
+  255, 35, 112, 246, 195, 65, 253, 128, 134, 255, 188, 240, 215, 3, 4, 33,
+  99, 123, 84, 151, 143, 135, 101, 254, 239, 3, 4, 192, 126, 107, 254, 39,
+  18, 237, 237, 86, 10, 16, 186, 0, 168, 74, 198, 1, 127, 112, 88, 80, 64,
+  73, 10, 80, 54, 1, 202, 11, 192, 131, 98, 5, 164, 181, 85, 145, 0, 147, 67,
+  114, 156, 114, 128, 48, 18, 32, 142, 127, 233, 182, 29, 59, 153, 255, 175,
+  168, 170, 171, 154, 75, 236, 127, 77, 65, 97, 241, 193, 15, 158, 255, 237,
+  107, 111, 44, 221, 178, 154, 186, 127, 78, 255, 36, 226, 127, 196, 0, 117,
+  91, 49, 128, 161, 3, 48, 174, 229, 96, 244, 33, 0, 192, 231, 52, 244, 99,
+  92, 52, 34, 174, 110, 254, 184, 201, 24, 172, 18, 255, 52, 106, 251, 216,
+  169, 63, 241, 0, 81, 171, 241, 235, 82, 30, 183, 246, 126, 213, 235, 133,
+  117, 244, 47, 154, 255, 222, 35, 100, 80, 196, 52, 234, 34, 127, 178, 201,
+  3, 53, 254, 190, 1, 237, 254, 193, 234, 160, 108, 0, 232, 198, 241, 77, 177,
+  0, 166, 253, 63, 216, 0, 29, 37, 223, 204, 47, 27, 0, 106, 3, 76, 78, 139,
+  14, 13, 53, 241, 4, 224, 34, 141, 255, 229, 8, 120, 247, 105, 58, 2, 204,
+  59, 192, 108, 67, 236, 56, 77, 0, 246, 29, 97, 234, 176, 199, 23, 46, 92,
+  178, 114, 45, 85, 6, 46, 120, 225, 165, 151, 222, 153, 177, 225, 67, 113,
+  253, 3, 255, 207, 215, 127, 213, 5, 96, 210, 0, 11, 23, 48, 174, 124, 123,
+  14, 168, 67, 229, 198, 176, 225, 115, 217, 144, 20, 16, 11, 192, 129, 63,
+  226, 142, 210, 137, 191, 65, 27, 168, 162, 191, 12, 99, 77, 152, 124, 127,
+  16, 246, 17, 69, 239, 143, 191, 94, 200, 202, 254, 28, 11, 132, 104, 19,
+  77, 197, 127, 35, 246, 244, 111, 216, 78, 255, 37, 254, 35, 154, 255, 11,
+  43, 135, 168, 5, 96, 49, 190, 222, 15, 6, 64, 251, 197, 0, 56, 164, 0, 10,
+  4, 174, 67, 17, 88, 40, 2, 57, 56, 116, 89, 146, 128, 203, 14, 16, 77, 0,
+  154, 184, 10, 84, 3, 35, 1, 187, 208, 76, 2, 192, 162, 146, 61, 36, 1, 40,
+  167, 212, 48, 5, 31, 44, 90, 189, 182, 160, 112, 123, 201, 222, 103, 95,
+  124, 245, 181, 153, 107, 222, 150, 248, 79, 225, 252, 63, 124, 253, 23, 51,
+  64, 77, 104, 34, 240, 9, 36, 6, 161, 85, 161, 224, 93, 143, 44, 159, 105,
+  136, 198, 229, 104, 54, 76, 251, 224, 192, 71, 50, 101, 112, 198, 234, 13,
+  82, 24, 252, 147, 235, 95, 122, 108, 147, 59, 198, 99, 138, 200, 36, 143,
+  179, 137, 191, 76, 252, 19, 174, 9, 242, 116, 100, 212, 33, 254, 96, 113,
+  199, 3, 238, 176, 81, 160, 255, 163, 243, 63, 63, 18, 142, 96, 248, 15, 136,
+  252, 95, 75, 192, 10, 6, 24, 209, 0, 14, 6, 110, 92, 187, 202, 235, 127,
+  124, 2, 76, 80, 64, 176, 89, 177, 235, 124, 2, 64, 142, 0, 112, 252, 47,
+  211, 189, 110, 146, 0, 112, 18, 168, 166, 150, 75, 59, 118, 236, 220, 181,
+  247, 192, 145, 210, 178, 154, 250, 147, 123, 230, 45, 90, 182, 154, 206,
+  0, 239, 249, 221, 175, 95, 121, 107, 246, 194, 223, 232, 240, 15, 248, 127,
+  116, 1, 32, 18, 80, 237, 2, 198, 149, 36, 16, 198, 60, 55, 166, 197, 130,
+  248, 57, 73, 138, 166, 154, 219, 247, 187, 120, 227, 208, 194, 23, 88, 33,
+  139, 135, 77, 243, 143, 219, 165, 127, 199, 24, 129, 220, 32, 72, 67, 222,
+  119, 175, 25, 34, 7, 15, 65, 218, 138, 255, 45, 255, 111, 112, 7, 250, 7,
+  33, 255, 59, 174, 255, 194, 201, 177, 232, 176, 92, 0, 235, 71, 247, 191,
+  214, 12, 12, 118, 93, 83, 13, 96, 153, 0, 242, 248, 111, 104, 168, 139, 171,
+  64, 170, 29, 80, 218, 1, 234, 234, 40, 167, 29, 96, 182, 3, 196, 57, 226,
+  247, 21, 49, 18, 152, 163, 101, 85, 53, 39, 42, 23, 44, 89, 182, 122, 253,
+  150, 29, 59, 75, 62, 248, 201, 43, 179, 231, 190, 255, 244, 195, 124, 253,
+  15, 172, 127, 41, 252, 69, 10, 8, 67, 0, 67, 14, 4, 156, 0, 108, 242, 242,
+  55, 250, 101, 25, 149, 157, 57, 141, 63, 105, 132, 126, 158, 177, 31, 165,
+  142, 50, 34, 118, 60, 247, 101, 68, 127, 105, 99, 244, 131, 9, 7, 32, 252,
+  237, 179, 228, 22, 143, 224, 248, 251, 29, 219, 127, 162, 129, 108, 47, 143,
+  6, 248, 248, 183, 232, 255, 143, 142, 32, 252, 117, 3, 152, 22, 0, 123, 1,
+  3, 168, 163, 1, 16, 184, 121, 245, 106, 187, 72, 0, 24, 95, 212, 77, 53,
+  1, 52, 220, 199, 57, 0, 85, 7, 128, 21, 0, 186, 234, 248, 14, 192, 233, 211,
+  103, 104, 5, 232, 226, 165, 138, 109, 116, 6, 244, 48, 101, 1, 172, 171,
+  94, 188, 124, 213, 154, 245, 36, 0, 220, 187, 234, 23, 191, 155, 51, 103,
+  254, 55, 69, 248, 103, 226, 175, 50, 0, 200, 2, 59, 14, 93, 128, 60, 1, 218,
+  15, 140, 143, 65, 224, 199, 164, 151, 64, 50, 49, 50, 236, 7, 124, 225, 158,
+  240, 3, 239, 207, 251, 139, 25, 52, 174, 23, 53, 183, 199, 77, 253, 177,
+  180, 229, 254, 19, 32, 114, 247, 26, 34, 112, 138, 71, 68, 141, 229, 127,
+  115, 251, 15, 176, 63, 242, 23, 8, 34, 254, 71, 167, 0, 28, 255, 246, 163,
+  172, 0, 220, 7, 20, 0, 192, 6, 32, 59, 50, 3, 106, 3, 68, 139, 192, 246,
+  9, 182, 24, 46, 2, 200, 18, 0, 209, 1, 38, 14, 224, 180, 78, 0, 152, 255,
+  63, 85, 180, 163, 132, 206, 128, 150, 149, 87, 213, 28, 95, 176, 112, 205,
+  186, 13, 27, 183, 20, 237, 218, 247, 194, 239, 94, 91, 186, 232, 115, 58,
+  252, 83, 248, 203, 0, 16, 81, 0, 154, 7, 64, 221, 2, 250, 20, 128, 127, 199,
+  199, 212, 159, 166, 144, 86, 68, 18, 10, 197, 128, 134, 47, 136, 252, 81,
+  236, 135, 246, 135, 147, 154, 57, 204, 216, 31, 5, 45, 91, 247, 2, 89, 90,
+  226, 31, 12, 57, 138, 255, 30, 244, 81, 122, 129, 36, 234, 154, 254, 9, 1,
+  10, 34, 212, 63, 78, 196, 147, 65, 224, 254, 85, 252, 143, 251, 191, 252,
+  246, 9, 194, 6, 144, 28, 26, 135, 3, 0, 129, 225, 171, 156, 221, 227, 134,
+  246, 255, 138, 45, 160, 153, 77, 128, 180, 138, 251, 159, 39, 0, 93, 205,
+  92, 6, 86, 36, 0, 205, 23, 155, 168, 12, 16, 9, 0, 233, 12, 120, 93, 193,
+  156, 121, 171, 10, 54, 23, 22, 239, 222, 255, 202, 75, 211, 23, 44, 249,
+  95, 133, 249, 243, 251, 255, 158, 78, 0, 5, 5, 36, 37, 0, 187, 165, 137,
+  224, 133, 18, 128, 62, 0, 224, 12, 140, 155, 200, 179, 127, 178, 72, 38,
+  6, 80, 70, 167, 28, 45, 31, 51, 243, 211, 133, 63, 214, 98, 140, 1, 209,
+  0, 199, 212, 247, 164, 209, 31, 211, 141, 87, 189, 191, 176, 199, 2, 89,
+  220, 84, 177, 78, 211, 248, 79, 220, 224, 126, 180, 62, 174, 215, 16, 20,
+  5, 133, 120, 133, 16, 24, 255, 55, 87, 199, 81, 254, 31, 214, 13, 32, 36,
+  1, 235, 147, 108, 99, 65, 63, 107, 0, 128, 21, 48, 109, 255, 67, 173, 106,
+  5, 180, 141, 110, 10, 243, 0, 240, 10, 235, 0, 156, 228, 44, 192, 23, 200,
+  159, 150, 20, 237, 220, 183, 255, 224, 225, 99, 36, 3, 56, 190, 103, 246,
+  135, 243, 87, 109, 161, 75, 65, 239, 190, 246, 206, 187, 139, 254, 163, 10,
+  255, 57, 253, 3, 47, 0, 171, 0, 0, 145, 192, 138, 44, 64, 159, 128, 49, 253,
+  57, 134, 220, 129, 58, 27, 227, 99, 113, 4, 62, 52, 126, 67, 42, 38, 229,
+  224, 141, 51, 232, 3, 194, 154, 59, 38, 223, 237, 159, 242, 148, 31, 140,
+  160, 194, 141, 139, 248, 209, 89, 253, 75, 211, 254, 159, 223, 73, 254, 230,
+  165, 29, 22, 6, 227, 159, 152, 57, 20, 46, 0, 208, 7, 249, 0, 176, 14, 0,
+  65, 253, 71, 84, 140, 104, 252, 39, 19, 0, 49, 1, 46, 241, 191, 46, 10, 128,
+  151, 164, 10, 40, 139, 18, 202, 121, 7, 136, 235, 0, 54, 183, 92, 58, 178,
+  157, 206, 128, 30, 161, 29, 128, 250, 210, 217, 243, 22, 173, 88, 187, 109,
+  207, 254, 195, 107, 94, 124, 103, 198, 188, 255, 118, 154, 100, 255, 128,
+  254, 31, 92, 0, 198, 13, 160, 213, 64, 212, 17, 0, 112, 67, 224, 249, 159,
+  37, 245, 181, 111, 72, 69, 8, 6, 193, 52, 44, 250, 2, 202, 216, 140, 205,
+  30, 145, 138, 0, 238, 152, 104, 158, 245, 113, 123, 129, 80, 234, 198, 134,
+  130, 174, 232, 223, 181, 250, 129, 21, 136, 34, 163, 163, 230, 242, 167,
+  55, 254, 244, 199, 137, 24, 244, 15, 174, 205, 113, 30, 201, 244, 193, 13,
+  112, 75, 2, 128, 62, 210, 33, 41, 160, 58, 132, 96, 152, 198, 191, 75, 172,
+  128, 93, 102, 36, 80, 178, 74, 84, 207, 100, 128, 232, 8, 24, 207, 15, 107,
+  201, 5, 176, 123, 255, 1, 74, 3, 87, 91, 79, 43, 128, 171, 55, 238, 216,
+  127, 108, 247, 111, 126, 63, 253, 253, 79, 78, 147, 236, 63, 192, 254, 239,
+  221, 209, 20, 176, 32, 4, 188, 5, 14, 128, 14, 3, 224, 33, 128, 191, 177,
+  127, 51, 178, 209, 131, 212, 2, 82, 102, 214, 159, 215, 249, 75, 239, 79,
+  185, 35, 228, 200, 63, 90, 34, 208, 131, 68, 73, 119, 242, 135, 117, 99,
+  29, 163, 63, 81, 143, 213, 15, 62, 252, 37, 241, 55, 134, 191, 157, 245,
+  31, 185, 60, 22, 85, 244, 63, 122, 253, 223, 38, 14, 143, 178, 2, 144, 98,
+  0, 236, 215, 172, 97, 210, 255, 211, 39, 186, 175, 241, 155, 157, 143, 128,
+  243, 118, 177, 200, 21, 251, 24, 7, 12, 239, 0, 115, 14, 16, 122, 73, 156,
+  169, 98, 21, 192, 134, 83, 103, 120, 11, 248, 220, 182, 237, 37, 123, 246,
+  31, 56, 116, 140, 86, 6, 22, 47, 94, 178, 114, 93, 65, 97, 201, 161, 210,
+  223, 191, 244, 250, 236, 251, 58, 252, 147, 246, 47, 19, 0, 196, 1, 139,
+  15, 0, 119, 0, 19, 198, 17, 224, 191, 192, 255, 153, 195, 10, 81, 9, 151,
+  88, 64, 42, 237, 209, 243, 49, 46, 255, 92, 54, 26, 65, 206, 255, 193, 216,
+  35, 160, 251, 79, 155, 139, 127, 158, 11, 132, 102, 30, 17, 25, 181, 187,
+  255, 90, 252, 213, 218, 30, 79, 36, 98, 104, 254, 203, 197, 255, 38, 67,
+  199, 65, 184, 0, 160, 167, 198, 101, 3, 128, 60, 210, 199, 226, 191, 118,
+  57, 0, 4, 86, 192, 134, 134, 206, 75, 17, 0, 209, 1, 190, 65, 125, 68, 75,
+  21, 39, 129, 16, 21, 224, 139, 173, 59, 136, 3, 32, 1, 192, 209, 210, 138,
+  218, 227, 5, 115, 23, 175, 38, 9, 224, 246, 61, 71, 222, 126, 251, 157, 247,
+  83, 147, 226, 15, 111, 0, 116, 7, 24, 39, 0, 156, 3, 245, 97, 131, 239, 41,
+  22, 224, 69, 26, 170, 55, 73, 210, 6, 113, 156, 71, 233, 207, 92, 31, 151,
+  228, 20, 89, 161, 27, 8, 221, 63, 102, 143, 114, 8, 63, 200, 151, 138, 216,
+  220, 79, 38, 123, 84, 76, 217, 63, 199, 95, 208, 191, 0, 252, 81, 249, 87,
+  225, 239, 235, 233, 129, 12, 144, 114, 107, 80, 104, 0, 208, 148, 97, 144,
+  15, 0, 144, 251, 95, 112, 64, 42, 18, 80, 146, 0, 160, 9, 32, 62, 1, 210,
+  117, 141, 217, 191, 88, 2, 189, 208, 210, 210, 122, 144, 46, 1, 237, 39,
+  25, 96, 69, 117, 221, 190, 15, 22, 44, 93, 183, 113, 219, 142, 146, 253,
+  11, 95, 159, 49, 119, 116, 154, 27, 127, 65, 1, 12, 35, 0, 16, 3, 224, 64,
+  208, 62, 5, 227, 252, 63, 167, 116, 200, 167, 76, 31, 210, 197, 167, 241,
+  213, 111, 204, 251, 65, 210, 80, 106, 255, 9, 71, 223, 39, 102, 238, 144,
+  152, 27, 100, 25, 67, 55, 206, 140, 254, 53, 11, 109, 28, 211, 71, 225, 17,
+  194, 136, 93, 253, 247, 104, 255, 114, 237, 176, 68, 92, 202, 127, 25, 243,
+  63, 6, 113, 8, 249, 11, 141, 202, 5, 48, 78, 235, 165, 22, 128, 56, 105,
+  36, 197, 223, 199, 27, 192, 140, 3, 86, 138, 64, 137, 14, 224, 208, 101,
+  58, 1, 36, 73, 160, 185, 12, 108, 87, 119, 7, 147, 129, 150, 58, 160, 77,
+  45, 151, 74, 119, 148, 144, 0, 224, 224, 209, 114, 226, 255, 43, 40, 13,
+  228, 166, 194, 109, 59, 247, 23, 188, 249, 206, 226, 46, 117, 253, 11, 250,
+  79, 133, 191, 162, 128, 5, 55, 128, 200, 2, 20, 254, 234, 12, 76, 40, 204,
+  193, 239, 25, 25, 241, 129, 124, 63, 105, 161, 159, 114, 115, 198, 26, 228,
+  49, 228, 3, 100, 254, 230, 24, 185, 179, 243, 147, 178, 198, 72, 226, 33,
+  204, 250, 235, 84, 14, 133, 252, 1, 106, 134, 32, 2, 168, 95, 17, 121, 188,
+  92, 68, 0, 234, 15, 252, 8, 169, 252, 159, 88, 178, 207, 181, 255, 39, 241,
+  15, 244, 40, 6, 240, 126, 189, 0, 2, 38, 192, 131, 1, 222, 0, 100, 12, 0,
+  146, 47, 66, 22, 0, 174, 159, 87, 59, 128, 122, 81, 172, 167, 154, 78, 128,
+  208, 14, 16, 219, 1, 107, 185, 88, 187, 149, 228, 251, 7, 15, 29, 43, 173,
+  170, 169, 59, 177, 116, 222, 242, 85, 107, 55, 83, 94, 128, 151, 62, 156,
+  127, 73, 85, 127, 161, 253, 139, 0, 144, 86, 0, 88, 23, 72, 58, 0, 238, 1,
+  110, 169, 3, 160, 79, 128, 58, 4, 234, 151, 137, 44, 140, 247, 141, 148,
+  15, 222, 252, 66, 219, 215, 42, 251, 100, 240, 14, 113, 58, 106, 152, 191,
+  30, 38, 122, 32, 250, 0, 242, 162, 177, 144, 199, 228, 39, 132, 206, 73,
+  31, 19, 1, 187, 159, 246, 242, 143, 163, 254, 159, 24, 26, 26, 68, 235, 127,
+  163, 174, 253, 79, 250, 104, 168, 167, 23, 49, 64, 97, 209, 8, 246, 29, 219,
+  175, 93, 187, 174, 69, 224, 121, 7, 168, 143, 39, 0, 61, 90, 6, 180, 173,
+  237, 250, 53, 209, 38, 60, 206, 10, 128, 20, 126, 86, 1, 188, 120, 102, 91,
+  113, 201, 190, 67, 71, 168, 255, 63, 126, 162, 232, 195, 69, 43, 215, 110,
+  44, 218, 181, 103, 223, 91, 31, 204, 59, 37, 220, 191, 104, 255, 114, 252,
+  69, 5, 200, 114, 0, 42, 6, 16, 165, 0, 195, 11, 224, 207, 177, 132, 210,
+  9, 74, 1, 199, 156, 4, 182, 239, 246, 253, 14, 246, 24, 198, 29, 161, 115,
+  53, 101, 254, 24, 254, 132, 67, 126, 22, 77, 145, 69, 192, 212, 166, 185,
+  66, 224, 232, 253, 2, 5, 162, 176, 93, 253, 55, 150, 127, 204, 20, 194, 55,
+  40, 239, 127, 65, 255, 7, 103, 7, 225, 224, 104, 164, 167, 215, 24, 0, 7,
+  12, 96, 28, 255, 238, 171, 162, 183, 75, 114, 123, 164, 23, 65, 14, 217,
+  121, 85, 1, 186, 210, 38, 86, 64, 216, 12, 104, 157, 100, 1, 190, 64, 41,
+  130, 182, 83, 33, 248, 195, 165, 229, 149, 85, 181, 39, 74, 63, 92, 180,
+  100, 205, 166, 173, 197, 123, 247, 175, 249, 253, 130, 10, 154, 253, 79,
+  229, 233, 63, 235, 255, 201, 2, 144, 44, 1, 202, 8, 0, 29, 0, 125, 9, 128,
+  35, 192, 80, 23, 191, 144, 223, 12, 125, 40, 128, 190, 69, 23, 15, 165, 98,
+  0, 113, 28, 94, 34, 86, 219, 222, 200, 252, 19, 15, 202, 30, 162, 116, 163,
+  12, 250, 16, 119, 239, 207, 212, 31, 14, 251, 85, 250, 7, 171, 255, 136,
+  252, 13, 203, 143, 141, 184, 227, 127, 92, 255, 103, 143, 246, 246, 244,
+  34, 255, 63, 36, 69, 67, 212, 200, 64, 159, 156, 0, 16, 19, 192, 34, 91,
+  96, 116, 65, 45, 178, 3, 40, 59, 64, 244, 150, 184, 36, 70, 0, 78, 55, 158,
+  227, 34, 241, 251, 119, 148, 236, 222, 127, 232, 112, 57, 253, 207, 39, 231,
+  47, 90, 190, 106, 195, 214, 237, 187, 15, 29, 121, 238, 245, 125, 252, 250,
+  23, 233, 63, 180, 127, 24, 1, 154, 7, 64, 199, 129, 226, 12, 192, 83, 192,
+  255, 177, 53, 130, 240, 189, 159, 50, 24, 163, 211, 110, 218, 72, 133, 127,
+  218, 44, 252, 196, 226, 214, 32, 105, 202, 155, 60, 136, 189, 180, 134, 45,
+  207, 10, 129, 177, 250, 195, 95, 42, 44, 230, 55, 141, 238, 143, 215, 250,
+  32, 197, 127, 8, 212, 127, 70, 92, 251, 255, 178, 115, 120, 83, 229, 127,
+  138, 53, 204, 167, 26, 192, 236, 59, 14, 93, 195, 19, 32, 170, 1, 72, 190,
+  248, 138, 152, 0, 224, 36, 32, 140, 42, 174, 171, 171, 189, 138, 209, 128,
+  146, 4, 128, 56, 0, 122, 56, 170, 248, 14, 64, 41, 241, 255, 245, 39, 87,
+  47, 91, 177, 102, 93, 1, 197, 255, 15, 191, 216, 10, 194, 63, 86, 255, 231,
+  5, 160, 187, 50, 0, 208, 17, 128, 78, 2, 64, 20, 32, 14, 0, 136, 6, 4, 254,
+  105, 128, 188, 0, 69, 20, 251, 220, 98, 1, 46, 248, 161, 249, 143, 197, 109,
+  226, 56, 123, 129, 20, 153, 127, 42, 99, 108, 16, 166, 66, 142, 201, 31,
+  7, 119, 56, 150, 160, 96, 63, 109, 24, 42, 127, 186, 200, 131, 149, 248,
+  139, 124, 141, 81, 181, 254, 107, 234, 63, 224, 254, 79, 52, 214, 175, 20,
+  224, 53, 254, 114, 105, 132, 219, 255, 136, 216, 0, 236, 16, 43, 96, 124,
+  2, 156, 215, 10, 219, 5, 7, 64, 43, 32, 1, 234, 236, 174, 225, 51, 224, 13,
+  167, 207, 158, 37, 127, 220, 218, 218, 192, 116, 96, 14, 31, 41, 173, 172,
+  173, 63, 85, 188, 104, 197, 186, 245, 5, 219, 118, 239, 59, 186, 242, 199,
+  171, 81, 248, 175, 248, 159, 85, 6, 40, 29, 0, 195, 159, 207, 2, 220, 146,
+  87, 192, 173, 9, 227, 8, 168, 99, 64, 224, 215, 200, 75, 240, 1, 250, 72,
+  34, 206, 131, 49, 90, 215, 125, 40, 252, 89, 29, 170, 197, 140, 125, 95,
+  7, 252, 38, 117, 36, 175, 38, 198, 67, 104, 238, 219, 203, 253, 39, 208,
+  232, 23, 255, 129, 67, 214, 240, 47, 156, 254, 136, 68, 45, 13, 235, 164,
+  31, 180, 255, 97, 255, 199, 182, 255, 65, 222, 255, 237, 131, 249, 63, 106,
+  0, 7, 131, 0, 127, 69, 2, 206, 54, 0, 134, 134, 123, 41, 254, 172, 5, 216,
+  38, 118, 0, 58, 59, 186, 186, 79, 86, 213, 214, 10, 26, 216, 243, 77, 77,
+  23, 47, 93, 162, 51, 224, 251, 15, 29, 61, 86, 94, 117, 188, 225, 200, 226,
+  165, 107, 10, 182, 20, 237, 216, 191, 127, 231, 79, 23, 76, 149, 248, 223,
+  215, 249, 159, 10, 0, 238, 128, 8, 64, 123, 0, 117, 7, 128, 107, 64, 28,
+  2, 113, 10, 50, 73, 165, 16, 132, 212, 193, 76, 173, 136, 252, 140, 209,
+  122, 163, 112, 76, 82, 7, 97, 226, 56, 107, 234, 195, 94, 33, 131, 205, 164,
+  24, 150, 124, 2, 23, 138, 41, 64, 136, 220, 63, 125, 165, 160, 240, 223,
+  140, 250, 61, 228, 152, 254, 140, 154, 202, 241, 254, 33, 45, 255, 173, 135,
+  7, 131, 184, 255, 199, 30, 29, 6, 245, 159, 1, 25, 53, 140, 248, 52, 103,
+  112, 48, 216, 46, 10, 0, 29, 93, 106, 4, 148, 121, 11, 242, 165, 3, 23, 216,
+  253, 47, 72, 0, 249, 160, 64, 87, 87, 51, 9, 244, 24, 11, 164, 152, 1, 110,
+  221, 67, 194, 125, 18, 0, 28, 163, 35, 0, 117, 11, 87, 144, 251, 159, 164,
+  4, 251, 15, 189, 252, 7, 121, 253, 59, 240, 87, 77, 64, 117, 3, 200, 66,
+  32, 138, 3, 177, 27, 160, 191, 103, 109, 117, 40, 91, 37, 6, 143, 122, 100,
+  178, 56, 240, 71, 214, 79, 240, 143, 65, 234, 40, 35, 243, 199, 220, 65,
+  102, 67, 65, 231, 20, 17, 207, 193, 63, 135, 4, 145, 174, 254, 209, 23, 11,
+  122, 135, 127, 22, 249, 23, 63, 147, 65, 201, 254, 238, 243, 161, 221, 97,
+  44, 0, 64, 159, 29, 49, 20, 224, 224, 83, 226, 145, 78, 182, 1, 38, 68, 128,
+  20, 7, 12, 223, 22, 107, 162, 75, 158, 242, 254, 151, 248, 95, 99, 35, 64,
+  108, 9, 148, 238, 128, 92, 108, 45, 221, 190, 123, 63, 241, 255, 148, 7,
+  188, 174, 126, 249, 18, 58, 2, 182, 99, 71, 241, 145, 37, 175, 136, 230,
+  175, 39, 254, 248, 0, 168, 66, 144, 225, 3, 144, 39, 200, 184, 212, 161,
+  108, 211, 135, 156, 209, 38, 250, 152, 60, 106, 140, 36, 255, 249, 168, 163,
+  140, 202, 15, 134, 95, 51, 7, 135, 204, 218, 159, 67, 132, 194, 154, 34,
+  225, 246, 31, 240, 139, 230, 191, 71, 247, 7, 118, 16, 249, 207, 20, 28,
+  130, 235, 255, 170, 123, 12, 133, 67, 197, 179, 126, 184, 0, 60, 164, 23,
+  128, 70, 116, 204, 112, 147, 55, 0, 58, 229, 4, 136, 80, 1, 98, 116, 129,
+  173, 34, 255, 215, 50, 80, 180, 5, 80, 93, 197, 71, 128, 40, 13, 28, 85,
+  9, 106, 216, 94, 188, 235, 192, 209, 163, 165, 76, 31, 162, 112, 225, 242,
+  181, 155, 11, 119, 20, 237, 58, 178, 253, 87, 234, 250, 231, 225, 191, 44,
+  0, 49, 248, 121, 15, 128, 227, 143, 14, 0, 15, 2, 93, 78, 224, 150, 128,
+  63, 173, 141, 30, 20, 250, 242, 163, 239, 65, 26, 75, 241, 79, 56, 66, 127,
+  15, 238, 32, 163, 242, 15, 6, 201, 66, 144, 244, 197, 92, 251, 140, 229,
+  93, 33, 8, 192, 234, 143, 67, 58, 22, 108, 127, 136, 67, 20, 130, 225, 159,
+  188, 254, 165, 242, 188, 238, 255, 146, 248, 47, 8, 8, 32, 4, 107, 180, 15,
+  108, 128, 83, 206, 152, 129, 235, 146, 3, 172, 187, 27, 173, 0, 144, 111,
+  114, 237, 188, 202, 255, 149, 86, 88, 87, 247, 105, 186, 4, 206, 88, 192,
+  248, 132, 192, 197, 162, 146, 93, 123, 247, 31, 43, 167, 252, 240, 245, 71,
+  62, 88, 184, 106, 221, 150, 173, 59, 247, 30, 62, 244, 99, 158, 253, 79,
+  21, 233, 159, 136, 255, 238, 1, 251, 151, 248, 203, 11, 64, 229, 129, 200,
+  7, 232, 140, 32, 43, 227, 60, 232, 242, 177, 78, 12, 70, 223, 202, 250, 32,
+  95, 60, 223, 45, 203, 70, 225, 144, 94, 204, 224, 15, 64, 163, 154, 24, 126,
+  216, 78, 74, 25, 173, 31, 199, 12, 185, 75, 131, 134, 189, 154, 78, 223,
+  241, 4, 177, 93, 67, 150, 21, 228, 16, 100, 127, 29, 129, 244, 31, 74, 56,
+  92, 60, 28, 238, 69, 12, 80, 134, 4, 12, 139, 255, 134, 65, 254, 215, 221,
+  131, 5, 3, 187, 206, 95, 0, 50, 224, 18, 255, 22, 146, 233, 215, 81, 22,
+  0, 26, 0, 210, 0, 96, 95, 241, 174, 125, 251, 15, 30, 165, 250, 128, 245,
+  39, 22, 204, 91, 188, 114, 205, 214, 3, 135, 14, 28, 250, 230, 84, 29, 254,
+  171, 252, 79, 38, 0, 70, 10, 192, 11, 193, 42, 10, 52, 157, 0, 63, 2, 153,
+  52, 80, 5, 75, 165, 243, 128, 159, 206, 184, 181, 34, 108, 235, 31, 75, 138,
+  46, 29, 204, 252, 226, 9, 55, 127, 128, 221, 79, 20, 238, 63, 225, 72, 254,
+  28, 251, 227, 206, 5, 98, 157, 190, 99, 234, 95, 196, 253, 29, 131, 228,
+  97, 33, 53, 200, 237, 179, 152, 67, 177, 112, 84, 140, 245, 127, 224, 2,
+  216, 144, 206, 255, 249, 153, 11, 48, 10, 136, 14, 185, 2, 8, 4, 195, 134,
+  134, 250, 169, 129, 139, 21, 128, 107, 106, 81, 248, 58, 27, 1, 58, 193,
+  88, 32, 206, 211, 251, 161, 122, 251, 206, 221, 7, 14, 29, 62, 90, 73, 39,
+  131, 54, 126, 56, 127, 209, 250, 205, 123, 142, 30, 218, 251, 121, 222, 252,
+  155, 122, 31, 249, 255, 123, 22, 254, 226, 6, 224, 248, 35, 23, 32, 189,
+  0, 63, 1, 25, 165, 13, 38, 237, 208, 214, 135, 74, 103, 204, 156, 207, 190,
+  249, 179, 128, 66, 134, 70, 127, 49, 71, 236, 23, 79, 130, 90, 141, 119,
+  219, 95, 158, 174, 152, 49, 248, 97, 72, 62, 90, 11, 196, 240, 245, 20, 254,
+  170, 249, 111, 74, 71, 34, 238, 96, 242, 34, 225, 33, 116, 145, 155, 227,
+  95, 114, 116, 128, 158, 193, 62, 48, 255, 163, 55, 192, 97, 252, 199, 18,
+  128, 118, 69, 1, 165, 27, 64, 212, 91, 52, 35, 18, 24, 33, 21, 218, 93, 83,
+  83, 67, 71, 128, 78, 157, 102, 59, 130, 23, 91, 207, 238, 160, 60, 144, 52,
+  0, 172, 59, 113, 114, 207, 220, 121, 203, 201, 5, 176, 239, 200, 254, 255,
+  93, 134, 127, 212, 254, 239, 9, 255, 175, 42, 128, 42, 2, 180, 60, 128, 138,
+  3, 209, 9, 184, 101, 138, 131, 57, 176, 159, 4, 125, 13, 191, 166, 142, 75,
+  235, 187, 223, 160, 14, 75, 154, 177, 63, 26, 249, 199, 253, 164, 136, 57,
+  248, 97, 148, 237, 236, 108, 66, 153, 127, 210, 15, 152, 159, 224, 4, 177,
+  67, 57, 94, 84, 36, 35, 82, 253, 23, 176, 127, 233, 244, 15, 93, 30, 131,
+  216, 255, 15, 106, 213, 72, 165, 25, 214, 201, 68, 96, 129, 8, 212, 205,
+  62, 229, 44, 174, 176, 17, 32, 206, 2, 124, 157, 237, 128, 210, 40, 177,
+  65, 180, 128, 185, 16, 108, 203, 165, 214, 157, 59, 119, 239, 217, 119, 240,
+  88, 89, 101, 85, 221, 201, 242, 5, 139, 87, 172, 46, 216, 186, 245, 240,
+  177, 255, 52, 21, 134, 255, 216, 254, 161, 3, 184, 163, 241, 23, 105, 160,
+  44, 6, 193, 123, 32, 109, 170, 130, 97, 121, 40, 3, 124, 88, 240, 201, 56,
+  73, 99, 197, 78, 113, 12, 68, 254, 168, 238, 151, 0, 243, 132, 41, 79, 222,
+  96, 113, 183, 88, 131, 31, 40, 162, 204, 171, 65, 148, 68, 179, 159, 65,
+  215, 2, 129, 169, 28, 30, 81, 237, 95, 159, 33, 28, 108, 18, 71, 199, 134,
+  213, 2, 104, 255, 160, 94, 27, 86, 164, 145, 244, 200, 245, 136, 1, 32, 190,
+  2, 210, 43, 249, 194, 153, 179, 232, 0, 59, 128, 146, 4, 166, 187, 231, 66,
+  53, 99, 129, 228, 35, 0, 244, 2, 56, 84, 188, 123, 239, 126, 74, 3, 80, 93,
+  93, 127, 106, 201, 178, 149, 171, 215, 21, 110, 43, 174, 254, 135, 7, 193,
+  95, 221, 0, 214, 1, 64, 78, 96, 28, 42, 131, 101, 16, 248, 10, 251, 180,
+  33, 26, 144, 159, 48, 156, 47, 149, 103, 204, 129, 31, 155, 61, 6, 23, 254,
+  120, 229, 215, 80, 31, 79, 133, 37, 104, 6, 231, 143, 35, 250, 79, 25, 11,
+  228, 9, 156, 253, 7, 77, 233, 24, 184, 62, 40, 98, 200, 40, 100, 127, 133,
+  242, 223, 80, 55, 156, 251, 142, 17, 155, 1, 212, 7, 40, 128, 233, 83, 253,
+  80, 3, 128, 23, 0, 197, 10, 208, 240, 112, 239, 5, 89, 1, 184, 194, 212,
+  194, 89, 159, 184, 231, 114, 13, 29, 1, 58, 121, 90, 140, 0, 92, 34, 1, 0,
+  229, 1, 61, 124, 180, 180, 178, 230, 248, 201, 141, 203, 87, 175, 93, 191,
+  97, 251, 142, 178, 127, 39, 155, 191, 114, 252, 147, 109, 0, 107, 252, 239,
+  42, 251, 183, 60, 128, 14, 4, 249, 33, 24, 147, 56, 3, 131, 135, 237, 157,
+  52, 146, 10, 193, 26, 81, 128, 53, 216, 164, 13, 101, 204, 113, 102, 213,
+  87, 173, 18, 37, 13, 185, 88, 15, 218, 240, 12, 208, 13, 8, 71, 242, 105,
+  144, 37, 93, 250, 227, 113, 63, 208, 125, 181, 149, 163, 163, 232, 250, 231,
+  175, 18, 51, 227, 127, 67, 254, 13, 224, 239, 239, 197, 12, 160, 98, 0, 192,
+  167, 54, 0, 3, 161, 193, 235, 237, 90, 4, 86, 77, 0, 113, 189, 144, 65, 114,
+  253, 211, 4, 64, 116, 0, 248, 14, 88, 119, 187, 242, 255, 103, 249, 12, 224,
+  25, 74, 3, 118, 136, 206, 0, 214, 212, 157, 220, 185, 124, 229, 250, 13,
+  5, 91, 75, 246, 253, 157, 137, 63, 76, 0, 92, 14, 64, 192, 111, 30, 129,
+  137, 91, 185, 76, 6, 106, 129, 89, 86, 159, 206, 184, 77, 223, 70, 63, 139,
+  120, 35, 115, 217, 73, 225, 183, 83, 63, 184, 68, 36, 190, 69, 28, 228, 254,
+  26, 181, 7, 163, 15, 138, 129, 226, 191, 171, 250, 103, 117, 255, 146, 201,
+  24, 40, 255, 161, 241, 127, 88, 60, 224, 248, 7, 113, 252, 55, 8, 183, 198,
+  69, 209, 96, 132, 231, 255, 29, 16, 127, 37, 24, 74, 235, 255, 98, 7, 76,
+  8, 65, 211, 11, 128, 198, 127, 108, 4, 136, 177, 4, 182, 180, 94, 162, 74,
+  48, 7, 14, 151, 210, 0, 224, 68, 233, 194, 213, 107, 11, 182, 108, 222, 181,
+  99, 170, 10, 255, 68, 249, 79, 218, 63, 107, 1, 242, 41, 16, 80, 4, 66, 39,
+  0, 93, 3, 82, 9, 72, 226, 13, 127, 177, 12, 95, 87, 250, 51, 30, 116, 241,
+  128, 63, 42, 105, 134, 126, 118, 236, 231, 205, 30, 195, 53, 227, 24, 111,
+  188, 199, 237, 239, 204, 254, 12, 233, 136, 168, 95, 235, 126, 152, 27, 4,
+  142, 229, 79, 250, 34, 113, 61, 253, 97, 172, 127, 104, 249, 47, 113, 120,
+  194, 189, 120, 1, 216, 218, 0, 161, 29, 32, 37, 2, 221, 133, 240, 39, 193,
+  162, 175, 149, 217, 55, 211, 129, 191, 122, 85, 86, 0, 123, 88, 0, 72, 73,
+  0, 206, 136, 14, 225, 222, 157, 123, 246, 30, 56, 116, 172, 172, 170, 186,
+  174, 190, 97, 241, 162, 117, 5, 91, 182, 237, 40, 202, 169, 234, 159, 198,
+  159, 119, 128, 97, 6, 32, 67, 64, 217, 10, 66, 39, 128, 5, 130, 153, 12,
+  150, 5, 67, 255, 102, 242, 42, 68, 97, 145, 176, 172, 6, 31, 50, 199, 105,
+  246, 40, 107, 139, 56, 229, 88, 248, 128, 230, 47, 190, 141, 140, 216, 101,
+  199, 206, 236, 252, 131, 67, 101, 105, 80, 69, 205, 230, 159, 43, 252, 147,
+  19, 68, 252, 101, 226, 210, 252, 173, 242, 111, 16, 51, 7, 196, 162, 81,
+  53, 255, 233, 137, 127, 232, 134, 220, 0, 35, 150, 141, 84, 160, 200, 23,
+  95, 103, 29, 32, 22, 255, 43, 22, 176, 174, 238, 115, 85, 117, 199, 143,
+  179, 29, 16, 70, 3, 121, 169, 181, 116, 71, 201, 190, 131, 135, 216, 12,
+  104, 253, 137, 45, 11, 150, 109, 218, 178, 125, 219, 214, 8, 203, 254, 167,
+  220, 151, 237, 95, 88, 0, 132, 7, 192, 242, 0, 232, 0, 140, 153, 114, 80,
+  166, 48, 152, 83, 35, 40, 99, 16, 198, 99, 181, 0, 73, 38, 146, 52, 105,
+  67, 227, 14, 2, 9, 123, 225, 195, 92, 34, 75, 133, 65, 227, 15, 143, 145,
+  79, 206, 30, 23, 129, 178, 239, 65, 196, 30, 100, 224, 175, 126, 186, 184,
+  174, 254, 219, 235, 63, 176, 252, 71, 158, 69, 243, 63, 74, 53, 88, 73, 0,
+  208, 0, 160, 27, 114, 128, 3, 14, 16, 18, 0, 248, 58, 229, 4, 80, 91, 27,
+  224, 138, 191, 204, 150, 0, 27, 78, 113, 26, 224, 139, 151, 46, 215, 23,
+  151, 236, 62, 112, 248, 8, 229, 135, 173, 63, 177, 119, 241, 146, 149, 69,
+  91, 183, 237, 24, 18, 238, 159, 195, 47, 243, 127, 222, 1, 224, 67, 32, 119,
+  45, 7, 32, 241, 151, 7, 224, 182, 86, 3, 178, 132, 193, 178, 182, 221, 35,
+  244, 115, 89, 183, 86, 132, 34, 143, 203, 74, 223, 143, 198, 253, 18, 96,
+  164, 220, 76, 253, 50, 105, 23, 121, 80, 60, 12, 152, 67, 17, 121, 156, 99,
+  146, 4, 74, 135, 208, 143, 176, 163, 248, 111, 207, 126, 35, 252, 19, 195,
+  120, 251, 15, 81, 7, 134, 197, 1, 16, 199, 176, 159, 9, 192, 33, 2, 160,
+  225, 17, 212, 0, 12, 246, 9, 17, 56, 222, 0, 84, 5, 96, 182, 100, 208, 39,
+  240, 111, 21, 59, 192, 220, 79, 220, 168, 18, 60, 208, 103, 206, 178, 251,
+  225, 114, 115, 49, 229, 129, 62, 86, 90, 86, 69, 206, 69, 245, 252, 101,
+  43, 215, 21, 109, 45, 233, 156, 2, 194, 63, 211, 255, 155, 14, 128, 162,
+  127, 199, 56, 0, 183, 111, 77, 40, 249, 159, 12, 212, 5, 83, 255, 43, 11,
+  131, 253, 12, 18, 11, 201, 233, 62, 127, 214, 164, 139, 23, 248, 39, 141,
+  188, 47, 238, 193, 30, 148, 118, 205, 124, 129, 107, 38, 170, 3, 118, 88,
+  250, 71, 75, 36, 73, 131, 246, 65, 209, 7, 133, 96, 244, 31, 196, 179, 95,
+  145, 152, 165, 28, 201, 126, 58, 190, 252, 239, 195, 194, 161, 230, 234,
+  48, 63, 135, 3, 198, 254, 151, 102, 13, 149, 122, 3, 161, 225, 107, 215,
+  65, 0, 216, 3, 26, 0, 195, 195, 67, 66, 5, 162, 85, 232, 64, 11, 173, 168,
+  186, 42, 174, 4, 127, 230, 44, 235, 0, 94, 190, 66, 103, 0, 14, 28, 162,
+  60, 80, 117, 39, 78, 45, 89, 178, 106, 101, 193, 142, 93, 151, 196, 245,
+  47, 236, 255, 222, 125, 104, 255, 70, 4, 96, 30, 0, 6, 255, 237, 28, 84,
+  4, 51, 116, 193, 224, 239, 166, 62, 148, 21, 245, 1, 210, 104, 205, 32, 151,
+  213, 174, 223, 136, 252, 19, 112, 180, 16, 116, 151, 51, 86, 234, 207, 6,
+  201, 67, 152, 56, 216, 189, 67, 166, 235, 9, 144, 61, 48, 147, 14, 170, 226,
+  191, 235, 250, 215, 3, 228, 240, 120, 106, 242, 55, 32, 28, 128, 219, 255,
+  242, 0, 12, 177, 244, 31, 19, 128, 233, 173, 81, 118, 255, 143, 94, 215,
+  248, 203, 21, 144, 126, 209, 46, 244, 93, 108, 98, 45, 96, 150, 255, 209,
+  115, 194, 23, 133, 26, 233, 16, 248, 73, 65, 3, 215, 124, 169, 245, 202,
+  145, 221, 123, 247, 31, 60, 68, 46, 0, 58, 4, 90, 176, 120, 197, 234, 181,
+  219, 119, 55, 194, 240, 15, 222, 255, 22, 254, 230, 21, 32, 218, 1, 72, 9,
+  72, 153, 248, 100, 226, 96, 80, 36, 200, 149, 242, 43, 38, 169, 36, 238,
+  248, 32, 248, 145, 245, 227, 121, 82, 107, 141, 36, 29, 14, 99, 173, 111,
+  212, 79, 192, 146, 31, 246, 20, 105, 192, 111, 140, 254, 33, 233, 16, 131,
+  59, 84, 92, 78, 195, 138, 252, 3, 79, 255, 90, 248, 71, 99, 195, 28, 255,
+  1, 173, 0, 40, 25, 64, 53, 105, 52, 47, 0, 170, 14, 96, 175, 230, 11, 24,
+  30, 190, 42, 11, 64, 109, 130, 4, 134, 205, 9, 183, 8, 26, 184, 198, 70,
+  198, 2, 113, 233, 114, 53, 21, 2, 58, 124, 228, 88, 69, 77, 109, 93, 67,
+  201, 226, 37, 171, 214, 109, 221, 93, 59, 5, 226, 207, 243, 127, 153, 0,
+  42, 252, 239, 106, 251, 191, 3, 130, 64, 2, 255, 88, 14, 10, 192, 100, 176,
+  44, 88, 198, 248, 47, 110, 145, 32, 20, 244, 27, 172, 193, 227, 25, 109,
+  252, 54, 117, 156, 227, 238, 7, 189, 69, 212, 85, 204, 37, 244, 180, 102,
+  196, 53, 75, 146, 128, 138, 127, 184, 248, 67, 62, 144, 241, 2, 254, 0, 51,
+  252, 131, 194, 209, 0, 255, 81, 29, 200, 129, 221, 1, 157, 61, 140, 244,
+  42, 252, 181, 2, 12, 106, 0, 7, 131, 157, 138, 3, 86, 147, 0, 74, 252, 59,
+  152, 14, 160, 36, 129, 161, 147, 98, 52, 75, 188, 198, 241, 167, 82, 224,
+  231, 216, 16, 248, 233, 226, 18, 170, 4, 92, 90, 94, 89, 91, 127, 162, 114,
+  254, 146, 101, 5, 155, 119, 31, 85, 225, 31, 43, 255, 168, 248, 79, 101,
+  128, 58, 2, 4, 248, 139, 51, 48, 129, 68, 96, 44, 73, 48, 120, 211, 103,
+  12, 232, 177, 78, 76, 22, 113, 134, 107, 6, 193, 241, 4, 186, 159, 49, 105,
+  48, 226, 14, 203, 195, 27, 203, 190, 95, 204, 181, 243, 101, 208, 7, 65,
+  247, 143, 203, 9, 50, 119, 15, 132, 140, 230, 79, 30, 234, 120, 159, 22,
+  127, 208, 220, 17, 65, 76, 63, 39, 78, 143, 95, 18, 64, 15, 34, 255, 143,
+  150, 6, 123, 144, 255, 239, 1, 43, 32, 195, 195, 55, 249, 8, 56, 27, 1, 184,
+  42, 86, 197, 200, 23, 9, 252, 25, 15, 108, 19, 113, 15, 151, 118, 236, 218,
+  189, 143, 46, 1, 85, 214, 212, 55, 52, 44, 94, 184, 122, 253, 230, 226, 221,
+  234, 250, 119, 226, 15, 29, 128, 242, 0, 18, 254, 49, 91, 8, 40, 107, 29,
+  4, 151, 56, 152, 33, 18, 228, 133, 254, 24, 165, 14, 195, 105, 31, 28, 246,
+  5, 119, 191, 193, 27, 170, 102, 138, 116, 146, 17, 129, 245, 218, 8, 102,
+  14, 142, 163, 81, 18, 135, 10, 85, 74, 243, 62, 97, 229, 48, 212, 252, 49,
+  132, 131, 125, 195, 26, 127, 168, 28, 16, 194, 204, 81, 244, 39, 9, 246,
+  222, 84, 43, 157, 46, 252, 233, 185, 235, 231, 173, 253, 46, 149, 0, 202,
+  0, 128, 36, 128, 67, 23, 154, 140, 17, 64, 122, 77, 244, 158, 172, 99, 44,
+  64, 167, 26, 89, 5, 136, 252, 241, 129, 146, 93, 251, 15, 28, 41, 165, 68,
+  144, 39, 78, 109, 88, 190, 114, 221, 230, 173, 133, 110, 252, 85, 0, 136,
+  35, 0, 229, 1, 200, 231, 184, 102, 253, 215, 34, 64, 232, 20, 216, 255, 59,
+  7, 189, 190, 83, 37, 8, 51, 199, 38, 204, 134, 15, 158, 247, 176, 236, 212,
+  140, 253, 21, 252, 105, 85, 249, 181, 196, 126, 77, 13, 74, 135, 10, 85,
+  34, 32, 195, 255, 144, 26, 222, 49, 54, 72, 12, 242, 168, 36, 195, 95, 194,
+  40, 237, 95, 238, 142, 154, 155, 195, 225, 155, 96, 1, 0, 168, 6, 143, 202,
+  199, 200, 83, 67, 106, 5, 88, 75, 198, 179, 126, 33, 29, 23, 190, 36, 88,
+  160, 57, 11, 224, 141, 118, 94, 39, 56, 91, 83, 95, 127, 146, 142, 0, 157,
+  97, 51, 128, 23, 47, 87, 113, 34, 112, 70, 4, 123, 114, 239, 138, 85, 107,
+  55, 109, 90, 43, 155, 127, 60, 253, 163, 248, 223, 191, 11, 42, 64, 119,
+  129, 253, 67, 23, 112, 11, 171, 192, 96, 41, 40, 248, 139, 54, 121, 144,
+  232, 103, 115, 150, 64, 152, 201, 26, 77, 137, 196, 210, 42, 56, 179, 224,
+  199, 29, 255, 84, 222, 21, 114, 242, 109, 147, 86, 237, 199, 46, 253, 24,
+  245, 68, 32, 67, 19, 183, 179, 191, 136, 57, 67, 106, 201, 79, 143, 24, 203,
+  31, 194, 254, 67, 198, 250, 47, 75, 68, 97, 253, 95, 40, 128, 130, 182, 49,
+  195, 223, 167, 26, 0, 92, 4, 136, 145, 128, 247, 11, 190, 160, 171, 4, 222,
+  22, 86, 0, 208, 44, 128, 221, 221, 151, 169, 18, 244, 41, 185, 5, 74, 18,
+  132, 198, 157, 187, 232, 18, 64, 105, 85, 117, 117, 93, 67, 229, 210, 53,
+  235, 54, 108, 94, 108, 133, 255, 186, 0, 32, 75, 64, 56, 7, 96, 240, 3, 226,
+  247, 156, 150, 4, 180, 20, 193, 64, 156, 231, 144, 136, 130, 216, 219, 182,
+  63, 54, 158, 139, 199, 109, 161, 48, 88, 245, 113, 208, 198, 58, 232, 99,
+  232, 55, 143, 25, 240, 71, 221, 193, 31, 40, 253, 2, 225, 176, 76, 20, 21,
+  127, 100, 244, 22, 142, 90, 220, 193, 176, 136, 56, 130, 186, 63, 88, 56,
+  78, 236, 160, 168, 17, 212, 155, 162, 254, 35, 2, 0, 173, 0, 162, 68, 163,
+  67, 126, 57, 0, 32, 227, 127, 64, 24, 59, 220, 217, 196, 39, 128, 56, 11,
+  212, 117, 49, 2, 208, 73, 9, 127, 79, 176, 14, 224, 121, 94, 2, 42, 222,
+  181, 135, 74, 1, 150, 85, 213, 28, 63, 113, 122, 217, 234, 117, 27, 54, 206,
+  1, 213, 159, 251, 247, 5, 252, 176, 2, 196, 225, 199, 7, 96, 204, 86, 130,
+  130, 58, 80, 24, 237, 44, 248, 207, 57, 75, 25, 16, 43, 133, 228, 32, 135,
+  232, 120, 50, 30, 207, 71, 26, 172, 83, 116, 7, 133, 128, 177, 74, 160, 219,
+  254, 160, 244, 103, 18, 199, 39, 188, 118, 136, 162, 170, 247, 23, 146, 43,
+  36, 26, 127, 216, 69, 210, 202, 49, 137, 212, 8, 224, 126, 71, 247, 127,
+  16, 8, 71, 136, 227, 211, 143, 251, 63, 146, 1, 110, 84, 139, 6, 132, 66,
+  220, 254, 187, 56, 7, 40, 88, 1, 166, 227, 66, 125, 188, 194, 175, 88, 96,
+  121, 0, 216, 115, 66, 206, 128, 115, 150, 168, 75, 151, 15, 239, 100, 35,
+  0, 101, 21, 116, 8, 176, 112, 249, 218, 245, 235, 166, 75, 243, 7, 229, 63,
+  217, 1, 80, 25, 0, 14, 1, 0, 241, 179, 60, 0, 99, 42, 140, 87, 24, 219, 160,
+  99, 161, 40, 152, 238, 229, 0, 115, 184, 102, 16, 205, 90, 113, 63, 212,
+  10, 74, 90, 107, 228, 206, 187, 159, 227, 159, 2, 138, 193, 156, 239, 39,
+  234, 40, 253, 36, 76, 239, 47, 203, 137, 97, 28, 253, 57, 133, 3, 45, 238,
+  208, 81, 93, 254, 183, 152, 163, 195, 96, 253, 143, 254, 36, 131, 90, 0,
+  78, 201, 70, 192, 250, 63, 125, 170, 19, 214, 255, 12, 252, 125, 23, 248,
+  4, 208, 21, 70, 2, 114, 93, 54, 10, 206, 19, 251, 175, 215, 51, 224, 151,
+  90, 143, 23, 239, 218, 123, 240, 16, 167, 1, 104, 216, 183, 112, 213, 250,
+  181, 47, 131, 235, 31, 28, 0, 96, 255, 26, 127, 70, 8, 96, 203, 0, 25, 78,
+  32, 103, 224, 13, 21, 1, 115, 134, 50, 160, 161, 25, 0, 141, 127, 108, 28,
+  242, 198, 38, 243, 68, 126, 14, 210, 240, 140, 49, 82, 22, 7, 177, 191, 173,
+  65, 13, 229, 94, 108, 250, 32, 90, 254, 13, 152, 181, 127, 119, 246, 103,
+  224, 239, 232, 254, 2, 230, 80, 64, 28, 22, 31, 162, 240, 43, 252, 135, 145,
+  4, 168, 196, 191, 71, 216, 63, 165, 0, 148, 241, 159, 8, 23, 124, 195, 151,
+  185, 125, 107, 22, 208, 14, 234, 39, 90, 233, 18, 96, 3, 109, 1, 157, 231,
+  9, 194, 133, 98, 186, 6, 126, 180, 140, 210, 0, 52, 28, 159, 187, 100, 213,
+  230, 231, 101, 243, 207, 182, 255, 123, 24, 127, 118, 4, 56, 193, 155, 37,
+  3, 100, 137, 64, 65, 192, 179, 240, 63, 142, 217, 133, 62, 83, 47, 64, 192,
+  159, 54, 164, 98, 140, 162, 79, 210, 224, 14, 67, 211, 254, 178, 228, 36,
+  131, 206, 136, 105, 254, 102, 242, 103, 46, 125, 225, 65, 162, 160, 179,
+  246, 143, 100, 63, 205, 42, 114, 50, 53, 10, 150, 63, 208, 244, 175, 225,
+  255, 233, 227, 62, 205, 255, 53, 8, 105, 163, 244, 216, 24, 73, 0, 219, 219,
+  65, 253, 183, 87, 198, 127, 60, 93, 188, 222, 36, 118, 0, 197, 14, 56, 231,
+  138, 237, 168, 22, 75, 160, 103, 206, 94, 224, 5, 162, 221, 37, 123, 246,
+  30, 60, 82, 70, 50, 64, 226, 23, 86, 206, 91, 186, 237, 25, 24, 254, 193,
+  251, 95, 103, 128, 58, 2, 80, 164, 159, 99, 248, 14, 128, 66, 80, 142, 143,
+  108, 14, 234, 132, 57, 196, 225, 12, 199, 207, 224, 207, 217, 55, 63, 183,
+  79, 104, 252, 106, 202, 56, 3, 105, 190, 140, 203, 159, 201, 70, 56, 69,
+  163, 98, 113, 72, 249, 146, 176, 148, 104, 164, 87, 209, 147, 123, 188, 117,
+  135, 130, 73, 61, 67, 132, 245, 103, 253, 106, 138, 11, 51, 71, 195, 250,
+  145, 244, 31, 35, 32, 252, 7, 11, 128, 112, 108, 48, 52, 4, 54, 128, 123,
+  97, 3, 136, 126, 121, 55, 177, 239, 22, 193, 2, 119, 77, 20, 10, 201, 61,
+  81, 207, 102, 192, 233, 14, 0, 163, 1, 184, 124, 165, 172, 120, 23, 155,
+  1, 173, 170, 173, 61, 113, 114, 251, 7, 203, 55, 126, 15, 225, 143, 253,
+  191, 198, 159, 154, 255, 45, 151, 2, 72, 78, 71, 130, 99, 57, 172, 5, 6,
+  225, 54, 116, 225, 12, 149, 32, 254, 43, 16, 12, 24, 103, 162, 1, 218, 245,
+  27, 140, 225, 73, 55, 121, 24, 158, 247, 133, 3, 197, 9, 48, 242, 143, 53,
+  200, 19, 30, 220, 177, 136, 59, 52, 197, 144, 51, 247, 126, 141, 74, 146,
+  69, 68, 231, 231, 32, 250, 32, 115, 180, 41, 28, 37, 239, 127, 63, 24, 255,
+  84, 246, 15, 88, 3, 40, 254, 163, 180, 177, 39, 54, 64, 244, 6, 24, 205,
+  255, 137, 255, 239, 87, 35, 96, 87, 20, 11, 92, 87, 79, 239, 89, 26, 0, 54,
+  156, 62, 77, 18, 128, 243, 205, 205, 36, 63, 56, 185, 115, 247, 30, 42, 5,
+  91, 89, 93, 87, 215, 112, 104, 225, 178, 21, 95, 53, 241, 23, 249, 159, 121,
+  1, 220, 82, 12, 47, 99, 134, 12, 212, 152, 161, 4, 102, 8, 3, 142, 89, 146,
+  128, 57, 195, 237, 231, 32, 129, 188, 164, 15, 206, 192, 25, 111, 220, 236,
+  7, 8, 25, 121, 127, 90, 245, 154, 49, 119, 96, 20, 192, 239, 184, 252, 61,
+  53, 227, 197, 11, 39, 249, 220, 62, 100, 125, 52, 184, 99, 93, 220, 161,
+  126, 189, 251, 13, 181, 127, 130, 22, 113, 116, 44, 26, 15, 202, 254, 223,
+  32, 164, 13, 211, 23, 7, 115, 61, 122, 3, 140, 139, 64, 129, 9, 64, 159,
+  143, 223, 239, 236, 2, 96, 52, 208, 124, 80, 252, 18, 173, 0, 179, 12, 144,
+  36, 0, 205, 196, 63, 52, 151, 80, 26, 0, 170, 5, 84, 83, 95, 127, 98, 241,
+  146, 101, 159, 227, 215, 191, 12, 255, 88, 253, 231, 222, 93, 35, 0, 184,
+  61, 97, 9, 128, 0, 202, 247, 156, 67, 14, 206, 91, 20, 206, 33, 14, 167,
+  225, 87, 228, 209, 57, 132, 62, 154, 243, 244, 134, 223, 139, 61, 44, 141,
+  51, 127, 15, 2, 17, 188, 68, 8, 169, 131, 19, 162, 4, 235, 172, 253, 59,
+  86, 63, 248, 207, 234, 247, 161, 233, 15, 136, 191, 41, 61, 24, 11, 247,
+  129, 254, 239, 48, 158, 255, 80, 1, 96, 231, 141, 118, 41, 2, 218, 163, 57,
+  128, 88, 1, 120, 216, 215, 170, 10, 192, 138, 6, 146, 124, 217, 245, 154,
+  227, 180, 3, 112, 170, 241, 220, 57, 182, 35, 112, 185, 109, 247, 238, 125,
+  92, 11, 178, 166, 246, 228, 169, 13, 75, 87, 252, 159, 118, 248, 127, 31,
+  218, 255, 61, 106, 250, 108, 179, 143, 49, 59, 56, 4, 64, 64, 40, 136, 33,
+  198, 162, 112, 150, 56, 152, 29, 242, 73, 6, 113, 242, 218, 73, 152, 244,
+  37, 146, 14, 194, 120, 119, 203, 7, 194, 175, 106, 15, 73, 17, 106, 73, 239,
+  31, 5, 179, 196, 186, 167, 100, 233, 70, 41, 234, 224, 168, 158, 251, 197,
+  228, 129, 64, 128, 218, 104, 254, 147, 23, 10, 192, 229, 47, 84, 254, 193,
+  204, 81, 236, 39, 194, 241, 223, 176, 15, 204, 255, 41, 209, 176, 30, 238,
+  255, 37, 254, 154, 3, 146, 150, 11, 174, 55, 73, 252, 233, 18, 232, 117,
+  54, 2, 66, 210, 68, 54, 3, 218, 32, 150, 128, 168, 76, 204, 145, 61, 123,
+  40, 254, 165, 21, 85, 199, 79, 158, 46, 89, 186, 226, 63, 99, 252, 181, 255,
+  231, 21, 128, 59, 183, 53, 221, 139, 228, 252, 196, 26, 64, 72, 6, 202, 113,
+  10, 198, 224, 111, 0, 120, 20, 242, 41, 240, 5, 254, 105, 104, 251, 88, 46,
+  32, 9, 54, 202, 243, 195, 175, 230, 201, 163, 48, 244, 215, 183, 127, 2,
+  199, 254, 104, 234, 95, 73, 16, 211, 151, 142, 168, 218, 15, 167, 143, 49,
+  162, 73, 135, 4, 29, 253, 89, 253, 62, 189, 251, 45, 185, 67, 104, 16, 129,
+  217, 223, 68, 247, 64, 247, 255, 217, 254, 143, 154, 27, 26, 85, 91, 195,
+  161, 224, 192, 117, 185, 1, 34, 37, 3, 229, 10, 40, 57, 48, 93, 205, 82,
+  7, 92, 171, 69, 144, 47, 59, 93, 123, 156, 205, 0, 210, 22, 48, 237, 0, 92,
+  174, 41, 217, 183, 143, 17, 1, 83, 251, 63, 188, 98, 217, 255, 128, 195,
+  127, 153, 0, 112, 7, 112, 75, 170, 63, 32, 230, 103, 161, 6, 173, 36, 193,
+  199, 13, 237, 39, 128, 181, 241, 41, 65, 207, 141, 57, 193, 87, 220, 225,
+  57, 11, 125, 139, 56, 52, 13, 233, 93, 77, 226, 80, 68, 27, 158, 205, 24,
+  235, 158, 49, 55, 223, 139, 155, 61, 142, 190, 118, 24, 118, 254, 121, 239,
+  39, 140, 231, 8, 226, 74, 225, 74, 115, 135, 250, 125, 166, 244, 27, 22,
+  14, 66, 221, 195, 1, 204, 255, 55, 140, 230, 198, 68, 219, 208, 167, 68,
+  0, 187, 123, 164, 100, 144, 202, 23, 250, 101, 1, 72, 143, 128, 82, 7, 208,
+  84, 91, 207, 150, 64, 26, 207, 158, 101, 75, 64, 151, 207, 148, 80, 34, 208,
+  163, 165, 180, 5, 212, 112, 124, 217, 146, 255, 94, 194, 63, 133, 89, 191,
+  30, 0, 147, 250, 127, 183, 33, 239, 43, 242, 0, 78, 21, 168, 28, 244, 5,
+  134, 28, 96, 206, 37, 20, 5, 245, 66, 36, 117, 120, 18, 235, 131, 218, 42,
+  129, 176, 234, 163, 71, 206, 45, 242, 56, 200, 27, 12, 67, 127, 155, 238,
+  41, 1, 131, 75, 83, 53, 52, 168, 204, 63, 12, 54, 72, 237, 5, 82, 172, 28,
+  226, 247, 25, 187, 255, 152, 58, 10, 234, 70, 198, 99, 131, 220, 255, 247,
+  171, 248, 223, 103, 139, 6, 5, 0, 5, 64, 15, 164, 0, 96, 253, 66, 58, 1,
+  68, 236, 91, 232, 128, 138, 76, 177, 167, 141, 38, 128, 92, 10, 154, 74,
+  1, 146, 11, 98, 39, 229, 1, 163, 21, 192, 26, 114, 51, 172, 88, 241, 239,
+  238, 203, 230, 47, 72, 255, 238, 34, 214, 47, 235, 6, 152, 192, 7, 96, 220,
+  161, 3, 150, 115, 253, 102, 74, 132, 105, 141, 40, 128, 62, 249, 72, 225,
+  130, 15, 34, 140, 119, 16, 135, 162, 158, 15, 184, 251, 101, 233, 57, 234,
+  28, 248, 119, 86, 126, 157, 228, 145, 41, 61, 247, 101, 109, 144, 98, 25,
+  10, 164, 27, 238, 87, 204, 207, 136, 251, 223, 98, 14, 101, 47, 48, 12, 231,
+  191, 64, 252, 167, 234, 6, 244, 240, 209, 251, 95, 175, 0, 245, 221, 212,
+  5, 0, 130, 255, 21, 57, 2, 74, 39, 0, 88, 7, 152, 102, 0, 93, 53, 146, 6,
+  140, 182, 128, 137, 3, 104, 59, 72, 183, 192, 75, 143, 49, 145, 240, 147,
+  91, 150, 127, 10, 186, 127, 42, 255, 136, 152, 223, 33, 235, 163, 210, 1,
+  70, 226, 15, 99, 70, 32, 96, 200, 193, 229, 92, 194, 112, 80, 41, 8, 249,
+  125, 254, 145, 209, 81, 95, 66, 83, 134, 187, 224, 87, 29, 31, 158, 248,
+  89, 214, 207, 121, 131, 97, 211, 47, 234, 94, 37, 112, 235, 134, 136, 87,
+  79, 26, 185, 191, 23, 119, 172, 177, 63, 232, 71, 202, 175, 22, 117, 148,
+  160, 142, 16, 186, 97, 62, 208, 254, 133, 178, 49, 80, 51, 54, 212, 125,
+  67, 80, 0, 234, 4, 64, 21, 128, 124, 55, 4, 13, 252, 21, 166, 3, 36, 213,
+  98, 123, 78, 146, 12, 224, 36, 147, 130, 166, 248, 183, 180, 94, 174, 162,
+  68, 176, 199, 202, 202, 43, 104, 105, 96, 239, 210, 71, 116, 243, 7, 178,
+  62, 240, 25, 143, 91, 14, 238, 127, 121, 5, 76, 0, 229, 15, 116, 4, 198,
+  109, 188, 145, 30, 164, 206, 243, 128, 233, 3, 221, 128, 92, 18, 8, 6, 56,
+  9, 227, 83, 78, 246, 56, 71, 221, 71, 185, 127, 167, 104, 136, 119, 227,
+  7, 239, 16, 39, 64, 217, 30, 211, 199, 120, 202, 134, 211, 23, 243, 3, 234,
+  31, 58, 197, 109, 164, 127, 97, 68, 29, 48, 42, 219, 127, 3, 82, 54, 64,
+  173, 13, 107, 252, 111, 10, 243, 71, 19, 160, 3, 162, 95, 220, 195, 101,
+  128, 88, 5, 152, 45, 129, 119, 176, 47, 59, 79, 103, 125, 79, 82, 29, 0,
+  222, 2, 108, 61, 85, 178, 103, 223, 126, 114, 255, 87, 84, 146, 63, 168,
+  89, 52, 161, 105, 223, 197, 210, 159, 102, 125, 66, 172, 143, 58, 9, 116,
+  201, 191, 24, 74, 112, 240, 36, 140, 227, 171, 222, 116, 249, 99, 72, 48,
+  132, 156, 171, 36, 238, 243, 74, 242, 208, 180, 87, 218, 103, 21, 253, 141,
+  185, 226, 168, 185, 238, 131, 82, 63, 83, 49, 92, 15, 146, 43, 231, 18, 13,
+  170, 228, 223, 158, 252, 136, 90, 42, 52, 50, 144, 244, 227, 240, 207, 175,
+  231, 7, 65, 1, 153, 187, 144, 120, 204, 15, 219, 127, 112, 255, 139, 199,
+  255, 28, 255, 65, 161, 1, 211, 173, 72, 192, 85, 2, 224, 243, 13, 240, 14,
+  48, 199, 95, 84, 0, 201, 215, 93, 174, 101, 51, 96, 141, 140, 8, 154, 126,
+  197, 229, 226, 221, 123, 246, 31, 60, 86, 94, 89, 85, 125, 226, 196, 233,
+  53, 65, 147, 246, 9, 243, 254, 106, 5, 208, 91, 19, 150, 250, 135, 113, 2,
+  76, 25, 56, 140, 57, 248, 67, 83, 35, 10, 105, 134, 164, 149, 98, 128, 97,
+  251, 230, 213, 159, 177, 153, 67, 51, 14, 254, 168, 180, 3, 126, 67, 53,
+  2, 107, 189, 88, 253, 228, 8, 192, 223, 96, 142, 119, 140, 145, 72, 243,
+  23, 248, 143, 170, 32, 94, 119, 255, 56, 249, 11, 140, 255, 227, 129, 62,
+  196, 255, 136, 234, 63, 106, 107, 196, 119, 67, 111, 0, 10, 202, 136, 1,
+  117, 1, 140, 72, 252, 5, 11, 36, 57, 0, 244, 156, 116, 74, 37, 192, 179,
+  92, 40, 230, 242, 229, 195, 84, 10, 232, 240, 49, 74, 16, 216, 208, 88, 220,
+  165, 105, 31, 176, 255, 199, 248, 123, 28, 128, 9, 44, 254, 51, 102, 170,
+  1, 218, 176, 99, 143, 63, 134, 52, 99, 232, 171, 101, 19, 136, 51, 222, 84,
+  138, 81, 166, 153, 23, 126, 192, 26, 159, 139, 91, 35, 31, 120, 224, 223,
+  216, 33, 215, 169, 191, 122, 253, 176, 228, 124, 178, 214, 190, 188, 122,
+  127, 194, 254, 245, 236, 191, 223, 210, 13, 52, 218, 199, 33, 237, 255, 109,
+  213, 104, 137, 255, 232, 141, 14, 208, 0, 4, 146, 129, 44, 97, 184, 172,
+  240, 151, 66, 112, 76, 44, 238, 4, 173, 0, 243, 25, 96, 222, 2, 172, 163,
+  91, 96, 7, 143, 149, 85, 215, 212, 156, 104, 60, 214, 52, 69, 182, 253, 238,
+  222, 187, 231, 32, 253, 186, 101, 135, 128, 150, 12, 160, 233, 4, 176, 40,
+  164, 203, 221, 143, 65, 163, 31, 211, 194, 33, 19, 57, 28, 243, 35, 242,
+  88, 71, 175, 63, 237, 34, 142, 69, 44, 18, 89, 9, 191, 243, 242, 183, 103,
+  10, 240, 14, 49, 219, 35, 64, 217, 159, 67, 54, 210, 214, 13, 100, 175, 53,
+  202, 111, 127, 129, 191, 197, 29, 129, 219, 199, 17, 75, 255, 199, 103, 214,
+  127, 200, 79, 32, 234, 63, 66, 3, 70, 149, 12, 120, 2, 216, 174, 88, 224,
+  213, 8, 88, 23, 193, 255, 44, 173, 0, 11, 26, 32, 54, 34, 116, 158, 14, 1,
+  82, 49, 224, 154, 186, 186, 134, 147, 53, 83, 244, 214, 39, 103, 125, 116,
+  240, 62, 211, 37, 191, 91, 152, 247, 221, 165, 1, 134, 4, 33, 13, 200, 85,
+  105, 15, 155, 62, 84, 141, 161, 191, 98, 173, 16, 39, 99, 188, 101, 252,
+  160, 225, 155, 201, 65, 235, 207, 50, 222, 96, 180, 238, 17, 83, 82, 244,
+  138, 62, 12, 143, 148, 192, 37, 82, 158, 88, 164, 173, 218, 47, 222, 251,
+  64, 123, 233, 128, 61, 196, 143, 220, 191, 223, 208, 13, 196, 233, 127, 44,
+  214, 135, 248, 159, 135, 49, 109, 132, 28, 27, 239, 208, 247, 63, 215, 0,
+  209, 146, 225, 62, 95, 79, 19, 31, 1, 163, 5, 96, 161, 3, 67, 15, 202, 69,
+  18, 255, 83, 26, 160, 70, 54, 3, 76, 19, 196, 221, 116, 8, 240, 232, 209,
+  242, 170, 227, 117, 245, 39, 247, 203, 182, 255, 93, 15, 252, 33, 221, 27,
+  82, 0, 67, 18, 96, 19, 182, 252, 155, 121, 197, 143, 141, 27, 145, 30, 134,
+  159, 189, 84, 42, 105, 212, 122, 53, 145, 36, 114, 253, 144, 85, 66, 54,
+  252, 97, 199, 79, 175, 19, 70, 163, 14, 218, 120, 163, 237, 99, 50, 72, 8,
+  65, 26, 241, 242, 73, 85, 181, 49, 179, 63, 35, 249, 143, 131, 253, 81, 110,
+  255, 180, 247, 47, 56, 92, 128, 112, 0, 24, 31, 148, 225, 95, 60, 214, 207,
+  232, 159, 12, 1, 104, 180, 0, 194, 18, 64, 177, 0, 160, 26, 128, 3, 130,
+  50, 150, 216, 255, 96, 179, 36, 129, 146, 108, 225, 12, 255, 235, 188, 0,
+  64, 103, 0, 232, 5, 64, 252, 67, 41, 21, 3, 62, 114, 172, 180, 170, 246,
+  120, 109, 195, 102, 201, 250, 40, 27, 62, 6, 235, 39, 102, 254, 119, 200,
+  255, 184, 100, 224, 198, 160, 42, 164, 235, 166, 199, 216, 79, 72, 248, 51,
+  168, 201, 155, 4, 220, 193, 150, 92, 68, 62, 214, 112, 176, 81, 150, 134,
+  119, 191, 161, 26, 97, 165, 126, 174, 224, 143, 107, 70, 59, 139, 63, 177,
+  168, 57, 68, 138, 22, 136, 228, 230, 191, 96, 126, 213, 61, 4, 123, 124,
+  140, 188, 196, 0, 47, 255, 13, 24, 254, 95, 49, 64, 134, 100, 2, 200, 236,
+  191, 187, 23, 81, 64, 176, 4, 96, 132, 118, 0, 229, 18, 184, 220, 21, 239,
+  233, 185, 73, 235, 60, 108, 4, 136, 85, 0, 47, 93, 110, 171, 167, 60, 112,
+  135, 143, 150, 151, 87, 215, 213, 158, 92, 106, 178, 126, 169, 4, 208, 200,
+  0, 76, 229, 135, 241, 9, 83, 251, 103, 92, 183, 6, 76, 53, 192, 177, 113,
+  47, 137, 56, 245, 201, 88, 227, 255, 95, 246, 222, 52, 86, 211, 52, 61, 15,
+  26, 22, 71, 22, 252, 176, 65, 16, 130, 28, 132, 217, 76, 68, 34, 19, 39,
+  142, 147, 16, 130, 28, 144, 81, 4, 216, 240, 35, 56, 10, 10, 193, 72, 96,
+  4, 24, 126, 96, 131, 64, 132, 56, 18, 81, 80, 192, 136, 8, 176, 68, 18, 65,
+  20, 185, 167, 187, 167, 167, 103, 60, 51, 221, 179, 184, 167, 215, 170, 174,
+  165, 187, 246, 94, 170, 186, 170, 206, 190, 124, 251, 254, 238, 223, 247,
+  85, 53, 239, 179, 223, 219, 243, 126, 167, 17, 18, 216, 231, 121, 106, 235,
+  158, 233, 58, 231, 84, 93, 207, 114, 47, 215, 125, 93, 212, 44, 36, 147,
+  30, 126, 46, 32, 104, 143, 127, 89, 80, 5, 169, 106, 142, 60, 67, 184, 120,
+  160, 64, 249, 165, 51, 228, 83, 125, 250, 45, 241, 7, 50, 127, 102, 192,
+  243, 133, 148, 146, 212, 151, 223, 67, 213, 31, 36, 253, 74, 220, 167, 20,
+  254, 199, 161, 253, 71, 239, 255, 16, 57, 28, 5, 11, 128, 61, 61, 1, 224,
+  36, 64, 116, 193, 248, 193, 45, 43, 2, 165, 10, 0, 154, 43, 168, 46, 128,
+  253, 43, 42, 1, 80, 248, 223, 184, 113, 227, 195, 91, 109, 2, 112, 243, 203,
+  95, 249, 138, 246, 2, 252, 206, 247, 222, 124, 235, 191, 253, 18, 28, 250,
+  198, 178, 223, 52, 2, 20, 221, 127, 144, 21, 100, 196, 9, 80, 188, 240, 195,
+  177, 183, 223, 74, 102, 17, 70, 106, 253, 168, 228, 147, 193, 179, 159, 19,
+  237, 72, 199, 52, 44, 164, 203, 63, 218, 246, 241, 124, 50, 36, 31, 55, 134,
+  181, 159, 49, 160, 145, 207, 98, 182, 161, 230, 227, 157, 251, 209, 159,
+  30, 127, 254, 199, 168, 129, 160, 240, 15, 229, 159, 40, 254, 227, 147, 135,
+  150, 0, 224, 44, 3, 29, 1, 64, 39, 140, 15, 45, 3, 236, 190, 103, 0, 168,
+  255, 114, 239, 195, 239, 191, 165, 116, 128, 109, 5, 232, 86, 187, 65, 148,
+  14, 224, 171, 223, 248, 214, 183, 95, 255, 238, 59, 111, 253, 210, 151, 252,
+  212, 23, 57, 255, 92, 246, 187, 33, 105, 160, 120, 9, 80, 39, 64, 250, 111,
+  13, 130, 62, 160, 223, 84, 60, 232, 139, 154, 133, 100, 146, 132, 28, 52,
+  139, 179, 212, 163, 229, 46, 248, 145, 208, 255, 10, 71, 152, 206, 51, 120,
+  8, 225, 103, 60, 82, 84, 251, 135, 207, 201, 57, 13, 255, 244, 37, 110, 198,
+  7, 92, 16, 25, 10, 136, 167, 62, 150, 59, 62, 245, 250, 111, 40, 255, 111,
+  111, 160, 30, 32, 0, 236, 251, 250, 159, 251, 13, 123, 218, 6, 232, 190,
+  231, 128, 219, 72, 241, 35, 29, 0, 40, 14, 240, 77, 51, 6, 126, 255, 107,
+  47, 189, 242, 234, 171, 95, 127, 77, 145, 192, 222, 249, 119, 81, 250, 239,
+  124, 127, 148, 243, 23, 144, 123, 90, 35, 243, 159, 110, 3, 48, 226, 2, 136,
+  78, 59, 6, 30, 96, 175, 190, 203, 33, 127, 199, 213, 207, 101, 195, 153,
+  132, 20, 147, 121, 33, 163, 132, 112, 150, 132, 73, 8, 152, 25, 242, 21,
+  40, 253, 161, 41, 18, 116, 253, 219, 240, 15, 42, 135, 135, 14, 62, 231,
+  126, 99, 246, 135, 218, 154, 103, 110, 252, 27, 186, 70, 145, 250, 79, 155,
+  0, 62, 34, 10, 16, 208, 49, 254, 88, 83, 0, 77, 2, 232, 40, 64, 79, 219,
+  245, 198, 27, 218, 10, 252, 125, 109, 5, 215, 254, 23, 247, 191, 243, 66,
+  27, 255, 181, 15, 192, 119, 191, 247, 198, 59, 63, 247, 37, 32, 250, 242,
+  44, 46, 251, 142, 66, 128, 32, 246, 94, 55, 100, 7, 160, 139, 160, 65, 193,
+  189, 251, 129, 125, 226, 92, 40, 137, 189, 98, 50, 249, 236, 99, 9, 201,
+  66, 168, 249, 33, 17, 161, 149, 16, 250, 33, 202, 207, 34, 170, 30, 231,
+  223, 151, 5, 28, 249, 151, 70, 72, 3, 141, 16, 145, 200, 150, 231, 128, 250,
+  141, 166, 199, 165, 240, 111, 126, 22, 218, 63, 222, 53, 136, 225, 63, 254,
+  236, 33, 242, 128, 56, 12, 13, 96, 101, 24, 112, 251, 150, 155, 1, 83, 50,
+  192, 154, 3, 168, 18, 133, 119, 222, 124, 243, 45, 19, 0, 220, 52, 36, 241,
+  119, 95, 120, 177, 125, 255, 191, 161, 56, 96, 111, 254, 244, 231, 18, 254,
+  230, 252, 75, 178, 239, 13, 115, 127, 170, 177, 25, 40, 220, 4, 236, 180,
+  35, 224, 1, 248, 45, 252, 168, 206, 11, 245, 195, 169, 79, 84, 38, 107, 199,
+  150, 5, 215, 141, 246, 85, 159, 25, 187, 252, 249, 48, 9, 117, 12, 206, 76,
+  75, 113, 202, 70, 254, 5, 223, 48, 228, 28, 96, 62, 222, 194, 29, 127, 160,
+  28, 141, 181, 99, 166, 16, 255, 30, 106, 255, 153, 242, 47, 199, 255, 233,
+  163, 48, 1, 230, 37, 96, 108, 3, 240, 252, 252, 65, 27, 255, 185, 25, 144,
+  79, 109, 5, 176, 253, 239, 110, 170, 33, 160, 119, 84, 5, 88, 85, 128, 110,
+  223, 189, 123, 75, 121, 65, 125, 227, 181, 111, 125, 231, 123, 191, 245,
+  253, 159, 64, 225, 255, 243, 160, 249, 184, 65, 15, 0, 221, 0, 196, 252,
+  73, 220, 3, 193, 10, 146, 162, 14, 144, 183, 191, 51, 67, 7, 223, 85, 97,
+  86, 226, 217, 207, 10, 60, 225, 151, 11, 10, 114, 154, 111, 152, 161, 170,
+  223, 76, 16, 16, 66, 3, 31, 66, 236, 223, 126, 236, 177, 121, 179, 145, 114,
+  188, 105, 219, 78, 129, 19, 21, 40, 254, 217, 25, 130, 133, 101, 254, 115,
+  229, 104, 172, 253, 97, 63, 72, 31, 148, 255, 78, 208, 224, 136, 29, 0, 211,
+  59, 231, 16, 156, 127, 27, 0, 30, 219, 6, 96, 187, 97, 30, 234, 248, 223,
+  248, 64, 56, 10, 72, 155, 0, 222, 83, 9, 128, 19, 2, 87, 58, 145, 247, 190,
+  242, 194, 87, 94, 249, 218, 55, 95, 255, 246, 119, 127, 235, 141, 127, 10,
+  132, 255, 88, 243, 17, 74, 189, 172, 161, 239, 67, 19, 162, 192, 53, 245,
+  254, 162, 155, 128, 186, 66, 2, 151, 64, 7, 189, 90, 25, 195, 30, 68, 226,
+  172, 218, 75, 121, 126, 92, 71, 200, 208, 77, 231, 140, 240, 129, 216, 222,
+  11, 42, 32, 36, 152, 70, 229, 197, 72, 28, 250, 153, 226, 168, 2, 200, 135,
+  184, 29, 181, 112, 217, 31, 241, 141, 26, 113, 219, 72, 245, 229, 13, 76,
+  45, 199, 187, 134, 7, 219, 128, 80, 255, 109, 19, 0, 47, 1, 30, 76, 64, 142,
+  125, 0, 240, 216, 92, 255, 182, 3, 236, 134, 197, 247, 30, 126, 95, 27, 193,
+  168, 10, 160, 225, 128, 221, 127, 237, 203, 47, 191, 98, 166, 128, 222, 248,
+  135, 66, 248, 7, 223, 127, 24, 0, 98, 231, 151, 38, 68, 129, 208, 250, 169,
+  6, 101, 65, 236, 5, 73, 65, 15, 119, 133, 255, 109, 57, 125, 242, 221, 225,
+  207, 97, 202, 215, 245, 242, 139, 178, 225, 84, 226, 45, 76, 148, 112, 233,
+  88, 152, 251, 193, 39, 102, 53, 2, 57, 187, 31, 35, 152, 201, 2, 18, 48,
+  157, 156, 187, 232, 175, 55, 144, 196, 67, 160, 112, 180, 250, 24, 67, 156,
+  254, 159, 6, 221, 8, 136, 255, 217, 35, 99, 1, 231, 60, 0, 156, 11, 156,
+  121, 0, 246, 181, 11, 136, 178, 1, 244, 42, 176, 234, 63, 221, 55, 248, 107,
+  43, 56, 117, 1, 220, 127, 240, 238, 111, 188, 248, 202, 171, 202, 13, 248,
+  123, 111, 254, 46, 174, 249, 200, 85, 255, 81, 8, 72, 223, 0, 250, 14, 96,
+  67, 208, 134, 93, 245, 53, 218, 45, 198, 49, 8, 18, 250, 161, 105, 136, 96,
+  25, 32, 31, 126, 42, 31, 9, 100, 195, 129, 190, 55, 179, 12, 226, 142, 129,
+  212, 53, 104, 97, 79, 63, 43, 253, 76, 189, 44, 165, 137, 41, 67, 51, 193,
+  124, 204, 25, 142, 254, 195, 232, 223, 72, 80, 142, 156, 207, 71, 96, 250,
+  235, 36, 76, 14, 16, 217, 152, 190, 229, 127, 60, 117, 5, 64, 43, 1, 97,
+  30, 128, 19, 212, 0, 50, 34, 0, 42, 3, 184, 106, 57, 224, 215, 174, 181,
+  25, 64, 27, 255, 61, 184, 243, 27, 47, 190, 164, 43, 128, 223, 125, 171,
+  102, 154, 175, 88, 239, 75, 220, 0, 200, 0, 208, 227, 191, 246, 6, 128, 0,
+  228, 154, 254, 11, 193, 94, 57, 6, 9, 238, 112, 152, 223, 133, 195, 62, 254,
+  242, 203, 178, 225, 130, 103, 196, 124, 129, 39, 253, 151, 43, 145, 244,
+  17, 240, 215, 225, 223, 216, 154, 134, 146, 25, 194, 57, 49, 161, 94, 198,
+  240, 247, 202, 209, 64, 60, 128, 226, 63, 241, 106, 14, 161, 252, 67, 248,
+  127, 106, 31, 250, 250, 95, 152, 0, 49, 155, 70, 223, 24, 119, 84, 1, 232,
+  190, 139, 255, 29, 5, 104, 239, 214, 27, 111, 190, 253, 158, 22, 2, 87, 78,
+  16, 119, 218, 11, 224, 213, 23, 95, 106, 51, 0, 229, 5, 51, 138, 106, 254,
+  34, 252, 99, 55, 0, 187, 3, 214, 181, 104, 9, 10, 221, 33, 161, 85, 96, 251,
+  59, 11, 193, 24, 18, 155, 132, 9, 15, 63, 187, 251, 201, 211, 95, 42, 237,
+  32, 128, 17, 31, 245, 233, 80, 16, 130, 218, 193, 250, 111, 221, 7, 127,
+  88, 242, 35, 98, 66, 108, 104, 100, 83, 34, 252, 1, 41, 100, 196, 129, 66,
+  125, 152, 41, 156, 254, 12, 131, 163, 212, 52, 238, 49, 176, 0, 216, 243,
+  248, 43, 27, 72, 117, 101, 124, 124, 59, 168, 0, 27, 187, 24, 141, 255, 39,
+  111, 124, 191, 77, 0, 141, 12, 152, 146, 129, 185, 251, 224, 187, 47, 189,
+  172, 90, 64, 175, 125, 231, 123, 251, 216, 243, 135, 5, 128, 91, 40, 246,
+  9, 45, 31, 26, 102, 255, 70, 92, 32, 37, 180, 213, 255, 160, 118, 8, 216,
+  47, 5, 63, 250, 193, 50, 132, 192, 95, 68, 94, 126, 34, 37, 100, 132, 67,
+  25, 215, 119, 142, 103, 10, 196, 216, 143, 72, 71, 231, 25, 46, 252, 18,
+  229, 120, 110, 69, 100, 196, 3, 213, 154, 130, 254, 173, 157, 31, 100, 190,
+  65, 160, 132, 56, 243, 211, 159, 94, 55, 148, 184, 70, 232, 198, 209, 158,
+  173, 255, 56, 254, 143, 191, 52, 76, 0, 120, 235, 142, 81, 129, 85, 20, 96,
+  199, 21, 111, 119, 202, 27, 111, 190, 245, 150, 214, 129, 181, 86, 129, 247,
+  175, 188, 248, 178, 146, 2, 127, 237, 59, 175, 223, 35, 225, 127, 36, 0,
+  216, 96, 207, 7, 102, 252, 4, 110, 1, 97, 19, 224, 3, 15, 255, 65, 193, 79,
+  43, 252, 200, 49, 4, 245, 249, 40, 250, 92, 57, 58, 72, 201, 44, 237, 233,
+  159, 113, 17, 25, 60, 76, 24, 211, 16, 209, 159, 105, 49, 130, 86, 111, 110,
+  232, 131, 203, 199, 240, 9, 194, 137, 47, 254, 178, 232, 63, 72, 135, 249,
+  233, 145, 197, 60, 164, 255, 39, 193, 53, 136, 185, 134, 28, 90, 5, 8, 163,
+  0, 0, 44, 3, 79, 84, 202, 112, 112, 251, 182, 23, 129, 249, 212, 136, 133,
+  169, 33, 176, 253, 43, 111, 106, 29, 80, 213, 1, 208, 28, 176, 251, 183,
+  94, 124, 249, 149, 87, 190, 246, 155, 175, 125, 251, 245, 247, 62, 7, 146,
+  159, 54, 255, 199, 122, 143, 0, 127, 225, 6, 16, 61, 32, 249, 70, 88, 147,
+  127, 114, 255, 105, 65, 188, 162, 114, 169, 212, 131, 5, 196, 65, 167, 95,
+  202, 250, 236, 96, 113, 73, 200, 126, 210, 164, 31, 51, 141, 193, 240, 171,
+  103, 102, 238, 180, 186, 17, 233, 123, 202, 125, 67, 216, 0, 249, 56, 12,
+  126, 194, 201, 95, 217, 55, 166, 93, 71, 96, 250, 155, 185, 198, 12, 220,
+  239, 61, 49, 249, 159, 27, 0, 241, 146, 193, 246, 205, 208, 4, 79, 71, 1,
+  126, 104, 255, 211, 189, 189, 15, 222, 50, 28, 192, 235, 55, 181, 78, 76,
+  155, 35, 188, 242, 210, 87, 190, 250, 234, 111, 126, 171, 189, 0, 168, 226,
+  11, 80, 252, 220, 80, 231, 55, 108, 250, 210, 192, 61, 192, 54, 193, 186,
+  105, 162, 63, 251, 255, 172, 0, 250, 13, 177, 42, 47, 78, 249, 242, 168,
+  101, 4, 22, 17, 91, 198, 106, 254, 11, 54, 75, 42, 72, 200, 248, 206, 194,
+  100, 36, 153, 6, 10, 234, 113, 148, 73, 146, 141, 122, 168, 248, 59, 0, 20,
+  178, 137, 224, 26, 62, 63, 62, 66, 236, 127, 60, 254, 61, 112, 170, 33, 231,
+  214, 2, 68, 75, 192, 24, 203, 8, 91, 0, 210, 33, 195, 125, 71, 1, 255, 232,
+  227, 79, 63, 121, 228, 58, 64, 251, 247, 223, 212, 58, 128, 87, 174, 57,
+  171, 208, 7, 175, 127, 89, 187, 129, 191, 246, 189, 151, 152, 228, 59, 81,
+  124, 38, 130, 239, 112, 7, 112, 251, 191, 176, 7, 224, 54, 32, 63, 194, 119,
+  104, 21, 150, 227, 42, 47, 55, 11, 130, 182, 1, 37, 177, 137, 196, 142, 33,
+  237, 143, 2, 220, 253, 196, 42, 152, 204, 250, 200, 147, 164, 118, 142, 48,
+  119, 193, 159, 96, 26, 24, 74, 138, 162, 9, 241, 40, 100, 127, 125, 110,
+  28, 224, 166, 7, 189, 107, 240, 252, 52, 156, 255, 51, 31, 255, 247, 157,
+  254, 187, 243, 28, 27, 124, 230, 8, 32, 222, 3, 2, 40, 134, 157, 63, 180,
+  1, 160, 85, 1, 115, 98, 113, 143, 237, 16, 88, 27, 1, 124, 248, 161, 206,
+  17, 222, 126, 225, 37, 37, 5, 253, 250, 119, 255, 230, 243, 207, 159, 119,
+  74, 190, 35, 189, 111, 193, 246, 73, 222, 2, 116, 31, 224, 239, 246, 255,
+  47, 112, 164, 79, 234, 124, 5, 188, 247, 169, 95, 12, 81, 144, 69, 250, 161,
+  86, 56, 116, 38, 153, 6, 44, 194, 76, 209, 170, 91, 60, 84, 127, 182, 165,
+  29, 248, 197, 35, 95, 83, 121, 134, 16, 51, 73, 134, 240, 248, 163, 226,
+  63, 25, 30, 183, 238, 131, 103, 250, 36, 31, 99, 215, 184, 126, 208, 255,
+  182, 158, 115, 182, 254, 235, 241, 63, 68, 142, 49, 123, 90, 3, 228, 158,
+  238, 0, 42, 195, 88, 103, 23, 252, 142, 114, 130, 210, 25, 128, 21, 10, 189,
+  241, 229, 47, 191, 250, 181, 175, 125, 243, 181, 111, 255, 26, 8, 255, 153,
+  226, 115, 151, 233, 11, 246, 126, 243, 91, 0, 236, 0, 180, 17, 240, 255,
+  166, 191, 229, 244, 193, 207, 88, 141, 247, 130, 232, 19, 217, 120, 109,
+  26, 2, 159, 126, 22, 250, 17, 182, 255, 138, 220, 61, 222, 51, 112, 62, 130,
+  166, 113, 176, 240, 47, 143, 16, 3, 22, 241, 160, 135, 179, 63, 26, 254,
+  225, 241, 129, 197, 252, 220, 220, 228, 64, 253, 229, 28, 15, 14, 154, 22,
+  228, 19, 87, 255, 119, 19, 192, 135, 96, 98, 176, 119, 164, 226, 63, 59,
+  3, 104, 42, 64, 6, 255, 27, 166, 2, 168, 167, 192, 84, 11, 232, 222, 253,
+  23, 94, 210, 94, 112, 223, 250, 203, 48, 252, 127, 78, 228, 254, 176, 229,
+  3, 242, 124, 17, 239, 0, 176, 3, 216, 125, 64, 190, 41, 163, 104, 193, 29,
+  16, 167, 122, 200, 55, 196, 75, 122, 8, 126, 49, 84, 59, 120, 49, 159, 201,
+  194, 209, 68, 68, 40, 91, 241, 73, 98, 56, 72, 56, 233, 200, 253, 102, 216,
+  52, 118, 65, 228, 35, 250, 96, 240, 7, 138, 71, 113, 238, 183, 217, 70, 231,
+  71, 118, 248, 147, 185, 198, 130, 254, 223, 120, 178, 103, 45, 160, 33, 254,
+  218, 5, 242, 84, 87, 12, 244, 8, 160, 245, 129, 50, 114, 33, 234, 253, 223,
+  191, 251, 214, 91, 154, 2, 114, 77, 203, 0, 168, 34, 161, 242, 130, 248,
+  198, 111, 126, 243, 155, 191, 204, 241, 7, 122, 191, 228, 2, 160, 55, 0,
+  140, 3, 252, 14, 160, 119, 1, 254, 23, 255, 83, 240, 8, 4, 177, 126, 134,
+  31, 252, 60, 98, 23, 196, 194, 126, 162, 33, 152, 235, 191, 83, 22, 248,
+  51, 178, 55, 25, 37, 70, 143, 191, 179, 140, 133, 182, 81, 152, 244, 143,
+  213, 195, 204, 187, 18, 134, 8, 250, 232, 250, 31, 50, 238, 23, 117, 13,
+  238, 161, 244, 207, 211, 63, 7, 56, 255, 31, 31, 25, 7, 160, 167, 123, 1,
+  255, 163, 240, 254, 247, 30, 40, 134, 183, 243, 1, 51, 50, 160, 138, 43,
+  244, 72, 91, 129, 95, 185, 166, 116, 160, 218, 11, 224, 222, 221, 7, 111,
+  190, 240, 226, 87, 20, 9, 252, 23, 37, 197, 255, 103, 76, 239, 155, 224,
+  79, 188, 255, 240, 22, 192, 119, 1, 66, 221, 127, 175, 137, 63, 32, 175,
+  239, 19, 183, 40, 18, 244, 19, 215, 0, 34, 30, 188, 8, 253, 62, 28, 248,
+  47, 104, 228, 191, 138, 170, 71, 170, 31, 43, 200, 249, 10, 33, 251, 148,
+  153, 17, 130, 17, 98, 151, 81, 132, 185, 31, 154, 253, 83, 219, 56, 227,
+  26, 218, 71, 226, 127, 250, 254, 63, 7, 213, 3, 39, 27, 113, 226, 5, 128,
+  246, 130, 103, 208, 177, 199, 255, 83, 205, 0, 53, 34, 48, 170, 2, 160, 117,
+  160, 219, 255, 242, 77, 21, 0, 42, 43, 216, 27, 170, 4, 216, 190, 16, 55,
+  95, 248, 178, 210, 1, 248, 246, 159, 3, 221, 191, 231, 76, 239, 151, 120,
+  254, 136, 214, 127, 107, 246, 16, 128, 77, 64, 96, 119, 63, 234, 44, 120,
+  69, 230, 144, 205, 153, 231, 212, 51, 8, 201, 248, 118, 88, 133, 129, 73,
+  243, 92, 136, 252, 188, 152, 128, 40, 37, 128, 228, 3, 253, 166, 43, 103,
+  99, 103, 244, 65, 165, 131, 35, 35, 228, 161, 155, 176, 116, 181, 159, 190,
+  44, 29, 10, 185, 159, 250, 3, 13, 66, 249, 47, 216, 6, 244, 16, 115, 216,
+  36, 128, 143, 129, 0, 8, 46, 0, 180, 191, 229, 137, 132, 127, 123, 1, 92,
+  85, 248, 191, 167, 42, 192, 218, 43, 234, 254, 253, 143, 190, 252, 146, 146,
+  130, 126, 253, 103, 253, 245, 255, 156, 202, 189, 70, 61, 127, 194, 6, 176,
+  248, 111, 192, 29, 64, 182, 1, 220, 15, 254, 127, 168, 192, 75, 159, 145,
+  112, 47, 248, 70, 97, 199, 32, 233, 230, 47, 185, 152, 156, 26, 54, 157,
+  227, 126, 31, 8, 252, 81, 217, 167, 75, 56, 222, 196, 26, 19, 55, 170, 33,
+  43, 71, 139, 35, 228, 246, 90, 89, 192, 214, 223, 0, 73, 71, 142, 137, 107,
+  172, 105, 33, 13, 15, 77, 248, 231, 195, 127, 252, 254, 187, 224, 161, 31,
+  248, 31, 166, 254, 11, 102, 70, 218, 27, 227, 192, 48, 128, 117, 7, 208,
+  24, 193, 154, 12, 224, 195, 183, 116, 11, 80, 171, 0, 168, 49, 192, 251,
+  31, 125, 83, 77, 1, 124, 227, 155, 127, 234, 121, 215, 249, 119, 23, 0, 13,
+  1, 44, 254, 248, 13, 96, 87, 1, 252, 185, 1, 255, 123, 153, 9, 102, 145,
+  200, 32, 144, 93, 252, 50, 250, 192, 39, 16, 200, 73, 101, 51, 36, 28, 237,
+  159, 126, 40, 239, 27, 247, 13, 8, 194, 241, 101, 238, 45, 67, 167, 19, 113,
+  140, 144, 219, 144, 251, 130, 226, 92, 96, 254, 16, 18, 17, 188, 73, 22,
+  139, 161, 105, 228, 132, 242, 31, 232, 30, 1, 221, 128, 209, 35, 192, 255,
+  211, 150, 17, 176, 105, 212, 59, 241, 249, 95, 240, 139, 84, 248, 63, 120,
+  211, 114, 64, 111, 104, 171, 168, 187, 247, 30, 188, 169, 167, 128, 190,
+  254, 147, 80, 240, 155, 57, 62, 108, 182, 12, 127, 88, 10, 70, 175, 0, 137,
+  5, 232, 191, 132, 255, 149, 185, 67, 22, 184, 184, 31, 192, 199, 49, 31,
+  83, 143, 199, 87, 127, 105, 69, 7, 74, 230, 17, 143, 233, 30, 162, 116, 180,
+  228, 27, 80, 46, 61, 233, 3, 196, 254, 92, 61, 112, 41, 216, 134, 101, 83,
+  199, 251, 238, 67, 217, 159, 145, 36, 30, 98, 62, 210, 40, 116, 127, 78,
+  73, 249, 31, 158, 255, 201, 99, 67, 0, 208, 252, 175, 125, 110, 25, 236,
+  243, 191, 143, 189, 90, 144, 34, 11, 168, 10, 144, 243, 2, 190, 173, 105,
+  226, 215, 95, 124, 241, 149, 175, 126, 237, 235, 191, 239, 243, 231, 162,
+  224, 191, 239, 1, 19, 203, 39, 247, 4, 160, 55, 32, 126, 15, 8, 59, 129,
+  223, 247, 24, 252, 66, 8, 250, 74, 28, 245, 69, 13, 99, 188, 107, 0, 212,
+  117, 21, 58, 126, 157, 151, 191, 255, 204, 115, 72, 249, 133, 98, 143, 18,
+  235, 147, 168, 135, 77, 130, 229, 163, 16, 253, 9, 202, 161, 227, 80, 253,
+  245, 237, 223, 62, 121, 255, 213, 218, 11, 249, 191, 241, 140, 56, 70, 248,
+  127, 100, 25, 128, 31, 125, 98, 253, 34, 172, 92, 184, 170, 0, 189, 123,
+  213, 60, 0, 119, 116, 144, 240, 194, 203, 47, 127, 245, 213, 111, 252, 222,
+  78, 252, 177, 233, 155, 119, 127, 6, 121, 0, 222, 3, 120, 19, 168, 169, 97,
+  186, 43, 106, 33, 202, 67, 218, 29, 240, 135, 92, 233, 21, 180, 227, 129,
+  196, 72, 129, 29, 99, 150, 114, 191, 95, 18, 143, 5, 29, 38, 67, 44, 25,
+  79, 136, 107, 204, 108, 42, 201, 135, 45, 120, 63, 49, 203, 198, 104, 236,
+  119, 200, 149, 131, 81, 248, 215, 126, 160, 177, 215, 126, 241, 226, 207,
+  231, 152, 60, 96, 206, 255, 129, 191, 255, 161, 2, 212, 137, 43, 0, 60, 178,
+  34, 112, 214, 6, 198, 222, 255, 251, 123, 55, 223, 124, 59, 60, 0, 119, 21,
+  254, 95, 123, 233, 229, 87, 94, 253, 198, 15, 119, 227, 207, 60, 191, 112,
+  34, 8, 94, 1, 122, 13, 108, 224, 62, 240, 171, 98, 33, 30, 115, 135, 12,
+  134, 113, 37, 233, 240, 23, 37, 117, 139, 2, 79, 191, 83, 25, 89, 184, 122,
+  63, 205, 250, 151, 84, 78, 32, 203, 240, 160, 63, 85, 16, 90, 17, 195, 224,
+  41, 19, 142, 159, 11, 174, 81, 246, 67, 143, 208, 225, 165, 234, 49, 212,
+  130, 172, 253, 72, 147, 48, 252, 1, 108, 35, 122, 204, 52, 250, 40, 188,
+  255, 251, 206, 51, 56, 56, 70, 156, 239, 3, 10, 88, 120, 255, 247, 247, 239,
+  127, 255, 109, 83, 1, 184, 161, 57, 128, 237, 37, 241, 29, 173, 4, 252, 3,
+  207, 159, 119, 27, 190, 116, 109, 0, 112, 5, 132, 29, 0, 46, 2, 148, 30,
+  172, 181, 89, 104, 206, 67, 60, 146, 230, 229, 146, 97, 152, 0, 62, 150,
+  16, 118, 74, 35, 57, 76, 250, 25, 217, 135, 43, 8, 230, 196, 55, 0, 132,
+  156, 115, 80, 247, 195, 199, 63, 144, 62, 33, 237, 15, 149, 20, 71, 212,
+  242, 21, 235, 254, 32, 245, 0, 253, 161, 38, 199, 180, 251, 119, 46, 184,
+  70, 141, 39, 167, 45, 162, 143, 131, 0, 204, 161, 151, 128, 61, 213, 148,
+  145, 19, 203, 0, 209, 231, 255, 83, 31, 255, 237, 127, 166, 42, 64, 90, 7,
+  84, 39, 128, 247, 238, 221, 123, 231, 133, 246, 254, 255, 122, 227, 245,
+  158, 159, 61, 231, 126, 31, 27, 88, 4, 196, 27, 0, 239, 0, 26, 14, 194, 31,
+  225, 39, 9, 247, 60, 98, 21, 88, 22, 49, 127, 88, 193, 55, 194, 29, 254,
+  54, 248, 91, 248, 97, 28, 74, 245, 11, 58, 82, 29, 210, 209, 97, 251, 149,
+  19, 55, 166, 71, 164, 131, 57, 159, 140, 234, 199, 180, 223, 135, 164, 245,
+  203, 138, 63, 84, 59, 104, 138, 170, 255, 103, 112, 116, 16, 185, 70, 156,
+  219, 250, 175, 19, 128, 49, 1, 64, 168, 25, 223, 117, 35, 0, 166, 0, 172,
+  25, 32, 42, 86, 120, 251, 173, 119, 222, 126, 79, 79, 129, 170, 41, 160,
+  59, 247, 239, 125, 240, 194, 75, 175, 124, 237, 213, 41, 236, 254, 91, 195,
+  175, 136, 229, 91, 136, 1, 96, 20, 24, 118, 0, 126, 9, 44, 250, 224, 151,
+  154, 128, 158, 203, 22, 145, 196, 27, 56, 56, 200, 84, 180, 201, 79, 92,
+  35, 212, 183, 21, 75, 251, 162, 145, 223, 10, 40, 137, 72, 194, 225, 57,
+  174, 251, 146, 216, 31, 9, 8, 45, 184, 126, 76, 223, 31, 127, 164, 250, 71,
+  169, 127, 161, 137, 52, 245, 179, 191, 167, 146, 107, 152, 223, 63, 3, 239,
+  0, 21, 234, 191, 78, 1, 64, 253, 174, 143, 239, 220, 51, 12, 16, 155, 0,
+  58, 181, 152, 247, 219, 251, 95, 203, 0, 105, 43, 176, 219, 247, 238, 223,
+  127, 233, 165, 151, 95, 253, 250, 137, 116, 255, 27, 248, 81, 10, 104, 241,
+  223, 226, 11, 64, 218, 2, 120, 19, 24, 252, 213, 63, 150, 8, 120, 193, 9,
+  92, 246, 6, 22, 249, 61, 212, 41, 206, 193, 95, 4, 147, 96, 92, 244, 161,
+  131, 165, 76, 67, 140, 41, 72, 105, 211, 8, 161, 235, 47, 123, 70, 194, 134,
+  162, 113, 12, 69, 209, 255, 16, 37, 255, 116, 122, 92, 95, 89, 51, 43, 253,
+  28, 92, 99, 81, 251, 40, 204, 32, 124, 6, 249, 255, 7, 190, 254, 123, 106,
+  238, 255, 222, 35, 173, 1, 165, 92, 0, 62, 241, 34, 48, 234, 63, 254, 240,
+  109, 213, 2, 214, 86, 144, 170, 5, 116, 231, 254, 3, 53, 5, 242, 245, 71,
+  8, 254, 231, 194, 249, 103, 33, 0, 48, 128, 135, 201, 32, 217, 1, 228, 167,
+  53, 135, 60, 103, 30, 145, 130, 45, 56, 167, 118, 18, 249, 120, 164, 40,
+  232, 225, 39, 135, 159, 107, 71, 19, 178, 167, 96, 26, 51, 195, 240, 59,
+  241, 80, 32, 31, 55, 95, 178, 49, 66, 119, 252, 87, 0, 187, 1, 112, 13, 157,
+  72, 197, 95, 243, 193, 128, 245, 23, 18, 127, 242, 147, 163, 54, 124, 120,
+  98, 249, 63, 251, 200, 51, 206, 91, 6, 238, 89, 27, 208, 143, 188, 8, 132,
+  73, 0, 62, 82, 5, 128, 43, 87, 222, 215, 231, 191, 13, 0, 238, 126, 244,
+  214, 151, 95, 122, 229, 213, 91, 178, 221, 199, 51, 9, 127, 112, 1, 108,
+  45, 254, 232, 18, 160, 247, 128, 199, 127, 211, 222, 253, 252, 117, 39, 119,
+  61, 14, 247, 11, 98, 26, 230, 220, 36, 232, 209, 71, 26, 178, 43, 31, 245,
+  19, 175, 192, 165, 12, 127, 46, 245, 252, 220, 215, 130, 131, 191, 153, 24,
+  251, 47, 137, 103, 168, 199, 127, 137, 147, 127, 20, 254, 77, 39, 19, 73,
+  58, 238, 200, 207, 254, 155, 225, 79, 200, 254, 240, 237, 191, 246, 247,
+  239, 63, 54, 252, 63, 35, 0, 138, 9, 192, 237, 111, 58, 118, 13, 96, 195,
+  1, 182, 20, 208, 54, 0, 212, 241, 159, 30, 2, 50, 21, 224, 251, 31, 188,
+  240, 226, 87, 94, 121, 55, 216, 125, 4, 2, 112, 231, 5, 64, 194, 64, 183,
+  3, 200, 53, 128, 119, 65, 73, 239, 119, 234, 13, 139, 92, 67, 203, 64, 233,
+  46, 152, 99, 84, 196, 55, 66, 125, 47, 34, 47, 63, 225, 122, 9, 240, 11,
+  218, 177, 75, 210, 245, 155, 138, 99, 196, 129, 81, 128, 141, 3, 102, 30,
+  126, 170, 30, 69, 198, 135, 195, 244, 232, 49, 28, 254, 160, 236, 95, 160,
+  26, 126, 164, 227, 127, 156, 255, 5, 207, 128, 222, 249, 93, 107, 3, 172,
+  25, 64, 214, 48, 88, 21, 139, 223, 121, 75, 81, 64, 223, 191, 102, 188, 224,
+  218, 77, 242, 209, 75, 237, 3, 240, 109, 234, 247, 40, 61, 0, 210, 6, 216,
+  186, 39, 128, 110, 129, 0, 191, 219, 10, 13, 192, 60, 28, 114, 143, 188,
+  228, 21, 138, 15, 126, 39, 250, 192, 52, 4, 221, 253, 142, 141, 239, 2, 127,
+  211, 242, 33, 129, 127, 20, 254, 98, 102, 34, 53, 160, 243, 139, 166, 9,
+  128, 220, 19, 157, 33, 87, 107, 10, 107, 63, 176, 245, 63, 230, 234, 1, 250,
+  249, 95, 46, 124, 248, 199, 93, 3, 145, 108, 232, 177, 41, 255, 65, 2, 112,
+  208, 12, 105, 127, 215, 125, 43, 1, 163, 25, 64, 174, 3, 220, 226, 127, 221,
+  118, 0, 140, 12, 128, 154, 19, 250, 86, 155, 1, 188, 2, 219, 127, 207, 41,
+  254, 160, 8, 28, 54, 0, 202, 3, 54, 228, 33, 128, 143, 129, 221, 4, 117,
+  65, 45, 129, 203, 130, 24, 2, 99, 187, 80, 234, 14, 204, 221, 161, 161, 91,
+  148, 23, 149, 204, 100, 195, 160, 37, 137, 252, 86, 142, 111, 26, 145, 18,
+  176, 59, 113, 204, 77, 131, 64, 236, 55, 95, 196, 74, 63, 102, 3, 76, 124,
+  237, 7, 74, 7, 115, 215, 80, 96, 27, 115, 12, 201, 63, 103, 216, 52, 26,
+  234, 134, 156, 186, 242, 31, 224, 127, 120, 252, 219, 91, 227, 83, 79, 0,
+  106, 19, 64, 51, 4, 170, 253, 162, 239, 106, 14, 224, 251, 215, 110, 40,
+  33, 72, 77, 19, 253, 173, 54, 0, 248, 219, 159, 63, 151, 239, 127, 146, 2,
+  186, 8, 32, 242, 8, 128, 112, 208, 98, 239, 183, 0, 60, 227, 228, 160, 51,
+  175, 216, 50, 86, 234, 161, 97, 95, 205, 92, 67, 212, 237, 31, 49, 139, 91,
+  34, 81, 9, 49, 242, 99, 2, 114, 75, 204, 247, 159, 118, 40, 135, 227, 219,
+  223, 112, 9, 135, 3, 32, 249, 55, 236, 214, 14, 116, 248, 187, 230, 175,
+  235, 254, 247, 5, 252, 219, 15, 208, 123, 236, 12, 128, 246, 225, 0, 136,
+  63, 255, 79, 212, 3, 240, 145, 21, 1, 116, 42, 112, 109, 180, 248, 80, 117,
+  0, 140, 17, 132, 230, 128, 221, 189, 127, 181, 61, 255, 191, 30, 220, 94,
+  80, 2, 72, 30, 0, 24, 3, 10, 87, 64, 184, 6, 80, 90, 208, 254, 104, 10, 126,
+  190, 105, 110, 71, 44, 225, 139, 82, 122, 244, 5, 155, 72, 108, 29, 176,
+  32, 221, 158, 112, 246, 89, 183, 31, 94, 254, 92, 71, 68, 127, 155, 233,
+  166, 47, 131, 31, 165, 126, 240, 245, 135, 209, 69, 187, 187, 6, 125, 102,
+  25, 62, 114, 19, 132, 82, 246, 223, 46, 144, 253, 195, 225, 95, 51, 59, 6,
+  168, 163, 131, 199, 142, 255, 115, 32, 226, 127, 112, 23, 20, 128, 213, 253,
+  111, 57, 160, 251, 111, 105, 25, 168, 171, 134, 2, 162, 90, 64, 183, 95,
+  124, 233, 229, 255, 145, 219, 125, 134, 4, 128, 216, 190, 243, 27, 64, 222,
+  2, 224, 46, 64, 174, 224, 1, 111, 226, 6, 93, 96, 232, 69, 143, 208, 200,
+  195, 239, 181, 5, 169, 105, 200, 18, 163, 15, 199, 204, 132, 211, 143, 20,
+  196, 218, 175, 34, 23, 202, 254, 179, 200, 32, 41, 212, 142, 117, 154, 21,
+  125, 106, 248, 50, 194, 60, 50, 59, 64, 12, 240, 95, 234, 234, 223, 41, 10,
+  255, 122, 206, 53, 202, 11, 7, 180, 191, 125, 236, 29, 160, 73, 253, 199,
+  90, 6, 158, 58, 6, 208, 39, 154, 1, 30, 12, 67, 175, 106, 21, 8, 45, 3, 99,
+  165, 130, 191, 250, 226, 203, 191, 10, 221, 254, 224, 251, 255, 44, 4, 0,
+  161, 12, 204, 238, 0, 225, 33, 0, 187, 160, 161, 62, 208, 254, 39, 234, 15,
+  92, 48, 203, 80, 214, 224, 43, 37, 207, 32, 15, 127, 1, 121, 30, 84, 61,
+  28, 91, 133, 102, 177, 188, 15, 84, 30, 150, 19, 230, 25, 230, 9, 229, 164,
+  242, 131, 74, 63, 150, 73, 190, 130, 188, 63, 64, 252, 241, 68, 18, 196,
+  253, 48, 248, 7, 229, 63, 160, 28, 6, 117, 99, 93, 250, 240, 196, 9, 128,
+  75, 249, 95, 251, 251, 238, 217, 4, 192, 21, 128, 117, 186, 184, 191, 183,
+  255, 193, 219, 214, 9, 76, 115, 128, 212, 45, 241, 218, 75, 47, 255, 151,
+  220, 238, 213, 195, 143, 30, 0, 120, 5, 128, 29, 32, 224, 239, 23, 65, 183,
+  96, 38, 225, 196, 33, 24, 132, 123, 204, 33, 150, 157, 125, 226, 29, 192,
+  123, 125, 188, 228, 23, 34, 191, 80, 244, 195, 145, 159, 127, 151, 166, 211,
+  73, 196, 54, 164, 211, 52, 204, 181, 148, 230, 184, 244, 235, 58, 127, 99,
+  242, 65, 1, 254, 203, 197, 201, 73, 112, 126, 56, 131, 179, 163, 168, 252,
+  223, 174, 189, 39, 79, 129, 254, 135, 167, 141, 122, 205, 152, 79, 204, 8,
+  168, 102, 0, 67, 189, 232, 7, 70, 5, 64, 37, 128, 31, 42, 18, 240, 125, 213,
+  2, 250, 79, 97, 249, 7, 37, 128, 52, 2, 112, 232, 107, 224, 133, 100, 144,
+  174, 70, 64, 151, 252, 47, 149, 12, 126, 21, 41, 243, 86, 113, 207, 160,
+  213, 82, 12, 251, 151, 92, 59, 60, 23, 232, 30, 57, 213, 17, 201, 66, 211,
+  207, 212, 253, 120, 219, 71, 16, 144, 10, 158, 161, 179, 0, 255, 144, 155,
+  70, 18, 229, 120, 139, 255, 169, 175, 254, 133, 217, 31, 40, 254, 234, 133,
+  67, 14, 108, 252, 111, 230, 191, 180, 102, 176, 247, 12, 83, 191, 239, 51,
+  141, 255, 3, 204, 0, 109, 239, 255, 199, 111, 190, 165, 42, 64, 239, 107,
+  47, 224, 91, 183, 239, 62, 184, 255, 193, 111, 188, 248, 11, 220, 238, 93,
+  12, 0, 248, 13, 64, 239, 0, 178, 7, 36, 55, 240, 170, 235, 95, 133, 128,
+  143, 219, 3, 135, 163, 15, 209, 111, 114, 127, 27, 131, 156, 127, 201, 141,
+  3, 232, 128, 33, 37, 25, 186, 194, 211, 2, 48, 126, 100, 206, 199, 130, 210,
+  137, 209, 16, 241, 100, 0, 121, 159, 204, 53, 140, 104, 199, 89, 252, 1,
+  249, 7, 147, 191, 156, 105, 164, 137, 32, 167, 135, 190, 253, 127, 112, 128,
+  61, 131, 13, 103, 124, 239, 158, 30, 1, 252, 24, 21, 128, 149, 97, 248, 59,
+  198, 11, 92, 9, 129, 26, 14, 224, 253, 23, 95, 252, 121, 249, 254, 135, 248,
+  63, 195, 33, 0, 138, 2, 28, 252, 120, 11, 108, 55, 117, 69, 32, 70, 206,
+  224, 21, 255, 159, 192, 217, 23, 108, 225, 101, 167, 64, 15, 127, 73, 138,
+  253, 190, 228, 211, 233, 25, 131, 250, 189, 120, 152, 28, 150, 253, 166,
+  84, 68, 198, 53, 253, 241, 196, 143, 217, 101, 182, 165, 56, 178, 167, 127,
+  48, 34, 99, 31, 220, 131, 120, 129, 241, 63, 11, 228, 223, 62, 177, 13, 176,
+  206, 131, 211, 147, 199, 1, 127, 107, 1, 29, 60, 3, 219, 223, 119, 108, 25,
+  96, 31, 127, 242, 137, 207, 255, 245, 115, 113, 253, 29, 85, 2, 190, 102,
+  101, 64, 238, 180, 23, 192, 55, 95, 248, 55, 72, 251, 23, 225, 31, 34, 64,
+  84, 7, 98, 113, 32, 206, 7, 182, 250, 229, 175, 136, 247, 55, 124, 218, 177,
+  79, 56, 113, 7, 23, 220, 129, 233, 189, 143, 253, 35, 154, 154, 77, 246,
+  45, 5, 219, 144, 60, 147, 188, 66, 69, 249, 208, 21, 187, 252, 35, 132, 111,
+  65, 58, 92, 127, 138, 161, 211, 251, 133, 83, 159, 99, 164, 30, 68, 143,
+  255, 242, 84, 23, 113, 112, 245, 119, 0, 156, 199, 221, 40, 194, 244, 204,
+  231, 255, 192, 51, 212, 179, 70, 123, 189, 243, 187, 86, 3, 238, 99, 75,
+  1, 212, 227, 2, 237, 186, 253, 246, 187, 166, 2, 164, 117, 224, 212, 24,
+  248, 27, 47, 252, 203, 66, 254, 15, 241, 103, 47, 128, 141, 1, 240, 29, 128,
+  174, 129, 109, 77, 124, 191, 5, 67, 112, 247, 19, 248, 63, 170, 24, 250,
+  53, 110, 242, 96, 243, 24, 227, 26, 129, 237, 194, 176, 140, 172, 224, 22,
+  88, 116, 68, 254, 192, 51, 8, 106, 7, 207, 230, 164, 233, 31, 26, 203, 84,
+  57, 190, 253, 78, 43, 255, 8, 255, 25, 24, 252, 1, 198, 1, 167, 65, 249,
+  211, 43, 71, 98, 246, 176, 165, 162, 247, 172, 254, 19, 244, 12, 55, 133,
+  35, 27, 55, 222, 183, 13, 64, 219, 1, 118, 13, 128, 253, 143, 85, 1, 224,
+  61, 51, 4, 164, 240, 191, 251, 224, 253, 23, 254, 152, 116, 254, 165, 7,
+  32, 242, 6, 240, 61, 176, 38, 14, 224, 248, 23, 236, 16, 78, 173, 225, 197,
+  238, 30, 247, 7, 198, 210, 226, 57, 239, 244, 45, 185, 132, 112, 78, 168,
+  94, 5, 105, 248, 2, 158, 81, 62, 69, 240, 227, 216, 207, 187, 124, 44, 86,
+  66, 236, 111, 62, 207, 18, 62, 254, 65, 61, 14, 215, 126, 96, 239, 199, 226,
+  15, 195, 191, 30, 14, 255, 134, 65, 57, 96, 96, 199, 191, 247, 188, 103,
+  184, 117, 0, 113, 67, 131, 31, 223, 135, 248, 251, 2, 240, 193, 19, 245,
+  254, 95, 185, 242, 254, 13, 21, 0, 104, 165, 136, 59, 95, 254, 113, 233,
+  253, 135, 25, 32, 190, 0, 2, 254, 177, 45, 80, 85, 208, 245, 59, 246, 141,
+  236, 136, 14, 240, 189, 145, 20, 115, 10, 180, 210, 210, 37, 245, 10, 92,
+  98, 191, 48, 201, 41, 86, 152, 47, 1, 50, 82, 11, 57, 244, 67, 66, 2, 194,
+  237, 31, 240, 159, 131, 145, 95, 81, 65, 64, 152, 31, 110, 241, 63, 245,
+  163, 159, 144, 252, 53, 192, 166, 161, 211, 201, 216, 180, 255, 246, 128,
+  1, 148, 147, 128, 54, 101, 227, 207, 238, 222, 127, 16, 70, 64, 172, 10,
+  96, 187, 91, 14, 149, 17, 144, 106, 1, 183, 247, 191, 214, 1, 187, 247, 224,
+  171, 255, 204, 115, 80, 255, 9, 12, 48, 8, 63, 173, 3, 131, 76, 144, 109,
+  130, 6, 187, 192, 87, 4, 92, 116, 197, 211, 242, 94, 89, 49, 90, 135, 224,
+  14, 205, 92, 5, 162, 15, 63, 148, 149, 202, 51, 214, 238, 203, 9, 223, 44,
+  228, 161, 224, 145, 14, 26, 82, 11, 30, 251, 135, 219, 159, 8, 8, 77, 253,
+  204, 182, 167, 237, 71, 230, 62, 128, 105, 236, 169, 139, 254, 207, 136,
+  110, 120, 32, 127, 155, 250, 207, 244, 241, 83, 82, 255, 179, 149, 67, 55,
+  52, 182, 111, 92, 96, 13, 3, 244, 81, 160, 0, 29, 94, 87, 20, 144, 247, 175,
+  94, 187, 254, 129, 210, 129, 82, 248, 191, 254, 35, 176, 252, 27, 11, 0,
+  158, 177, 16, 192, 111, 0, 180, 3, 214, 1, 195, 18, 254, 66, 54, 133, 195,
+  95, 200, 243, 132, 128, 15, 185, 132, 114, 231, 160, 12, 78, 246, 48, 179,
+  64, 38, 37, 40, 156, 126, 106, 25, 181, 218, 125, 250, 129, 216, 7, 36, 148,
+  186, 8, 99, 76, 174, 255, 48, 68, 56, 1, 204, 31, 226, 26, 118, 10, 184,
+  63, 130, 109, 12, 144, 13, 223, 179, 249, 255, 1, 48, 13, 61, 245, 253, 191,
+  94, 255, 88, 143, 128, 127, 252, 137, 27, 1, 210, 132, 65, 117, 93, 220,
+  110, 241, 127, 239, 125, 195, 1, 214, 94, 144, 247, 223, 250, 7, 195, 241,
+  135, 247, 63, 121, 0, 158, 137, 55, 0, 221, 1, 53, 119, 253, 14, 200, 50,
+  59, 120, 124, 229, 151, 220, 27, 188, 38, 86, 161, 230, 234, 39, 62, 18,
+  57, 172, 246, 45, 41, 250, 43, 65, 86, 72, 112, 141, 192, 74, 50, 51, 41,
+  244, 67, 210, 225, 148, 243, 67, 165, 163, 135, 136, 245, 15, 166, 190, 132,
+  185, 31, 95, 75, 58, 195, 205, 31, 106, 26, 29, 66, 200, 233, 254, 83, 146,
+  255, 29, 123, 5, 40, 221, 53, 60, 191, 171, 3, 128, 79, 252, 8, 160, 51,
+  140, 254, 184, 205, 255, 212, 16, 232, 245, 235, 31, 24, 29, 176, 251, 55,
+  126, 16, 62, 255, 248, 252, 75, 33, 32, 185, 2, 224, 14, 104, 34, 206, 223,
+  37, 252, 21, 254, 11, 218, 13, 23, 3, 31, 251, 73, 52, 117, 83, 192, 140,
+  159, 149, 123, 5, 9, 225, 34, 239, 138, 252, 20, 254, 57, 213, 247, 158,
+  205, 37, 229, 120, 110, 28, 16, 76, 3, 109, 210, 70, 104, 191, 88, 62, 140,
+  137, 71, 157, 226, 230, 15, 178, 13, 25, 34, 229, 136, 35, 43, 255, 11, 243,
+  63, 43, 1, 111, 52, 3, 30, 40, 19, 152, 7, 97, 4, 208, 204, 0, 238, 239,
+  63, 121, 219, 57, 129, 105, 29, 40, 117, 77, 88, 233, 63, 215, 255, 243,
+  29, 160, 142, 11, 0, 220, 1, 1, 255, 53, 117, 126, 23, 86, 73, 255, 89, 40,
+  237, 179, 18, 47, 181, 12, 68, 174, 81, 21, 233, 242, 11, 113, 159, 160,
+  42, 84, 192, 154, 47, 101, 152, 87, 139, 41, 224, 250, 123, 33, 9, 164, 242,
+  41, 61, 254, 43, 191, 211, 138, 229, 208, 101, 109, 113, 229, 120, 159, 253,
+  185, 7, 101, 165, 117, 191, 78, 207, 152, 109, 12, 168, 33, 218, 2, 242,
+  137, 13, 255, 108, 254, 167, 249, 255, 129, 0, 218, 254, 198, 135, 45, 176,
+  10, 255, 143, 31, 122, 27, 48, 243, 0, 188, 171, 41, 64, 239, 223, 208, 94,
+  144, 90, 43, 184, 16, 243, 63, 26, 1, 24, 248, 159, 1, 240, 241, 45, 176,
+  129, 126, 207, 146, 251, 251, 174, 237, 80, 75, 69, 62, 209, 45, 18, 217,
+  73, 112, 244, 105, 185, 55, 104, 8, 23, 82, 209, 71, 208, 145, 130, 99, 222,
+  144, 240, 35, 20, 126, 164, 219, 223, 24, 198, 15, 145, 103, 40, 26, 34,
+  149, 106, 191, 75, 123, 254, 207, 92, 241, 15, 187, 70, 34, 219, 128, 233,
+  228, 204, 212, 115, 131, 254, 55, 246, 12, 235, 247, 159, 90, 9, 136, 143,
+  63, 49, 134, 65, 174, 96, 116, 112, 67, 115, 64, 213, 249, 191, 249, 161,
+  145, 138, 155, 128, 248, 79, 198, 95, 124, 2, 236, 38, 176, 247, 64, 240,
+  252, 166, 190, 239, 53, 223, 12, 181, 240, 218, 195, 218, 62, 14, 247, 43,
+  201, 38, 212, 57, 10, 100, 16, 252, 37, 117, 12, 203, 121, 216, 79, 243,
+  190, 18, 71, 126, 46, 250, 155, 33, 174, 127, 48, 13, 226, 118, 209, 162,
+  114, 252, 20, 193, 79, 21, 63, 37, 207, 112, 29, 255, 91, 217, 127, 238,
+  26, 72, 93, 227, 206, 159, 218, 241, 111, 50, 255, 127, 234, 104, 99, 7,
+  247, 173, 4, 200, 39, 159, 62, 244, 130, 209, 170, 3, 112, 239, 45, 51, 3,
+  160, 172, 160, 110, 223, 186, 115, 231, 254, 253, 83, 241, 253, 135, 36,
+  0, 225, 6, 64, 119, 192, 182, 166, 126, 223, 196, 248, 29, 97, 76, 110, 133,
+  216, 185, 167, 21, 126, 118, 245, 27, 211, 24, 131, 253, 146, 229, 124, 146,
+  71, 56, 123, 250, 203, 162, 96, 142, 81, 198, 51, 104, 218, 97, 26, 180,
+  96, 195, 132, 56, 208, 240, 134, 225, 32, 248, 31, 143, 121, 231, 47, 104,
+  7, 219, 15, 10, 7, 127, 131, 103, 124, 208, 254, 27, 249, 225, 129, 62, 176,
+  255, 32, 2, 176, 230, 252, 31, 235, 250, 143, 14, 0, 63, 117, 249, 159, 158,
+  23, 127, 244, 150, 149, 129, 187, 249, 129, 26, 2, 106, 31, 128, 39, 188,
+  255, 43, 69, 128, 66, 12, 96, 55, 64, 83, 99, 147, 111, 249, 59, 124, 218,
+  37, 228, 41, 248, 240, 240, 67, 240, 129, 109, 88, 27, 251, 249, 54, 15,
+  178, 11, 228, 47, 127, 6, 213, 69, 48, 203, 159, 106, 8, 230, 193, 216, 141,
+  179, 125, 45, 191, 4, 20, 154, 68, 199, 88, 231, 244, 58, 70, 209, 31, 11,
+  254, 176, 107, 232, 2, 48, 127, 207, 123, 196, 52, 120, 232, 63, 142, 138,
+  33, 135, 79, 161, 255, 59, 225, 127, 105, 209, 80, 103, 2, 231, 24, 160,
+  54, 254, 223, 63, 120, 219, 62, 0, 45, 254, 154, 3, 118, 255, 65, 28, 255,
+  112, 1, 56, 244, 249, 14, 104, 106, 102, 250, 14, 175, 130, 200, 134, 160,
+  55, 62, 57, 246, 21, 50, 141, 197, 215, 126, 128, 191, 4, 181, 62, 106, 26,
+  149, 103, 180, 209, 31, 30, 126, 78, 246, 128, 195, 101, 115, 92, 244, 157,
+  17, 245, 88, 169, 240, 67, 73, 101, 89, 40, 217, 98, 249, 56, 217, 50, 222,
+  14, 16, 47, 78, 92, 239, 175, 7, 76, 67, 41, 249, 95, 127, 148, 113, 104,
+  255, 28, 28, 1, 213, 216, 32, 26, 244, 145, 147, 0, 10, 5, 64, 227, 23, 114,
+  85, 233, 0, 191, 175, 173, 0, 63, 208, 28, 192, 155, 224, 254, 39, 5, 0,
+  233, 5, 192, 59, 96, 77, 237, 190, 43, 114, 25, 224, 75, 193, 254, 51, 124,
+  35, 106, 185, 173, 87, 9, 143, 126, 120, 246, 53, 252, 21, 24, 230, 143,
+  120, 69, 118, 189, 252, 84, 79, 198, 86, 35, 11, 120, 65, 207, 132, 170,
+  47, 17, 17, 202, 98, 134, 209, 96, 228, 195, 234, 61, 3, 46, 161, 112, 252,
+  1, 254, 142, 250, 131, 149, 3, 245, 244, 152, 13, 34, 159, 192, 246, 63,
+  241, 12, 183, 9, 192, 3, 51, 1, 106, 240, 183, 142, 177, 237, 127, 255, 225,
+  59, 134, 3, 172, 134, 128, 116, 5, 240, 221, 103, 164, 255, 7, 51, 192, 238,
+  13, 176, 1, 72, 193, 39, 219, 111, 2, 240, 207, 145, 7, 130, 252, 135, 66,
+  115, 167, 70, 215, 190, 127, 250, 149, 93, 40, 177, 140, 35, 181, 126, 196,
+  240, 101, 97, 63, 181, 13, 113, 197, 104, 231, 25, 4, 15, 63, 112, 13, 138,
+  199, 126, 1, 255, 98, 38, 232, 61, 81, 205, 143, 25, 210, 165, 85, 187, 106,
+  110, 123, 255, 222, 247, 195, 43, 63, 33, 225, 88, 253, 97, 246, 80, 249,
+  143, 120, 6, 171, 189, 243, 228, 62, 96, 128, 155, 17, 32, 51, 47, 242, 224,
+  109, 213, 1, 212, 94, 192, 183, 110, 41, 14, 224, 119, 195, 245, 239, 243,
+  255, 112, 252, 249, 6, 176, 248, 63, 107, 207, 126, 195, 172, 190, 195, 15,
+  120, 151, 35, 148, 229, 231, 158, 188, 248, 17, 139, 232, 128, 126, 83, 119,
+  58, 133, 34, 81, 209, 34, 214, 237, 19, 212, 163, 139, 25, 233, 248, 9, 132,
+  31, 217, 54, 6, 232, 7, 78, 134, 76, 239, 137, 80, 137, 113, 240, 31, 222,
+  127, 87, 252, 3, 194, 143, 131, 33, 34, 255, 152, 91, 228, 224, 169, 179,
+  127, 130, 166, 49, 222, 51, 190, 223, 63, 188, 231, 36, 96, 108, 1, 232,
+  177, 21, 12, 123, 164, 58, 0, 87, 141, 19, 132, 54, 11, 248, 122, 228, 253,
+  15, 15, 128, 69, 31, 226, 255, 204, 156, 125, 182, 42, 184, 19, 196, 205,
+  192, 191, 161, 64, 191, 34, 6, 210, 13, 14, 248, 61, 250, 208, 47, 82, 246,
+  137, 5, 232, 19, 17, 217, 50, 230, 23, 167, 76, 67, 188, 81, 60, 14, 253,
+  188, 126, 40, 86, 144, 3, 153, 38, 168, 47, 15, 113, 240, 207, 213, 3, 231,
+  51, 97, 132, 116, 129, 139, 255, 100, 244, 19, 13, 15, 206, 14, 141, 250,
+  135, 145, 255, 177, 250, 31, 46, 123, 208, 248, 159, 216, 9, 96, 37, 1, 3,
+  28, 131, 15, 14, 246, 108, 7, 80, 13, 129, 220, 86, 28, 176, 23, 113, 253,
+  159, 102, 128, 40, 6, 244, 97, 224, 6, 155, 58, 211, 13, 0, 207, 50, 222,
+  12, 236, 194, 23, 250, 249, 49, 127, 240, 26, 248, 135, 229, 93, 254, 240,
+  84, 68, 190, 144, 29, 163, 152, 95, 156, 51, 13, 65, 167, 159, 72, 199, 175,
+  98, 133, 159, 240, 25, 87, 224, 244, 143, 130, 105, 160, 175, 42, 206, 103,
+  104, 140, 196, 93, 43, 11, 40, 252, 210, 135, 202, 47, 32, 251, 31, 155,
+  15, 116, 98, 162, 57, 142, 191, 81, 13, 107, 19, 0, 75, 0, 50, 12, 80, 171,
+  24, 163, 58, 128, 7, 87, 85, 7, 240, 253, 171, 102, 8, 168, 77, 0, 255, 207,
+  232, 249, 71, 57, 32, 124, 2, 54, 13, 241, 122, 111, 234, 174, 109, 128,
+  54, 3, 124, 235, 43, 250, 31, 54, 176, 196, 199, 226, 253, 154, 24, 6, 162,
+  202, 59, 164, 118, 103, 130, 99, 148, 72, 244, 41, 168, 150, 212, 106, 70,
+  237, 66, 231, 11, 230, 28, 192, 71, 201, 129, 77, 93, 251, 249, 22, 163,
+  33, 96, 253, 8, 165, 31, 118, 253, 59, 252, 207, 130, 238, 103, 15, 40, 63,
+  112, 211, 216, 83, 171, 254, 97, 219, 63, 71, 122, 254, 47, 140, 141, 183,
+  235, 163, 7, 166, 0, 224, 8, 64, 78, 49, 244, 240, 3, 221, 1, 116, 67, 32,
+  183, 239, 253, 58, 122, 255, 159, 75, 240, 99, 252, 55, 200, 227, 25, 25,
+  189, 71, 86, 5, 254, 129, 220, 248, 21, 15, 246, 144, 91, 52, 56, 251, 192,
+  73, 172, 112, 217, 190, 216, 228, 245, 114, 210, 69, 140, 231, 35, 169, 72,
+  234, 146, 228, 84, 14, 252, 5, 33, 153, 204, 63, 254, 43, 116, 249, 91, 195,
+  232, 161, 159, 248, 34, 35, 127, 118, 232, 103, 134, 4, 68, 244, 7, 158,
+  235, 251, 219, 114, 63, 164, 230, 31, 144, 142, 57, 219, 3, 229, 63, 67,
+  255, 57, 193, 99, 195, 15, 85, 252, 255, 145, 35, 0, 125, 102, 38, 134, 85,
+  0, 120, 255, 29, 237, 3, 225, 90, 192, 119, 255, 231, 103, 184, 254, 43,
+  60, 0, 240, 6, 88, 51, 151, 111, 105, 23, 52, 34, 252, 53, 187, 241, 99,
+  209, 30, 53, 11, 70, 198, 145, 77, 153, 73, 236, 46, 209, 31, 30, 11, 137,
+  118, 4, 126, 186, 32, 189, 162, 142, 113, 180, 229, 23, 145, 142, 199, 3,
+  5, 19, 31, 176, 123, 237, 104, 50, 242, 41, 136, 71, 174, 150, 115, 212,
+  251, 117, 220, 159, 65, 224, 126, 185, 234, 127, 251, 129, 206, 225, 244,
+  31, 54, 141, 180, 157, 163, 39, 150, 0, 166, 71, 128, 92, 3, 72, 93, 25,
+  15, 223, 49, 5, 160, 107, 170, 0, 112, 251, 246, 221, 191, 66, 239, 127,
+  48, 4, 202, 240, 95, 83, 155, 239, 240, 29, 110, 129, 6, 192, 90, 53, 53,
+  207, 17, 192, 149, 95, 53, 209, 23, 159, 188, 249, 110, 85, 225, 238, 5,
+  229, 30, 251, 2, 103, 146, 103, 80, 46, 188, 252, 146, 118, 188, 216, 239,
+  231, 137, 255, 18, 179, 139, 128, 97, 176, 222, 111, 190, 94, 63, 34, 226,
+  177, 224, 241, 159, 47, 112, 242, 223, 126, 220, 153, 131, 159, 217, 70,
+  129, 240, 207, 126, 160, 190, 193, 255, 240, 128, 154, 6, 122, 252, 15, 220,
+  251, 239, 71, 128, 44, 99, 112, 95, 171, 0, 93, 211, 86, 128, 170, 5, 248,
+  23, 217, 251, 255, 28, 227, 239, 115, 128, 103, 196, 234, 157, 109, 1, 241,
+  50, 0, 191, 86, 252, 62, 104, 216, 131, 47, 216, 195, 99, 252, 107, 41, 223,
+  15, 102, 2, 176, 220, 231, 133, 37, 119, 6, 126, 186, 29, 153, 205, 220,
+  229, 44, 169, 71, 243, 204, 143, 242, 11, 204, 117, 179, 28, 145, 210, 207,
+  148, 41, 126, 8, 84, 194, 213, 114, 10, 224, 71, 198, 1, 35, 103, 65, 231,
+  93, 195, 102, 3, 115, 255, 171, 244, 239, 48, 148, 255, 28, 255, 187, 111,
+  18, 0, 167, 1, 30, 68, 224, 109, 5, 208, 168, 0, 25, 25, 176, 59, 191, 2,
+  251, 255, 6, 250, 48, 5, 6, 47, 0, 106, 237, 107, 64, 10, 155, 128, 110,
+  131, 166, 22, 46, 132, 90, 172, 238, 208, 99, 79, 60, 194, 33, 252, 235,
+  26, 158, 125, 97, 172, 35, 203, 11, 202, 239, 205, 131, 218, 140, 44, 30,
+  111, 251, 145, 254, 238, 159, 45, 72, 205, 159, 58, 7, 240, 216, 47, 243,
+  159, 116, 30, 56, 191, 192, 49, 120, 66, 108, 163, 204, 28, 9, 236, 39, 77,
+  192, 220, 39, 242, 141, 113, 206, 79, 0, 255, 145, 47, 255, 128, 241, 31,
+  87, 60, 214, 248, 247, 76, 3, 240, 211, 96, 3, 106, 83, 134, 195, 15, 76,
+  0, 112, 67, 7, 128, 119, 110, 255, 18, 140, 255, 224, 249, 199, 27, 128,
+  121, 186, 210, 103, 32, 186, 15, 80, 166, 16, 65, 30, 215, 247, 234, 152,
+  81, 180, 250, 151, 44, 128, 191, 202, 112, 208, 207, 8, 94, 98, 216, 79,
+  197, 37, 60, 19, 37, 35, 129, 127, 28, 254, 12, 15, 251, 97, 82, 249, 20,
+  81, 190, 45, 231, 91, 169, 189, 10, 166, 145, 144, 74, 54, 14, 204, 31, 68,
+  253, 3, 179, 31, 222, 55, 96, 98, 221, 127, 221, 249, 7, 131, 195, 214, 51,
+  126, 240, 209, 125, 19, 255, 63, 52, 34, 192, 143, 141, 99, 104, 139, 255,
+  253, 119, 222, 49, 20, 160, 155, 55, 111, 181, 15, 192, 127, 64, 207, 63,
+  233, 1, 169, 159, 54, 220, 212, 21, 93, 2, 36, 36, 68, 27, 1, 108, 6, 225,
+  202, 199, 187, 7, 251, 196, 163, 131, 239, 62, 63, 244, 136, 23, 90, 252,
+  2, 183, 63, 167, 130, 130, 101, 41, 43, 10, 33, 105, 199, 32, 240, 195, 53,
+  4, 179, 21, 29, 43, 128, 159, 152, 166, 126, 192, 54, 40, 90, 251, 177, 248,
+  159, 129, 219, 31, 94, 255, 4, 255, 118, 47, 25, 241, 15, 23, 255, 121, 225,
+  0, 32, 27, 241, 80, 197, 255, 106, 0, 232, 33, 100, 0, 183, 91, 230, 209,
+  187, 239, 188, 219, 38, 128, 215, 117, 2, 112, 235, 206, 159, 39, 239, 255,
+  115, 90, 1, 120, 230, 237, 125, 193, 38, 0, 214, 238, 226, 46, 240, 187,
+  1, 94, 8, 82, 85, 55, 138, 125, 45, 152, 6, 175, 27, 128, 126, 14, 234, 46,
+  25, 181, 135, 207, 153, 186, 100, 244, 238, 119, 240, 103, 36, 242, 155,
+  227, 200, 31, 204, 147, 103, 212, 54, 8, 150, 153, 87, 22, 125, 111, 25,
+  11, 196, 99, 5, 222, 79, 184, 90, 70, 140, 249, 229, 133, 255, 64, 247, 71,
+  95, 37, 179, 169, 169, 254, 169, 235, 255, 16, 221, 255, 94, 54, 96, 240,
+  216, 212, 255, 62, 253, 244, 81, 96, 0, 107, 193, 160, 125, 205, 1, 87, 78,
+  128, 218, 11, 246, 207, 60, 143, 23, 0, 212, 6, 240, 30, 110, 30, 253, 53,
+  122, 150, 107, 244, 61, 126, 31, 192, 31, 172, 149, 143, 114, 252, 58, 98,
+  26, 221, 254, 200, 50, 84, 113, 205, 224, 197, 159, 201, 9, 191, 172, 34,
+  44, 12, 152, 123, 159, 120, 49, 244, 67, 240, 51, 21, 49, 64, 42, 159, 227,
+  182, 31, 209, 143, 3, 201, 31, 246, 13, 89, 174, 134, 228, 250, 103, 194,
+  241, 64, 57, 114, 118, 96, 216, 31, 182, 253, 127, 114, 236, 239, 127, 223,
+  59, 218, 127, 224, 26, 192, 143, 188, 101, 164, 17, 140, 122, 255, 93, 203,
+  1, 85, 28, 224, 219, 63, 251, 44, 150, 0, 180, 107, 3, 13, 29, 163, 246,
+  238, 232, 228, 70, 46, 4, 30, 227, 19, 232, 197, 88, 159, 120, 6, 231, 56,
+  231, 34, 207, 126, 222, 141, 190, 175, 248, 161, 180, 207, 203, 135, 175,
+  0, 215, 139, 42, 200, 174, 164, 200, 127, 5, 29, 75, 145, 97, 176, 207, 214,
+  36, 199, 232, 153, 164, 28, 175, 246, 214, 208, 31, 95, 211, 251, 233, 15,
+  177, 114, 44, 178, 13, 58, 116, 221, 127, 18, 255, 5, 213, 200, 163, 54,
+  252, 179, 12, 240, 207, 60, 254, 42, 102, 56, 250, 208, 58, 129, 106, 29,
+  216, 219, 63, 67, 227, 191, 128, 190, 117, 237, 136, 58, 188, 215, 104, 11,
+  176, 235, 0, 92, 8, 8, 115, 225, 202, 71, 199, 190, 70, 47, 126, 240, 13,
+  94, 103, 100, 142, 59, 139, 248, 195, 251, 135, 63, 46, 33, 14, 156, 130,
+  13, 252, 37, 42, 249, 206, 177, 144, 152, 52, 81, 204, 168, 197, 246, 19,
+  143, 24, 231, 71, 84, 15, 133, 29, 101, 243, 209, 251, 86, 243, 255, 188,
+  31, 106, 191, 102, 124, 124, 236, 71, 127, 61, 133, 228, 200, 117, 255, 189,
+  253, 139, 171, 255, 58, 211, 128, 179, 7, 129, 0, 242, 153, 149, 140, 214,
+  5, 192, 195, 7, 10, 127, 213, 1, 212, 29, 128, 63, 41, 220, 255, 122, 8,
+  44, 120, 119, 17, 135, 119, 49, 22, 196, 63, 129, 200, 192, 110, 3, 130,
+  60, 173, 235, 130, 173, 180, 102, 183, 190, 117, 16, 205, 120, 123, 31, 131,
+  15, 155, 252, 146, 67, 124, 65, 213, 4, 193, 176, 217, 146, 58, 198, 33,
+  41, 41, 166, 33, 24, 117, 142, 200, 70, 132, 241, 189, 83, 61, 212, 189,
+  44, 125, 233, 249, 31, 33, 26, 193, 212, 73, 7, 206, 78, 2, 254, 199, 78,
+  254, 239, 20, 220, 255, 237, 245, 161, 5, 64, 204, 4, 128, 179, 140, 51,
+  15, 192, 195, 247, 44, 7, 92, 119, 0, 126, 10, 246, 255, 252, 249, 135, 94,
+  78, 240, 9, 88, 147, 43, 128, 93, 4, 13, 194, 52, 188, 9, 20, 118, 161, 182,
+  135, 207, 61, 1, 223, 195, 47, 48, 187, 136, 61, 60, 119, 140, 147, 156,
+  98, 177, 124, 124, 65, 220, 66, 49, 221, 3, 88, 198, 197, 79, 191, 169, 52,
+  44, 2, 227, 211, 225, 133, 12, 227, 133, 218, 143, 221, 92, 12, 255, 192,
+  252, 230, 12, 226, 51, 47, 254, 109, 203, 127, 97, 114, 212, 253, 254, 79,
+  30, 124, 20, 8, 64, 143, 31, 123, 203, 200, 195, 167, 239, 94, 121, 239,
+  234, 53, 93, 1, 106, 19, 192, 31, 231, 231, 127, 187, 33, 182, 77, 198, 188,
+  51, 242, 10, 52, 188, 66, 71, 95, 133, 90, 194, 61, 18, 233, 135, 43, 6,
+  130, 111, 225, 207, 217, 28, 55, 186, 248, 189, 190, 124, 25, 139, 251, 42,
+  81, 68, 186, 61, 254, 0, 23, 230, 27, 195, 222, 254, 149, 60, 80, 170, 62,
+  241, 100, 44, 140, 123, 134, 190, 47, 165, 147, 2, 54, 81, 47, 212, 126,
+  123, 3, 218, 251, 31, 33, 241, 152, 217, 244, 124, 31, 150, 127, 142, 145,
+  107, 140, 165, 14, 60, 114, 253, 63, 91, 0, 116, 35, 163, 135, 7, 87, 116,
+  252, 119, 77, 227, 127, 235, 159, 245, 249, 191, 69, 159, 24, 124, 187, 39,
+  128, 250, 186, 203, 225, 32, 222, 13, 254, 231, 250, 66, 200, 243, 99, 31,
+  240, 207, 51, 230, 22, 45, 215, 249, 121, 163, 143, 161, 207, 132, 133, 234,
+  124, 142, 88, 254, 64, 222, 5, 141, 151, 208, 145, 226, 156, 89, 7, 228,
+  36, 245, 195, 206, 1, 51, 90, 90, 130, 198, 17, 166, 241, 127, 142, 92, 67,
+  71, 192, 51, 122, 12, 203, 200, 189, 32, 254, 6, 76, 35, 97, 254, 63, 124,
+  162, 235, 255, 170, 254, 167, 2, 192, 207, 128, 100, 204, 117, 37, 2, 117,
+  237, 218, 53, 197, 1, 190, 253, 163, 1, 126, 37, 254, 239, 84, 219, 145,
+  181, 51, 118, 114, 238, 186, 5, 196, 27, 33, 150, 219, 203, 41, 62, 129,
+  62, 120, 133, 139, 65, 31, 39, 119, 229, 49, 183, 72, 212, 235, 195, 150,
+  113, 11, 252, 244, 75, 158, 97, 203, 108, 37, 200, 71, 67, 102, 185, 90,
+  43, 244, 248, 3, 192, 224, 28, 185, 32, 29, 223, 126, 124, 19, 252, 245,
+  130, 109, 28, 159, 252, 152, 248, 50, 114, 223, 15, 255, 28, 81, 215, 32,
+  231, 26, 112, 240, 192, 229, 127, 250, 252, 63, 214, 13, 32, 189, 107, 238,
+  188, 163, 102, 192, 181, 21, 236, 173, 91, 191, 39, 240, 127, 183, 200, 223,
+  221, 252, 68, 188, 221, 131, 157, 59, 216, 3, 107, 134, 34, 1, 87, 172, 235,
+  212, 18, 244, 4, 248, 112, 249, 179, 230, 126, 4, 253, 29, 5, 31, 63, 129,
+  14, 47, 255, 58, 67, 35, 62, 145, 200, 143, 189, 253, 2, 252, 197, 28, 12,
+  123, 75, 150, 177, 179, 168, 134, 196, 2, 36, 127, 125, 201, 55, 6, 117,
+  145, 7, 86, 251, 23, 167, 127, 103, 32, 127, 24, 30, 127, 20, 8, 128, 166,
+  3, 236, 70, 6, 62, 209, 58, 240, 215, 141, 17, 196, 63, 224, 218, 255, 208,
+  220, 23, 220, 0, 13, 14, 2, 216, 51, 128, 234, 2, 107, 82, 32, 90, 179, 104,
+  64, 206, 239, 49, 246, 205, 154, 124, 19, 239, 125, 185, 195, 123, 145, 184,
+  143, 202, 8, 87, 30, 125, 82, 243, 67, 68, 127, 9, 126, 228, 25, 168, 214,
+  4, 250, 133, 203, 250, 145, 172, 242, 111, 62, 195, 28, 213, 126, 161, 109,
+  160, 191, 81, 212, 126, 178, 31, 109, 232, 195, 63, 160, 254, 134, 7, 199,
+  207, 213, 251, 239, 20, 160, 236, 8, 160, 249, 93, 79, 223, 213, 51, 64,
+  38, 1, 248, 251, 244, 233, 39, 190, 126, 216, 219, 155, 216, 120, 55, 13,
+  203, 7, 214, 141, 240, 30, 172, 197, 104, 32, 126, 231, 243, 131, 111, 127,
+  130, 253, 189, 12, 185, 198, 74, 71, 31, 25, 70, 250, 54, 63, 58, 251, 216,
+  48, 176, 202, 72, 218, 199, 2, 127, 198, 53, 202, 35, 240, 231, 99, 224,
+  24, 139, 108, 163, 230, 88, 59, 62, 60, 254, 46, 183, 152, 249, 177, 175,
+  1, 214, 142, 69, 36, 98, 71, 32, 31, 237, 131, 225, 63, 164, 27, 235, 30,
+  144, 225, 192, 224, 111, 76, 160, 221, 8, 168, 249, 93, 87, 222, 123, 87,
+  227, 175, 56, 192, 127, 207, 115, 107, 241, 142, 124, 29, 169, 147, 39, 52,
+  115, 39, 129, 0, 221, 2, 107, 124, 176, 107, 30, 15, 172, 41, 250, 40, 210,
+  71, 208, 171, 180, 3, 159, 252, 140, 184, 135, 82, 139, 112, 236, 28, 37,
+  198, 125, 68, 73, 182, 100, 21, 223, 5, 215, 18, 203, 196, 183, 223, 11,
+  200, 218, 46, 211, 114, 76, 219, 62, 93, 206, 17, 97, 144, 172, 93, 83, 52,
+  246, 5, 245, 131, 36, 211, 224, 73, 8, 255, 143, 144, 107, 200, 121, 120,
+  64, 62, 213, 245, 255, 79, 66, 254, 255, 196, 228, 127, 135, 135, 55, 223,
+  123, 79, 23, 128, 174, 127, 120, 243, 86, 237, 221, 93, 131, 183, 51, 189,
+  1, 26, 116, 11, 132, 77, 32, 4, 132, 168, 70, 20, 141, 13, 215, 242, 157,
+  79, 206, 189, 254, 94, 243, 123, 31, 250, 195, 163, 254, 62, 51, 15, 138,
+  245, 122, 144, 134, 248, 114, 1, 71, 60, 100, 175, 232, 21, 35, 25, 11, 90,
+  34, 202, 50, 106, 60, 22, 92, 195, 160, 144, 192, 2, 209, 126, 194, 103,
+  152, 26, 205, 183, 96, 26, 73, 170, 63, 154, 250, 235, 7, 200, 38, 134, 252,
+  195, 216, 95, 142, 254, 169, 154, 199, 159, 217, 1, 96, 51, 0, 166, 45, 163,
+  84, 1, 168, 253, 77, 119, 222, 211, 20, 160, 155, 42, 0, 24, 1, 99, 167,
+  117, 252, 2, 240, 248, 163, 13, 176, 102, 79, 65, 60, 42, 144, 242, 123,
+  233, 197, 135, 224, 183, 145, 68, 14, 130, 62, 124, 244, 121, 157, 159, 26,
+  6, 118, 197, 125, 193, 50, 14, 220, 253, 66, 228, 183, 36, 29, 191, 60, 203,
+  50, 26, 128, 250, 175, 96, 50, 38, 58, 175, 241, 202, 223, 130, 56, 134,
+  79, 192, 249, 39, 210, 193, 248, 252, 235, 15, 55, 117, 228, 47, 132, 127,
+  152, 28, 87, 31, 225, 41, 24, 0, 252, 236, 241, 83, 59, 2, 174, 44, 195,
+  63, 121, 247, 138, 29, 2, 255, 224, 195, 61, 100, 240, 142, 34, 192, 141,
+  96, 223, 221, 176, 75, 64, 122, 13, 214, 145, 29, 176, 110, 228, 236, 30,
+  96, 239, 127, 213, 63, 170, 156, 16, 59, 216, 201, 47, 68, 215, 184, 152,
+  105, 156, 96, 26, 182, 88, 96, 248, 145, 124, 60, 31, 243, 194, 131, 101,
+  88, 62, 58, 143, 197, 254, 243, 217, 76, 30, 38, 210, 143, 191, 166, 179,
+  142, 207, 25, 243, 3, 217, 70, 141, 145, 118, 216, 236, 32, 84, 127, 143,
+  129, 105, 52, 192, 127, 120, 240, 145, 183, 0, 121, 228, 45, 163, 213, 187,
+  113, 244, 248, 61, 93, 1, 208, 248, 223, 115, 238, 174, 52, 0, 216, 112,
+  71, 119, 148, 12, 194, 227, 74, 94, 3, 82, 43, 22, 227, 60, 242, 219, 192,
+  6, 0, 191, 84, 121, 164, 206, 151, 23, 5, 43, 244, 70, 28, 3, 75, 34, 49,
+  6, 4, 134, 140, 105, 16, 64, 63, 40, 72, 75, 182, 65, 89, 38, 168, 135, 195,
+  175, 98, 49, 113, 240, 139, 166, 129, 49, 5, 49, 253, 241, 135, 61, 115,
+  252, 123, 80, 243, 119, 200, 134, 8, 156, 111, 68, 168, 254, 0, 246, 231,
+  25, 28, 29, 26, 158, 250, 252, 207, 49, 128, 247, 156, 102, 164, 26, 1, 188,
+  106, 58, 128, 239, 97, 115, 95, 228, 232, 203, 54, 0, 197, 71, 186, 7, 32,
+  180, 252, 165, 151, 51, 60, 124, 231, 187, 187, 102, 93, 162, 250, 122, 78,
+  188, 131, 119, 24, 5, 19, 69, 105, 18, 246, 187, 57, 164, 114, 129, 44, 3,
+  1, 205, 119, 73, 84, 68, 221, 241, 167, 222, 1, 160, 213, 52, 245, 133, 31,
+  22, 251, 207, 132, 202, 31, 232, 43, 100, 171, 161, 134, 159, 215, 254, 169,
+  124, 144, 157, 31, 61, 116, 210, 127, 176, 252, 23, 232, 95, 106, 11, 245,
+  62, 182, 10, 208, 198, 3, 230, 113, 40, 0, 30, 93, 187, 114, 69, 81, 128,
+  84, 7, 240, 117, 234, 237, 13, 92, 189, 177, 161, 187, 135, 133, 228, 131,
+  226, 30, 64, 27, 96, 29, 125, 236, 49, 244, 13, 140, 53, 91, 248, 51, 132,
+  61, 155, 224, 151, 223, 125, 122, 244, 169, 162, 48, 246, 140, 91, 18, 163,
+  112, 28, 249, 45, 233, 128, 153, 160, 34, 8, 190, 12, 234, 23, 174, 47, 235,
+  41, 29, 40, 17, 21, 196, 178, 190, 185, 253, 123, 161, 246, 135, 124, 99,
+  80, 245, 183, 253, 112, 71, 193, 250, 211, 149, 127, 78, 207, 33, 254, 237,
+  71, 248, 56, 196, 127, 126, 2, 208, 224, 127, 171, 125, 255, 175, 105, 10,
+  216, 7, 47, 109, 88, 2, 32, 230, 0, 252, 21, 96, 117, 129, 53, 129, 85, 46,
+  230, 146, 4, 79, 68, 94, 255, 92, 240, 71, 159, 92, 252, 37, 157, 230, 44,
+  34, 158, 113, 37, 211, 149, 116, 142, 145, 220, 45, 86, 16, 16, 71, 84, 95,
+  81, 69, 80, 127, 9, 43, 36, 243, 54, 133, 66, 34, 225, 246, 39, 158, 177,
+  78, 67, 36, 243, 67, 127, 136, 248, 55, 102, 234, 81, 150, 67, 126, 12, 172,
+  95, 21, 254, 39, 193, 52, 184, 231, 216, 35, 15, 77, 252, 167, 76, 224, 13,
+  3, 88, 75, 192, 40, 252, 31, 232, 248, 95, 5, 0, 31, 254, 141, 45, 185, 0,
+  136, 167, 251, 90, 206, 4, 208, 14, 16, 99, 130, 117, 36, 185, 195, 177,
+  30, 190, 241, 27, 240, 57, 10, 214, 215, 151, 171, 188, 156, 217, 73, 98,
+  126, 171, 47, 89, 147, 192, 79, 255, 96, 118, 161, 196, 42, 28, 68, 254,
+  121, 150, 197, 28, 35, 237, 87, 49, 155, 176, 174, 95, 204, 57, 100, 73,
+  197, 195, 87, 184, 244, 235, 196, 99, 221, 237, 63, 158, 226, 25, 162, 249,
+  73, 32, 255, 29, 159, 98, 211, 232, 158, 147, 141, 127, 172, 251, 191, 159,
+  186, 247, 223, 19, 0, 14, 15, 31, 189, 171, 59, 64, 42, 0, 252, 181, 109,
+  199, 3, 16, 98, 64, 41, 23, 64, 167, 22, 71, 4, 24, 255, 117, 55, 246, 12,
+  124, 245, 47, 228, 205, 231, 23, 63, 34, 245, 98, 37, 7, 194, 240, 40, 99,
+  230, 49, 117, 198, 122, 189, 82, 197, 127, 197, 21, 69, 240, 126, 180, 141,
+  70, 112, 79, 123, 190, 183, 75, 253, 102, 11, 154, 251, 97, 66, 233, 194,
+  231, 254, 38, 250, 27, 132, 232, 127, 130, 60, 227, 45, 254, 167, 7, 48,
+  253, 35, 166, 209, 198, 52, 118, 176, 167, 13, 0, 48, 254, 38, 111, 220,
+  215, 12, 16, 173, 2, 246, 151, 233, 253, 31, 172, 59, 81, 16, 40, 230, 2,
+  8, 58, 80, 28, 88, 35, 194, 192, 154, 134, 248, 228, 234, 160, 216, 91, 248,
+  89, 123, 71, 140, 249, 226, 213, 158, 136, 121, 80, 80, 22, 116, 142, 145,
+  200, 42, 90, 40, 249, 174, 40, 229, 72, 223, 73, 76, 67, 114, 229, 99, 191,
+  201, 20, 105, 200, 205, 216, 40, 57, 185, 253, 219, 31, 11, 40, 249, 132,
+  93, 67, 161, 118, 164, 175, 38, 156, 83, 252, 207, 32, 254, 230, 253, 63,
+  212, 243, 223, 150, 0, 170, 39, 128, 181, 103, 120, 123, 109, 28, 190, 111,
+  125, 128, 110, 126, 240, 203, 62, 255, 219, 110, 136, 161, 251, 90, 142,
+  2, 59, 183, 1, 122, 17, 154, 104, 152, 71, 223, 122, 178, 234, 174, 84, 191,
+  192, 230, 177, 204, 49, 52, 226, 29, 69, 45, 35, 149, 95, 48, 27, 240, 224,
+  66, 162, 162, 101, 160, 167, 251, 192, 123, 104, 62, 1, 148, 31, 226, 25,
+  41, 228, 126, 88, 60, 122, 134, 115, 255, 193, 144, 24, 199, 76, 39, 88,
+  148, 246, 92, 72, 255, 130, 109, 148, 249, 40, 39, 118, 254, 11, 76, 128,
+  107, 9, 128, 22, 255, 15, 237, 12, 224, 205, 155, 191, 8, 188, 188, 200,
+  249, 135, 79, 128, 124, 9, 224, 23, 155, 60, 9, 244, 186, 199, 169, 35, 255,
+  173, 225, 19, 84, 69, 87, 107, 151, 163, 207, 29, 67, 41, 250, 53, 123, 249,
+  219, 31, 185, 212, 234, 23, 135, 60, 240, 140, 167, 96, 22, 175, 190, 133,
+  195, 63, 193, 133, 159, 25, 37, 23, 216, 79, 231, 79, 127, 251, 89, 166,
+  30, 184, 48, 245, 19, 152, 159, 222, 138, 208, 171, 7, 245, 2, 254, 39, 199,
+  126, 248, 203, 227, 175, 67, 136, 115, 199, 255, 86, 19, 224, 166, 0, 184,
+  103, 53, 163, 238, 105, 25, 112, 213, 1, 252, 115, 91, 127, 255, 111, 55,
+  204, 198, 27, 225, 47, 134, 2, 228, 217, 94, 67, 252, 241, 107, 79, 174,
+  124, 241, 224, 235, 15, 94, 22, 242, 8, 87, 48, 16, 71, 110, 162, 129, 212,
+  29, 187, 250, 169, 129, 140, 249, 169, 68, 227, 61, 17, 227, 32, 74, 56,
+  197, 137, 40, 132, 127, 53, 33, 161, 255, 20, 193, 47, 42, 72, 134, 79, 51,
+  238, 97, 252, 71, 64, 63, 14, 36, 127, 190, 149, 208, 211, 199, 24, 164,
+  127, 167, 112, 118, 216, 152, 134, 14, 108, 252, 247, 153, 83, 0, 210, 4,
+  48, 85, 0, 62, 122, 248, 222, 149, 43, 109, 2, 208, 158, 255, 159, 101, 231,
+  223, 23, 129, 237, 3, 96, 161, 135, 175, 64, 228, 49, 232, 40, 16, 240, 99,
+  223, 16, 212, 3, 252, 20, 251, 220, 181, 119, 176, 111, 184, 124, 244, 97,
+  165, 191, 172, 5, 175, 104, 63, 128, 188, 140, 59, 133, 227, 170, 79, 222,
+  97, 22, 30, 162, 144, 121, 144, 249, 49, 61, 255, 169, 23, 17, 67, 211, 222,
+  132, 88, 98, 63, 205, 200, 149, 254, 189, 226, 239, 16, 204, 17, 193, 231,
+  223, 60, 40, 253, 67, 144, 254, 159, 158, 176, 240, 79, 103, 16, 159, 216,
+  248, 255, 179, 207, 0, 1, 84, 5, 0, 71, 79, 45, 5, 240, 230, 205, 63, 181,
+  145, 30, 0, 139, 63, 184, 1, 54, 93, 119, 128, 253, 95, 26, 177, 95, 28,
+  139, 243, 26, 248, 81, 194, 199, 149, 139, 124, 225, 220, 75, 175, 62, 178,
+  149, 34, 54, 225, 49, 19, 137, 156, 74, 186, 161, 151, 223, 219, 5, 95, 212,
+  53, 172, 192, 132, 47, 196, 248, 35, 82, 111, 164, 188, 172, 241, 31, 246,
+  1, 237, 123, 128, 76, 131, 129, 120, 100, 192, 127, 96, 175, 255, 163, 19,
+  175, 253, 117, 118, 134, 58, 72, 45, 254, 143, 44, 255, 75, 93, 255, 16,
+  255, 246, 119, 94, 209, 9, 192, 141, 27, 31, 252, 228, 22, 52, 0, 55, 44,
+  4, 164, 123, 128, 4, 131, 112, 31, 108, 26, 177, 91, 216, 25, 232, 133, 15,
+  98, 127, 106, 186, 35, 190, 130, 122, 133, 83, 248, 201, 203, 95, 163, 90,
+  63, 146, 159, 0, 79, 255, 138, 193, 31, 243, 12, 132, 84, 79, 252, 20, 173,
+  36, 190, 39, 16, 16, 101, 156, 191, 37, 114, 13, 236, 251, 228, 111, 48,
+  192, 206, 1, 86, 61, 210, 247, 126, 77, 56, 57, 80, 32, 30, 30, 123, 252,
+  207, 252, 244, 159, 249, 64, 42, 137, 24, 61, 9, 2, 160, 222, 4, 214, 20,
+  0, 143, 110, 94, 185, 170, 85, 32, 111, 254, 190, 45, 246, 115, 230, 33,
+  128, 203, 3, 104, 36, 192, 54, 193, 134, 161, 207, 34, 189, 14, 240, 245,
+  143, 90, 58, 249, 100, 126, 183, 64, 166, 194, 21, 226, 118, 69, 40, 30,
+  130, 208, 216, 10, 167, 125, 204, 59, 6, 201, 122, 238, 118, 142, 41, 103,
+  19, 32, 241, 73, 84, 228, 72, 131, 81, 80, 16, 92, 1, 248, 233, 212, 223,
+  24, 205, 16, 219, 143, 57, 244, 217, 223, 49, 54, 141, 247, 166, 193, 237,
+  135, 57, 248, 216, 242, 191, 213, 252, 167, 139, 255, 13, 111, 228, 142,
+  22, 129, 187, 126, 227, 131, 223, 235, 28, 125, 217, 3, 64, 55, 64, 192,
+  159, 38, 4, 66, 114, 64, 98, 60, 241, 177, 15, 224, 187, 143, 91, 177, 177,
+  109, 94, 224, 47, 136, 163, 48, 203, 248, 202, 88, 212, 7, 165, 228, 243,
+  197, 82, 108, 246, 117, 250, 197, 118, 56, 199, 20, 164, 236, 139, 84, 228,
+  162, 134, 241, 254, 249, 95, 58, 210, 47, 32, 254, 140, 71, 76, 59, 24, 226,
+  127, 116, 132, 170, 255, 208, 53, 210, 221, 34, 71, 150, 255, 111, 230, 63,
+  92, 254, 175, 241, 127, 112, 213, 22, 128, 126, 152, 223, 255, 44, 4, 136,
+  60, 3, 120, 27, 192, 235, 64, 130, 125, 45, 94, 23, 97, 71, 109, 84, 187,
+  183, 160, 77, 125, 58, 187, 95, 32, 3, 105, 90, 231, 23, 122, 252, 94, 115,
+  12, 105, 201, 151, 75, 24, 248, 65, 53, 239, 21, 149, 21, 34, 253, 190, 136,
+  126, 248, 50, 156, 126, 48, 232, 207, 76, 35, 121, 223, 71, 127, 174, 124,
+  214, 15, 164, 239, 1, 18, 143, 70, 198, 49, 46, 166, 108, 241, 247, 189,
+  255, 19, 76, 254, 119, 202, 113, 106, 19, 157, 90, 253, 15, 99, 1, 232, 60,
+  0, 116, 230, 248, 72, 199, 127, 215, 111, 220, 252, 123, 183, 40, 254, 219,
+  106, 232, 193, 249, 231, 248, 71, 158, 130, 77, 236, 14, 144, 159, 9, 112,
+  244, 221, 247, 192, 223, 135, 92, 62, 251, 147, 64, 236, 224, 9, 95, 25,
+  79, 249, 42, 36, 52, 70, 209, 199, 113, 127, 212, 47, 22, 19, 206, 160, 156,
+  208, 108, 74, 25, 63, 254, 237, 23, 154, 254, 76, 68, 104, 134, 115, 127,
+  115, 252, 71, 176, 245, 67, 4, 100, 70, 135, 232, 248, 19, 229, 72, 189,
+  145, 70, 195, 222, 39, 31, 235, 227, 239, 44, 32, 44, 1, 68, 225, 191, 255,
+  158, 197, 191, 217, 240, 0, 128, 190, 0, 104, 7, 128, 61, 32, 93, 6, 136,
+  53, 76, 242, 132, 13, 127, 240, 195, 71, 108, 10, 124, 239, 151, 82, 161,
+  167, 140, 182, 247, 75, 228, 20, 78, 107, 189, 21, 150, 157, 201, 185, 95,
+  44, 112, 15, 89, 93, 196, 52, 14, 231, 33, 133, 71, 31, 55, 253, 152, 148,
+  8, 116, 140, 7, 195, 100, 19, 79, 251, 3, 214, 17, 144, 248, 53, 33, 226,
+  177, 163, 67, 235, 251, 126, 124, 26, 92, 67, 237, 241, 239, 249, 36, 194,
+  212, 255, 30, 153, 254, 255, 147, 61, 213, 0, 52, 249, 255, 225, 241, 85,
+  59, 2, 48, 117, 239, 255, 118, 195, 46, 0, 142, 63, 143, 7, 229, 157, 208,
+  136, 47, 61, 134, 125, 141, 2, 139, 186, 240, 15, 190, 20, 241, 21, 80, 174,
+  179, 164, 198, 177, 222, 67, 174, 142, 25, 6, 35, 145, 185, 114, 233, 167,
+  250, 5, 223, 48, 49, 235, 167, 105, 63, 185, 147, 150, 158, 240, 1, 28, 163,
+  231, 72, 232, 137, 101, 254, 38, 203, 52, 107, 140, 120, 31, 80, 63, 112,
+  204, 21, 68, 84, 51, 105, 12, 70, 63, 130, 113, 0, 118, 13, 29, 181, 9, 160,
+  113, 128, 124, 252, 153, 39, 0, 153, 2, 240, 209, 209, 135, 186, 3, 124,
+  227, 230, 201, 70, 8, 0, 45, 252, 226, 21, 64, 226, 65, 254, 125, 231, 125,
+  143, 95, 146, 141, 141, 252, 194, 173, 143, 122, 250, 56, 218, 39, 165, 158,
+  88, 200, 143, 60, 99, 177, 153, 64, 227, 29, 67, 73, 181, 95, 44, 249, 17,
+  89, 25, 208, 240, 195, 1, 201, 140, 216, 197, 211, 178, 255, 146, 206, 251,
+  44, 241, 60, 193, 176, 79, 72, 255, 64, 65, 138, 245, 126, 212, 135, 29,
+  227, 230, 207, 41, 172, 254, 7, 219, 176, 199, 159, 58, 7, 208, 207, 66,
+  252, 191, 175, 83, 135, 251, 239, 25, 252, 31, 110, 195, 3, 64, 95, 0, 24,
+  4, 208, 59, 128, 2, 200, 54, 192, 70, 188, 242, 253, 207, 254, 183, 234,
+  111, 0, 249, 142, 230, 14, 139, 249, 34, 158, 193, 181, 116, 245, 7, 11,
+  153, 44, 234, 23, 27, 137, 251, 233, 168, 9, 29, 48, 170, 114, 52, 233, 23,
+  188, 67, 22, 115, 120, 249, 47, 72, 153, 9, 176, 138, 6, 118, 234, 195, 73,
+  62, 88, 248, 185, 122, 168, 203, 41, 38, 71, 135, 222, 248, 3, 185, 70, 246,
+  160, 112, 236, 158, 74, 255, 31, 218, 249, 63, 37, 1, 185, 111, 240, 111,
+  99, 199, 79, 141, 6, 200, 141, 91, 91, 88, 0, 220, 50, 252, 233, 6, 16, 174,
+  1, 22, 22, 72, 247, 61, 61, 244, 104, 43, 49, 50, 15, 58, 93, 194, 209, 7,
+  117, 222, 136, 109, 172, 224, 25, 107, 225, 207, 87, 17, 163, 120, 170, 236,
+  16, 19, 145, 102, 240, 43, 195, 104, 56, 233, 197, 61, 99, 177, 136, 28,
+  49, 14, 202, 242, 213, 128, 176, 254, 145, 115, 204, 148, 152, 134, 171,
+  15, 59, 69, 213, 63, 172, 28, 235, 9, 164, 163, 3, 117, 252, 109, 255, 207,
+  152, 70, 31, 184, 185, 177, 167, 26, 255, 235, 55, 223, 221, 108, 227, 248,
+  187, 13, 64, 94, 129, 29, 119, 1, 207, 237, 248, 141, 15, 191, 53, 232, 220,
+  219, 91, 159, 31, 124, 161, 214, 67, 121, 157, 220, 74, 136, 195, 95, 34,
+  207, 192, 37, 148, 146, 70, 135, 63, 139, 137, 72, 211, 203, 223, 88, 6,
+  98, 145, 159, 40, 252, 178, 117, 200, 210, 37, 127, 80, 239, 219, 84, 254,
+  3, 243, 7, 21, 148, 167, 54, 255, 131, 220, 191, 115, 236, 26, 218, 126,
+  160, 147, 79, 64, 252, 111, 251, 127, 251, 135, 198, 53, 228, 234, 21, 173,
+  1, 240, 250, 54, 242, 0, 224, 43, 0, 237, 0, 15, 157, 124, 25, 240, 51, 47,
+  131, 111, 127, 169, 232, 177, 143, 94, 251, 66, 119, 191, 236, 182, 138,
+  15, 134, 193, 94, 116, 12, 188, 251, 64, 201, 217, 235, 200, 51, 125, 17,
+  54, 108, 194, 53, 164, 51, 203, 247, 153, 226, 196, 191, 203, 51, 22, 79,
+  19, 206, 67, 240, 63, 36, 172, 239, 49, 55, 13, 86, 31, 121, 118, 116, 20,
+  200, 127, 103, 216, 55, 44, 216, 134, 157, 57, 253, 63, 143, 191, 81, 141,
+  84, 15, 192, 13, 83, 0, 250, 74, 28, 127, 176, 3, 240, 43, 208, 117, 19,
+  8, 208, 51, 240, 225, 47, 155, 16, 234, 179, 88, 159, 22, 249, 58, 106, 61,
+  32, 234, 99, 97, 31, 50, 16, 203, 151, 145, 176, 143, 223, 253, 96, 190,
+  79, 242, 140, 12, 124, 179, 57, 140, 252, 161, 136, 40, 205, 252, 5, 215,
+  64, 253, 9, 103, 254, 242, 135, 248, 79, 208, 241, 199, 174, 161, 243, 35,
+  63, 250, 231, 103, 255, 172, 111, 216, 32, 152, 198, 247, 205, 249, 255,
+  12, 224, 239, 101, 99, 110, 105, 23, 128, 27, 255, 215, 22, 220, 255, 62,
+  7, 116, 73, 32, 121, 7, 196, 93, 32, 188, 5, 24, 125, 241, 220, 187, 239,
+  59, 227, 61, 210, 221, 227, 126, 241, 117, 37, 89, 70, 11, 55, 191, 250,
+  169, 164, 240, 83, 7, 145, 29, 105, 159, 228, 29, 83, 76, 33, 223, 107, 62,
+  139, 232, 200, 97, 9, 81, 212, 94, 156, 56, 218, 215, 112, 68, 135, 190,
+  76, 242, 63, 115, 111, 139, 127, 87, 76, 250, 31, 154, 191, 103, 212, 55,
+  68, 23, 17, 131, 254, 167, 199, 223, 205, 13, 63, 184, 122, 77, 5, 128, 255,
+  123, 48, 112, 143, 222, 0, 240, 17, 136, 110, 131, 53, 152, 29, 143, 191,
+  245, 232, 183, 219, 167, 159, 22, 247, 73, 192, 7, 162, 125, 32, 219, 23,
+  24, 189, 220, 77, 76, 240, 13, 117, 10, 100, 172, 207, 143, 4, 189, 208,
+  225, 47, 32, 201, 63, 23, 102, 203, 221, 215, 184, 196, 45, 63, 218, 243,
+  181, 206, 65, 212, 58, 6, 18, 203, 134, 3, 146, 251, 147, 198, 47, 58, 255,
+  102, 103, 133, 234, 31, 195, 31, 244, 144, 31, 153, 247, 255, 177, 31, 0,
+  181, 253, 191, 246, 2, 120, 164, 11, 128, 215, 255, 218, 118, 35, 94, 0,
+  155, 216, 29, 0, 225, 147, 83, 3, 17, 123, 6, 190, 250, 0, 21, 192, 62, 22,
+  240, 81, 244, 69, 82, 103, 244, 236, 67, 251, 192, 246, 219, 106, 69, 85,
+  188, 87, 68, 82, 148, 123, 8, 136, 82, 162, 234, 107, 117, 33, 201, 12, 102,
+  103, 152, 240, 51, 95, 82, 165, 15, 193, 50, 58, 203, 7, 100, 226, 151, 153,
+  6, 79, 153, 107, 172, 155, 252, 9, 205, 127, 240, 252, 251, 30, 226, 99,
+  123, 255, 211, 243, 223, 190, 30, 123, 87, 149, 6, 204, 141, 191, 180, 221,
+  70, 50, 0, 233, 18, 144, 111, 2, 124, 15, 196, 207, 60, 218, 57, 237, 15,
+  120, 236, 11, 214, 213, 147, 202, 60, 49, 82, 103, 60, 227, 115, 119, 127,
+  99, 83, 63, 68, 241, 203, 248, 112, 79, 22, 247, 14, 42, 101, 215, 192, 140,
+  179, 253, 36, 203, 224, 165, 48, 82, 102, 173, 99, 50, 211, 176, 25, 12,
+  49, 239, 67, 240, 140, 247, 226, 177, 115, 122, 252, 49, 254, 238, 99, 237,
+  125, 26, 12, 192, 140, 7, 176, 105, 0, 169, 221, 115, 85, 219, 0, 254, 202,
+  6, 6, 128, 145, 29, 176, 22, 18, 2, 249, 65, 88, 75, 185, 1, 59, 247, 250,
+  167, 6, 131, 207, 211, 124, 114, 244, 99, 217, 62, 38, 247, 84, 220, 67,
+  204, 171, 15, 150, 26, 128, 8, 197, 47, 227, 214, 81, 104, 238, 64, 176,
+  141, 51, 95, 224, 130, 177, 253, 192, 227, 31, 171, 251, 162, 61, 183, 4,
+  35, 63, 195, 17, 84, 16, 100, 198, 97, 8, 127, 85, 252, 63, 57, 5, 182, 161,
+  78, 251, 201, 157, 255, 225, 161, 145, 127, 115, 248, 59, 215, 80, 29, 60,
+  126, 208, 226, 127, 237, 198, 127, 188, 229, 15, 192, 142, 29, 128, 211,
+  2, 198, 22, 144, 174, 124, 114, 244, 213, 79, 53, 6, 190, 232, 2, 95, 44,
+  245, 208, 113, 142, 40, 250, 94, 126, 110, 41, 155, 133, 75, 113, 159, 44,
+  47, 34, 25, 135, 21, 72, 223, 45, 132, 126, 115, 34, 40, 64, 83, 191, 85,
+  136, 54, 230, 88, 236, 25, 42, 8, 194, 206, 15, 154, 35, 195, 189, 223, 64,
+  254, 11, 218, 129, 106, 43, 29, 219, 241, 63, 213, 254, 121, 106, 8, 160,
+  198, 53, 174, 61, 255, 119, 148, 8, 248, 245, 127, 111, 27, 2, 64, 127, 250,
+  165, 71, 192, 135, 3, 235, 248, 155, 64, 82, 187, 53, 190, 238, 1, 254, 109,
+  218, 7, 239, 209, 142, 226, 190, 71, 158, 128, 47, 161, 79, 219, 124, 208,
+  68, 76, 215, 125, 87, 43, 218, 233, 141, 244, 250, 8, 209, 11, 76, 121, 48,
+  9, 249, 37, 173, 249, 47, 144, 158, 204, 178, 195, 50, 218, 125, 210, 41,
+  32, 125, 19, 227, 40, 87, 251, 153, 226, 158, 130, 198, 31, 81, 255, 184,
+  118, 168, 250, 80, 167, 126, 252, 211, 245, 127, 141, 108, 188, 202, 30,
+  62, 185, 162, 70, 64, 255, 237, 205, 197, 46, 0, 241, 34, 144, 42, 4, 177,
+  199, 30, 255, 196, 121, 60, 232, 220, 75, 111, 62, 164, 116, 74, 49, 159,
+  156, 239, 7, 237, 193, 92, 114, 11, 39, 141, 254, 140, 170, 76, 0, 246, 49,
+  110, 67, 123, 178, 241, 12, 118, 252, 176, 140, 168, 168, 31, 47, 56, 71,
+  141, 67, 223, 31, 143, 252, 34, 231, 32, 220, 82, 178, 209, 159, 211, 125,
+  213, 205, 159, 115, 212, 253, 81, 31, 172, 167, 198, 127, 62, 123, 20, 240,
+  87, 2, 0, 135, 198, 53, 252, 177, 102, 0, 255, 107, 91, 142, 191, 131, 127,
+  27, 185, 1, 208, 63, 162, 139, 96, 45, 164, 6, 228, 202, 48, 119, 191, 184,
+  42, 86, 221, 143, 208, 122, 216, 48, 79, 197, 189, 67, 177, 200, 184, 181,
+  139, 151, 171, 253, 228, 229, 167, 163, 230, 37, 173, 250, 192, 65, 147,
+  140, 194, 31, 181, 15, 160, 74, 82, 65, 73, 102, 232, 115, 63, 48, 242, 59,
+  158, 76, 166, 100, 232, 123, 6, 4, 202, 109, 237, 31, 54, 127, 104, 247,
+  111, 56, 26, 15, 156, 252, 167, 199, 127, 223, 9, 7, 29, 31, 40, 9, 136,
+  235, 63, 109, 235, 63, 142, 3, 16, 240, 239, 184, 4, 228, 205, 32, 156, 249,
+  181, 112, 101, 168, 187, 191, 148, 43, 251, 190, 198, 67, 203, 60, 152, 206,
+  141, 186, 60, 114, 153, 31, 29, 126, 253, 11, 72, 250, 228, 184, 63, 230,
+  23, 140, 180, 101, 152, 174, 200, 60, 144, 61, 9, 221, 11, 54, 253, 8, 189,
+  20, 214, 153, 243, 124, 5, 79, 191, 87, 123, 30, 67, 70, 97, 80, 17, 112,
+  145, 197, 17, 73, 254, 153, 124, 140, 105, 35, 60, 12, 247, 255, 19, 130,
+  255, 201, 53, 133, 255, 79, 121, 252, 61, 11, 4, 61, 1, 219, 47, 178, 9,
+  214, 60, 59, 224, 232, 175, 25, 240, 98, 192, 231, 57, 29, 85, 100, 146,
+  167, 234, 46, 244, 162, 195, 175, 124, 163, 16, 193, 47, 152, 8, 201, 129,
+  159, 216, 236, 47, 184, 152, 100, 65, 242, 126, 218, 243, 89, 160, 166, 159,
+  16, 251, 183, 107, 49, 12, 109, 127, 65, 241, 1, 180, 254, 64, 98, 233, 7,
+  191, 252, 228, 39, 56, 254, 214, 54, 178, 253, 88, 143, 49, 254, 206, 54,
+  72, 117, 143, 78, 62, 84, 5, 160, 63, 0, 238, 127, 242, 2, 92, 108, 11, 224,
+  71, 96, 205, 243, 3, 178, 79, 212, 221, 95, 21, 213, 174, 76, 207, 21, 249,
+  48, 246, 12, 124, 118, 246, 169, 187, 136, 197, 63, 183, 224, 3, 134, 215,
+  138, 219, 134, 22, 80, 214, 131, 147, 188, 11, 46, 41, 181, 132, 10, 15,
+  115, 121, 208, 111, 25, 211, 144, 181, 155, 110, 134, 88, 63, 200, 236, 1,
+  170, 199, 219, 235, 197, 126, 248, 19, 131, 255, 201, 25, 116, 13, 54, 210,
+  225, 125, 107, 27, 170, 62, 218, 211, 135, 225, 253, 55, 253, 255, 125, 55,
+  57, 124, 114, 79, 225, 255, 79, 34, 252, 105, 12, 176, 221, 177, 3, 182,
+  52, 20, 96, 201, 1, 65, 127, 131, 15, 252, 255, 115, 240, 197, 168, 15, 216,
+  143, 97, 127, 137, 194, 159, 61, 123, 239, 19, 27, 25, 193, 50, 182, 136,
+  194, 15, 218, 16, 37, 53, 140, 22, 249, 94, 75, 54, 88, 132, 4, 164, 39,
+  168, 242, 231, 105, 127, 100, 156, 32, 16, 74, 44, 254, 32, 252, 63, 63,
+  3, 174, 193, 182, 150, 100, 62, 218, 190, 58, 254, 48, 254, 219, 63, 48,
+  4, 32, 149, 0, 168, 248, 255, 31, 221, 110, 200, 5, 224, 208, 135, 59, 96,
+  75, 65, 143, 222, 2, 107, 57, 62, 180, 191, 177, 9, 133, 61, 31, 237, 201,
+  224, 211, 249, 77, 146, 239, 9, 190, 241, 130, 175, 144, 211, 28, 45, 121,
+  181, 151, 57, 70, 35, 211, 208, 48, 218, 77, 75, 126, 88, 92, 98, 197, 136,
+  254, 146, 196, 151, 144, 249, 131, 79, 92, 140, 64, 219, 207, 5, 127, 99,
+  81, 62, 218, 158, 255, 165, 193, 31, 80, 127, 207, 122, 94, 249, 213, 145,
+  191, 77, 46, 113, 228, 218, 127, 143, 13, 253, 219, 18, 64, 52, 119, 224,
+  177, 138, 255, 127, 104, 203, 54, 0, 78, 3, 241, 6, 216, 118, 237, 131, 53,
+  61, 236, 24, 124, 123, 247, 227, 83, 47, 100, 122, 252, 201, 23, 43, 125,
+  156, 217, 21, 179, 17, 172, 113, 204, 207, 170, 253, 89, 212, 58, 46, 234,
+  26, 137, 29, 131, 105, 213, 47, 224, 79, 232, 229, 40, 229, 116, 251, 110,
+  136, 181, 30, 199, 19, 48, 243, 53, 195, 206, 97, 246, 252, 183, 27, 224,
+  196, 22, 255, 8, 245, 223, 117, 127, 156, 124, 196, 169, 109, 255, 232, 231,
+  223, 241, 255, 14, 12, 121, 252, 80, 73, 0, 252, 192, 86, 126, 0, 112, 20,
+  64, 222, 129, 173, 188, 5, 196, 11, 31, 252, 135, 224, 204, 91, 216, 81,
+  172, 47, 148, 248, 240, 197, 79, 78, 126, 21, 143, 248, 107, 36, 58, 29,
+  192, 39, 157, 62, 32, 42, 141, 252, 131, 114, 70, 67, 149, 5, 5, 51, 22,
+  248, 207, 105, 209, 159, 205, 122, 173, 168, 136, 104, 230, 115, 191, 241,
+  200, 195, 79, 105, 159, 168, 246, 163, 62, 254, 137, 63, 254, 206, 247, 3,
+  114, 127, 7, 142, 68, 122, 246, 8, 180, 127, 159, 186, 249, 207, 3, 195,
+  29, 187, 126, 237, 218, 181, 45, 57, 255, 108, 3, 196, 158, 2, 49, 73, 92,
+  199, 195, 4, 125, 247, 135, 67, 47, 220, 249, 124, 130, 3, 4, 252, 145, 100,
+  31, 93, 253, 212, 85, 202, 123, 134, 178, 155, 95, 112, 13, 237, 110, 245,
+  23, 194, 152, 169, 74, 254, 4, 182, 79, 204, 50, 26, 132, 254, 224, 179,
+  23, 109, 248, 63, 244, 148, 127, 104, 30, 33, 209, 62, 221, 253, 111, 240,
+  63, 245, 225, 255, 25, 54, 14, 12, 248, 247, 109, 248, 247, 196, 26, 192,
+  132, 254, 127, 139, 255, 173, 54, 254, 91, 129, 243, 31, 2, 0, 140, 63, 125,
+  7, 182, 241, 13, 16, 135, 191, 170, 192, 153, 223, 157, 233, 97, 232, 187,
+  208, 151, 18, 62, 168, 53, 95, 120, 170, 189, 164, 231, 144, 229, 176, 209,
+  159, 83, 113, 185, 136, 148, 176, 249, 98, 179, 121, 36, 240, 23, 253, 35,
+  104, 217, 215, 81, 203, 103, 36, 247, 115, 133, 63, 16, 253, 17, 5, 65, 181,
+  1, 192, 235, 127, 118, 70, 93, 227, 195, 4, 225, 192, 179, 191, 76, 254,
+  23, 250, 191, 45, 254, 247, 219, 248, 111, 40, 94, 0, 91, 132, 61, 186, 6,
+  164, 159, 194, 212, 136, 16, 30, 24, 89, 145, 170, 100, 223, 162, 193, 62,
+  175, 243, 144, 116, 175, 66, 246, 242, 212, 72, 20, 59, 13, 148, 172, 218,
+  39, 112, 124, 104, 189, 191, 20, 221, 226, 41, 5, 97, 225, 147, 114, 247,
+  50, 207, 153, 152, 156, 104, 29, 133, 98, 206, 9, 110, 251, 91, 181, 55,
+  59, 244, 65, 121, 95, 190, 182, 96, 136, 223, 6, 126, 96, 28, 72, 158, 255,
+  209, 216, 133, 127, 79, 77, 254, 183, 103, 249, 223, 106, 118, 252, 228,
+  225, 251, 215, 174, 31, 105, 236, 253, 241, 167, 87, 128, 176, 3, 60, 236,
+  187, 74, 133, 91, 122, 247, 87, 240, 185, 167, 15, 126, 73, 170, 251, 228,
+  209, 143, 181, 120, 48, 250, 208, 52, 222, 172, 42, 195, 142, 157, 248, 240,
+  115, 69, 241, 104, 218, 135, 3, 63, 181, 10, 210, 241, 147, 236, 67, 128,
+  196, 35, 201, 252, 124, 208, 57, 150, 218, 254, 110, 228, 139, 154, 198,
+  251, 43, 6, 50, 63, 76, 239, 95, 48, 14, 108, 115, 201, 199, 230, 249, 87,
+  215, 191, 230, 255, 28, 248, 252, 255, 248, 228, 105, 139, 255, 163, 205,
+  118, 187, 149, 114, 64, 151, 8, 226, 123, 64, 218, 12, 219, 174, 131, 143,
+  239, 254, 138, 126, 167, 84, 174, 112, 240, 105, 188, 207, 219, 187, 248,
+  230, 23, 209, 55, 177, 95, 198, 57, 62, 52, 231, 163, 178, 3, 49, 81, 73,
+  232, 28, 182, 0, 215, 114, 151, 111, 32, 181, 141, 196, 5, 135, 108, 136,
+  38, 62, 124, 236, 15, 131, 255, 25, 238, 44, 248, 247, 223, 23, 127, 204,
+  241, 39, 228, 15, 29, 77, 62, 53, 234, 111, 166, 252, 231, 4, 64, 45, 254,
+  71, 45, 254, 119, 182, 219, 142, 23, 128, 199, 131, 242, 118, 16, 51, 67,
+  247, 127, 174, 249, 137, 47, 43, 177, 169, 199, 31, 125, 172, 216, 85, 119,
+  182, 247, 145, 211, 204, 218, 251, 197, 19, 195, 248, 92, 230, 119, 230,
+  76, 87, 182, 196, 36, 95, 198, 63, 43, 195, 219, 143, 189, 163, 22, 162,
+  160, 16, 109, 250, 185, 79, 191, 114, 165, 90, 144, 250, 67, 223, 200, 105,
+  152, 39, 128, 217, 5, 30, 252, 9, 214, 81, 84, 60, 248, 192, 190, 255, 138,
+  254, 71, 241, 63, 185, 113, 237, 250, 251, 18, 254, 177, 61, 64, 223, 5,
+  24, 31, 138, 71, 95, 39, 253, 66, 130, 87, 74, 229, 61, 33, 226, 35, 216,
+  87, 145, 246, 46, 203, 248, 28, 254, 57, 142, 250, 253, 187, 47, 101, 252,
+  185, 232, 24, 29, 120, 126, 148, 125, 184, 210, 186, 158, 212, 56, 16, 218,
+  135, 184, 170, 127, 152, 42, 207, 169, 101, 120, 94, 204, 81, 229, 39, 88,
+  199, 145, 105, 194, 57, 30, 36, 95, 208, 222, 207, 121, 80, 15, 70, 248,
+  31, 233, 233, 95, 79, 255, 209, 14, 64, 7, 78, 57, 238, 246, 181, 235, 223,
+  119, 248, 243, 16, 0, 189, 4, 210, 119, 4, 255, 86, 56, 250, 234, 23, 177,
+  137, 95, 202, 73, 126, 120, 243, 233, 252, 94, 21, 105, 240, 201, 86, 178,
+  14, 255, 34, 195, 28, 15, 100, 31, 88, 144, 145, 254, 14, 187, 248, 138,
+  57, 7, 182, 155, 122, 142, 44, 163, 165, 200, 95, 14, 253, 225, 84, 105,
+  251, 109, 74, 231, 253, 240, 200, 151, 233, 46, 0, 252, 151, 238, 254, 151,
+  122, 127, 193, 55, 220, 225, 127, 138, 232, 31, 4, 255, 7, 215, 174, 191,
+  182, 137, 93, 0, 93, 187, 0, 199, 7, 12, 250, 112, 55, 52, 177, 20, 143,
+  116, 116, 25, 143, 183, 146, 139, 188, 136, 205, 47, 122, 72, 3, 252, 203,
+  140, 69, 253, 12, 125, 73, 108, 136, 171, 137, 115, 211, 88, 109, 24, 79,
+  170, 126, 84, 67, 30, 206, 122, 172, 100, 49, 41, 101, 25, 6, 44, 222, 237,
+  227, 63, 177, 18, 194, 51, 44, 36, 99, 73, 37, 234, 19, 204, 79, 201, 224,
+  95, 223, 23, 255, 177, 128, 204, 57, 60, 255, 251, 4, 255, 135, 215, 174,
+  191, 98, 14, 191, 188, 1, 228, 45, 32, 236, 8, 242, 226, 251, 227, 47, 60,
+  245, 59, 179, 252, 142, 26, 63, 190, 250, 97, 182, 231, 45, 69, 129, 253,
+  88, 69, 75, 253, 82, 177, 55, 143, 250, 136, 32, 174, 7, 183, 16, 153, 65,
+  244, 119, 26, 7, 202, 161, 191, 250, 252, 176, 235, 235, 219, 190, 192, 234,
+  9, 117, 150, 157, 124, 184, 190, 255, 1, 243, 211, 223, 254, 126, 142, 196,
+  225, 223, 119, 211, 63, 126, 252, 219, 244, 127, 117, 255, 248, 233, 181,
+  235, 127, 39, 92, 255, 226, 6, 160, 155, 32, 114, 43, 8, 216, 111, 182, 77,
+  85, 197, 138, 59, 184, 176, 79, 219, 186, 29, 164, 46, 6, 63, 115, 147, 117,
+  182, 19, 53, 4, 159, 215, 250, 73, 159, 191, 44, 98, 54, 34, 210, 224, 65,
+  93, 173, 104, 224, 47, 8, 9, 95, 196, 51, 122, 105, 31, 255, 17, 142, 253,
+  38, 129, 244, 27, 130, 76, 160, 31, 61, 247, 197, 63, 219, 251, 177, 193,
+  159, 31, 253, 115, 76, 162, 161, 186, 254, 45, 253, 211, 209, 127, 189, 114,
+  236, 209, 181, 235, 255, 199, 22, 221, 255, 22, 114, 7, 49, 192, 91, 254,
+  71, 188, 1, 112, 136, 88, 85, 17, 232, 107, 137, 200, 133, 40, 252, 21, 126,
+  247, 27, 129, 207, 45, 61, 250, 8, 255, 21, 69, 159, 203, 248, 137, 189,
+  30, 81, 78, 28, 224, 111, 94, 43, 161, 228, 31, 134, 60, 229, 170, 111, 198,
+  196, 196, 218, 207, 62, 39, 93, 95, 110, 29, 38, 206, 18, 207, 79, 1, 241,
+  219, 134, 127, 3, 95, 252, 7, 213, 228, 113, 96, 127, 184, 241, 63, 215,
+  255, 111, 19, 128, 155, 215, 255, 250, 150, 61, 0, 242, 37, 176, 237, 216,
+  7, 82, 110, 176, 145, 239, 251, 72, 97, 191, 162, 208, 87, 209, 42, 47, 165,
+  118, 48, 99, 73, 99, 59, 32, 53, 121, 51, 153, 218, 127, 1, 235, 192, 146,
+  232, 203, 100, 98, 201, 127, 193, 116, 69, 136, 111, 36, 147, 145, 45, 38,
+  160, 240, 67, 93, 163, 167, 100, 230, 7, 184, 198, 207, 204, 233, 87, 115,
+  223, 103, 61, 58, 249, 1, 137, 164, 19, 115, 253, 27, 245, 23, 163, 255,
+  166, 233, 159, 58, 255, 59, 185, 115, 237, 127, 216, 110, 165, 23, 96, 231,
+  30, 64, 219, 64, 72, 12, 154, 146, 31, 248, 29, 161, 62, 64, 190, 170, 59,
+  122, 251, 117, 164, 212, 131, 156, 166, 242, 44, 146, 241, 119, 24, 199,
+  226, 9, 196, 42, 226, 28, 169, 191, 102, 2, 63, 96, 123, 125, 33, 248, 243,
+  98, 132, 230, 61, 130, 128, 60, 102, 149, 19, 139, 74, 131, 127, 168, 253,
+  186, 248, 143, 249, 134, 182, 31, 244, 137, 127, 254, 117, 252, 111, 218,
+  127, 135, 199, 90, 60, 230, 244, 193, 245, 95, 5, 231, 31, 93, 0, 8, 105,
+  17, 126, 222, 48, 12, 23, 2, 140, 148, 196, 43, 95, 62, 249, 172, 177, 47,
+  4, 252, 98, 147, 7, 155, 11, 174, 85, 230, 39, 234, 119, 198, 224, 71, 131,
+  125, 241, 154, 143, 251, 210, 115, 174, 235, 9, 111, 255, 149, 48, 233, 67,
+  85, 5, 204, 215, 144, 13, 225, 233, 31, 75, 183, 255, 140, 248, 134, 234,
+  207, 50, 85, 151, 191, 237, 252, 250, 222, 111, 31, 41, 8, 217, 136, 114,
+  207, 62, 255, 70, 254, 119, 79, 135, 255, 238, 253, 63, 125, 120, 253, 191,
+  218, 242, 11, 0, 34, 44, 97, 46, 62, 8, 240, 97, 104, 196, 228, 30, 163,
+  95, 51, 46, 23, 203, 244, 89, 165, 47, 154, 237, 83, 51, 217, 194, 190, 251,
+  146, 111, 131, 200, 242, 224, 229, 94, 89, 96, 202, 126, 233, 136, 235, 179,
+  164, 115, 30, 84, 77, 80, 148, 148, 49, 175, 207, 18, 116, 253, 132, 121,
+  95, 194, 251, 8, 179, 196, 211, 83, 68, 252, 238, 33, 221, 79, 52, 67, 124,
+  224, 202, 255, 62, 254, 215, 244, 79, 131, 255, 211, 235, 255, 57, 130, 159,
+  226, 143, 1, 135, 191, 200, 197, 66, 243, 77, 36, 235, 163, 97, 77, 156,
+  229, 85, 49, 236, 241, 248, 174, 84, 230, 229, 39, 95, 125, 175, 98, 244,
+  46, 209, 74, 74, 120, 250, 43, 217, 73, 194, 253, 9, 50, 200, 244, 18, 100,
+  228, 105, 228, 159, 211, 193, 114, 95, 119, 154, 33, 173, 15, 204, 248, 159,
+  114, 9, 97, 255, 153, 166, 164, 245, 195, 38, 63, 125, 51, 241, 200, 132,
+  127, 237, 241, 135, 248, 155, 252, 239, 228, 248, 250, 47, 122, 248, 35,
+  248, 75, 200, 75, 79, 128, 255, 135, 117, 172, 139, 75, 222, 252, 72, 103,
+  39, 40, 182, 208, 73, 14, 126, 240, 107, 232, 48, 26, 220, 166, 42, 148,
+  242, 101, 185, 152, 241, 243, 62, 127, 33, 60, 252, 212, 63, 202, 124, 253,
+  11, 207, 243, 12, 47, 242, 130, 232, 136, 3, 13, 121, 26, 129, 2, 9, 249,
+  49, 30, 246, 101, 190, 177, 80, 71, 204, 223, 51, 43, 131, 191, 178, 124,
+  112, 99, 159, 193, 59, 204, 114, 63, 28, 151, 104, 114, 242, 153, 19, 255,
+  10, 237, 63, 151, 255, 159, 156, 222, 252, 11, 30, 126, 241, 9, 136, 237,
+  134, 248, 14, 168, 99, 201, 125, 56, 246, 56, 212, 143, 61, 249, 80, 182,
+  3, 148, 122, 34, 81, 31, 176, 155, 170, 241, 68, 159, 156, 242, 117, 198,
+  253, 85, 236, 229, 55, 127, 128, 12, 102, 253, 49, 29, 113, 68, 57, 193,
+  249, 7, 216, 132, 6, 126, 103, 242, 128, 85, 68, 73, 233, 103, 14, 11, 12,
+  19, 219, 251, 243, 99, 159, 168, 250, 7, 231, 8, 206, 80, 250, 167, 211,
+  255, 3, 47, 29, 126, 122, 231, 231, 61, 252, 20, 255, 200, 94, 48, 255, 22,
+  139, 12, 215, 66, 134, 87, 227, 64, 159, 78, 107, 243, 10, 47, 163, 244,
+  197, 66, 62, 9, 125, 149, 249, 241, 156, 15, 191, 250, 185, 252, 242, 23,
+  93, 113, 31, 248, 195, 136, 129, 255, 74, 188, 252, 101, 223, 80, 199, 52,
+  41, 151, 99, 86, 249, 129, 19, 31, 64, 67, 24, 113, 202, 87, 203, 201, 25,
+  152, 251, 176, 167, 223, 185, 71, 216, 126, 178, 205, 41, 250, 152, 253,
+  99, 227, 63, 167, 29, 253, 209, 207, 49, 252, 99, 123, 0, 125, 71, 247, 64,
+  248, 38, 133, 121, 190, 162, 23, 97, 240, 86, 177, 147, 79, 187, 187, 18,
+  248, 12, 125, 157, 249, 229, 188, 211, 35, 218, 74, 132, 70, 111, 180, 224,
+  87, 242, 233, 131, 140, 240, 60, 133, 211, 15, 41, 71, 57, 138, 253, 10,
+  100, 26, 63, 15, 211, 126, 99, 224, 29, 53, 37, 74, 82, 11, 132, 191, 122,
+  99, 198, 254, 248, 135, 224, 191, 143, 85, 68, 236, 199, 29, 194, 244, 47,
+  228, 255, 86, 60, 234, 209, 191, 186, 237, 216, 0, 50, 240, 44, 85, 116,
+  193, 193, 186, 142, 53, 113, 105, 93, 31, 2, 143, 148, 185, 133, 163, 207,
+  239, 254, 53, 143, 250, 131, 173, 108, 206, 95, 91, 216, 232, 195, 19, 189,
+  130, 180, 120, 236, 229, 15, 175, 23, 226, 122, 224, 1, 239, 101, 212, 49,
+  62, 115, 146, 66, 168, 233, 52, 149, 98, 127, 218, 246, 133, 51, 37, 78,
+  71, 104, 226, 194, 191, 30, 32, 254, 66, 243, 16, 143, 255, 232, 49, 194,
+  223, 24, 199, 31, 25, 241, 192, 211, 147, 189, 127, 41, 64, 143, 54, 128,
+  180, 3, 192, 47, 180, 96, 172, 15, 63, 206, 236, 201, 113, 119, 143, 125,
+  228, 197, 103, 216, 179, 124, 143, 54, 119, 113, 206, 231, 188, 198, 114,
+  225, 230, 151, 233, 93, 184, 207, 95, 136, 150, 225, 146, 208, 200, 10, 81,
+  125, 130, 139, 4, 213, 21, 138, 73, 201, 194, 193, 114, 103, 240, 68, 83,
+  191, 169, 0, 63, 160, 22, 173, 86, 227, 83, 16, 253, 91, 213, 55, 94, 253,
+  211, 31, 247, 177, 19, 255, 215, 211, 255, 251, 192, 56, 246, 228, 228, 244,
+  232, 167, 182, 160, 0, 64, 243, 128, 238, 127, 196, 121, 193, 6, 137, 241,
+  112, 222, 102, 103, 117, 87, 80, 234, 138, 130, 143, 19, 62, 226, 50, 89,
+  224, 66, 191, 92, 235, 103, 42, 195, 29, 44, 47, 31, 204, 4, 199, 120, 41,
+  237, 115, 101, 159, 12, 249, 58, 112, 190, 25, 254, 66, 86, 136, 243, 49,
+  197, 98, 31, 81, 251, 16, 181, 211, 198, 103, 129, 249, 133, 131, 127, 171,
+  33, 231, 157, 35, 39, 79, 158, 4, 241, 127, 219, 254, 209, 233, 255, 145,
+  158, 31, 254, 241, 237, 54, 186, 3, 34, 152, 139, 27, 160, 145, 27, 248,
+  12, 245, 170, 43, 205, 39, 253, 29, 124, 237, 215, 50, 244, 200, 104, 178,
+  208, 127, 211, 89, 180, 218, 151, 35, 157, 225, 82, 24, 238, 144, 237, 3,
+  65, 206, 146, 201, 89, 255, 50, 34, 44, 227, 233, 94, 88, 77, 210, 172, 5,
+  135, 31, 23, 254, 130, 132, 244, 18, 219, 199, 140, 17, 243, 203, 207, 253,
+  177, 234, 95, 187, 246, 28, 249, 223, 165, 255, 90, 255, 253, 200, 202, 199,
+  252, 216, 22, 46, 134, 190, 252, 47, 116, 3, 108, 215, 228, 212, 71, 250,
+  57, 209, 84, 79, 124, 245, 165, 82, 143, 136, 189, 183, 151, 45, 241, 217,
+  23, 102, 122, 152, 127, 40, 126, 249, 217, 211, 95, 99, 203, 248, 186, 42,
+  131, 170, 91, 212, 60, 46, 194, 244, 39, 97, 72, 251, 233, 167, 136, 241,
+  133, 166, 189, 81, 234, 143, 164, 132, 244, 39, 27, 170, 195, 175, 94, 127,
+  84, 251, 11, 206, 161, 129, 78, 52, 61, 208, 179, 191, 33, 253, 243, 247,
+  191, 158, 31, 255, 199, 49, 246, 36, 16, 192, 255, 32, 252, 100, 190, 215,
+  18, 119, 163, 146, 206, 124, 213, 121, 242, 133, 120, 191, 22, 2, 126, 80,
+  234, 67, 30, 179, 165, 195, 62, 163, 230, 225, 98, 194, 95, 148, 226, 100,
+  151, 116, 250, 67, 220, 178, 98, 37, 223, 29, 174, 193, 113, 239, 192, 178,
+  160, 148, 159, 16, 251, 207, 145, 140, 172, 111, 251, 123, 106, 209, 208,
+  158, 126, 68, 252, 28, 0, 253, 224, 112, 254, 143, 124, 248, 231, 220, 191,
+  76, 253, 255, 68, 227, 255, 143, 240, 243, 31, 7, 92, 250, 255, 85, 189,
+  87, 46, 232, 238, 128, 94, 8, 248, 106, 241, 205, 175, 105, 208, 39, 153,
+  202, 183, 223, 43, 60, 208, 69, 10, 253, 57, 114, 21, 42, 5, 150, 135, 224,
+  40, 192, 28, 227, 11, 214, 239, 129, 138, 130, 204, 62, 170, 27, 254, 12,
+  102, 254, 161, 237, 227, 133, 158, 103, 192, 62, 8, 247, 151, 150, 3, 112,
+  250, 161, 234, 163, 157, 252, 128, 238, 17, 39, 28, 255, 224, 29, 113, 242,
+  195, 20, 252, 8, 210, 232, 231, 45, 36, 13, 54, 194, 152, 6, 130, 94, 2,
+  94, 184, 244, 229, 155, 95, 200, 245, 241, 173, 239, 45, 102, 171, 139, 52,
+  121, 35, 20, 31, 206, 241, 43, 107, 230, 31, 88, 57, 211, 88, 52, 226, 35,
+  136, 202, 209, 89, 3, 238, 31, 101, 2, 144, 37, 123, 252, 13, 231, 111, 202,
+  6, 190, 22, 84, 70, 176, 111, 53, 31, 60, 243, 143, 91, 7, 142, 108, 81,
+  225, 244, 9, 197, 223, 181, 127, 148, 119, 208, 15, 110, 201, 218, 108, 59,
+  49, 119, 191, 248, 173, 81, 117, 208, 55, 226, 29, 61, 65, 159, 145, 150,
+  249, 234, 93, 17, 63, 246, 148, 175, 165, 135, 95, 68, 159, 28, 254, 104,
+  185, 63, 20, 124, 253, 241, 207, 73, 210, 47, 122, 7, 174, 56, 237, 8, 9,
+  139, 56, 252, 203, 105, 152, 245, 36, 117, 223, 25, 174, 252, 184, 29, 183,
+  98, 248, 135, 232, 191, 207, 146, 127, 251, 209, 123, 182, 250, 251, 212,
+  177, 127, 141, 113, 244, 145, 17, 143, 253, 187, 36, 244, 187, 32, 199, 255,
+  71, 35, 129, 223, 117, 227, 179, 84, 15, 86, 249, 36, 90, 207, 58, 26, 246,
+  33, 123, 233, 38, 34, 224, 5, 216, 125, 68, 200, 169, 144, 244, 165, 133,
+  200, 15, 254, 169, 150, 193, 195, 151, 189, 253, 89, 196, 62, 44, 147, 45,
+  68, 218, 239, 160, 238, 51, 161, 240, 195, 129, 175, 57, 181, 142, 92, 66,
+  252, 3, 252, 193, 57, 24, 90, 71, 246, 213, 241, 127, 162, 178, 255, 112,
+  255, 171, 246, 143, 241, 142, 105, 158, 113, 244, 25, 226, 27, 254, 95, 216,
+  195, 47, 176, 117, 171, 58, 138, 126, 211, 81, 225, 237, 170, 241, 227, 131,
+  15, 225, 119, 191, 212, 121, 30, 119, 108, 32, 236, 78, 73, 200, 11, 218,
+  134, 71, 34, 63, 115, 252, 121, 214, 191, 140, 42, 201, 239, 112, 13, 207,
+  60, 227, 131, 25, 7, 187, 216, 159, 57, 199, 186, 79, 215, 3, 154, 47, 222,
+  58, 22, 232, 200, 132, 170, 226, 116, 168, 103, 255, 12, 249, 39, 188, 255,
+  206, 58, 80, 205, 127, 63, 99, 216, 110, 182, 219, 46, 228, 237, 191, 173,
+  47, 12, 62, 239, 232, 198, 78, 126, 125, 65, 240, 177, 181, 120, 147, 115,
+  147, 214, 60, 98, 30, 46, 143, 117, 197, 148, 165, 145, 162, 60, 30, 237,
+  135, 206, 161, 12, 253, 140, 165, 162, 44, 5, 93, 132, 73, 111, 160, 242,
+  59, 3, 114, 82, 116, 176, 36, 108, 183, 115, 31, 253, 135, 199, 63, 12, 254,
+  64, 239, 176, 201, 24, 146, 191, 194, 244, 151, 61, 255, 227, 173, 184, 98,
+  184, 195, 127, 173, 35, 50, 108, 21, 131, 157, 113, 247, 73, 153, 39, 30,
+  244, 197, 192, 111, 176, 201, 180, 36, 217, 158, 199, 142, 190, 48, 209,
+  93, 10, 3, 232, 216, 77, 68, 173, 108, 201, 73, 222, 180, 226, 191, 10, 204,
+  35, 156, 140, 144, 203, 223, 60, 255, 176, 238, 3, 13, 68, 102, 40, 245,
+  131, 185, 63, 194, 191, 23, 252, 94, 177, 132, 176, 149, 144, 53, 31, 222,
+  114, 255, 125, 249, 199, 151, 255, 181, 120, 244, 118, 215, 6, 16, 54, 129,
+  62, 252, 245, 46, 238, 86, 19, 41, 241, 8, 221, 29, 57, 219, 151, 10, 252,
+  2, 252, 250, 244, 75, 47, 191, 148, 241, 23, 84, 201, 41, 234, 33, 199, 255,
+  116, 60, 237, 147, 137, 158, 36, 244, 47, 114, 98, 35, 96, 66, 208, 130,
+  213, 125, 216, 188, 207, 28, 56, 135, 98, 255, 160, 243, 243, 115, 52, 244,
+  109, 52, 223, 88, 248, 167, 239, 150, 167, 142, 252, 103, 217, 63, 186, 253,
+  123, 100, 245, 163, 246, 183, 241, 181, 233, 248, 191, 28, 222, 209, 118,
+  78, 35, 60, 249, 140, 198, 139, 175, 253, 139, 161, 207, 224, 95, 3, 179,
+  142, 248, 72, 15, 53, 24, 225, 173, 158, 50, 170, 48, 105, 45, 227, 195,
+  124, 23, 109, 247, 137, 98, 210, 146, 146, 60, 72, 65, 86, 19, 231, 238,
+  228, 50, 63, 118, 250, 231, 243, 136, 152, 208, 210, 211, 254, 128, 228,
+  231, 0, 216, 199, 120, 252, 219, 111, 123, 190, 250, 7, 216, 255, 237, 245,
+  127, 170, 54, 192, 195, 237, 238, 133, 246, 129, 14, 22, 154, 26, 224, 31,
+  173, 236, 160, 80, 15, 138, 243, 117, 13, 238, 70, 91, 187, 52, 223, 15,
+  240, 51, 106, 39, 168, 246, 116, 120, 8, 87, 145, 98, 127, 68, 97, 178, 116,
+  48, 56, 178, 135, 236, 25, 159, 147, 41, 227, 130, 215, 125, 204, 87, 50,
+  39, 34, 127, 110, 214, 27, 118, 253, 109, 163, 209, 111, 57, 247, 73, 61,
+  254, 125, 104, 248, 55, 68, 74, 18, 222, 58, 248, 208, 75, 191, 218, 238,
+  239, 161, 158, 254, 48, 247, 255, 61, 128, 234, 174, 67, 15, 94, 254, 154,
+  148, 243, 133, 38, 62, 9, 246, 232, 139, 223, 117, 244, 133, 230, 30, 79,
+  249, 28, 254, 84, 193, 37, 143, 93, 253, 204, 95, 4, 213, 251, 106, 193,
+  52, 62, 252, 217, 148, 117, 16, 108, 245, 147, 167, 223, 83, 253, 242, 168,
+  143, 4, 122, 252, 213, 119, 152, 249, 205, 144, 127, 20, 73, 253, 23, 208,
+  174, 216, 4, 155, 115, 8, 63, 158, 250, 28, 217, 234, 111, 160, 148, 28,
+  129, 238, 143, 17, 255, 245, 229, 255, 147, 211, 155, 4, 254, 11, 172, 53,
+  14, 244, 170, 104, 55, 135, 148, 118, 197, 115, 127, 129, 144, 159, 21, 123,
+  8, 252, 5, 151, 236, 230, 14, 226, 66, 159, 79, 34, 119, 203, 190, 209, 166,
+  242, 187, 92, 116, 120, 198, 51, 174, 87, 22, 81, 21, 115, 55, 81, 30, 156,
+  221, 109, 209, 215, 40, 61, 8, 240, 47, 152, 154, 204, 12, 176, 126, 65,
+  235, 111, 68, 134, 73, 77, 93, 233, 88, 43, 191, 64, 252, 181, 250, 207,
+  177, 150, 15, 126, 239, 162, 232, 63, 3, 47, 127, 19, 77, 241, 27, 177, 174,
+  27, 1, 95, 110, 240, 236, 68, 223, 71, 253, 106, 21, 17, 114, 31, 37, 120,
+  8, 93, 94, 34, 231, 178, 195, 68, 14, 207, 247, 236, 74, 251, 189, 166, 160,
+  32, 41, 104, 240, 95, 138, 137, 191, 201, 252, 23, 44, 247, 11, 55, 142,
+  166, 24, 204, 32, 237, 19, 182, 126, 33, 252, 110, 154, 228, 244, 169, 11,
+  255, 247, 125, 247, 199, 155, 71, 189, 193, 224, 127, 214, 185, 7, 26, 146,
+  215, 49, 167, 53, 14, 61, 233, 235, 177, 26, 111, 205, 73, 93, 66, 204, 7,
+  211, 125, 10, 63, 69, 191, 236, 152, 232, 227, 178, 163, 225, 248, 19, 129,
+  89, 184, 173, 179, 37, 59, 134, 40, 240, 195, 202, 126, 168, 230, 75, 31,
+  36, 179, 31, 231, 116, 210, 119, 54, 71, 77, 127, 164, 246, 128, 68, 196,
+  51, 141, 63, 172, 252, 187, 169, 111, 238, 30, 165, 62, 197, 185, 189, 254,
+  157, 247, 135, 43, 255, 232, 243, 255, 218, 179, 29, 168, 195, 255, 227,
+  217, 154, 194, 223, 205, 225, 232, 44, 242, 136, 138, 29, 226, 195, 47, 60,
+  250, 246, 31, 0, 155, 50, 71, 224, 83, 244, 11, 252, 234, 19, 61, 34, 185,
+  215, 3, 255, 104, 21, 18, 243, 230, 158, 241, 168, 230, 239, 79, 127, 33,
+  36, 126, 174, 250, 12, 19, 255, 96, 31, 134, 61, 68, 68, 235, 96, 117, 225,
+  76, 194, 204, 159, 85, 252, 5, 214, 209, 166, 248, 19, 40, 101, 61, 115,
+  252, 113, 247, 215, 185, 7, 125, 141, 129, 255, 44, 190, 5, 26, 255, 178,
+  179, 61, 208, 196, 107, 250, 81, 42, 95, 71, 190, 215, 121, 244, 253, 194,
+  127, 195, 121, 148, 221, 85, 176, 155, 159, 201, 207, 241, 94, 79, 93, 129,
+  20, 54, 19, 138, 62, 25, 210, 116, 165, 177, 31, 239, 65, 33, 190, 97, 134,
+  70, 253, 166, 160, 234, 75, 204, 35, 151, 164, 242, 171, 63, 229, 4, 235,
+  125, 123, 205, 79, 236, 31, 98, 63, 67, 31, 92, 255, 54, 252, 119, 229, 159,
+  147, 179, 23, 61, 188, 29, 207, 128, 249, 231, 53, 172, 222, 69, 187, 121,
+  116, 84, 243, 34, 209, 126, 164, 212, 103, 240, 231, 71, 223, 45, 177, 205,
+  23, 41, 245, 146, 130, 15, 204, 250, 107, 134, 63, 18, 30, 80, 63, 74, 97,
+  178, 159, 70, 126, 220, 75, 128, 21, 34, 193, 107, 180, 64, 147, 158, 36,
+  244, 183, 248, 47, 67, 238, 231, 99, 127, 243, 57, 199, 112, 230, 207, 220,
+  254, 22, 254, 225, 120, 132, 57, 101, 211, 233, 40, 132, 127, 126, 248, 243,
+  200, 153, 199, 253, 237, 103, 24, 236, 103, 226, 22, 80, 255, 132, 138, 183,
+  96, 7, 68, 46, 254, 134, 253, 66, 10, 188, 53, 191, 249, 133, 6, 15, 5, 223,
+  254, 186, 113, 151, 63, 245, 233, 145, 18, 126, 208, 233, 3, 21, 159, 50,
+  194, 239, 149, 92, 228, 108, 239, 149, 148, 252, 50, 66, 243, 102, 62, 50,
+  252, 244, 251, 47, 106, 202, 225, 135, 106, 130, 115, 230, 28, 140, 92, 43,
+  71, 158, 247, 225, 74, 255, 67, 40, 250, 57, 129, 82, 2, 179, 177, 171, 254,
+  161, 238, 207, 177, 193, 255, 111, 8, 231, 159, 255, 211, 51, 149, 244, 225,
+  120, 94, 72, 243, 89, 101, 79, 184, 246, 47, 112, 244, 217, 213, 143, 2,
+  126, 143, 127, 1, 228, 250, 121, 198, 215, 201, 238, 19, 232, 189, 168, 217,
+  67, 85, 39, 242, 165, 72, 241, 15, 218, 130, 248, 236, 75, 84, 79, 162, 39,
+  154, 243, 178, 239, 172, 195, 62, 14, 247, 25, 179, 108, 8, 146, 63, 72,
+  252, 66, 196, 95, 199, 42, 152, 216, 209, 207, 144, 254, 29, 25, 247, 40,
+  21, 255, 253, 175, 240, 252, 75, 192, 187, 151, 31, 133, 116, 210, 173, 207,
+  220, 23, 200, 119, 113, 106, 119, 103, 194, 39, 223, 253, 10, 126, 210, 230,
+  133, 247, 190, 64, 239, 98, 49, 127, 73, 68, 9, 104, 181, 31, 140, 30, 151,
+  160, 228, 67, 103, 187, 87, 29, 122, 226, 29, 70, 2, 171, 9, 37, 252, 132,
+  81, 111, 48, 90, 202, 115, 14, 115, 227, 12, 200, 204, 31, 53, 16, 130, 230,
+  113, 211, 153, 225, 126, 152, 230, 159, 37, 255, 122, 252, 127, 205, 98,
+  76, 119, 192, 51, 241, 229, 135, 100, 157, 186, 22, 171, 59, 113, 232, 99,
+  195, 123, 136, 207, 137, 240, 143, 188, 251, 22, 254, 66, 62, 97, 225, 148,
+  21, 82, 198, 223, 225, 40, 133, 3, 255, 240, 164, 173, 192, 203, 191, 4,
+  30, 98, 88, 93, 206, 130, 207, 141, 195, 75, 65, 79, 118, 206, 103, 125,
+  2, 223, 127, 225, 31, 127, 129, 99, 166, 63, 169, 170, 251, 161, 220, 127,
+  224, 36, 228, 195, 56, 121, 112, 15, 219, 223, 51, 210, 111, 128, 252, 235,
+  241, 255, 171, 30, 228, 103, 210, 201, 127, 102, 202, 189, 228, 110, 247,
+  27, 64, 104, 232, 212, 164, 178, 39, 146, 184, 17, 173, 135, 135, 124, 252,
+  221, 111, 220, 163, 111, 241, 47, 48, 181, 147, 241, 58, 153, 177, 164, 88,
+  236, 103, 94, 114, 149, 32, 59, 162, 92, 163, 195, 213, 191, 20, 156, 100,
+  242, 76, 18, 20, 103, 55, 19, 252, 170, 112, 203, 223, 187, 72, 204, 252,
+  227, 191, 196, 156, 47, 212, 106, 200, 50, 80, 249, 5, 181, 159, 225, 136,
+  216, 7, 218, 79, 113, 232, 70, 63, 45, 249, 71, 87, 127, 108, 251, 247, 87,
+  53, 196, 194, 21, 224, 241, 111, 26, 116, 179, 187, 45, 176, 187, 159, 231,
+  15, 189, 172, 211, 180, 22, 198, 55, 9, 169, 107, 77, 223, 253, 13, 134,
+  159, 157, 126, 193, 73, 124, 7, 201, 131, 200, 77, 2, 1, 2, 191, 205, 209,
+  195, 111, 38, 124, 50, 42, 40, 47, 219, 198, 231, 76, 76, 218, 118, 30, 51,
+  161, 231, 75, 155, 190, 184, 233, 143, 39, 203, 208, 237, 15, 21, 31, 71,
+  184, 248, 99, 88, 5, 71, 86, 248, 223, 90, 127, 152, 225, 47, 235, 30, 245,
+  223, 108, 35, 27, 192, 254, 47, 155, 186, 17, 191, 17, 248, 57, 133, 75,
+  172, 241, 116, 208, 57, 165, 18, 191, 244, 238, 171, 159, 139, 136, 122,
+  19, 106, 240, 150, 148, 223, 23, 97, 246, 75, 238, 225, 176, 95, 153, 129,
+  182, 155, 108, 31, 73, 117, 38, 108, 84, 202, 141, 163, 253, 151, 181, 48,
+  234, 222, 200, 56, 94, 154, 245, 93, 200, 146, 34, 203, 158, 105, 251, 129,
+  232, 207, 26, 200, 176, 236, 95, 5, 24, 199, 33, 251, 63, 58, 48, 233, 255,
+  137, 97, 255, 158, 158, 254, 50, 192, 31, 35, 175, 127, 226, 23, 59, 194,
+  191, 217, 117, 244, 35, 19, 28, 157, 33, 127, 244, 217, 183, 27, 96, 195,
+  245, 154, 217, 5, 91, 80, 163, 177, 170, 227, 240, 243, 203, 31, 72, 78,
+  21, 40, 236, 143, 186, 135, 122, 105, 151, 60, 18, 152, 160, 84, 36, 146,
+  249, 205, 133, 113, 31, 73, 76, 112, 65, 89, 159, 166, 244, 171, 115, 255,
+  81, 152, 39, 118, 173, 165, 211, 189, 160, 252, 121, 8, 240, 111, 55, 192,
+  217, 47, 61, 99, 23, 64, 248, 199, 141, 128, 175, 127, 5, 164, 92, 79, 120,
+  237, 107, 153, 195, 31, 163, 116, 9, 69, 94, 116, 243, 43, 248, 243, 104,
+  181, 47, 106, 40, 28, 225, 248, 196, 70, 82, 193, 31, 48, 82, 242, 89, 137,
+  154, 210, 252, 236, 11, 222, 177, 101, 149, 5, 244, 241, 241, 135, 194, 18,
+  220, 66, 200, 215, 27, 230, 116, 226, 159, 90, 199, 91, 252, 173, 136, 240,
+  153, 225, 254, 29, 216, 240, 255, 208, 146, 191, 219, 227, 127, 114, 246,
+  139, 12, 255, 240, 147, 88, 194, 169, 155, 38, 214, 211, 145, 66, 189, 90,
+  10, 249, 228, 33, 30, 196, 232, 147, 14, 190, 249, 185, 204, 37, 74, 63,
+  208, 236, 173, 46, 128, 62, 210, 161, 225, 28, 134, 240, 199, 203, 145, 137,
+  7, 54, 143, 205, 177, 172, 87, 6, 153, 94, 121, 17, 241, 16, 83, 95, 210,
+  2, 29, 126, 226, 238, 4, 143, 255, 10, 230, 254, 129, 99, 54, 243, 180, 15,
+  91, 249, 69, 30, 2, 19, 146, 254, 205, 122, 79, 247, 29, 254, 182, 249, 123,
+  228, 221, 3, 127, 65, 196, 255, 153, 110, 244, 202, 101, 28, 243, 111, 162,
+  215, 30, 139, 243, 37, 193, 134, 53, 28, 226, 17, 203, 252, 235, 232, 205,
+  175, 170, 126, 38, 228, 47, 227, 4, 15, 193, 85, 150, 244, 121, 43, 18, 244,
+  197, 92, 100, 155, 166, 138, 205, 245, 175, 176, 172, 176, 60, 226, 37, 94,
+  77, 237, 87, 53, 11, 100, 79, 122, 252, 57, 223, 155, 120, 200, 168, 53,
+  165, 165, 159, 33, 21, 145, 71, 106, 18, 253, 64, 253, 61, 0, 213, 127, 141,
+  255, 191, 3, 240, 71, 240, 55, 114, 207, 214, 126, 151, 134, 181, 132, 242,
+  94, 13, 170, 60, 29, 13, 158, 142, 22, 143, 63, 251, 27, 151, 247, 139, 244,
+  30, 238, 212, 131, 108, 90, 65, 185, 183, 22, 152, 253, 21, 109, 101, 248,
+  63, 187, 14, 250, 196, 201, 222, 152, 113, 60, 45, 249, 178, 189, 89, 149,
+  57, 173, 250, 49, 137, 223, 5, 33, 27, 160, 86, 115, 158, 77, 161, 220, 219,
+  0, 248, 199, 185, 218, 143, 230, 21, 78, 156, 146, 216, 16, 20, 255, 1, 249,
+  87, 227, 255, 103, 8, 254, 246, 199, 166, 230, 151, 62, 200, 233, 59, 3,
+  190, 166, 105, 186, 148, 89, 249, 163, 47, 134, 252, 27, 142, 63, 129, 159,
+  54, 248, 11, 233, 222, 103, 129, 95, 45, 12, 118, 84, 77, 68, 109, 178, 16,
+  88, 126, 212, 73, 138, 4, 254, 185, 72, 62, 68, 149, 136, 165, 63, 254, 161,
+  229, 59, 91, 204, 69, 65, 65, 92, 249, 177, 81, 199, 132, 136, 253, 195,
+  228, 31, 118, 126, 141, 133, 208, 108, 184, 111, 125, 127, 141, 242, 59,
+  232, 254, 158, 158, 253, 156, 193, 159, 192, 31, 169, 226, 130, 91, 128,
+  41, 176, 215, 248, 220, 195, 131, 207, 171, 124, 141, 136, 125, 179, 142,
+  63, 251, 27, 155, 247, 227, 140, 15, 20, 123, 10, 121, 156, 143, 153, 138,
+  118, 112, 124, 64, 85, 195, 254, 249, 132, 86, 127, 8, 252, 164, 9, 159,
+  188, 83, 87, 210, 150, 34, 102, 83, 238, 237, 64, 236, 157, 4, 23, 17, 112,
+  247, 140, 53, 250, 65, 238, 55, 148, 254, 70, 126, 236, 7, 48, 203, 198,
+  46, 251, 11, 205, 95, 143, 255, 159, 126, 230, 48, 15, 240, 175, 5, 158,
+  22, 42, 230, 196, 70, 53, 121, 176, 215, 121, 244, 233, 171, 223, 112, 228,
+  253, 189, 191, 33, 240, 227, 130, 122, 17, 165, 246, 33, 235, 137, 186, 18,
+  28, 196, 59, 60, 132, 115, 252, 244, 75, 222, 209, 113, 243, 96, 105, 210,
+  88, 127, 101, 5, 40, 251, 205, 131, 196, 27, 105, 250, 45, 164, 212, 207,
+  50, 140, 71, 30, 126, 72, 251, 20, 188, 227, 13, 254, 147, 253, 125, 35,
+  252, 166, 163, 127, 55, 251, 105, 240, 255, 87, 28, 246, 1, 126, 57, 157,
+  7, 177, 29, 151, 98, 149, 197, 152, 201, 208, 182, 159, 219, 110, 58, 171,
+  188, 24, 250, 128, 191, 0, 63, 171, 245, 241, 124, 95, 44, 247, 74, 238,
+  34, 130, 0, 69, 25, 107, 245, 119, 192, 79, 187, 253, 130, 131, 224, 74,
+  156, 244, 17, 102, 253, 0, 233, 3, 125, 254, 124, 232, 43, 127, 160, 242,
+  63, 70, 188, 79, 48, 80, 58, 157, 225, 231, 223, 30, 255, 99, 45, 33, 255,
+  39, 49, 252, 252, 240, 11, 40, 215, 23, 107, 235, 208, 145, 253, 120, 190,
+  215, 117, 241, 59, 240, 215, 155, 208, 227, 143, 16, 251, 196, 114, 143,
+  220, 230, 165, 240, 3, 153, 217, 32, 54, 42, 28, 254, 21, 81, 244, 227, 162,
+  126, 185, 160, 40, 93, 160, 50, 244, 156, 77, 250, 224, 158, 47, 164, 252,
+  200, 162, 50, 150, 244, 101, 130, 255, 1, 116, 15, 197, 204, 31, 183, 207,
+  246, 253, 243, 239, 154, 127, 138, 251, 173, 207, 255, 31, 221, 62, 67, 240,
+  67, 225, 37, 76, 215, 1, 170, 187, 93, 114, 156, 98, 115, 231, 139, 92, 252,
+  4, 123, 11, 190, 13, 253, 74, 209, 155, 211, 165, 252, 85, 247, 76, 23, 189,
+  249, 171, 78, 141, 241, 38, 95, 9, 4, 255, 136, 139, 32, 52, 18, 43, 113,
+  209, 151, 58, 137, 20, 83, 26, 250, 7, 49, 233, 57, 42, 251, 187, 231, 63,
+  163, 3, 38, 190, 237, 59, 160, 222, 241, 192, 67, 8, 180, 23, 14, 116, 235,
+  95, 63, 255, 86, 249, 255, 216, 250, 135, 157, 254, 196, 51, 120, 1, 172,
+  229, 136, 143, 229, 244, 81, 101, 166, 152, 60, 31, 137, 247, 69, 46, 47,
+  193, 30, 31, 254, 181, 108, 209, 196, 79, 126, 76, 196, 7, 211, 123, 35,
+  240, 195, 171, 173, 90, 69, 24, 222, 194, 132, 7, 84, 23, 45, 35, 69, 63,
+  23, 148, 172, 252, 160, 215, 140, 123, 71, 219, 195, 191, 192, 60, 115, 162,
+  37, 188, 242, 70, 79, 108, 230, 47, 48, 191, 76, 244, 111, 246, 217, 145,
+  145, 253, 180, 163, 63, 250, 249, 55, 213, 255, 211, 179, 63, 176, 221, 134,
+  29, 16, 185, 247, 107, 146, 211, 119, 72, 51, 209, 250, 126, 215, 16, 79,
+  172, 216, 35, 128, 191, 105, 58, 72, 221, 21, 62, 250, 130, 130, 151, 16,
+  245, 87, 17, 127, 137, 240, 199, 227, 47, 127, 116, 182, 23, 189, 253, 37,
+  146, 25, 225, 195, 102, 139, 233, 140, 207, 121, 6, 73, 73, 35, 40, 137,
+  9, 7, 6, 127, 191, 251, 150, 206, 231, 47, 100, 127, 88, 70, 62, 140, 21,
+  153, 207, 116, 124, 224, 169, 191, 70, 250, 87, 159, 255, 211, 147, 179,
+  211, 179, 31, 11, 240, 175, 187, 249, 58, 124, 3, 68, 27, 59, 52, 232, 147,
+  244, 90, 58, 26, 60, 40, 230, 223, 248, 170, 159, 56, 207, 83, 225, 140,
+  63, 166, 220, 219, 97, 43, 135, 158, 254, 176, 179, 139, 174, 195, 159, 97,
+  231, 120, 50, 226, 33, 202, 76, 184, 176, 164, 68, 111, 255, 140, 208, 253,
+  168, 139, 16, 36, 253, 248, 192, 115, 209, 7, 149, 223, 17, 116, 123, 161,
+  98, 114, 214, 63, 242, 212, 13, 254, 154, 234, 175, 211, 126, 80, 248, 255,
+  232, 51, 183, 1, 164, 163, 47, 63, 240, 178, 251, 6, 237, 237, 236, 64, 63,
+  26, 244, 97, 240, 245, 79, 77, 185, 203, 162, 9, 95, 252, 101, 199, 48, 183,
+  192, 242, 32, 74, 195, 230, 175, 65, 124, 249, 115, 238, 227, 34, 74, 123,
+  80, 77, 105, 224, 122, 191, 162, 116, 31, 10, 63, 22, 122, 193, 62, 34, 38,
+  237, 152, 225, 182, 63, 120, 254, 39, 200, 70, 192, 180, 24, 218, 207, 115,
+  122, 16, 132, 159, 188, 244, 131, 49, 16, 251, 17, 11, 255, 154, 145, 118,
+  58, 202, 121, 157, 45, 221, 14, 244, 187, 224, 167, 65, 159, 61, 250, 26,
+  126, 218, 72, 145, 211, 253, 93, 229, 190, 200, 104, 135, 100, 41, 102, 124,
+  195, 1, 203, 107, 133, 76, 36, 179, 14, 193, 129, 104, 218, 111, 191, 178,
+  57, 133, 127, 33, 37, 254, 188, 233, 31, 12, 4, 179, 25, 148, 250, 70, 188,
+  159, 9, 172, 253, 5, 252, 207, 124, 244, 223, 134, 127, 33, 252, 63, 107,
+  119, 192, 63, 108, 206, 255, 206, 87, 63, 178, 7, 120, 164, 143, 67, 190,
+  24, 250, 4, 126, 1, 252, 128, 127, 195, 254, 90, 139, 142, 152, 143, 73,
+  120, 69, 223, 125, 1, 126, 255, 135, 46, 228, 151, 191, 203, 85, 0, 178,
+  208, 138, 136, 133, 96, 85, 22, 51, 49, 241, 159, 83, 93, 49, 38, 43, 5,
+  12, 4, 167, 36, 247, 27, 2, 251, 104, 170, 36, 171, 181, 228, 122, 198, 246,
+  65, 223, 254, 71, 238, 250, 55, 231, 255, 135, 21, 252, 107, 22, 215, 215,
+  29, 117, 124, 129, 199, 71, 112, 239, 170, 242, 54, 17, 244, 65, 145, 31,
+  225, 191, 169, 217, 147, 90, 8, 15, 63, 106, 243, 148, 194, 80, 79, 69, 212,
+  137, 48, 127, 17, 122, 201, 42, 235, 88, 243, 151, 142, 9, 222, 89, 196,
+  73, 46, 228, 253, 165, 152, 156, 132, 73, 83, 21, 253, 131, 134, 239, 108,
+  129, 109, 164, 64, 221, 71, 244, 15, 117, 95, 192, 4, 209, 62, 156, 220,
+  167, 37, 126, 120, 69, 9, 64, 46, 235, 235, 244, 207, 232, 62, 187, 226,
+  175, 245, 143, 253, 251, 245, 225, 223, 205, 216, 194, 37, 221, 142, 198,
+  78, 119, 141, 95, 100, 242, 199, 143, 190, 191, 252, 165, 156, 143, 148,
+  122, 225, 193, 47, 73, 159, 87, 144, 41, 17, 60, 38, 194, 159, 27, 104, 185,
+  65, 162, 71, 224, 247, 139, 53, 63, 30, 158, 114, 235, 248, 185, 160, 240,
+  50, 23, 237, 99, 169, 121, 244, 202, 79, 23, 142, 192, 241, 15, 133, 255,
+  177, 111, 253, 77, 93, 231, 199, 225, 63, 48, 199, 223, 232, 126, 251, 243,
+  175, 174, 255, 179, 31, 120, 182, 166, 65, 93, 189, 163, 166, 83, 71, 90,
+  250, 152, 209, 19, 239, 240, 52, 241, 50, 31, 199, 191, 46, 35, 154, 157,
+  48, 236, 19, 20, 156, 24, 199, 71, 190, 250, 101, 131, 145, 66, 168, 248,
+  112, 39, 65, 97, 180, 191, 16, 114, 83, 68, 59, 47, 80, 195, 127, 193, 25,
+  31, 136, 106, 78, 121, 230, 118, 7, 142, 0, 237, 3, 141, 252, 142, 153, 150,
+  164, 177, 143, 31, 58, 248, 195, 245, 239, 236, 195, 191, 212, 208, 34, 79,
+  221, 116, 231, 118, 221, 36, 206, 142, 34, 63, 63, 252, 34, 250, 224, 234,
+  111, 225, 143, 200, 183, 84, 244, 238, 151, 109, 134, 107, 169, 224, 211,
+  176, 46, 63, 187, 253, 209, 84, 175, 60, 223, 129, 179, 254, 18, 219, 201,
+  200, 254, 177, 237, 90, 154, 179, 63, 67, 218, 190, 164, 234, 143, 249, 134,
+  36, 247, 83, 95, 130, 111, 251, 75, 19, 255, 164, 244, 175, 63, 215, 200,
+  83, 63, 220, 228, 183, 105, 254, 183, 248, 23, 36, 160, 139, 163, 207, 118,
+  128, 92, 224, 19, 170, 188, 8, 247, 230, 98, 232, 155, 159, 42, 50, 206,
+  197, 254, 90, 187, 74, 253, 17, 94, 63, 183, 17, 167, 115, 169, 161, 211,
+  183, 18, 6, 59, 187, 226, 126, 38, 46, 74, 137, 231, 243, 144, 247, 195,
+  211, 143, 39, 61, 253, 160, 1, 21, 20, 53, 95, 194, 42, 192, 143, 70, 126,
+  64, 246, 55, 67, 46, 34, 179, 73, 144, 125, 54, 207, 191, 150, 126, 209,
+  247, 255, 184, 233, 98, 107, 178, 8, 47, 54, 182, 197, 5, 218, 228, 82, 79,
+  67, 218, 187, 66, 178, 191, 9, 199, 191, 6, 246, 76, 146, 102, 167, 24, 243,
+  215, 113, 5, 183, 168, 211, 0, 216, 253, 235, 38, 95, 81, 118, 191, 112,
+  248, 11, 52, 222, 89, 22, 32, 235, 47, 226, 138, 242, 57, 32, 250, 135, 73,
+  175, 37, 246, 15, 22, 228, 5, 144, 182, 192, 138, 180, 253, 131, 215, 23,
+  225, 125, 121, 15, 177, 169, 31, 252, 58, 34, 225, 223, 217, 81, 179, 174,
+  59, 18, 123, 52, 155, 139, 42, 251, 226, 205, 47, 247, 247, 46, 132, 62,
+  198, 94, 95, 0, 149, 220, 229, 37, 228, 30, 89, 187, 49, 46, 228, 34, 249,
+  202, 193, 63, 120, 185, 66, 25, 63, 207, 249, 37, 243, 248, 16, 160, 22,
+  93, 2, 99, 203, 32, 240, 193, 18, 255, 5, 139, 252, 89, 225, 207, 108, 194,
+  133, 155, 246, 6, 193, 191, 131, 127, 60, 197, 248, 155, 66, 195, 44, 232,
+  62, 0, 238, 135, 190, 255, 31, 118, 21, 118, 214, 156, 180, 185, 171, 177,
+  215, 81, 228, 111, 8, 179, 35, 22, 242, 89, 244, 55, 213, 14, 155, 6, 153,
+  223, 195, 9, 94, 149, 232, 37, 29, 85, 29, 93, 193, 120, 155, 90, 9, 22,
+  185, 228, 41, 194, 61, 68, 105, 228, 103, 191, 68, 58, 226, 15, 39, 189,
+  160, 125, 244, 170, 195, 62, 58, 155, 35, 206, 31, 40, 253, 140, 39, 68,
+  83, 198, 215, 153, 116, 242, 31, 138, 127, 38, 251, 215, 22, 98, 183, 99,
+  248, 139, 80, 227, 18, 127, 148, 203, 199, 47, 254, 166, 131, 216, 195, 239,
+  125, 253, 83, 37, 161, 207, 235, 188, 162, 102, 55, 150, 241, 169, 4, 51,
+  225, 200, 225, 111, 214, 172, 209, 75, 213, 252, 24, 252, 101, 81, 200, 118,
+  50, 174, 17, 237, 55, 104, 142, 59, 126, 17, 35, 41, 161, 239, 136, 232,
+  38, 211, 161, 23, 250, 54, 149, 159, 17, 189, 253, 39, 32, 247, 211, 159,
+  241, 16, 244, 126, 142, 93, 244, 167, 54, 192, 249, 149, 206, 34, 223, 90,
+  168, 237, 116, 220, 252, 146, 96, 207, 5, 104, 93, 102, 11, 96, 244, 221,
+  233, 23, 90, 232, 148, 221, 211, 41, 224, 86, 69, 175, 126, 217, 87, 142,
+  220, 254, 104, 168, 159, 198, 125, 57, 38, 36, 8, 50, 83, 164, 23, 177, 152,
+  139, 121, 63, 38, 124, 44, 237, 144, 33, 113, 145, 11, 17, 200, 4, 8, 61,
+  59, 210, 47, 112, 143, 167, 54, 66, 106, 29, 29, 30, 2, 217, 231, 99, 123,
+  252, 213, 5, 240, 189, 157, 140, 93, 90, 216, 219, 161, 214, 208, 92, 128,
+  218, 33, 134, 125, 232, 167, 77, 137, 199, 249, 42, 33, 160, 234, 188, 250,
+  229, 62, 111, 183, 203, 136, 170, 109, 68, 36, 220, 5, 146, 103, 206, 232,
+  40, 84, 99, 142, 60, 254, 117, 137, 233, 62, 160, 236, 183, 224, 254, 193,
+  116, 196, 56, 56, 27, 141, 136, 214, 223, 72, 118, 145, 154, 130, 193, 146,
+  227, 67, 239, 250, 161, 108, 223, 142, 77, 246, 119, 122, 118, 126, 246,
+  245, 29, 197, 30, 230, 174, 43, 56, 174, 210, 67, 223, 116, 13, 238, 115,
+  102, 15, 57, 248, 234, 251, 134, 113, 59, 37, 151, 14, 170, 219, 27, 225,
+  119, 85, 145, 148, 95, 26, 73, 207, 249, 116, 7, 79, 250, 35, 240, 71, 220,
+  227, 195, 202, 24, 219, 107, 201, 85, 30, 150, 130, 162, 48, 14, 64, 71,
+  184, 242, 99, 225, 143, 24, 72, 155, 207, 120, 18, 178, 191, 19, 43, 252,
+  219, 30, 126, 117, 255, 191, 208, 197, 219, 228, 70, 107, 93, 179, 91, 216,
+  145, 97, 215, 32, 7, 123, 248, 225, 247, 146, 42, 119, 69, 106, 125, 101,
+  151, 100, 123, 71, 189, 47, 166, 53, 95, 102, 188, 228, 39, 153, 9, 18, 170,
+  7, 45, 249, 134, 47, 22, 165, 165, 139, 47, 2, 63, 158, 52, 129, 243, 197,
+  216, 229, 15, 27, 8, 163, 218, 95, 224, 23, 158, 30, 6, 217, 175, 99, 123,
+  253, 171, 13, 112, 126, 246, 55, 165, 202, 62, 22, 100, 34, 85, 221, 142,
+  155, 191, 123, 140, 39, 194, 237, 216, 96, 252, 213, 143, 72, 206, 71, 84,
+  251, 170, 78, 205, 118, 230, 67, 192, 239, 126, 222, 217, 202, 216, 112,
+  15, 38, 121, 209, 185, 126, 121, 244, 180, 146, 93, 68, 203, 25, 13, 253,
+  152, 159, 128, 52, 108, 146, 103, 160, 254, 208, 126, 9, 25, 104, 251, 143,
+  9, 235, 11, 138, 202, 216, 226, 159, 94, 231, 48, 250, 83, 183, 191, 105,
+  254, 181, 247, 255, 95, 199, 224, 175, 227, 188, 93, 247, 11, 151, 228, 142,
+  129, 223, 240, 49, 30, 185, 222, 131, 190, 111, 214, 101, 87, 48, 197, 163,
+  62, 96, 56, 78, 224, 111, 196, 153, 62, 118, 249, 251, 171, 14, 129, 207,
+  196, 220, 104, 218, 95, 118, 117, 123, 5, 10, 226, 138, 207, 248, 74, 218,
+  238, 236, 248, 227, 139, 168, 88, 142, 88, 233, 39, 102, 32, 237, 241, 239,
+  133, 232, 207, 100, 255, 39, 167, 214, 64, 254, 175, 174, 163, 243, 26, 210,
+  136, 118, 231, 225, 23, 123, 60, 155, 14, 86, 223, 154, 31, 253, 246, 7,
+  111, 242, 147, 66, 111, 215, 217, 175, 192, 179, 223, 200, 167, 95, 138,
+  251, 252, 237, 159, 33, 162, 135, 100, 41, 149, 23, 93, 76, 159, 72, 79,
+  66, 109, 79, 115, 247, 187, 203, 31, 222, 253, 11, 108, 34, 153, 173, 168,
+  125, 124, 112, 181, 45, 242, 133, 101, 124, 57, 206, 255, 132, 178, 254,
+  160, 170, 132, 197, 191, 15, 163, 255, 211, 147, 16, 254, 157, 253, 119,
+  156, 184, 219, 69, 218, 223, 161, 201, 45, 196, 125, 27, 54, 195, 39, 84,
+  123, 192, 6, 88, 147, 129, 30, 169, 144, 66, 206, 62, 150, 239, 35, 35, 125,
+  13, 63, 253, 17, 77, 130, 154, 162, 79, 124, 123, 5, 79, 41, 217, 80, 38,
+  112, 208, 74, 112, 63, 229, 238, 240, 147, 180, 127, 33, 56, 200, 66, 198,
+  39, 37, 27, 207, 124, 225, 135, 178, 190, 252, 196, 255, 148, 14, 22, 15,
+  124, 235, 255, 216, 50, 191, 77, 245, 231, 236, 252, 151, 215, 236, 222,
+  143, 30, 254, 53, 209, 106, 17, 5, 217, 47, 200, 235, 242, 207, 62, 62, 253,
+  155, 70, 38, 118, 211, 163, 207, 21, 251, 163, 197, 94, 241, 238, 247, 91,
+  0, 36, 179, 171, 64, 238, 149, 6, 123, 137, 139, 112, 172, 43, 45, 78, 31,
+  168, 47, 16, 144, 61, 230, 212, 70, 208, 232, 59, 18, 194, 207, 42, 131,
+  47, 191, 175, 63, 204, 76, 234, 63, 28, 19, 165, 247, 192, 250, 3, 149, 127,
+  75, 48, 29, 28, 185, 231, 255, 4, 225, 127, 126, 246, 159, 224, 74, 223,
+  142, 153, 141, 93, 99, 219, 77, 60, 230, 19, 15, 191, 199, 223, 128, 191,
+  86, 240, 71, 172, 25, 217, 201, 255, 98, 181, 254, 216, 233, 15, 91, 61,
+  71, 20, 175, 40, 207, 103, 7, 252, 17, 169, 153, 186, 42, 61, 211, 115, 46,
+  187, 199, 139, 132, 31, 219, 244, 133, 41, 200, 4, 165, 254, 68, 236, 115,
+  66, 52, 165, 108, 163, 113, 104, 146, 191, 35, 255, 250, 187, 240, 239, 252,
+  23, 214, 157, 109, 29, 172, 202, 70, 116, 186, 98, 164, 158, 134, 215, 249,
+  56, 169, 147, 4, 126, 230, 167, 166, 40, 119, 137, 54, 10, 224, 71, 100,
+  187, 163, 206, 178, 28, 255, 246, 91, 201, 189, 91, 216, 112, 87, 78, 5,
+  135, 196, 211, 95, 138, 137, 233, 10, 18, 189, 89, 191, 223, 71, 127, 224,
+  238, 95, 65, 251, 248, 176, 17, 199, 64, 234, 203, 87, 254, 167, 110, 228,
+  99, 74, 75, 191, 26, 255, 209, 17, 168, 253, 91, 234, 95, 155, 252, 181,
+  27, 224, 207, 54, 235, 78, 69, 54, 6, 191, 216, 218, 237, 22, 236, 17, 14,
+  63, 185, 250, 205, 79, 138, 236, 35, 56, 180, 128, 80, 26, 18, 251, 152,
+  126, 91, 135, 142, 7, 155, 86, 231, 87, 29, 151, 240, 221, 193, 243, 129,
+  245, 73, 32, 57, 82, 69, 60, 69, 22, 184, 225, 183, 96, 105, 255, 82, 170,
+  251, 248, 89, 131, 194, 127, 37, 35, 50, 239, 53, 70, 3, 191, 72, 77, 124,
+  230, 66, 206, 177, 27, 251, 63, 134, 199, 95, 121, 136, 255, 28, 233, 235,
+  136, 197, 93, 182, 7, 58, 148, 153, 35, 181, 30, 169, 203, 67, 238, 254,
+  22, 254, 232, 195, 47, 178, 123, 58, 250, 124, 236, 217, 151, 78, 63, 172,
+  101, 228, 210, 92, 31, 214, 244, 128, 178, 14, 100, 186, 179, 138, 185, 201,
+  249, 180, 52, 95, 144, 200, 31, 177, 189, 8, 227, 67, 200, 252, 189, 207,
+  73, 62, 28, 142, 104, 234, 63, 70, 6, 210, 8, 127, 243, 105, 39, 96, 238,
+  39, 244, 126, 149, 133, 236, 207, 136, 248, 71, 104, 60, 49, 240, 47, 50,
+  202, 33, 84, 250, 65, 206, 167, 86, 85, 150, 187, 61, 153, 121, 212, 31,
+  69, 31, 81, 123, 41, 179, 153, 252, 89, 203, 24, 203, 135, 222, 253, 148,
+  228, 91, 112, 95, 9, 106, 42, 160, 191, 198, 149, 148, 247, 47, 86, 212,
+  63, 124, 181, 18, 198, 13, 130, 157, 68, 251, 109, 5, 45, 126, 129, 205,
+  43, 174, 252, 97, 53, 241, 197, 84, 215, 254, 181, 234, 155, 58, 254, 39,
+  250, 244, 159, 158, 183, 27, 224, 95, 148, 198, 118, 98, 44, 174, 11, 204,
+  238, 198, 138, 61, 226, 225, 7, 224, 43, 166, 167, 68, 236, 150, 224, 223,
+  253, 240, 203, 189, 30, 150, 244, 251, 63, 105, 45, 30, 254, 130, 21, 252,
+  73, 201, 175, 216, 113, 87, 133, 29, 90, 98, 178, 23, 182, 117, 224, 29,
+  127, 162, 46, 149, 1, 97, 185, 37, 39, 253, 140, 137, 131, 244, 20, 171,
+  201, 183, 223, 102, 164, 248, 99, 146, 63, 117, 1, 252, 97, 116, 237, 71,
+  37, 25, 41, 254, 60, 209, 111, 98, 146, 61, 32, 229, 227, 33, 191, 3, 95,
+  56, 253, 145, 195, 95, 87, 49, 244, 43, 228, 63, 135, 239, 126, 200, 112,
+  131, 205, 45, 27, 210, 146, 148, 47, 67, 142, 114, 92, 98, 190, 236, 160,
+  121, 150, 162, 212, 76, 142, 67, 63, 87, 246, 161, 129, 127, 152, 244, 141,
+  25, 201, 21, 115, 159, 251, 17, 214, 199, 132, 193, 31, 156, 100, 102, 71,
+  128, 248, 123, 226, 106, 255, 237, 245, 127, 254, 207, 241, 153, 45, 206,
+  232, 8, 160, 239, 18, 104, 101, 13, 222, 200, 225, 247, 129, 159, 253, 121,
+  83, 94, 68, 177, 21, 142, 115, 146, 168, 175, 98, 246, 115, 248, 238, 151,
+  14, 191, 255, 99, 22, 148, 230, 193, 192, 207, 119, 196, 253, 98, 218, 15,
+  98, 211, 37, 150, 247, 192, 153, 159, 160, 45, 153, 131, 208, 15, 224, 95,
+  168, 242, 143, 183, 248, 11, 74, 143, 1, 127, 86, 251, 49, 41, 167, 239,
+  252, 59, 221, 7, 85, 253, 83, 239, 255, 63, 209, 208, 190, 94, 68, 166, 1,
+  226, 223, 113, 245, 111, 68, 110, 15, 14, 250, 73, 212, 111, 169, 126, 213,
+  174, 195, 95, 199, 70, 249, 171, 186, 155, 221, 25, 179, 152, 115, 133, 172,
+  10, 249, 118, 81, 29, 207, 60, 150, 244, 23, 93, 94, 130, 21, 146, 154, 41,
+  3, 207, 63, 226, 32, 14, 193, 95, 69, 8, 231, 250, 75, 153, 140, 184, 214,
+  11, 82, 251, 178, 156, 127, 207, 53, 208, 159, 216, 29, 127, 219, 251, 9,
+  248, 255, 30, 62, 183, 21, 81, 102, 219, 57, 189, 27, 185, 248, 187, 130,
+  126, 247, 11, 155, 228, 23, 7, 57, 137, 96, 123, 215, 56, 103, 7, 193, 139,
+  94, 254, 235, 90, 30, 238, 96, 18, 227, 112, 172, 191, 235, 238, 47, 253,
+  61, 229, 191, 200, 21, 46, 251, 208, 57, 159, 165, 164, 45, 41, 76, 155,
+  168, 175, 197, 149, 253, 200, 188, 231, 132, 182, 253, 177, 143, 160, 31,
+  251, 113, 115, 223, 38, 251, 239, 157, 255, 16, 108, 236, 119, 170, 180,
+  116, 164, 124, 155, 47, 242, 238, 195, 140, 207, 238, 1, 121, 150, 151, 177,
+  122, 9, 250, 240, 238, 111, 164, 122, 31, 189, 251, 215, 210, 229, 191, 110,
+  64, 148, 149, 137, 52, 143, 174, 122, 127, 41, 136, 14, 208, 233, 3, 149,
+  252, 67, 51, 71, 212, 241, 91, 66, 79, 129, 12, 200, 11, 82, 117, 41, 251,
+  37, 161, 211, 239, 61, 190, 167, 176, 243, 55, 199, 114, 242, 138, 97, 126,
+  114, 108, 29, 127, 125, 246, 111, 158, 255, 243, 223, 181, 22, 251, 252,
+  145, 198, 94, 236, 238, 223, 172, 215, 23, 98, 116, 179, 155, 223, 114, 189,
+  36, 193, 94, 137, 212, 13, 110, 126, 122, 247, 55, 49, 21, 167, 78, 83, 241,
+  246, 123, 65, 209, 231, 222, 77, 36, 231, 47, 34, 122, 83, 184, 60, 5, 246,
+  104, 190, 88, 176, 49, 15, 112, 246, 151, 212, 64, 62, 39, 140, 31, 80, 132,
+  200, 16, 233, 3, 116, 125, 39, 216, 67, 156, 140, 152, 156, 57, 203, 7, 155,
+  252, 59, 252, 123, 207, 47, 50, 181, 137, 55, 64, 148, 215, 21, 31, 231,
+  224, 135, 159, 158, 254, 206, 195, 79, 51, 62, 177, 222, 39, 186, 208, 68,
+  138, 253, 96, 151, 87, 188, 228, 39, 148, 251, 5, 41, 87, 81, 98, 88, 118,
+  20, 90, 46, 132, 183, 63, 36, 254, 240, 250, 207, 249, 196, 9, 10, 69, 87,
+  54, 242, 71, 109, 95, 135, 62, 40, 253, 154, 203, 223, 39, 157, 103, 126,
+  236, 203, 212, 126, 117, 237, 175, 189, 254, 207, 11, 142, 125, 19, 141,
+  243, 187, 153, 61, 209, 82, 159, 156, 241, 227, 203, 191, 203, 166, 3, 71,
+  252, 194, 60, 47, 245, 162, 145, 158, 126, 106, 50, 103, 255, 144, 13, 0,
+  95, 230, 247, 151, 162, 204, 116, 197, 38, 81, 34, 58, 131, 237, 143, 18,
+  147, 125, 22, 220, 65, 156, 78, 250, 80, 234, 81, 136, 68, 23, 52, 243, 119,
+  30, 210, 238, 244, 79, 185, 143, 160, 194, 255, 36, 224, 127, 102, 138, 191,
+  6, 255, 169, 48, 182, 43, 79, 239, 52, 241, 25, 62, 218, 229, 139, 52, 249,
+  192, 205, 223, 113, 250, 217, 223, 38, 123, 246, 187, 36, 156, 232, 56, 103,
+  205, 90, 91, 120, 56, 21, 243, 123, 161, 113, 155, 108, 44, 21, 155, 67,
+  98, 154, 3, 96, 155, 174, 8, 250, 184, 236, 75, 76, 37, 114, 82, 137, 66,
+  78, 114, 185, 74, 255, 201, 180, 223, 132, 149, 126, 76, 238, 135, 26, 14,
+  231, 206, 241, 7, 214, 254, 213, 6, 56, 91, 139, 202, 156, 98, 146, 223,
+  116, 149, 249, 17, 252, 230, 23, 185, 195, 143, 142, 127, 35, 213, 251, 202,
+  206, 30, 175, 212, 234, 145, 4, 233, 235, 104, 206, 7, 46, 184, 146, 152,
+  182, 49, 142, 95, 220, 77, 180, 138, 124, 197, 108, 159, 150, 172, 230, 199,
+  189, 228, 8, 215, 91, 168, 251, 216, 47, 104, 74, 198, 125, 144, 141, 44,
+  18, 148, 71, 60, 211, 30, 186, 254, 207, 44, 254, 237, 251, 191, 39, 143,
+  237, 114, 30, 103, 179, 163, 191, 15, 105, 189, 209, 14, 127, 72, 248, 219,
+  181, 221, 152, 118, 191, 164, 219, 71, 221, 249, 240, 95, 169, 164, 222,
+  24, 191, 249, 69, 87, 113, 243, 189, 234, 42, 248, 58, 147, 1, 201, 73, 56,
+  34, 49, 77, 6, 80, 204, 70, 205, 64, 216, 111, 44, 29, 208, 144, 111, 182,
+  98, 70, 162, 254, 57, 226, 212, 147, 201, 216, 27, 252, 185, 224, 47, 12,
+  124, 96, 93, 193, 5, 40, 58, 244, 65, 235, 207, 181, 254, 53, 254, 31, 203,
+  131, 187, 98, 160, 223, 236, 100, 116, 139, 65, 31, 42, 247, 209, 211, 143,
+  188, 249, 68, 163, 6, 193, 167, 105, 7, 179, 91, 166, 246, 115, 242, 74,
+  155, 249, 227, 164, 207, 189, 180, 130, 144, 43, 119, 19, 173, 186, 156,
+  100, 221, 29, 165, 126, 137, 176, 61, 4, 190, 199, 74, 152, 53, 14, 253,
+  39, 189, 27, 5, 161, 55, 91, 250, 1, 199, 223, 155, 136, 123, 73, 217, 65,
+  56, 254, 142, 249, 165, 159, 255, 222, 173, 248, 224, 54, 1, 188, 137, 213,
+  249, 55, 188, 224, 215, 121, 248, 253, 170, 37, 249, 46, 106, 212, 192, 82,
+  62, 234, 207, 140, 70, 249, 37, 249, 42, 193, 99, 208, 126, 207, 243, 156,
+  118, 215, 119, 41, 186, 112, 54, 58, 254, 146, 121, 97, 178, 32, 154, 206,
+  84, 217, 17, 137, 76, 145, 186, 31, 210, 152, 81, 248, 103, 184, 240, 3,
+  83, 127, 96, 36, 25, 240, 119, 137, 199, 48, 76, 125, 251, 227, 175, 241,
+  191, 42, 225, 31, 147, 233, 98, 5, 159, 174, 46, 31, 58, 252, 194, 211, 191,
+  173, 164, 156, 175, 148, 163, 62, 201, 164, 77, 110, 244, 9, 252, 62, 98,
+  56, 227, 131, 155, 50, 166, 232, 32, 191, 253, 81, 39, 225, 232, 233, 215,
+  107, 137, 242, 190, 149, 48, 230, 179, 146, 140, 68, 179, 2, 149, 253, 236,
+  90, 217, 212, 207, 53, 125, 225, 184, 223, 20, 201, 74, 218, 232, 111, 105,
+  54, 223, 40, 16, 255, 108, 244, 167, 179, 255, 222, 249, 247, 9, 179, 167,
+  171, 196, 219, 72, 9, 223, 70, 184, 251, 5, 82, 191, 116, 250, 201, 197,
+  95, 86, 18, 115, 66, 120, 249, 89, 197, 143, 43, 120, 9, 5, 63, 100, 49,
+  168, 51, 255, 60, 103, 57, 86, 87, 189, 159, 87, 169, 164, 34, 5, 221, 167,
+  21, 186, 254, 87, 88, 223, 3, 219, 8, 51, 109, 217, 130, 217, 8, 47, 32,
+  252, 144, 245, 49, 101, 240, 7, 19, 249, 246, 115, 143, 64, 237, 47, 60,
+  255, 45, 254, 175, 17, 110, 87, 172, 189, 183, 17, 100, 155, 200, 0, 127,
+  108, 152, 75, 120, 250, 183, 186, 223, 43, 207, 114, 115, 185, 238, 216,
+  225, 111, 234, 200, 225, 71, 18, 85, 180, 220, 235, 118, 119, 147, 71, 165,
+  188, 242, 14, 157, 121, 25, 254, 90, 20, 28, 82, 43, 195, 86, 158, 66, 213,
+  71, 80, 27, 16, 174, 36, 211, 124, 156, 83, 165, 23, 192, 249, 178, 46, 210,
+  80, 89, 80, 95, 0, 234, 219, 248, 196, 43, 190, 195, 232, 191, 215, 251,
+  234, 78, 94, 215, 122, 221, 109, 203, 178, 145, 2, 191, 104, 173, 223, 173,
+  138, 220, 162, 59, 173, 89, 209, 203, 223, 116, 144, 60, 204, 47, 130, 191,
+  48, 73, 107, 243, 188, 179, 221, 83, 34, 139, 153, 152, 248, 136, 136, 62,
+  74, 79, 194, 140, 151, 192, 246, 161, 129, 63, 53, 149, 96, 19, 39, 83, 151,
+  250, 141, 39, 152, 244, 225, 240, 135, 181, 159, 160, 46, 178, 28, 159, 224,
+  228, 95, 101, 254, 237, 243, 223, 239, 253, 6, 177, 220, 222, 101, 195, 38,
+  195, 239, 127, 234, 186, 249, 215, 238, 232, 111, 208, 233, 143, 37, 253,
+  28, 252, 200, 217, 151, 218, 252, 107, 177, 224, 11, 247, 118, 217, 197,
+  240, 20, 180, 28, 139, 138, 71, 126, 146, 236, 4, 249, 66, 243, 165, 44,
+  235, 41, 104, 75, 231, 216, 85, 162, 96, 133, 168, 246, 171, 153, 216, 170,
+  63, 30, 247, 66, 177, 63, 24, 50, 157, 123, 182, 201, 4, 4, 255, 190, 246,
+  175, 46, 128, 191, 213, 161, 218, 193, 157, 184, 58, 70, 185, 186, 110, 126,
+  114, 250, 183, 235, 74, 206, 159, 75, 241, 44, 117, 148, 123, 99, 89, 159,
+  76, 101, 135, 113, 109, 221, 81, 242, 41, 121, 228, 87, 136, 36, 191, 114,
+  39, 35, 161, 241, 121, 191, 64, 243, 167, 100, 79, 209, 76, 16, 125, 89,
+  57, 68, 223, 188, 254, 51, 106, 38, 135, 101, 101, 77, 233, 65, 225, 127,
+  234, 121, 159, 167, 46, 249, 63, 239, 245, 255, 55, 81, 182, 69, 214, 236,
+  232, 158, 228, 99, 135, 63, 114, 243, 171, 118, 191, 132, 126, 217, 193,
+  236, 148, 251, 252, 232, 232, 215, 18, 181, 91, 104, 105, 218, 63, 159, 164,
+  229, 5, 52, 124, 57, 211, 67, 228, 120, 146, 86, 63, 26, 63, 212, 187, 180,
+  176, 200, 67, 67, 143, 78, 248, 73, 70, 130, 157, 110, 203, 21, 64, 95, 40,
+  252, 73, 150, 2, 230, 252, 207, 142, 13, 237, 51, 36, 255, 10, 253, 222,
+  121, 255, 127, 218, 137, 62, 221, 0, 0, 126, 210, 226, 103, 9, 159, 112,
+  250, 183, 170, 228, 95, 69, 137, 253, 17, 90, 55, 245, 230, 22, 13, 72, 35,
+  204, 126, 122, 249, 251, 199, 191, 136, 214, 123, 105, 189, 159, 157, 126,
+  193, 76, 86, 150, 155, 90, 129, 192, 159, 233, 122, 238, 130, 159, 52, 33,
+  218, 31, 75, 56, 237, 67, 76, 94, 152, 147, 232, 28, 180, 28, 103, 176, 243,
+  103, 162, 63, 253, 252, 247, 254, 251, 245, 69, 124, 25, 58, 167, 184, 89,
+  181, 55, 28, 124, 233, 240, 175, 25, 250, 229, 78, 245, 174, 170, 131, 217,
+  191, 19, 126, 118, 249, 175, 215, 5, 140, 250, 17, 211, 131, 244, 249, 109,
+  232, 87, 136, 211, 40, 28, 126, 186, 81, 75, 56, 228, 19, 50, 63, 74, 246,
+  130, 142, 82, 92, 106, 2, 124, 89, 115, 32, 244, 128, 198, 253, 108, 236,
+  135, 117, 133, 93, 242, 223, 126, 234, 89, 24, 250, 245, 197, 159, 246, 244,
+  159, 247, 255, 98, 215, 219, 191, 137, 242, 123, 248, 209, 143, 222, 252,
+  107, 112, 244, 55, 244, 244, 199, 90, 125, 244, 222, 175, 152, 95, 67, 29,
+  117, 31, 229, 246, 226, 180, 161, 85, 69, 103, 186, 69, 244, 37, 13, 130,
+  238, 154, 143, 143, 254, 22, 208, 204, 5, 199, 126, 25, 146, 150, 143, 194,
+  159, 195, 6, 244, 140, 83, 126, 80, 229, 199, 148, 254, 128, 164, 188, 235,
+  60, 44, 2, 241, 195, 220, 254, 58, 249, 239, 245, 250, 191, 178, 150, 14,
+  127, 35, 216, 49, 93, 228, 240, 199, 186, 188, 97, 11, 52, 62, 221, 47, 119,
+  139, 120, 16, 205, 246, 136, 138, 79, 45, 40, 215, 197, 72, 236, 182, 236,
+  95, 144, 155, 63, 191, 8, 250, 81, 82, 106, 212, 72, 186, 138, 205, 120,
+  17, 129, 97, 193, 85, 2, 110, 204, 16, 142, 76, 41, 229, 103, 74, 172, 68,
+  103, 204, 73, 212, 26, 74, 193, 235, 255, 220, 214, 126, 219, 213, 255, 207,
+  8, 193, 95, 170, 243, 237, 146, 112, 232, 236, 242, 194, 172, 111, 179, 105,
+  64, 185, 135, 171, 182, 146, 48, 154, 255, 149, 70, 43, 62, 114, 181, 63,
+  82, 211, 18, 198, 186, 16, 191, 59, 226, 44, 88, 17, 77, 151, 110, 149, 225,
+  70, 39, 127, 88, 219, 3, 139, 251, 8, 108, 47, 56, 232, 133, 148, 70, 236,
+  55, 32, 243, 38, 228, 126, 32, 247, 167, 218, 98, 11, 120, 252, 237, 243,
+  175, 240, 239, 253, 135, 148, 227, 45, 132, 254, 27, 89, 173, 121, 23, 185,
+  111, 77, 142, 190, 110, 248, 69, 213, 219, 234, 152, 126, 23, 85, 237, 238,
+  60, 251, 114, 193, 7, 239, 236, 66, 14, 251, 98, 182, 162, 85, 244, 244,
+  215, 177, 154, 159, 251, 90, 3, 213, 7, 207, 120, 49, 47, 209, 76, 150, 24,
+  4, 207, 191, 150, 25, 201, 189, 198, 43, 168, 251, 77, 227, 94, 162, 160,
+  246, 208, 6, 255, 39, 166, 244, 171, 241, 87, 199, 95, 61, 255, 189, 191,
+  64, 37, 187, 154, 104, 123, 23, 26, 49, 239, 56, 252, 98, 224, 183, 221,
+  212, 113, 213, 86, 65, 183, 147, 62, 166, 17, 179, 158, 186, 137, 195, 31,
+  238, 254, 240, 231, 42, 163, 240, 139, 35, 253, 209, 89, 196, 186, 170, 100,
+  38, 186, 223, 169, 5, 225, 122, 44, 17, 217, 7, 105, 139, 51, 177, 9, 246,
+  42, 169, 239, 43, 78, 249, 224, 243, 62, 200, 71, 222, 199, 159, 78, 240,
+  211, 224, 223, 179, 231, 191, 223, 251, 249, 47, 0, 127, 124, 146, 87, 74,
+  248, 215, 228, 236, 235, 134, 31, 174, 246, 149, 157, 243, 124, 236, 58,
+  101, 162, 237, 29, 244, 222, 168, 254, 124, 13, 56, 85, 49, 130, 175, 172,
+  64, 33, 218, 10, 114, 74, 82, 248, 74, 87, 178, 172, 31, 226, 250, 198, 18,
+  63, 22, 147, 170, 239, 11, 36, 244, 17, 208, 159, 66, 210, 135, 104, 41,
+  178, 60, 3, 165, 127, 131, 191, 126, 254, 123, 255, 102, 135, 51, 15, 227,
+  246, 116, 105, 118, 118, 159, 254, 173, 109, 247, 87, 84, 188, 177, 235,
+  234, 223, 37, 218, 94, 199, 229, 106, 229, 98, 118, 179, 222, 52, 129, 227,
+  41, 146, 251, 139, 200, 104, 79, 132, 157, 32, 240, 17, 253, 215, 90, 242,
+  208, 47, 147, 156, 164, 115, 62, 232, 35, 60, 75, 234, 107, 154, 79, 240,
+  184, 199, 12, 206, 123, 193, 121, 159, 57, 157, 52, 91, 157, 193, 206, 159,
+  78, 254, 52, 252, 253, 63, 141, 137, 189, 141, 92, 228, 143, 41, 184, 176,
+  167, 95, 188, 248, 109, 195, 239, 130, 178, 173, 66, 32, 93, 239, 148, 113,
+  217, 85, 237, 247, 171, 240, 1, 150, 128, 126, 199, 108, 143, 16, 175, 210,
+  196, 175, 34, 249, 233, 106, 197, 101, 253, 50, 28, 250, 67, 182, 71, 22,
+  181, 145, 247, 175, 210, 76, 158, 246, 17, 173, 132, 33, 254, 237, 215, 112,
+  14, 110, 127, 219, 250, 211, 248, 255, 244, 58, 34, 226, 66, 122, 60, 81,
+  205, 206, 104, 163, 135, 94, 254, 81, 17, 159, 221, 5, 159, 112, 240, 133,
+  78, 223, 69, 154, 61, 126, 85, 146, 117, 7, 25, 234, 45, 118, 163, 223, 45,
+  62, 96, 190, 212, 202, 157, 126, 172, 237, 33, 235, 186, 102, 114, 217, 135,
+  232, 203, 170, 196, 223, 231, 126, 51, 194, 248, 156, 81, 39, 97, 143, 191,
+  250, 18, 206, 253, 208, 71, 192, 191, 133, 191, 247, 199, 201, 201, 111,
+  162, 222, 44, 17, 213, 198, 174, 70, 15, 216, 0, 85, 172, 214, 95, 117, 208,
+  187, 152, 67, 103, 228, 248, 75, 194, 53, 66, 58, 187, 81, 143, 127, 209,
+  121, 194, 168, 142, 43, 239, 246, 8, 36, 95, 169, 60, 169, 92, 100, 112,
+  230, 151, 113, 113, 151, 152, 194, 44, 55, 22, 208, 95, 94, 14, 248, 126,
+  56, 243, 135, 94, 178, 220, 77, 84, 125, 13, 61, 207, 250, 182, 204, 143,
+  158, 170, 254, 246, 251, 127, 168, 155, 218, 139, 8, 62, 209, 122, 31, 31,
+  234, 128, 57, 191, 97, 123, 72, 234, 125, 112, 168, 143, 158, 164, 74, 182,
+  106, 18, 185, 221, 172, 222, 15, 226, 126, 88, 202, 108, 186, 101, 28, 203,
+  152, 101, 115, 68, 129, 162, 238, 130, 191, 90, 17, 23, 87, 238, 37, 156,
+  75, 108, 31, 172, 53, 131, 110, 166, 149, 47, 250, 78, 121, 229, 199, 141,
+  252, 128, 195, 15, 73, 103, 125, 51, 245, 113, 14, 147, 255, 246, 252, 247,
+  127, 127, 167, 82, 251, 6, 239, 128, 29, 195, 188, 114, 216, 167, 126, 222,
+  173, 224, 37, 139, 54, 203, 230, 236, 245, 142, 135, 191, 65, 240, 195, 199,
+  191, 232, 100, 120, 34, 134, 183, 40, 61, 86, 75, 198, 114, 98, 103, 178,
+  201, 87, 238, 242, 103, 94, 94, 216, 79, 50, 99, 232, 179, 106, 164, 37,
+  159, 47, 208, 168, 159, 148, 249, 139, 86, 210, 122, 27, 246, 241, 235, 111,
+  163, 191, 126, 255, 159, 238, 152, 232, 220, 116, 49, 188, 58, 70, 186, 216,
+  6, 136, 137, 56, 209, 89, 153, 110, 249, 70, 62, 214, 35, 232, 85, 10, 205,
+  30, 255, 71, 42, 169, 160, 67, 148, 224, 219, 169, 229, 87, 85, 23, 209,
+  28, 211, 231, 30, 177, 252, 37, 35, 113, 160, 235, 202, 76, 165, 80, 61,
+  66, 125, 109, 115, 64, 247, 52, 232, 79, 81, 211, 15, 53, 126, 150, 216,
+  74, 124, 224, 27, 127, 166, 244, 123, 174, 225, 239, 245, 255, 177, 181,
+  72, 246, 147, 36, 60, 152, 96, 119, 71, 205, 7, 222, 253, 27, 220, 50, 165,
+  228, 126, 8, 63, 123, 247, 187, 133, 155, 47, 212, 235, 243, 127, 166, 170,
+  192, 110, 173, 49, 91, 225, 168, 234, 104, 45, 13, 247, 69, 224, 47, 160,
+  168, 23, 178, 18, 23, 253, 68, 11, 60, 123, 64, 234, 126, 246, 94, 154, 113,
+  153, 39, 147, 249, 219, 167, 223, 103, 127, 128, 113, 232, 72, 103, 3, 19,
+  253, 121, 222, 143, 59, 255, 191, 187, 99, 176, 99, 195, 52, 92, 118, 142,
+  242, 11, 119, 255, 58, 38, 217, 29, 151, 108, 111, 162, 110, 77, 187, 42,
+  62, 13, 155, 93, 243, 127, 156, 70, 58, 251, 69, 228, 234, 135, 98, 126,
+  221, 69, 234, 72, 99, 154, 202, 122, 81, 59, 15, 38, 240, 33, 246, 162, 112,
+  19, 26, 38, 254, 33, 243, 7, 124, 95, 216, 246, 199, 131, 198, 203, 225,
+  25, 160, 125, 250, 215, 191, 223, 255, 161, 168, 120, 95, 12, 253, 104, 193,
+  79, 220, 0, 219, 117, 71, 0, 5, 37, 82, 234, 232, 195, 223, 37, 228, 130,
+  163, 254, 40, 133, 113, 99, 51, 255, 162, 91, 198, 17, 11, 16, 137, 26, 20,
+  210, 4, 50, 83, 157, 106, 143, 63, 155, 238, 101, 102, 194, 120, 236, 28,
+  114, 144, 192, 151, 7, 239, 165, 124, 34, 195, 63, 155, 71, 220, 100, 97,
+  243, 105, 104, 95, 255, 51, 219, 248, 213, 201, 95, 139, 255, 15, 70, 102,
+  59, 184, 134, 71, 199, 195, 191, 222, 196, 174, 254, 246, 244, 75, 47, 127,
+  23, 99, 50, 134, 126, 221, 68, 58, 125, 124, 110, 89, 144, 160, 223, 72,
+  213, 126, 217, 184, 169, 131, 226, 93, 71, 70, 144, 155, 186, 198, 87, 21,
+  18, 116, 197, 161, 31, 152, 241, 50, 216, 103, 136, 231, 159, 71, 213, 70,
+  86, 114, 221, 207, 9, 189, 160, 218, 15, 133, 127, 57, 242, 240, 235, 198,
+  79, 79, 39, 127, 237, 250, 187, 119, 95, 254, 226, 233, 239, 60, 254, 219,
+  192, 245, 226, 84, 73, 58, 219, 19, 17, 111, 228, 243, 252, 145, 137, 94,
+  129, 223, 217, 176, 253, 188, 41, 5, 195, 62, 201, 189, 33, 38, 64, 181,
+  195, 90, 140, 52, 166, 75, 100, 225, 11, 105, 222, 43, 248, 242, 51, 174,
+  103, 46, 118, 35, 236, 90, 78, 35, 140, 175, 25, 59, 253, 139, 69, 80, 151,
+  51, 27, 96, 20, 130, 127, 123, 251, 27, 252, 55, 235, 88, 213, 191, 11, 125,
+  2, 62, 238, 241, 195, 183, 95, 150, 113, 170, 187, 84, 187, 155, 184, 79,
+  99, 252, 238, 143, 153, 14, 110, 124, 236, 71, 231, 122, 228, 153, 126, 162,
+  232, 98, 194, 150, 186, 234, 50, 151, 106, 132, 25, 212, 140, 15, 120, 173,
+  168, 183, 72, 78, 4, 103, 242, 168, 198, 168, 253, 202, 230, 64, 229, 7,
+  24, 60, 68, 188, 196, 23, 120, 214, 112, 226, 21, 127, 52, 237, 71, 239,
+  128, 65, 111, 208, 207, 215, 187, 143, 127, 36, 242, 147, 142, 255, 22, 62,
+  253, 154, 237, 17, 81, 240, 139, 13, 243, 55, 23, 112, 233, 92, 11, 19, 253,
+  112, 102, 153, 211, 87, 155, 200, 217, 138, 186, 202, 119, 72, 121, 242,
+  246, 84, 67, 147, 212, 10, 22, 253, 50, 158, 247, 249, 163, 159, 229, 84,
+  114, 68, 108, 70, 153, 77, 57, 157, 78, 161, 189, 15, 152, 244, 213, 15,
+  0, 182, 147, 165, 158, 82, 99, 154, 251, 155, 227, 63, 152, 137, 74, 78,
+  60, 219, 191, 104, 183, 103, 11, 240, 111, 0, 179, 191, 174, 118, 140, 243,
+  115, 21, 167, 142, 94, 223, 90, 30, 236, 138, 42, 84, 224, 177, 46, 82, 242,
+  137, 155, 203, 194, 108, 21, 135, 170, 85, 167, 250, 68, 134, 27, 126, 153,
+  8, 191, 199, 30, 146, 145, 34, 4, 100, 245, 117, 21, 32, 248, 155, 162, 170,
+  175, 196, 248, 93, 16, 141, 169, 9, 28, 250, 240, 248, 15, 250, 253, 216,
+  72, 191, 140, 63, 37, 248, 134, 95, 182, 12, 255, 6, 183, 249, 235, 42, 118,
+  245, 87, 187, 208, 231, 147, 61, 235, 216, 80, 175, 200, 96, 40, 34, 62,
+  237, 157, 230, 178, 93, 99, 253, 17, 83, 89, 27, 167, 84, 112, 190, 19, 95,
+  253, 68, 105, 178, 144, 188, 228, 133, 110, 148, 250, 194, 178, 233, 148,
+  48, 190, 236, 217, 119, 172, 15, 68, 250, 192, 110, 210, 203, 213, 212, 141,
+  252, 218, 210, 127, 251, 77, 93, 255, 131, 163, 117, 124, 172, 115, 19, 151,
+  113, 138, 215, 124, 182, 238, 167, 70, 224, 202, 49, 248, 195, 105, 106,
+  46, 170, 226, 197, 45, 104, 59, 201, 139, 234, 241, 103, 150, 109, 130, 160,
+  71, 84, 211, 99, 119, 197, 143, 14, 162, 228, 36, 246, 195, 37, 223, 136,
+  175, 148, 192, 246, 11, 95, 160, 250, 202, 150, 128, 239, 53, 197, 26, 143,
+  156, 243, 179, 160, 234, 194, 19, 21, 252, 247, 76, 227, 95, 241, 190, 250,
+  230, 250, 239, 63, 185, 192, 219, 127, 1, 29, 31, 12, 189, 145, 118, 169,
+  98, 10, 142, 29, 141, 211, 11, 52, 123, 168, 39, 109, 228, 238, 15, 29, 204,
+  58, 234, 211, 126, 33, 134, 47, 43, 249, 97, 177, 97, 126, 85, 213, 145,
+  249, 206, 60, 139, 84, 125, 112, 75, 130, 56, 201, 187, 162, 68, 181, 64,
+  85, 223, 25, 236, 249, 205, 177, 165, 96, 152, 57, 10, 85, 136, 169, 139,
+  253, 65, 237, 167, 133, 127, 240, 177, 52, 221, 213, 137, 62, 141, 250, 214,
+  52, 234, 115, 60, 239, 29, 58, 78, 59, 198, 185, 69, 179, 54, 193, 152, 50,
+  214, 234, 245, 127, 150, 38, 151, 203, 189, 49, 134, 111, 156, 157, 20, 77,
+  85, 240, 86, 205, 173, 129, 115, 168, 248, 7, 89, 63, 38, 233, 141, 102,
+  60, 115, 88, 246, 241, 214, 199, 118, 248, 4, 158, 125, 171, 241, 235, 53,
+  30, 231, 148, 242, 181, 160, 234, 210, 83, 83, 248, 55, 149, 95, 128, 255,
+  157, 14, 233, 102, 204, 240, 20, 90, 189, 235, 200, 213, 175, 152, 158, 221,
+  86, 77, 60, 142, 106, 46, 226, 208, 28, 115, 31, 38, 240, 163, 63, 9, 97,
+  249, 97, 95, 233, 178, 18, 225, 231, 52, 47, 142, 127, 35, 93, 254, 237,
+  79, 117, 199, 128, 31, 77, 251, 11, 46, 52, 234, 235, 62, 144, 133, 166,
+  195, 63, 7, 254, 20, 101, 254, 238, 233, 7, 133, 31, 82, 251, 209, 107, 102,
+  27, 63, 230, 248, 247, 109, 244, 55, 232, 223, 88, 119, 165, 254, 29, 232,
+  175, 35, 97, 191, 254, 81, 115, 154, 71, 231, 96, 23, 207, 161, 57, 191,
+  123, 221, 61, 220, 17, 105, 95, 201, 143, 127, 201, 141, 134, 112, 193, 207,
+  231, 43, 188, 73, 81, 225, 175, 151, 125, 185, 133, 31, 240, 99, 68, 63,
+  42, 233, 77, 58, 62, 80, 111, 140, 137, 204, 230, 80, 221, 29, 95, 255, 116,
+  216, 211, 231, 254, 8, 255, 158, 99, 253, 245, 122, 254, 245, 31, 12, 222,
+  69, 247, 127, 84, 201, 101, 87, 197, 127, 203, 225, 239, 8, 252, 186, 122,
+  39, 177, 145, 222, 136, 63, 77, 164, 220, 235, 255, 36, 85, 100, 184, 71,
+  200, 249, 119, 244, 123, 196, 76, 85, 160, 163, 163, 110, 31, 25, 240, 132,
+  101, 159, 66, 156, 240, 46, 34, 134, 178, 229, 106, 138, 174, 126, 60, 234,
+  205, 10, 63, 84, 102, 44, 155, 157, 3, 210, 183, 195, 191, 221, 0, 111, 200,
+  242, 205, 56, 225, 151, 56, 190, 194, 6, 112, 63, 154, 82, 126, 64, 59, 216,
+  253, 141, 216, 235, 169, 119, 20, 252, 226, 205, 30, 183, 137, 155, 28, 189,
+  171, 4, 255, 42, 146, 244, 119, 117, 251, 170, 248, 215, 171, 191, 220, 98,
+  229, 79, 191, 196, 244, 99, 67, 94, 156, 131, 14, 191, 196, 80, 142, 92,
+  4, 83, 111, 52, 235, 69, 202, 190, 11, 166, 46, 110, 174, 163, 121, 24, 249,
+  81, 27, 96, 96, 143, 255, 224, 245, 152, 109, 199, 134, 109, 0, 134, 254,
+  26, 20, 125, 45, 246, 154, 231, 29, 25, 233, 141, 178, 251, 155, 58, 150,
+  243, 215, 59, 42, 62, 130, 221, 56, 230, 45, 21, 92, 198, 85, 40, 247, 138,
+  240, 119, 27, 140, 225, 65, 36, 176, 89, 89, 187, 111, 69, 244, 188, 51,
+  168, 232, 142, 93, 5, 145, 202, 52, 249, 2, 231, 174, 240, 55, 167, 42, 79,
+  148, 242, 5, 181, 6, 60, 245, 12, 224, 111, 146, 127, 139, 255, 215, 59,
+  130, 191, 139, 177, 60, 183, 228, 248, 215, 210, 124, 108, 76, 185, 89, 10,
+  252, 58, 77, 122, 197, 164, 63, 6, 255, 70, 158, 237, 42, 202, 152, 128,
+  119, 41, 127, 217, 145, 112, 69, 170, 80, 149, 16, 253, 85, 196, 75, 62,
+  223, 193, 66, 46, 16, 7, 213, 208, 103, 102, 238, 253, 159, 195, 194, 15,
+  48, 149, 92, 114, 63, 113, 80, 134, 90, 156, 147, 198, 239, 64, 227, 63,
+  124, 185, 187, 238, 27, 173, 250, 201, 248, 107, 248, 203, 42, 162, 138,
+  22, 51, 236, 33, 106, 30, 108, 170, 51, 158, 245, 201, 51, 43, 254, 79, 81,
+  209, 126, 95, 76, 203, 171, 138, 249, 246, 85, 93, 178, 131, 82, 142, 42,
+  151, 252, 41, 254, 59, 205, 228, 11, 42, 52, 89, 0, 115, 151, 57, 180, 246,
+  100, 140, 191, 5, 202, 252, 28, 247, 108, 233, 39, 190, 123, 62, 248, 87,
+  235, 239, 108, 58, 240, 223, 68, 41, 254, 2, 254, 24, 254, 146, 112, 188,
+  46, 226, 212, 119, 129, 172, 143, 201, 84, 10, 245, 94, 31, 192, 212, 34,
+  195, 159, 234, 185, 72, 73, 191, 216, 160, 20, 4, 72, 216, 87, 91, 128, 171,
+  127, 133, 6, 60, 145, 160, 119, 183, 177, 24, 211, 153, 109, 191, 103, 179,
+  25, 54, 119, 161, 148, 159, 101, 152, 246, 132, 118, 242, 153, 41, 69, 100,
+  139, 222, 121, 168, 252, 2, 252, 255, 214, 166, 51, 245, 219, 37, 226, 136,
+  175, 254, 173, 154, 241, 194, 28, 191, 58, 78, 154, 136, 42, 183, 11, 195,
+  29, 23, 40, 249, 48, 248, 27, 54, 221, 35, 140, 246, 137, 99, 41, 59, 162,
+  213, 166, 142, 206, 33, 66, 154, 39, 212, 116, 204, 160, 210, 44, 145, 116,
+  143, 216, 202, 21, 168, 21, 189, 130, 153, 191, 85, 121, 160, 124, 255, 37,
+  182, 21, 68, 252, 147, 37, 200, 253, 194, 235, 63, 24, 252, 250, 38, 162,
+  235, 113, 65, 244, 37, 248, 203, 238, 122, 111, 181, 51, 240, 171, 47, 202,
+  238, 110, 58, 106, 151, 107, 129, 233, 33, 150, 251, 101, 69, 15, 178, 97,
+  171, 24, 37, 25, 125, 181, 37, 112, 240, 163, 44, 255, 172, 67, 98, 62, 62,
+  121, 238, 190, 194, 197, 108, 6, 155, 254, 115, 72, 248, 153, 243, 194, 207,
+  146, 152, 11, 172, 86, 174, 244, 231, 250, 126, 6, 255, 225, 255, 178, 233,
+  60, 254, 177, 186, 207, 150, 226, 191, 11, 254, 238, 123, 116, 103, 179,
+  47, 78, 243, 137, 150, 174, 67, 62, 205, 187, 189, 216, 104, 44, 150, 245,
+  69, 155, 189, 88, 114, 22, 236, 128, 24, 215, 3, 107, 58, 199, 47, 255, 152,
+  181, 84, 27, 254, 185, 162, 31, 213, 120, 155, 47, 56, 227, 111, 73, 220,
+  5, 218, 47, 104, 233, 131, 255, 30, 132, 127, 240, 215, 54, 49, 248, 65,
+  190, 207, 213, 219, 183, 95, 28, 254, 168, 130, 103, 167, 113, 67, 252, 240,
+  55, 81, 231, 57, 253, 173, 148, 208, 47, 34, 198, 77, 85, 103, 185, 191,
+  138, 247, 40, 240, 23, 91, 114, 65, 79, 209, 86, 22, 18, 145, 145, 199, 64,
+  100, 242, 188, 170, 138, 128, 63, 148, 120, 132, 77, 255, 197, 114, 73, 109,
+  5, 129, 212, 212, 138, 84, 254, 29, 254, 127, 69, 116, 109, 99, 194, 237,
+  107, 46, 224, 75, 110, 127, 14, 191, 143, 252, 59, 159, 126, 250, 240, 215,
+  68, 191, 55, 82, 240, 107, 118, 144, 150, 170, 46, 244, 229, 102, 95, 141,
+  3, 127, 28, 170, 82, 249, 33, 193, 79, 190, 89, 147, 192, 31, 123, 184, 102,
+  84, 207, 95, 112, 150, 43, 61, 221, 135, 148, 164, 115, 152, 249, 207, 120,
+  221, 207, 79, 123, 173, 248, 200, 185, 249, 102, 70, 62, 108, 233, 223, 62,
+  254, 195, 193, 224, 47, 201, 195, 221, 246, 252, 199, 224, 167, 29, 191,
+  8, 252, 232, 28, 197, 250, 61, 244, 232, 215, 205, 5, 165, 156, 186, 224,
+  111, 98, 205, 222, 162, 195, 178, 179, 38, 35, 41, 23, 85, 32, 241, 199,
+  95, 144, 243, 101, 68, 79, 38, 239, 32, 20, 125, 120, 116, 186, 162, 18,
+  79, 120, 214, 119, 137, 41, 127, 80, 113, 194, 21, 34, 97, 223, 183, 111,
+  224, 111, 55, 192, 240, 191, 22, 69, 189, 118, 234, 56, 110, 89, 234, 23,
+  129, 95, 86, 243, 137, 106, 56, 10, 21, 223, 152, 132, 167, 253, 89, 150,
+  38, 17, 51, 170, 98, 167, 95, 111, 7, 45, 149, 125, 209, 244, 235, 93, 55,
+  153, 216, 240, 97, 38, 190, 52, 237, 23, 104, 200, 21, 250, 26, 43, 69, 254,
+  8, 226, 222, 51, 252, 248, 47, 177, 210, 19, 114, 21, 4, 61, 104, 210, 247,
+  237, 235, 211, 63, 28, 254, 23, 178, 166, 27, 138, 249, 99, 28, 127, 126,
+  250, 35, 10, 190, 81, 199, 166, 216, 213, 207, 15, 63, 101, 247, 227, 73,
+  117, 42, 74, 86, 178, 152, 170, 232, 110, 245, 199, 114, 85, 153, 153, 200,
+  138, 84, 250, 169, 170, 72, 213, 39, 151, 58, 62, 96, 202, 167, 132, 22,
+  19, 188, 46, 137, 124, 37, 231, 136, 238, 9, 175, 255, 37, 225, 124, 197,
+  164, 198, 44, 250, 58, 247, 243, 209, 223, 112, 248, 75, 255, 175, 194, 127,
+  81, 73, 7, 254, 244, 71, 60, 155, 98, 99, 125, 77, 167, 24, 113, 5, 25, 212,
+  140, 232, 33, 70, 254, 36, 234, 175, 228, 6, 21, 166, 166, 144, 167, 42,
+  11, 117, 31, 234, 222, 158, 65, 166, 39, 49, 151, 146, 138, 126, 84, 107,
+  178, 32, 100, 239, 112, 249, 207, 129, 189, 200, 2, 43, 140, 47, 195, 212,
+  105, 251, 163, 111, 82, 63, 152, 251, 43, 252, 255, 35, 201, 192, 69, 40,
+  247, 175, 163, 68, 47, 25, 126, 185, 116, 90, 69, 238, 81, 240, 183, 89,
+  71, 204, 26, 229, 110, 15, 53, 31, 50, 177, 95, 199, 88, 47, 44, 251, 117,
+  218, 182, 237, 232, 79, 146, 196, 111, 173, 143, 63, 62, 253, 50, 250, 113,
+  169, 225, 192, 247, 96, 149, 137, 12, 177, 125, 23, 115, 226, 238, 179, 32,
+  133, 31, 38, 49, 223, 46, 29, 252, 133, 220, 175, 63, 52, 248, 255, 251,
+  200, 192, 5, 242, 124, 47, 0, 191, 143, 252, 227, 222, 13, 209, 56, 10, 211,
+  102, 184, 148, 27, 98, 247, 54, 17, 244, 197, 196, 181, 166, 109, 244, 144,
+  242, 151, 93, 173, 126, 30, 173, 10, 131, 157, 241, 97, 36, 169, 234, 195,
+  140, 156, 114, 81, 109, 212, 63, 82, 21, 82, 154, 13, 55, 212, 106, 70, 224,
+  231, 42, 63, 65, 102, 122, 197, 231, 14, 219, 213, 135, 125, 191, 190, 57,
+  253, 45, 254, 127, 62, 166, 235, 244, 133, 224, 143, 57, 183, 212, 187, 68,
+  60, 99, 87, 63, 195, 63, 18, 248, 75, 116, 213, 162, 107, 176, 79, 18, 242,
+  140, 107, 121, 73, 14, 115, 145, 6, 69, 37, 176, 188, 165, 134, 15, 145,
+  117, 148, 46, 41, 94, 149, 94, 208, 73, 159, 57, 206, 252, 16, 252, 240,
+  240, 135, 144, 164, 111, 94, 127, 189, 1, 92, 242, 55, 26, 12, 127, 62, 226,
+  220, 135, 131, 254, 117, 132, 233, 181, 181, 92, 63, 185, 236, 67, 195, 254,
+  70, 214, 239, 110, 232, 104, 231, 186, 105, 190, 104, 197, 15, 192, 95, 98,
+  162, 87, 68, 198, 179, 140, 191, 253, 81, 241, 177, 88, 166, 178, 54, 199,
+  63, 212, 251, 101, 248, 125, 224, 151, 119, 194, 47, 17, 17, 41, 223, 7,
+  103, 254, 17, 202, 15, 158, 62, 25, 128, 212, 223, 6, 255, 237, 241, 31,
+  254, 91, 130, 188, 7, 47, 247, 174, 99, 79, 191, 135, 63, 166, 134, 47, 241,
+  188, 224, 227, 47, 137, 120, 50, 118, 255, 5, 147, 126, 20, 251, 137, 70,
+  237, 81, 167, 57, 202, 75, 221, 9, 63, 110, 78, 43, 35, 89, 198, 242, 206,
+  2, 217, 163, 160, 254, 82, 161, 234, 211, 9, 191, 253, 26, 75, 42, 239, 42,
+  51, 126, 144, 220, 24, 110, 67, 175, 242, 126, 31, 149, 126, 236, 245, 63,
+  252, 215, 227, 254, 77, 130, 164, 219, 86, 104, 249, 84, 85, 151, 9, 90,
+  76, 210, 163, 75, 199, 79, 176, 233, 166, 34, 37, 155, 24, 252, 181, 24,
+  249, 87, 29, 147, 125, 29, 241, 74, 83, 215, 81, 185, 121, 253, 107, 40,
+  81, 230, 43, 10, 126, 71, 197, 63, 47, 34, 9, 10, 138, 78, 195, 23, 153,
+  139, 234, 190, 78, 224, 157, 242, 61, 73, 226, 111, 223, 165, 1, 238, 251,
+  90, 248, 135, 63, 179, 185, 192, 241, 23, 59, 126, 219, 48, 230, 17, 209,
+  198, 169, 184, 148, 151, 160, 226, 185, 67, 208, 69, 54, 163, 141, 233, 81,
+  214, 241, 132, 138, 159, 253, 178, 234, 154, 236, 149, 82, 149, 104, 141,
+  170, 20, 60, 188, 178, 72, 205, 71, 104, 249, 9, 79, 20, 124, 159, 86, 196,
+  211, 61, 212, 125, 48, 225, 199, 38, 127, 75, 65, 98, 62, 27, 2, 210, 167,
+  191, 253, 135, 195, 159, 230, 142, 237, 224, 248, 71, 248, 30, 97, 7, 52,
+  176, 230, 83, 197, 217, 178, 187, 12, 251, 46, 48, 213, 189, 51, 237, 91,
+  171, 221, 200, 21, 93, 56, 209, 99, 103, 169, 170, 235, 11, 22, 120, 105,
+  237, 119, 193, 193, 45, 235, 114, 23, 19, 67, 212, 138, 243, 208, 205, 215,
+  183, 16, 171, 190, 203, 5, 57, 254, 176, 244, 167, 99, 191, 12, 88, 12, 12,
+  92, 238, 239, 42, 191, 6, 255, 63, 33, 106, 251, 196, 241, 71, 119, 255,
+  118, 199, 229, 95, 197, 198, 250, 35, 167, 95, 176, 109, 250, 2, 113, 255,
+  38, 196, 126, 98, 189, 79, 242, 27, 170, 187, 183, 108, 87, 175, 23, 124,
+  193, 240, 248, 179, 138, 47, 117, 152, 65, 109, 105, 148, 247, 85, 164, 236,
+  231, 191, 70, 87, 247, 93, 224, 227, 191, 92, 44, 240, 164, 39, 74, 254,
+  73, 49, 114, 216, 235, 163, 224, 191, 221, 0, 163, 22, 255, 63, 34, 30, 127,
+  128, 251, 58, 206, 245, 194, 240, 215, 85, 164, 117, 246, 5, 78, 127, 196,
+  188, 225, 66, 113, 191, 18, 27, 137, 27, 182, 94, 212, 110, 72, 112, 151,
+  189, 0, 39, 85, 24, 237, 142, 74, 123, 80, 154, 119, 17, 35, 34, 187, 11,
+  170, 46, 28, 223, 115, 49, 103, 250, 158, 236, 248, 235, 217, 179, 37, 72,
+  252, 29, 254, 194, 235, 223, 110, 128, 63, 200, 44, 220, 40, 205, 155, 15,
+  121, 185, 243, 95, 99, 243, 142, 11, 75, 186, 68, 42, 40, 226, 225, 39, 111,
+  255, 38, 62, 164, 232, 99, 191, 56, 137, 166, 75, 122, 184, 138, 145, 83,
+  162, 95, 112, 24, 71, 169, 86, 196, 188, 23, 212, 251, 125, 195, 23, 142,
+  33, 240, 162, 63, 14, 79, 177, 98, 78, 174, 166, 124, 103, 190, 240, 179,
+  8, 182, 190, 40, 245, 195, 146, 83, 174, 25, 149, 3, 252, 7, 30, 127, 123,
+  251, 143, 134, 191, 95, 188, 254, 169, 154, 171, 72, 247, 104, 58, 71, 101,
+  56, 205, 107, 215, 233, 95, 199, 171, 62, 84, 205, 71, 132, 191, 129, 126,
+  173, 5, 139, 167, 133, 105, 116, 217, 176, 93, 34, 38, 118, 143, 33, 203,
+  53, 31, 72, 245, 100, 99, 8, 2, 35, 5, 203, 206, 0, 82, 194, 106, 30, 83,
+  248, 90, 44, 153, 175, 244, 106, 69, 108, 229, 237, 87, 54, 132, 125, 31,
+  189, 1, 212, 245, 63, 250, 49, 81, 220, 169, 67, 198, 221, 149, 252, 33,
+  252, 181, 156, 249, 117, 182, 78, 235, 120, 214, 119, 145, 130, 63, 166,
+  170, 168, 95, 214, 164, 143, 138, 31, 213, 14, 13, 178, 58, 54, 219, 43,
+  17, 125, 234, 53, 15, 83, 75, 209, 194, 173, 32, 21, 255, 156, 117, 123,
+  11, 145, 233, 203, 7, 80, 23, 168, 236, 39, 14, 122, 46, 37, 143, 137, 21,
+  240, 149, 214, 248, 7, 218, 199, 208, 30, 255, 209, 143, 70, 98, 255, 157,
+  68, 239, 53, 138, 251, 187, 226, 168, 102, 119, 32, 189, 142, 101, 253, 29,
+  5, 127, 170, 73, 212, 201, 241, 20, 149, 252, 42, 230, 46, 46, 31, 127, 242,
+  21, 211, 47, 182, 17, 4, 29, 11, 82, 247, 137, 168, 13, 147, 2, 21, 86, 157,
+  113, 95, 105, 233, 227, 126, 174, 240, 197, 24, 95, 68, 114, 202, 187, 203,
+  229, 35, 86, 250, 105, 207, 255, 104, 244, 35, 226, 188, 71, 76, 212, 47,
+  132, 126, 187, 78, 63, 201, 249, 101, 227, 166, 78, 239, 6, 153, 227, 27,
+  157, 80, 45, 163, 236, 121, 202, 244, 168, 165, 153, 180, 74, 162, 121, 117,
+  232, 79, 129, 175, 181, 8, 232, 11, 30, 94, 121, 212, 95, 46, 74, 70, 38,
+  183, 84, 14, 174, 126, 64, 248, 161, 232, 199, 224, 183, 247, 210, 200, 167,
+  126, 62, 248, 111, 143, 255, 240, 79, 124, 158, 214, 101, 94, 9, 255, 132,
+  127, 90, 9, 255, 180, 18, 254, 105, 37, 252, 211, 74, 248, 167, 149, 240,
+  79, 43, 225, 159, 86, 194, 63, 173, 132, 127, 90, 9, 255, 180, 18, 254, 105,
+  37, 252, 211, 74, 248, 167, 149, 240, 79, 43, 225, 159, 86, 194, 63, 173,
+  132, 127, 90, 9, 255, 180, 18, 254, 105, 253, 54, 196, 255, 75, 233, 239,
+  32, 225, 159, 86, 194, 63, 173, 132, 127, 90, 9, 255, 180, 18, 254, 105,
+  37, 252, 211, 74, 248, 167, 149, 240, 79, 43, 225, 159, 214, 239, 92, 252,
+  211, 6, 72, 248, 167, 149, 240, 79, 43, 225, 159, 86, 194, 63, 173, 132,
+  127, 90, 9, 255, 180, 46, 9, 254, 105, 3, 36, 252, 211, 74, 248, 167, 149,
+  240, 79, 43, 225, 159, 214, 37, 90, 255, 66, 194, 63, 225, 159, 86, 194,
+  63, 173, 132, 127, 90, 151, 18, 255, 180, 1, 18, 254, 105, 37, 252, 211,
+  74, 248, 167, 149, 240, 79, 43, 225, 159, 214, 37, 194, 63, 109, 128, 132,
+  127, 90, 9, 255, 180, 18, 254, 105, 37, 252, 211, 74, 248, 167, 149, 240,
+  79, 235, 146, 224, 159, 54, 64, 194, 63, 173, 132, 127, 90, 9, 255, 180,
+  18, 254, 105, 93, 50, 252, 211, 6, 72, 231, 63, 173, 75, 184, 254, 120, 58,
+  255, 9, 255, 132, 127, 194, 63, 173, 132, 127, 90, 9, 255, 180, 18, 254,
+  105, 37, 252, 211, 186, 84, 248, 167, 13, 144, 206, 127, 90, 233, 252, 167,
+  149, 240, 79, 43, 225, 159, 86, 194, 63, 173, 132, 127, 90, 151, 4, 255,
+  180, 1, 46, 227, 250, 82, 58, 255, 233, 252, 167, 13, 144, 240, 79, 240,
+  167, 243, 159, 86, 194, 63, 173, 203, 138, 127, 218, 0, 233, 252, 167, 149,
+  240, 79, 43, 221, 255, 105, 93, 150, 245, 199, 18, 254, 9, 255, 132, 127,
+  194, 63, 225, 127, 201, 241, 255, 60, 109, 128, 132, 127, 90, 151, 247, 254,
+  79, 248, 39, 252, 211, 74, 241, 95, 90, 9, 255, 180, 46, 33, 254, 105, 7,
+  164, 247, 63, 173, 132, 127, 90, 233, 254, 79, 43, 157, 255, 180, 46, 23,
+  254, 105, 3, 164, 243, 159, 86, 58, 255, 105, 165, 243, 159, 86, 138, 255,
+  211, 74, 247, 127, 90, 151, 232, 254, 79, 27, 32, 225, 159, 86, 138, 255,
+  210, 74, 239, 127, 90, 9, 255, 180, 46, 25, 254, 105, 7, 164, 248, 47, 173,
+  132, 127, 90, 151, 101, 253, 209, 244, 254, 39, 252, 19, 254, 9, 255, 180,
+  1, 46, 61, 254, 233, 111, 35, 225, 159, 86, 194, 63, 173, 132, 127, 90, 41,
+  254, 79, 43, 225, 159, 86, 194, 63, 173, 244, 254, 167, 149, 206, 127, 90,
+  9, 255, 180, 18, 254, 105, 37, 252, 211, 74, 241, 95, 90, 191, 195, 240,
+  79, 59, 224, 210, 173, 159, 74, 247, 127, 194, 63, 225, 159, 240, 79, 240,
+  39, 252, 211, 74, 248, 167, 149, 240, 79, 235, 114, 226, 159, 118, 64, 138,
+  255, 211, 74, 247, 127, 90, 151, 17, 255, 116, 253, 167, 251, 63, 173, 116,
+  255, 167, 149, 240, 79, 43, 225, 159, 86, 122, 255, 211, 74, 241, 127, 90,
+  233, 254, 79, 43, 157, 255, 180, 126, 7, 174, 63, 146, 206, 127, 194, 63,
+  225, 159, 240, 79, 248, 39, 252, 211, 74, 248, 167, 117, 89, 241, 79, 127,
+  25, 151, 28, 255, 180, 3, 46, 51, 254, 9, 254, 116, 254, 211, 74, 239, 127,
+  90, 233, 254, 79, 43, 225, 159, 86, 194, 63, 173, 244, 254, 167, 117, 41,
+  240, 79, 199, 255, 178, 223, 255, 105, 7, 92, 98, 252, 63, 79, 247, 127,
+  58, 255, 233, 175, 35, 189, 255, 105, 37, 252, 211, 186, 132, 239, 127, 218,
+  0, 9, 255, 180, 210, 253, 159, 214, 101, 90, 63, 153, 240, 79, 248, 167,
+  244, 63, 157, 255, 244, 87, 113, 185, 207, 127, 186, 255, 211, 249, 79, 235,
+  210, 226, 159, 142, 127, 194, 63, 173, 75, 140, 127, 218, 0, 9, 255, 180,
+  18, 254, 105, 93, 66, 252, 83, 250, 151, 242, 255, 180, 46, 45, 254, 233,
+  248, 167, 251, 63, 109, 128, 116, 254, 211, 186, 148, 248, 127, 158, 194,
+  255, 116, 255, 167, 149, 240, 79, 43, 225, 159, 214, 101, 195, 255, 243,
+  132, 255, 101, 143, 255, 18, 254, 9, 255, 180, 46, 115, 254, 159, 214, 165,
+  62, 255, 41, 255, 191, 172, 248, 127, 158, 154, 191, 233, 252, 167, 191,
+  135, 75, 157, 255, 165, 13, 112, 105, 215, 31, 78, 204, 239, 75, 142, 127,
+  250, 59, 72, 248, 167, 149, 240, 79, 43, 225, 159, 214, 165, 195, 63, 253,
+  21, 92, 114, 252, 211, 5, 144, 206, 127, 90, 233, 253, 79, 43, 225, 159,
+  86, 186, 255, 211, 74, 231, 63, 173, 116, 254, 211, 74, 248, 167, 149, 240,
+  79, 43, 225, 159, 86, 194, 63, 173, 223, 137, 235, 15, 165, 191, 130, 132,
+  127, 90, 9, 255, 180, 18, 254, 105, 37, 252, 211, 74, 248, 167, 149, 240,
+  79, 43, 225, 159, 86, 194, 63, 173, 132, 127, 90, 9, 255, 180, 18, 254, 105,
+  37, 252, 211, 74, 248, 167, 149, 240, 79, 43, 225, 159, 86, 194, 63, 173,
+  132, 127, 90, 9, 255, 180, 18, 254, 105, 253, 182, 91, 63, 145, 254, 10,
+  18, 254, 105, 37, 252, 211, 74, 248, 167, 149, 240, 79, 43, 225, 159, 86,
+  194, 63, 173, 132, 127, 90, 9, 255, 180, 18, 254, 105, 37, 252, 211, 74,
+  248, 167, 149, 240, 79, 43, 225, 159, 86, 194, 63, 173, 132, 127, 90, 9,
+  255, 180, 18, 254, 105, 37, 252, 211, 74, 248, 167, 149, 240, 79, 43, 225,
+  159, 86, 194, 63, 173, 132, 127, 90, 255, 191, 95, 127, 48, 253, 21, 36,
+  252, 211, 74, 248, 167, 149, 240, 79, 43, 225, 159, 86, 194, 63, 173, 132,
+  127, 90, 9, 255, 180, 18, 254, 105, 37, 252, 211, 74, 248, 167, 149, 240,
+  79, 43, 225, 159, 86, 194, 63, 173, 132, 127, 90, 9, 255, 180, 18, 254, 105,
+  37, 252, 211, 74, 248, 167, 149, 240, 79, 43, 225, 159, 86, 194, 63, 173,
+  132, 127, 90, 9, 255, 180, 18, 254, 105, 37, 252, 211, 74, 248, 167, 149,
+  240, 79, 43, 225, 159, 86, 194, 63, 173, 132, 127, 90, 9, 255, 180, 254,
+  63, 95, 255, 124, 250, 43, 72, 248, 167, 149, 240, 79, 43, 225, 159, 86,
+  194, 63, 173, 132, 127, 90, 9, 255, 180, 18, 254, 105, 37, 252, 211, 74,
+  248, 167, 149, 240, 79, 43, 225, 159, 86, 194, 63, 173, 132, 127, 90, 9,
+  255, 180, 18, 254, 105, 37, 252, 211, 74, 248, 167, 149, 240, 79, 43, 225,
+  159, 214, 111, 187, 245, 227, 233, 175, 32, 225, 159, 86, 194, 63, 173, 132,
+  127, 90, 9, 255, 180, 18, 254, 105, 37, 252, 211, 74, 248, 167, 149, 240,
+  79, 43, 225, 159, 86, 194, 63, 173, 132, 127, 90, 9, 255, 180, 18, 254, 105,
+  37, 252, 211, 74, 248, 167, 149, 240, 79, 43, 225, 159, 86, 194, 63, 173,
+  132, 127, 90, 9, 255, 180, 18, 254, 105, 37, 252, 211, 74, 248, 255, 223,
+  236, 189, 9, 188, 101, 89, 85, 30, 190, 207, 185, 239, 189, 154, 171, 186,
+  170, 186, 171, 171, 231, 129, 134, 22, 26, 100, 80, 132, 2, 19, 148, 31,
+  26, 53, 33, 63, 135, 160, 162, 168, 68, 18, 36, 24, 7, 130, 33, 42, 26, 163,
+  136, 65, 131, 56, 16, 4, 17, 17, 68, 230, 238, 48, 196, 33, 142, 145, 63,
+  17, 135, 102, 106, 193, 166, 7, 104, 122, 238, 170, 174, 174, 174, 121, 122,
+  245, 238, 61, 255, 51, 159, 61, 172, 105, 159, 123, 95, 247, 123, 247, 172,
+  93, 221, 111, 170, 122, 53, 220, 111, 237, 181, 190, 245, 173, 111, 239,
+  163, 107, 205, 175, 39, 233, 75, 160, 248, 235, 82, 252, 117, 41, 254, 186,
+  20, 127, 93, 138, 191, 46, 197, 95, 151, 226, 175, 75, 241, 215, 165, 248,
+  235, 82, 252, 117, 41, 254, 186, 20, 127, 93, 138, 191, 46, 197, 95, 151,
+  226, 175, 75, 241, 215, 165, 248, 235, 82, 252, 117, 41, 254, 186, 20, 127,
+  93, 138, 191, 46, 197, 95, 151, 226, 175, 75, 241, 215, 165, 248, 235, 82,
+  252, 117, 41, 254, 186, 20, 127, 93, 138, 191, 46, 197, 95, 215, 154, 88,
+  79, 212, 151, 64, 241, 215, 165, 248, 235, 82, 252, 117, 41, 254, 186, 20,
+  127, 93, 138, 191, 46, 197, 95, 151, 226, 175, 75, 241, 215, 165, 248, 235,
+  82, 252, 117, 41, 254, 186, 20, 127, 93, 138, 191, 46, 197, 95, 151, 226,
+  175, 75, 241, 215, 165, 248, 235, 82, 252, 117, 41, 254, 186, 20, 127, 93,
+  138, 191, 46, 197, 95, 151, 226, 175, 75, 241, 215, 165, 248, 235, 82, 252,
+  117, 41, 254, 186, 20, 127, 93, 138, 191, 46, 197, 95, 151, 226, 175, 75,
+  241, 215, 165, 248, 235, 82, 252, 117, 41, 254, 186, 20, 127, 93, 138, 191,
+  46, 197, 95, 151, 226, 175, 107, 85, 215, 117, 250, 18, 40, 254, 186, 20,
+  127, 93, 138, 191, 46, 197, 95, 151, 226, 175, 75, 241, 215, 165, 248, 235,
+  82, 252, 117, 41, 254, 186, 20, 127, 93, 138, 191, 46, 197, 95, 151, 226,
+  175, 75, 241, 215, 165, 248, 235, 82, 252, 117, 41, 254, 186, 20, 127, 93,
+  138, 191, 46, 197, 95, 151, 226, 175, 75, 241, 215, 165, 248, 235, 82, 252,
+  117, 41, 254, 186, 214, 236, 122, 130, 190, 4, 138, 191, 46, 197, 95, 151,
+  226, 175, 75, 241, 215, 165, 248, 235, 82, 252, 117, 41, 254, 186, 20, 127,
+  93, 138, 191, 46, 197, 95, 151, 226, 175, 75, 241, 215, 165, 248, 235, 82,
+  252, 117, 41, 254, 186, 20, 127, 93, 138, 191, 46, 197, 95, 151, 226, 175,
+  75, 241, 215, 165, 248, 235, 82, 252, 117, 41, 254, 186, 20, 127, 93, 138,
+  191, 46, 197, 95, 151, 226, 175, 75, 241, 215, 165, 248, 235, 82, 252, 117,
+  41, 254, 186, 20, 127, 93, 138, 191, 174, 71, 109, 61, 94, 95, 2, 197, 95,
+  151, 226, 175, 75, 241, 215, 165, 248, 235, 82, 252, 117, 41, 254, 186, 20,
+  127, 93, 138, 191, 46, 197, 95, 151, 226, 175, 75, 241, 215, 165, 248, 235,
+  82, 252, 117, 41, 254, 186, 20, 127, 93, 138, 191, 46, 197, 95, 151, 226,
+  175, 75, 241, 215, 165, 248, 235, 82, 252, 117, 41, 254, 186, 20, 127, 93,
+  138, 191, 46, 197, 95, 151, 226, 175, 75, 241, 215, 165, 248, 235, 82, 252,
+  117, 41, 254, 186, 20, 127, 93, 138, 191, 46, 197, 95, 151, 226, 175, 75,
+  241, 215, 165, 248, 235, 82, 252, 117, 41, 254, 186, 30, 145, 53, 73, 18,
+  163, 107, 184, 235, 225, 173, 105, 30, 1, 86, 12, 104, 56, 12, 106, 125,
+  250, 170, 13, 163, 36, 41, 146, 64, 34, 128, 95, 131, 99, 222, 214, 59, 158,
+  179, 125, 113, 148, 166, 69, 10, 104, 98, 32, 153, 18, 112, 13, 146, 117,
+  180, 94, 242, 178, 11, 54, 45, 142, 70, 73, 17, 1, 64, 8, 36, 171, 136, 174,
+  198, 201, 26, 88, 151, 190, 233, 138, 237, 27, 22, 23, 210, 60, 5, 36, 85,
+  18, 112, 99, 64, 150, 12, 86, 25, 74, 141, 148, 85, 91, 159, 252, 196, 117,
+  231, 111, 222, 176, 176, 48, 74, 147, 42, 2, 154, 0, 72, 194, 16, 72, 98,
+  97, 121, 132, 113, 211, 48, 137, 95, 63, 121, 122, 223, 222, 29, 155, 150,
+  138, 0, 168, 34, 160, 73, 2, 96, 8, 48, 125, 66, 178, 246, 113, 210, 24,
+  113, 215, 227, 174, 254, 166, 43, 118, 109, 217, 184, 148, 115, 128, 58,
+  5, 52, 73, 192, 75, 3, 137, 161, 146, 65, 50, 139, 151, 123, 45, 96, 51,
+  180, 248, 184, 237, 121, 223, 117, 237, 158, 109, 91, 54, 44, 45, 20, 1,
+  144, 86, 1, 96, 213, 129, 48, 4, 128, 92, 16, 83, 25, 146, 117, 140, 201,
+  28, 6, 199, 91, 190, 251, 135, 158, 124, 201, 206, 45, 155, 54, 84, 37, 160,
+  139, 0, 183, 14, 52, 49, 224, 132, 0, 156, 11, 146, 232, 215, 45, 89, 239,
+  104, 172, 227, 184, 248, 183, 47, 126, 213, 51, 174, 60, 127, 199, 230, 141,
+  121, 19, 176, 80, 101, 128, 150, 9, 242, 33, 192, 243, 130, 164, 215, 235,
+  149, 204, 1, 22, 235, 35, 40, 190, 230, 123, 95, 251, 156, 199, 238, 221,
+  185, 117, 83, 78, 1, 74, 14, 48, 74, 138, 20, 144, 182, 69, 160, 13, 128,
+  26, 123, 174, 26, 144, 13, 99, 210, 251, 165, 74, 230, 0, 139, 181, 24, 17,
+  23, 126, 243, 27, 191, 233, 9, 151, 156, 191, 61, 175, 0, 139, 139, 139,
+  85, 6, 104, 3, 160, 197, 223, 162, 2, 104, 8, 132, 185, 128, 41, 11, 201,
+  116, 175, 83, 178, 238, 209, 88, 19, 241, 240, 212, 223, 253, 182, 39, 95,
+  177, 103, 231, 214, 205, 155, 150, 150, 202, 18, 96, 213, 0, 167, 27, 8,
+  42, 65, 23, 2, 110, 4, 64, 169, 128, 175, 10, 51, 160, 140, 235, 58, 34,
+  30, 165, 63, 252, 216, 174, 119, 127, 247, 211, 31, 115, 209, 238, 237, 85,
+  5, 168, 2, 160, 172, 1, 109, 0, 184, 33, 224, 244, 4, 126, 8, 136, 82, 129,
+  164, 89, 72, 102, 241, 74, 37, 235, 117, 131, 62, 130, 127, 238, 131, 135,
+  63, 248, 3, 207, 126, 220, 165, 23, 156, 183, 109, 115, 222, 3, 228, 77,
+  64, 209, 6, 148, 69, 160, 12, 128, 134, 9, 10, 66, 128, 228, 133, 210, 162,
+  144, 196, 191, 30, 137, 153, 227, 120, 88, 245, 63, 241, 129, 27, 175, 127,
+  233, 215, 93, 119, 249, 133, 187, 182, 111, 205, 123, 128, 46, 3, 212, 1,
+  224, 232, 1, 65, 67, 0, 82, 66, 121, 38, 224, 36, 164, 30, 193, 16, 243,
+  130, 173, 171, 112, 88, 173, 63, 107, 255, 123, 174, 127, 249, 55, 60, 249,
+  234, 139, 206, 63, 111, 235, 150, 205, 27, 54, 44, 22, 25, 96, 52, 170, 105,
+  160, 21, 0, 29, 254, 30, 19, 72, 176, 16, 96, 73, 1, 81, 19, 196, 100, 113,
+  118, 202, 194, 58, 33, 15, 179, 254, 99, 14, 253, 252, 251, 126, 236, 155,
+  191, 234, 177, 151, 236, 217, 153, 39, 128, 162, 2, 20, 77, 64, 81, 2, 234,
+  26, 208, 20, 1, 175, 10, 56, 101, 0, 208, 7, 4, 153, 0, 73, 4, 2, 118, 208,
+  87, 108, 126, 196, 162, 33, 89, 63, 97, 112, 252, 197, 239, 124, 197, 243,
+  159, 113, 237, 229, 123, 119, 239, 216, 182, 165, 168, 0, 69, 19, 80, 103,
+  128, 81, 221, 8, 164, 110, 10, 176, 219, 1, 60, 4, 208, 8, 144, 151, 132,
+  105, 136, 226, 90, 137, 133, 100, 141, 71, 193, 185, 175, 123, 203, 43, 191,
+  109, 223, 117, 87, 94, 124, 126, 153, 0, 74, 10, 80, 102, 128, 154, 5, 186,
+  189, 160, 43, 10, 249, 140, 144, 171, 5, 83, 84, 132, 169, 122, 134, 25,
+  202, 141, 201, 26, 12, 133, 169, 126, 223, 197, 171, 223, 240, 202, 239,
+  248, 218, 39, 61, 230, 210, 61, 187, 202, 4, 80, 115, 192, 42, 3, 180, 53,
+  160, 173, 2, 77, 10, 104, 203, 128, 29, 0, 110, 83, 128, 215, 130, 169, 42,
+  130, 172, 101, 232, 29, 11, 143, 68, 94, 72, 214, 80, 12, 236, 216, 240,
+  154, 87, 188, 224, 57, 79, 121, 236, 101, 123, 119, 23, 9, 160, 172, 0, 75,
+  11, 85, 6, 104, 74, 128, 219, 10, 56, 101, 32, 64, 63, 129, 234, 64, 108,
+  34, 144, 21, 4, 33, 73, 124, 4, 66, 33, 89, 27, 129, 208, 231, 183, 187,
+  248, 240, 171, 126, 236, 59, 191, 254, 105, 215, 94, 113, 209, 158, 157,
+  69, 2, 216, 180, 177, 226, 128, 69, 6, 88, 104, 74, 64, 154, 184, 173, 128,
+  85, 6, 0, 85, 0, 106, 13, 163, 18, 65, 52, 51, 152, 54, 18, 102, 23, 10,
+  201, 163, 28, 7, 209, 191, 211, 99, 111, 125, 249, 15, 127, 231, 115, 159,
+  254, 248, 171, 46, 217, 179, 251, 188, 237, 91, 183, 108, 218, 180, 161,
+  14, 128, 81, 43, 4, 164, 29, 15, 180, 244, 0, 47, 7, 216, 33, 208, 2, 223,
+  47, 17, 196, 48, 131, 181, 26, 9, 143, 162, 113, 58, 234, 183, 121, 202,
+  39, 190, 239, 165, 223, 249, 188, 175, 121, 194, 99, 46, 187, 240, 130, 157,
+  219, 183, 149, 20, 176, 228, 128, 139, 35, 171, 15, 236, 50, 64, 74, 230,
+  0, 188, 45, 140, 73, 4, 84, 30, 144, 6, 194, 170, 71, 194, 234, 5, 66, 242,
+  72, 134, 192, 179, 255, 232, 219, 94, 252, 130, 231, 61, 227, 73, 215, 92,
+  126, 209, 158, 93, 231, 109, 219, 90, 82, 192, 13, 139, 29, 9, 108, 82, 64,
+  98, 177, 128, 86, 21, 70, 218, 129, 80, 28, 194, 149, 194, 89, 212, 131,
+  89, 4, 66, 111, 158, 176, 74, 166, 199, 71, 72, 143, 250, 23, 239, 126, 222,
+  247, 126, 251, 55, 60, 243, 43, 31, 119, 229, 197, 123, 242, 22, 48, 103,
+  0, 57, 5, 44, 117, 192, 197, 197, 182, 4, 88, 125, 64, 139, 191, 71, 5, 65,
+  54, 72, 37, 129, 136, 14, 81, 76, 16, 99, 123, 198, 71, 33, 16, 146, 71,
+  46, 10, 68, 223, 251, 237, 111, 121, 230, 191, 249, 214, 111, 216, 247, 228,
+  107, 175, 186, 100, 239, 249, 101, 2, 216, 180, 169, 12, 128, 197, 42, 3,
+  212, 37, 96, 4, 145, 0, 172, 29, 192, 234, 0, 52, 49, 242, 38, 71, 145, 253,
+  65, 191, 70, 97, 149, 3, 33, 153, 53, 174, 201, 42, 134, 192, 139, 126, 245,
+  73, 207, 127, 254, 243, 158, 245, 148, 175, 184, 250, 210, 139, 46, 216,
+  125, 94, 217, 2, 148, 61, 64, 81, 1, 234, 12, 80, 38, 128, 17, 80, 3, 146,
+  64, 18, 128, 235, 0, 153, 4, 88, 94, 136, 150, 3, 24, 253, 169, 68, 164,
+  25, 118, 144, 51, 14, 131, 85, 50, 73, 254, 208, 107, 174, 254, 198, 111,
+  121, 238, 179, 158, 242, 248, 107, 46, 187, 248, 194, 221, 59, 119, 148,
+  45, 64, 217, 3, 84, 20, 192, 82, 130, 10, 87, 64, 91, 3, 176, 28, 16, 214,
+  1, 148, 12, 132, 232, 139, 202, 1, 149, 5, 48, 236, 153, 46, 33, 121, 116,
+  227, 96, 117, 133, 6, 250, 123, 94, 241, 234, 11, 159, 243, 141, 207, 221,
+  247, 212, 39, 92, 115, 249, 37, 23, 94, 176, 107, 71, 147, 0, 202, 0, 88,
+  168, 218, 64, 171, 13, 72, 237, 145, 128, 51, 23, 96, 235, 0, 23, 1, 46,
+  248, 242, 238, 32, 166, 75, 88, 221, 56, 72, 30, 145, 40, 72, 102, 26, 0,
+  175, 126, 229, 246, 103, 62, 247, 235, 158, 249, 212, 235, 174, 185, 242,
+  210, 189, 69, 1, 216, 94, 180, 0, 77, 5, 40, 57, 160, 211, 6, 4, 130, 176,
+  147, 2, 144, 150, 16, 8, 2, 172, 41, 240, 118, 127, 68, 147, 24, 81, 22,
+  226, 37, 229, 228, 17, 10, 131, 213, 105, 38, 136, 95, 254, 218, 31, 89,
+  120, 218, 63, 255, 103, 207, 120, 218, 19, 30, 119, 229, 101, 123, 243, 14,
+  224, 188, 237, 91, 11, 21, 120, 99, 19, 0, 11, 11, 11, 22, 9, 176, 3, 192,
+  11, 1, 3, 212, 1, 199, 44, 32, 104, 11, 161, 158, 192, 143, 133, 62, 154,
+  145, 176, 87, 76, 30, 169, 48, 152, 73, 71, 153, 204, 36, 0, 222, 240, 178,
+  149, 235, 246, 61, 251, 107, 158, 122, 221, 227, 174, 186, 236, 226, 61,
+  23, 236, 202, 25, 224, 214, 66, 5, 46, 122, 128, 165, 197, 38, 0, 70, 112,
+  13, 240, 50, 128, 195, 5, 49, 58, 200, 71, 0, 29, 5, 209, 220, 112, 234,
+  116, 48, 85, 24, 244, 142, 130, 71, 136, 62, 190, 249, 37, 39, 31, 251, 213,
+  207, 124, 250, 83, 158, 248, 184, 171, 46, 191, 120, 239, 5, 187, 114, 6,
+  88, 104, 0, 69, 0, 44, 85, 179, 224, 70, 10, 230, 83, 128, 143, 63, 168,
+  12, 73, 4, 66, 145, 76, 148, 72, 56, 193, 26, 9, 131, 100, 213, 130, 96,
+  218, 201, 196, 239, 253, 219, 67, 151, 63, 229, 233, 95, 253, 228, 235, 174,
+  189, 250, 242, 75, 246, 94, 80, 20, 128, 34, 1, 108, 174, 18, 64, 85, 1,
+  22, 59, 14, 0, 167, 0, 103, 42, 16, 4, 0, 203, 5, 68, 116, 128, 138, 130,
+  71, 53, 12, 102, 16, 5, 211, 245, 15, 83, 113, 134, 247, 126, 255, 3, 123,
+  159, 248, 180, 167, 62, 249, 9, 215, 94, 125, 197, 37, 23, 237, 57, 127,
+  87, 201, 0, 235, 10, 208, 81, 128, 142, 3, 180, 157, 96, 39, 6, 164, 9, 199,
+  4, 241, 36, 224, 71, 128, 36, 13, 160, 200, 247, 105, 20, 251, 113, 3, 81,
+  50, 136, 139, 130, 85, 167, 141, 224, 47, 250, 208, 139, 238, 218, 245, 21,
+  95, 249, 148, 39, 21, 248, 95, 122, 209, 133, 231, 239, 62, 175, 74, 0, 155,
+  54, 85, 20, 208, 13, 128, 212, 174, 1, 118, 10, 72, 33, 252, 253, 12, 16,
+  224, 31, 90, 6, 100, 250, 144, 104, 126, 212, 59, 25, 76, 163, 32, 77, 43,
+  41, 173, 42, 105, 132, 126, 201, 159, 124, 207, 237, 219, 30, 243, 196, 39,
+  61, 241, 9, 143, 187, 250, 202, 28, 255, 11, 118, 239, 202, 241, 47, 25,
+  64, 45, 2, 84, 58, 96, 173, 3, 84, 9, 192, 19, 131, 2, 69, 208, 36, 96, 0,
+  248, 214, 209, 152, 174, 0, 235, 15, 197, 89, 224, 17, 77, 6, 211, 233, 8,
+  143, 40, 89, 248, 171, 23, 222, 188, 241, 138, 175, 184, 238, 186, 199, 63,
+  246, 49, 87, 92, 118, 241, 133, 123, 118, 23, 5, 96, 219, 150, 130, 1, 84,
+  1, 176, 104, 5, 192, 200, 170, 1, 93, 17, 112, 83, 64, 106, 144, 42, 0, 36,
+  1, 84, 28, 114, 209, 15, 6, 6, 241, 81, 16, 103, 49, 72, 102, 17, 5, 83,
+  5, 65, 207, 24, 136, 175, 19, 127, 243, 194, 155, 70, 151, 60, 246, 241,
+  143, 191, 246, 113, 87, 231, 248, 239, 205, 9, 64, 209, 1, 180, 9, 192, 9,
+  128, 209, 130, 19, 0, 161, 51, 36, 197, 104, 0, 6, 63, 50, 38, 72, 166, 175,
+  5, 34, 248, 103, 16, 5, 51, 9, 130, 25, 210, 197, 216, 42, 241, 201, 239,
+  254, 84, 118, 225, 85, 215, 94, 123, 237, 53, 121, 254, 191, 36, 199, 127,
+  247, 206, 243, 118, 108, 171, 19, 192, 134, 210, 11, 98, 117, 129, 80, 0,
+  120, 36, 32, 77, 152, 50, 32, 98, 131, 83, 215, 130, 8, 229, 184, 87, 20,
+  76, 151, 10, 196, 65, 48, 115, 158, 224, 255, 236, 63, 190, 240, 239, 207,
+  237, 186, 226, 154, 199, 62, 238, 49, 249, 254, 191, 100, 111, 78, 0, 203,
+  2, 176, 181, 78, 0, 27, 151, 54, 212, 58, 48, 20, 0, 21, 9, 176, 199, 130,
+  161, 34, 68, 118, 131, 206, 152, 8, 143, 0, 76, 38, 140, 19, 137, 152, 38,
+  113, 234, 121, 2, 29, 4, 253, 59, 134, 217, 210, 4, 239, 39, 111, 125, 225,
+  223, 156, 222, 113, 201, 213, 215, 92, 115, 245, 85, 57, 254, 23, 237, 201,
+  9, 96, 94, 0, 202, 22, 176, 81, 1, 235, 0, 168, 166, 193, 78, 0, 212, 51,
+  97, 88, 12, 32, 52, 65, 184, 8, 80, 124, 144, 171, 5, 124, 42, 144, 78, 145,
+  18, 81, 20, 72, 83, 65, 60, 83, 124, 132, 11, 196, 151, 95, 248, 241, 227,
+  91, 246, 94, 113, 245, 99, 174, 190, 242, 138, 75, 47, 41, 26, 128, 221,
+  59, 119, 228, 5, 160, 78, 0, 69, 1, 40, 75, 192, 66, 163, 3, 45, 140, 186,
+  62, 176, 117, 134, 117, 122, 96, 133, 126, 48, 23, 64, 187, 1, 4, 127, 76,
+  27, 232, 65, 8, 34, 82, 129, 224, 11, 125, 82, 193, 163, 192, 17, 196, 245,
+  225, 222, 239, 253, 235, 195, 27, 47, 184, 236, 202, 171, 174, 186, 242,
+  242, 18, 255, 156, 0, 238, 220, 158, 23, 128, 173, 91, 54, 21, 9, 160, 148,
+  129, 155, 38, 208, 15, 0, 203, 30, 30, 202, 65, 176, 40, 8, 52, 131, 48,
+  254, 132, 78, 60, 43, 86, 40, 86, 13, 123, 25, 17, 103, 31, 3, 51, 98, 8,
+  206, 207, 60, 248, 162, 191, 124, 104, 97, 247, 197, 151, 95, 121, 229, 21,
+  151, 93, 118, 113, 129, 255, 238, 157, 85, 7, 176, 37, 15, 128, 141, 245,
+  32, 176, 145, 129, 176, 0, 104, 14, 137, 192, 6, 49, 151, 13, 6, 68, 32,
+  192, 223, 203, 0, 56, 19, 144, 155, 72, 102, 24, 4, 81, 46, 196, 136, 218,
+  48, 107, 49, 73, 86, 29, 14, 127, 223, 159, 31, 72, 207, 187, 240, 210, 43,
+  46, 191, 252, 178, 75, 115, 252, 247, 148, 4, 112, 199, 246, 173, 165, 8,
+  92, 245, 128, 117, 19, 88, 115, 64, 135, 3, 216, 98, 160, 83, 4, 82, 60,
+  0, 160, 34, 16, 21, 1, 161, 58, 16, 31, 4, 61, 85, 130, 48, 3, 76, 215, 48,
+  246, 136, 129, 217, 22, 135, 19, 63, 240, 167, 247, 103, 219, 46, 184, 248,
+  178, 124, 93, 210, 224, 95, 117, 0, 45, 3, 168, 100, 192, 210, 17, 12, 6,
+  192, 200, 98, 129, 53, 254, 80, 47, 96, 8, 85, 8, 104, 7, 192, 8, 192, 250,
+  129, 169, 250, 195, 233, 131, 96, 42, 139, 250, 76, 212, 196, 190, 157, 195,
+  217, 23, 255, 159, 123, 86, 54, 159, 191, 247, 146, 75, 47, 205, 203, 127,
+  158, 255, 139, 6, 160, 196, 191, 74, 0, 27, 187, 30, 160, 34, 129, 78, 27,
+  88, 115, 192, 81, 80, 2, 160, 118, 208, 192, 35, 98, 97, 59, 224, 158, 45,
+  99, 179, 192, 163, 17, 4, 83, 28, 92, 154, 129, 128, 208, 175, 52, 76, 126,
+  240, 143, 239, 92, 222, 184, 115, 207, 69, 151, 228, 235, 162, 189, 197,
+  254, 223, 125, 94, 73, 0, 156, 4, 96, 201, 64, 86, 0, 116, 66, 0, 76, 2,
+  160, 177, 128, 19, 0, 92, 4, 16, 9, 64, 226, 31, 96, 140, 165, 51, 12, 2,
+  186, 93, 236, 163, 39, 175, 102, 101, 176, 190, 152, 254, 187, 63, 186, 227,
+  244, 226, 142, 11, 246, 94, 116, 241, 197, 23, 95, 180, 119, 207, 158, 243,
+  243, 6, 224, 188, 243, 182, 151, 5, 160, 105, 1, 154, 65, 80, 51, 11, 108,
+  165, 224, 58, 0, 60, 22, 16, 100, 128, 52, 12, 0, 66, 22, 114, 36, 33, 60,
+  11, 72, 245, 129, 41, 57, 1, 43, 19, 9, 161, 95, 5, 114, 48, 139, 194, 176,
+  244, 210, 63, 252, 226, 137, 133, 109, 187, 246, 236, 189, 248, 162, 139,
+  246, 22, 248, 239, 222, 93, 225, 191, 109, 203, 214, 205, 133, 6, 212, 80,
+  192, 10, 255, 214, 14, 210, 6, 128, 131, 63, 16, 1, 93, 63, 104, 160, 1,
+  113, 5, 57, 212, 19, 210, 250, 48, 220, 23, 98, 83, 35, 249, 248, 40, 170,
+  59, 72, 34, 137, 192, 170, 215, 133, 232, 172, 176, 229, 101, 31, 189, 237,
+  120, 178, 121, 231, 5, 23, 238, 205, 215, 133, 21, 254, 59, 119, 20, 4, 160,
+  24, 2, 116, 9, 96, 195, 226, 82, 93, 1, 108, 37, 216, 209, 2, 147, 192, 23,
+  16, 30, 22, 161, 83, 0, 211, 17, 114, 41, 0, 62, 119, 14, 7, 130, 92, 39,
+  96, 170, 65, 108, 12, 8, 110, 80, 159, 70, 86, 142, 12, 128, 29, 47, 255,
+  200, 173, 71, 178, 77, 59, 118, 231, 1, 112, 225, 133, 23, 238, 185, 160,
+  193, 63, 239, 0, 183, 86, 5, 160, 77, 0, 77, 5, 176, 167, 193, 65, 13, 72,
+  100, 17, 96, 16, 183, 32, 110, 21, 145, 246, 132, 73, 52, 29, 136, 224, 133,
+  220, 232, 40, 137, 166, 1, 201, 180, 101, 129, 143, 0, 170, 42, 236, 250,
+  145, 15, 127, 225, 240, 120, 105, 251, 206, 243, 247, 92, 152, 255, 40, 240,
+  223, 181, 179, 104, 0, 182, 111, 173, 11, 64, 157, 0, 202, 10, 176, 212,
+  36, 128, 42, 0, 74, 83, 112, 88, 3, 66, 49, 8, 10, 1, 131, 250, 69, 113,
+  235, 48, 86, 9, 104, 161, 80, 130, 191, 164, 26, 196, 14, 144, 228, 84, 48,
+  153, 170, 44, 76, 67, 21, 247, 252, 232, 71, 254, 233, 161, 149, 197, 45,
+  231, 237, 190, 224, 130, 61, 57, 252, 23, 236, 222, 189, 171, 106, 0, 43,
+  9, 168, 212, 128, 54, 110, 168, 100, 224, 197, 118, 20, 104, 145, 192, 212,
+  157, 7, 53, 98, 176, 101, 13, 233, 58, 193, 20, 21, 132, 4, 17, 64, 197,
+  0, 45, 18, 74, 143, 26, 197, 39, 130, 89, 177, 195, 217, 142, 153, 34, 120,
+  194, 197, 63, 254, 225, 207, 31, 60, 59, 218, 188, 99, 231, 249, 231, 231,
+  232, 23, 233, 127, 87, 33, 0, 213, 10, 64, 193, 0, 54, 214, 70, 128, 74,
+  5, 90, 92, 104, 154, 128, 5, 155, 3, 6, 53, 32, 129, 35, 128, 28, 13, 193,
+  102, 49, 50, 6, 248, 74, 224, 113, 66, 89, 33, 72, 86, 37, 6, 228, 192, 79,
+  153, 17, 228, 41, 225, 178, 87, 126, 232, 115, 7, 206, 36, 155, 182, 157,
+  183, 235, 252, 243, 47, 56, 191, 72, 255, 45, 254, 197, 12, 160, 46, 0, 77,
+  15, 232, 36, 128, 142, 4, 56, 243, 64, 79, 14, 6, 72, 64, 234, 180, 131,
+  158, 38, 232, 13, 137, 101, 194, 80, 100, 6, 136, 232, 13, 103, 221, 37,
+  206, 176, 40, 196, 68, 0, 22, 0, 87, 253, 196, 135, 111, 218, 127, 202, 108,
+  216, 178, 99, 231, 238, 221, 231, 231, 171, 76, 255, 37, 254, 219, 172, 2,
+  224, 82, 192, 150, 2, 180, 39, 131, 172, 105, 192, 200, 159, 9, 131, 30,
+  209, 132, 176, 138, 97, 115, 98, 164, 33, 64, 82, 129, 104, 98, 148, 136,
+  18, 193, 84, 246, 162, 88, 217, 40, 38, 26, 166, 207, 8, 215, 252, 151, 15,
+  221, 116, 255, 137, 108, 113, 243, 246, 243, 118, 237, 218, 157, 103, 255,
+  130, 254, 237, 220, 113, 222, 246, 82, 1, 42, 93, 0, 133, 19, 180, 196, 191,
+  161, 128, 109, 6, 24, 89, 36, 160, 33, 129, 240, 72, 48, 69, 105, 32, 72,
+  5, 112, 167, 0, 210, 18, 64, 218, 128, 52, 0, 162, 44, 69, 194, 75, 10, 250,
+  240, 130, 126, 33, 48, 37, 75, 188, 246, 167, 62, 244, 217, 251, 142, 143,
+  23, 54, 109, 221, 177, 115, 231, 238, 93, 37, 251, 107, 246, 255, 182, 18,
+  255, 150, 1, 90, 20, 176, 227, 128, 246, 44, 0, 168, 1, 126, 6, 0, 104, 160,
+  23, 0, 65, 51, 56, 99, 129, 152, 0, 62, 46, 8, 88, 119, 137, 220, 101, 194,
+  196, 0, 12, 119, 124, 227, 8, 125, 250, 132, 87, 127, 232, 51, 247, 30, 59,
+  55, 218, 176, 117, 219, 121, 69, 0, 20, 240, 23, 248, 151, 251, 127, 107,
+  133, 127, 155, 0, 156, 30, 160, 29, 6, 187, 74, 96, 133, 255, 40, 77, 2,
+  53, 16, 116, 135, 132, 84, 80, 220, 13, 76, 33, 16, 83, 230, 114, 233, 1,
+  68, 27, 221, 85, 99, 135, 242, 156, 208, 179, 46, 60, 233, 103, 63, 252,
+  233, 187, 143, 46, 39, 75, 155, 183, 237, 200, 3, 96, 215, 206, 114, 251,
+  91, 248, 151, 46, 128, 182, 5, 44, 231, 64, 150, 10, 224, 41, 129, 246, 60,
+  16, 176, 134, 81, 57, 64, 28, 1, 128, 60, 44, 108, 10, 101, 52, 0, 190, 158,
+  72, 42, 25, 199, 20, 133, 153, 116, 139, 83, 150, 133, 167, 252, 220, 135,
+  63, 117, 247, 225, 179, 102, 113, 211, 150, 237, 69, 0, 236, 220, 89, 167,
+  255, 26, 255, 170, 0, 132, 9, 192, 111, 2, 22, 224, 18, 0, 15, 5, 83, 34,
+  5, 224, 211, 33, 174, 37, 92, 3, 49, 128, 70, 66, 15, 225, 112, 202, 102,
+  81, 152, 14, 158, 246, 11, 31, 254, 212, 157, 15, 159, 201, 22, 54, 108,
+  217, 86, 4, 64, 249, 35, 167, 127, 37, 255, 47, 20, 192, 106, 6, 208, 48,
+  0, 191, 2, 52, 9, 192, 30, 7, 90, 19, 97, 71, 10, 176, 225, 79, 137, 20,
+  224, 71, 0, 139, 63, 57, 35, 32, 229, 97, 46, 6, 216, 209, 129, 76, 45, 74,
+  102, 24, 2, 51, 78, 7, 79, 255, 197, 15, 127, 242, 206, 67, 167, 38, 163,
+  165, 205, 91, 183, 237, 216, 113, 94, 185, 118, 20, 251, 127, 91, 211, 0,
+  86, 67, 64, 39, 1, 148, 21, 192, 74, 0, 216, 48, 32, 176, 134, 117, 90, 16,
+  49, 23, 66, 34, 192, 199, 31, 76, 1, 113, 83, 130, 168, 24, 232, 233, 56,
+  143, 96, 136, 51, 46, 8, 18, 221, 224, 153, 175, 253, 200, 39, 191, 252,
+  208, 201, 149, 116, 105, 227, 150, 109, 101, 0, 236, 40, 224, 47, 241, 207,
+  243, 127, 177, 255, 235, 33, 96, 99, 4, 105, 43, 64, 59, 9, 170, 240, 175,
+  135, 1, 142, 22, 108, 13, 132, 66, 22, 40, 142, 0, 97, 25, 144, 56, 136,
+  105, 137, 144, 79, 255, 72, 48, 196, 164, 129, 72, 110, 48, 43, 229, 8, 9,
+  128, 103, 189, 238, 35, 159, 188, 227, 193, 147, 231, 146, 133, 141, 121,
+  2, 216, 190, 125, 71, 11, 255, 246, 173, 181, 2, 236, 20, 128, 218, 11, 24,
+  82, 128, 174, 11, 128, 51, 128, 151, 2, 58, 240, 37, 85, 0, 227, 2, 178,
+  66, 32, 142, 129, 88, 26, 16, 63, 75, 238, 163, 33, 78, 151, 13, 152, 88,
+  248, 103, 191, 252, 209, 27, 191, 244, 224, 137, 101, 51, 218, 176, 105,
+  75, 30, 0, 57, 244, 59, 42, 246, 231, 224, 95, 107, 192, 27, 151, 218, 49,
+  128, 67, 1, 58, 252, 235, 8, 8, 92, 65, 65, 43, 136, 77, 133, 104, 34, 32,
+  106, 10, 3, 248, 145, 230, 48, 74, 33, 236, 23, 3, 210, 131, 233, 179, 150,
+  141, 152, 114, 208, 125, 248, 156, 215, 127, 244, 198, 47, 30, 56, 126, 54,
+  43, 10, 64, 94, 1, 114, 228, 243, 8, 40, 224, 207, 233, 95, 33, 0, 54, 10,
+  208, 166, 114, 255, 219, 12, 192, 161, 0, 85, 5, 176, 199, 129, 35, 91, 7,
+  232, 250, 0, 167, 21, 68, 212, 0, 9, 17, 96, 211, 128, 152, 14, 176, 250,
+  144, 200, 73, 212, 99, 128, 4, 150, 128, 169, 68, 35, 169, 223, 164, 251,
+  232, 235, 223, 80, 224, 127, 244, 204, 36, 93, 220, 176, 57, 175, 0, 69,
+  0, 148, 187, 191, 162, 127, 45, 254, 37, 1, 116, 24, 64, 53, 9, 180, 84,
+  0, 71, 7, 128, 181, 64, 183, 8, 144, 1, 224, 107, 130, 116, 25, 160, 91,
+  194, 30, 35, 99, 153, 167, 24, 179, 15, 128, 67, 164, 88, 62, 56, 229, 28,
+  129, 172, 1, 237, 7, 207, 251, 181, 255, 125, 227, 237, 251, 143, 158, 30,
+  39, 11, 75, 155, 54, 231, 21, 160, 136, 128, 109, 53, 251, 175, 243, 127,
+  69, 0, 219, 4, 176, 212, 205, 129, 28, 10, 176, 208, 202, 0, 245, 56, 192,
+  179, 6, 187, 248, 211, 122, 32, 19, 1, 97, 37, 136, 77, 2, 82, 30, 208, 171,
+  43, 100, 166, 137, 17, 36, 32, 254, 38, 108, 97, 50, 104, 190, 242, 141,
+  191, 241, 135, 55, 222, 126, 255, 145, 211, 231, 204, 194, 226, 198, 205,
+  155, 183, 228, 89, 63, 199, 190, 132, 191, 42, 255, 85, 3, 184, 201, 238,
+  0, 10, 17, 176, 13, 0, 71, 7, 244, 12, 1, 254, 61, 1, 64, 43, 72, 204, 4,
+  194, 67, 35, 216, 217, 1, 234, 40, 25, 225, 25, 136, 109, 9, 132, 157, 97,
+  252, 28, 81, 162, 28, 247, 105, 21, 73, 106, 80, 189, 255, 166, 55, 22, 248,
+  31, 62, 181, 108, 242, 2, 176, 41, 175, 0, 57, 236, 219, 139, 44, 208, 150,
+  255, 122, 4, 232, 22, 128, 174, 7, 172, 15, 134, 7, 50, 128, 115, 60, 200,
+  247, 5, 65, 69, 0, 9, 0, 56, 2, 128, 49, 33, 169, 12, 82, 190, 17, 113, 63,
+  144, 76, 209, 21, 246, 28, 38, 147, 233, 96, 234, 24, 200, 223, 125, 203,
+  155, 254, 232, 198, 219, 238, 59, 124, 226, 220, 36, 93, 88, 218, 88, 84,
+  128, 173, 5, 242, 13, 252, 101, 255, 223, 16, 192, 14, 255, 13, 139, 150,
+  19, 192, 25, 5, 6, 25, 32, 80, 131, 19, 108, 36, 128, 5, 128, 135, 62, 102,
+  27, 198, 175, 149, 136, 177, 146, 11, 90, 2, 105, 25, 232, 27, 2, 18, 172,
+  103, 227, 49, 200, 223, 254, 171, 55, 23, 248, 31, 58, 121, 118, 82, 20,
+  128, 162, 2, 108, 45, 34, 96, 107, 83, 253, 155, 250, 223, 225, 31, 38, 0,
+  223, 12, 224, 106, 193, 65, 39, 152, 96, 44, 160, 13, 0, 239, 188, 8, 81,
+  2, 194, 75, 37, 72, 30, 192, 216, 199, 102, 80, 10, 226, 170, 0, 115, 159,
+  105, 68, 74, 232, 167, 26, 36, 230, 95, 255, 246, 31, 255, 195, 109, 247,
+  30, 58, 113, 118, 197, 140, 22, 55, 228, 9, 160, 12, 128, 114, 109, 65, 240,
+  47, 224, 223, 176, 232, 82, 192, 182, 4, 120, 150, 176, 54, 3, 140, 2, 33,
+  192, 173, 1, 184, 26, 96, 152, 16, 48, 209, 182, 65, 193, 164, 32, 137, 183,
+  15, 197, 132, 0, 239, 40, 136, 136, 0, 36, 37, 72, 34, 33, 49, 223, 250,
+  214, 63, 185, 241, 214, 123, 31, 58, 126, 102, 197, 228, 5, 96, 195, 166,
+  188, 2, 108, 217, 82, 96, 95, 227, 191, 185, 225, 255, 181, 11, 172, 213,
+  0, 171, 30, 112, 193, 238, 1, 92, 10, 224, 56, 2, 70, 224, 68, 208, 167,
+  129, 41, 211, 11, 226, 25, 64, 76, 7, 97, 109, 200, 69, 124, 42, 82, 216,
+  55, 4, 176, 1, 226, 20, 17, 32, 9, 128, 111, 127, 91, 137, 255, 177, 211,
+  231, 178, 100, 161, 72, 0, 85, 0, 108, 105, 118, 127, 93, 254, 155, 17, 144,
+  91, 0, 90, 17, 200, 166, 0, 33, 9, 116, 39, 130, 128, 55, 144, 30, 11, 178,
+  33, 48, 141, 99, 136, 155, 21, 244, 54, 18, 146, 192, 243, 182, 178, 169,
+  188, 199, 242, 84, 144, 124, 199, 219, 255, 244, 198, 91, 238, 61, 120, 244,
+  244, 185, 73, 94, 0, 138, 4, 176, 105, 75, 21, 1, 29, 252, 109, 254, 175,
+  109, 128, 181, 4, 208, 170, 192, 86, 19, 216, 170, 0, 141, 14, 224, 54, 1,
+  35, 68, 13, 118, 135, 66, 41, 74, 3, 76, 84, 8, 136, 245, 97, 145, 135, 44,
+  238, 222, 1, 118, 104, 44, 180, 23, 178, 142, 2, 217, 221, 118, 168, 4, 248,
+  130, 119, 228, 248, 223, 115, 240, 232, 169, 229, 177, 25, 21, 9, 96, 227,
+  230, 42, 0, 202, 220, 223, 166, 255, 86, 0, 232, 58, 64, 183, 7, 172, 237,
+  96, 94, 9, 0, 218, 64, 104, 38, 12, 103, 128, 148, 160, 1, 161, 103, 220,
+  5, 191, 167, 97, 132, 167, 4, 17, 247, 143, 36, 211, 242, 1, 198, 73, 16,
+  117, 197, 37, 150, 18, 190, 235, 157, 127, 118, 227, 173, 119, 63, 120, 244,
+  228, 242, 138, 201, 11, 192, 82, 65, 1, 243, 18, 176, 185, 65, 127, 75, 3,
+  191, 67, 0, 55, 56, 248, 91, 12, 32, 156, 5, 165, 128, 41, 4, 85, 2, 72,
+  34, 232, 77, 5, 240, 54, 0, 234, 7, 88, 62, 24, 145, 3, 226, 46, 159, 72,
+  216, 236, 207, 245, 3, 194, 8, 160, 83, 0, 242, 179, 47, 252, 253, 63, 47,
+  240, 63, 146, 55, 0, 89, 50, 90, 44, 18, 64, 94, 237, 55, 87, 200, 151, 255,
+  109, 170, 245, 255, 77, 27, 61, 2, 80, 79, 1, 172, 49, 64, 87, 2, 108, 25,
+  192, 73, 0, 237, 149, 129, 240, 60, 128, 180, 6, 0, 49, 0, 10, 130, 4, 21,
+  192, 196, 65, 137, 54, 212, 171, 51, 136, 61, 101, 64, 182, 3, 113, 37, 65,
+  36, 32, 126, 207, 31, 252, 69, 142, 255, 129, 35, 39, 206, 172, 228, 4, 96,
+  148, 119, 118, 27, 203, 12, 80, 38, 254, 45, 117, 241, 175, 202, 127, 181,
+  255, 55, 214, 18, 112, 199, 0, 109, 17, 40, 224, 128, 68, 9, 8, 138, 0, 77,
+  3, 194, 201, 48, 109, 18, 241, 240, 103, 167, 4, 88, 250, 159, 202, 61, 128,
+  79, 13, 35, 78, 28, 205, 202, 108, 8, 145, 195, 23, 189, 231, 47, 62, 121,
+  203, 93, 15, 30, 62, 126, 230, 220, 36, 75, 23, 242, 22, 176, 232, 1, 202,
+  8, 104, 86, 241, 233, 198, 186, 254, 55, 4, 176, 57, 12, 22, 168, 128, 94,
+  2, 176, 103, 65, 65, 4, 56, 151, 70, 161, 254, 64, 126, 54, 76, 159, 27,
+  144, 120, 7, 121, 109, 144, 58, 104, 222, 211, 83, 26, 219, 22, 138, 108,
+  5, 73, 100, 0, 124, 223, 251, 254, 226, 83, 183, 220, 117, 224, 240, 241,
+  211, 57, 1, 76, 10, 6, 104, 5, 192, 166, 150, 252, 185, 249, 223, 43, 0,
+  78, 15, 216, 50, 0, 215, 16, 132, 244, 129, 96, 14, 96, 105, 0, 146, 1, 136,
+  236, 223, 175, 41, 32, 149, 129, 41, 236, 100, 81, 87, 151, 198, 30, 65,
+  18, 79, 21, 203, 183, 63, 240, 254, 191, 44, 240, 127, 248, 88, 142, 255,
+  36, 73, 115, 6, 88, 80, 192, 50, 2, 170, 204, 95, 5, 192, 198, 166, 255,
+  247, 241, 199, 18, 64, 211, 6, 166, 150, 20, 60, 178, 219, 192, 4, 39, 130,
+  110, 5, 240, 85, 97, 171, 31, 52, 224, 124, 8, 57, 67, 10, 83, 1, 105, 83,
+  32, 246, 16, 69, 184, 201, 102, 93, 16, 98, 43, 66, 241, 246, 197, 31, 252,
+  171, 28, 255, 253, 15, 31, 59, 181, 156, 19, 128, 52, 103, 128, 69, 5, 40,
+  240, 223, 180, 185, 249, 207, 222, 254, 14, 254, 21, 252, 165, 8, 232, 37,
+  0, 127, 20, 0, 205, 2, 144, 169, 48, 130, 127, 42, 170, 2, 244, 128, 56,
+  68, 190, 87, 8, 8, 93, 229, 201, 76, 106, 129, 112, 100, 192, 149, 2, 172,
+  18, 252, 224, 245, 127, 245, 233, 28, 255, 67, 199, 78, 21, 4, 48, 47, 0,
+  5, 3, 40, 3, 96, 99, 133, 124, 67, 254, 27, 3, 128, 221, 0, 216, 18, 64,
+  216, 3, 120, 109, 32, 168, 5, 163, 99, 97, 31, 127, 121, 21, 16, 133, 0,
+  120, 170, 52, 206, 70, 30, 97, 38, 92, 5, 74, 16, 49, 54, 72, 168, 0, 120,
+  201, 13, 127, 157, 227, 255, 192, 161, 99, 39, 11, 2, 152, 23, 128, 133,
+  42, 1, 84, 41, 96, 83, 187, 249, 27, 250, 215, 238, 255, 13, 77, 254, 95,
+  106, 225, 15, 122, 128, 133, 17, 200, 1, 32, 18, 136, 155, 195, 194, 94,
+  48, 37, 203, 0, 57, 26, 32, 43, 64, 84, 91, 16, 209, 17, 68, 205, 143, 87,
+  33, 17, 80, 5, 225, 223, 255, 175, 143, 125, 234, 214, 59, 247, 63, 116,
+  236, 196, 153, 115, 227, 44, 47, 0, 57, 148, 27, 74, 14, 88, 69, 192, 198,
+  234, 255, 141, 141, 252, 239, 53, 0, 142, 6, 212, 220, 16, 109, 53, 129,
+  11, 35, 88, 10, 14, 189, 193, 136, 26, 0, 222, 28, 65, 89, 133, 45, 236,
+  5, 131, 129, 94, 62, 242, 152, 227, 101, 125, 7, 71, 51, 77, 4, 68, 37, 120,
+  233, 135, 63, 246, 233, 91, 239, 124, 224, 208, 145, 147, 167, 207, 21, 4,
+  160, 104, 1, 151, 154, 12, 80, 18, 193, 22, 253, 110, 251, 59, 4, 96, 201,
+  41, 0, 182, 12, 108, 207, 2, 3, 71, 200, 8, 8, 0, 212, 29, 70, 153, 4, 241,
+  185, 128, 228, 78, 17, 81, 14, 232, 33, 13, 70, 215, 129, 89, 39, 2, 180,
+  27, 112, 43, 192, 203, 62, 242, 177, 207, 228, 249, 255, 161, 35, 39, 206,
+  156, 45, 8, 64, 145, 0, 138, 0, 40, 168, 94, 149, 246, 221, 236, 95, 151,
+  255, 234, 36, 96, 237, 3, 108, 239, 5, 108, 72, 224, 200, 115, 3, 193, 66,
+  208, 200, 107, 3, 129, 0, 64, 149, 128, 176, 23, 0, 20, 65, 96, 62, 192,
+  183, 1, 179, 56, 94, 26, 103, 45, 239, 217, 34, 246, 55, 151, 217, 159, 252,
+  135, 143, 126, 60, 199, 255, 254, 28, 255, 211, 103, 87, 198, 57, 1, 24,
+  21, 45, 192, 82, 89, 2, 202, 8, 40, 177, 223, 228, 192, 239, 236, 255, 38,
+  255, 219, 248, 135, 12, 192, 214, 130, 221, 62, 176, 105, 4, 19, 208, 24,
+  0, 249, 2, 210, 72, 85, 152, 52, 139, 113, 208, 11, 61, 132, 192, 53, 148,
+  2, 54, 16, 97, 46, 151, 88, 203, 99, 143, 36, 22, 31, 188, 252, 15, 63, 254,
+  153, 60, 255, 63, 116, 248, 196, 169, 179, 37, 1, 104, 18, 192, 134, 42,
+  5, 180, 169, 223, 198, 223, 217, 255, 14, 1, 64, 41, 160, 67, 2, 45, 14,
+  56, 242, 166, 1, 78, 0, 4, 146, 48, 233, 18, 100, 15, 141, 176, 79, 35, 100,
+  246, 127, 220, 121, 130, 168, 82, 32, 208, 6, 122, 251, 75, 73, 251, 192,
+  15, 255, 209, 255, 251, 236, 173, 119, 222, 95, 224, 159, 19, 192, 178, 0,
+  148, 9, 192, 10, 128, 186, 241, 175, 170, 255, 198, 26, 126, 171, 1, 180,
+  90, 64, 96, 16, 184, 16, 38, 0, 120, 24, 96, 55, 1, 192, 92, 208, 187, 79,
+  30, 117, 137, 1, 45, 161, 96, 70, 60, 155, 16, 160, 228, 225, 94, 132, 128,
+  61, 114, 34, 226, 133, 196, 252, 39, 249, 145, 63, 206, 241, 191, 235, 254,
+  131, 71, 142, 229, 248, 175, 20, 29, 96, 206, 0, 23, 150, 22, 203, 10, 208,
+  68, 192, 134, 90, 250, 105, 178, 127, 59, 1, 170, 242, 127, 99, 3, 169, 183,
+  127, 77, 1, 221, 22, 192, 239, 2, 70, 112, 0, 248, 230, 192, 216, 28, 64,
+  181, 3, 112, 25, 32, 43, 129, 196, 76, 46, 180, 15, 78, 43, 15, 244, 116,
+  155, 163, 222, 210, 250, 131, 31, 253, 147, 79, 228, 251, 255, 129, 131,
+  135, 143, 157, 60, 179, 156, 227, 111, 146, 28, 177, 133, 134, 2, 108, 216,
+  80, 3, 95, 41, 127, 54, 254, 245, 85, 16, 237, 12, 160, 233, 0, 96, 25, 56,
+  172, 0, 200, 60, 16, 9, 0, 228, 210, 128, 52, 1, 120, 96, 144, 2, 136, 4,
+  16, 117, 177, 4, 106, 36, 140, 234, 10, 185, 203, 136, 98, 78, 156, 137,
+  103, 201, 9, 54, 23, 254, 177, 63, 253, 196, 103, 111, 187, 243, 254, 18,
+  255, 130, 0, 230, 47, 67, 177, 121, 203, 10, 176, 180, 161, 202, 248, 205,
+  222, 111, 225, 175, 171, 191, 51, 3, 242, 53, 32, 160, 9, 72, 131, 54, 80,
+  32, 6, 199, 230, 0, 195, 169, 66, 120, 14, 136, 107, 4, 98, 228, 98, 89,
+  30, 152, 238, 156, 137, 220, 92, 100, 127, 233, 199, 255, 236, 111, 111,
+  202, 243, 255, 131, 57, 254, 121, 3, 176, 146, 101, 73, 155, 0, 150, 154,
+  26, 176, 161, 69, 191, 174, 254, 22, 254, 78, 1, 232, 90, 128, 17, 72, 1,
+  82, 204, 23, 142, 6, 64, 187, 253, 41, 111, 72, 26, 166, 0, 195, 182, 132,
+  6, 63, 78, 78, 212, 0, 4, 123, 225, 49, 99, 118, 94, 224, 211, 193, 158,
+  121, 128, 8, 3, 159, 12, 252, 167, 63, 251, 187, 155, 138, 253, 255, 240,
+  177, 188, 1, 204, 9, 96, 86, 74, 0, 69, 2, 40, 75, 192, 210, 134, 22, 120,
+  43, 249, 111, 112, 182, 191, 39, 1, 89, 5, 0, 233, 1, 4, 1, 224, 213, 0,
+  56, 7, 48, 70, 97, 106, 58, 16, 162, 47, 158, 16, 35, 6, 114, 232, 190, 1,
+  129, 131, 16, 171, 6, 54, 180, 125, 243, 128, 223, 52, 2, 108, 208, 188,
+  242, 207, 255, 254, 31, 139, 253, 95, 224, 95, 18, 192, 82, 2, 24, 45, 22,
+  20, 176, 202, 0, 75, 13, 240, 27, 45, 244, 113, 252, 187, 211, 32, 144, 12,
+  148, 82, 74, 32, 113, 82, 56, 194, 31, 70, 82, 65, 66, 15, 144, 89, 133,
+  144, 188, 191, 138, 121, 96, 138, 106, 64, 53, 132, 117, 0, 252, 196, 95,
+  254, 221, 231, 242, 253, 95, 224, 127, 234, 236, 242, 74, 209, 1, 22, 9,
+  96, 84, 0, 90, 115, 0, 107, 45, 57, 228, 223, 205, 255, 142, 6, 220, 194,
+  95, 162, 239, 170, 64, 118, 19, 192, 7, 64, 155, 255, 27, 244, 153, 187,
+  67, 32, 159, 88, 207, 58, 192, 212, 2, 97, 16, 48, 73, 128, 113, 14, 68,
+  78, 11, 120, 163, 144, 151, 14, 254, 243, 95, 253, 253, 231, 110, 43, 246,
+  255, 209, 227, 167, 207, 44, 23, 10, 128, 41, 90, 192, 98, 12, 84, 38, 128,
+  165, 13, 117, 21, 104, 224, 95, 234, 216, 127, 153, 34, 22, 59, 252, 45,
+  9, 104, 113, 68, 235, 192, 46, 5, 36, 2, 128, 169, 1, 41, 217, 8, 176, 110,
+  65, 140, 6, 202, 236, 98, 120, 39, 56, 203, 60, 48, 85, 119, 232, 82, 62,
+  32, 12, 94, 245, 127, 255, 225, 115, 183, 223, 89, 226, 127, 170, 192, 191,
+  232, 0, 114, 64, 70, 5, 144, 117, 9, 88, 106, 112, 183, 146, 255, 134, 48,
+  253, 7, 26, 112, 11, 63, 52, 9, 162, 2, 0, 244, 4, 128, 53, 32, 149, 180,
+  2, 70, 118, 155, 8, 196, 1, 168, 135, 213, 179, 199, 74, 163, 251, 130, 25,
+  158, 58, 196, 68, 95, 55, 48, 242, 255, 254, 203, 95, 223, 248, 185, 219,
+  243, 253, 127, 40, 199, 255, 244, 114, 78, 0, 202, 2, 80, 38, 0, 55, 0, 154,
+  68, 96, 163, 111, 109, 255, 165, 86, 1, 170, 209, 119, 7, 193, 142, 29, 172,
+  181, 132, 74, 3, 192, 66, 223, 193, 31, 31, 13, 27, 80, 12, 192, 188, 98,
+  236, 101, 179, 177, 73, 192, 51, 16, 71, 221, 56, 48, 253, 77, 20, 36, 229,
+  243, 126, 213, 79, 126, 236, 147, 159, 47, 246, 127, 142, 255, 201, 51, 103,
+  151, 199, 117, 1, 168, 122, 192, 197, 42, 2, 54, 216, 49, 176, 228, 178,
+  191, 165, 6, 125, 160, 3, 176, 172, 96, 174, 23, 192, 61, 23, 2, 112, 0,
+  183, 17, 4, 83, 128, 168, 21, 128, 108, 98, 208, 69, 2, 76, 43, 32, 148,
+  134, 217, 67, 69, 209, 79, 173, 233, 57, 62, 230, 15, 151, 182, 95, 253,
+  169, 255, 239, 147, 255, 116, 251, 93, 247, 61, 248, 240, 145, 227, 39, 79,
+  151, 4, 176, 44, 0, 85, 15, 216, 4, 64, 27, 1, 13, 248, 157, 248, 107, 209,
+  63, 107, 6, 176, 232, 118, 128, 174, 14, 152, 66, 1, 16, 136, 193, 221, 60,
+  8, 152, 8, 70, 122, 4, 97, 171, 168, 100, 68, 200, 165, 1, 54, 9, 224, 199,
+  203, 228, 206, 17, 50, 16, 144, 8, 128, 35, 34, 44, 23, 63, 253, 241, 79,
+  253, 83, 153, 255, 115, 252, 203, 6, 32, 39, 0, 38, 77, 10, 184, 236, 0,
+  104, 178, 126, 147, 252, 55, 44, 186, 236, 127, 169, 157, 0, 56, 251, 223,
+  41, 0, 200, 40, 144, 10, 0, 44, 5, 144, 62, 225, 250, 19, 35, 57, 49, 32,
+  171, 3, 130, 105, 113, 252, 225, 210, 254, 62, 66, 238, 208, 33, 60, 50,
+  134, 158, 117, 101, 146, 87, 255, 191, 79, 221, 92, 225, 127, 236, 100, 222,
+  0, 172, 20, 4, 160, 108, 1, 43, 10, 216, 5, 64, 3, 252, 210, 210, 210, 146,
+  151, 254, 221, 253, 111, 7, 192, 40, 244, 130, 133, 102, 0, 50, 0, 124, 83,
+  8, 22, 2, 252, 69, 114, 104, 254, 23, 92, 38, 224, 7, 64, 76, 18, 32, 55,
+  255, 20, 99, 227, 132, 52, 7, 8, 79, 158, 39, 63, 243, 55, 159, 190, 249,
+  139, 119, 221, 127, 160, 192, 255, 212, 217, 179, 121, 3, 80, 20, 128, 130,
+  1, 44, 212, 20, 96, 177, 110, 243, 28, 228, 93, 246, 111, 151, 127, 95, 2,
+  128, 241, 247, 44, 161, 22, 254, 182, 39, 196, 147, 131, 99, 82, 64, 138,
+  202, 129, 33, 246, 82, 159, 0, 235, 26, 146, 212, 130, 184, 32, 16, 6, 130,
+  135, 45, 117, 69, 169, 23, 0, 63, 251, 137, 79, 223, 252, 165, 124, 255,
+  63, 84, 224, 127, 230, 236, 185, 146, 0, 84, 12, 176, 169, 0, 139, 85, 157,
+  247, 161, 7, 182, 191, 61, 3, 90, 108, 225, 119, 52, 128, 5, 148, 3, 218,
+  248, 59, 182, 48, 104, 36, 24, 155, 2, 224, 118, 208, 8, 238, 18, 160, 225,
+  151, 207, 8, 5, 25, 32, 206, 78, 76, 123, 5, 240, 175, 186, 17, 240, 95,
+  255, 246, 51, 37, 254, 135, 14, 31, 59, 81, 225, 95, 16, 128, 164, 110, 1,
+  22, 202, 26, 80, 238, 242, 54, 4, 22, 237, 0, 128, 210, 255, 162, 71, 0,
+  108, 252, 109, 14, 232, 156, 12, 4, 250, 128, 132, 75, 1, 94, 23, 64, 187,
+  196, 12, 147, 4, 228, 87, 138, 48, 6, 98, 86, 38, 150, 7, 129, 176, 24, 224,
+  200, 35, 244, 192, 250, 166, 159, 251, 187, 207, 124, 225, 75, 119, 223,
+  215, 224, 95, 18, 128, 170, 0, 212, 21, 160, 225, 0, 77, 4, 44, 134, 187,
+  127, 105, 209, 201, 255, 110, 0, 140, 136, 10, 0, 140, 130, 96, 41, 16, 77,
+  1, 126, 35, 200, 155, 196, 40, 69, 152, 53, 139, 80, 84, 16, 115, 139, 244,
+  61, 98, 42, 62, 110, 142, 62, 190, 138, 209, 137, 202, 183, 255, 237, 239,
+  110, 202, 241, 207, 235, 127, 129, 127, 222, 0, 86, 4, 160, 106, 1, 171,
+  10, 208, 146, 128, 197, 166, 227, 107, 63, 90, 116, 186, 127, 123, 251, 47,
+  66, 248, 59, 240, 123, 21, 0, 198, 63, 140, 0, 80, 14, 130, 83, 0, 239, 19,
+  197, 218, 0, 54, 0, 4, 103, 8, 216, 89, 145, 180, 6, 72, 224, 151, 40, 3,
+  176, 82, 248, 243, 127, 127, 211, 45, 57, 254, 15, 62, 148, 227, 127, 242,
+  204, 153, 229, 134, 0, 36, 201, 168, 174, 0, 37, 170, 245, 70, 111, 96, 111,
+  225, 247, 212, 159, 46, 253, 47, 2, 29, 192, 66, 88, 0, 66, 67, 216, 8, 233,
+  2, 80, 95, 8, 76, 2, 69, 84, 208, 16, 118, 81, 118, 74, 8, 2, 79, 30, 36,
+  19, 7, 129, 73, 228, 240, 11, 188, 35, 148, 175, 252, 23, 254, 225, 166,
+  91, 238, 40, 240, 63, 114, 244, 68, 209, 0, 22, 248, 151, 5, 32, 41, 96,
+  89, 112, 50, 192, 226, 82, 247, 99, 169, 249, 60, 72, 255, 245, 238, 15,
+  59, 128, 5, 176, 5, 192, 100, 128, 206, 24, 236, 74, 65, 30, 246, 240, 84,
+  152, 180, 138, 115, 51, 1, 105, 0, 244, 61, 68, 196, 136, 130, 172, 159,
+  52, 72, 250, 44, 61, 12, 144, 239, 126, 226, 53, 55, 254, 99, 131, 255, 241,
+  83, 167, 11, 2, 88, 18, 128, 154, 1, 182, 25, 160, 240, 3, 52, 85, 160, 139,
+  3, 7, 126, 10, 255, 80, 2, 194, 134, 193, 94, 23, 16, 156, 14, 240, 93, 65,
+  184, 49, 0, 247, 10, 99, 115, 193, 56, 26, 32, 99, 131, 140, 73, 68, 126,
+  202, 152, 124, 118, 41, 169, 15, 129, 244, 176, 225, 11, 191, 120, 227, 231,
+  110, 45, 240, 63, 116, 248, 232, 241, 147, 21, 254, 101, 1, 48, 105, 23,
+  0, 139, 77, 10, 232, 248, 94, 136, 190, 61, 255, 1, 241, 247, 10, 64, 80,
+  1, 130, 131, 33, 208, 61, 17, 48, 7, 196, 165, 128, 84, 96, 17, 225, 167,
+  195, 60, 19, 136, 48, 145, 247, 191, 123, 14, 245, 140, 82, 17, 64, 100,
+  139, 226, 163, 215, 126, 242, 115, 183, 126, 249, 238, 7, 14, 52, 248, 151,
+  4, 112, 98, 178, 36, 233, 40, 96, 205, 1, 234, 0, 176, 144, 183, 192, 15,
+  28, 128, 0, 1, 64, 68, 160, 30, 28, 32, 36, 0, 116, 10, 72, 35, 28, 66, 68,
+  0, 112, 3, 162, 62, 248, 123, 243, 226, 232, 167, 19, 48, 191, 136, 243,
+  26, 255, 210, 167, 62, 119, 219, 29, 247, 212, 248, 23, 13, 96, 77, 0, 170,
+  22, 48, 29, 53, 20, 160, 22, 247, 23, 151, 22, 195, 55, 205, 230, 111, 216,
+  159, 13, 63, 160, 1, 45, 160, 9, 0, 85, 130, 153, 8, 160, 236, 129, 105,
+  66, 51, 65, 88, 22, 198, 51, 0, 65, 4, 209, 123, 198, 216, 171, 5, 196, 79,
+  168, 97, 199, 67, 96, 154, 199, 139, 134, 249, 239, 159, 250, 252, 109, 95,
+  110, 241, 63, 93, 226, 63, 206, 38, 197, 175, 72, 139, 41, 64, 186, 208,
+  100, 128, 26, 225, 6, 114, 111, 239, 35, 229, 95, 154, 0, 66, 33, 200, 87,
+  2, 129, 121, 16, 232, 11, 146, 169, 65, 220, 19, 231, 232, 35, 164, 240,
+  9, 162, 216, 3, 165, 204, 156, 24, 76, 250, 145, 231, 75, 249, 234, 241,
+  186, 79, 255, 83, 129, 127, 222, 255, 29, 61, 94, 8, 64, 21, 1, 44, 241,
+  111, 40, 224, 168, 193, 191, 201, 1, 33, 246, 22, 250, 94, 251, 223, 249,
+  0, 45, 39, 224, 2, 157, 0, 48, 83, 32, 170, 5, 186, 73, 192, 63, 45, 6, 182,
+  130, 148, 79, 36, 138, 11, 34, 138, 112, 236, 113, 226, 24, 127, 72, 34,
+  113, 14, 219, 31, 17, 157, 227, 235, 62, 115, 243, 109, 119, 182, 248, 159,
+  62, 91, 19, 192, 172, 106, 1, 107, 10, 216, 148, 128, 54, 0, 66, 240, 113,
+  248, 125, 31, 24, 147, 0, 184, 105, 32, 29, 1, 232, 72, 136, 49, 11, 75,
+  179, 128, 84, 21, 162, 148, 193, 136, 71, 17, 208, 108, 144, 176, 144, 147,
+  103, 16, 109, 177, 240, 151, 63, 123, 243, 237, 95, 190, 183, 196, 255, 88,
+  158, 255, 207, 44, 47, 175, 20, 5, 32, 179, 24, 192, 168, 41, 1, 205, 30,
+  183, 64, 183, 136, 63, 78, 255, 2, 13, 112, 1, 33, 128, 33, 7, 176, 111,
+  10, 243, 108, 97, 225, 73, 225, 208, 24, 196, 118, 130, 204, 136, 216, 68,
+  199, 128, 248, 110, 129, 184, 91, 5, 34, 14, 25, 163, 100, 1, 100, 134, 191,
+  242, 217, 47, 220, 126, 103, 131, 255, 201, 124, 255, 215, 4, 48, 171, 11,
+  128, 19, 0, 139, 109, 43, 184, 176, 232, 190, 197, 224, 7, 8, 224, 2, 32,
+  2, 187, 77, 160, 127, 67, 4, 56, 15, 4, 196, 64, 48, 3, 128, 141, 96, 74,
+  159, 24, 161, 166, 131, 232, 85, 195, 164, 38, 132, 30, 39, 226, 159, 72,
+  150, 68, 133, 2, 183, 255, 253, 190, 224, 127, 220, 244, 133, 219, 239, 186,
+  103, 127, 137, 255, 137, 83, 167, 171, 6, 160, 43, 0, 165, 10, 88, 237, 93,
+  59, 0, 22, 172, 164, 223, 246, 253, 29, 252, 139, 245, 47, 30, 1, 249, 223,
+  43, 1, 105, 48, 7, 64, 77, 161, 0, 9, 64, 35, 160, 95, 17, 224, 179, 0, 115,
+  140, 180, 103, 10, 64, 146, 62, 118, 19, 45, 118, 221, 68, 212, 25, 131,
+  58, 10, 94, 127, 211, 45, 95, 204, 247, 255, 193, 10, 255, 83, 13, 254, 117,
+  2, 40, 69, 32, 32, 0, 22, 220, 93, 111, 213, 126, 132, 254, 135, 4, 96, 33,
+  5, 7, 129, 20, 254, 16, 9, 160, 51, 0, 120, 129, 152, 180, 8, 244, 20, 134,
+  241, 249, 32, 123, 148, 204, 67, 83, 112, 53, 61, 18, 24, 56, 238, 190, 48,
+  248, 250, 207, 221, 242, 197, 187, 242, 252, 127, 232, 240, 145, 227, 39,
+  74, 1, 168, 32, 0, 21, 254, 101, 11, 152, 86, 115, 128, 138, 196, 215, 216,
+  90, 144, 91, 239, 189, 237, 143, 52, 128, 128, 19, 12, 193, 63, 144, 2, 177,
+  18, 32, 85, 3, 67, 224, 211, 240, 236, 56, 40, 15, 71, 53, 3, 242, 225, 0,
+  242, 24, 34, 137, 123, 116, 58, 255, 72, 23, 5, 191, 250, 185, 91, 190, 116,
+  215, 125, 45, 254, 167, 43, 252, 199, 53, 254, 45, 3, 24, 53, 1, 176, 208,
+  204, 247, 29, 216, 91, 236, 233, 242, 223, 237, 127, 71, 3, 10, 174, 134,
+  193, 165, 192, 132, 82, 2, 124, 252, 227, 5, 225, 136, 25, 113, 191, 36,
+  32, 122, 20, 77, 140, 89, 128, 138, 4, 70, 54, 44, 255, 127, 195, 231, 111,
+  185, 227, 174, 123, 247, 151, 248, 31, 207, 243, 127, 217, 0, 20, 10, 64,
+  195, 0, 43, 6, 80, 147, 64, 39, 5, 4, 63, 92, 233, 175, 185, 6, 164, 235,
+  255, 17, 6, 8, 14, 2, 25, 41, 16, 40, 1, 46, 254, 209, 198, 0, 236, 62, 49,
+  70, 24, 38, 79, 18, 243, 167, 8, 157, 93, 47, 190, 117, 174, 199, 53, 213,
+  158, 65, 164, 253, 202, 175, 125, 254, 214, 59, 238, 186, 175, 196, 255,
+  88, 185, 255, 207, 158, 59, 215, 22, 128, 196, 180, 12, 192, 10, 128, 54,
+  2, 2, 232, 195, 221, 15, 236, 127, 76, 3, 32, 240, 31, 49, 37, 0, 117, 5,
+  216, 20, 128, 30, 9, 24, 233, 233, 49, 195, 95, 45, 199, 206, 5, 2, 225,
+  63, 250, 46, 106, 82, 48, 228, 199, 134, 221, 47, 250, 245, 207, 223, 118,
+  199, 221, 5, 254, 15, 231, 252, 239, 100, 190, 255, 115, 252, 203, 17, 208,
+  164, 46, 0, 118, 5, 104, 2, 160, 65, 121, 209, 127, 179, 208, 121, 63, 195,
+  246, 191, 17, 0, 29, 13, 144, 86, 1, 209, 163, 65, 254, 61, 1, 48, 254, 136,
+  18, 144, 74, 43, 0, 54, 35, 36, 2, 64, 50, 30, 132, 251, 64, 252, 182, 137,
+  248, 177, 33, 16, 1, 16, 9, 200, 223, 252, 250, 205, 37, 254, 7, 107, 252,
+  75, 1, 32, 199, 191, 156, 1, 101, 73, 195, 0, 130, 0, 176, 66, 192, 249,
+  175, 109, 253, 58, 244, 195, 252, 31, 20, 0, 172, 2, 160, 37, 0, 60, 32,
+  72, 101, 128, 152, 26, 128, 22, 129, 126, 167, 70, 224, 39, 207, 192, 221,
+  129, 208, 58, 48, 93, 9, 176, 246, 127, 98, 126, 227, 230, 219, 239, 184,
+  251, 254, 253, 101, 255, 119, 188, 220, 255, 57, 254, 37, 1, 156, 152, 172,
+  252, 139, 89, 21, 160, 235, 3, 189, 16, 112, 254, 95, 0, 212, 95, 42, 255,
+  3, 34, 80, 0, 127, 168, 4, 65, 166, 32, 20, 127, 248, 30, 209, 84, 182, 247,
+  163, 142, 143, 138, 134, 1, 241, 183, 142, 78, 99, 29, 192, 199, 3, 249,
+  155, 223, 188, 249, 246, 47, 223, 115, 223, 129, 194, 255, 81, 224, 127,
+  186, 197, 127, 146, 89, 12, 32, 12, 128, 209, 162, 19, 3, 65, 226, 15, 224,
+  239, 6, 64, 174, 4, 220, 167, 2, 224, 58, 0, 106, 11, 192, 107, 64, 202,
+  195, 31, 147, 4, 220, 75, 229, 16, 164, 165, 231, 72, 4, 7, 76, 89, 23, 49,
+  165, 4, 37, 230, 55, 191, 240, 197, 47, 223, 147, 239, 255, 138, 255, 21,
+  248, 159, 45, 241, 175, 36, 192, 142, 1, 148, 216, 44, 120, 53, 192, 133,
+  125, 209, 250, 226, 136, 162, 127, 16, 1, 160, 198, 0, 150, 39, 208, 30,
+  7, 36, 238, 165, 161, 152, 57, 24, 191, 56, 40, 141, 82, 3, 37, 143, 156,
+  193, 31, 71, 30, 126, 26, 121, 235, 228, 116, 207, 45, 68, 85, 225, 55, 222,
+  82, 224, 127, 160, 194, 191, 18, 128, 151, 171, 6, 160, 210, 128, 219, 30,
+  176, 74, 1, 11, 65, 0, 44, 184, 216, 59, 190, 15, 11, 126, 7, 253, 133, 145,
+  119, 22, 8, 209, 129, 145, 2, 32, 213, 130, 97, 61, 208, 5, 95, 208, 11,
+  26, 254, 169, 83, 194, 187, 69, 5, 242, 144, 216, 56, 16, 245, 236, 66, 124,
+  20, 240, 63, 11, 249, 183, 220, 255, 117, 254, 63, 83, 225, 111, 21, 128,
+  182, 2, 164, 109, 5, 0, 66, 96, 17, 72, 252, 225, 246, 199, 8, 32, 58, 7,
+  192, 10, 128, 164, 13, 68, 51, 64, 128, 125, 202, 223, 34, 38, 123, 222,
+  12, 121, 197, 116, 47, 215, 32, 149, 8, 164, 30, 34, 34, 23, 188, 233, 150,
+  47, 229, 248, 31, 104, 240, 47, 28, 32, 21, 254, 227, 172, 214, 0, 77, 218,
+  84, 128, 70, 6, 232, 240, 31, 45, 16, 107, 68, 164, 127, 68, 2, 114, 241,
+  247, 53, 64, 152, 4, 226, 109, 32, 101, 12, 128, 56, 32, 121, 137, 144, 137,
+  211, 4, 49, 147, 32, 9, 127, 47, 252, 241, 8, 144, 28, 54, 127, 211, 173,
+  119, 220, 121, 239, 3, 86, 254, 63, 115, 246, 92, 161, 0, 142, 107, 9, 176,
+  102, 0, 93, 5, 240, 83, 192, 8, 131, 62, 72, 254, 78, 249, 95, 192, 241,
+  135, 100, 96, 220, 19, 72, 88, 66, 136, 75, 131, 228, 99, 65, 204, 43, 206,
+  248, 3, 144, 91, 102, 133, 15, 162, 138, 187, 132, 82, 112, 33, 53, 248,
+  243, 197, 155, 223, 186, 237, 75, 119, 21, 248, 63, 92, 225, 95, 10, 192,
+  37, 254, 69, 7, 152, 153, 142, 1, 88, 77, 64, 23, 1, 97, 8, 140, 2, 225,
+  199, 109, 254, 197, 248, 219, 102, 32, 11, 253, 145, 235, 9, 20, 212, 0,
+  255, 129, 66, 200, 137, 241, 84, 12, 127, 232, 20, 21, 224, 79, 6, 64, 100,
+  57, 144, 140, 10, 36, 240, 23, 255, 191, 249, 182, 59, 138, 241, 95, 157,
+  255, 75, 1, 120, 249, 92, 173, 0, 149, 248, 119, 12, 160, 14, 128, 116, 161,
+  107, 4, 253, 36, 48, 130, 74, 191, 95, 253, 61, 250, 111, 119, 128, 14, 254,
+  184, 23, 4, 76, 0, 178, 12, 192, 140, 5, 83, 129, 12, 104, 232, 46, 0, 129,
+  158, 160, 127, 49, 167, 137, 68, 119, 143, 129, 118, 114, 255, 203, 213,
+  187, 55, 223, 126, 199, 221, 247, 238, 63, 240, 80, 137, 127, 185, 255, 43,
+  252, 87, 38, 181, 4, 84, 21, 128, 90, 5, 74, 71, 13, 9, 4, 35, 96, 228, 111,
+  253, 230, 215, 0, 236, 15, 195, 159, 179, 130, 96, 9, 128, 168, 1, 212, 76,
+  72, 102, 13, 49, 209, 231, 133, 98, 207, 142, 244, 126, 46, 17, 209, 9, 112,
+  195, 130, 226, 255, 183, 220, 254, 229, 187, 239, 123, 32, 199, 255, 72,
+  149, 255, 243, 253, 95, 76, 0, 86, 198, 77, 7, 216, 49, 0, 171, 9, 104, 105,
+  224, 200, 66, 218, 221, 247, 206, 222, 119, 147, 63, 143, 191, 157, 254,
+  169, 12, 144, 68, 214, 0, 56, 3, 8, 143, 137, 136, 109, 33, 124, 0, 16, 49,
+  64, 88, 199, 226, 231, 4, 232, 141, 116, 109, 110, 120, 75, 222, 254, 223,
+  247, 192, 131, 15, 181, 249, 191, 20, 0, 42, 5, 168, 196, 223, 97, 0, 54,
+  7, 104, 35, 96, 100, 227, 237, 64, 15, 39, 127, 160, 254, 251, 18, 16, 49,
+  9, 30, 185, 219, 63, 24, 7, 9, 51, 128, 143, 126, 26, 103, 11, 192, 207,
+  12, 163, 183, 202, 68, 228, 1, 81, 115, 64, 95, 71, 205, 221, 68, 218, 124,
+  252, 219, 95, 188, 243, 238, 251, 115, 252, 31, 174, 243, 191, 131, 127,
+  163, 1, 154, 90, 79, 171, 75, 128, 87, 3, 130, 24, 112, 176, 15, 185, 31,
+  198, 255, 128, 41, 0, 59, 9, 74, 98, 107, 0, 121, 80, 44, 149, 246, 1, 68,
+  10, 96, 30, 68, 202, 200, 4, 241, 199, 203, 169, 1, 1, 114, 39, 185, 157,
+  12, 222, 250, 197, 59, 239, 185, 255, 129, 131, 7, 31, 238, 246, 127, 57,
+  1, 8, 10, 64, 210, 37, 128, 212, 201, 0, 118, 0, 56, 176, 91, 161, 65, 87,
+  127, 138, 0, 224, 147, 160, 132, 25, 6, 112, 248, 247, 200, 0, 148, 4, 76,
+  222, 43, 198, 184, 6, 251, 158, 40, 228, 7, 4, 152, 46, 208, 254, 228, 91,
+  191, 116, 215, 61, 247, 239, 119, 246, 127, 139, 127, 35, 1, 53, 20, 176,
+  225, 128, 53, 78, 11, 110, 17, 24, 121, 59, 222, 206, 252, 116, 246, 119,
+  27, 64, 170, 0, 32, 131, 32, 39, 255, 211, 248, 99, 247, 199, 198, 30, 20,
+  131, 111, 17, 227, 10, 131, 240, 20, 81, 143, 235, 5, 96, 111, 1, 145, 251,
+  235, 47, 253, 78, 222, 254, 151, 248, 151, 252, 175, 216, 255, 133, 0, 80,
+  41, 128, 147, 90, 2, 168, 24, 128, 67, 1, 224, 20, 16, 0, 191, 48, 114, 246,
+  62, 170, 254, 242, 5, 160, 99, 128, 129, 33, 20, 162, 0, 176, 33, 128, 61,
+  39, 8, 187, 132, 13, 123, 78, 136, 174, 10, 80, 16, 68, 94, 56, 26, 131,
+  190, 236, 65, 117, 245, 151, 126, 39, 111, 255, 239, 63, 240, 224, 161, 58,
+  255, 87, 251, 191, 192, 127, 101, 60, 105, 36, 32, 99, 81, 192, 100, 148,
+  166, 54, 254, 112, 8, 132, 91, 223, 130, 126, 97, 100, 141, 127, 218, 223,
+  41, 37, 11, 0, 55, 10, 70, 92, 129, 216, 85, 33, 228, 197, 113, 169, 116,
+  34, 104, 184, 146, 0, 36, 3, 241, 49, 34, 186, 37, 140, 8, 6, 116, 32, 80,
+  190, 123, 91, 222, 254, 223, 127, 224, 96, 177, 255, 143, 151, 6, 224, 211,
+  45, 254, 53, 1, 168, 25, 128, 73, 109, 25, 200, 75, 1, 22, 198, 0, 242, 192,
+  230, 95, 0, 217, 63, 236, 3, 9, 243, 255, 8, 68, 223, 135, 31, 55, 4, 64,
+  167, 196, 124, 240, 83, 153, 37, 136, 78, 0, 88, 111, 96, 162, 238, 24, 235,
+  57, 36, 34, 237, 129, 205, 175, 255, 221, 28, 255, 7, 74, 252, 155, 253,
+  127, 102, 185, 158, 0, 212, 29, 160, 205, 0, 146, 212, 37, 129, 169, 205,
+  231, 44, 248, 189, 125, 79, 162, 143, 245, 255, 152, 12, 76, 157, 10, 241,
+  224, 71, 31, 34, 197, 12, 4, 132, 15, 23, 19, 42, 131, 88, 163, 96, 152,
+  222, 80, 16, 1, 49, 246, 114, 152, 23, 254, 110, 41, 255, 28, 60, 100, 239,
+  255, 82, 0, 178, 58, 192, 150, 1, 36, 41, 156, 1, 92, 46, 232, 163, 190,
+  96, 133, 7, 82, 253, 137, 0, 128, 69, 160, 17, 213, 2, 210, 109, 32, 106,
+  10, 72, 145, 137, 160, 73, 40, 171, 176, 161, 239, 23, 199, 142, 146, 198,
+  214, 1, 215, 35, 40, 71, 31, 61, 93, 82, 191, 123, 123, 33, 255, 148, 248,
+  183, 251, 191, 18, 0, 90, 2, 96, 49, 128, 46, 1, 52, 25, 32, 117, 106, 249,
+  194, 200, 3, 61, 200, 252, 182, 243, 195, 201, 254, 72, 250, 103, 236, 224,
+  132, 8, 4, 249, 66, 193, 16, 136, 153, 7, 25, 233, 120, 136, 137, 2, 246,
+  73, 84, 177, 15, 170, 71, 164, 129, 64, 12, 242, 179, 66, 242, 246, 59, 239,
+  185, 111, 127, 49, 254, 61, 124, 180, 220, 255, 167, 44, 252, 139, 253, 223,
+  224, 95, 139, 64, 118, 19, 144, 90, 133, 123, 193, 163, 2, 1, 242, 11, 163,
+  17, 190, 255, 211, 240, 44, 56, 4, 63, 96, 6, 99, 40, 0, 126, 66, 20, 174,
+  0, 17, 135, 132, 56, 139, 8, 159, 2, 132, 61, 161, 252, 138, 49, 86, 20,
+  2, 190, 246, 123, 133, 252, 83, 140, 255, 154, 253, 95, 228, 255, 229, 106,
+  2, 208, 117, 128, 89, 210, 138, 64, 93, 19, 224, 215, 0, 43, 0, 60, 224,
+  67, 217, 103, 1, 216, 253, 200, 246, 135, 84, 224, 145, 44, 1, 4, 182, 96,
+  238, 190, 24, 80, 9, 74, 27, 84, 201, 235, 131, 36, 1, 0, 111, 255, 168,
+  135, 209, 69, 115, 65, 166, 44, 252, 222, 93, 247, 222, 183, 255, 193, 131,
+  15, 231, 249, 191, 216, 255, 101, 254, 175, 241, 95, 169, 246, 255, 196,
+  100, 93, 1, 232, 40, 64, 151, 1, 82, 63, 0, 28, 204, 157, 47, 8, 183, 63,
+  9, 191, 141, 253, 8, 186, 32, 8, 29, 5, 177, 198, 80, 209, 173, 97, 84, 65,
+  48, 18, 78, 216, 247, 174, 217, 248, 233, 160, 128, 24, 190, 163, 146, 127,
+  242, 250, 127, 172, 222, 255, 69, 254, 95, 118, 8, 96, 214, 22, 128, 54,
+  1, 180, 180, 12, 137, 0, 111, 203, 187, 180, 127, 193, 175, 253, 0, 250,
+  22, 247, 143, 96, 0, 100, 11, 200, 94, 21, 225, 166, 255, 20, 60, 44, 76,
+  28, 24, 139, 13, 128, 136, 73, 49, 119, 249, 60, 127, 116, 0, 139, 144, 119,
+  20, 237, 127, 49, 254, 203, 243, 255, 137, 106, 255, 159, 113, 240, 183,
+  90, 192, 134, 2, 118, 93, 96, 91, 2, 210, 17, 152, 4, 60, 228, 65, 234, 239,
+  12, 255, 58, 236, 9, 248, 97, 55, 40, 153, 0, 56, 83, 24, 13, 191, 144, 15,
+  80, 23, 12, 243, 1, 64, 238, 127, 52, 10, 250, 226, 223, 228, 128, 119, 230,
+  237, 255, 254, 131, 37, 254, 199, 139, 253, 127, 234, 76, 37, 0, 86, 248,
+  183, 18, 80, 86, 255, 94, 213, 139, 213, 152, 1, 108, 18, 0, 68, 0, 176,
+  227, 193, 185, 143, 39, 254, 225, 229, 223, 66, 127, 20, 97, 5, 96, 196,
+  96, 90, 10, 38, 47, 142, 193, 51, 130, 232, 97, 19, 226, 115, 100, 100, 67,
+  136, 93, 48, 99, 184, 167, 23, 22, 163, 128, 119, 222, 115, 239, 3, 7, 30,
+  60, 84, 216, 63, 171, 253, 127, 186, 197, 191, 28, 1, 149, 29, 96, 215, 2,
+  154, 212, 233, 2, 219, 18, 16, 70, 0, 1, 250, 130, 147, 250, 101, 229, 223,
+  169, 254, 35, 98, 255, 3, 9, 0, 45, 0, 132, 6, 228, 193, 207, 20, 3, 81,
+  99, 200, 94, 45, 71, 223, 38, 208, 99, 50, 32, 144, 136, 127, 255, 238, 251,
+  246, 231, 251, 255, 225, 195, 71, 139, 252, 127, 234, 100, 153, 255, 207,
+  158, 171, 21, 224, 114, 255, 59, 45, 160, 91, 2, 70, 157, 41, 12, 138, 0,
+  34, 233, 131, 218, 47, 41, 255, 17, 18, 16, 48, 11, 118, 7, 129, 209, 158,
+  64, 180, 22, 164, 177, 149, 64, 48, 31, 50, 146, 171, 133, 250, 93, 54, 200,
+  182, 6, 191, 159, 183, 127, 7, 42, 252, 143, 55, 252, 239, 172, 133, 255,
+  56, 235, 36, 0, 59, 0, 210, 198, 14, 130, 164, 128, 148, 134, 157, 201, 254,
+  4, 252, 184, 29, 28, 155, 4, 49, 183, 196, 16, 61, 0, 60, 23, 74, 123, 75,
+  3, 194, 0, 160, 15, 149, 163, 224, 247, 50, 142, 190, 171, 108, 255, 203,
+  241, 175, 157, 255, 75, 252, 75, 5, 176, 128, 191, 240, 129, 118, 12, 192,
+  225, 128, 13, 64, 93, 242, 30, 97, 137, 128, 71, 159, 134, 31, 72, 255, 35,
+  120, 255, 79, 35, 3, 145, 214, 32, 89, 107, 24, 79, 4, 12, 105, 30, 37, 78,
+  150, 201, 53, 34, 196, 36, 240, 174, 188, 253, 171, 228, 255, 99, 165, 255,
+  51, 231, 127, 165, 0, 184, 188, 226, 16, 128, 150, 1, 116, 61, 64, 87, 2,
+  236, 20, 144, 162, 248, 167, 40, 250, 88, 247, 231, 55, 0, 104, 250, 7, 220,
+  0, 193, 201, 80, 164, 251, 131, 19, 0, 88, 13, 132, 181, 192, 244, 121, 236,
+  148, 44, 0, 152, 24, 136, 200, 5, 45, 254, 127, 80, 180, 255, 21, 254, 77,
+  254, 175, 4, 224, 142, 0, 116, 18, 128, 169, 255, 118, 105, 80, 2, 236, 182,
+  109, 132, 70, 65, 26, 9, 127, 184, 255, 67, 254, 55, 10, 205, 160, 220, 115,
+  163, 188, 250, 239, 38, 0, 196, 30, 76, 248, 4, 83, 22, 124, 172, 33, 68,
+  2, 128, 148, 132, 217, 171, 6, 217, 235, 135, 61, 252, 31, 168, 228, 159,
+  28, 255, 54, 255, 159, 237, 240, 175, 36, 224, 18, 255, 44, 105, 2, 32, 13,
+  74, 64, 71, 216, 58, 30, 144, 226, 176, 3, 188, 15, 132, 223, 99, 255, 78,
+  237, 31, 177, 251, 31, 79, 0, 24, 5, 4, 4, 1, 236, 226, 128, 72, 113, 144,
+  187, 66, 0, 30, 10, 71, 223, 50, 22, 45, 13, 188, 187, 104, 255, 74, 249,
+  247, 232, 241, 50, 255, 183, 248, 151, 10, 112, 185, 255, 237, 2, 96, 186,
+  168, 79, 237, 105, 160, 27, 0, 105, 144, 3, 0, 224, 29, 213, 31, 135, 31,
+  160, 127, 168, 0, 132, 26, 130, 217, 99, 97, 200, 72, 128, 121, 172, 80,
+  42, 197, 159, 208, 5, 33, 57, 56, 46, 21, 132, 9, 128, 119, 13, 181, 248,
+  223, 247, 64, 35, 255, 29, 59, 81, 233, 63, 121, 254, 63, 219, 225, 223,
+  36, 0, 175, 5, 104, 101, 181, 212, 169, 1, 233, 200, 161, 130, 105, 144,
+  235, 125, 232, 169, 228, 31, 136, 63, 116, 253, 15, 192, 7, 189, 0, 248,
+  179, 228, 69, 238, 144, 112, 251, 167, 226, 30, 128, 246, 142, 138, 152,
+  128, 204, 49, 200, 92, 65, 110, 255, 196, 187, 203, 246, 175, 195, 191, 174,
+  255, 203, 231, 44, 5, 208, 146, 0, 130, 0, 104, 57, 0, 154, 3, 60, 188, 67,
+  232, 41, 248, 225, 233, 15, 177, 255, 195, 51, 129, 132, 31, 24, 225, 129,
+  232, 77, 226, 120, 35, 152, 202, 240, 23, 92, 50, 79, 162, 207, 244, 132,
+  130, 51, 165, 126, 69, 120, 79, 49, 253, 207, 219, 255, 98, 252, 219, 244,
+  255, 103, 90, 252, 237, 14, 208, 109, 1, 108, 33, 24, 47, 2, 1, 29, 64, 176,
+  183, 190, 39, 132, 127, 148, 58, 245, 31, 186, 13, 128, 115, 131, 243, 135,
+  130, 208, 80, 160, 39, 196, 0, 238, 41, 211, 3, 162, 6, 17, 246, 17, 132,
+  180, 64, 76, 155, 71, 177, 31, 239, 169, 218, 191, 18, 127, 171, 254, 187,
+  13, 64, 221, 1, 52, 34, 160, 9, 43, 128, 37, 6, 226, 33, 0, 228, 124, 112,
+  239, 35, 228, 31, 228, 255, 193, 113, 176, 32, 245, 123, 240, 251, 216, 67,
+  65, 128, 94, 27, 35, 123, 188, 156, 228, 34, 25, 156, 8, 8, 115, 129, 192,
+  55, 72, 41, 255, 205, 79, 190, 39, 167, 255, 181, 252, 123, 188, 237, 255,
+  109, 252, 187, 14, 176, 43, 0, 166, 77, 0, 84, 0, 216, 29, 97, 138, 236,
+  122, 31, 124, 100, 243, 139, 250, 127, 129, 25, 28, 120, 120, 164, 31, 13,
+  140, 67, 8, 185, 76, 88, 124, 114, 140, 184, 71, 68, 54, 26, 68, 129, 151,
+  90, 199, 221, 137, 208, 123, 239, 63, 240, 96, 185, 255, 143, 229, 248, 55,
+  245, 191, 195, 191, 56, 6, 94, 73, 192, 85, 11, 104, 154, 14, 210, 150, 129,
+  172, 121, 176, 29, 3, 88, 30, 240, 144, 199, 115, 63, 171, 254, 142, 88,
+  253, 39, 145, 92, 16, 196, 114, 2, 162, 4, 112, 227, 65, 226, 145, 179, 172,
+  83, 144, 117, 136, 244, 16, 134, 188, 15, 205, 123, 139, 246, 239, 208, 97,
+  4, 255, 21, 139, 0, 58, 45, 128, 233, 18, 64, 146, 166, 174, 22, 136, 37,
+  1, 252, 63, 172, 241, 131, 202, 63, 53, 0, 160, 198, 192, 33, 5, 192, 18,
+  1, 201, 3, 167, 52, 10, 81, 240, 139, 46, 22, 240, 72, 32, 117, 201, 12,
+  17, 9, 221, 231, 239, 43, 219, 191, 82, 254, 13, 240, 63, 55, 174, 70, 64,
+  30, 254, 237, 159, 157, 90, 50, 64, 226, 20, 231, 145, 159, 4, 224, 253,
+  142, 229, 125, 23, 123, 100, 251, 143, 200, 236, 79, 239, 127, 120, 34, 28,
+  101, 18, 78, 147, 30, 19, 1, 132, 1, 144, 151, 11, 97, 167, 198, 56, 85,
+  136, 228, 3, 237, 143, 247, 85, 237, 95, 57, 254, 59, 209, 242, 255, 90,
+  0, 202, 225, 95, 153, 116, 9, 192, 148, 21, 32, 113, 2, 192, 234, 2, 18,
+  11, 25, 55, 5, 4, 137, 0, 165, 124, 96, 234, 183, 209, 247, 176, 31, 201,
+  206, 2, 134, 131, 64, 42, 15, 144, 17, 192, 60, 92, 48, 229, 71, 65, 33,
+  218, 132, 125, 28, 195, 58, 110, 62, 132, 228, 134, 252, 237, 251, 202, 246,
+  175, 148, 255, 10, 252, 79, 159, 58, 115, 218, 198, 191, 86, 128, 138, 14,
+  176, 196, 223, 106, 1, 76, 155, 0, 90, 41, 56, 25, 185, 51, 33, 44, 2, 194,
+  109, 15, 96, 15, 104, 63, 44, 255, 75, 184, 246, 47, 172, 5, 244, 85, 17,
+  236, 89, 33, 161, 28, 108, 4, 149, 128, 186, 93, 204, 206, 246, 18, 81, 88,
+  124, 181, 192, 251, 139, 246, 239, 208, 225, 114, 252, 115, 226, 100, 193,
+  255, 11, 3, 120, 131, 127, 219, 0, 148, 1, 96, 60, 17, 200, 116, 1, 224,
+  118, 96, 118, 10, 64, 242, 128, 3, 57, 128, 61, 130, 62, 114, 4, 0, 113,
+  1, 67, 87, 132, 83, 190, 48, 214, 30, 192, 114, 192, 148, 59, 49, 130, 31,
+  30, 132, 241, 39, 61, 34, 220, 116, 16, 74, 1, 94, 19, 240, 254, 114, 250,
+  87, 158, 254, 41, 241, 175, 234, 191, 131, 255, 184, 37, 128, 89, 83, 0,
+  154, 0, 72, 3, 29, 32, 177, 50, 180, 27, 1, 96, 162, 7, 179, 62, 196, 252,
+  5, 246, 15, 40, 251, 67, 29, 160, 208, 29, 204, 157, 20, 139, 229, 128, 220,
+  189, 226, 146, 17, 33, 61, 27, 166, 92, 131, 64, 60, 148, 31, 190, 191, 110,
+  255, 92, 252, 235, 1, 64, 211, 0, 180, 29, 160, 213, 2, 24, 59, 230, 83,
+  155, 4, 32, 17, 144, 142, 4, 63, 240, 198, 63, 216, 253, 35, 154, 252, 65,
+  21, 192, 139, 3, 168, 12, 8, 142, 137, 200, 19, 128, 145, 198, 129, 137,
+  60, 55, 100, 100, 115, 1, 193, 253, 34, 239, 63, 112, 176, 192, 255, 232,
+  209, 202, 254, 211, 242, 127, 171, 1, 176, 58, 64, 187, 0, 16, 1, 224, 71,
+  0, 19, 4, 178, 202, 79, 158, 0, 134, 14, 2, 187, 251, 31, 107, 8, 184, 217,
+  0, 151, 0, 162, 159, 48, 27, 5, 127, 175, 24, 240, 159, 84, 77, 5, 194, 7,
+  202, 233, 95, 45, 255, 218, 248, 47, 231, 240, 55, 13, 192, 216, 193, 223,
+  174, 0, 97, 0, 36, 206, 246, 12, 160, 132, 241, 14, 202, 62, 154, 251, 113,
+  246, 151, 144, 243, 95, 42, 4, 68, 17, 208, 247, 137, 82, 125, 30, 52, 21,
+  74, 130, 50, 113, 152, 63, 81, 30, 204, 137, 63, 80, 210, 255, 90, 254, 5,
+  240, 111, 26, 128, 54, 0, 188, 10, 96, 172, 249, 169, 45, 5, 121, 114, 0,
+  18, 2, 104, 214, 39, 192, 247, 220, 127, 9, 17, 2, 9, 194, 6, 1, 81, 88,
+  216, 6, 196, 220, 25, 193, 238, 127, 114, 42, 132, 223, 50, 75, 63, 155,
+  222, 0, 114, 17, 14, 127, 242, 129, 7, 203, 246, 175, 148, 127, 156, 250,
+  95, 225, 95, 229, 255, 113, 88, 0, 76, 215, 139, 224, 1, 96, 79, 134, 189,
+  16, 128, 112, 31, 165, 92, 234, 231, 118, 63, 54, 1, 228, 40, 33, 99, 16,
+  145, 24, 2, 122, 228, 0, 206, 38, 238, 95, 48, 36, 126, 30, 41, 233, 20,
+  113, 75, 194, 7, 15, 60, 84, 181, 255, 199, 78, 148, 199, 127, 44, 252, 43,
+  254, 87, 143, 128, 109, 13, 48, 107, 175, 16, 179, 117, 64, 155, 88, 9, 66,
+  0, 222, 241, 108, 219, 199, 41, 63, 1, 1, 8, 63, 0, 193, 199, 143, 8, 198,
+  201, 128, 61, 28, 226, 204, 100, 144, 191, 90, 38, 194, 45, 20, 152, 132,
+  62, 88, 210, 255, 195, 71, 107, 249, 55, 192, 191, 81, 128, 45, 252, 51,
+  63, 1, 216, 122, 185, 179, 5, 29, 176, 70, 41, 27, 3, 76, 217, 231, 173,
+  255, 129, 4, 4, 195, 207, 41, 130, 148, 71, 148, 158, 5, 99, 208, 167, 114,
+  77, 192, 128, 226, 160, 17, 61, 122, 66, 120, 233, 172, 21, 15, 31, 44, 212,
+  255, 195, 141, 252, 231, 225, 95, 89, 192, 218, 17, 64, 165, 1, 55, 5, 160,
+  251, 141, 188, 0, 72, 82, 128, 6, 184, 57, 28, 136, 129, 16, 120, 209, 230,
+  135, 220, 191, 94, 20, 18, 93, 1, 45, 5, 114, 50, 0, 169, 1, 76, 119, 135,
+  132, 65, 207, 144, 138, 142, 144, 113, 183, 141, 118, 31, 125, 240, 96, 133,
+  127, 209, 254, 21, 199, 191, 90, 253, 167, 157, 0, 143, 219, 2, 80, 105,
+  192, 13, 5, 180, 43, 128, 43, 5, 7, 44, 32, 0, 113, 148, 166, 252, 166, 23,
+  14, 125, 208, 236, 15, 223, 13, 4, 185, 66, 208, 185, 16, 243, 8, 25, 120,
+  12, 144, 38, 194, 98, 32, 127, 212, 152, 252, 20, 153, 47, 22, 147, 218,
+  80, 254, 238, 131, 37, 253, 175, 229, 159, 98, 252, 83, 227, 191, 108, 9,
+  64, 45, 1, 172, 241, 207, 128, 4, 144, 56, 35, 20, 7, 128, 17, 28, 4, 163,
+  148, 217, 243, 88, 222, 31, 193, 137, 63, 232, 0, 194, 32, 72, 144, 167,
+  134, 177, 248, 227, 214, 112, 185, 22, 156, 178, 115, 161, 254, 247, 9, 177,
+  135, 201, 208, 33, 241, 245, 245, 244, 143, 196, 191, 149, 0, 161, 4, 96,
+  28, 21, 192, 97, 129, 9, 144, 3, 130, 36, 0, 10, 124, 80, 199, 71, 185, 62,
+  67, 240, 129, 227, 0, 184, 14, 144, 32, 17, 128, 226, 143, 28, 21, 12, 43,
+  65, 218, 67, 8, 96, 106, 1, 132, 125, 111, 38, 112, 125, 49, 253, 105, 218,
+  255, 162, 254, 159, 105, 240, 95, 94, 105, 38, 128, 22, 1, 156, 16, 9, 128,
+  173, 1, 80, 16, 192, 104, 35, 91, 159, 245, 253, 99, 205, 0, 98, 10, 12,
+  240, 199, 84, 32, 182, 1, 160, 206, 139, 74, 28, 194, 177, 89, 32, 66, 19,
+  160, 123, 129, 235, 31, 42, 204, 191, 69, 251, 127, 252, 100, 101, 255, 108,
+  241, 239, 4, 128, 78, 1, 104, 241, 207, 218, 155, 132, 67, 33, 208, 174,
+  1, 32, 15, 128, 163, 32, 12, 1, 168, 234, 143, 192, 188, 15, 131, 14, 192,
+  15, 224, 15, 206, 0, 164, 248, 99, 23, 135, 68, 202, 2, 132, 79, 128, 47,
+  0, 162, 243, 228, 72, 17, 184, 190, 164, 127, 173, 252, 147, 227, 95, 205,
+  127, 59, 7, 88, 71, 0, 235, 25, 80, 39, 2, 182, 243, 229, 118, 22, 104, 119,
+  1, 9, 176, 29, 71, 208, 123, 160, 46, 200, 55, 62, 218, 2, 146, 20, 128,
+  209, 128, 229, 87, 5, 192, 60, 160, 151, 63, 148, 78, 3, 166, 79, 18, 224,
+  149, 161, 235, 43, 245, 63, 111, 255, 142, 159, 172, 235, 255, 217, 51, 149,
+  254, 219, 9, 0, 174, 4, 108, 21, 0, 99, 156, 171, 142, 83, 81, 10, 128, 200,
+  28, 152, 15, 48, 206, 71, 97, 15, 88, 193, 169, 67, 97, 232, 12, 64, 240,
+  240, 32, 252, 180, 120, 196, 147, 133, 196, 100, 192, 48, 82, 0, 43, 10,
+  194, 58, 241, 13, 165, 249, 175, 108, 255, 43, 249, 215, 193, 191, 20, 0,
+  74, 5, 176, 84, 0, 44, 252, 155, 41, 64, 216, 4, 192, 41, 32, 129, 225, 15,
+  246, 56, 118, 196, 115, 36, 235, 251, 152, 3, 161, 2, 99, 24, 128, 190, 248,
+  108, 32, 49, 25, 142, 156, 14, 26, 254, 177, 51, 210, 4, 64, 62, 143, 44,
+  185, 161, 158, 254, 212, 242, 239, 169, 51, 150, 254, 211, 10, 0, 174, 4,
+  28, 36, 0, 135, 3, 52, 36, 208, 146, 86, 125, 140, 70, 88, 54, 160, 146,
+  126, 112, 213, 195, 8, 24, 253, 80, 145, 145, 80, 119, 132, 194, 46, 0, 95,
+  7, 38, 250, 128, 41, 143, 10, 179, 89, 0, 154, 9, 245, 189, 96, 216, 254,
+  47, 199, 191, 107, 255, 42, 251, 175, 203, 255, 44, 2, 232, 226, 223, 245,
+  128, 46, 7, 180, 219, 0, 188, 23, 164, 67, 64, 88, 242, 9, 240, 65, 248,
+  17, 95, 24, 234, 3, 162, 167, 0, 208, 229, 177, 204, 1, 129, 222, 89, 128,
+  209, 131, 240, 35, 68, 134, 177, 142, 221, 112, 168, 154, 254, 88, 242, 111,
+  139, 127, 59, 1, 198, 11, 128, 195, 1, 141, 245, 2, 216, 106, 112, 2, 23,
+  1, 148, 19, 204, 0, 124, 28, 126, 114, 10, 44, 116, 130, 162, 165, 32, 237,
+  159, 255, 227, 44, 163, 200, 136, 88, 122, 169, 68, 23, 0, 55, 84, 234, 127,
+  219, 254, 87, 247, 63, 212, 252, 191, 219, 255, 77, 3, 16, 36, 128, 142,
+  2, 132, 28, 192, 177, 93, 138, 66, 32, 18, 122, 226, 247, 75, 164, 182, 48,
+  124, 0, 0, 65, 143, 167, 1, 177, 55, 48, 157, 166, 0, 244, 188, 89, 20, 47,
+  8, 55, 212, 244, 255, 216, 137, 110, 252, 211, 242, 191, 182, 1, 132, 8,
+  128, 149, 0, 172, 39, 31, 2, 37, 192, 245, 224, 8, 66, 128, 184, 222, 73,
+  6, 126, 216, 15, 64, 253, 63, 61, 2, 66, 206, 132, 135, 211, 64, 84, 24,
+  230, 175, 10, 72, 9, 91, 8, 8, 126, 216, 18, 10, 239, 151, 6, 244, 224, 186,
+  254, 151, 244, 175, 105, 255, 154, 252, 191, 124, 214, 205, 255, 173, 2,
+  212, 73, 0, 97, 2, 240, 117, 0, 40, 2, 64, 46, 144, 176, 91, 63, 137, 66,
+  31, 30, 7, 83, 18, 160, 112, 250, 135, 127, 22, 89, 1, 210, 30, 217, 63,
+  8, 131, 152, 7, 141, 160, 140, 224, 134, 135, 15, 215, 211, 159, 90, 254,
+  63, 125, 214, 173, 255, 206, 254, 135, 19, 64, 71, 1, 236, 18, 224, 201,
+  40, 174, 28, 144, 200, 112, 20, 209, 251, 24, 252, 217, 9, 0, 237, 1, 21,
+  221, 19, 192, 60, 83, 170, 159, 30, 32, 105, 8, 177, 243, 163, 84, 17, 184,
+  161, 80, 255, 106, 252, 79, 181, 246, 127, 187, 254, 219, 13, 64, 167, 1,
+  91, 9, 0, 160, 0, 144, 22, 148, 96, 17, 144, 72, 240, 78, 98, 224, 143, 33,
+  127, 66, 3, 88, 4, 254, 196, 88, 40, 34, 9, 24, 193, 117, 130, 188, 79, 148,
+  196, 191, 172, 255, 53, 253, 107, 218, 191, 58, 255, 47, 183, 3, 32, 187,
+  1, 104, 240, 175, 2, 192, 73, 0, 118, 5, 176, 254, 217, 105, 216, 10, 6,
+  178, 96, 130, 131, 154, 200, 62, 145, 184, 1, 57, 23, 40, 117, 52, 28, 192,
+  159, 59, 30, 70, 243, 192, 52, 94, 8, 16, 121, 4, 196, 79, 33, 235, 248,
+  223, 225, 195, 86, 251, 87, 202, 255, 110, 253, 239, 26, 128, 166, 3, 108,
+  108, 64, 246, 28, 176, 83, 1, 156, 105, 96, 88, 3, 60, 91, 46, 56, 178, 195,
+  85, 189, 36, 14, 126, 130, 252, 81, 237, 31, 26, 4, 44, 254, 105, 66, 224,
+  159, 82, 44, 80, 120, 82, 0, 63, 73, 204, 233, 195, 6, 158, 17, 150, 248,
+  151, 211, 159, 70, 254, 117, 242, 127, 33, 0, 91, 19, 128, 214, 6, 214, 142,
+  129, 107, 47, 168, 117, 210, 208, 251, 167, 121, 47, 103, 26, 180, 3, 222,
+  59, 184, 115, 75, 201, 47, 70, 110, 127, 145, 250, 35, 188, 44, 72, 224,
+  13, 38, 224, 143, 50, 140, 27, 246, 58, 33, 119, 215, 83, 57, 160, 227, 255,
+  101, 249, 111, 218, 255, 114, 252, 235, 229, 255, 102, 255, 143, 29, 252,
+  171, 237, 31, 80, 64, 219, 183, 104, 189, 32, 238, 72, 32, 129, 186, 1, 204,
+  179, 131, 206, 246, 18, 116, 22, 156, 200, 201, 31, 116, 26, 156, 60, 16,
+  216, 27, 255, 168, 145, 32, 99, 19, 231, 174, 148, 18, 77, 7, 58, 252, 143,
+  29, 61, 110, 201, 63, 37, 253, 239, 12, 128, 77, 7, 56, 105, 9, 64, 131,
+  63, 68, 1, 253, 12, 144, 66, 73, 0, 36, 2, 9, 120, 134, 7, 153, 228, 51,
+  132, 49, 17, 9, 255, 172, 251, 139, 189, 32, 134, 214, 131, 129, 203, 131,
+  41, 10, 144, 50, 231, 68, 112, 49, 128, 59, 60, 128, 182, 133, 69, 253, 63,
+  82, 171, 255, 101, 251, 87, 217, 63, 138, 243, 255, 109, 254, 111, 38, 128,
+  29, 1, 104, 143, 130, 58, 20, 208, 193, 223, 120, 19, 113, 235, 165, 3, 36,
+  161, 4, 54, 237, 195, 149, 33, 137, 48, 0, 36, 220, 129, 80, 194, 252, 67,
+  132, 130, 80, 8, 166, 182, 127, 95, 49, 192, 208, 95, 137, 23, 7, 111, 56,
+  82, 153, 127, 154, 246, 175, 28, 255, 214, 249, 191, 225, 127, 14, 1, 168,
+  9, 96, 80, 1, 18, 64, 6, 240, 105, 160, 207, 4, 19, 220, 158, 239, 161, 157,
+  72, 138, 127, 34, 57, 11, 200, 11, 191, 12, 250, 236, 230, 23, 220, 28, 221,
+  71, 14, 48, 236, 189, 146, 56, 39, 244, 58, 65, 235, 195, 27, 142, 212, 234,
+  111, 219, 254, 215, 252, 239, 220, 178, 189, 255, 171, 4, 224, 226, 223,
+  192, 223, 12, 2, 201, 12, 224, 135, 128, 31, 0, 128, 54, 139, 184, 55, 40,
+  25, 32, 193, 15, 2, 226, 178, 15, 4, 62, 202, 3, 5, 195, 64, 214, 27, 198,
+  144, 128, 52, 202, 28, 4, 118, 4, 196, 238, 247, 26, 129, 27, 26, 250, 119,
+  226, 84, 145, 255, 207, 88, 251, 223, 21, 128, 2, 2, 232, 106, 64, 30, 7,
+  12, 72, 128, 219, 56, 165, 1, 19, 128, 232, 121, 154, 162, 52, 145, 113,
+  255, 144, 178, 15, 115, 244, 35, 190, 4, 160, 26, 48, 34, 6, 167, 18, 135,
+  184, 224, 192, 16, 205, 4, 224, 250, 239, 235, 194, 55, 20, 221, 127, 69,
+  255, 59, 249, 199, 219, 255, 77, 254, 31, 3, 248, 195, 21, 32, 20, 2, 92,
+  225, 44, 172, 3, 65, 36, 192, 181, 155, 217, 247, 240, 206, 23, 103, 127,
+  41, 19, 132, 167, 64, 84, 19, 192, 249, 131, 123, 8, 66, 6, 238, 4, 196,
+  215, 72, 212, 250, 239, 145, 142, 254, 181, 227, 191, 96, 255, 7, 4, 208,
+  209, 128, 218, 57, 144, 165, 3, 26, 32, 169, 165, 9, 17, 0, 225, 127, 0,
+  250, 9, 239, 249, 76, 208, 204, 207, 152, 190, 32, 224, 49, 55, 184, 224,
+  118, 32, 46, 8, 40, 14, 144, 70, 157, 25, 23, 28, 34, 51, 232, 148, 224,
+  134, 34, 253, 151, 230, 47, 171, 253, 239, 250, 191, 86, 0, 182, 9, 160,
+  219, 2, 90, 5, 192, 157, 5, 226, 53, 0, 46, 184, 88, 111, 8, 56, 136, 18,
+  70, 236, 17, 12, 124, 128, 4, 32, 229, 128, 162, 187, 33, 68, 207, 19, 138,
+  201, 3, 162, 155, 164, 192, 24, 192, 135, 68, 53, 254, 181, 250, 223, 229,
+  127, 111, 255, 87, 19, 128, 0, 127, 79, 3, 240, 240, 183, 75, 81, 154, 96,
+  60, 16, 210, 133, 130, 58, 144, 128, 34, 49, 34, 20, 226, 167, 253, 96, 213,
+  79, 220, 7, 136, 76, 97, 132, 67, 156, 117, 134, 71, 63, 91, 14, 49, 135,
+  176, 51, 66, 235, 179, 27, 74, 245, 199, 198, 255, 172, 87, 255, 155, 253,
+  31, 72, 192, 158, 10, 28, 54, 1, 38, 129, 139, 0, 24, 2, 64, 16, 224, 246,
+  177, 4, 231, 123, 196, 214, 199, 175, 125, 32, 106, 63, 110, 6, 135, 19,
+  0, 234, 10, 101, 6, 130, 253, 77, 162, 38, 194, 41, 20, 8, 195, 55, 28, 237,
+  232, 127, 213, 254, 33, 251, 191, 85, 0, 61, 6, 88, 239, 255, 102, 14, 224,
+  220, 61, 10, 140, 3, 192, 28, 0, 84, 2, 152, 12, 160, 249, 94, 94, 246, 193,
+  189, 47, 225, 127, 156, 16, 76, 61, 60, 136, 189, 51, 138, 237, 3, 69, 254,
+  80, 249, 149, 82, 29, 255, 47, 233, 223, 241, 147, 86, 251, 95, 60, 255,
+  197, 222, 255, 37, 255, 235, 26, 128, 26, 255, 102, 10, 76, 81, 0, 147, 132,
+  158, 128, 32, 0, 128, 52, 16, 92, 213, 137, 204, 138, 18, 170, 217, 67, 243,
+  62, 8, 62, 220, 3, 76, 49, 6, 16, 76, 132, 144, 219, 163, 98, 47, 18, 35,
+  103, 2, 220, 25, 210, 27, 44, 250, 127, 186, 118, 255, 251, 251, 191, 206,
+  255, 206, 8, 192, 99, 128, 118, 19, 24, 150, 0, 72, 12, 242, 203, 40, 212,
+  17, 248, 199, 200, 72, 216, 131, 78, 1, 151, 251, 233, 237, 207, 183, 254,
+  146, 39, 198, 200, 39, 130, 83, 62, 105, 156, 56, 51, 138, 221, 52, 108,
+  133, 192, 13, 141, 250, 87, 149, 255, 90, 254, 241, 246, 127, 219, 0, 248,
+  248, 119, 251, 63, 11, 241, 119, 72, 128, 113, 115, 29, 192, 4, 64, 26, 16,
+  30, 33, 194, 247, 60, 186, 241, 177, 186, 79, 108, 127, 118, 0, 68, 91, 1,
+  103, 54, 17, 140, 186, 78, 146, 189, 84, 24, 40, 2, 215, 251, 244, 175, 25,
+  255, 212, 250, 127, 43, 0, 87, 252, 175, 82, 0, 44, 13, 184, 43, 0, 190,
+  10, 96, 31, 58, 75, 160, 86, 16, 122, 13, 161, 205, 136, 136, 128, 9, 122,
+  213, 19, 33, 247, 128, 25, 70, 182, 253, 153, 4, 16, 61, 17, 102, 225, 79,
+  69, 251, 94, 176, 255, 169, 115, 228, 215, 31, 179, 233, 95, 39, 255, 121,
+  249, 191, 157, 0, 140, 43, 252, 11, 248, 3, 6, 80, 93, 12, 105, 156, 199,
+  205, 32, 44, 48, 204, 2, 225, 235, 141, 217, 70, 19, 234, 90, 39, 6, 124,
+  159, 99, 186, 168, 243, 236, 143, 70, 159, 116, 132, 114, 248, 71, 29, 18,
+  48, 177, 33, 128, 13, 134, 175, 47, 213, 159, 70, 253, 59, 221, 202, 63,
+  64, 254, 239, 20, 160, 86, 2, 236, 24, 64, 64, 1, 141, 255, 24, 67, 40, 0,
+  152, 8, 32, 117, 64, 54, 229, 211, 53, 95, 244, 80, 0, 72, 249, 99, 108,
+  160, 254, 65, 65, 84, 8, 236, 111, 13, 21, 171, 66, 134, 63, 67, 120, 253,
+  49, 91, 253, 181, 228, 223, 122, 255, 91, 249, 223, 197, 63, 40, 0, 142,
+  10, 100, 61, 106, 54, 108, 3, 2, 99, 4, 169, 9, 224, 255, 227, 115, 163,
+  164, 71, 230, 151, 37, 127, 26, 125, 97, 1, 224, 246, 255, 236, 174, 147,
+  69, 61, 34, 205, 167, 21, 254, 39, 203, 233, 95, 131, 255, 114, 119, 254,
+  199, 113, 0, 1, 18, 48, 26, 0, 9, 48, 14, 52, 193, 63, 16, 104, 8, 173, 215,
+  25, 6, 22, 128, 156, 185, 229, 153, 106, 249, 122, 36, 127, 17, 244, 169,
+  84, 9, 238, 109, 14, 230, 21, 33, 201, 61, 34, 215, 215, 222, 207, 134, 254,
+  55, 242, 159, 151, 255, 235, 250, 239, 226, 223, 25, 65, 43, 244, 189, 38,
+  16, 236, 2, 164, 17, 0, 152, 133, 19, 65, 170, 23, 138, 61, 176, 246, 7,
+  36, 255, 168, 7, 70, 138, 158, 24, 128, 38, 128, 8, 252, 83, 214, 39, 108,
+  56, 139, 88, 243, 225, 7, 235, 244, 111, 183, 127, 237, 248, 199, 25, 0,
+  35, 4, 192, 153, 2, 88, 58, 176, 245, 180, 81, 155, 1, 24, 68, 249, 12, 95,
+  83, 100, 24, 16, 1, 61, 131, 191, 112, 243, 243, 199, 65, 40, 254, 47, 121,
+  126, 96, 212, 141, 65, 105, 164, 34, 136, 63, 117, 168, 124, 251, 65, 183,
+  252, 55, 167, 191, 60, 254, 15, 17, 64, 187, 0, 120, 1, 144, 56, 69, 192,
+  141, 0, 3, 253, 99, 194, 87, 141, 145, 130, 19, 9, 238, 50, 190, 39, 25,
+  253, 81, 211, 191, 62, 55, 4, 208, 174, 160, 84, 138, 61, 113, 64, 136, 57,
+  48, 210, 198, 65, 142, 127, 57, 252, 173, 204, 159, 157, 252, 99, 231, 127,
+  95, 0, 10, 10, 128, 69, 0, 252, 0, 8, 219, 64, 74, 14, 176, 94, 65, 206,
+  29, 192, 61, 210, 37, 14, 127, 96, 244, 39, 152, 253, 198, 236, 126, 222,
+  21, 202, 54, 0, 113, 55, 137, 162, 58, 128, 243, 238, 131, 109, 249, 47,
+  212, 127, 27, 255, 86, 255, 177, 5, 160, 14, 255, 160, 0, 52, 4, 160, 157,
+  4, 73, 3, 192, 125, 109, 220, 75, 4, 193, 253, 204, 126, 136, 18, 124, 178,
+  238, 203, 132, 31, 8, 125, 24, 121, 185, 45, 88, 120, 97, 160, 204, 28, 0,
+  119, 132, 88, 43, 248, 129, 227, 245, 209, 31, 15, 255, 166, 254, 55, 39,
+  128, 86, 92, 252, 221, 2, 208, 180, 0, 213, 230, 135, 2, 0, 25, 8, 97, 73,
+  32, 69, 196, 96, 178, 143, 139, 122, 19, 59, 246, 3, 148, 106, 124, 14, 44,
+  153, 4, 240, 1, 16, 49, 23, 50, 188, 36, 128, 76, 135, 63, 224, 210, 191,
+  186, 253, 59, 123, 206, 169, 255, 157, 0, 232, 225, 111, 105, 64, 110, 2,
+  160, 2, 192, 103, 130, 105, 160, 10, 82, 198, 0, 200, 49, 196, 72, 121, 104,
+  183, 47, 226, 125, 32, 236, 226, 57, 48, 119, 65, 16, 93, 251, 211, 62, 248,
+  163, 164, 16, 170, 2, 31, 232, 232, 95, 61, 253, 171, 229, 255, 176, 255,
+  119, 8, 160, 211, 1, 0, 21, 160, 13, 0, 96, 24, 128, 233, 65, 73, 247, 56,
+  57, 127, 30, 4, 190, 99, 62, 22, 199, 135, 148, 247, 203, 132, 0, 102, 247,
+  251, 216, 211, 183, 132, 164, 145, 236, 47, 145, 156, 26, 183, 83, 66, 133,
+  127, 109, 254, 112, 228, 159, 242, 252, 47, 132, 127, 59, 2, 168, 135, 0,
+  206, 20, 32, 112, 3, 121, 1, 0, 226, 239, 110, 132, 20, 119, 7, 17, 163,
+  58, 116, 130, 199, 199, 14, 115, 0, 20, 249, 156, 20, 126, 8, 63, 136, 228,
+  49, 210, 242, 161, 128, 137, 43, 10, 65, 253, 127, 127, 147, 254, 219, 233,
+  95, 43, 255, 89, 252, 207, 198, 191, 185, 8, 38, 96, 128, 94, 2, 192, 3,
+  192, 160, 127, 239, 46, 253, 3, 10, 140, 44, 28, 160, 15, 113, 163, 175,
+  252, 196, 151, 232, 41, 193, 178, 212, 47, 112, 3, 74, 234, 1, 3, 191, 200,
+  46, 110, 90, 252, 171, 244, 239, 202, 191, 231, 92, 254, 223, 225, 95, 219,
+  192, 29, 6, 24, 38, 0, 63, 0, 130, 28, 224, 222, 23, 147, 132, 39, 197, 18,
+  255, 74, 102, 194, 159, 205, 69, 8, 157, 53, 122, 96, 79, 142, 255, 248,
+  51, 1, 200, 230, 103, 158, 38, 33, 58, 41, 26, 17, 0, 13, 254, 167, 27, 243,
+  159, 135, 127, 205, 255, 125, 252, 219, 131, 160, 19, 39, 1, 56, 86, 0, 40,
+  0, 152, 78, 0, 176, 3, 176, 245, 64, 22, 17, 168, 205, 95, 168, 247, 51,
+  30, 144, 8, 241, 143, 157, 0, 77, 127, 117, 32, 137, 191, 27, 0, 239, 235,
+  186, 255, 118, 250, 215, 202, 63, 29, 255, 71, 240, 71, 18, 128, 63, 10,
+  116, 2, 128, 236, 4, 65, 75, 8, 118, 18, 143, 249, 193, 231, 130, 168, 212,
+  79, 220, 11, 203, 26, 64, 34, 239, 134, 136, 125, 178, 104, 164, 44, 96,
+  7, 128, 141, 255, 153, 0, 255, 149, 80, 0, 182, 21, 160, 46, 1, 24, 71, 6,
+  246, 204, 0, 13, 252, 112, 13, 112, 253, 129, 168, 173, 2, 19, 228, 164,
+  33, 48, 69, 209, 167, 198, 64, 66, 1, 144, 221, 254, 52, 242, 233, 12, 183,
+  191, 251, 186, 191, 175, 180, 254, 54, 195, 223, 214, 253, 225, 227, 31,
+  42, 192, 174, 13, 208, 117, 130, 216, 248, 227, 41, 32, 148, 3, 83, 44, 8,
+  252, 201, 48, 23, 4, 20, 89, 152, 30, 123, 209, 240, 135, 62, 11, 194, 105,
+  64, 253, 238, 9, 144, 170, 130, 86, 0, 188, 183, 222, 254, 157, 250, 215,
+  158, 254, 119, 250, 255, 16, 127, 187, 3, 164, 18, 0, 154, 2, 128, 26, 144,
+  178, 65, 128, 244, 97, 169, 148, 37, 244, 36, 124, 132, 1, 76, 188, 253,
+  9, 23, 104, 42, 157, 6, 165, 189, 247, 63, 120, 161, 92, 135, 255, 233, 206,
+  252, 199, 227, 223, 40, 0, 182, 4, 132, 39, 0, 107, 255, 99, 28, 192, 64,
+  166, 48, 170, 22, 208, 178, 140, 172, 26, 112, 240, 242, 26, 112, 255, 217,
+  111, 84, 4, 200, 156, 161, 253, 6, 131, 239, 113, 186, 127, 87, 254, 193,
+  240, 119, 59, 64, 75, 3, 240, 240, 183, 116, 192, 32, 2, 252, 115, 232, 144,
+  12, 12, 12, 133, 241, 241, 11, 2, 127, 236, 197, 46, 120, 62, 193, 103, 62,
+  50, 244, 65, 229, 23, 81, 3, 249, 171, 131, 227, 207, 137, 144, 248, 87,
+  195, 223, 142, 254, 161, 248, 183, 13, 128, 125, 18, 156, 144, 129, 189,
+  89, 64, 224, 11, 52, 129, 8, 0, 69, 0, 197, 8, 192, 93, 43, 238, 18, 98,
+  251, 125, 250, 252, 71, 220, 195, 1, 226, 34, 32, 98, 34, 104, 228, 82, 192,
+  123, 236, 225, 79, 103, 254, 70, 240, 247, 8, 96, 5, 191, 63, 5, 240, 68,
+  32, 192, 17, 130, 180, 1, 240, 131, 148, 98, 163, 128, 1, 159, 68, 159, 164,
+  20, 225, 240, 87, 250, 92, 0, 26, 124, 166, 39, 228, 25, 64, 26, 113, 60,
+  192, 111, 187, 222, 125, 178, 181, 254, 183, 230, 191, 194, 253, 213, 217,
+  191, 80, 252, 173, 14, 160, 62, 10, 224, 184, 193, 1, 14, 224, 120, 130,
+  28, 119, 48, 44, 123, 166, 68, 34, 192, 44, 120, 124, 28, 68, 40, 252, 196,
+  206, 23, 242, 254, 105, 34, 128, 216, 252, 105, 255, 86, 192, 237, 186, 223,
+  93, 117, 127, 157, 250, 231, 202, 63, 48, 254, 245, 8, 192, 35, 0, 158, 21,
+  168, 198, 223, 157, 6, 251, 28, 48, 60, 37, 30, 216, 2, 49, 35, 5, 222, 33,
+  82, 92, 0, 47, 247, 92, 65, 16, 21, 126, 1, 250, 76, 234, 79, 165, 155, 95,
+  86, 254, 83, 70, 6, 250, 3, 191, 252, 67, 248, 219, 3, 64, 159, 0, 184, 34,
+  176, 223, 3, 102, 80, 9, 8, 149, 160, 152, 16, 144, 53, 136, 146, 18, 47,
+  71, 95, 24, 0, 120, 253, 167, 60, 224, 177, 252, 191, 255, 76, 16, 224, 0,
+  127, 16, 148, 127, 203, 253, 25, 226, 31, 16, 0, 143, 1, 90, 78, 32, 160,
+  6, 248, 9, 192, 48, 163, 64, 120, 119, 224, 49, 64, 105, 69, 24, 230, 83,
+  160, 47, 118, 254, 136, 110, 135, 226, 238, 137, 156, 78, 10, 194, 154, 193,
+  119, 57, 221, 127, 107, 254, 45, 198, 191, 43, 158, 254, 191, 50, 9, 9, 128,
+  199, 0, 61, 13, 192, 106, 3, 61, 71, 16, 120, 95, 112, 100, 12, 0, 172, 144,
+  28, 30, 209, 78, 94, 49, 223, 103, 10, 63, 60, 255, 21, 141, 130, 36, 7,
+  2, 122, 169, 65, 6, 255, 244, 93, 157, 245, 187, 81, 255, 42, 247, 159, 101,
+  255, 168, 240, 175, 28, 96, 192, 8, 40, 168, 0, 6, 236, 2, 49, 37, 144, 153,
+  99, 134, 151, 232, 166, 132, 82, 72, 43, 4, 148, 137, 155, 162, 7, 171, 135,
+  62, 199, 252, 166, 186, 39, 72, 162, 9, 252, 126, 45, 254, 150, 233, 191,
+  45, 255, 86, 251, 87, 206, 127, 155, 1, 192, 4, 28, 1, 120, 5, 128, 170,
+  0, 174, 12, 16, 136, 192, 6, 137, 238, 20, 79, 7, 50, 38, 128, 253, 12, 222,
+  250, 69, 113, 190, 52, 145, 100, 255, 200, 39, 6, 114, 34, 80, 218, 23, 117,
+  251, 139, 57, 254, 39, 79, 159, 10, 203, 127, 131, 127, 235, 255, 9, 5, 32,
+  171, 3, 244, 10, 128, 91, 1, 50, 164, 9, 12, 20, 64, 248, 175, 153, 146,
+  234, 0, 162, 13, 16, 219, 86, 84, 43, 132, 207, 252, 96, 204, 254, 50, 244,
+  83, 209, 240, 63, 106, 255, 51, 14, 17, 235, 171, 239, 236, 210, 127, 83,
+  254, 59, 247, 119, 185, 253, 157, 254, 207, 86, 128, 241, 2, 208, 226, 79,
+  113, 64, 112, 10, 192, 255, 147, 82, 90, 32, 96, 118, 42, 43, 31, 34, 232,
+  243, 114, 15, 163, 251, 245, 216, 255, 184, 55, 104, 138, 66, 224, 179, 192,
+  119, 250, 229, 191, 77, 255, 229, 227, 31, 252, 254, 223, 174, 255, 110,
+  0, 180, 78, 80, 136, 3, 102, 126, 19, 104, 63, 52, 144, 174, 2, 8, 1, 18,
+  142, 139, 184, 168, 128, 161, 143, 160, 124, 224, 164, 162, 71, 4, 112, 251,
+  63, 130, 253, 167, 162, 102, 176, 254, 250, 59, 172, 244, 223, 169, 191,
+  205, 233, 47, 151, 255, 143, 237, 6, 96, 156, 193, 5, 192, 174, 0, 32, 7,
+  72, 156, 7, 70, 217, 51, 0, 35, 48, 181, 1, 105, 32, 77, 152, 0, 32, 67,
+  129, 161, 12, 226, 75, 94, 250, 162, 47, 105, 254, 34, 238, 11, 143, 77,
+  1, 191, 119, 202, 234, 254, 139, 225, 159, 69, 255, 218, 246, 223, 29, 0,
+  133, 10, 16, 198, 0, 186, 2, 144, 57, 163, 32, 106, 14, 104, 200, 200, 77,
+  201, 214, 16, 5, 157, 203, 7, 194, 71, 188, 137, 133, 126, 182, 222, 203,
+  187, 63, 97, 16, 244, 157, 8, 57, 248, 91, 251, 223, 174, 255, 22, 255, 171,
+  182, 191, 171, 0, 184, 26, 128, 201, 60, 252, 51, 132, 2, 192, 7, 131, 140,
+  208, 217, 138, 150, 1, 66, 139, 9, 195, 161, 55, 238, 228, 17, 79, 25, 227,
+  19, 36, 0, 225, 67, 131, 166, 49, 6, 189, 189, 21, 127, 93, 245, 119, 185,
+  163, 255, 65, 253, 119, 9, 96, 183, 253, 171, 7, 67, 122, 131, 64, 191, 6,
+  36, 214, 179, 2, 216, 28, 96, 100, 248, 251, 141, 0, 44, 192, 166, 108, 179,
+  200, 206, 116, 185, 86, 143, 139, 0, 193, 133, 64, 248, 229, 144, 146, 238,
+  47, 141, 108, 2, 205, 219, 27, 235, 151, 61, 252, 135, 242, 63, 32, 0, 65,
+  46, 16, 17, 5, 64, 166, 64, 8, 15, 48, 17, 60, 0, 159, 19, 64, 239, 34, 183,
+  187, 116, 223, 139, 34, 128, 70, 63, 141, 75, 254, 253, 41, 192, 239, 250,
+  233, 223, 154, 254, 116, 250, 143, 61, 0, 172, 225, 175, 111, 2, 68, 24,
+  96, 80, 2, 252, 46, 32, 1, 12, 225, 97, 47, 128, 147, 129, 20, 225, 1, 204,
+  180, 136, 144, 10, 98, 232, 163, 20, 125, 160, 48, 145, 151, 65, 50, 51,
+  0, 214, 0, 146, 70, 138, 64, 38, 121, 219, 105, 71, 252, 183, 233, 127, 155,
+  255, 199, 43, 72, 254, 199, 25, 160, 131, 63, 216, 3, 36, 88, 8, 224, 49,
+  128, 29, 24, 34, 118, 148, 104, 110, 40, 70, 94, 136, 62, 148, 237, 251,
+  162, 159, 10, 61, 128, 105, 207, 6, 224, 109, 64, 249, 119, 246, 255, 74,
+  123, 0, 176, 203, 255, 85, 3, 216, 236, 255, 22, 125, 75, 3, 130, 116, 64,
+  227, 62, 47, 22, 172, 1, 8, 19, 48, 189, 230, 3, 20, 48, 60, 222, 204, 215,
+  232, 178, 30, 225, 2, 35, 46, 3, 146, 89, 128, 8, 232, 83, 195, 197, 193,
+  239, 216, 221, 95, 121, 244, 191, 52, 255, 116, 237, 63, 144, 255, 113, 2,
+  208, 106, 64, 64, 1, 64, 110, 136, 164, 170, 128, 40, 4, 82, 201, 132, 64,
+  70, 7, 153, 89, 14, 81, 82, 208, 154, 47, 108, 249, 73, 244, 133, 54, 160,
+  52, 122, 243, 251, 248, 47, 159, 245, 233, 31, 196, 255, 27, 248, 43, 5,
+  8, 34, 0, 88, 2, 200, 144, 41, 32, 128, 191, 227, 13, 53, 2, 69, 32, 37,
+  228, 97, 92, 39, 228, 112, 198, 39, 58, 244, 56, 79, 118, 254, 27, 174, 244,
+  194, 199, 4, 77, 51, 16, 236, 94, 200, 183, 58, 226, 31, 220, 254, 181, 243,
+  95, 184, 1, 240, 70, 0, 146, 30, 192, 115, 131, 219, 157, 32, 162, 8, 176,
+  218, 176, 96, 76, 196, 142, 234, 104, 65, 71, 222, 205, 83, 222, 63, 89,
+  191, 199, 112, 191, 105, 189, 32, 93, 28, 252, 246, 105, 79, 252, 239, 204,
+  159, 53, 253, 119, 245, 159, 78, 0, 106, 76, 128, 72, 2, 48, 25, 54, 9, 76,
+  224, 19, 33, 118, 18, 144, 55, 132, 41, 254, 81, 74, 43, 68, 60, 153, 147,
+  114, 59, 154, 235, 167, 240, 153, 111, 242, 73, 16, 210, 51, 64, 169, 76,
+  4, 36, 88, 192, 91, 236, 217, 159, 101, 254, 113, 246, 255, 56, 28, 0, 184,
+  4, 192, 183, 1, 129, 9, 32, 195, 220, 224, 30, 254, 64, 37, 8, 91, 1, 35,
+  121, 97, 82, 222, 76, 44, 81, 14, 162, 92, 60, 169, 104, 208, 43, 56, 253,
+  203, 214, 255, 222, 5, 192, 120, 248, 123, 221, 191, 215, 254, 187, 252,
+  207, 221, 255, 158, 13, 120, 2, 39, 0, 55, 2, 18, 240, 84, 168, 131, 63,
+  202, 5, 93, 7, 35, 217, 14, 167, 184, 62, 32, 154, 201, 164, 20, 127, 16,
+  88, 210, 120, 244, 133, 67, 159, 148, 78, 118, 83, 158, 13, 126, 51, 90,
+  254, 195, 253, 15, 78, 0, 28, 23, 16, 16, 0, 64, 2, 72, 144, 115, 193, 22,
+  254, 120, 4, 176, 163, 1, 236, 50, 149, 24, 35, 150, 0, 234, 52, 17, 155,
+  59, 168, 103, 193, 178, 135, 62, 233, 75, 129, 166, 41, 254, 229, 75, 249,
+  91, 94, 250, 183, 202, 191, 109, 255, 114, 12, 64, 190, 2, 100, 213, 255,
+  9, 157, 0, 12, 232, 3, 112, 179, 192, 244, 17, 128, 189, 102, 148, 250, 206,
+  109, 115, 94, 186, 143, 145, 250, 103, 131, 254, 116, 224, 87, 235, 183,
+  236, 244, 239, 168, 127, 252, 254, 247, 36, 96, 58, 1, 100, 222, 129, 80,
+  144, 6, 178, 60, 64, 228, 17, 128, 107, 102, 26, 241, 38, 234, 184, 14, 86,
+  57, 248, 71, 255, 112, 237, 126, 74, 180, 57, 236, 53, 209, 1, 75, 6, 95,
+  180, 55, 53, 233, 191, 235, 254, 91, 250, 215, 202, 63, 214, 254, 111, 224,
+  31, 79, 38, 144, 4, 4, 80, 64, 59, 5, 24, 131, 150, 0, 148, 9, 98, 46, 49,
+  62, 6, 252, 23, 43, 165, 149, 66, 238, 150, 126, 172, 159, 16, 77, 247, 133,
+  154, 143, 24, 125, 20, 254, 200, 17, 192, 255, 180, 103, 127, 142, 250, 3,
+  217, 63, 108, 1, 40, 28, 1, 32, 34, 128, 9, 159, 16, 227, 39, 128, 6, 124,
+  160, 27, 4, 250, 0, 193, 120, 152, 116, 10, 96, 154, 49, 69, 210, 137, 47,
+  196, 122, 59, 210, 36, 134, 254, 197, 165, 254, 84, 86, 245, 187, 245, 198,
+  51, 173, 248, 235, 13, 127, 157, 246, 223, 222, 255, 93, 249, 111, 158, 6,
+  70, 39, 0, 255, 110, 96, 215, 7, 20, 38, 129, 196, 48, 173, 0, 18, 1, 134,
+  27, 143, 114, 66, 123, 26, 19, 39, 209, 39, 123, 232, 9, 111, 42, 160, 120,
+  233, 44, 208, 247, 94, 181, 223, 60, 99, 205, 254, 154, 238, 207, 163, 255,
+  110, 255, 239, 11, 0, 21, 248, 48, 254, 78, 5, 0, 125, 64, 65, 8, 0, 69,
+  64, 166, 7, 138, 204, 227, 228, 230, 75, 69, 211, 24, 73, 1, 136, 189, 226,
+  75, 52, 238, 231, 224, 143, 164, 131, 213, 235, 245, 155, 126, 247, 87, 121,
+  127, 235, 242, 111, 201, 255, 246, 9, 80, 91, 0, 240, 10, 0, 61, 5, 48, 88,
+  13, 192, 102, 2, 134, 85, 132, 89, 58, 144, 114, 141, 97, 196, 198, 36, 183,
+  127, 140, 165, 147, 62, 237, 195, 244, 249, 233, 44, 224, 175, 95, 177, 223,
+  168, 217, 127, 117, 237, 119, 88, 254, 207, 141, 219, 253, 239, 156, 0, 106,
+  3, 32, 131, 92, 0, 147, 112, 14, 236, 21, 0, 143, 5, 118, 60, 32, 232, 4,
+  56, 57, 80, 192, 7, 83, 50, 28, 24, 209, 149, 78, 8, 162, 171, 125, 145,
+  226, 206, 90, 61, 211, 100, 21, 225, 175, 94, 176, 95, 47, 181, 127, 43,
+  253, 219, 229, 223, 30, 255, 59, 3, 64, 55, 255, 219, 4, 160, 29, 3, 123,
+  1, 0, 22, 128, 254, 41, 0, 80, 133, 131, 219, 110, 168, 49, 121, 202, 15,
+  144, 4, 17, 32, 235, 242, 232, 9, 85, 172, 242, 55, 117, 241, 111, 213, 211,
+  242, 5, 251, 53, 32, 253, 47, 59, 244, 15, 228, 127, 222, 41, 176, 142, 0,
+  216, 248, 187, 199, 65, 136, 12, 224, 201, 65, 64, 8, 132, 23, 200, 7, 237,
+  0, 204, 4, 24, 203, 84, 42, 211, 86, 49, 158, 192, 182, 13, 60, 186, 162,
+  211, 62, 162, 174, 63, 141, 175, 254, 73, 242, 6, 32, 253, 219, 244, 207,
+  202, 255, 142, 1, 8, 82, 0, 195, 30, 176, 13, 0, 67, 101, 0, 76, 13, 64,
+  27, 1, 239, 49, 134, 49, 126, 81, 201, 20, 53, 101, 249, 99, 154, 36, 162,
+  167, 250, 242, 224, 242, 236, 36, 78, 240, 77, 227, 224, 79, 126, 213, 99,
+  255, 221, 240, 223, 166, 255, 72, 254, 7, 8, 128, 167, 1, 152, 12, 120, 58,
+  20, 212, 6, 132, 122, 32, 172, 5, 248, 60, 208, 208, 101, 64, 250, 34, 165,
+  220, 28, 137, 166, 128, 210, 3, 252, 49, 169, 190, 255, 147, 97, 233, 231,
+  68, 165, 206, 107, 244, 171, 167, 207, 134, 226, 239, 114, 13, 255, 185,
+  21, 81, 254, 39, 53, 160, 82, 4, 6, 78, 2, 149, 31, 37, 64, 14, 64, 66, 0,
+  72, 1, 96, 2, 48, 73, 252, 162, 239, 212, 226, 156, 37, 209, 135, 183, 100,
+  135, 123, 167, 184, 0, 52, 21, 138, 127, 249, 122, 189, 39, 254, 180, 71,
+  63, 61, 249, 199, 201, 255, 37, 250, 174, 2, 204, 180, 128, 6, 244, 129,
+  70, 136, 1, 168, 57, 4, 122, 168, 105, 140, 62, 40, 161, 83, 32, 111, 23,
+  57, 182, 101, 105, 61, 149, 242, 17, 105, 24, 164, 226, 215, 224, 127, 88,
+  179, 159, 242, 224, 119, 211, 253, 117, 233, 223, 217, 254, 52, 1, 116, 90,
+  64, 19, 62, 31, 216, 74, 0, 25, 83, 3, 152, 46, 0, 51, 138, 154, 40, 240,
+  197, 129, 193, 219, 52, 133, 61, 91, 143, 193, 238, 172, 250, 61, 112, 253,
+  74, 183, 253, 171, 217, 191, 213, 253, 59, 242, 159, 163, 255, 4, 19, 0,
+  31, 255, 9, 233, 1, 112, 106, 128, 53, 18, 12, 251, 0, 116, 28, 128, 209,
+  0, 88, 13, 48, 83, 7, 64, 132, 86, 36, 234, 50, 184, 141, 30, 111, 242, 234,
+  55, 255, 255, 229, 118, 251, 135, 195, 31, 171, 253, 183, 231, 255, 144,
+  5, 200, 195, 31, 126, 46, 4, 69, 2, 37, 90, 0, 50, 22, 100, 220, 226, 70,
+  82, 6, 35, 138, 0, 255, 140, 6, 222, 167, 203, 182, 118, 66, 202, 151, 246,
+  132, 189, 59, 23, 240, 58, 151, 253, 187, 234, 159, 47, 255, 174, 76, 194,
+  9, 80, 198, 49, 64, 131, 38, 128, 76, 218, 8, 250, 182, 144, 48, 0, 4, 189,
+  160, 73, 250, 4, 2, 65, 204, 5, 67, 89, 118, 71, 203, 48, 79, 227, 82, 85,
+  196, 248, 47, 249, 239, 101, 243, 31, 166, 127, 95, 254, 233, 230, 191, 128,
+  3, 128, 28, 2, 152, 192, 4, 20, 193, 2, 16, 18, 128, 29, 23, 224, 103, 3,
+  38, 137, 13, 131, 148, 31, 38, 241, 29, 165, 64, 201, 21, 109, 249, 52, 46,
+  4, 248, 16, 255, 165, 179, 103, 130, 244, 223, 210, 255, 218, 253, 201, 242,
+  63, 4, 255, 73, 120, 25, 4, 29, 1, 137, 1, 198, 194, 104, 8, 112, 86, 113,
+  248, 161, 135, 61, 74, 66, 148, 9, 43, 237, 165, 51, 69, 52, 249, 146, 114,
+  96, 196, 153, 224, 181, 97, 250, 95, 118, 213, 31, 103, 252, 211, 242, 191,
+  80, 0, 240, 207, 130, 79, 96, 11, 80, 24, 1, 190, 41, 128, 51, 6, 129, 69,
+  0, 59, 56, 42, 204, 4, 38, 178, 6, 136, 51, 116, 26, 153, 18, 102, 41, 242,
+  73, 106, 192, 47, 6, 236, 223, 87, 255, 236, 246, 31, 22, 128, 33, 252, 39,
+  200, 109, 48, 173, 16, 228, 171, 193, 89, 18, 94, 18, 134, 120, 3, 13, 67,
+  4, 145, 9, 17, 25, 3, 210, 0, 232, 189, 79, 83, 105, 92, 76, 45, 242, 137,
+  107, 127, 177, 94, 115, 214, 113, 254, 181, 226, 191, 133, 127, 123, 252,
+  187, 214, 127, 32, 252, 109, 9, 0, 188, 17, 214, 107, 2, 218, 237, 15, 182,
+  1, 112, 5, 144, 240, 0, 38, 16, 194, 24, 48, 162, 36, 32, 145, 224, 210,
+  89, 132, 66, 28, 182, 105, 12, 210, 240, 47, 250, 5, 79, 252, 9, 134, 191,
+  190, 252, 15, 57, 64, 2, 9, 168, 30, 3, 154, 48, 1, 216, 36, 144, 8, 0, 112,
+  24, 16, 242, 0, 162, 19, 12, 199, 68, 228, 131, 208, 99, 2, 96, 26, 136,
+  100, 207, 113, 137, 221, 220, 81, 133, 223, 249, 53, 63, 127, 22, 235, 254,
+  206, 173, 64, 242, 15, 129, 127, 237, 3, 179, 15, 131, 131, 1, 32, 74, 1,
+  226, 0, 0, 6, 67, 108, 8, 224, 19, 35, 51, 179, 124, 155, 78, 241, 53, 15,
+  209, 25, 73, 125, 224, 191, 237, 191, 157, 181, 203, 127, 4, 254, 50, 2,
+  96, 252, 10, 32, 173, 1, 9, 78, 3, 201, 26, 224, 225, 207, 100, 129, 233,
+  114, 192, 180, 225, 48, 163, 84, 15, 131, 157, 18, 255, 26, 211, 233, 63,
+  63, 7, 179, 255, 86, 252, 241, 233, 63, 40, 0, 227, 4, 192, 100, 211, 6,
+  0, 219, 10, 132, 93, 32, 28, 2, 112, 103, 16, 21, 1, 62, 16, 102, 58, 220,
+  210, 89, 6, 146, 232, 175, 19, 254, 138, 255, 218, 109, 127, 219, 250, 131,
+  182, 127, 14, 254, 248, 12, 48, 188, 14, 176, 70, 191, 134, 223, 31, 7, 101,
+  83, 5, 0, 56, 24, 162, 138, 1, 99, 31, 51, 211, 37, 216, 85, 163, 239, 51,
+  76, 253, 205, 87, 126, 214, 218, 254, 112, 250, 7, 241, 199, 8, 0, 200, 255,
+  33, 14, 40, 204, 0, 110, 35, 232, 31, 21, 36, 15, 139, 249, 41, 129, 227,
+  4, 253, 70, 70, 38, 153, 241, 38, 94, 133, 26, 79, 253, 244, 207, 248, 236,
+  175, 17, 255, 98, 241, 183, 19, 0, 124, 27, 96, 108, 0, 36, 96, 16, 224,
+  222, 32, 87, 17, 196, 202, 1, 117, 197, 88, 68, 4, 244, 157, 42, 165, 143,
+  6, 240, 6, 255, 210, 171, 67, 241, 167, 77, 255, 213, 217, 63, 2, 127, 110,
+  4, 96, 192, 0, 128, 75, 0, 21, 0, 126, 13, 64, 239, 12, 192, 83, 1, 64, 10,
+  216, 8, 48, 130, 87, 211, 172, 58, 158, 189, 11, 190, 17, 124, 201, 252,
+  52, 158, 254, 107, 243, 79, 28, 254, 141, 9, 216, 230, 127, 110, 0, 32, 36,
+  48, 227, 124, 161, 228, 81, 65, 124, 50, 16, 148, 1, 250, 126, 49, 35, 43,
+  155, 49, 140, 113, 150, 91, 57, 53, 61, 190, 137, 10, 132, 159, 10, 216,
+  127, 179, 253, 109, 243, 31, 141, 255, 56, 99, 46, 131, 132, 218, 64, 100,
+  32, 136, 5, 0, 154, 2, 144, 58, 0, 142, 135, 194, 171, 197, 152, 20, 128,
+  61, 56, 137, 246, 26, 155, 213, 42, 223, 177, 223, 195, 141, 188, 243, 79,
+  127, 210, 55, 254, 54, 219, 223, 55, 255, 160, 253, 95, 107, 2, 246, 92,
+  224, 62, 3, 12, 3, 128, 79, 0, 192, 57, 81, 110, 40, 68, 76, 136, 241, 129,
+  177, 17, 152, 6, 130, 159, 230, 143, 33, 155, 85, 5, 223, 72, 191, 76, 125,
+  229, 85, 65, 243, 7, 168, 191, 142, 254, 107, 93, 1, 231, 157, 2, 116, 159,
+  7, 2, 221, 4, 2, 74, 193, 25, 129, 63, 117, 82, 24, 86, 3, 97, 46, 64, 248,
+  6, 201, 20, 16, 126, 68, 148, 139, 168, 173, 56, 187, 95, 33, 13, 63, 240,
+  211, 255, 188, 108, 25, 63, 187, 238, 159, 192, 223, 53, 0, 140, 49, 1, 160,
+  123, 40, 48, 158, 2, 48, 87, 160, 180, 8, 36, 68, 20, 192, 45, 1, 227, 30,
+  198, 61, 3, 164, 112, 108, 166, 4, 170, 111, 232, 24, 193, 87, 13, 205, 94,
+  127, 34, 100, 127, 237, 209, 31, 144, 254, 161, 248, 59, 10, 160, 79, 0,
+  208, 20, 192, 39, 128, 160, 19, 128, 156, 33, 178, 8, 48, 60, 15, 132, 183,
+  57, 46, 29, 199, 25, 13, 167, 72, 217, 17, 101, 157, 13, 3, 235, 147, 87,
+  46, 123, 163, 95, 155, 253, 215, 187, 223, 133, 31, 21, 0, 96, 254, 23, 114,
+  64, 76, 7, 232, 2, 192, 115, 5, 35, 98, 128, 56, 6, 128, 138, 192, 23, 1,
+  131, 0, 207, 221, 78, 111, 162, 177, 50, 253, 183, 187, 97, 126, 149, 97,
+  219, 151, 255, 228, 108, 255, 229, 115, 43, 142, 245, 211, 77, 255, 245,
+  253, 15, 150, 1, 16, 108, 0, 195, 35, 32, 206, 81, 96, 176, 11, 0, 253, 64,
+  136, 55, 28, 31, 9, 209, 89, 64, 112, 134, 200, 192, 200, 203, 116, 99, 161,
+  183, 200, 196, 229, 107, 241, 47, 50, 130, 70, 53, 252, 137, 87, 0, 219,
+  223, 22, 255, 186, 233, 159, 237, 255, 6, 8, 32, 192, 255, 108, 13, 200,
+  189, 13, 128, 78, 0, 25, 193, 1, 49, 49, 144, 100, 3, 162, 243, 35, 70, 0,
+  186, 137, 176, 147, 152, 164, 71, 60, 176, 153, 220, 200, 51, 2, 250, 231,
+  216, 191, 230, 199, 189, 230, 223, 18, 255, 86, 28, 243, 231, 138, 75, 255,
+  67, 2, 224, 76, 128, 129, 67, 128, 24, 7, 8, 19, 64, 70, 183, 1, 225, 33,
+  65, 162, 24, 160, 151, 11, 7, 162, 80, 48, 18, 8, 190, 238, 253, 34, 44,
+  8, 4, 254, 50, 147, 240, 191, 134, 12, 14, 250, 151, 26, 62, 120, 154, 15,
+  127, 212, 223, 254, 46, 253, 15, 229, 31, 171, 252, 227, 22, 16, 162, 2,
+  80, 9, 128, 192, 31, 81, 3, 17, 81, 152, 110, 10, 249, 20, 16, 192, 206,
+  221, 58, 128, 199, 128, 17, 131, 110, 132, 27, 95, 150, 76, 12, 45, 92, 53,
+  31, 254, 8, 148, 254, 157, 225, 143, 79, 255, 75, 228, 1, 7, 8, 116, 23,
+  188, 83, 1, 252, 7, 131, 96, 248, 75, 250, 128, 4, 106, 5, 56, 252, 73, 105,
+  152, 197, 29, 23, 141, 233, 80, 160, 25, 130, 137, 224, 106, 210, 158, 211,
+  8, 191, 177, 248, 232, 63, 6, 218, 175, 149, 254, 219, 237, 111, 195, 31,
+  8, 192, 246, 69, 208, 147, 14, 254, 9, 176, 255, 1, 59, 0, 225, 7, 203, 48,
+  26, 152, 16, 130, 16, 221, 17, 4, 90, 0, 144, 2, 224, 79, 153, 12, 96, 18,
+  73, 40, 16, 34, 34, 90, 33, 12, 141, 189, 97, 182, 57, 201, 77, 76, 242,
+  195, 229, 133, 191, 86, 243, 239, 176, 127, 123, 251, 187, 231, 255, 218,
+  35, 224, 99, 216, 0, 16, 22, 0, 113, 2, 192, 171, 64, 34, 136, 0, 128, 11,
+  114, 146, 16, 237, 29, 19, 200, 5, 188, 183, 16, 19, 148, 140, 116, 191,
+  139, 163, 64, 160, 93, 218, 95, 249, 15, 203, 142, 239, 215, 22, 127, 106,
+  246, 231, 210, 63, 159, 255, 1, 14, 0, 255, 8, 136, 189, 255, 189, 4, 0,
+  30, 13, 205, 88, 18, 144, 24, 46, 4, 18, 209, 217, 33, 98, 72, 204, 152,
+  8, 72, 55, 153, 40, 23, 24, 97, 130, 230, 190, 66, 14, 165, 12, 251, 193,
+  203, 150, 3, 237, 151, 166, 127, 214, 252, 199, 46, 0, 89, 27, 0, 206, 195,
+  160, 168, 4, 224, 49, 64, 23, 127, 255, 136, 184, 119, 56, 8, 103, 2, 33,
+  15, 160, 7, 132, 8, 210, 188, 153, 140, 60, 101, 194, 7, 130, 145, 66, 101,
+  228, 96, 18, 191, 29, 22, 66, 63, 4, 56, 63, 28, 241, 215, 130, 127, 101,
+  2, 213, 127, 123, 0, 20, 30, 0, 154, 80, 9, 0, 148, 129, 201, 78, 32, 65,
+  38, 2, 126, 8, 136, 15, 13, 176, 83, 66, 242, 186, 9, 97, 42, 0, 144, 55,
+  12, 130, 220, 123, 254, 23, 96, 82, 182, 251, 245, 151, 90, 218, 95, 5, 191,
+  187, 253, 189, 242, 111, 233, 63, 72, 254, 119, 14, 128, 100, 50, 29, 16,
+  59, 21, 194, 141, 132, 201, 66, 32, 63, 60, 8, 1, 205, 117, 10, 130, 84,
+  64, 102, 5, 67, 110, 83, 147, 240, 195, 8, 98, 108, 201, 32, 111, 191, 251,
+  119, 110, 245, 111, 71, 191, 182, 247, 11, 30, 255, 0, 151, 0, 184, 242,
+  191, 36, 3, 32, 167, 130, 68, 37, 192, 163, 131, 88, 21, 144, 117, 130, 62,
+  244, 66, 181, 64, 144, 9, 168, 9, 2, 57, 85, 54, 244, 192, 217, 80, 33, 64,
+  71, 142, 245, 238, 37, 192, 228, 223, 99, 255, 94, 251, 207, 229, 127, 58,
+  1, 96, 20, 32, 236, 3, 145, 18, 144, 32, 99, 97, 1, 23, 228, 147, 0, 62,
+  48, 194, 199, 70, 134, 19, 140, 137, 25, 2, 55, 108, 146, 161, 108, 4, 4,
+  19, 251, 243, 126, 48, 208, 254, 124, 241, 215, 86, 255, 237, 254, 15, 20,
+  128, 28, 255, 127, 216, 4, 56, 42, 160, 111, 5, 128, 166, 193, 180, 39, 192,
+  134, 31, 33, 130, 92, 39, 24, 116, 133, 156, 157, 148, 83, 141, 248, 120,
+  96, 122, 70, 195, 255, 44, 243, 115, 38, 17, 126, 49, 127, 247, 98, 139,
+  252, 251, 219, 31, 222, 255, 65, 254, 111, 233, 127, 120, 5, 20, 36, 2, 4,
+  207, 7, 206, 28, 35, 136, 179, 253, 131, 28, 144, 96, 76, 0, 62, 45, 32,
+  26, 14, 2, 176, 35, 173, 2, 60, 55, 48, 252, 172, 128, 46, 19, 8, 240, 33,
+  93, 52, 73, 143, 116, 1, 230, 131, 246, 147, 31, 64, 183, 191, 111, 254,
+  88, 25, 183, 199, 191, 17, 1, 192, 190, 4, 24, 217, 255, 174, 14, 8, 245,
+  128, 124, 5, 160, 235, 64, 66, 92, 31, 193, 25, 6, 157, 113, 17, 121, 239,
+  164, 224, 176, 41, 253, 5, 10, 115, 62, 28, 122, 53, 25, 6, 250, 249, 239,
+  15, 78, 125, 58, 179, 95, 63, 253, 91, 247, 127, 144, 249, 31, 227, 128,
+  38, 203, 120, 63, 112, 6, 11, 1, 38, 182, 27, 160, 107, 0, 108, 29, 150,
+  73, 5, 228, 89, 83, 8, 111, 35, 163, 137, 156, 219, 0, 77, 9, 146, 46, 3,
+  252, 45, 94, 20, 250, 62, 37, 244, 15, 25, 0, 187, 240, 71, 81, 64, 216,
+  15, 38, 153, 8, 130, 157, 0, 225, 17, 16, 255, 64, 245, 98, 140, 9, 208,
+  131, 4, 182, 28, 64, 152, 27, 2, 124, 44, 2, 4, 1, 208, 126, 248, 189, 78,
+  245, 7, 211, 191, 179, 255, 37, 252, 207, 167, 128, 88, 5, 8, 173, 96, 224,
+  161, 0, 38, 3, 32, 173, 0, 214, 7, 162, 112, 71, 227, 47, 11, 4, 236, 48,
+  186, 40, 34, 96, 190, 200, 242, 7, 94, 132, 104, 63, 252, 30, 180, 249, 227,
+  219, 191, 224, 4, 128, 71, 0, 160, 10, 96, 152, 67, 129, 88, 6, 32, 194,
+  32, 65, 53, 129, 68, 64, 3, 136, 40, 16, 170, 133, 196, 65, 163, 222, 60,
+  129, 184, 225, 222, 76, 201, 32, 220, 15, 191, 59, 208, 126, 130, 244, 31,
+  182, 127, 168, 1, 36, 19, 86, 0, 220, 12, 234, 95, 17, 5, 180, 129, 132,
+  61, 144, 48, 137, 32, 33, 0, 1, 143, 28, 41, 19, 70, 128, 145, 13, 16, 101,
+  177, 0, 121, 146, 36, 17, 32, 138, 138, 226, 205, 119, 117, 210, 175, 135,
+  255, 24, 84, 255, 236, 249, 159, 149, 254, 199, 25, 28, 0, 25, 110, 6, 18,
+  103, 0, 216, 23, 74, 9, 2, 148, 22, 228, 194, 13, 190, 243, 142, 149, 137,
+  53, 227, 168, 70, 193, 36, 244, 255, 164, 47, 145, 164, 146, 244, 79, 120,
+  63, 253, 130, 115, 142, 241, 195, 19, 127, 124, 245, 159, 220, 255, 217,
+  4, 220, 255, 200, 40, 24, 57, 17, 134, 101, 0, 58, 8, 18, 242, 180, 16, 62,
+  21, 156, 214, 65, 108, 176, 193, 65, 116, 183, 16, 193, 21, 89, 149, 137,
+  23, 158, 186, 175, 255, 27, 207, 246, 43, 41, 255, 208, 254, 119, 47, 0,
+  227, 11, 0, 128, 63, 222, 5, 0, 109, 0, 232, 13, 194, 206, 11, 226, 30, 49,
+  9, 63, 164, 250, 65, 38, 29, 16, 69, 128, 103, 8, 70, 104, 68, 37, 104, 37,
+  223, 105, 124, 135, 71, 254, 67, 241, 15, 160, 255, 162, 253, 79, 203, 128,
+  6, 186, 23, 32, 140, 128, 144, 3, 100, 82, 57, 32, 161, 137, 160, 245, 158,
+  137, 0, 1, 31, 132, 195, 192, 36, 252, 25, 116, 50, 40, 104, 79, 162, 84,
+  101, 162, 50, 132, 249, 54, 146, 253, 217, 222, 159, 238, 244, 71, 184, 255,
+  199, 19, 124, 255, 131, 41, 192, 100, 24, 254, 93, 11, 24, 54, 129, 60, 17,
+  72, 140, 17, 24, 132, 18, 50, 40, 192, 38, 0, 31, 24, 112, 49, 193, 134,
+  129, 236, 226, 50, 40, 44, 32, 149, 137, 235, 50, 189, 159, 254, 86, 175,
+  250, 123, 163, 127, 207, 252, 229, 168, 63, 99, 64, 254, 65, 3, 128, 98,
+  0, 164, 18, 236, 89, 66, 232, 118, 48, 33, 110, 14, 1, 81, 231, 91, 68, 110,
+  98, 128, 36, 5, 54, 7, 16, 183, 18, 24, 214, 131, 44, 250, 121, 58, 139,
+  212, 31, 252, 107, 59, 251, 195, 226, 143, 107, 254, 116, 46, 128, 238, 182,
+  191, 15, 63, 64, 1, 189, 75, 65, 58, 27, 8, 70, 2, 17, 37, 72, 218, 12, 50,
+  22, 49, 118, 88, 200, 170, 130, 24, 57, 100, 186, 69, 89, 86, 16, 216, 144,
+  57, 131, 186, 196, 213, 254, 124, 95, 251, 241, 216, 191, 43, 254, 135, 254,
+  31, 116, 255, 131, 1, 224, 62, 22, 8, 58, 17, 72, 80, 0, 222, 28, 202, 158,
+  23, 11, 65, 39, 114, 128, 45, 7, 96, 163, 2, 172, 73, 196, 120, 162, 56,
+  16, 224, 15, 123, 197, 69, 48, 132, 176, 127, 226, 95, 158, 179, 92, 255,
+  182, 241, 183, 217, 254, 193, 244, 7, 246, 255, 251, 79, 1, 100, 123, 0,
+  192, 9, 134, 234, 192, 244, 76, 88, 62, 20, 162, 98, 1, 111, 4, 169, 74,
+  96, 132, 217, 32, 54, 16, 56, 9, 41, 12, 2, 65, 66, 128, 226, 226, 91, 188,
+  244, 223, 24, 63, 189, 238, 111, 197, 78, 255, 4, 253, 151, 7, 128, 161,
+  111, 134, 241, 84, 0, 176, 21, 144, 187, 67, 144, 76, 64, 104, 4, 200, 41,
+  146, 132, 63, 96, 42, 81, 142, 185, 128, 96, 8, 34, 19, 35, 2, 93, 161, 253,
+  240, 155, 44, 242, 103, 27, 255, 172, 237, 143, 77, 255, 198, 246, 241, 31,
+  11, 126, 175, 3, 156, 72, 140, 64, 54, 250, 176, 33, 8, 142, 0, 242, 176,
+  40, 97, 18, 21, 120, 199, 153, 155, 5, 34, 11, 130, 68, 54, 224, 248, 33,
+  145, 12, 68, 115, 39, 232, 195, 127, 225, 247, 254, 231, 198, 161, 248, 19,
+  182, 255, 206, 248, 111, 236, 60, 2, 204, 23, 1, 192, 0, 48, 25, 140, 127,
+  200, 0, 145, 42, 64, 118, 2, 0, 254, 46, 240, 146, 83, 100, 17, 248, 51,
+  119, 209, 81, 62, 67, 73, 163, 40, 57, 149, 34, 127, 231, 126, 248, 13, 222,
+  246, 7, 241, 7, 233, 127, 104, 255, 196, 43, 128, 31, 0, 38, 3, 241, 247,
+  57, 32, 214, 8, 112, 146, 112, 66, 30, 23, 144, 121, 70, 9, 85, 120, 170,
+  16, 16, 179, 131, 105, 230, 77, 242, 170, 241, 60, 127, 251, 211, 233, 223,
+  205, 255, 192, 67, 160, 219, 20, 0, 6, 64, 249, 206, 208, 102, 80, 212, 16,
+  98, 159, 15, 96, 52, 193, 4, 101, 130, 152, 109, 56, 17, 158, 36, 141, 173,
+  9, 140, 209, 144, 63, 128, 64, 221, 105, 27, 117, 124, 13, 126, 247, 220,
+  150, 251, 129, 205, 31, 220, 254, 97, 79, 0, 128, 42, 0, 113, 30, 212, 144,
+  103, 66, 189, 4, 128, 204, 132, 225, 28, 144, 224, 99, 65, 56, 4, 160, 179,
+  228, 162, 57, 161, 60, 11, 112, 254, 98, 56, 2, 200, 54, 129, 3, 95, 16,
+  12, 95, 31, 244, 254, 110, 243, 31, 148, 127, 196, 254, 159, 193, 29, 0,
+  57, 4, 64, 110, 5, 9, 19, 64, 180, 26, 148, 32, 238, 16, 44, 4, 18, 142,
+  5, 4, 232, 139, 203, 1, 59, 70, 224, 143, 161, 144, 147, 70, 38, 51, 112,
+  4, 242, 57, 129, 244, 23, 226, 111, 159, 253, 194, 237, 223, 217, 36, 54,
+  1, 24, 238, 122, 80, 0, 254, 208, 27, 234, 37, 255, 204, 183, 137, 39, 124,
+  81, 72, 152, 50, 64, 134, 3, 16, 0, 189, 181, 2, 146, 39, 246, 85, 148, 200,
+  40, 248, 231, 221, 145, 63, 127, 244, 19, 104, 255, 97, 253, 15, 174, 127,
+  140, 74, 0, 240, 137, 80, 0, 126, 180, 15, 68, 2, 32, 65, 216, 0, 30, 2,
+  9, 95, 6, 194, 161, 49, 37, 22, 17, 114, 1, 169, 25, 70, 14, 26, 133, 132,
+  17, 207, 16, 95, 219, 102, 127, 111, 242, 11, 227, 143, 141, 127, 50, 1,
+  3, 128, 135, 128, 152, 10, 96, 184, 163, 1, 114, 57, 24, 201, 7, 194, 41,
+  81, 98, 232, 80, 232, 171, 20, 144, 99, 36, 241, 92, 73, 192, 12, 200, 255,
+  158, 29, 12, 126, 109, 242, 71, 169, 255, 254, 233, 31, 63, 1, 116, 45, 0,
+  22, 0, 6, 155, 5, 243, 53, 128, 189, 50, 142, 9, 2, 102, 80, 76, 78, 138,
+  101, 137, 32, 202, 95, 222, 119, 174, 20, 65, 15, 2, 49, 161, 250, 96, 95,
+  224, 250, 245, 241, 71, 213, 127, 228, 1, 96, 248, 20, 136, 10, 0, 76, 6,
+  100, 59, 193, 136, 0, 128, 51, 129, 108, 76, 136, 94, 46, 64, 92, 54, 18,
+  43, 27, 70, 204, 19, 4, 245, 64, 20, 16, 230, 25, 0, 249, 247, 154, 127,
+  88, 253, 243, 250, 191, 0, 254, 80, 5, 102, 19, 64, 176, 253, 209, 62, 0,
+  186, 53, 86, 26, 1, 140, 83, 0, 10, 1, 50, 13, 72, 122, 2, 121, 49, 16, 76,
+  19, 36, 154, 162, 152, 54, 126, 13, 224, 251, 41, 177, 183, 170, 63, 64,
+  255, 189, 246, 47, 155, 96, 13, 128, 123, 30, 28, 161, 0, 124, 5, 64, 38,
+  2, 144, 18, 32, 24, 11, 48, 71, 200, 153, 119, 9, 170, 19, 48, 116, 144,
+  196, 159, 57, 129, 38, 170, 8, 17, 41, 161, 121, 255, 213, 112, 245, 119,
+  216, 95, 55, 252, 3, 220, 159, 227, 238, 236, 111, 124, 1, 160, 122, 64,
+  34, 0, 224, 51, 130, 25, 3, 63, 227, 23, 103, 38, 197, 68, 29, 136, 63, 91,
+  208, 99, 164, 200, 7, 128, 100, 230, 20, 68, 194, 87, 89, 202, 255, 74, 40,
+  253, 55, 214, 191, 26, 126, 188, 253, 243, 225, 135, 141, 160, 92, 15, 72,
+  6, 64, 48, 20, 194, 133, 128, 44, 170, 8, 224, 60, 0, 158, 21, 39, 192, 179,
+  136, 176, 36, 32, 201, 3, 178, 56, 96, 18, 129, 64, 87, 130, 62, 121, 170,
+  219, 251, 83, 218, 47, 37, 255, 102, 236, 16, 128, 62, 13, 10, 138, 0, 88,
+  0, 176, 222, 192, 16, 127, 244, 22, 17, 246, 58, 33, 156, 24, 144, 52, 160,
+  95, 12, 68, 52, 140, 253, 251, 6, 39, 12, 158, 236, 101, 127, 162, 249, 19,
+  180, 255, 196, 20, 16, 43, 0, 171, 17, 0, 153, 145, 149, 130, 132, 57, 63,
+  202, 180, 135, 28, 21, 164, 231, 136, 236, 17, 84, 185, 205, 64, 22, 4, 96,
+  24, 124, 101, 103, 251, 113, 125, 63, 16, 254, 19, 248, 246, 135, 44, 148,
+  128, 196, 4, 176, 71, 0, 128, 55, 197, 32, 243, 64, 132, 20, 38, 108, 17,
+  160, 39, 197, 52, 33, 148, 8, 69, 211, 166, 3, 217, 45, 22, 124, 24, 60,
+  17, 32, 255, 160, 241, 27, 115, 255, 193, 21, 0, 147, 0, 137, 27, 97, 34,
+  3, 0, 52, 133, 224, 214, 16, 241, 177, 49, 38, 27, 36, 38, 162, 35, 136,
+  60, 121, 218, 191, 34, 144, 161, 65, 170, 141, 79, 88, 193, 180, 31, 20,
+  127, 244, 249, 239, 72, 5, 224, 241, 247, 221, 160, 124, 35, 40, 242, 134,
+  102, 50, 58, 40, 157, 17, 11, 2, 0, 17, 13, 169, 249, 97, 124, 54, 16, 39,
+  6, 48, 17, 120, 239, 30, 143, 246, 254, 49, 244, 207, 42, 1, 225, 16, 0,
+  198, 223, 189, 26, 30, 244, 2, 161, 1, 128, 11, 129, 144, 36, 152, 241, 62,
+  49, 100, 62, 12, 117, 6, 34, 169, 48, 137, 154, 37, 99, 7, 15, 164, 153,
+  0, 78, 3, 124, 243, 80, 252, 184, 214, 39, 127, 196, 246, 111, 233, 159,
+  115, 251, 111, 0, 63, 133, 191, 119, 18, 196, 119, 3, 65, 103, 2, 184, 0,
+  192, 6, 130, 72, 46, 224, 51, 128, 148, 24, 74, 85, 66, 156, 20, 72, 166,
+  201, 61, 189, 135, 82, 158, 240, 88, 183, 247, 235, 184, 31, 176, 253, 3,
+  250, 239, 92, 253, 24, 224, 111, 105, 192, 248, 157, 160, 176, 6, 0, 237,
+  127, 70, 10, 132, 147, 0, 227, 20, 76, 140, 216, 40, 32, 47, 3, 156, 90,
+  44, 105, 16, 164, 1, 16, 43, 33, 4, 81, 240, 152, 21, 118, 251, 35, 234,
+  207, 216, 237, 254, 156, 6, 128, 193, 127, 66, 91, 193, 128, 2, 0, 111, 127,
+  234, 140, 80, 16, 4, 153, 112, 44, 148, 72, 110, 150, 145, 156, 37, 145,
+  143, 144, 105, 70, 48, 85, 66, 224, 148, 230, 171, 241, 234, 223, 106, 127,
+  182, 250, 27, 78, 127, 51, 159, 2, 2, 51, 32, 86, 3, 64, 12, 225, 96, 18,
+  32, 70, 194, 108, 34, 64, 79, 12, 82, 9, 33, 137, 200, 2, 220, 233, 50, 112,
+  124, 40, 23, 15, 103, 30, 9, 87, 90, 158, 111, 168, 247, 95, 9, 172, 127,
+  200, 195, 255, 48, 9, 144, 189, 14, 12, 115, 131, 134, 240, 19, 66, 144,
+  40, 6, 132, 125, 0, 205, 9, 201, 150, 48, 138, 28, 70, 210, 195, 248, 249,
+  162, 36, 14, 46, 7, 6, 63, 225, 232, 15, 60, 251, 21, 135, 127, 0, 255, 132,
+  156, 3, 179, 53, 0, 191, 53, 88, 112, 102, 148, 204, 1, 146, 58, 64, 42,
+  132, 194, 40, 136, 53, 26, 146, 45, 99, 191, 108, 96, 146, 203, 206, 65,
+  194, 191, 63, 249, 71, 205, 159, 147, 24, 5, 128, 160, 0, 160, 19, 192, 134,
+  159, 115, 4, 132, 222, 176, 184, 35, 131, 38, 178, 16, 16, 81, 192, 15, 12,
+  98, 117, 67, 161, 5, 93, 124, 177, 161, 245, 227, 18, 68, 249, 15, 232, 127,
+  128, 191, 7, 191, 131, 63, 172, 0, 10, 198, 64, 32, 7, 148, 156, 13, 0, 143,
+  138, 74, 51, 0, 87, 9, 146, 136, 60, 32, 73, 2, 242, 43, 105, 100, 30, 244,
+  168, 178, 80, 101, 255, 230, 211, 139, 128, 236, 15, 193, 31, 158, 253, 139,
+  199, 95, 196, 0, 162, 165, 64, 188, 29, 156, 46, 3, 200, 116, 226, 8, 157,
+  144, 111, 18, 99, 200, 65, 100, 58, 192, 18, 192, 133, 118, 235, 15, 193,
+  239, 116, 127, 182, 250, 7, 226, 143, 217, 192, 97, 27, 168, 127, 41, 40,
+  72, 1, 172, 10, 192, 116, 129, 68, 8, 112, 147, 33, 105, 49, 64, 158, 59,
+  64, 42, 133, 242, 206, 128, 13, 128, 40, 233, 64, 148, 21, 46, 88, 177, 93,
+  31, 128, 241, 195, 103, 127, 88, 249, 71, 37, 96, 184, 2, 96, 12, 0, 37,
+  129, 220, 44, 128, 138, 2, 50, 3, 100, 253, 3, 128, 156, 27, 37, 240, 179,
+  105, 200, 9, 162, 135, 58, 214, 44, 194, 226, 161, 11, 48, 147, 17, 154,
+  15, 206, 119, 139, 191, 211, 251, 175, 64, 213, 63, 2, 127, 248, 42, 40,
+  209, 28, 16, 85, 2, 224, 91, 66, 240, 84, 128, 103, 128, 204, 200, 195, 128,
+  29, 20, 208, 26, 17, 94, 12, 152, 219, 136, 34, 201, 129, 200, 123, 226,
+  126, 184, 11, 149, 126, 194, 209, 63, 73, 255, 172, 0, 144, 19, 0, 127, 8,
+  132, 115, 0, 31, 122, 184, 13, 8, 60, 130, 236, 29, 130, 50, 171, 72, 194,
+  179, 1, 248, 72, 1, 217, 31, 226, 5, 65, 222, 44, 194, 39, 149, 229, 195,
+  198, 243, 236, 222, 207, 130, 223, 151, 254, 89, 250, 71, 18, 0, 201, 20,
+  32, 172, 0, 86, 4, 192, 50, 80, 144, 2, 4, 199, 5, 129, 42, 192, 247, 5,
+  137, 240, 60, 25, 206, 9, 9, 71, 89, 76, 171, 72, 40, 136, 16, 254, 188,
+  124, 176, 221, 129, 223, 29, 252, 66, 226, 15, 154, 254, 177, 99, 64, 89,
+  132, 8, 140, 42, 65, 180, 16, 232, 249, 130, 224, 35, 195, 228, 169, 113,
+  62, 11, 36, 252, 184, 32, 145, 138, 4, 236, 117, 84, 194, 161, 50, 89, 18,
+  248, 190, 177, 124, 179, 117, 188, 18, 194, 239, 87, 127, 160, 252, 3, 240,
+  227, 1, 64, 223, 5, 195, 58, 130, 249, 121, 48, 154, 11, 120, 147, 152, 56,
+  4, 18, 121, 73, 160, 91, 2, 129, 92, 24, 49, 87, 38, 211, 129, 3, 54, 72,
+  17, 182, 192, 220, 191, 71, 250, 39, 19, 64, 204, 24, 16, 26, 7, 58, 50,
+  32, 141, 63, 170, 11, 162, 105, 32, 19, 18, 194, 36, 90, 37, 244, 9, 161,
+  216, 97, 28, 89, 16, 4, 4, 1, 41, 10, 155, 8, 233, 199, 62, 247, 3, 167,
+  255, 177, 61, 255, 5, 76, 128, 241, 5, 32, 44, 1, 148, 16, 236, 225, 47,
+  188, 51, 34, 12, 1, 105, 4, 192, 179, 2, 244, 182, 137, 132, 231, 4, 96,
+  155, 136, 161, 223, 179, 40, 80, 37, 97, 131, 51, 245, 239, 54, 63, 162,
+  253, 66, 55, 191, 77, 200, 25, 176, 165, 0, 128, 18, 96, 56, 6, 10, 27, 65,
+  119, 239, 123, 93, 128, 133, 62, 113, 90, 16, 15, 1, 242, 38, 33, 1, 23,
+  16, 221, 57, 19, 81, 17, 4, 148, 0, 62, 132, 194, 216, 13, 224, 40, 88, 116,
+  117, 127, 88, 250, 5, 143, 126, 122, 37, 0, 243, 0, 17, 23, 194, 147, 20,
+  16, 119, 4, 96, 150, 48, 76, 22, 160, 12, 66, 220, 221, 226, 81, 55, 11,
+  208, 100, 80, 100, 49, 167, 249, 128, 164, 42, 48, 33, 224, 71, 193, 200,
+  43, 254, 65, 246, 7, 217, 63, 196, 255, 131, 0, 8, 15, 1, 217, 240, 219,
+  224, 79, 50, 95, 7, 160, 167, 65, 124, 12, 136, 237, 33, 153, 233, 125, 122,
+  36, 178, 35, 160, 50, 65, 20, 57, 148, 168, 7, 226, 202, 144, 140, 33, 207,
+  55, 48, 250, 241, 182, 255, 24, 163, 127, 40, 255, 147, 136, 192, 64, 2,
+  192, 117, 224, 168, 8, 8, 78, 11, 225, 46, 145, 62, 39, 9, 137, 123, 70,
+  18, 201, 25, 3, 38, 0, 200, 59, 107, 161, 40, 32, 111, 175, 176, 127, 50,
+  27, 163, 202, 159, 117, 236, 55, 216, 254, 32, 253, 199, 14, 129, 196, 50,
+  64, 63, 8, 16, 83, 168, 131, 55, 115, 80, 140, 242, 135, 136, 181, 33, 140,
+  26, 36, 252, 184, 64, 56, 55, 64, 219, 2, 89, 191, 24, 209, 46, 52, 1, 48,
+  30, 67, 71, 62, 64, 246, 199, 168, 63, 126, 0, 200, 18, 0, 97, 5, 136, 112,
+  4, 9, 231, 66, 114, 151, 16, 117, 116, 36, 139, 38, 3, 152, 100, 44, 241,
+  151, 178, 33, 33, 154, 43, 128, 7, 22, 139, 183, 43, 2, 242, 135, 137, 255,
+  227, 176, 250, 195, 23, 65, 161, 151, 193, 81, 25, 0, 181, 133, 3, 53, 128,
+  25, 11, 128, 17, 128, 77, 7, 178, 254, 99, 34, 70, 28, 162, 47, 35, 148,
+  113, 66, 185, 235, 144, 75, 6, 213, 187, 101, 208, 244, 179, 66, 111, 255,
+  241, 100, 50, 137, 27, 0, 16, 67, 32, 138, 2, 72, 51, 0, 111, 16, 133, 174,
+  142, 145, 104, 67, 212, 112, 32, 139, 81, 6, 240, 98, 128, 5, 64, 140, 195,
+  72, 226, 53, 0, 3, 224, 76, 32, 252, 82, 219, 31, 121, 238, 183, 236, 16,
+  104, 116, 2, 32, 142, 5, 64, 248, 243, 103, 197, 73, 131, 80, 198, 42, 2,
+  17, 180, 48, 145, 120, 8, 68, 178, 177, 172, 75, 192, 9, 34, 211, 42, 156,
+  234, 181, 253, 177, 242, 143, 215, 127, 232, 145, 80, 76, 12, 72, 92, 193,
+  236, 88, 32, 194, 31, 194, 5, 64, 214, 175, 39, 224, 46, 32, 228, 59, 68,
+  190, 79, 64, 182, 191, 160, 48, 156, 96, 90, 63, 64, 252, 25, 91, 79, 125,
+  164, 8, 0, 62, 2, 236, 210, 127, 168, 2, 128, 66, 128, 33, 51, 0, 250, 252,
+  24, 212, 22, 128, 183, 133, 177, 199, 72, 179, 184, 36, 32, 179, 18, 240,
+  170, 17, 195, 19, 229, 221, 194, 177, 112, 236, 179, 130, 39, 255, 224, 177,
+  63, 34, 7, 152, 55, 4, 244, 27, 192, 9, 71, 1, 13, 115, 52, 136, 40, 0, 132,
+  59, 72, 122, 106, 4, 155, 19, 246, 200, 2, 252, 205, 180, 9, 215, 45, 178,
+  18, 50, 138, 63, 220, 43, 28, 241, 46, 250, 199, 183, 127, 237, 253, 148,
+  245, 127, 32, 1, 132, 26, 64, 104, 14, 64, 77, 130, 144, 34, 192, 184, 3,
+  165, 38, 49, 72, 22, 156, 89, 91, 32, 226, 4, 130, 78, 145, 103, 5, 162,
+  142, 161, 122, 247, 48, 217, 250, 59, 232, 67, 229, 127, 12, 78, 128, 178,
+  168, 14, 96, 194, 83, 64, 128, 3, 18, 84, 0, 24, 9, 26, 230, 224, 96, 220,
+  148, 72, 204, 4, 51, 244, 116, 17, 43, 17, 8, 175, 36, 64, 135, 203, 180,
+  3, 177, 253, 248, 33, 160, 248, 59, 174, 95, 180, 252, 99, 249, 31, 186,
+  5, 14, 176, 129, 240, 77, 32, 203, 1, 165, 183, 197, 112, 49, 32, 41, 3,
+  83, 91, 72, 227, 143, 29, 163, 141, 98, 143, 62, 1, 205, 8, 15, 210, 187,
+  31, 222, 255, 147, 9, 39, 0, 251, 103, 192, 65, 9, 144, 45, 1, 152, 39, 92,
+  138, 63, 101, 14, 65, 4, 1, 42, 8, 80, 199, 80, 22, 161, 17, 74, 100, 34,
+  169, 197, 16, 137, 129, 152, 19, 106, 251, 209, 177, 95, 216, 252, 1, 234,
+  239, 24, 228, 255, 94, 3, 136, 60, 14, 8, 149, 1, 38, 152, 6, 68, 227, 47,
+  72, 1, 97, 95, 128, 30, 31, 196, 248, 64, 143, 118, 32, 139, 102, 131, 162,
+  62, 17, 200, 6, 209, 233, 192, 220, 15, 181, 126, 221, 153, 31, 159, 253,
+  5, 222, 31, 170, 1, 0, 174, 130, 7, 102, 192, 156, 18, 100, 208, 20, 128,
+  158, 18, 53, 104, 20, 192, 87, 200, 241, 149, 128, 127, 236, 144, 232, 112,
+  97, 38, 54, 145, 8, 75, 193, 212, 62, 131, 123, 109, 240, 153, 236, 143,
+  122, 63, 176, 6, 128, 52, 129, 136, 42, 0, 234, 6, 131, 210, 0, 103, 14,
+  227, 134, 3, 204, 140, 80, 116, 173, 76, 102, 166, 234, 15, 123, 77, 19,
+  99, 125, 6, 118, 26, 184, 27, 166, 126, 176, 241, 207, 159, 253, 83, 14,
+  32, 129, 4, 4, 111, 127, 200, 16, 230, 170, 64, 224, 80, 56, 202, 27, 132,
+  92, 38, 140, 198, 0, 209, 23, 178, 250, 96, 54, 147, 40, 72, 166, 201, 8,
+  4, 65, 184, 51, 216, 252, 246, 216, 223, 221, 252, 54, 252, 99, 89, 255,
+  207, 236, 127, 145, 14, 12, 218, 1, 233, 177, 32, 21, 6, 180, 46, 68, 207,
+  9, 35, 212, 193, 108, 250, 24, 32, 248, 65, 194, 41, 72, 180, 150, 220, 5,
+  192, 29, 176, 234, 79, 167, 127, 11, 124, 80, 0, 200, 38, 226, 253, 47, 137,
+  0, 67, 229, 0, 218, 24, 36, 61, 44, 32, 24, 17, 138, 239, 152, 203, 204,
+  44, 99, 0, 29, 30, 144, 199, 18, 57, 94, 208, 190, 253, 34, 150, 252, 221,
+  59, 159, 128, 244, 63, 150, 29, 0, 96, 77, 32, 46, 5, 160, 25, 128, 151,
+  3, 240, 2, 224, 97, 30, 25, 0, 148, 93, 64, 104, 33, 207, 102, 28, 3, 132,
+  185, 164, 151, 118, 212, 188, 189, 205, 222, 251, 254, 129, 223, 48, 253,
+  3, 244, 111, 76, 234, 127, 196, 254, 71, 40, 192, 132, 48, 2, 32, 248, 211,
+  174, 0, 3, 143, 134, 248, 83, 131, 146, 219, 197, 8, 235, 72, 207, 16, 200,
+  12, 37, 26, 38, 83, 12, 22, 161, 116, 112, 139, 159, 251, 253, 222, 207,
+  131, 223, 202, 254, 177, 3, 32, 162, 0, 8, 25, 64, 16, 4, 108, 2, 160, 67,
+  64, 122, 135, 0, 163, 13, 9, 58, 3, 65, 119, 152, 69, 180, 4, 66, 185, 64,
+  48, 85, 184, 25, 173, 253, 136, 248, 3, 52, 255, 99, 235, 4, 16, 187, 255,
+  145, 2, 32, 58, 19, 20, 48, 1, 88, 5, 96, 188, 65, 49, 57, 0, 119, 10, 224,
+  250, 176, 228, 18, 234, 44, 2, 253, 222, 67, 101, 73, 66, 248, 60, 92, 251,
+  131, 230, 15, 112, 254, 247, 223, 255, 94, 7, 192, 14, 131, 77, 198, 224,
+  79, 14, 131, 98, 79, 140, 197, 165, 128, 190, 33, 48, 139, 38, 145, 41, 8,
+  146, 233, 210, 63, 82, 220, 175, 35, 127, 148, 245, 115, 12, 157, 0, 228,
+  71, 128, 1, 3, 152, 48, 83, 0, 175, 10, 112, 151, 197, 81, 181, 96, 38, 33,
+  32, 81, 8, 133, 17, 48, 13, 47, 140, 99, 136, 254, 71, 159, 117, 220, 254,
+  32, 249, 235, 212, 31, 110, 255, 115, 207, 129, 129, 109, 128, 180, 25, 0,
+  59, 21, 36, 178, 133, 24, 217, 185, 113, 42, 4, 100, 231, 7, 178, 248, 198,
+  32, 230, 113, 69, 83, 89, 11, 200, 241, 226, 167, 93, 221, 199, 214, 126,
+  38, 161, 248, 7, 121, 127, 198, 228, 1, 80, 105, 0, 0, 23, 195, 77, 188,
+  171, 97, 252, 50, 0, 39, 0, 192, 20, 196, 72, 66, 116, 87, 200, 250, 198,
+  165, 205, 1, 209, 23, 204, 172, 71, 148, 136, 200, 110, 44, 124, 210, 218,
+  247, 54, 245, 15, 124, 159, 193, 51, 159, 68, 253, 191, 127, 17, 120, 72,
+  1, 137, 0, 96, 104, 0, 112, 62, 152, 49, 8, 26, 118, 62, 196, 171, 195, 64,
+  8, 100, 145, 148, 144, 170, 10, 153, 137, 238, 14, 226, 25, 162, 245, 217,
+  63, 64, 204, 159, 32, 255, 126, 249, 31, 227, 243, 95, 31, 126, 81, 0, 240,
+  61, 160, 172, 2, 8, 238, 144, 207, 224, 209, 16, 230, 29, 229, 52, 226, 24,
+  23, 161, 216, 73, 192, 79, 18, 147, 233, 104, 226, 223, 138, 225, 247, 202,
+  255, 88, 160, 255, 195, 2, 160, 159, 255, 133, 42, 128, 161, 228, 0, 35,
+  140, 1, 134, 9, 50, 234, 160, 248, 40, 17, 171, 21, 247, 82, 138, 178, 89,
+  22, 132, 250, 43, 127, 35, 131, 223, 109, 254, 200, 1, 96, 22, 77, 0, 168,
+  171, 193, 97, 252, 137, 4, 192, 6, 128, 168, 14, 68, 233, 130, 25, 101, 24,
+  144, 72, 133, 108, 33, 152, 62, 20, 176, 162, 240, 113, 12, 125, 16, 126,
+  110, 251, 147, 4, 32, 34, 0, 136, 171, 129, 226, 2, 128, 97, 129, 193, 230,
+  207, 34, 149, 65, 129, 109, 0, 22, 10, 229, 71, 76, 164, 228, 48, 139, 134,
+  191, 88, 31, 99, 224, 7, 70, 255, 200, 238, 15, 111, 128, 4, 249, 31, 42,
+  2, 48, 86, 16, 67, 159, 14, 117, 239, 10, 164, 238, 143, 150, 143, 136, 101,
+  7, 136, 50, 138, 18, 114, 94, 82, 182, 14, 176, 143, 178, 132, 99, 33, 161,
+  142, 167, 219, 235, 255, 18, 201, 31, 223, 254, 81, 252, 143, 204, 255, 228,
+  165, 48, 19, 28, 126, 177, 47, 140, 31, 12, 160, 169, 0, 72, 1, 113, 179,
+  66, 94, 44, 206, 100, 38, 2, 178, 65, 152, 170, 97, 252, 75, 105, 246, 247,
+  183, 63, 123, 1, 28, 12, 191, 19, 0, 93, 250, 71, 27, 128, 9, 6, 63, 23,
+  0, 162, 78, 32, 230, 26, 33, 62, 14, 68, 166, 1, 240, 145, 197, 100, 91,
+  32, 243, 21, 245, 140, 130, 63, 23, 103, 127, 150, 254, 17, 79, 1, 12, 243,
+  63, 68, 1, 68, 231, 65, 232, 0, 240, 202, 128, 100, 46, 32, 180, 137, 136,
+  36, 98, 201, 147, 104, 132, 189, 129, 200, 99, 56, 253, 28, 225, 79, 99,
+  178, 63, 232, 253, 29, 7, 55, 0, 122, 22, 112, 120, 251, 19, 78, 128, 190,
+  1, 192, 167, 0, 234, 234, 8, 240, 62, 57, 42, 19, 244, 45, 4, 204, 4, 89,
+  220, 33, 102, 83, 246, 7, 89, 65, 12, 254, 216, 145, 124, 195, 237, 143,
+  222, 250, 215, 59, 255, 67, 247, 1, 78, 216, 33, 224, 68, 108, 10, 49, 236,
+  19, 36, 152, 209, 160, 232, 98, 217, 8, 54, 128, 242, 66, 202, 65, 32, 53,
+  21, 185, 63, 37, 111, 36, 154, 245, 135, 174, 230, 207, 108, 127, 111, 247,
+  11, 243, 63, 172, 0, 201, 220, 192, 25, 241, 192, 80, 153, 43, 136, 19, 132,
+  249, 18, 0, 132, 129, 188, 53, 36, 158, 76, 197, 182, 4, 205, 27, 180, 169,
+  200, 76, 220, 129, 245, 80, 94, 252, 40, 48, 244, 33, 182, 127, 184, 249,
+  199, 40, 253, 135, 243, 127, 136, 190, 192, 9, 52, 17, 59, 2, 152, 27, 67,
+  232, 201, 160, 224, 208, 136, 232, 110, 1, 234, 153, 100, 56, 43, 196, 42,
+  12, 159, 81, 216, 142, 18, 183, 33, 125, 24, 152, 249, 66, 228, 63, 232,
+  254, 227, 242, 191, 36, 1, 16, 215, 130, 77, 56, 75, 88, 84, 10, 112, 144,
+  199, 200, 32, 153, 8, 132, 189, 33, 69, 12, 161, 136, 10, 193, 39, 127, 131,
+  8, 95, 42, 58, 105, 248, 95, 248, 204, 223, 39, 255, 126, 250, 31, 147, 246,
+  31, 84, 0, 240, 166, 0, 216, 163, 225, 38, 12, 252, 140, 41, 76, 32, 6, 9,
+  252, 1, 120, 42, 16, 54, 4, 153, 135, 119, 70, 254, 222, 130, 10, 211, 227,
+  14, 35, 242, 254, 130, 235, 241, 198, 207, 79, 255, 128, 245, 123, 12, 162,
+  143, 79, 128, 123, 38, 128, 137, 216, 21, 10, 23, 0, 241, 112, 88, 20, 1,
+  52, 23, 244, 33, 35, 244, 39, 150, 113, 88, 111, 194, 203, 75, 34, 102, 79,
+  4, 165, 124, 255, 132, 104, 252, 59, 240, 69, 234, 15, 2, 63, 82, 255, 177,
+  59, 33, 67, 6, 192, 143, 132, 13, 255, 240, 144, 85, 137, 0, 52, 6, 220,
+  166, 67, 230, 69, 65, 67, 44, 131, 209, 231, 239, 182, 21, 132, 193, 123,
+  81, 234, 135, 164, 127, 170, 254, 103, 132, 3, 8, 69, 31, 57, 14, 54, 17,
+  192, 15, 95, 22, 220, 55, 2, 152, 83, 35, 60, 27, 68, 166, 16, 200, 67, 236,
+  184, 131, 138, 232, 24, 66, 114, 127, 133, 112, 26, 157, 153, 119, 187, 91,
+  159, 196, 159, 169, 255, 153, 228, 8, 16, 105, 5, 129, 19, 192, 132, 150,
+  131, 69, 17, 192, 138, 194, 113, 17, 224, 129, 79, 211, 78, 242, 246, 106,
+  224, 247, 102, 79, 44, 139, 196, 71, 97, 46, 120, 87, 216, 245, 251, 71,
+  190, 194, 131, 127, 80, 253, 207, 38, 194, 250, 31, 91, 0, 144, 68, 96, 30,
+  253, 8, 64, 31, 86, 64, 168, 208, 208, 157, 149, 224, 31, 24, 115, 133, 137,
+  236, 212, 18, 152, 15, 222, 73, 215, 126, 95, 252, 97, 202, 63, 93, 255,
+  161, 41, 0, 126, 30, 216, 199, 127, 194, 251, 193, 232, 235, 2, 216, 126,
+  16, 2, 29, 156, 18, 50, 110, 52, 98, 28, 21, 34, 207, 77, 165, 105, 122,
+  24, 163, 66, 129, 65, 240, 118, 34, 247, 67, 233, 159, 111, 255, 45, 248,
+  177, 237, 143, 223, 9, 29, 78, 1, 38, 162, 30, 16, 86, 132, 98, 120, 0, 130,
+  130, 31, 10, 204, 159, 31, 119, 81, 129, 104, 48, 205, 117, 8, 145, 199,
+  22, 188, 79, 223, 6, 20, 255, 73, 175, 242, 143, 245, 255, 84, 1, 144, 227,
+  31, 99, 11, 37, 196, 160, 104, 147, 88, 247, 1, 57, 140, 54, 98, 57, 186,
+  167, 24, 41, 10, 129, 152, 209, 116, 253, 238, 173, 196, 230, 247, 71, 191,
+  94, 242, 31, 163, 207, 127, 129, 29, 160, 48, 250, 12, 254, 162, 123, 162,
+  13, 7, 4, 58, 24, 148, 92, 41, 46, 19, 33, 96, 57, 2, 13, 0, 142, 129, 128,
+  254, 20, 78, 41, 18, 207, 38, 187, 4, 240, 22, 80, 244, 243, 122, 127, 204,
+  250, 59, 38, 239, 255, 103, 58, 128, 9, 228, 1, 65, 240, 247, 197, 0, 19,
+  123, 58, 0, 81, 132, 184, 125, 40, 187, 165, 22, 159, 72, 96, 227, 8, 34,
+  14, 136, 38, 81, 122, 179, 153, 175, 20, 132, 242, 81, 247, 165, 55, 17,
+  155, 191, 77, 253, 164, 250, 51, 246, 209, 119, 9, 128, 160, 7, 36, 78, 3,
+  246, 51, 5, 74, 139, 49, 57, 23, 112, 254, 240, 9, 53, 143, 36, 186, 81,
+  84, 142, 20, 49, 81, 154, 27, 70, 85, 5, 236, 191, 55, 2, 155, 63, 156, 251,
+  137, 212, 31, 102, 0, 192, 18, 64, 87, 2, 6, 94, 124, 62, 3, 51, 165, 152,
+  73, 2, 254, 166, 7, 142, 37, 77, 162, 146, 0, 250, 52, 107, 238, 47, 33,
+  59, 196, 206, 206, 16, 4, 173, 194, 111, 0, 224, 67, 202, 159, 239, 253,
+  162, 159, 255, 229, 109, 127, 175, 3, 148, 227, 63, 17, 83, 0, 166, 16, 11,
+  93, 130, 38, 244, 163, 161, 67, 201, 9, 239, 78, 39, 30, 103, 220, 115, 66,
+  201, 139, 134, 60, 55, 112, 62, 252, 53, 24, 124, 20, 127, 150, 254, 195,
+  252, 223, 2, 158, 111, 0, 92, 232, 165, 240, 75, 181, 32, 20, 254, 44, 131,
+  46, 38, 152, 196, 42, 210, 112, 62, 50, 177, 109, 9, 215, 30, 24, 254, 198,
+  91, 32, 16, 130, 76, 240, 122, 24, 124, 28, 127, 70, 254, 245, 12, 32, 52,
+  1, 16, 157, 6, 157, 240, 118, 0, 195, 58, 3, 240, 16, 104, 62, 244, 255,
+  26, 216, 45, 117, 76, 45, 48, 148, 75, 145, 170, 73, 224, 85, 70, 244, 41,
+  70, 137, 102, 196, 213, 133, 95, 113, 145, 119, 160, 103, 196, 191, 49, 213,
+  254, 5, 2, 96, 15, 252, 163, 235, 175, 17, 95, 24, 227, 192, 63, 65, 254,
+  35, 30, 86, 35, 182, 168, 2, 247, 21, 9, 142, 46, 24, 130, 22, 8, 216, 97,
+  48, 96, 198, 163, 224, 117, 104, 234, 15, 119, 63, 63, 253, 7, 12, 64, 242,
+  22, 0, 196, 95, 68, 0, 249, 62, 16, 101, 130, 200, 137, 36, 242, 137, 245,
+  82, 54, 136, 119, 132, 178, 16, 64, 135, 135, 188, 115, 69, 52, 182, 46,
+  222, 253, 18, 212, 245, 97, 217, 63, 104, 255, 198, 216, 243, 191, 97, 7,
+  168, 28, 127, 241, 237, 96, 19, 178, 9, 160, 153, 224, 36, 60, 142, 226,
+  199, 130, 144, 142, 198, 140, 168, 129, 136, 164, 15, 48, 17, 172, 48, 146,
+  23, 0, 149, 225, 53, 40, 241, 147, 224, 15, 185, 255, 33, 2, 40, 194, 31,
+  194, 30, 121, 88, 108, 188, 26, 28, 188, 220, 193, 197, 228, 128, 43, 109,
+  130, 93, 81, 130, 101, 128, 137, 240, 175, 4, 30, 96, 103, 230, 70, 176,
+  139, 157, 59, 208, 146, 53, 38, 36, 3, 199, 194, 207, 139, 118, 63, 53, 252,
+  25, 103, 146, 1, 128, 28, 255, 41, 201, 55, 220, 135, 187, 117, 119, 66,
+  25, 146, 252, 108, 16, 198, 128, 192, 160, 32, 104, 13, 233, 66, 192, 30,
+  101, 19, 8, 5, 146, 70, 241, 231, 64, 232, 125, 244, 189, 238, 159, 116,
+  127, 145, 13, 160, 80, 2, 228, 201, 55, 119, 48, 0, 39, 2, 248, 173, 4, 184,
+  57, 9, 13, 72, 40, 44, 39, 194, 142, 128, 180, 174, 10, 142, 51, 82, 14,
+  54, 241, 49, 199, 159, 1, 161, 183, 148, 95, 71, 251, 143, 145, 255, 92,
+  240, 163, 240, 23, 49, 128, 73, 214, 163, 8, 112, 167, 146, 4, 215, 148,
+  8, 232, 224, 132, 134, 95, 64, 6, 194, 100, 192, 48, 195, 190, 196, 224,
+  167, 93, 232, 109, 244, 1, 242, 223, 71, 254, 141, 196, 31, 218, 254, 125,
+  74, 0, 208, 13, 50, 199, 210, 160, 48, 32, 66, 128, 187, 187, 120, 66, 160,
+  207, 150, 2, 161, 131, 5, 125, 14, 38, 157, 4, 172, 15, 127, 18, 171, 252,
+  94, 242, 231, 196, 63, 82, 255, 99, 24, 0, 209, 119, 115, 148, 75, 124, 83,
+  76, 54, 145, 206, 36, 133, 23, 21, 76, 162, 6, 213, 19, 105, 149, 50, 89,
+  148, 153, 40, 214, 217, 30, 132, 192, 171, 224, 202, 31, 20, 127, 49, 254,
+  180, 0, 132, 225, 79, 168, 111, 152, 4, 48, 137, 72, 0, 146, 99, 41, 162,
+  99, 202, 84, 8, 224, 17, 48, 145, 6, 169, 161, 111, 183, 137, 185, 239, 72,
+  56, 74, 122, 37, 143, 254, 170, 227, 143, 110, 127, 252, 80, 200, 68, 200,
+  1, 187, 180, 79, 7, 0, 154, 2, 232, 16, 144, 77, 170, 38, 81, 214, 21, 94,
+  178, 98, 196, 34, 128, 16, 224, 23, 226, 190, 130, 206, 252, 226, 225, 143,
+  80, 0, 102, 175, 131, 34, 110, 135, 141, 207, 1, 38, 243, 206, 36, 48, 77,
+  9, 145, 2, 32, 30, 0, 204, 8, 99, 78, 47, 201, 52, 2, 35, 54, 180, 9, 30,
+  143, 27, 190, 249, 49, 68, 244, 241, 55, 255, 76, 240, 167, 38, 128, 192,
+  222, 167, 159, 17, 35, 120, 89, 189, 67, 41, 116, 87, 10, 221, 85, 73, 94,
+  87, 193, 8, 21, 177, 42, 177, 200, 200, 198, 95, 119, 34, 168, 7, 118, 0,
+  252, 71, 0, 125, 104, 243, 79, 139, 191, 224, 37, 150, 220, 11, 21, 147,
+  2, 240, 186, 228, 129, 206, 246, 132, 232, 133, 21, 162, 71, 217, 76, 34,
+  201, 0, 173, 95, 35, 105, 128, 213, 9, 144, 40, 120, 185, 7, 59, 146, 252,
+  93, 225, 135, 163, 255, 36, 254, 34, 150, 69, 90, 130, 5, 243, 160, 112,
+  40, 225, 11, 19, 217, 4, 132, 159, 17, 133, 68, 173, 138, 255, 247, 155,
+  196, 213, 2, 244, 194, 123, 218, 211, 196, 95, 131, 8, 69, 193, 203, 224,
+  157, 111, 1, 47, 76, 255, 189, 240, 167, 120, 246, 132, 145, 91, 136, 87,
+  21, 156, 74, 249, 127, 53, 238, 239, 71, 92, 90, 70, 20, 3, 23, 115, 78,
+  184, 152, 80, 10, 129, 225, 179, 129, 244, 14, 60, 188, 40, 252, 123, 31,
+  123, 120, 243, 11, 240, 167, 249, 63, 119, 27, 92, 176, 247, 233, 2, 64,
+  100, 0, 32, 38, 121, 109, 10, 191, 171, 132, 226, 130, 236, 241, 5, 116,
+  94, 28, 97, 102, 19, 24, 219, 96, 147, 161, 36, 18, 204, 75, 56, 230, 47,
+  86, 255, 96, 252, 221, 141, 198, 52, 128, 32, 23, 140, 80, 219, 60, 244,
+  39, 178, 217, 164, 36, 2, 36, 217, 10, 239, 8, 101, 212, 117, 194, 89, 9,
+  9, 91, 75, 247, 54, 82, 51, 122, 113, 72, 248, 221, 35, 31, 225, 246, 231,
+  167, 63, 232, 8, 136, 56, 8, 136, 229, 87, 204, 13, 12, 190, 152, 4, 47,
+  5, 67, 19, 57, 169, 16, 17, 1, 132, 92, 53, 17, 30, 101, 146, 13, 50, 184,
+  67, 6, 24, 39, 68, 207, 191, 86, 239, 190, 31, 236, 249, 192, 244, 207, 108,
+  127, 191, 213, 22, 105, 64, 244, 107, 138, 158, 8, 128, 219, 108, 46, 52,
+  161, 191, 27, 97, 85, 165, 38, 132, 220, 240, 146, 24, 95, 161, 69, 96, 146,
+  113, 99, 35, 195, 8, 134, 134, 231, 5, 126, 24, 188, 8, 66, 222, 223, 252,
+  40, 252, 227, 140, 243, 127, 179, 21, 54, 35, 77, 56, 34, 161, 117, 210,
+  38, 126, 52, 52, 1, 2, 128, 253, 69, 233, 89, 21, 26, 3, 148, 131, 133, 123,
+  214, 249, 164, 183, 60, 128, 31, 122, 228, 39, 8, 101, 0, 188, 112, 194,
+  213, 126, 220, 251, 49, 70, 57, 86, 4, 1, 196, 115, 0, 229, 7, 246, 99, 128,
+  205, 77, 96, 122, 162, 243, 20, 95, 7, 56, 255, 202, 68, 192, 5, 228, 70,
+  50, 195, 240, 67, 110, 146, 12, 226, 255, 93, 48, 238, 33, 251, 67, 189,
+  127, 12, 201, 22, 179, 43, 246, 72, 24, 222, 9, 78, 160, 123, 105, 177, 0,
+  205, 250, 85, 42, 178, 22, 80, 154, 0, 244, 247, 143, 80, 50, 98, 15, 25,
+  200, 142, 191, 180, 31, 188, 0, 221, 250, 109, 9, 128, 183, 63, 112, 246,
+  19, 206, 177, 212, 203, 202, 71, 0, 123, 34, 96, 146, 141, 33, 252, 225,
+  195, 201, 29, 248, 97, 8, 248, 231, 149, 34, 70, 196, 248, 244, 138, 121,
+  206, 233, 164, 215, 176, 64, 124, 238, 144, 191, 29, 51, 251, 118, 217, 246,
+  247, 225, 31, 195, 20, 91, 216, 101, 179, 196, 90, 56, 105, 155, 148, 123,
+  31, 194, 127, 76, 182, 39, 72, 171, 18, 232, 66, 200, 136, 144, 181, 9, 176,
+  78, 38, 70, 207, 234, 227, 113, 161, 31, 147, 137, 142, 145, 190, 149, 132,
+  94, 226, 252, 15, 8, 118, 116, 1, 16, 92, 11, 137, 20, 1, 43, 55, 9, 252,
+  137, 97, 4, 80, 53, 128, 106, 6, 56, 253, 18, 101, 3, 156, 66, 52, 213, 232,
+  16, 155, 30, 81, 199, 96, 158, 143, 3, 143, 158, 251, 31, 203, 59, 44, 218,
+  5, 70, 70, 0, 157, 66, 203, 207, 198, 113, 248, 123, 97, 26, 193, 87, 17,
+  171, 8, 167, 96, 145, 73, 128, 180, 54, 245, 180, 16, 16, 49, 128, 100, 131,
+  127, 233, 192, 77, 110, 127, 137, 250, 139, 108, 40, 114, 204, 198, 50, 106,
+  248, 5, 244, 168, 41, 196, 81, 177, 251, 41, 120, 73, 0, 183, 45, 72, 216,
+  171, 132, 13, 242, 247, 157, 137, 99, 192, 8, 237, 239, 64, 171, 152, 125,
+  51, 7, 190, 16, 126, 100, 202, 38, 59, 7, 24, 105, 188, 117, 208, 31, 79,
+  220, 255, 217, 3, 170, 32, 93, 1, 21, 33, 44, 9, 144, 236, 69, 98, 25, 146,
+  223, 118, 53, 97, 205, 132, 172, 86, 68, 159, 133, 248, 70, 65, 238, 31,
+  51, 204, 74, 164, 255, 210, 151, 129, 18, 119, 2, 65, 47, 154, 199, 76, 29,
+  252, 5, 85, 106, 130, 93, 89, 66, 208, 0, 62, 5, 240, 1, 192, 156, 38, 152,
+  72, 167, 198, 19, 1, 254, 8, 53, 240, 171, 193, 243, 0, 224, 129, 236, 31,
+  190, 168, 108, 251, 47, 79, 0, 220, 163, 65, 252, 15, 193, 224, 28, 35, 157,
+  128, 36, 8, 50, 41, 19, 228, 148, 65, 140, 16, 224, 222, 118, 31, 126, 97,
+  12, 120, 150, 199, 9, 30, 10, 76, 147, 248, 245, 33, 248, 112, 2, 32, 26,
+  0, 73, 255, 207, 187, 174, 195, 4, 0, 103, 79, 251, 111, 86, 131, 62, 14,
+  56, 0, 240, 23, 205, 200, 114, 192, 240, 0, 144, 10, 226, 39, 71, 176, 73,
+  6, 83, 212, 28, 216, 89, 159, 67, 196, 220, 8, 247, 23, 62, 39, 76, 249,
+  46, 248, 99, 90, 251, 129, 111, 255, 34, 95, 70, 116, 178, 2, 223, 10, 237,
+  110, 154, 48, 55, 1, 60, 144, 125, 68, 57, 90, 180, 176, 192, 101, 124, 98,
+  162, 0, 32, 221, 205, 228, 197, 87, 204, 168, 96, 34, 141, 2, 160, 32, 124,
+  237, 132, 7, 159, 215, 86, 66, 58, 237, 190, 122, 113, 47, 30, 94, 58, 17,
+  118, 50, 142, 45, 1, 28, 13, 164, 228, 11, 222, 51, 78, 7, 0, 46, 110, 79,
+  68, 165, 96, 34, 198, 159, 61, 130, 154, 127, 244, 44, 4, 124, 20, 254, 200,
+  17, 43, 127, 12, 76, 126, 34, 8, 158, 76, 97, 248, 115, 240, 79, 120, 45,
+  0, 107, 8, 1, 220, 37, 106, 150, 176, 43, 96, 45, 111, 147, 172, 143, 84,
+  8, 43, 5, 207, 132, 106, 126, 152, 253, 5, 243, 181, 168, 134, 58, 254, 212,
+  85, 241, 135, 19, 9, 170, 99, 2, 204, 67, 42, 241, 186, 197, 167, 0, 170,
+  19, 16, 55, 3, 220, 97, 103, 89, 37, 232, 59, 51, 240, 227, 224, 233, 1,
+  234, 64, 243, 79, 176, 127, 118, 254, 139, 241, 63, 116, 251, 35, 27, 101,
+  76, 12, 167, 209, 18, 32, 74, 2, 25, 197, 3, 99, 132, 97, 241, 84, 139, 106,
+  10, 185, 16, 136, 241, 15, 76, 120, 137, 224, 171, 112, 220, 209, 91, 63,
+  105, 250, 199, 188, 122, 189, 18, 0, 99, 77, 69, 88, 32, 112, 81, 169, 152,
+  4, 176, 76, 32, 12, 1, 242, 32, 57, 110, 111, 1, 223, 193, 115, 2, 60, 9,
+  76, 196, 172, 208, 139, 132, 167, 56, 88, 131, 197, 63, 130, 254, 73, 95,
+  58, 222, 92, 225, 108, 23, 240, 116, 2, 213, 5, 48, 211, 224, 136, 20, 192,
+  217, 196, 194, 119, 2, 215, 24, 45, 15, 81, 119, 160, 225, 250, 96, 207,
+  241, 225, 87, 2, 240, 3, 244, 143, 175, 166, 146, 18, 42, 63, 121, 109, 255,
+  135, 28, 77, 69, 84, 202, 0, 254, 177, 52, 3, 128, 41, 0, 193, 63, 56, 56,
+  22, 161, 107, 8, 174, 155, 147, 220, 132, 57, 145, 31, 137, 37, 214, 117,
+  62, 228, 16, 252, 16, 250, 99, 191, 153, 150, 53, 0, 140, 144, 26, 190, 64,
+  232, 225, 100, 36, 83, 121, 9, 11, 201, 1, 99, 76, 9, 0, 224, 151, 169, 130,
+  130, 170, 54, 145, 220, 54, 39, 156, 124, 71, 151, 131, 234, 203, 173, 82,
+  104, 38, 85, 33, 120, 60, 15, 191, 84, 253, 195, 7, 0, 236, 61, 96, 104,
+  254, 71, 175, 166, 16, 145, 64, 129, 114, 133, 50, 24, 188, 14, 80, 199,
+  199, 166, 81, 134, 162, 46, 66, 163, 187, 2, 185, 70, 240, 184, 73, 152,
+  245, 199, 19, 64, 252, 229, 173, 53, 18, 41, 149, 221, 254, 46, 89, 194,
+  46, 164, 39, 165, 42, 127, 28, 76, 21, 130, 140, 9, 130, 76, 112, 164, 89,
+  242, 143, 226, 78, 146, 137, 39, 69, 194, 211, 16, 98, 54, 112, 141, 143,
+  119, 31, 241, 143, 233, 161, 200, 250, 79, 188, 62, 236, 149, 212, 104, 6,
+  8, 219, 150, 177, 84, 191, 64, 4, 33, 116, 156, 73, 199, 53, 216, 227, 82,
+  126, 17, 178, 33, 144, 68, 192, 68, 60, 42, 40, 191, 120, 181, 0, 254, 24,
+  41, 133, 8, 0, 129, 120, 98, 103, 200, 9, 122, 51, 105, 132, 12, 0, 115,
+  129, 49, 199, 1, 225, 66, 32, 242, 53, 74, 46, 21, 161, 143, 188, 176, 87,
+  77, 144, 66, 49, 127, 3, 133, 243, 217, 21, 238, 11, 40, 42, 255, 100, 253,
+  23, 90, 171, 153, 30, 48, 19, 94, 74, 143, 7, 172, 63, 8, 16, 9, 66, 168,
+  59, 8, 197, 159, 32, 130, 66, 223, 48, 114, 236, 65, 122, 45, 178, 36, 2,
+  8, 177, 240, 50, 4, 254, 152, 242, 143, 21, 78, 209, 69, 160, 48, 77, 2,
+  31, 74, 17, 155, 1, 2, 53, 88, 244, 143, 32, 135, 2, 160, 176, 41, 241, 9,
+  77, 216, 123, 38, 39, 200, 140, 80, 198, 6, 72, 71, 49, 33, 21, 94, 28, 192,
+  13, 192, 47, 238, 254, 153, 198, 9, 153, 159, 5, 240, 211, 79, 164, 226,
+  50, 64, 168, 2, 48, 146, 96, 38, 76, 2, 236, 100, 64, 88, 9, 162, 78, 21,
+  195, 240, 139, 74, 1, 171, 18, 229, 159, 237, 5, 97, 15, 248, 20, 119, 244,
+  75, 36, 160, 18, 59, 196, 126, 89, 38, 193, 3, 233, 122, 113, 64, 119, 243,
+  11, 89, 96, 198, 121, 218, 189, 58, 0, 143, 6, 197, 101, 142, 191, 5, 7,
+  117, 13, 201, 158, 150, 195, 142, 141, 46, 176, 95, 180, 96, 235, 143, 153,
+  217, 143, 116, 142, 78, 248, 232, 130, 87, 6, 125, 26, 49, 139, 63, 60, 9,
+  68, 93, 1, 99, 137, 51, 68, 32, 8, 97, 199, 70, 224, 127, 169, 88, 21, 136,
+  108, 9, 144, 211, 230, 220, 13, 20, 187, 69, 240, 79, 213, 254, 49, 76, 217,
+  125, 61, 176, 135, 145, 67, 18, 32, 234, 86, 133, 224, 143, 156, 10, 138,
+  230, 66, 76, 55, 8, 220, 46, 38, 176, 61, 177, 246, 65, 105, 4, 136, 238,
+  205, 58, 47, 196, 28, 76, 164, 49, 237, 95, 224, 167, 68, 149, 18, 191, 253,
+  11, 159, 69, 79, 60, 144, 124, 76, 217, 21, 61, 30, 48, 142, 81, 2, 0, 139,
+  168, 248, 236, 48, 210, 15, 68, 156, 35, 228, 238, 30, 37, 202, 192, 4, 178,
+  16, 210, 148, 96, 187, 139, 118, 56, 79, 67, 207, 125, 139, 95, 169, 140,
+  191, 116, 175, 41, 252, 53, 250, 33, 252, 228, 243, 41, 188, 195, 138, 8,
+  252, 168, 51, 140, 172, 3, 153, 68, 17, 148, 197, 64, 214, 43, 8, 196, 83,
+  2, 148, 14, 146, 1, 176, 5, 195, 126, 44, 159, 164, 102, 184, 1, 60, 38,
+  255, 183, 232, 143, 69, 207, 36, 23, 136, 0, 212, 241, 16, 153, 61, 12, 17,
+  3, 133, 173, 128, 72, 240, 196, 45, 67, 172, 50, 36, 109, 8, 136, 35, 38,
+  155, 160, 29, 31, 86, 209, 40, 241, 52, 155, 224, 53, 18, 37, 72, 45, 248,
+  104, 14, 32, 241, 71, 154, 64, 191, 29, 140, 51, 6, 100, 148, 26, 68, 121,
+  133, 209, 0, 8, 116, 79, 246, 20, 20, 113, 176, 84, 36, 17, 50, 67, 163,
+  37, 10, 123, 242, 222, 15, 226, 44, 5, 69, 0, 144, 34, 48, 246, 208, 39,
+  30, 75, 31, 33, 3, 137, 207, 135, 140, 165, 28, 128, 54, 57, 113, 71, 222,
+  25, 213, 171, 175, 66, 140, 106, 67, 116, 10, 40, 222, 45, 128, 175, 152,
+  95, 253, 35, 204, 63, 189, 8, 64, 128, 190, 172, 4, 4, 227, 96, 54, 2, 232,
+  140, 6, 202, 65, 252, 169, 97, 60, 9, 72, 58, 158, 152, 251, 16, 200, 179,
+  4, 17, 17, 208, 189, 77, 88, 248, 69, 201, 18, 127, 109, 4, 204, 120, 18,
+  160, 31, 212, 0, 12, 127, 210, 14, 36, 116, 134, 70, 153, 195, 208, 51, 99,
+  180, 93, 152, 184, 104, 26, 119, 193, 203, 233, 32, 165, 14, 50, 92, 192,
+  47, 151, 99, 182, 249, 27, 83, 114, 153, 108, 106, 238, 188, 201, 81, 92,
+  113, 192, 119, 225, 71, 117, 96, 210, 16, 42, 57, 30, 196, 90, 195, 224,
+  99, 195, 156, 204, 197, 140, 134, 132, 94, 129, 200, 32, 160, 60, 132, 84,
+  34, 88, 145, 108, 254, 104, 250, 47, 189, 91, 201, 222, 252, 99, 170, 8,
+  200, 230, 0, 172, 140, 1, 16, 128, 113, 156, 59, 48, 198, 41, 140, 95, 50,
+  78, 28, 31, 65, 142, 195, 82, 23, 205, 160, 70, 98, 193, 173, 19, 203, 222,
+  230, 239, 151, 254, 229, 249, 223, 15, 128, 177, 8, 126, 10, 127, 242, 228,
+  10, 237, 11, 3, 175, 52, 164, 149, 0, 226, 95, 137, 221, 42, 153, 193, 129,
+  32, 118, 140, 73, 174, 160, 38, 31, 158, 67, 221, 163, 120, 122, 2, 181,
+  204, 61, 134, 255, 228, 205, 74, 88, 0, 212, 169, 31, 134, 159, 198, 159,
+  124, 86, 1, 57, 18, 132, 66, 96, 44, 85, 2, 184, 74, 71, 5, 0, 37, 10, 113,
+  232, 71, 184, 134, 184, 129, 177, 83, 4, 78, 82, 251, 63, 56, 72, 39, 62,
+  66, 193, 109, 127, 123, 243, 175, 192, 232, 67, 28, 112, 18, 49, 10, 132,
+  173, 225, 189, 67, 128, 192, 31, 204, 2, 148, 83, 80, 102, 20, 18, 38, 1,
+  198, 50, 194, 60, 84, 251, 24, 179, 249, 35, 165, 18, 150, 254, 217, 175,
+  70, 3, 253, 74, 0, 125, 32, 4, 80, 131, 64, 184, 7, 128, 169, 108, 172, 49,
+  172, 167, 38, 44, 208, 4, 5, 147, 208, 44, 226, 250, 105, 153, 58, 24, 82,
+  194, 35, 48, 250, 50, 241, 31, 226, 71, 216, 243, 150, 2, 207, 116, 176,
+  245, 199, 189, 240, 167, 110, 46, 18, 81, 192, 49, 223, 10, 100, 81, 55,
+  9, 226, 23, 204, 19, 125, 64, 31, 38, 128, 248, 5, 100, 78, 226, 58, 10,
+  14, 17, 251, 223, 75, 0, 172, 121, 158, 190, 89, 211, 203, 131, 21, 248,
+  43, 44, 252, 168, 6, 16, 202, 64, 188, 22, 64, 218, 194, 224, 169, 80, 70,
+  223, 35, 40, 106, 122, 196, 211, 65, 201, 9, 34, 246, 153, 25, 81, 100, 224,
+  32, 34, 151, 147, 179, 95, 230, 244, 12, 118, 11, 132, 21, 3, 147, 149, 26,
+  251, 149, 105, 240, 199, 30, 85, 10, 169, 1, 164, 43, 108, 60, 145, 210,
+  192, 24, 163, 184, 64, 19, 140, 25, 17, 202, 47, 29, 132, 224, 71, 168, 224,
+  126, 111, 92, 10, 165, 255, 177, 76, 38, 23, 54, 0, 157, 226, 67, 5, 128,
+  215, 5, 160, 118, 80, 242, 226, 114, 246, 154, 168, 113, 4, 5, 144, 226,
+  143, 10, 130, 100, 55, 40, 179, 141, 75, 206, 20, 199, 93, 61, 246, 108,
+  163, 107, 200, 75, 241, 87, 252, 117, 41, 254, 186, 20, 127, 93, 138, 191,
+  174, 97, 173, 103, 233, 75, 160, 248, 235, 26, 46, 254, 137, 190, 6, 67,
+  94, 251, 20, 127, 197, 95, 151, 226, 175, 75, 241, 215, 165, 248, 235, 82,
+  252, 117, 13, 102, 61, 83, 241, 31, 54, 254, 250, 18, 40, 254, 186, 20, 127,
+  93, 138, 191, 46, 197, 95, 151, 226, 175, 107, 56, 253, 191, 190, 4, 138,
+  191, 174, 225, 226, 159, 233, 107, 160, 248, 235, 82, 252, 117, 41, 254,
+  186, 20, 127, 93, 138, 191, 46, 197, 95, 151, 226, 175, 75, 241, 215, 165,
+  248, 235, 82, 252, 117, 205, 39, 254, 26, 0, 138, 191, 46, 197, 95, 151,
+  226, 175, 75, 241, 215, 165, 248, 235, 82, 252, 117, 41, 254, 186, 6, 128,
+  191, 6, 128, 226, 175, 75, 241, 215, 165, 248, 235, 82, 252, 117, 41, 254,
+  186, 20, 127, 93, 3, 193, 95, 3, 64, 241, 215, 165, 248, 235, 26, 222, 122,
+  150, 226, 175, 248, 235, 203, 160, 248, 235, 26, 46, 254, 26, 0, 138, 191,
+  46, 197, 95, 151, 226, 175, 75, 241, 215, 165, 248, 235, 26, 16, 254, 26,
+  0, 138, 191, 46, 197, 95, 151, 226, 175, 75, 241, 215, 53, 48, 252, 53, 0,
+  20, 127, 93, 138, 191, 46, 197, 95, 151, 226, 175, 107, 96, 248, 107, 0,
+  40, 254, 186, 20, 127, 93, 138, 191, 46, 197, 95, 215, 192, 240, 215, 0,
+  80, 252, 117, 41, 254, 186, 20, 127, 93, 3, 196, 95, 3, 64, 241, 215, 165,
+  248, 235, 82, 252, 117, 13, 16, 127, 13, 0, 197, 95, 215, 128, 241, 215,
+  0, 208, 253, 175, 75, 247, 191, 46, 197, 95, 151, 226, 175, 107, 96, 248,
+  107, 0, 40, 254, 186, 20, 127, 93, 138, 191, 174, 1, 226, 175, 1, 160, 248,
+  235, 82, 252, 117, 13, 20, 127, 13, 0, 197, 95, 151, 226, 175, 107, 160,
+  248, 107, 0, 40, 254, 186, 6, 140, 191, 6, 128, 238, 127, 93, 138, 191, 46,
+  205, 255, 186, 20, 127, 93, 138, 191, 174, 1, 225, 175, 1, 160, 248, 235,
+  82, 252, 117, 13, 20, 127, 13, 0, 197, 95, 151, 226, 175, 107, 160, 248,
+  107, 0, 40, 254, 186, 20, 127, 93, 3, 197, 95, 3, 64, 241, 215, 165, 248,
+  235, 26, 42, 254, 26, 1, 131, 198, 95, 225, 87, 252, 117, 41, 254, 186, 6,
+  138, 191, 70, 128, 226, 175, 75, 241, 215, 53, 84, 252, 53, 0, 20, 127, 93,
+  138, 191, 46, 197, 95, 215, 0, 241, 215, 0, 80, 252, 117, 41, 254, 186, 134,
+  138, 191, 70, 128, 226, 175, 107, 176, 248, 107, 5, 80, 252, 117, 13, 25,
+  127, 13, 0, 197, 95, 151, 226, 175, 75, 241, 215, 53, 68, 252, 53, 2, 20,
+  127, 93, 138, 191, 174, 65, 226, 175, 12, 96, 240, 248, 107, 4, 12, 26, 127,
+  133, 95, 241, 215, 165, 248, 235, 26, 42, 254, 26, 1, 138, 191, 174, 193,
+  226, 175, 21, 64, 241, 215, 53, 104, 252, 53, 2, 20, 127, 93, 138, 191, 174,
+  161, 226, 175, 17, 48, 104, 252, 21, 254, 33, 227, 175, 45, 128, 226, 175,
+  107, 216, 248, 107, 4, 40, 254, 186, 20, 127, 93, 138, 191, 174, 33, 226,
+  175, 17, 48, 96, 252, 53, 3, 12, 29, 127, 133, 127, 240, 248, 107, 8, 12,
+  26, 127, 133, 95, 241, 215, 165, 248, 235, 26, 38, 255, 215, 8, 24, 244,
+  254, 87, 252, 135, 142, 191, 194, 63, 120, 252, 53, 4, 6, 141, 191, 194,
+  175, 248, 235, 26, 52, 254, 26, 2, 131, 198, 95, 225, 87, 252, 117, 13, 20,
+  127, 109, 1, 20, 127, 133, 95, 241, 215, 53, 104, 252, 53, 4, 134, 139, 191,
+  194, 63, 116, 252, 21, 254, 193, 227, 175, 33, 48, 104, 252, 21, 254, 65,
+  227, 175, 240, 15, 30, 127, 13, 129, 65, 227, 175, 240, 15, 23, 127, 77,
+  0, 138, 191, 194, 175, 248, 107, 8, 12, 20, 127, 21, 1, 21, 127, 133, 127,
+  240, 248, 107, 4, 12, 24, 127, 133, 95, 241, 215, 16, 24, 54, 254, 10, 255,
+  128, 241, 215, 4, 160, 248, 43, 252, 3, 198, 95, 19, 128, 226, 175, 240,
+  15, 183, 255, 215, 4, 48, 112, 254, 175, 34, 240, 192, 249, 159, 86, 128,
+  129, 215, 255, 10, 126, 13, 129, 97, 226, 95, 109, 127, 69, 127, 192, 248,
+  43, 5, 28, 50, 254, 106, 4, 27, 56, 254, 90, 1, 6, 142, 127, 3, 191, 134,
+  192, 64, 241, 87, 2, 160, 248, 107, 5, 24, 112, 253, 175, 225, 215, 8, 24,
+  106, 253, 215, 253, 63, 240, 252, 175, 251, 127, 200, 248, 171, 10, 60, 112,
+  252, 59, 17, 72, 35, 96, 144, 245, 95, 91, 0, 205, 255, 74, 1, 134, 155,
+  255, 219, 253, 175, 1, 48, 76, 252, 187, 2, 160, 17, 48, 200, 252, 111, 49,
+  0, 141, 128, 33, 230, 127, 165, 128, 131, 206, 255, 202, 0, 6, 142, 191,
+  6, 192, 192, 249, 95, 43, 2, 105, 0, 12, 116, 255, 183, 219, 95, 35, 96,
+  128, 248, 107, 0, 12, 156, 255, 217, 34, 160, 6, 192, 80, 247, 127, 67, 0,
+  52, 2, 134, 134, 127, 219, 2, 84, 208, 107, 0, 12, 113, 255, 107, 2, 24,
+  244, 254, 215, 10, 48, 232, 253, 239, 136, 64, 138, 255, 32, 247, 191, 38,
+  128, 193, 226, 239, 85, 0, 197, 127, 104, 248, 119, 42, 176, 226, 63, 200,
+  253, 239, 36, 0, 197, 127, 128, 251, 223, 98, 0, 138, 255, 240, 246, 191,
+  237, 4, 81, 252, 135, 200, 255, 52, 1, 12, 122, 255, 107, 2, 24, 124, 254,
+  247, 240, 215, 40, 24, 212, 254, 87, 25, 120, 224, 248, 215, 240, 171, 8,
+  52, 208, 254, 223, 117, 131, 43, 254, 67, 204, 255, 129, 8, 164, 97, 48,
+  164, 252, 239, 247, 128, 138, 254, 144, 246, 191, 227, 4, 210, 26, 48, 64,
+  252, 93, 13, 64, 219, 192, 129, 225, 111, 130, 12, 160, 232, 15, 43, 255,
+  251, 42, 160, 194, 63, 180, 250, 31, 76, 130, 53, 4, 6, 85, 255, 109, 252,
+  21, 254, 225, 213, 127, 136, 3, 106, 12, 12, 166, 254, 219, 21, 64, 11, 192,
+  208, 241, 111, 224, 215, 16, 24, 16, 255, 119, 241, 87, 59, 192, 192, 234,
+  191, 59, 8, 212, 26, 48, 176, 252, 175, 20, 96, 232, 248, 67, 37, 64, 187,
+  128, 225, 226, 175, 9, 96, 80, 248, 27, 68, 7, 212, 32, 24, 74, 255, 151,
+  65, 5, 64, 193, 31, 12, 255, 195, 18, 128, 134, 192, 32, 241, 215, 4, 48,
+  76, 252, 117, 18, 56, 96, 252, 195, 4, 160, 232, 15, 13, 255, 206, 13, 170,
+  17, 48, 56, 252, 67, 51, 152, 194, 63, 64, 252, 157, 4, 160, 107, 64, 248,
+  187, 9, 64, 249, 223, 224, 240, 239, 230, 128, 173, 25, 76, 215, 144, 240,
+  15, 166, 0, 186, 6, 136, 191, 222, 13, 60, 88, 252, 157, 10, 160, 232, 15,
+  20, 127, 189, 20, 102, 176, 253, 159, 127, 51, 172, 6, 193, 192, 250, 63,
+  251, 249, 80, 138, 254, 240, 250, 63, 43, 255, 107, 6, 24, 34, 255, 247,
+  30, 15, 167, 232, 15, 141, 255, 133, 23, 131, 107, 12, 12, 6, 255, 90, 4,
+  6, 79, 2, 105, 24, 12, 1, 127, 247, 70, 32, 77, 0, 3, 235, 255, 178, 192,
+  2, 162, 135, 1, 6, 86, 255, 13, 113, 28, 92, 163, 96, 0, 245, 223, 184, 30,
+  0, 173, 1, 3, 171, 255, 88, 2, 208, 16, 24, 10, 254, 97, 2, 80, 22, 48, 148,
+  250, 15, 93, 6, 160, 17, 48, 148, 253, 111, 128, 4, 224, 75, 1, 26, 2, 115,
+  142, 191, 147, 0, 106, 228, 125, 53, 88, 131, 96, 174, 249, 191, 215, 4,
+  180, 219, 95, 97, 159, 99, 252, 77, 152, 0, 108, 18, 168, 1, 48, 239, 251,
+  31, 12, 0, 77, 1, 67, 211, 255, 172, 10, 160, 53, 96, 112, 248, 107, 0, 12,
+  155, 255, 59, 21, 160, 134, 223, 31, 7, 105, 4, 204, 49, 255, 135, 56, 160,
+  102, 128, 129, 224, 223, 161, 175, 1, 48, 196, 254, 47, 12, 0, 184, 4, 104,
+  0, 204, 45, 255, 115, 3, 0, 33, 129, 138, 255, 252, 214, 127, 168, 13, 68,
+  6, 130, 186, 230, 177, 254, 195, 1, 160, 9, 96, 16, 248, 187, 61, 0, 200,
+  1, 21, 255, 249, 196, 223, 208, 41, 64, 111, 135, 28, 192, 254, 55, 100,
+  10, 208, 4, 48, 144, 252, 207, 11, 65, 93, 0, 104, 36, 204, 23, 254, 206,
+  81, 96, 176, 11, 80, 63, 208, 92, 247, 127, 254, 109, 0, 116, 2, 80, 252,
+  231, 109, 255, 83, 28, 32, 76, 0, 138, 255, 220, 229, 127, 154, 3, 232, 209,
+  176, 121, 215, 127, 128, 11, 97, 50, 12, 127, 133, 127, 110, 247, 63, 96,
+  7, 32, 252, 96, 26, 8, 115, 132, 191, 60, 1, 104, 21, 152, 223, 253, 239,
+  37, 0, 240, 104, 168, 86, 129, 121, 221, 255, 120, 19, 104, 223, 16, 165,
+  71, 196, 231, 18, 127, 147, 209, 77, 160, 163, 2, 104, 13, 152, 203, 253,
+  143, 232, 128, 216, 169, 16, 133, 127, 174, 240, 55, 226, 83, 65, 90, 2,
+  230, 116, 255, 163, 20, 32, 236, 3, 181, 4, 204, 113, 254, 15, 6, 65, 96,
+  8, 40, 250, 243, 183, 255, 195, 231, 3, 103, 142, 17, 196, 217, 254, 154,
+  3, 230, 51, 255, 3, 115, 96, 220, 18, 172, 232, 207, 89, 254, 231, 252, 192,
+  25, 44, 4, 232, 154, 143, 252, 15, 83, 64, 216, 15, 166, 41, 96, 78, 235,
+  63, 108, 5, 3, 15, 5, 40, 248, 115, 132, 191, 97, 14, 5, 98, 25, 64, 195,
+  96, 126, 242, 63, 101, 6, 245, 175, 136, 2, 218, 64, 13, 132, 117, 143, 191,
+  137, 201, 0, 234, 11, 157, 83, 254, 7, 157, 8, 195, 50, 128, 6, 193, 92,
+  229, 127, 8, 127, 188, 11, 0, 218, 0, 13, 131, 245, 141, 191, 129, 238, 5,
+  8, 35, 32, 228, 0, 10, 252, 188, 240, 63, 24, 255, 174, 5, 12, 155, 64, 173,
+  1, 115, 196, 255, 64, 43, 24, 161, 4, 122, 157, 128, 198, 192, 250, 230,
+  127, 150, 13, 4, 35, 129, 136, 18, 164, 205, 224, 186, 198, 223, 4, 12, 128,
+  38, 129, 108, 8, 232, 90, 175, 252, 223, 195, 31, 213, 129, 117, 38, 60,
+  183, 253, 31, 94, 2, 28, 21, 0, 108, 5, 52, 6, 214, 119, 255, 231, 226, 223,
+  34, 15, 27, 130, 224, 8, 208, 24, 88, 199, 253, 31, 128, 127, 200, 0, 145,
+  42, 160, 157, 192, 186, 239, 255, 66, 252, 125, 14, 136, 53, 2, 42, 9, 175,
+  103, 252, 13, 109, 6, 69, 13, 33, 246, 249, 0, 213, 4, 215, 59, 255, 179,
+  241, 71, 10, 0, 228, 11, 245, 41, 128, 230, 128, 117, 142, 127, 88, 0, 194,
+  4, 160, 106, 208, 252, 227, 79, 15, 131, 253, 58, 128, 27, 68, 53, 4, 214,
+  25, 254, 126, 2, 0, 224, 71, 251, 64, 13, 128, 249, 193, 31, 115, 3, 97,
+  71, 3, 84, 14, 158, 35, 252, 97, 6, 128, 215, 0, 189, 50, 110, 14, 240, 167,
+  19, 0, 95, 3, 52, 0, 230, 7, 127, 144, 2, 162, 125, 0, 116, 107, 172, 70,
+  192, 186, 195, 223, 110, 1, 232, 10, 128, 76, 4, 32, 37, 64, 163, 97, 29,
+  225, 79, 244, 128, 68, 0, 192, 103, 4, 51, 133, 127, 189, 226, 47, 10, 128,
+  96, 40, 132, 11, 1, 10, 255, 122, 193, 31, 81, 1, 201, 0, 96, 189, 129, 33,
+  254, 26, 16, 107, 22, 255, 85, 8, 0, 213, 132, 215, 19, 254, 177, 1, 0, 222,
+  20, 131, 204, 3, 149, 20, 174, 3, 252, 123, 5, 0, 104, 10, 193, 173, 33,
+  10, 253, 26, 198, 223, 119, 131, 242, 141, 160, 200, 27, 170, 14, 161, 181,
+  142, 191, 1, 253, 160, 108, 0, 224, 66, 32, 36, 9, 170, 64, 180, 150, 247,
+  191, 129, 3, 128, 210, 1, 100, 3, 65, 36, 23, 232, 90, 163, 252, 47, 116,
+  132, 67, 98, 48, 109, 14, 102, 130, 64, 163, 96, 173, 215, 127, 140, 1, 192,
+  219, 159, 58, 35, 20, 4, 129, 98, 191, 134, 241, 71, 12, 225, 96, 18, 32,
+  70, 194, 108, 34, 208, 56, 88, 163, 248, 135, 110, 208, 16, 126, 66, 8, 18,
+  197, 128, 66, 191, 166, 251, 127, 248, 76, 16, 86, 3, 240, 91, 131, 5, 103,
+  70, 53, 16, 214, 98, 253, 15, 24, 128, 133, 60, 231, 8, 8, 189, 97, 122,
+  100, 112, 93, 229, 127, 56, 2, 140, 244, 108, 0, 120, 84, 84, 51, 192, 58,
+  170, 255, 128, 25, 164, 175, 39, 132, 210, 134, 21, 249, 53, 91, 255, 97,
+  10, 96, 85, 0, 166, 11, 36, 66, 128, 155, 12, 41, 254, 107, 37, 6, 12, 222,
+  7, 114, 206, 112, 233, 161, 113, 29, 10, 174, 205, 252, 239, 21, 0, 228,
+  96, 8, 101, 8, 160, 224, 103, 134, 66, 153, 226, 255, 232, 15, 129, 112,
+  14, 224, 67, 15, 183, 1, 129, 71, 144, 189, 67, 112, 232, 86, 145, 103, 173,
+  181, 221, 15, 11, 65, 176, 12, 20, 164, 0, 193, 113, 65, 160, 10, 12, 185,
+  47, 88, 83, 249, 31, 85, 130, 104, 33, 208, 243, 5, 193, 71, 134, 201, 83,
+  227, 195, 205, 2, 107, 12, 127, 116, 26, 72, 207, 131, 209, 92, 192, 155,
+  196, 6, 30, 2, 207, 90, 139, 216, 135, 227, 64, 71, 6, 164, 241, 71, 117,
+  65, 52, 13, 100, 3, 38, 132, 107, 122, 255, 67, 39, 195, 112, 18, 32, 190,
+  51, 34, 12, 129, 225, 70, 192, 179, 214, 224, 238, 15, 26, 65, 119, 239,
+  123, 93, 128, 133, 62, 113, 90, 16, 15, 1, 242, 38, 161, 76, 241, 127, 84,
+  107, 0, 49, 14, 36, 126, 112, 20, 0, 125, 51, 60, 113, 232, 89, 107, 113,
+  251, 115, 211, 32, 62, 6, 196, 246, 16, 178, 49, 28, 64, 0, 172, 189, 253,
+  239, 37, 0, 92, 7, 142, 138, 128, 224, 180, 16, 238, 18, 25, 212, 73, 194,
+  125, 217, 218, 92, 38, 99, 77, 161, 14, 222, 204, 65, 49, 202, 31, 34, 214,
+  134, 230, 145, 26, 236, 91, 195, 216, 203, 29, 65, 194, 185, 144, 220, 37,
+  68, 29, 29, 201, 116, 255, 63, 170, 182, 112, 160, 6, 48, 99, 1, 48, 2, 176,
+  233, 64, 54, 168, 49, 209, 190, 53, 157, 253, 165, 25, 128, 55, 136, 66,
+  87, 199, 72, 180, 33, 106, 56, 144, 41, 254, 143, 214, 177, 0, 8, 127, 254,
+  172, 56, 105, 16, 202, 88, 69, 96, 30, 105, 225, 250, 200, 255, 104, 6, 96,
+  199, 2, 17, 254, 16, 46, 0, 230, 242, 56, 233, 218, 230, 127, 244, 185, 16,
+  63, 8, 208, 155, 2, 160, 171, 131, 144, 182, 48, 246, 24, 105, 166, 248,
+  63, 186, 134, 32, 218, 31, 76, 184, 131, 164, 167, 70, 176, 57, 161, 246,
+  127, 143, 198, 36, 8, 41, 2, 140, 59, 80, 106, 18, 131, 100, 193, 249, 110,
+  11, 214, 246, 254, 7, 83, 128, 225, 168, 0, 48, 18, 52, 204, 193, 193, 184,
+  41, 145, 152, 9, 102, 138, 255, 42, 114, 64, 233, 109, 49, 92, 12, 72, 202,
+  192, 188, 90, 72, 247, 173, 3, 244, 17, 59, 88, 196, 93, 33, 152, 71, 8,
+  121, 194, 28, 18, 4, 168, 99, 40, 91, 191, 26, 225, 190, 53, 15, 62, 236,
+  6, 146, 157, 17, 67, 156, 33, 33, 5, 68, 174, 150, 199, 90, 131, 184, 118,
+  32, 83, 252, 103, 222, 3, 144, 167, 68, 13, 26, 5, 240, 21, 114, 124, 37,
+  224, 31, 59, 36, 50, 17, 103, 138, 255, 140, 220, 96, 80, 26, 224, 204, 97,
+  220, 112, 128, 153, 17, 138, 174, 149, 89, 111, 7, 204, 214, 69, 253, 247,
+  84, 32, 112, 40, 28, 229, 13, 66, 46, 19, 70, 99, 128, 232, 11, 89, 125,
+  48, 83, 252, 103, 92, 2, 224, 58, 128, 61, 61, 34, 34, 0, 192, 1, 161, 236,
+  74, 17, 90, 30, 202, 20, 255, 217, 192, 31, 230, 0, 218, 24, 36, 61, 44,
+  32, 24, 17, 138, 239, 152, 67, 74, 64, 166, 248, 79, 205, 0, 188, 28, 128,
+  23, 0, 15, 243, 200, 0, 160, 236, 2, 66, 11, 249, 122, 201, 3, 235, 67, 255,
+  97, 240, 167, 93, 1, 6, 30, 13, 241, 167, 6, 37, 183, 139, 17, 214, 145,
+  158, 33, 144, 41, 254, 226, 36, 192, 38, 0, 58, 4, 164, 119, 8, 48, 218,
+  144, 160, 51, 16, 116, 135, 153, 238, 255, 136, 51, 1, 212, 93, 81, 140,
+  55, 40, 38, 7, 224, 78, 1, 92, 31, 150, 92, 66, 189, 102, 30, 80, 177, 111,
+  61, 193, 143, 226, 79, 14, 131, 98, 79, 140, 197, 165, 128, 190, 33, 176,
+  70, 154, 196, 125, 235, 8, 125, 183, 10, 112, 151, 197, 81, 181, 96, 38,
+  33, 32, 81, 8, 133, 17, 144, 41, 255, 147, 155, 129, 56, 99, 24, 29, 5, 177,
+  33, 32, 59, 63, 144, 197, 55, 6, 107, 227, 113, 69, 251, 214, 13, 248, 65,
+  25, 128, 19, 0, 96, 10, 98, 36, 33, 186, 43, 100, 125, 227, 210, 230, 128,
+  232, 11, 50, 229, 255, 61, 104, 0, 112, 62, 152, 49, 8, 26, 118, 62, 196,
+  171, 195, 64, 8, 100, 145, 148, 144, 170, 10, 217, 35, 220, 21, 238, 91,
+  135, 240, 75, 42, 128, 224, 14, 249, 12, 30, 13, 97, 222, 81, 78, 35, 142,
+  113, 17, 138, 157, 4, 171, 62, 73, 220, 183, 30, 225, 15, 229, 0, 35, 140,
+  1, 134, 9, 50, 234, 160, 248, 40, 17, 171, 21, 247, 82, 138, 178, 65, 239,
+  127, 35, 243, 133, 177, 1, 32, 170, 3, 81, 186, 96, 70, 25, 6, 36, 82, 33,
+  91, 8, 86, 47, 20, 246, 173, 75, 248, 197, 1, 192, 176, 192, 96, 243, 103,
+  145, 202, 160, 192, 54, 0, 11, 133, 242, 35, 38, 82, 114, 152, 13, 10, 127,
+  255, 116, 168, 123, 87, 32, 117, 127, 180, 124, 68, 44, 59, 64, 148, 81,
+  148, 144, 243, 146, 178, 117, 160, 223, 163, 44, 51, 113, 56, 236, 91, 167,
+  240, 139, 125, 97, 252, 96, 0, 77, 5, 64, 10, 136, 155, 21, 242, 98, 113,
+  38, 51, 17, 144, 13, 66, 54, 128, 252, 111, 162, 141, 129, 162, 78, 32, 230,
+  26, 33, 62, 14, 68, 166, 1, 240, 145, 197, 100, 91, 32, 243, 21, 101, 115,
+  223, 255, 73, 2, 192, 43, 3, 146, 185, 128, 208, 38, 34, 146, 136, 37, 79,
+  162, 17, 246, 6, 34, 143, 225, 244, 115, 132, 245, 140, 191, 204, 23, 198,
+  200, 129, 128, 79, 132, 111, 6, 165, 39, 203, 81, 240, 137, 9, 178, 184,
+  67, 204, 166, 236, 15, 178, 245, 138, 191, 137, 12, 0, 86, 18, 22, 155, 5,
+  229, 243, 98, 194, 72, 138, 222, 61, 214, 199, 84, 228, 254, 148, 188, 145,
+  88, 215, 251, 63, 202, 21, 196, 9, 194, 124, 9, 0, 194, 64, 222, 26, 18,
+  79, 166, 98, 91, 130, 204, 48, 22, 180, 204, 196, 29, 88, 15, 229, 197, 125,
+  235, 57, 243, 83, 222, 208, 8, 77, 152, 182, 9, 34, 35, 34, 138, 20, 82,
+  207, 36, 195, 89, 33, 86, 97, 248, 140, 194, 118, 148, 184, 13, 105, 223,
+  58, 47, 254, 240, 1, 17, 233, 65, 49, 130, 12, 146, 137, 64, 216, 27, 82,
+  196, 16, 138, 168, 16, 124, 242, 55, 136, 240, 165, 162, 147, 134, 125, 235,
+  157, 253, 33, 166, 32, 129, 24, 36, 240, 7, 224, 169, 64, 216, 16, 100, 30,
+  222, 25, 249, 123, 11, 42, 76, 143, 59, 140, 200, 251, 11, 230, 128, 255,
+  59, 1, 0, 22, 0, 241, 112, 88, 20, 1, 52, 23, 244, 33, 35, 244, 39, 150,
+  113, 88, 111, 194, 203, 75, 34, 102, 79, 4, 165, 92, 215, 248, 131, 41, 64,
+  120, 90, 124, 38, 17, 128, 198, 128, 219, 116, 200, 188, 40, 104, 136, 101,
+  48, 250, 252, 221, 182, 130, 48, 88, 223, 248, 131, 151, 5, 247, 141, 0,
+  230, 212, 8, 207, 6, 145, 41, 4, 242, 16, 59, 238, 160, 34, 58, 134, 144,
+  220, 95, 33, 156, 70, 175, 87, 254, 111, 98, 35, 128, 21, 133, 227, 34, 192,
+  3, 159, 166, 157, 228, 237, 213, 192, 239, 205, 158, 88, 22, 137, 143, 194,
+  92, 176, 111, 189, 111, 252, 71, 49, 2, 50, 236, 97, 5, 132, 10, 13, 221,
+  89, 9, 254, 129, 49, 87, 152, 200, 78, 45, 129, 249, 96, 14, 248, 63, 231,
+  12, 148, 237, 72, 36, 53, 131, 83, 66, 198, 141, 70, 140, 163, 66, 228, 185,
+  169, 52, 77, 15, 99, 84, 40, 48, 8, 246, 205, 71, 249, 135, 21, 161, 24,
+  30, 128, 160, 224, 135, 130, 68, 137, 20, 95, 84, 32, 26, 76, 115, 29, 66,
+  228, 177, 5, 239, 211, 245, 206, 255, 240, 66, 48, 85, 4, 0, 129, 64, 14,
+  163, 5, 135, 148, 167, 19, 35, 69, 33, 16, 51, 154, 158, 27, 252, 241, 92,
+  44, 240, 6, 72, 174, 20, 143, 77, 65, 146, 67, 106, 44, 3, 1, 253, 41, 156,
+  82, 36, 158, 77, 118, 9, 96, 253, 243, 127, 57, 7, 96, 137, 64, 248, 102,
+  202, 137, 4, 54, 142, 32, 226, 128, 104, 18, 165, 55, 155, 249, 74, 65, 40,
+  31, 117, 95, 218, 55, 47, 27, 159, 148, 132, 197, 101, 192, 218, 140, 51,
+  233, 70, 81, 57, 82, 196, 68, 105, 110, 24, 85, 21, 176, 255, 246, 205, 87,
+  250, 167, 75, 49, 147, 4, 226, 55, 61, 151, 131, 50, 228, 105, 214, 220,
+  95, 66, 118, 136, 157, 157, 33, 8, 90, 133, 185, 168, 255, 124, 33, 22, 186,
+  4, 205, 140, 18, 17, 76, 72, 12, 146, 141, 34, 38, 148, 188, 104, 200, 115,
+  3, 231, 195, 57, 194, 95, 168, 5, 161, 240, 175, 106, 62, 50, 177, 109, 9,
+  215, 30, 24, 254, 198, 91, 32, 16, 130, 76, 48, 111, 252, 31, 113, 6, 224,
+  33, 96, 178, 153, 130, 143, 246, 134, 134, 169, 73, 224, 85, 70, 244, 41,
+  70, 137, 102, 196, 213, 133, 125, 243, 184, 249, 249, 11, 99, 28, 248, 31,
+  145, 191, 150, 97, 123, 67, 168, 14, 8, 104, 33, 16, 5, 193, 128, 25, 143,
+  130, 121, 203, 255, 72, 31, 136, 50, 193, 71, 238, 111, 196, 102, 37, 238,
+  126, 123, 116, 116, 0, 206, 144, 4, 99, 235, 185, 170, 255, 38, 130, 6, 204,
+  58, 233, 71, 81, 18, 32, 34, 233, 3, 76, 4, 43, 140, 228, 5, 64, 101, 152,
+  87, 254, 135, 196, 128, 201, 30, 201, 141, 47, 155, 83, 161, 204, 20, 189,
+  220, 8, 121, 240, 17, 70, 13, 16, 183, 209, 156, 230, 127, 176, 15, 15, 171,
+  239, 163, 76, 78, 185, 66, 192, 30, 101, 19, 8, 5, 146, 70, 113, 223, 188,
+  238, 126, 148, 8, 172, 1, 173, 154, 190, 207, 78, 120, 150, 137, 116, 176,
+  137, 143, 57, 238, 155, 235, 237, 15, 20, 223, 53, 0, 191, 128, 12, 132,
+  201, 128, 97, 134, 125, 137, 193, 124, 230, 127, 164, 27, 92, 51, 232, 179,
+  165, 64, 232, 96, 65, 159, 131, 73, 39, 129, 57, 223, 255, 70, 140, 192,
+  218, 171, 82, 232, 220, 40, 194, 197, 32, 57, 229, 54, 128, 253, 191, 22,
+  161, 103, 130, 0, 107, 89, 162, 38, 7, 81, 163, 164, 125, 138, 250, 90, 163,
+  42, 172, 100, 197, 136, 69, 0, 33, 192, 47, 196, 157, 231, 253, 191, 142,
+  66, 193, 208, 5, 65, 52, 57, 18, 60, 30, 55, 124, 51, 215, 248, 207, 65,
+  227, 2, 62, 241, 128, 50, 154, 11, 234, 129, 29, 0, 138, 255, 154, 76, 84,
+  38, 178, 51, 224, 117, 2, 36, 10, 20, 255, 117, 208, 184, 26, 162, 34, 136,
+  206, 188, 227, 185, 64, 241, 95, 179, 28, 197, 240, 217, 64, 122, 7, 30,
+  94, 20, 20, 255, 181, 31, 22, 172, 177, 13, 54, 25, 74, 34, 65, 241, 95,
+  235, 9, 129, 208, 9, 192, 183, 145, 154, 145, 226, 191, 158, 138, 3, 113,
+  200, 0, 227, 132, 232, 249, 87, 173, 255, 235, 142, 22, 160, 140, 0, 236,
+  13, 5, 90, 129, 226, 191, 206, 229, 129, 12, 61, 244, 200, 79, 16, 148, 255,
+  173, 227, 148, 32, 120, 44, 150, 196, 94, 164, 248, 207, 71, 129, 16, 88,
+  76, 97, 185, 72, 241, 159, 175, 30, 145, 238, 16, 194, 96, 80, 252, 231,
+  150, 17, 112, 119, 18, 40, 254, 115, 22, 2, 216, 244, 136, 58, 6, 163, 248,
+  207, 45, 47, 52, 146, 108, 160, 248, 207, 161, 86, 128, 216, 223, 129, 86,
+  81, 241, 159, 71, 252, 193, 24, 128, 139, 129, 226, 63, 167, 248, 35, 212,
+  192, 175, 6, 138, 255, 188, 82, 64, 89, 147, 168, 248, 15, 139, 17, 248,
+  169, 64, 241, 31, 82, 93, 8, 19, 133, 226, 63, 188, 64, 176, 163, 64, 241,
+  31, 182, 82, 160, 248, 15, 59, 14, 20, 255, 97, 75, 4, 138, 255, 176, 35,
+  65, 241, 31, 118, 48, 40, 254, 195, 94, 138, 255, 48, 179, 191, 81, 254,
+  175, 75, 241, 87, 252, 245, 37, 80, 252, 117, 41, 254, 186, 20, 127, 93,
+  138, 191, 46, 197, 95, 151, 226, 175, 75, 241, 215, 165, 248, 235, 82, 252,
+  117, 41, 254, 186, 20, 127, 93, 138, 191, 46, 197, 95, 151, 226, 175, 107,
+  46, 214, 51, 245, 37, 80, 252, 117, 41, 254, 186, 20, 127, 93, 138, 191,
+  46, 197, 95, 151, 226, 175, 75, 241, 215, 165, 248, 235, 82, 252, 117, 205,
+  237, 58, 177, 255, 192, 129, 3, 15, 30, 120, 240, 224, 131, 7, 15, 30, 124,
+  40, 95, 135, 30, 58, 116, 232, 225, 135, 15, 29, 126, 248, 225, 195, 249,
+  58, 82, 172, 163, 71, 142, 30, 61, 122, 236, 232, 177, 124, 29, 63, 118,
+  188, 88, 39, 78, 228, 255, 157, 56, 90, 124, 235, 131, 197, 55, 150, 223,
+  90, 126, 103, 254, 189, 213, 119, 30, 62, 114, 184, 254, 206, 250, 123, 143,
+  87, 223, 92, 126, 103, 177, 14, 22, 223, 235, 124, 115, 249, 221, 135, 139,
+  31, 71, 202, 239, 174, 191, 189, 250, 147, 243, 239, 173, 191, 189, 248,
+  13, 30, 58, 80, 253, 217, 237, 247, 23, 223, 222, 254, 6, 237, 223, 188,
+  250, 227, 157, 63, 255, 224, 3, 15, 60, 176, 255, 129, 3, 251, 247, 151,
+  255, 108, 251, 55, 176, 254, 250, 15, 31, 113, 254, 233, 135, 239, 185, 247,
+  222, 123, 239, 187, 239, 190, 251, 239, 123, 224, 254, 226, 219, 247, 239,
+  223, 95, 255, 241, 249, 183, 63, 116, 176, 253, 211, 171, 127, 250, 254,
+  47, 127, 249, 206, 59, 239, 188, 235, 174, 187, 239, 190, 251, 158, 230,
+  27, 239, 191, 191, 248, 83, 247, 31, 216, 223, 188, 214, 15, 61, 116, 215,
+  173, 183, 222, 118, 219, 237, 183, 127, 241, 75, 95, 250, 210, 29, 119, 148,
+  223, 209, 126, 195, 255, 223, 222, 189, 190, 255, 61, 23, 112, 28, 207, 249,
+  176, 9, 219, 40, 167, 205, 113, 12, 57, 44, 214, 52, 167, 149, 44, 149, 162,
+  212, 226, 162, 88, 57, 92, 185, 114, 200, 21, 82, 138, 46, 145, 67, 33, 109,
+  92, 198, 212, 149, 67, 73, 206, 167, 236, 98, 57, 204, 105, 46, 12, 155,
+  195, 181, 203, 225, 178, 34, 118, 85, 87, 232, 82, 148, 212, 109, 255, 192,
+  239, 251, 124, 60, 111, 255, 174, 221, 120, 61, 110, 237, 243, 249, 126,
+  222, 239, 255, 255, 249, 11, 143, 206, 159, 255, 216, 227, 79, 60, 177, 112,
+  225, 194, 39, 159, 122, 247, 79, 159, 89, 244, 238, 159, 62, 251, 191, 127,
+  123, 209, 221, 115, 239, 189, 247, 254, 7, 230, 205, 123, 232, 225, 135,
+  31, 153, 63, 255, 241, 199, 23, 44, 120, 242, 201, 91, 175, 191, 233, 230,
+  91, 110, 155, 125, 251, 156, 59, 239, 186, 103, 238, 125, 15, 220, 120, 254,
+  204, 89, 191, 184, 244, 138, 43, 175, 186, 246, 250, 235, 142, 58, 246, 187,
+  39, 159, 122, 214, 185, 51, 62, 53, 249, 51, 83, 15, 60, 252, 219, 39, 157,
+  126, 222, 172, 43, 174, 159, 61, 247, 145, 167, 95, 92, 242, 15, 254, 252,
+  249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63,
+  127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231,
+  207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252,
+  249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63,
+  127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231,
+  207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252,
+  249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63,
+  127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231,
+  207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252,
+  249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63,
+  127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231,
+  207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252,
+  249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63,
+  127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231,
+  207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252,
+  249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63,
+  127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231,
+  207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252,
+  249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63,
+  127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231,
+  207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252,
+  249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63,
+  127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231,
+  207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252,
+  249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63,
+  127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231,
+  207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252,
+  249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63,
+  127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231,
+  207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252,
+  249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63,
+  127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231,
+  207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252,
+  249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63,
+  127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231,
+  207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252,
+  249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63,
+  127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231,
+  207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252,
+  249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63,
+  127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231,
+  207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252,
+  249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63,
+  127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231,
+  207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252,
+  249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63,
+  127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231,
+  207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252,
+  249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63,
+  127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231,
+  207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252,
+  249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63,
+  127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231,
+  207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252,
+  249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63,
+  127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231,
+  207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252,
+  249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63,
+  127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231,
+  207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252,
+  249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63,
+  127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231,
+  207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252,
+  249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63,
+  127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231,
+  207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252,
+  249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63,
+  127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231,
+  207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252,
+  249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63,
+  127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231,
+  207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252,
+  249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63,
+  127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231,
+  207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 159, 63, 127, 254, 252,
+  249, 243, 231, 207, 159, 63, 127, 254, 252, 249, 243, 231, 207, 255, 189,
+  252, 39, 189, 163, 114, 252, 249, 139, 191, 248, 139, 191, 248, 139, 191,
+  248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191,
+  248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191,
+  248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191,
+  248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191,
+  248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191,
+  248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 63, 127, 241, 23,
+  127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127,
+  241, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 241,
+  23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23,
+  127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127,
+  241, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 241,
+  23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 254, 226,
+  47, 254, 226, 47, 254, 226, 47, 254, 226, 47, 254, 226, 47, 254, 226, 47,
+  254, 226, 47, 254, 226, 47, 254, 226, 47, 254, 226, 47, 254, 226, 47, 254,
+  226, 47, 254, 226, 47, 254, 226, 47, 254, 226, 47, 254, 226, 47, 254, 226,
+  47, 254, 226, 47, 254, 226, 47, 254, 226, 47, 254, 226, 47, 254, 226, 47,
+  254, 226, 47, 254, 226, 47, 254, 226, 47, 254, 226, 47, 254, 226, 47, 254,
+  226, 47, 254, 226, 47, 254, 226, 47, 254, 226, 47, 254, 226, 207, 95, 252,
+  197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197,
+  95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95,
+  252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252,
+  197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197,
+  95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95,
+  252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 159, 191,
+  248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191,
+  248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191,
+  248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191,
+  248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191,
+  248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191,
+  248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191,
+  248, 139, 191, 248, 243, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127,
+  241, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 241,
+  23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23,
+  127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127,
+  241, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 241,
+  23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23,
+  127, 241, 23, 127, 241, 231, 47, 254, 226, 47, 254, 226, 47, 254, 226, 47,
+  254, 226, 47, 254, 226, 47, 254, 226, 47, 254, 226, 47, 254, 226, 47, 254,
+  226, 47, 254, 226, 47, 254, 226, 47, 254, 226, 47, 254, 226, 47, 254, 226,
+  47, 254, 226, 47, 254, 226, 47, 254, 226, 47, 254, 226, 47, 254, 226, 47,
+  254, 226, 47, 254, 226, 47, 254, 226, 47, 254, 226, 47, 254, 226, 47, 254,
+  226, 47, 254, 226, 47, 254, 226, 47, 254, 226, 47, 254, 226, 47, 254, 226,
+  47, 254, 226, 47, 254, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197,
+  95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95,
+  252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252,
+  197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197,
+  95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95,
+  252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 245, 94, 189,
+  254, 62, 149, 91, 100, 130, 116, 115, 77, 144, 238, 106, 19, 164, 59, 223,
+  4, 233, 78, 54, 65, 186, 111, 152, 32, 221, 62, 38, 72, 183, 139, 9, 210,
+  141, 51, 65, 186, 81, 38, 72, 247, 142, 9, 210, 189, 98, 130, 116, 11, 77,
+  144, 238, 46, 19, 164, 243, 252, 191, 221, 133, 38, 72, 119, 154, 9, 210,
+  29, 99, 130, 116, 7, 154, 32, 221, 158, 38, 72, 55, 201, 4, 233, 188, 255,
+  105, 183, 166, 9, 210, 45, 103, 130, 116, 175, 153, 32, 221, 11, 38, 72,
+  247, 168, 9, 210, 205, 49, 65, 58, 239, 255, 218, 93, 108, 130, 116, 63,
+  49, 65, 186, 19, 77, 144, 238, 155, 38, 72, 119, 128, 9, 210, 121, 255, 219,
+  110, 103, 19, 164, 219, 202, 4, 233, 198, 152, 32, 221, 106, 38, 72, 183,
+  148, 9, 210, 121, 255, 223, 110, 177, 9, 210, 249, 254, 183, 221, 253, 38,
+  72, 119, 155, 9, 210, 93, 101, 130, 116, 151, 152, 32, 221, 185, 38, 72,
+  119, 138, 9, 210, 29, 103, 130, 116, 206, 127, 110, 231, 247, 63, 237, 246,
+  50, 65, 186, 221, 76, 144, 110, 162, 9, 210, 109, 97, 130, 116, 126, 255,
+  213, 110, 164, 9, 210, 173, 96, 130, 116, 111, 154, 32, 157, 243, 95, 218,
+  61, 104, 130, 116, 55, 152, 32, 157, 243, 63, 218, 57, 255, 191, 221, 209,
+  38, 72, 183, 191, 9, 210, 77, 49, 65, 186, 241, 38, 72, 183, 158, 9, 210,
+  173, 104, 130, 116, 175, 155, 32, 221, 243, 38, 72, 247, 144, 9, 210, 253,
+  222, 4, 233, 46, 51, 65, 186, 159, 153, 32, 221, 15, 76, 144, 206, 249, 223,
+  237, 246, 51, 65, 186, 79, 154, 32, 221, 4, 19, 164, 219, 216, 4, 233, 70,
+  152, 32, 157, 243, 159, 219, 253, 205, 4, 233, 158, 51, 65, 186, 135, 77,
+  144, 238, 118, 19, 164, 251, 157, 9, 210, 93, 100, 130, 116, 103, 153, 32,
+  221, 247, 76, 144, 206, 251, 223, 118, 206, 127, 109, 247, 89, 19, 164, 219,
+  197, 4, 233, 182, 49, 65, 186, 13, 76, 144, 206, 251, 255, 118, 203, 154,
+  32, 221, 27, 38, 72, 247, 146, 9, 210, 61, 109, 130, 116, 243, 76, 144, 238,
+  14, 19, 164, 187, 214, 4, 233, 126, 101, 130, 116, 211, 77, 144, 238, 199,
+  38, 72, 247, 93, 19, 164, 59, 194, 4, 233, 166, 153, 32, 221, 23, 77, 144,
+  110, 15, 19, 164, 219, 201, 4, 233, 182, 53, 65, 186, 77, 76, 144, 110, 45,
+  19, 164, 91, 197, 4, 233, 156, 255, 211, 110, 137, 9, 210, 45, 48, 65, 186,
+  57, 38, 72, 247, 27, 19, 164, 59, 207, 4, 233, 78, 52, 65, 186, 195, 76,
+  144, 238, 11, 38, 72, 183, 179, 9, 210, 141, 51, 65, 186, 81, 38, 144, 178,
+  121, 254, 223, 238, 41, 19, 164, 155, 107, 130, 116, 215, 153, 32, 221, 44,
+  19, 164, 59, 211, 4, 233, 142, 55, 65, 186, 67, 76, 144, 206, 251, 159, 118,
+  147, 77, 144, 110, 107, 19, 164, 27, 109, 130, 116, 195, 77, 144, 238, 45,
+  19, 164, 251, 179, 9, 210, 121, 255, 215, 238, 126, 19, 164, 187, 197, 4,
+  233, 174, 48, 65, 186, 25, 38, 72, 119, 170, 9, 210, 29, 107, 130, 116, 222,
+  255, 182, 155, 106, 130, 116, 83, 76, 144, 110, 162, 9, 210, 249, 254, 179,
+  221, 218, 38, 72, 55, 204, 4, 233, 254, 109, 130, 116, 127, 49, 65, 186,
+  231, 77, 144, 238, 49, 19, 164, 187, 199, 4, 233, 110, 54, 65, 186, 95, 155,
+  32, 221, 76, 19, 164, 251, 169, 9, 210, 157, 100, 130, 116, 199, 152, 32,
+  157, 223, 255, 180, 219, 215, 4, 233, 246, 52, 65, 186, 93, 77, 144, 110,
+  59, 19, 164, 219, 212, 4, 233, 214, 49, 65, 186, 85, 77, 144, 110, 25, 19,
+  164, 251, 171, 9, 210, 57, 255, 165, 221, 157, 38, 72, 119, 165, 9, 210,
+  185, 255, 185, 157, 251, 159, 219, 29, 106, 130, 116, 123, 155, 32, 221,
+  36, 19, 164, 27, 107, 130, 116, 171, 155, 32, 221, 219, 38, 72, 247, 146,
+  9, 210, 249, 254, 183, 221, 29, 38, 72, 231, 249, 127, 59, 231, 127, 183,
+  251, 161, 9, 210, 29, 105, 130, 116, 251, 155, 32, 221, 30, 38, 72, 55, 193,
+  4, 233, 54, 50, 65, 58, 239, 127, 218, 253, 199, 4, 233, 150, 152, 32, 221,
+  51, 38, 72, 247, 128, 9, 210, 185, 255, 183, 221, 229, 38, 72, 55, 221, 4,
+  233, 78, 49, 65, 58, 231, 127, 182, 155, 102, 130, 116, 159, 55, 65, 186,
+  143, 153, 32, 221, 120, 19, 164, 219, 208, 4, 233, 70, 152, 32, 221, 210,
+  38, 72, 247, 154, 9, 210, 45, 54, 65, 186, 5, 38, 72, 119, 175, 9, 210, 121,
+  255, 223, 206, 253, 175, 237, 46, 52, 65, 186, 51, 77, 144, 206, 249, 175,
+  237, 124, 255, 221, 238, 32, 19, 164, 219, 199, 4, 233, 118, 55, 65, 186,
+  29, 76, 144, 110, 11, 19, 164, 27, 109, 130, 116, 206, 127, 104, 183, 172,
+  9, 210, 185, 255, 179, 221, 66, 19, 164, 187, 221, 4, 233, 46, 53, 65, 186,
+  179, 76, 144, 206, 247, 223, 237, 156, 255, 220, 110, 55, 19, 164, 219, 210,
+  4, 233, 214, 48, 65, 58, 231, 255, 182, 123, 217, 4, 233, 230, 155, 32, 221,
+  108, 19, 164, 187, 204, 4, 233, 206, 54, 65, 186, 19, 76, 144, 238, 96, 19,
+  164, 219, 203, 4, 233, 38, 153, 32, 221, 88, 19, 164, 115, 254, 99, 59, 207,
+  255, 219, 189, 98, 130, 116, 126, 255, 221, 238, 110, 19, 164, 187, 198,
+  4, 233, 46, 50, 65, 186, 211, 77, 144, 238, 56, 19, 164, 251, 186, 9, 210,
+  185, 255, 173, 221, 174, 38, 72, 183, 149, 9, 210, 173, 107, 130, 116, 195,
+  76, 144, 238, 95, 38, 72, 231, 251, 159, 118, 79, 153, 32, 221, 125, 38,
+  72, 119, 179, 9, 210, 93, 110, 130, 116, 51, 76, 144, 238, 84, 19, 164, 59,
+  214, 4, 233, 14, 49, 65, 186, 169, 38, 72, 55, 197, 4, 233, 38, 154, 32,
+  221, 56, 19, 164, 91, 219, 4, 233, 134, 155, 32, 221, 91, 38, 72, 247, 172,
+  9, 210, 221, 101, 130, 116, 222, 255, 181, 59, 195, 4, 233, 142, 52, 65,
+  186, 125, 76, 144, 110, 7, 19, 164, 27, 99, 130, 116, 238, 255, 110, 247,
+  170, 9, 210, 185, 255, 165, 221, 173, 38, 72, 119, 137, 9, 210, 249, 253,
+  119, 187, 35, 76, 144, 238, 75, 38, 72, 183, 179, 9, 210, 185, 255, 163,
+  221, 170, 38, 72, 247, 166, 9, 210, 189, 96, 130, 116, 243, 76, 144, 238,
+  38, 19, 164, 243, 252, 183, 157, 251, 31, 218, 29, 99, 130, 116, 95, 49,
+  65, 186, 61, 76, 144, 110, 123, 19, 164, 91, 223, 4, 233, 124, 255, 223,
+  206, 243, 255, 118, 139, 77, 144, 206, 239, 191, 219, 221, 97, 130, 116,
+  191, 53, 65, 186, 11, 76, 144, 238, 71, 38, 72, 231, 253, 79, 187, 131, 76,
+  144, 238, 115, 38, 72, 183, 147, 9, 210, 109, 105, 130, 116, 235, 152, 32,
+  221, 202, 38, 72, 247, 119, 19, 164, 243, 254, 167, 221, 181, 38, 72, 119,
+  142, 9, 210, 29, 101, 130, 116, 123, 153, 32, 221, 182, 38, 72, 55, 194,
+  4, 233, 94, 55, 65, 186, 133, 38, 72, 231, 252, 223, 118, 51, 77, 144, 238,
+  251, 38, 72, 55, 205, 4, 233, 118, 55, 65, 186, 205, 77, 144, 206, 249, 175,
+  237, 60, 255, 105, 247, 180, 9, 210, 205, 49, 65, 186, 203, 76, 144, 238,
+  76, 19, 164, 251, 150, 9, 210, 237, 107, 130, 116, 147, 77, 144, 110, 51,
+  19, 164, 91, 205, 4, 233, 254, 105, 130, 116, 238, 127, 106, 247, 160, 9,
+  210, 221, 104, 130, 116, 23, 155, 32, 221, 105, 38, 72, 231, 249, 111, 187,
+  253, 77, 144, 110, 138, 9, 210, 141, 55, 65, 186, 209, 38, 72, 231, 252,
+  183, 118, 175, 154, 32, 221, 61, 38, 72, 231, 249, 95, 187, 227, 76, 144,
+  110, 111, 19, 164, 115, 254, 123, 187, 21, 76, 144, 238, 69, 19, 164, 251,
+  131, 9, 252, 255, 79, 217, 78, 48, 65, 186, 47, 155, 32, 221, 4, 19, 164,
+  91, 195, 4, 233, 222, 48, 65, 186, 5, 38, 72, 119, 147, 9, 210, 205, 48,
+  65, 186, 227, 77, 144, 110, 63, 19, 164, 219, 209, 4, 233, 198, 152, 32,
+  221, 210, 38, 72, 247, 39, 19, 164, 115, 254, 71, 187, 171, 77, 144, 238,
+  60, 19, 164, 251, 142, 9, 210, 125, 213, 4, 233, 62, 97, 130, 116, 190, 255,
+  104, 55, 210, 4, 233, 220, 255, 213, 206, 247, 255, 237, 166, 155, 32, 221,
+  33, 38, 72, 55, 209, 4, 233, 134, 153, 32, 221, 115, 38, 72, 119, 131, 9,
+  210, 157, 110, 130, 116, 222, 255, 180, 219, 222, 4, 233, 134, 155, 32, 221,
+  98, 19, 164, 187, 221, 4, 233, 206, 55, 65, 186, 163, 77, 144, 238, 211,
+  38, 72, 183, 169, 9, 210, 45, 99, 130, 116, 207, 155, 192, 255, 255, 148,
+  109, 166, 9, 210, 57, 255, 183, 221, 190, 38, 72, 183, 131, 9, 210, 173,
+  101, 130, 116, 206, 255, 109, 119, 171, 9, 210, 157, 104, 130, 116, 31, 55,
+  65, 186, 149, 76, 144, 110, 190, 9, 210, 93, 104, 130, 116, 7, 155, 32, 221,
+  54, 38, 72, 247, 182, 9, 210, 57, 255, 183, 221, 5, 38, 72, 119, 168, 9,
+  210, 57, 255, 165, 157, 231, 127, 237, 22, 153, 32, 221, 53, 38, 72, 119,
+  138, 9, 210, 249, 253, 103, 59, 207, 127, 219, 173, 96, 130, 116, 115, 76,
+  144, 206, 249, 15, 237, 198, 154, 32, 157, 231, 63, 237, 220, 255, 216, 110,
+  79, 19, 164, 91, 209, 4, 233, 230, 154, 32, 157, 231, 255, 237, 220, 255,
+  218, 206, 243, 223, 118, 243, 76, 144, 238, 28, 19, 164, 155, 106, 130, 116,
+  235, 155, 32, 221, 19, 38, 72, 119, 184, 9, 210, 45, 111, 130, 116, 151,
+  154, 32, 221, 110, 38, 72, 247, 178, 9, 210, 157, 109, 130, 116, 206, 127,
+  110, 247, 71, 19, 164, 155, 110, 130, 116, 83, 76, 144, 238, 77, 19, 164,
+  59, 204, 4, 233, 158, 53, 65, 58, 223, 255, 183, 123, 198, 4, 233, 14, 52,
+  65, 186, 37, 38, 72, 231, 254, 159, 118, 35, 77, 144, 238, 0, 19, 164, 155,
+  101, 130, 116, 175, 152, 32, 221, 100, 19, 164, 251, 165, 9, 210, 13, 55,
+  65, 186, 147, 77, 144, 110, 41, 19, 164, 59, 195, 4, 233, 214, 51, 65, 186,
+  217, 38, 72, 55, 205, 4, 233, 70, 153, 32, 221, 35, 38, 72, 247, 115, 19,
+  164, 251, 154, 9, 210, 237, 104, 130, 116, 99, 76, 144, 110, 152, 9, 210,
+  121, 254, 223, 110, 146, 9, 248, 139, 191, 248, 139, 191, 248, 139, 191,
+  248, 139, 191, 248, 139, 191, 6, 178, 143, 154, 128, 191, 248, 139, 191,
+  248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191,
+  6, 38, 247, 127, 242, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127,
+  241, 23, 127, 241, 23, 127, 241, 23, 127, 241, 215, 208, 111, 162, 9, 248,
+  139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191, 248,
+  139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191, 134, 100, 31, 49,
+  1, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23,
+  127, 13, 92, 19, 76, 192, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252,
+  197, 95, 252, 197, 95, 252, 197, 95, 3, 211, 246, 38, 224, 47, 254, 226,
+  47, 254, 226, 47, 254, 226, 47, 254, 226, 47, 254, 226, 47, 254, 226, 47,
+  254, 226, 175, 33, 223, 118, 38, 224, 47, 254, 226, 47, 254, 226, 47, 254,
+  226, 47, 254, 226, 47, 254, 226, 47, 254, 226, 47, 254, 226, 47, 254, 226,
+  47, 254, 226, 175, 33, 215, 135, 77, 192, 95, 252, 197, 95, 252, 197, 95,
+  252, 197, 95, 252, 197, 95, 252, 197, 95, 3, 215, 120, 19, 240, 23, 127,
+  241, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 13,
+  84, 219, 154, 128, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191, 248,
+  139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191, 134, 124, 219, 152,
+  128, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191, 248,
+  139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191, 134,
+  92, 91, 155, 128, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191, 248,
+  139, 191, 248, 107, 32, 219, 202, 4, 252, 197, 95, 252, 197, 95, 252, 197,
+  95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 3, 213, 135, 76, 192, 95, 252,
+  197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197,
+  95, 252, 197, 95, 67, 190, 45, 77, 192, 95, 252, 197, 95, 252, 197, 95, 252,
+  197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197,
+  95, 67, 182, 45, 76, 192, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252,
+  197, 95, 3, 219, 230, 38, 224, 47, 254, 226, 47, 254, 226, 47, 254, 226,
+  47, 254, 226, 47, 254, 226, 175, 129, 107, 156, 9, 248, 139, 191, 248, 139,
+  191, 248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 107,
+  96, 218, 204, 4, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95,
+  252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 53, 228, 219, 212, 4, 252,
+  197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 53, 176, 141, 53,
+  1, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 13, 108,
+  155, 152, 128, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139,
+  191, 248, 139, 191, 6, 174, 141, 77, 192, 95, 252, 197, 95, 252, 197, 95,
+  252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 3, 211, 70, 38, 224,
+  47, 254, 226, 47, 254, 226, 47, 254, 226, 175, 129, 111, 67, 19, 240, 23,
+  127, 241, 23, 127, 241, 23, 127, 241, 23, 127, 13, 116, 27, 152, 128, 191,
+  248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 139, 191, 6, 182, 245,
+  77, 192, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 252,
+  197, 95, 3, 215, 24, 19, 240, 23, 127, 241, 23, 127, 241, 23, 127, 37, 26,
+  109, 2, 254, 226, 47, 254, 226, 47, 254, 226, 175, 68, 235, 153, 128, 191,
+  248, 139, 191, 248, 139, 191, 248, 139, 191, 248, 107, 160, 91, 215, 4, 252,
+  197, 95, 252, 197, 95, 252, 197, 95, 252, 197, 95, 3, 221, 58, 38, 224, 47,
+  254, 226, 47, 254, 226, 175, 76, 107, 155, 128, 191, 248, 139, 191, 248,
+  139, 191, 50, 173, 101, 2, 254, 226, 47, 254, 226, 47, 254, 226, 175, 68,
+  31, 52, 1, 127, 241, 23, 127, 241, 23, 127, 241, 87, 162, 15, 152, 128, 191,
+  248, 139, 191, 248, 43, 213, 154, 38, 224, 47, 254, 226, 175, 92, 107, 152,
+  128, 191, 248, 139, 191, 248, 139, 191, 50, 141, 50, 1, 127, 241, 23, 127,
+  241, 23, 127, 101, 26, 105, 2, 254, 226, 175, 100, 35, 76, 192, 95, 252,
+  197, 95, 185, 86, 55, 1, 127, 241, 23, 127, 229, 90, 205, 4, 252, 197, 95,
+  252, 149, 107, 85, 19, 240, 23, 127, 37, 123, 191, 9, 248, 43, 219, 42, 38,
+  224, 47, 254, 74, 54, 220, 4, 252, 197, 95, 201, 134, 153, 128, 191, 178,
+  173, 108, 2, 254, 202, 182, 146, 9, 248, 43, 219, 138, 38, 224, 47, 254,
+  74, 182, 130, 9, 210, 45, 111, 130, 116, 203, 153, 128, 191, 178, 45, 107,
+  2, 254, 202, 182, 140, 9, 248, 43, 219, 210, 38, 224, 175, 108, 75, 153,
+  128, 191, 248, 75, 146, 36, 73, 146, 164, 129, 237, 191, 161, 108, 232, 63
+};
+
+#endif
+
@@ -2,8 +2,11 @@
 #include "common.hpp"
 #include "filebuf.hpp"
 #include "pbr_lut.hpp"
+#include "threadpool.hpp"
+#include "zlib.hpp"
 
-#include <thread>
+// pbr_lut_data_size, pbr_lut_data_zlib: generated by scripts/make_lut.cpp
+#include "pbr_ltbl.cpp"
 
 // the code for generating the BRDF LUT is based on
 // "Real Shading in Unreal Engine 4" (s2013_pbs_epic_notes_v2.pdf)
@@ -84,46 +87,130 @@ void SF_PBR_Tables::threadFunction(
   }
 }
 
-SF_PBR_Tables::SF_PBR_Tables(int width, int nSpec)
-  : imageData(size_t(width) * size_t(width) * sizeof(std::uint64_t) + 148, 0)
+void SF_PBR_Tables::generateImageData(
+    unsigned char *buf, int width, int nSpec)
 {
-  unsigned char *p = imageData.data();
   // DXGI_FORMAT_R16G16B16A16_FLOAT
-  FileBuffer::writeDDSHeader(p, 0x0A, width, width);
-  p = p + 148;
+  FileBuffer::writeDDSHeader(buf, 0x0A, width, width);
+  unsigned char *p = buf + 148;
 
-  int     threadCnt = int(std::thread::hardware_concurrency());
-  threadCnt = std::min< int >(std::max< int >(threadCnt, 1), 16);
-  threadCnt = std::min(threadCnt, width);
-  std::thread *threads[16];
-  for (int i = 0; i < 16; i++)
-    threads[i] = nullptr;
-  try
+  ThreadPool::getDefaultPool().parallelFor(
+      0, width, 1,
+      [=](int y0, int y1)
+      {
+        threadFunction(p, width, nSpec, y0, y1);
+      });
+}
+
+void SF_PBR_Tables::loadDefaultTable()
+{
+  // the embedded data consists of the DDS header, followed by 8 planes of
+  // width * width bytes: the low and high bytes of the difference of each
+  // 16-bit channel from the pixel on its left, in R, G, B, A order
+  if (imageData.size() != pbr_lut_data_size)
+    errorMessage("internal error: invalid size of embedded PBR LUT");
+  std::vector< unsigned char >  tmpBuf(pbr_lut_data_size);
+  if (ZLibDecompressor::decompressData(tmpBuf.data(), tmpBuf.size(),
+                                       pbr_lut_data_zlib,
+                                       sizeof(pbr_lut_data_zlib))
+      != tmpBuf.size())
   {
-    for (int i = 0; i < threadCnt; i++)
-    {
-      threads[i] = new std::thread(threadFunction, p, width, nSpec,
-                                   i * width / threadCnt,
-                                   (i + 1) * width / threadCnt);
-    }
-    for (int i = 0; i < threadCnt; i++)
-    {
-      threads[i]->join();
-      delete threads[i];
-      threads[i] = nullptr;
-    }
+    errorMessage("internal error: invalid embedded PBR LUT data");
   }
-  catch (...)
+  std::memcpy(imageData.data(), tmpBuf.data(), 148);
+  size_t  n = size_t(width) * size_t(width);
+  const unsigned char *srcPtr = tmpBuf.data() + 148;
+  for (size_t c = 0; c < 4; c++)
   {
-    for (int i = 0; i < 16; i++)
+    unsigned char *p = imageData.data() + (148 + (c * 2));
+    for (int y = 0; y < width; y++)
     {
-      if (threads[i])
+      std::uint16_t tmp = 0;
+      for (int x = 0; x < width; x++, srcPtr++, p = p + sizeof(std::uint64_t))
       {
-        threads[i]->join();
-        delete threads[i];
+        tmp = std::uint16_t(tmp + srcPtr[0] + (std::uint16_t(srcPtr[n]) << 8));
+        FileBuffer::writeUInt16Fast(p, tmp);
       }
     }
-    throw;
+    srcPtr = srcPtr + n;
+  }
+}
+
+std::string SF_PBR_Tables::getCacheFileName(const char *cacheDir) const
+{
+  std::string fileName(cacheDir);
+  if (!(fileName.ends_with('/') || fileName.ends_with('\\')))
+    fileName += '/';
+  printToString(fileName, "pbr_lut_%d_%d.dds", width, nSpec);
+  return fileName;
+}
+
+bool SF_PBR_Tables::loadFromDiskCache(const std::string& fileName)
+{
+  try
+  {
+    FileBuffer  f(fileName.c_str());
+    if (f.size() != imageData.size())
+      return false;
+    // the header must be identical to that of a newly generated table
+    unsigned char tmpBuf[148];
+    FileBuffer::writeDDSHeader(tmpBuf, 0x0A, width, width);
+    if (std::memcmp(f.data(), tmpBuf, 148) != 0)
+      return false;
+    std::memcpy(imageData.data(), f.data(), imageData.size());
+    return true;
+  }
+  catch (FO76UtilsError&)
+  {
+  }
+  return false;
+}
+
+void SF_PBR_Tables::storeInDiskCache(const std::string& fileName) const
+{
+  // errors are ignored, the table is just not cached
+  (void) OutputFile::writeFileAtomic(fileName.c_str(), imageData.data(),
+                                     imageData.size());
+}
+
+SF_PBR_Tables::SF_PBR_Tables(int width, int nSpec, const char *cacheDir)
+  : imageData(size_t(width) * size_t(width) * sizeof(std::uint64_t) + 148, 0),
+    width(width),
+    nSpec(nSpec)
+{
+  if (width == 512 && nSpec == 4096)
+  {
+    loadDefaultTable();
+    return;
+  }
+  std::string fileName;
+  if (cacheDir && cacheDir[0])
+  {
+    fileName = getCacheFileName(cacheDir);
+    if (loadFromDiskCache(fileName))
+      return;
+  }
+  generateImageData(imageData.data(), width, nSpec);
+  if (!fileName.empty())
+    storeInDiskCache(fileName);
+}
+
+float SF_PBR_Tables::verifyImageData() const
+{
+  std::vector< unsigned char >  tmpBuf(imageData.size());
+  generateImageData(tmpBuf.data(), width, nSpec);
+  FloatVector4  maxDiff(0.0f);
+  for (size_t i = 148; (i + sizeof(std::uint64_t)) <= tmpBuf.size();
+       i = i + sizeof(std::uint64_t))
+  {
+    FloatVector4  a(FloatVector4::convertFloat16(
+                        FileBuffer::readUInt64Fast(tmpBuf.data() + i)));
+    FloatVector4  b(FloatVector4::convertFloat16(
+                        FileBuffer::readUInt64Fast(imageData.data() + i)));
+    maxDiff.maxValues(a - b);
+    maxDiff.maxValues(b - a);
   }
+  return std::max(std::max(maxDiff[0], maxDiff[1]),
+                  std::max(maxDiff[2], maxDiff[3]));
 }
 
@@ -5,6 +5,7 @@
 #include "common.hpp"
 #include "fp32vec4.hpp"
 #include "fp32vec8.hpp"
+#include "filebuf.hpp"
 
 class SF_PBR_Tables
 {
@@ -14,12 +15,32 @@ class SF_PBR_Tables
   static FloatVector4 importanceSampleGGX(FloatVector4 xi, float a2);
  protected:
   std::vector< unsigned char >  imageData;
+  int     width;
+  int     nSpec;
   // approximates Fresnel function for n = 1.5, normalized to 0.0 to 1.0
   static inline FloatVector8 fresnel_n(FloatVector8 x);
   static void threadFunction(unsigned char *outBuf, int width, int nSpec,
                              int y0, int y1);
+  // decompress the table embedded in the library, which has the default
+  // parameters (width = 512, nSpec = 4096)
+  void loadDefaultTable();
+  std::string getCacheFileName(const char *cacheDir) const;
+  // returns false if the file does not exist or is not valid
+  bool loadFromDiskCache(const std::string& fileName);
+  void storeInDiskCache(const std::string& fileName) const;
  public:
-  SF_PBR_Tables(int width = 512, int nSpec = 4096);
+  // The table with default parameters is not calculated, but decompressed
+  // from data embedded in the library. For other sizes, if cacheDir is not
+  // nullptr or empty, the table is loaded from "pbr_lut_W_N.dds" in the
+  // cache directory, or calculated and saved there if the file is not found.
+  SF_PBR_Tables(int width = 512, int nSpec = 4096,
+                const char *cacheDir = nullptr);
+  // calculate the table at runtime, buf must have space for the DDS header
+  // and width * width pixels
+  static void generateImageData(unsigned char *buf, int width, int nSpec);
+  // verification mode: calculates the table at runtime, and returns the
+  // largest absolute difference from the embedded or cached image data
+  float verifyImageData() const;
   // R = indirect specular F (U = N·V, V = roughness)
   // G = indirect specular G
   // B = fresnel_n(U)
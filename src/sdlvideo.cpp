@@ -6,8 +6,8 @@
 #include "ddstxt.hpp"
 #include "zlib.hpp"
 #include "downsamp.hpp"
+#include "threadpool.hpp"
 
-#include <thread>
 #if defined(_WIN32) || defined(_WIN64)
 #  include <windows.h>
 #endif
@@ -827,11 +827,12 @@ void SDLDisplay::drawText(int y0Dst, int y0Src, int lineCnt,
   if ((y0Dst + lineCnt) > textHeight)
     lineCnt = textHeight - y0Dst;
 
-  std::thread *threads[32];
-  int     threadCnt = int(std::thread::hardware_concurrency());
-  if (threadCnt > (lineCnt >> (fontVScale < 1.0f ? 1 : 2)))
-    threadCnt = lineCnt >> (fontVScale < 1.0f ? 1 : 2);
-  threadCnt = (threadCnt > 1 ? (threadCnt < 32 ? threadCnt : 32) : 1);
+  // characters may overlap adjacent lines, so the text is drawn in two
+  // passes, with only even or odd numbered blocks of lines drawn in parallel
+  int     threadCnt = ThreadPool::getDefaultPool().getThreadCount();
+  int     blockLines = std::max(lineCnt / (threadCnt * 4),
+                                (fontVScale < 1.0f ? 1 : 2));
+  int     blockCnt = (lineCnt + blockLines - 1) / blockLines;
 #ifdef HAVE_SDL2
   if (!usingImageBuf)
     SDL_LockSurface(sdlScreen);
@@ -845,43 +846,25 @@ void SDLDisplay::drawText(int y0Dst, int y0Src, int lineCnt,
       continue;
     alpha = (alpha < 1.0f ? alpha : 1.0f);
     bool    isBackground = (i == 0);
-    if (threadCnt < 2)
+    if (blockCnt < 3)
     {
       drawTextThreadFunc(this, y0Src, y0Dst, lineCnt, isBackground, alpha);
       continue;
     }
     for (int j = 0; j < 2; j++)
     {
-      int     y0 = 0;
-      for (int k = 0; k < threadCnt; k++)
-      {
-        int     y2 = (lineCnt * (k + 1)) / threadCnt;
-        int     y1 = (y0 + y2) >> 1;
-        int     yOffs = (j == 0 ? y0 : y1);
-        int     n = (j == 0 ? (y1 - y0) : (y2 - y1));
-        try
-        {
-          threads[k] = new std::thread(drawTextThreadFunc,
-                                       this, y0Src + yOffs, y0Dst + yOffs, n,
-                                       isBackground, alpha);
-        }
-        catch (...)
-        {
-          threads[k] = nullptr;
-          drawTextThreadFunc(this, y0Src + yOffs, y0Dst + yOffs, n,
-                             isBackground, alpha);
-        }
-        y0 = y2;
-      }
-      for (int k = 0; k < threadCnt; k++)
-      {
-        if (threads[k])
-        {
-          threads[k]->join();
-          delete threads[k];
-          threads[k] = nullptr;
-        }
-      }
+      ThreadPool::getDefaultPool().parallelFor(
+          0, (blockCnt + 1 - j) >> 1, 1,
+          [&](int k0, int k1)
+          {
+            for (int k = k0; k < k1; k++)
+            {
+              int     yOffs = ((k << 1) + j) * blockLines;
+              int     n = std::min(blockLines, lineCnt - yOffs);
+              drawTextThreadFunc(this, y0Src + yOffs, y0Dst + yOffs, n,
+                                 isBackground, alpha);
+            }
+          });
     }
   }
 #ifdef HAVE_SDL2
@@ -4,8 +4,7 @@
 #include "fp32vec8.hpp"
 #include "ddstxt.hpp"
 #include "ddstxt16.hpp"
-
-#include <thread>
+#include "threadpool.hpp"
 
 const float SFCubeMapFilter::defaultRoughnessTable[7] =
 {
@@ -470,11 +469,6 @@ size_t SFCubeMapFilter::convertImage(
   }
 
   unsigned char *outBufP = buf + 148;
-  int     threadCnt = int(std::thread::hardware_concurrency());
-  threadCnt = std::min< int >(std::max< int >(threadCnt, 1), 16);
-  std::thread *threads[16];
-  for (int i = 0; i < 16; i++)
-    threads[i] = nullptr;
   int     w = int(width);
   for (int m = 0; w > 0; m++, w = w >> 1)
   {
@@ -522,38 +516,15 @@ size_t SFCubeMapFilter::convertImage(
       cubeFilterTable = reinterpret_cast< float * >(cubeFilterTableBuf.data());
       createFilterTable(w2);
     }
-    try
-    {
-      threadCnt = std::min< int >(threadCnt, std::max< int >(w >> 3, 1));
-      int     y0 = 0;
-      for (int i = 0; i < threadCnt; i++)
-      {
-        int     y1 = (w * 6 * (i + 1)) / threadCnt;
-        size_t  startPos = size_t(y0) * size_t(w);
-        size_t  endPos = size_t(y1) * size_t(w);
-        y0 = y1;
-        threads[i] = new std::thread(threadFunction, this, outBufP, w,
-                                     startPos, endPos, roughness, enableFilter);
-      }
-      for (int i = 0; i < threadCnt; i++)
-      {
-        threads[i]->join();
-        delete threads[i];
-        threads[i] = nullptr;
-      }
-    }
-    catch (...)
-    {
-      for (int i = 0; i < 16; i++)
-      {
-        if (threads[i])
+    // blocks of at least 256 pixels, the number of pixels processed by
+    // each call must be even
+    ThreadPool::getDefaultPool().parallelFor(
+        0, w * 6, std::max< int >(256 / w, 1),
+        [&](int y0, int y1)
         {
-          threads[i]->join();
-          delete threads[i];
-        }
-      }
-      throw;
-    }
+          threadFunction(this, outBufP, w, size_t(y0) * size_t(w),
+                         size_t(y1) * size_t(w), roughness, enableFilter);
+        });
     outBufP = outBufP + (size_t(w * w) * sizeof(std::uint32_t));
   }
 
@@ -869,42 +840,13 @@ bool SFCubeMapCache::convertHDRToDDS(
   (void) FileBuffer::writeDDSHeader(p, outFmt, cubeWidth, cubeWidth, 1, true);
   p = p + 148;
 
-  int     threadCnt = int(std::thread::hardware_concurrency());
-  threadCnt = std::min< int >(threadCnt, std::min< int >(cubeWidth >> 3, 16));
-  threadCnt = std::max< int >(threadCnt, 1);
-  std::thread *threads[16];
-  for (int i = 0; i < 16; i++)
-    threads[i] = nullptr;
-  try
-  {
-    int     y0 = 0;
-    for (int i = 0; i < threadCnt; i++)
-    {
-      int     y1 = (cubeWidth * 6 * (i + 1)) / threadCnt;
-      threads[i] = new std::thread(convertHDRToDDSThread, p, outPixelSize,
-                                   cubeWidth, y0, y1, tmpBuf2.data(), w, h,
-                                   maxLevel);
-      y0 = y1;
-    }
-    for (int i = 0; i < threadCnt; i++)
-    {
-      threads[i]->join();
-      delete threads[i];
-      threads[i] = nullptr;
-    }
-  }
-  catch (...)
-  {
-    for (int i = 0; i < 16; i++)
-    {
-      if (threads[i])
+  ThreadPool::getDefaultPool().parallelFor(
+      0, cubeWidth * 6, 8,
+      [&](int y0, int y1)
       {
-        threads[i]->join();
-        delete threads[i];
-      }
-    }
-    throw;
-  }
+        convertHDRToDDSThread(p, outPixelSize, cubeWidth, y0, y1,
+                              tmpBuf2.data(), w, h, maxLevel);
+      });
   return true;
 }
 
@@ -3,8 +3,21 @@
 #include "filebuf.hpp"
 #include "fp32vec8.hpp"
 #include "pbr_lut.hpp"
+#include "simdfunc.hpp"
+#include "threadpool.hpp"
 
-#include <thread>
+#include <ctime>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#if defined(_WIN32) || defined(_WIN64)
+#  include <io.h>
+#  include <direct.h>
+#  include <sys/utime.h>
+#else
+#  include <dirent.h>
+#  include <utime.h>
+#endif
 
 const float SFCubeMapFilter::defaultRoughnessTable[7] =
 {
@@ -12,6 +25,11 @@ const float SFCubeMapFilter::defaultRoughnessTable[7] =
   1.00000000f
 };
 
+std::mutex SFCubeMapFilter::tableCacheMutex;
+
+std::map< std::uint64_t, SFCubeMapFilter::TablePtr >
+    SFCubeMapFilter::tableCache;
+
 void SFCubeMapFilter::processImage_Specular(
     unsigned char *outBufP, int w, int y0, int y1, float roughness)
 {
@@ -21,8 +39,20 @@ void SFCubeMapFilter::processImage_Specular(
   std::uint8_t  l2w = std::uint8_t(std::bit_width((unsigned int) w) - 1);
   size_t  cubeFilterTableSize = (size_t(w2) * size_t(w2) * 30) >> 3;
   std::vector< FloatVector4 > tmpBuf(endPos - startPos, FloatVector4(0.0f));
+  // v = reflected view vector (R) of each pixel, assume V = N = R
+  std::vector< FloatVector4 > v(endPos - startPos);
+  for (size_t i = startPos; i < endPos; i++)
+  {
+    int     x = int(i & (size_t(w) - 1));
+    int     y = int((i >> l2w) & (size_t(w) - 1));
+    int     n = int(i >> (l2w + l2w));
+    v[i - startPos] = convertCoord(x, y, w, n);
+  }
   float   a = roughness * roughness;
   float   a2 = a * a;
+  void    (*filterFunction)(float *, const float *, size_t,
+                            const float *, size_t, float) =
+      SIMDFunctions::get().cubeFilterSpecular;
   for (size_t j0 = 0; (j0 + 10) <= cubeFilterTableSize; )
   {
     // accumulate convolution output in tmpBuf using smaller partitions of the
@@ -30,68 +60,8 @@ void SFCubeMapFilter::processImage_Specular(
     // L1 cache
     size_t  j1 = j0 + 400;
     j1 = std::min(j1, cubeFilterTableSize);
-    FloatVector4  *tmpBufPtr = tmpBuf.data();
-    for (size_t i = startPos; i < endPos; i++, tmpBufPtr++)
-    {
-      int     x = int(i & (size_t(w) - 1));
-      int     y = int((i >> l2w) & (size_t(w) - 1));
-      int     n = int(i >> (l2w + l2w));
-      // v1 = reflected view vector (R), assume V = N = R
-      FloatVector4  v1(convertCoord(x, y, w, n));
-      FloatVector8  v1x(v1[0]);
-      FloatVector8  v1y(v1[1]);
-      FloatVector8  v1z(v1[2]);
-      FloatVector8  c_r(0.0f);
-      FloatVector8  c_g(0.0f);
-      FloatVector8  c_b(0.0f);
-      FloatVector8  totalWeight(0.0f);
-      FloatVector8  a2m1(a2 - 1.0f);
-      FloatVector8  a2p1(a2 + 1.0f);
-      const FloatVector8  *j =
-          reinterpret_cast< const FloatVector8 * >(cubeFilterTable) + j0;
-      const FloatVector8  *endPtr = j + (j1 - j0);
-      for ( ; (j + 10) <= endPtr; j += 10)
-      {
-        // v2 = light vector
-        FloatVector8  v2x(j[0]);
-        FloatVector8  v2y(j[1]);
-        FloatVector8  v2z(j[2]);
-        // d = N·L = R·L = 2.0 * N·H * N·H - 1.0
-        FloatVector8  lDotR = (v1x * v2x) + (v1y * v2y) + (v1z * v2z);
-        std::uint32_t signMask = lDotR.getSignMask();
-        FloatVector8  v2w(j[3]);
-        if (signMask != 255U)
-        {
-          FloatVector8  d(lDotR);       // face +X, +Y or +Z
-          d.maxValues(FloatVector8(0.0f));
-          FloatVector8  weight(d * v2w);
-          // D denominator = (N·H * N·H * (a2 - 1.0) + 1.0)² * 4.0
-          //               = ((R·L + 1.0) * (a2 - 1.0) + 2.0)²
-          weight *= (d * a2m1 + a2p1).rcpSqr();
-          c_r += (j[4] * weight);
-          c_g += (j[5] * weight);
-          c_b += (j[6] * weight);
-          totalWeight += weight;
-          if (signMask == 0U) [[likely]]
-            continue;
-        }
-        {
-          FloatVector8  d(lDotR);       // face -X, -Y or -Z: invert dot product
-          d.minValues(FloatVector8(0.0f));
-          FloatVector8  weight(d * v2w);
-          weight *= (a2p1 - (d * a2m1)).rcpSqr();
-          c_r -= (j[7] * weight);
-          c_g -= (j[8] * weight);
-          c_b -= (j[9] * weight);
-          totalWeight -= weight;
-        }
-      }
-      FloatVector4  c(c_r.dotProduct(FloatVector8(1.0f)),
-                      c_g.dotProduct(FloatVector8(1.0f)),
-                      c_b.dotProduct(FloatVector8(1.0f)),
-                      totalWeight.dotProduct(FloatVector8(1.0f)));
-      *tmpBufPtr = *tmpBufPtr + c;
-    }
+    filterFunction(&(tmpBuf[0][0]), &(v[0][0]), endPos - startPos,
+                   cubeFilterTable + (j0 * 8), (j1 - j0) / 10, a2);
     j0 = j1;
   }
 
@@ -118,8 +88,13 @@ void SFCubeMapFilter::processImage_Specular(
 void SFCubeMapFilter::processImage_ImportanceSample(
     unsigned char *outBufP, int w, int y0, int y1)
 {
-  const FloatVector4  *importanceSampleData = importanceSampleTable->data();
+  const FloatVector8  *importanceSampleData = importanceSampleTable->data();
   size_t  sCnt = importanceSampleTable->size();
+  FloatVector8  totalWeight(0.0f);
+  for (size_t i = 0; i < sCnt; i = i + 5)
+    totalWeight += importanceSampleData[i + 3];
+  float   scale = normalizeScale / totalWeight.dotProduct(FloatVector8(1.0f));
+  FloatVector8  mipOffset(float(std::log2(float(cubeMap->getWidth()))));
   std::uint8_t  l2w = std::uint8_t(std::bit_width((unsigned int) w) - 1);
   for (int y = y0; y < y1; y++)
   {
@@ -138,18 +113,32 @@ void SFCubeMapFilter::processImage_ImportanceSample(
       t_x /= float(std::sqrt(t_x.dotProduct3(t_x)));
       FloatVector4  t_y(normal.crossProduct3(t_x));
       t_y /= float(std::sqrt(t_y.dotProduct3(t_y)));
-      FloatVector4  c(0.0f);
-      float   weight = 0.0f;
-      for (int i = 0; i < int(sCnt); i++)
+      // tangent space to world space matrix, one column per axis
+      FloatVector8  m00(t_x[0]), m01(t_y[0]), m02(normal[0]);
+      FloatVector8  m10(t_x[1]), m11(t_y[1]), m12(normal[1]);
+      FloatVector8  m20(t_x[2]), m21(t_y[2]), m22(normal[2]);
+      FloatVector8  c_r(0.0f);
+      FloatVector8  c_g(0.0f);
+      FloatVector8  c_b(0.0f);
+      const FloatVector8  *j = importanceSampleData;
+      for (size_t i = 0; i < sCnt; i = i + 5, j = j + 5)
       {
-        FloatVector4  l(importanceSampleData[i]);
-        float   nDotL = l[2];
-        float   mipLevel = l[3];
-        l = (t_x * l[0]) + (t_y * l[1]) + (normal * l[2]);
-        c += cubeMap->cubeMap(l[0], l[1], l[2], mipLevel) * nDotL;
-        weight += nDotL;
+        FloatVector8  l_x((m00 * j[0]) + (m01 * j[1]) + (m02 * j[2]));
+        FloatVector8  l_y((m10 * j[0]) + (m11 * j[1]) + (m12 * j[2]));
+        FloatVector8  l_z((m20 * j[0]) + (m21 * j[1]) + (m22 * j[2]));
+        FloatVector8  mipLevel(j[4] + mipOffset);
+        mipLevel.maxValues(FloatVector8(0.0f));
+        mipLevel.minValues(FloatVector8(16.0f));
+        FloatVector8  c[4];
+        cubeMap->cubeMap8(c, l_x, l_y, l_z, mipLevel);
+        c_r += (c[0] * j[3]);
+        c_g += (c[1] * j[3]);
+        c_b += (c[2] * j[3]);
       }
-      pixelStoreFunction(p, c * (normalizeScale / weight));
+      FloatVector4  c(c_r.dotProduct(FloatVector8(1.0f)),
+                      c_g.dotProduct(FloatVector8(1.0f)),
+                      c_b.dotProduct(FloatVector8(1.0f)), 0.0f);
+      pixelStoreFunction(p, c * scale);
     }
   }
 }
@@ -177,6 +166,103 @@ void SFCubeMapFilter::processImage_Copy(
   }
 }
 
+void SFCubeMapFilter::processImage_Diffuse(
+    unsigned char *outBufP, int w, int y0, int y1)
+{
+  std::uint8_t  l2w = std::uint8_t(std::bit_width((unsigned int) w) - 1);
+  for (int y = y0; y < y1; y++)
+  {
+    int     n = y >> l2w;
+    int     yc = y & (w - 1);
+    unsigned char *p =
+        outBufP + (size_t(n) * faceDataSize
+                   + (size_t(yc) * size_t(w) * sizeof(std::uint32_t)));
+    for (int x = 0; x < w; x++, p = p + sizeof(std::uint32_t))
+    {
+      FloatVector4  v(convertCoord(x, yc, w, n));
+      FloatVector4  c(evaluateSHIrradiance(shCoefficients, v));
+      pixelStoreFunction(p, c.maxValues(FloatVector4(0.0f)));
+    }
+  }
+}
+
+// real spherical harmonics basis functions for bands 0 to 2 of unit vector v
+static inline void getSHBasis(float *b, FloatVector4 v)
+{
+  float   x = v[0];
+  float   y = v[1];
+  float   z = v[2];
+  b[0] = 0.28209479f;
+  b[1] = 0.48860251f * y;
+  b[2] = 0.48860251f * z;
+  b[3] = 0.48860251f * x;
+  b[4] = 1.09254843f * (x * y);
+  b[5] = 1.09254843f * (y * z);
+  b[6] = 0.31539157f * (3.0f * (z * z) - 1.0f);
+  b[7] = 1.09254843f * (x * z);
+  b[8] = 0.54627422f * ((x * x) - (y * y));
+}
+
+void SFCubeMapFilter::calculateSphericalHarmonics(
+    FloatVector4 *sh, const DDSTexture16& t)
+{
+  // a resolution of 64x64 per face is more than sufficient for band 2
+  int     w = t.getWidth();
+  int     mipLevel = 0;
+  for ( ; w > 64; w = w >> 1)
+    mipLevel++;
+  // partial sums per row, added in a fixed order for deterministic results
+  std::vector< FloatVector4 > rowSums(size_t(w * 6) * 9, FloatVector4(0.0f));
+  ThreadPool::getDefaultPool().parallelFor(
+      0, w * 6, 8,
+      [&](int y0, int y1)
+      {
+        for (int y = y0; y < y1; y++)
+        {
+          FloatVector4  *s = rowSums.data() + (size_t(y) * 9);
+          for (int x = 0; x < w; x++)
+          {
+            FloatVector4  v(convertCoord(x, y % w, w, y / w));
+            // v[3] is proportional to the solid angle of the texel
+            FloatVector4  c(t.cubeMap(v[0], v[1], v[2], float(mipLevel)));
+            c *= v[3];
+            float   b[9];
+            getSHBasis(b, v);
+            for (int i = 0; i < 9; i++)
+              s[i] += c * b[i];
+          }
+        }
+      });
+  for (int i = 0; i < 9; i++)
+    sh[i] = FloatVector4(0.0f);
+  for (size_t j = 0; j < rowSums.size(); j = j + 9)
+  {
+    for (int i = 0; i < 9; i++)
+      sh[i] += rowSums[j + size_t(i)];
+  }
+  // texel solid angle = 4 / (w * w) * v[3]
+  float   scale = 4.0f / float(w * w);
+  for (int i = 0; i < 9; i++)
+  {
+    sh[i] *= scale;
+    sh[i][3] = 0.0f;
+  }
+}
+
+FloatVector4 SFCubeMapFilter::evaluateSHIrradiance(
+    const FloatVector4 *sh, FloatVector4 n)
+{
+  // cosine lobe convolution (Ramamoorthi and Hanrahan, 2001), divided by π:
+  // A0 = 1.0, A1 = 2.0 / 3.0, A2 = 1.0 / 4.0
+  float   b[9];
+  getSHBasis(b, n);
+  FloatVector4  c(sh[0] * b[0]);
+  c += ((sh[1] * b[1]) + (sh[2] * b[2]) + (sh[3] * b[3])) * (2.0f / 3.0f);
+  c += ((sh[4] * b[4]) + (sh[5] * b[5]) + (sh[6] * b[6])
+        + (sh[7] * b[7]) + (sh[8] * b[8])) * 0.25f;
+  return c;
+}
+
 void SFCubeMapFilter::pixelStore_R8G8B8A8(unsigned char *p, FloatVector4 c)
 {
   std::uint32_t tmp = std::uint32_t(c.srgbCompress()) | 0xFF000000U;
@@ -194,17 +280,89 @@ void SFCubeMapFilter::threadFunction(
 {
   if (!enableFilter)
     p->processImage_Copy(outBufP, w, y0, y1);
+  else if (roughness >= 1.0f)
+    p->processImage_Diffuse(outBufP, w, y0, y1);
   else if (!p->importanceSampleTable)
     p->processImage_Specular(outBufP, w, y0, y1, roughness);
   else
     p->processImage_ImportanceSample(outBufP, w, y0, y1);
 }
 
-void SFCubeMapFilter::createFilterTable(int w)
+SFCubeMapFilter::TablePtr SFCubeMapFilter::getImportanceSampleTable(
+    float roughness, std::uint32_t n)
 {
-  int     mipLevel = int(std::bit_width((unsigned int) cubeMap->getWidth()))
-                     - int(std::bit_width((unsigned int) w));
-  mipLevel = std::max< int >(mipLevel - 1, 0);
+  // roughness > 0.0, so the upper 32 bits of the key are never zero,
+  // unlike in the case of direction tables
+  std::uint64_t k =
+      (std::uint64_t(std::bit_cast< std::uint32_t >(roughness)) << 32) | n;
+  std::unique_lock< std::mutex >  lock(tableCacheMutex);
+  std::map< std::uint64_t, TablePtr >::const_iterator i = tableCache.find(k);
+  if (i != tableCache.end())
+    return i->second;
+
+  std::vector< FloatVector8 > *buf = new std::vector< FloatVector8 >();
+  TablePtr  t(buf);
+  buf->reserve(size_t((n + 7U) >> 3) * 5);
+  size_t  m = 0;
+  float   a = roughness * roughness;
+  float   a2 = a * a;
+  for (std::uint32_t j = 0; j < n; j++)
+  {
+    FloatVector4  h(SF_PBR_Tables::importanceSampleGGX(
+                        SF_PBR_Tables::Hammersley(int(j), int(n)), a2));
+    float   nDotH = h[2];
+    FloatVector4  l(h * (nDotH * 2.0f)          // L = reflect(-N, H)
+                    - FloatVector4(0.0f, 0.0f, 1.0f, 0.0f));
+    if (!(l[2] > 0.0f))
+      continue;
+    // calculate mip level, based on formula from
+    // https://chetanjags.wordpress.com/2015/08/26/image-based-lighting/
+    // log2(input width) is added when the table is used
+    float   d = nDotH * nDotH * (a2 - 1.0f) + 1.0f;
+    d = a2 / (d * d);
+    float   mipLevel =                  // mip bias = +1.0
+        float(std::log2(float(n) * d)) * -0.5f + 2.29248125f;
+    // store samples in groups of 8 as vec8 X, vec8 Y, vec8 Z,
+    // vec8 weight (N·L), vec8 mip level
+    if (!(m & 7))
+    {
+      for (int c = 0; c < 5; c++)
+        buf->emplace_back(0.0f);
+    }
+    FloatVector8  *q = buf->data() + ((m >> 3) * 5);
+    q[0][m & 7] = l[0];
+    q[1][m & 7] = l[1];
+    q[2][m & 7] = l[2];
+    q[3][m & 7] = l[2];
+    q[4][m & 7] = mipLevel;
+    m++;
+  }
+  // unused elements of the last group have zero weight, and sample
+  // the first direction to avoid special cases in cubeMap8()
+  for ( ; m & 7; m++)
+  {
+    FloatVector8  *q = buf->data() + ((m >> 3) * 5);
+    q[0][m & 7] = q[0][0];
+    q[1][m & 7] = q[1][0];
+    q[2][m & 7] = q[2][0];
+    q[4][m & 7] = q[4][0];
+  }
+  tableCache.emplace(k, t);
+  return t;
+}
+
+SFCubeMapFilter::TablePtr SFCubeMapFilter::getDirectionTable(int w)
+{
+  std::uint64_t k = std::uint32_t(w);
+  std::unique_lock< std::mutex >  lock(tableCacheMutex);
+  std::map< std::uint64_t, TablePtr >::const_iterator i = tableCache.find(k);
+  if (i != tableCache.end())
+    return i->second;
+
+  std::vector< FloatVector8 > *buf =
+      new std::vector< FloatVector8 >((size_t(w) * size_t(w) * 12) >> 3,
+                                      FloatVector8(0.0f));
+  TablePtr  t(buf);
   for (int n = 0; n < 6; n = n + 2)
   {
     for (int y = 0; y < w; y++)
@@ -212,25 +370,69 @@ void SFCubeMapFilter::createFilterTable(int w)
       for (int x = 0; x < w; x++)
       {
         FloatVector4  v(convertCoord(x, y, w, n));
-        FloatVector4  c(cubeMap->cubeMap(v[0], v[1], v[2], float(mipLevel)));
-        FloatVector4  c2(cubeMap->cubeMap(-(v[0]), -(v[1]), -(v[2]),
-                                          float(mipLevel)));
-        float   *p = cubeFilterTable;
         // reorder data for more efficient use of SIMD
-        p = p + ((((n >> 1) * w + y) * w + (x & ~7)) * 10 + (x & 7));
-        p[0] = v[0];
-        p[8] = v[1];
-        p[16] = v[2];
-        p[24] = v[3];
-        p[32] = c[0];
-        p[40] = c[1];
-        p[48] = c[2];
-        p[56] = c2[0];
-        p[64] = c2[1];
-        p[72] = c2[2];
+        FloatVector8  *p =
+            buf->data() + (((((n >> 1) * w + y) * w + x) >> 3) * 4);
+        p[0][x & 7] = v[0];
+        p[1][x & 7] = v[1];
+        p[2][x & 7] = v[2];
+        p[3][x & 7] = v[3];
       }
     }
   }
+  tableCache.emplace(k, t);
+  return t;
+}
+
+std::uint32_t SFCubeMapFilter::getImportanceSampleLimit(int m, int mipCnt)
+{
+  std::uint32_t importanceSampleLimit = std::uint32_t(m + 16 - mipCnt) << 1;
+#if ENABLE_X86_64_SIMD >= 4
+  importanceSampleLimit = 44739243U >> importanceSampleLimit;
+#elif ENABLE_X86_64_SIMD == 3
+  importanceSampleLimit = 50331648U >> importanceSampleLimit;
+#elif ENABLE_X86_64_SIMD == 2
+  importanceSampleLimit = 33554432U >> importanceSampleLimit;
+#else
+  importanceSampleLimit = 134217728U >> importanceSampleLimit;
+#endif
+  return importanceSampleLimit;
+}
+
+void SFCubeMapFilter::createFilterTable(int w)
+{
+  TablePtr  directionTable(getDirectionTable(w));
+  int     mipLevel = int(std::bit_width((unsigned int) cubeMap->getWidth()))
+                     - int(std::bit_width((unsigned int) w));
+  mipLevel = std::max< int >(mipLevel - 1, 0);
+  const FloatVector8  *src = directionTable->data();
+  FloatVector8  *dst = reinterpret_cast< FloatVector8 * >(cubeFilterTable);
+  // sample the input texture in the direction of each texel (R0, G0, B0),
+  // and in the opposite direction (R1, G1, B1)
+  ThreadPool::getDefaultPool().parallelFor(
+      0, (w * w * 3) >> 3, 64,
+      [&](int i0, int i1)
+      {
+        FloatVector8  m = FloatVector8(float(mipLevel));
+        for (int i = i0; i < i1; i++)
+        {
+          const FloatVector8  *q = src + (size_t(i) * 4);
+          FloatVector8  *p = dst + (size_t(i) * 10);
+          FloatVector8  c[4];
+          p[0] = q[0];
+          p[1] = q[1];
+          p[2] = q[2];
+          p[3] = q[3];
+          cubeMap->cubeMap8(c, q[0], q[1], q[2], m);
+          p[4] = c[0];
+          p[5] = c[1];
+          p[6] = c[2];
+          cubeMap->cubeMap8(c, q[0] * -1.0f, q[1] * -1.0f, q[2] * -1.0f, m);
+          p[7] = c[0];
+          p[8] = c[1];
+          p[9] = c[2];
+        }
+      });
 }
 
 SFCubeMapFilter::SFCubeMapFilter(size_t outputWidth)
@@ -240,6 +442,13 @@ SFCubeMapFilter::SFCubeMapFilter(size_t outputWidth)
   roughnessTableSize = int(sizeof(defaultRoughnessTable) / sizeof(float));
   normalizeLevel = float(12.5 / 6.0);
   importanceSampleCnt = 0xFFFFFFFFU;
+  importanceSampleTable = nullptr;
+  inputMipOffset = -1;
+  blockCompression = 0;
+  compressionQuality = (unsigned char) BCnEncoder::qualityNormal;
+  cancelFlag = nullptr;
+  for (int i = 0; i < 9; i++)
+    shCoefficients[i] = FloatVector4(0.0f);
 }
 
 SFCubeMapFilter::~SFCubeMapFilter()
@@ -260,7 +469,7 @@ size_t SFCubeMapFilter::convertImage(
     return 0;
   try
   {
-    DDSTexture16  t(buf, bufSize, -1);
+    DDSTexture16  t(buf, bufSize, inputMipOffset);
     cubeMap = &t;
     if (!(t.getIsCubeMap() && t.getWidth() >= minWidth &&
           t.getWidth() == t.getHeight()))
@@ -282,6 +491,10 @@ size_t SFCubeMapFilter::convertImage(
       if (tmp > 1.0f)
         normalizeScale = 1.0f / std::min(tmp, 65536.0f);
     }
+    // used for the diffuse filter (roughness = 1.0)
+    calculateSphericalHarmonics(shCoefficients, t);
+    for (int i = 0; i < 9; i++)
+      shCoefficients[i] *= normalizeScale;
 
     int     mipCnt = int(std::bit_width(width));
     if (!outFmtFloat)
@@ -300,65 +513,34 @@ size_t SFCubeMapFilter::convertImage(
     }
     unsigned char *outBufP = buf + 148;
 
-    std::vector< FloatVector4 > importanceSampleBuf;
+    TablePtr  importanceSampleBuf;
     std::vector< FloatVector8 > cubeFilterTableBuf;
     cubeFilterTable = nullptr;
 
-    int     threadCnt = int(std::thread::hardware_concurrency());
-    threadCnt = std::min< int >(std::max< int >(threadCnt, 1), 16);
-    std::thread *threads[16];
-    for (int i = 0; i < 16; i++)
-      threads[i] = nullptr;
     int     w = int(width);
     for (int m = 0; w > 0; m++, w = w >> 1)
     {
+      if (cancelFlag && cancelFlag->load(std::memory_order_relaxed))
+        return 0;
       int     w2 = std::max< int >(w, filterMinWidth);
       float   roughness = 1.0f;
       if (m < roughnessTableSize)
         roughness = roughnessTable[m];
       bool    enableFilter = (roughness >= (3.0f / 128.0f));
+      // the diffuse filter does not use the importance sample and
+      // convolution tables
+      bool    needTables = (enableFilter && roughness < 1.0f);
       if (w >= filterMinWidth)
         cubeFilterTable = nullptr;
       importanceSampleTable = nullptr;
-      std::uint32_t importanceSampleLimit = std::uint32_t(m + 16 - mipCnt) << 1;
-#if ENABLE_X86_64_SIMD >= 4
-      importanceSampleLimit = 44739243U >> importanceSampleLimit;
-#elif ENABLE_X86_64_SIMD == 3
-      importanceSampleLimit = 50331648U >> importanceSampleLimit;
-#elif ENABLE_X86_64_SIMD == 2
-      importanceSampleLimit = 33554432U >> importanceSampleLimit;
-#else
-      importanceSampleLimit = 134217728U >> importanceSampleLimit;
-#endif
-      if (enableFilter && importanceSampleCnt < importanceSampleLimit)
+      if (needTables &&
+          importanceSampleCnt < getImportanceSampleLimit(m, mipCnt))
       {
-        int     n = int(importanceSampleCnt);
-        importanceSampleTable = &importanceSampleBuf;
-        importanceSampleBuf.clear();
-        importanceSampleBuf.reserve(size_t(n));
-        float   a = roughness * roughness;
-        float   a2 = a * a;
-        for (int i = 0; i < n; i++)
-        {
-          FloatVector4  h(SF_PBR_Tables::importanceSampleGGX(
-                              SF_PBR_Tables::Hammersley(i, n), a2));
-          float   nDotH = h[2];
-          FloatVector4  l(h * (nDotH * 2.0f)    // L = reflect(-N, H)
-                          - FloatVector4(0.0f, 0.0f, 1.0f, 0.0f));
-          if (!(l[2] > 0.0f))
-            continue;
-          // calculate mip level, based on formula from
-          // https://chetanjags.wordpress.com/2015/08/26/image-based-lighting/
-          float   d = nDotH * nDotH * (a2 - 1.0f) + 1.0f;
-          d = a2 / (d * d);
-          float   mipLevel =            // mip bias = +1.0
-              float(std::log2(float(t.getWidth()) * float(t.getWidth())
-                              / (float(n) * d))) * 0.5f + 2.29248125f;
-          l[3] = std::min(std::max(mipLevel, 0.0f), 16.0f);
-          importanceSampleBuf.push_back(l);
-        }
+        importanceSampleBuf =
+            getImportanceSampleTable(roughness, importanceSampleCnt);
+        importanceSampleTable = importanceSampleBuf.get();
       }
-      else if (enableFilter && !cubeFilterTable)
+      else if (needTables && !cubeFilterTable)
       {
         cubeFilterTableBuf.resize((size_t(w2) * size_t(w2) * 30) >> 3,
                                   FloatVector8(0.0f));
@@ -366,38 +548,22 @@ size_t SFCubeMapFilter::convertImage(
             reinterpret_cast< float * >(cubeFilterTableBuf.data());
         createFilterTable(w2);
       }
-      try
-      {
-        threadCnt = std::min< int >(threadCnt, std::max< int >(w >> 3, 1));
-        int     y0 = 0;
-        for (int i = 0; i < threadCnt; i++)
-        {
-          int     y1 = (w * 6 * (i + 1)) / threadCnt;
-          threads[i] = new std::thread(threadFunction, this, outBufP, w,
-                                       y0, y1, roughness, enableFilter);
-          y0 = y1;
-        }
-        for (int i = 0; i < threadCnt; i++)
-        {
-          threads[i]->join();
-          delete threads[i];
-          threads[i] = nullptr;
-        }
-      }
-      catch (...)
-      {
-        for (int i = 0; i < 16; i++)
-        {
-          if (threads[i])
+      // blocks of at least 256 pixels, the specular filter also requires
+      // an even number of pixels
+      ThreadPool::getDefaultPool().parallelFor(
+          0, w * 6, std::max< int >(256 / w, 1),
+          [&](int y0, int y1)
           {
-            threads[i]->join();
-            delete threads[i];
-          }
-        }
-        throw;
-      }
+            if (cancelFlag && cancelFlag->load(std::memory_order_relaxed))
+              return;
+            threadFunction(this, outBufP, w, y0, y1, roughness, enableFilter);
+          });
       outBufP = outBufP + (size_t(w * w) * sizeof(std::uint32_t));
     }
+    if (cancelFlag && cancelFlag->load(std::memory_order_relaxed))
+      return 0;
+    if (blockCompression)
+      newSize = compressOutput(buf, outFmtFloat);
     return newSize;
   }
   catch (FO76UtilsError&)
@@ -406,6 +572,33 @@ size_t SFCubeMapFilter::convertImage(
   return 0;
 }
 
+size_t SFCubeMapFilter::compressOutput(unsigned char *buf, bool outFmtFloat)
+{
+  unsigned char dxgiFmt = 0x5F;         // DXGI_FORMAT_BC6H_UF16
+  if (!outFmtFloat)                     // DXGI_FORMAT_BC1_UNORM_SRGB
+    dxgiFmt = (blockCompression == 1 ? 0x48 : 0x63);    // or BC7_UNORM_SRGB
+  // the compressed data is smaller, but it is written to the same buffer,
+  // so the input is copied first
+  std::vector< std::uint32_t >  tmpBuf((size_t(faceDataSize) * 6)
+                                       / sizeof(std::uint32_t));
+  std::memcpy(tmpBuf.data(), buf + 148, size_t(faceDataSize) * 6);
+  FileBuffer::writeDDSHeader(buf, dxgiFmt, int(width), int(width),
+                             int(std::bit_width(width)), true);
+  unsigned char *p = buf + 148;
+  for (int n = 0; n < 6; n++)
+  {
+    const std::uint32_t *src =
+        tmpBuf.data() + ((size_t(n) * faceDataSize) / sizeof(std::uint32_t));
+    for (int w = int(width); w > 0; w = w >> 1)
+    {
+      p = p + BCnEncoder::compressImage(p, src, w, w, size_t(w), dxgiFmt,
+                                        compressionQuality);
+      src = src + (size_t(w) * size_t(w));
+    }
+  }
+  return size_t(p - buf);
+}
+
 void SFCubeMapFilter::setRoughnessTable(const float *p, size_t n)
 {
   if (!p)
@@ -417,28 +610,77 @@ void SFCubeMapFilter::setRoughnessTable(const float *p, size_t n)
   roughnessTableSize = int(n);
 }
 
+void SFCubeMapFilter::precomputeTables(
+    size_t outputWidth, const float *roughnessTable, size_t roughnessTableSize,
+    std::int32_t importanceSampleCnt)
+{
+  SFCubeMapFilter f(outputWidth);
+  f.setRoughnessTable(roughnessTable, roughnessTableSize);
+  int     mipCnt = int(std::bit_width(f.width));
+  int     w = int(f.width);
+  for (int m = 0; w > 0; m++, w = w >> 1)
+  {
+    float   roughness = 1.0f;
+    if (m < f.roughnessTableSize)
+      roughness = f.roughnessTable[m];
+    if (!(roughness >= (3.0f / 128.0f) && roughness < 1.0f))
+      continue;
+    if (std::uint32_t(importanceSampleCnt)
+        < getImportanceSampleLimit(m, mipCnt))
+    {
+      (void) getImportanceSampleTable(roughness,
+                                      std::uint32_t(importanceSampleCnt));
+    }
+    else
+    {
+      (void) getDirectionTable(std::max< int >(w, filterMinWidth));
+    }
+  }
+}
+
+void SFCubeMapFilter::clearTableCache()
+{
+  std::unique_lock< std::mutex >  lock(tableCacheMutex);
+  tableCache.clear();
+}
+
 SFCubeMapCache::SFCubeMapCache()
-  : SFCubeMapFilter(256)
+  : SFCubeMapFilter(256),
+    backgroundPool(std::max< int >(
+                       int(std::thread::hardware_concurrency() >> 1), 1)),
+    diskCacheMaxBytes(0)
 {
 }
 
 SFCubeMapCache::~SFCubeMapCache()
 {
+  cancelProgressive();
 }
 
-size_t SFCubeMapCache::convertImage(
-    unsigned char *buf, size_t bufSize, bool outFmtFloat, size_t bufCapacity,
-    int hdrToneMap)
+std::uint64_t SFCubeMapCache::calculateHash(
+    const unsigned char *buf, size_t bufSize, bool outFmtFloat,
+    int hdrToneMap) const
 {
-  bool    isHDR = (bufSize >= 11 &&                     // "#?RADIAN"
-                   FileBuffer::readUInt64Fast(buf) == 0x4E41494441523F23ULL);
   std::uint32_t h1 = width | (importanceSampleCnt << 17);
-  if (isHDR)
+  h1 = h1 | (std::uint32_t(hdrToneMap) << 12);
+  std::uint32_t h2 = std::uint32_t(outFmtFloat);
+  if (blockCompression)
   {
-    hdrToneMap = std::min< int >(std::max< int >(hdrToneMap, 0), 16);
-    h1 = h1 | (std::uint32_t(hdrToneMap) << 12);
+    h2 = h2 | (std::uint32_t(blockCompression) << 1)
+         | (std::uint32_t(compressionQuality) << 3);
+  }
+  h2 = ~h1 ^ h2;
+  // other settings that change the output
+  hashFunctionCRC32C< std::uint32_t >(h1, std::uint32_t(inputMipOffset));
+  hashFunctionCRC32C< std::uint32_t >(
+      h2, std::bit_cast< std::uint32_t >(normalizeLevel));
+  hashFunctionCRC32C< std::uint32_t >(h1, std::uint32_t(roughnessTableSize));
+  for (int j = 0; j < roughnessTableSize; j++)
+  {
+    std::uint32_t&  h = (!(j & 1) ? h2 : h1);
+    hashFunctionCRC32C< std::uint32_t >(
+        h, std::bit_cast< std::uint32_t >(roughnessTable[j]));
   }
-  std::uint32_t h2 = ~h1;
   size_t  i = 0;
   for ( ; (i + 16) <= bufSize; i = i + 16)
   {
@@ -452,59 +694,411 @@ size_t SFCubeMapCache::convertImage(
     std::uint32_t&  h = (!(i & 8) ? h1 : h2);
     hashFunctionCRC32C< unsigned char >(h, buf[i]);
   }
-  std::uint64_t k = (std::uint64_t(h2) << 32) | h1;
-  std::vector< unsigned char >& v = cachedTextures[k];
-  if (v.size() > 0)
+  return ((std::uint64_t(h2) << 32) | h1);
+}
+
+std::string SFCubeMapCache::getDiskCacheFileName(std::uint64_t k) const
+{
+  std::string fileName(diskCachePath);
+  // the version number in the prefix should be incremented if changes to
+  // the filtering invalidate previously stored images
+  printToString(fileName, "sfcube2_%016llX.dds", (unsigned long long) k);
+  return fileName;
+}
+
+SFCubeMapCache::CachedImage SFCubeMapCache::loadFromDiskCache(
+    std::uint64_t k) const
+{
+  if (diskCachePath.empty())
+    return CachedImage();
+  std::string fileName(getDiskCacheFileName(k));
+  try
+  {
+    FileBuffer  f(fileName.c_str());
+    if (f.size() > 148 &&
+        FileBuffer::readUInt32Fast(f.data()) == 0x20534444U)    // "DDS "
+    {
+      CachedImage p(std::make_shared< const std::vector< unsigned char > >(
+                        f.data(), f.data() + f.size()));
+      // update the modification time for least recently used eviction
+#if defined(_WIN32) || defined(_WIN64)
+      (void) _utime(fileName.c_str(), nullptr);
+#else
+      (void) utime(fileName.c_str(), nullptr);
+#endif
+      return p;
+    }
+  }
+  catch (FO76UtilsError&)
+  {
+  }
+  return CachedImage();
+}
+
+void SFCubeMapCache::storeInDiskCache(
+    std::uint64_t k, const std::vector< unsigned char >& v)
+{
+  if (diskCachePath.empty())
+    return;
+  std::string fileName(getDiskCacheFileName(k));
+  // errors are ignored, the image is just not cached
+  if (!OutputFile::writeFileAtomic(fileName.c_str(), v.data(), v.size()))
+    return;
+  pruneDiskCache(fileName);
+}
+
+void SFCubeMapCache::pruneDiskCache(const std::string& keepFileName)
+{
+  if (diskCachePath.empty())
+    return;
+  std::set< DiskCacheFile > fileList;
+  std::uint64_t totalSize = 0;
+  DiskCacheFile f;
+  // temporary files more than an hour old were left by a writer that did not
+  // finish, these are deleted regardless of the size of the cache
+  std::vector< std::string >  staleFiles;
+  std::int64_t  staleTime = std::int64_t(std::time(nullptr)) - 3600;
+#if defined(_WIN32) || defined(_WIN64)
+  std::string tmpName(diskCachePath);
+  tmpName += "sfcube*";
+  __finddata64_t  e;
+  std::intptr_t   d = _findfirst64(tmpName.c_str(), &e);
+  if (d < 0)
+    return;
+  try
+  {
+    do
+    {
+      std::string_view  baseName(e.name);
+      bool    isTmpFile = baseName.ends_with(".tmp");
+      if ((e.attrib & _A_SUBDIR) || !(isTmpFile || baseName.ends_with(".dds")))
+        continue;
+      f.modTime = std::int64_t(e.time_write);
+      f.fileSize = std::uint64_t(e.size);
+      f.fileName = diskCachePath;
+      f.fileName += baseName;
+      if (isTmpFile)
+      {
+        if (f.modTime < staleTime)
+          staleFiles.push_back(f.fileName);
+        continue;
+      }
+      totalSize = totalSize + f.fileSize;
+      fileList.insert(f);
+    }
+    while (_findnext64(d, &e) >= 0);
+  }
+  catch (...)
+  {
+    _findclose(d);
+    throw;
+  }
+  _findclose(d);
+#else
+  DIR     *d = opendir(diskCachePath.c_str());
+  if (!d)
+    return;
+  try
+  {
+    struct dirent *e;
+    while (bool(e = readdir(d)))
+    {
+      std::string_view  baseName(e->d_name);
+      bool    isTmpFile = baseName.ends_with(".tmp");
+      if (!(baseName.starts_with("sfcube") &&
+            (isTmpFile || baseName.ends_with(".dds"))))
+      {
+        continue;
+      }
+      f.fileName = diskCachePath;
+      f.fileName += baseName;
+      struct stat st;
+      if (stat(f.fileName.c_str(), &st) != 0 ||
+          (st.st_mode & S_IFMT) != S_IFREG)
+      {
+        continue;
+      }
+      f.modTime = std::int64_t(st.st_mtime);
+      f.fileSize = std::uint64_t(st.st_size);
+      if (isTmpFile)
+      {
+        if (f.modTime < staleTime)
+          staleFiles.push_back(f.fileName);
+        continue;
+      }
+      totalSize = totalSize + f.fileSize;
+      fileList.insert(f);
+    }
+  }
+  catch (...)
+  {
+    closedir(d);
+    throw;
+  }
+  closedir(d);
+#endif
+  for (size_t i = 0; i < staleFiles.size(); i++)
+    (void) std::remove(staleFiles[i].c_str());
+  for (std::set< DiskCacheFile >::const_iterator i = fileList.begin();
+       i != fileList.end() && totalSize > diskCacheMaxBytes; i++)
+  {
+    if (i->fileName == keepFileName)
+      continue;
+    if (std::remove(i->fileName.c_str()) == 0)
+      totalSize = totalSize - i->fileSize;
+  }
+}
+
+SFCubeMapCache::CachedImage SFCubeMapCache::findCachedImage(std::uint64_t k)
+{
+  {
+    std::unique_lock< std::mutex >  lock(cacheMutex);
+    std::map< std::uint64_t, CachedImage >::const_iterator  i =
+        cachedTextures.find(k);
+    if (i != cachedTextures.end())
+      return i->second;
+  }
+  CachedImage v(loadFromDiskCache(k));
+  if (v)
+  {
+    std::unique_lock< std::mutex >  lock(cacheMutex);
+    cachedTextures[k] = v;
+  }
+  return v;
+}
+
+void SFCubeMapCache::storeCachedImage(std::uint64_t k, const CachedImage& v)
+{
   {
-    std::memcpy(buf, v.data(), v.size());
-    return v.size();
+    std::unique_lock< std::mutex >  lock(cacheMutex);
+    cachedTextures[k] = v;
   }
+  storeInDiskCache(k, *v);
+}
+
+SFCubeMapCache::CachedImage SFCubeMapCache::filterImage(
+    SFCubeMapFilter& f, const unsigned char *buf, size_t bufSize,
+    bool outFmtFloat, int hdrToneMap, int hdrCubeWidth,
+    const std::atomic< bool > *cancelFlag)
+{
+  bool    isHDR = (bufSize >= 11 &&                     // "#?RADIAN"
+                   FileBuffer::readUInt64Fast(buf) == 0x4E41494441523F23ULL);
+  std::vector< unsigned char >  tmpBuf;
   size_t  newSize = 0;
+  size_t  w = f.getOutputWidth();
+  f.setCancelFlag(cancelFlag);
   if (!isHDR)
   {
-    newSize =
-        SFCubeMapFilter::convertImage(buf, bufSize, outFmtFloat, bufCapacity);
+    // the filter works in place, and needs a buffer with enough capacity
+    // for the output
+    tmpBuf.resize(std::max(bufSize, w * w * 8 * 4 + 148));
+    std::memcpy(tmpBuf.data(), buf, bufSize);
+    newSize = f.convertImage(tmpBuf.data(), bufSize, outFmtFloat,
+                             tmpBuf.size());
   }
   else
   {
-    std::vector< unsigned char >  tmpBuf;
     float   maxLevel = float(hdrToneMap > 0 ? (-65536 >> hdrToneMap) : 65504);
-    if (convertHDRToDDS(tmpBuf, buf, bufSize, 2048, false, maxLevel, 0x0A))
+    if (convertHDRToDDS(tmpBuf, buf, bufSize, hdrCubeWidth, false, maxLevel,
+                        0x0A, cancelFlag))
     {
-      newSize = SFCubeMapFilter::convertImage(tmpBuf.data(), tmpBuf.size(),
-                                              outFmtFloat, tmpBuf.size());
-      if (newSize && newSize <= std::max(bufSize, bufCapacity))
-        std::memcpy(buf, tmpBuf.data(), newSize);
-      else
-        newSize = 0;
+      newSize = f.convertImage(tmpBuf.data(), tmpBuf.size(), outFmtFloat,
+                               tmpBuf.size());
     }
   }
-  if (newSize)
+  f.setCancelFlag(nullptr);
+  if (!newSize)
+    return CachedImage();
+  tmpBuf.resize(newSize);
+  tmpBuf.shrink_to_fit();
+  return std::make_shared< const std::vector< unsigned char > >(
+             std::move(tmpBuf));
+}
+
+SFCubeMapCache::CachedImage SFCubeMapCache::getFilteredImage(
+    const unsigned char *buf, size_t bufSize, bool outFmtFloat,
+    int hdrToneMap)
+{
+  bool    isHDR = (bufSize >= 11 &&                     // "#?RADIAN"
+                   FileBuffer::readUInt64Fast(buf) == 0x4E41494441523F23ULL);
+  if (!isHDR)
+    hdrToneMap = 0;
+  else
+    hdrToneMap = std::min< int >(std::max< int >(hdrToneMap, 0), 16);
+  std::uint64_t k = calculateHash(buf, bufSize, outFmtFloat, hdrToneMap);
+  CachedImage v(findCachedImage(k));
+  if (v)
+    return v;
+  v = filterImage(*this, buf, bufSize, outFmtFloat, hdrToneMap, 2048,
+                  nullptr);
+  if (v)
+    storeCachedImage(k, v);
+  return v;
+}
+
+void SFCubeMapCache::progressiveThreadFunction(
+    SFCubeMapCache *p, ProgressiveJob *job, SFCubeMapFilter f,
+    std::vector< unsigned char > buf, std::uint64_t k, bool outFmtFloat,
+    int hdrToneMap, ProgressiveCallback callback, void *callbackData)
+{
+  CachedImage v;
+  ThreadPool  *prvPool = ThreadPool::setThreadDefaultPool(&(p->backgroundPool));
+  try
   {
-    v.resize(newSize);
-    std::memcpy(v.data(), buf, newSize);
-    return newSize;
+    v = filterImage(f, buf.data(), buf.size(), outFmtFloat, hdrToneMap, 2048,
+                    &(job->cancelFlag));
+    if (v)
+      p->storeCachedImage(k, v);
   }
-  return bufSize;
+  catch (std::exception&)
+  {
+    v.reset();
+  }
+  (void) ThreadPool::setThreadDefaultPool(prvPool);
+  if (callback)
+    callback(callbackData, v);
+  job->doneFlag.store(true);
 }
 
-static inline float atan2NormFast(float y, float x, bool xNonNegative = false)
+SFCubeMapCache::CachedImage SFCubeMapCache::getFilteredImageProgressive(
+    const unsigned char *buf, size_t bufSize,
+    ProgressiveCallback callback, void *callbackData,
+    bool outFmtFloat, int hdrToneMap, size_t previewWidth,
+    int previewSampleCnt)
+{
+  cancelProgressiveJobs(false);
+  bool    isHDR = (bufSize >= 11 &&                     // "#?RADIAN"
+                   FileBuffer::readUInt64Fast(buf) == 0x4E41494441523F23ULL);
+  if (!isHDR)
+    hdrToneMap = 0;
+  else
+    hdrToneMap = std::min< int >(std::max< int >(hdrToneMap, 0), 16);
+  std::uint64_t k = calculateHash(buf, bufSize, outFmtFloat, hdrToneMap);
+  CachedImage v(findCachedImage(k));
+  if (v)
+    return v;
+  previewWidth = std::bit_floor(std::min< size_t >(previewWidth, width));
+  previewWidth = std::max< size_t >(previewWidth, minWidth);
+  SFCubeMapFilter preview(*this);
+  preview.setOutputWidth(previewWidth);
+  preview.setImportanceSamplingQuality(previewSampleCnt);
+  // the preview is filtered from an input of about 4 times its resolution
+  int     inputWidth = int(std::max< size_t >(previewWidth * 4, minWidth));
+  if (!isHDR && bufSize >= 148 &&
+      FileBuffer::readUInt32Fast(buf) == 0x20534444U)           // "DDS "
+  {
+    int     w = int(FileBuffer::readUInt32Fast(buf + 16));
+    int     mipCnt = int(FileBuffer::readUInt32Fast(buf + 28));
+    int     n = 0;
+    while ((n + 1) < mipCnt && (w >> (n + 1)) >= inputWidth)
+      n++;
+    if (n > 0)
+      preview.setInputMipOffset(n);
+  }
+  v = filterImage(preview, buf, bufSize, outFmtFloat, hdrToneMap, inputWidth,
+                  nullptr);
+  if (!v)
+    return v;
+  progressiveJobs.push_back(new ProgressiveJob);
+  ProgressiveJob  *job = progressiveJobs.back();
+  job->thread = nullptr;
+  job->cancelFlag.store(false);
+  job->doneFlag.store(false);
+  job->roughnessTable.assign(roughnessTable,
+                             roughnessTable + roughnessTableSize);
+  SFCubeMapFilter f(*this);
+  f.setRoughnessTable(job->roughnessTable.data(), job->roughnessTable.size());
+  try
+  {
+    job->thread =
+        new std::thread(progressiveThreadFunction, this, job, f,
+                        std::vector< unsigned char >(buf, buf + bufSize),
+                        k, outFmtFloat, hdrToneMap, callback, callbackData);
+  }
+  catch (std::system_error&)
+  {
+    // could not start thread, filter at full quality before returning
+    progressiveThreadFunction(this, job, f,
+                              std::vector< unsigned char >(buf, buf + bufSize),
+                              k, outFmtFloat, hdrToneMap,
+                              callback, callbackData);
+  }
+  return v;
+}
+
+void SFCubeMapCache::cancelProgressiveJobs(bool waitForAll)
+{
+  size_t  n = 0;
+  for (size_t i = 0; i < progressiveJobs.size(); i++)
+  {
+    ProgressiveJob  *job = progressiveJobs[i];
+    job->cancelFlag.store(true);
+    if (!(waitForAll || job->doneFlag.load()))
+    {
+      progressiveJobs[n++] = job;
+      continue;
+    }
+    if (job->thread)
+    {
+      job->thread->join();
+      delete job->thread;
+    }
+    delete job;
+  }
+  progressiveJobs.resize(n);
+}
+
+void SFCubeMapCache::cancelProgressive()
+{
+  cancelProgressiveJobs(true);
+}
+
+size_t SFCubeMapCache::convertImage(
+    unsigned char *buf, size_t bufSize, bool outFmtFloat, size_t bufCapacity,
+    int hdrToneMap)
+{
+  CachedImage v(getFilteredImage(buf, bufSize, outFmtFloat, hdrToneMap));
+  if (!v || v->size() > std::max(bufSize, bufCapacity))
+    return bufSize;
+  std::memcpy(buf, v->data(), v->size());
+  return v->size();
+}
+
+static inline FloatVector8 atan2NormFast(FloatVector8 y, FloatVector8 x,
+                                        bool xNonNegative = false)
 {
   // assumes x² + y² = 1.0, returns atan2(y, x) / π
-  float   xAbs = (xNonNegative ? x : float(std::fabs(x)));
-  float   yAbs = float(std::fabs(y));
-  float   tmp = std::min(xAbs, yAbs);
-  float   tmp2 = tmp * tmp;
-  float   tmp3 = tmp2 * tmp;
-  tmp = (((0.39603792f * tmp3) + (-0.98507216f * tmp2) + (1.09851059f * tmp)
+  FloatVector8  xAbs(x);
+  FloatVector8  yAbs(y);
+  if (!xNonNegative)
+    xAbs.maxValues(x * -1.0f);
+  yAbs.maxValues(y * -1.0f);
+  FloatVector8  tmp(xAbs);
+  tmp.minValues(yAbs);
+  FloatVector8  tmp2(tmp * tmp);
+  FloatVector8  tmp3(tmp2 * tmp);
+  tmp = (((tmp3 * 0.39603792f) + (tmp2 * -0.98507216f) + (tmp * 1.09851059f)
           - 0.65754361f) * tmp3
-         + (0.26000725f * tmp2) + (-0.05051132f * tmp) + 0.05919720f) * tmp3
-        + (-0.00037558f * tmp2) + (0.31831810f * tmp);
-  if (xAbs < yAbs)
-    tmp = 0.5f - tmp;
-  if (!xNonNegative && x < 0.0f)
-    tmp = 1.0f - tmp;
-  return (y < 0.0f ? -tmp : tmp);
+         + (tmp2 * 0.26000725f) + (tmp * -0.05051132f) + 0.05919720f) * tmp3
+        + (tmp2 * -0.00037558f) + (tmp * 0.31831810f);
+  // bit N of the masks is set if the condition is true for element N
+  std::uint32_t swapMask = (xAbs - yAbs).getSignMask();
+  std::uint32_t xSignMask = (xNonNegative ? 0U : x.getSignMask());
+  std::uint32_t ySignMask = y.getSignMask();
+  if (!(swapMask | xSignMask | ySignMask))
+    return tmp;
+  float   v[8];
+  tmp.convertToFloats(v);
+  for (int i = 0; i < 8; i++)
+  {
+    if (swapMask & (1U << i))
+      v[i] = 0.5f - v[i];
+    if (xSignMask & (1U << i))
+      v[i] = 1.0f - v[i];
+    if (ySignMask & (1U << i))
+      v[i] = -(v[i]);
+  }
+  return FloatVector8(v);
 }
 
 void SFCubeMapCache::convertHDRToDDSThread(
@@ -514,54 +1108,237 @@ void SFCubeMapCache::convertHDRToDDSThread(
 {
   unsigned char *p =
       outBuf + (size_t(yStart) * size_t(cubeWidth) * outPixelSize);
+  const FloatVector8  xOffsets(0.0f, 2.0f, 4.0f, 6.0f,
+                               8.0f, 10.0f, 12.0f, 14.0f);
   for ( ; yStart < yEnd; yStart++)
   {
     int     n = yStart / cubeWidth;
     int     y = yStart % cubeWidth;
-    for (int x = 0; x < cubeWidth; x++, p = p + outPixelSize)
+    for (int x = 0; x < cubeWidth; x = x + 8)
     {
-      FloatVector4  v(SFCubeMapFilter::convertCoord(x, y, cubeWidth, n));
+      // direction vectors of 8 texels, not normalized, with the same face
+      // layout as SFCubeMapFilter::convertCoord():
+      //   a = w - (x * 2 + 1), b = w - (y * 2 + 1)
+      FloatVector8  a(FloatVector8(float(cubeWidth - (x * 2 + 1))) - xOffsets);
+      FloatVector8  b = FloatVector8(float(cubeWidth - (y * 2 + 1)));
+      FloatVector8  d = FloatVector8(float(cubeWidth));
+      FloatVector8  vx(a * -1.0f);
+      FloatVector8  vy(b);
+      FloatVector8  vz(d);
+      switch (n)
+      {
+        case 0:
+          vx = d;
+          vz = a;
+          break;
+        case 1:
+          vx = d * -1.0f;
+          vz = a * -1.0f;
+          break;
+        case 2:
+          vy = d;
+          vz = b * -1.0f;
+          break;
+        case 3:
+          vy = d * -1.0f;
+          vz = b;
+          break;
+        case 4:
+          break;
+        default:
+          vx = a;
+          vz = d * -1.0f;
+          break;
+      }
       // convert to spherical coordinates
-      float   xy = float(std::sqrt(v.dotProduct2(v)));
-      float   z = v[2];
-      v /= xy;
-      float   xf = atan2NormFast(v[0], v[1]) * 0.5f + 0.5f;
-      float   yf = atan2NormFast(z, xy, true) + 0.5f;
-      xf = xf * float(w) - 0.5f;
-      yf = yf * float(h) - 0.5f;
-      float   xi = float(std::floor(xf));
-      float   yi = float(std::floor(yf));
-      xf -= xi;
-      yf -= yi;
-      int     x0 = int(xi);
-      int     y0 = int(yi);
-      x0 = (x0 <= (w - 1) ? (x0 >= 0 ? x0 : (w - 1)) : 0);
-      int     x1 = (x0 < (w - 1) ? (x0 + 1) : 0);
-      int     y1 = std::min< int >(std::max< int >(y0 + 1, 0), h - 1);
-      y0 = std::min< int >(std::max< int >(y0, 0), h - 1);
-      // bilinear interpolation
-      const FloatVector4  *inPtr = hdrTexture + (y0 * w);
-      FloatVector4  c(inPtr[x0] * (1.0f - xf) + (inPtr[x1] * xf));
-      inPtr = inPtr + (y1 > y0 ? w : 0);
-      c = c + (((inPtr[x0] * (1.0f - xf) + (inPtr[x1] * xf)) - c) * yf);
-      c.maxValues(FloatVector4(0.0f));
-      if (maxLevel < 0.0f)
-        c = c * FloatVector4(maxLevel) / (FloatVector4(maxLevel) - c);
+      FloatVector8  xy2((vx * vx) + (vy * vy));
+      FloatVector8  xy(xy2);
+      xy.squareRoot();
+      FloatVector8  r(xy2 + (vz * vz));
+      r.squareRoot();
+      FloatVector8  xc(atan2NormFast(vx / xy, vy / xy) * 0.5f + 0.5f);
+      FloatVector8  yc(atan2NormFast(vz / r, xy / r, true) + 0.5f);
+      xc = xc * float(w) - 0.5f;
+      yc = yc * float(h) - 0.5f;
+      FloatVector8  xi(xc);
+      FloatVector8  yi(yc);
+      xi.floorValues();
+      yi.floorValues();
+      std::int32_t  x0v[8], y0v[8];
+      float   xfv[8], yfv[8];
+      xi.convertToInt32(x0v);
+      yi.convertToInt32(y0v);
+      (xc - xi).convertToFloats(xfv);
+      (yc - yi).convertToFloats(yfv);
+      int     l = std::min< int >(cubeWidth - x, 8);
+      for (int i = 0; i < l; i++, p = p + outPixelSize)
+      {
+        float   xf = xfv[i];
+        float   yf = yfv[i];
+        int     x0 = x0v[i];
+        int     y0 = y0v[i];
+        x0 = (x0 <= (w - 1) ? (x0 >= 0 ? x0 : (w - 1)) : 0);
+        int     x1 = (x0 < (w - 1) ? (x0 + 1) : 0);
+        int     y1 = std::min< int >(std::max< int >(y0 + 1, 0), h - 1);
+        y0 = std::min< int >(std::max< int >(y0, 0), h - 1);
+        // bilinear interpolation
+        const FloatVector4  *inPtr = hdrTexture + (size_t(y0) * size_t(w));
+        FloatVector4  c(inPtr[x0] * (1.0f - xf) + (inPtr[x1] * xf));
+        inPtr = inPtr + (y1 > y0 ? w : 0);
+        c = c + (((inPtr[x0] * (1.0f - xf) + (inPtr[x1] * xf)) - c) * yf);
+        c.maxValues(FloatVector4(0.0f));
+        if (maxLevel < 0.0f)
+          c = c * FloatVector4(maxLevel) / (FloatVector4(maxLevel) - c);
+        else
+          c.minValues(FloatVector4(maxLevel));
+        c[3] = 1.0f;
+        if (outPixelSize == sizeof(std::uint64_t))
+          FileBuffer::writeUInt64Fast(p, c.convertToFloat16());
+        else
+          FileBuffer::writeUInt32Fast(p, c.convertToR9G9B9E5());
+      }
+    }
+  }
+}
+
+// Decode a scanline of a Radiance HDR image starting at offset pos of buf,
+// and store the pixels in RGBE format in p, or only find the end of the line
+// if p is nullptr. On success, pos is set to the start of the next scanline.
+static bool decodeHDRScanline(std::uint32_t *p, const unsigned char *buf,
+                              size_t bufSize, size_t& pos, int w)
+{
+  if ((pos + 4) > bufSize)
+    return false;
+  std::uint32_t tmp = FileBuffer::readUInt32Fast(buf + pos);
+  if (tmp != ((std::uint32_t(w & 0xFF) << 24) | (std::uint32_t(w >> 8) << 16)
+              | 0x0202U))
+  {
+    // old RLE format
+    unsigned char lenShift = 0;
+    for (int x = 0; x < w; )
+    {
+      if ((pos + 4) > bufSize)
+        return false;
+      std::uint32_t c = FileBuffer::readUInt32Fast(buf + pos);
+      pos = pos + 4;
+      if ((c & 0x00FFFFFFU) != 0x00010101U || x < 1)
+      {
+        lenShift = 0;
+        if (p)
+          p[x] = c;
+        x++;
+      }
       else
-        c.minValues(FloatVector4(maxLevel));
-      c[3] = 1.0f;
-      if (outPixelSize == sizeof(std::uint64_t))
-        FileBuffer::writeUInt64Fast(p, c.convertToFloat16());
+      {
+        size_t  l = (c >> 24) << lenShift;
+        lenShift = 8;
+        if (l > size_t(w - x))
+          return false;
+        if (!p)
+        {
+          x = x + int(l);
+          continue;
+        }
+        for ( ; l; l--, x++)
+          p[x] = p[x - 1];
+      }
+    }
+    return true;
+  }
+  // new RLE format
+  pos = pos + 4;
+  if (p)
+    std::memset(p, 0, size_t(w) * sizeof(std::uint32_t));
+  for (unsigned char c = 0; c < 32; c = c + 8)
+  {
+    for (int x = 0; x < w; )
+    {
+      if (pos >= bufSize)
+        return false;
+      size_t  l = buf[pos];
+      pos++;
+      if (l <= 0x80)
+      {
+        // copy literals
+        if (l > size_t(w - x) || l > (bufSize - pos))
+          return false;
+        if (p)
+        {
+          for (size_t i = 0; i < l; i++)
+            p[x + int(i)] |= (std::uint32_t(buf[pos + i]) << c);
+        }
+        pos = pos + l;
+        x = x + int(l);
+      }
       else
-        FileBuffer::writeUInt32Fast(p, c.convertToR9G9B9E5());
+      {
+        // RLE
+        l = l - 0x80;
+        if (pos >= bufSize || l > size_t(w - x))
+          return false;
+        std::uint32_t b = std::uint32_t(buf[pos]) << c;
+        pos++;
+        if (p)
+        {
+          for (size_t i = 0; i < l; i++)
+            p[x + int(i)] |= b;
+        }
+        x = x + int(l);
+      }
     }
   }
+  return true;
+}
+
+static inline float convertRGBEScale(std::uint32_t b)
+{
+  int     e = int(b >> 24);
+#if defined(__i386__) || defined(__x86_64__) || defined(__x86_64)
+  e = std::min< int >(std::max< int >(e, 16), 240) - 9;
+  return std::bit_cast< float >(std::uint32_t(e << 23));
+#else
+  e = std::min< int >(std::max< int >(e, 103), 165) - 103;
+  return float(std::int64_t(1) << e) * float(0.5 / (65536.0 * 65536.0));
+#endif
+}
+
+// convert a line of RGBE pixels to floats, 2 pixels at a time
+static void convertRGBELine(FloatVector4 *dst, const std::uint32_t *src, int w)
+{
+  int     x = 0;
+  for ( ; (x + 2) <= w; x = x + 2)
+  {
+    std::uint64_t tmp = (std::uint64_t(src[x + 1]) << 32) | src[x];
+    FloatVector8  c(&tmp);
+    float   s0 = convertRGBEScale(src[x]);
+    float   s1 = convertRGBEScale(src[x + 1]);
+    c *= FloatVector8(s0, s0, s0, s0, s1, s1, s1, s1);
+    c.blendValues(FloatVector8(1.0f), 0x88);
+    c.convertToFloatVector4(dst + x);
+  }
+  if (x < w)
+  {
+    FloatVector4  c(src[x]);
+    c *= convertRGBEScale(src[x]);
+    c[3] = 1.0f;
+    dst[x] = c;
+  }
 }
 
 bool SFCubeMapCache::convertHDRToDDS(
     std::vector< unsigned char >& outBuf,
     const unsigned char *inBufData, size_t inBufSize,
     int cubeWidth, bool invertCoord, float maxLevel, unsigned char outFmt)
+{
+  return convertHDRToDDS(outBuf, inBufData, inBufSize, cubeWidth, invertCoord,
+                         maxLevel, outFmt, nullptr);
+}
+
+bool SFCubeMapCache::convertHDRToDDS(
+    std::vector< unsigned char >& outBuf,
+    const unsigned char *inBufData, size_t inBufSize,
+    int cubeWidth, bool invertCoord, float maxLevel, unsigned char outFmt,
+    const std::atomic< bool > *cancelFlag)
 {
   // file should begin with "#?RADIANCE\n"
   if (inBufSize < 11 ||
@@ -615,98 +1392,32 @@ bool SFCubeMapCache::convertHDRToDDS(
   }
   if (!w || !h)
     return false;
-  std::vector< std::uint32_t >  tmpBuf(size_t(w * h), 0U);
+  // find the start of each scanline, so that they can be decoded in parallel
+  std::vector< size_t > lineOffsets(size_t(h), 0);
+  size_t  pos = inBuf.getPosition();
   for (int y = 0; y < h; y++)
   {
-    if ((inBuf.getPosition() + 4ULL) > inBuf.size())
+    lineOffsets[y] = pos;
+    if (!decodeHDRScanline(nullptr, inBufData, inBufSize, pos, w))
       return false;
-    std::uint32_t *p =
-        tmpBuf.data() + size_t((invertCoord ? y : ((h - 1) - y)) * w);
-    std::uint32_t tmp =
-        FileBuffer::readUInt32Fast(inBuf.data() + inBuf.getPosition());
-    if (tmp != ((std::uint32_t(w & 0xFF) << 24) | (std::uint32_t(w >> 8) << 16)
-                | 0x0202U))
-    {
-      // old RLE format
-      unsigned char lenShift = 0;
-      for (int x = 0; x < w; )
-      {
-        if ((inBuf.getPosition() + 4ULL) > inBuf.size())
-          return false;
-        std::uint32_t c = inBuf.readUInt32Fast();
-        if ((c & 0x00FFFFFFU) != 0x00010101U || x < 1)
-        {
-          lenShift = 0;
-          p[x] = c;
-          x++;
-        }
-        else
-        {
-          size_t  l = (c >> 24) << lenShift;
-          lenShift = 8;
-          for ( ; l; l--, x++)
-          {
-            if (x >= w)
-              return false;
-            p[x] = p[x - 1];
-          }
-        }
-      }
-    }
-    else
-    {
-      // new RLE format
-      inBuf.setPosition(inBuf.getPosition() + 4);
-      for (unsigned char c = 0; c < 32; c = c + 8)
+  }
+  std::vector< FloatVector4 > tmpBuf2(size_t(w) * size_t(h));
+  ThreadPool::getDefaultPool().parallelFor(
+      0, h, 16,
+      [&](int y0, int y1)
       {
-        for (int x = 0; x < w; )
+        std::vector< std::uint32_t >  lineData;
+        lineData.resize(size_t(w));
+        for (int y = y0; y < y1; y++)
         {
-          if (inBuf.getPosition() >= inBuf.size())
-            return false;
-          unsigned char l = inBuf.readUInt8Fast();
-          if (l <= 0x80)
-          {
-            // copy literals
-            for ( ; l; l--, x++)
-            {
-              if (x >= w || inBuf.getPosition() >= inBuf.size())
-                return false;
-              p[x] |= (std::uint32_t(inBuf.readUInt8Fast()) << c);
-            }
-          }
-          else
-          {
-            // RLE
-            if (inBuf.getPosition() >= inBuf.size())
-              return false;
-            std::uint32_t b = std::uint32_t(inBuf.readUInt8Fast()) << c;
-            for ( ; l > 0x80; l--, x++)
-            {
-              if (x >= w)
-                return false;
-              p[x] |= b;
-            }
-          }
+          size_t  offs = lineOffsets[y];
+          (void) decodeHDRScanline(lineData.data(), inBufData, inBufSize,
+                                   offs, w);
+          int     yc = (invertCoord ? y : ((h - 1) - y));
+          convertRGBELine(tmpBuf2.data() + (size_t(yc) * size_t(w)),
+                          lineData.data(), w);
         }
-      }
-    }
-  }
-  std::vector< FloatVector4 > tmpBuf2(tmpBuf.size(), FloatVector4(0.0f));
-  for (size_t i = 0; i < tmpBuf.size(); i++)
-  {
-    std::uint32_t b = tmpBuf[i];
-    FloatVector4  c(b);
-    int     e = int(b >> 24);
-#if defined(__i386__) || defined(__x86_64__) || defined(__x86_64)
-    e = std::min< int >(std::max< int >(e, 16), 240) - 9;
-    c *= std::bit_cast< float >(std::uint32_t(e << 23));
-#else
-    e = std::min< int >(std::max< int >(e, 103), 165) - 103;
-    c *= float(std::int64_t(1) << e) * float(0.5 / (65536.0 * 65536.0));
-#endif
-    c[3] = 1.0f;
-    tmpBuf2[i] = c;
-  }
+      });
   size_t  outPixelSize =        // 8 bytes for DXGI_FORMAT_R16G16B16A16_FLOAT
       (outFmt == 0x0A ? sizeof(std::uint64_t) : sizeof(std::uint32_t));
   outBuf.resize(size_t(cubeWidth * cubeWidth) * 6 * outPixelSize + 148, 0);
@@ -714,47 +1425,48 @@ bool SFCubeMapCache::convertHDRToDDS(
   (void) FileBuffer::writeDDSHeader(p, outFmt, cubeWidth, cubeWidth, 1, true);
   p = p + 148;
 
-  int     threadCnt = int(std::thread::hardware_concurrency());
-  threadCnt = std::min< int >(threadCnt, std::min< int >(cubeWidth >> 3, 16));
-  threadCnt = std::max< int >(threadCnt, 1);
-  std::thread *threads[16];
-  for (int i = 0; i < 16; i++)
-    threads[i] = nullptr;
-  try
-  {
-    int     y0 = 0;
-    for (int i = 0; i < threadCnt; i++)
-    {
-      int     y1 = (cubeWidth * 6 * (i + 1)) / threadCnt;
-      threads[i] = new std::thread(convertHDRToDDSThread, p, outPixelSize,
-                                   cubeWidth, y0, y1, tmpBuf2.data(), w, h,
-                                   maxLevel);
-      y0 = y1;
-    }
-    for (int i = 0; i < threadCnt; i++)
-    {
-      threads[i]->join();
-      delete threads[i];
-      threads[i] = nullptr;
-    }
-  }
-  catch (...)
-  {
-    for (int i = 0; i < 16; i++)
-    {
-      if (threads[i])
+  ThreadPool::getDefaultPool().parallelFor(
+      0, cubeWidth * 6, 8,
+      [&](int y0, int y1)
       {
-        threads[i]->join();
-        delete threads[i];
-      }
-    }
-    throw;
+        if (cancelFlag && cancelFlag->load(std::memory_order_relaxed))
+          return;
+        convertHDRToDDSThread(p, outPixelSize, cubeWidth, y0, y1,
+                              tmpBuf2.data(), w, h, maxLevel);
+      });
+  return !(cancelFlag && cancelFlag->load(std::memory_order_relaxed));
+}
+
+void SFCubeMapCache::setDiskCache(const char *dirName, std::uint64_t maxBytes)
+{
+  cancelProgressive();
+  diskCachePath.clear();
+  diskCacheMaxBytes = maxBytes;
+  if (!dirName || dirName[0] == '\0')
+    return;
+  diskCachePath = dirName;
+  if (!(diskCachePath.ends_with('/') || diskCachePath.ends_with('\\')))
+    diskCachePath += '/';
+  // create missing directories
+  for (size_t i = 1; i < diskCachePath.length(); i++)
+  {
+    char    c = diskCachePath[i];
+    if (!(c == '/' || c == '\\'))
+      continue;
+    diskCachePath[i] = '\0';
+#if defined(_WIN32) || defined(_WIN64)
+    (void) _mkdir(diskCachePath.c_str());
+#else
+    (void) mkdir(diskCachePath.c_str(), 0755);
+#endif
+    diskCachePath[i] = c;
   }
-  return true;
+  pruneDiskCache(std::string());
 }
 
 void SFCubeMapCache::clear()
 {
+  std::unique_lock< std::mutex >  lock(cacheMutex);
   cachedTextures.clear();
 }
 
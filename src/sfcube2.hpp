@@ -4,7 +4,15 @@
 
 #include "common.hpp"
 #include "fp32vec4.hpp"
+#include "fp32vec8.hpp"
 #include "ddstxt16.hpp"
+#include "bcnenc.hpp"
+#include "threadpool.hpp"
+
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <thread>
 
 class SFCubeMapFilter
 {
@@ -23,13 +31,27 @@ class SFCubeMapFilter
   //   vec8 X, vec8 Y, vec8 Z, vec8 W, vec8 R0, vec8 G0, vec8 B0,
   //   vec8 R1, vec8 G1, vec8 B1
   float   *cubeFilterTable;
+  // tables that do not depend on the input image are created once, and
+  // shared by all instances and threads through a process-wide cache
+  typedef std::shared_ptr< const std::vector< FloatVector8 > >  TablePtr;
+  static std::mutex tableCacheMutex;
+  static std::map< std::uint64_t, TablePtr >  tableCache;
   const float   *roughnessTable;
   int     roughnessTableSize;
   float   normalizeScale;
   void (*pixelStoreFunction)(unsigned char *p, FloatVector4 c);
   float   normalizeLevel;
   std::uint32_t importanceSampleCnt;
-  const std::vector< FloatVector4 > *importanceSampleTable;
+  // groups of 8 samples: vec8 X, vec8 Y, vec8 Z, vec8 weight, vec8 mip level
+  // (the mip level is relative to log2(input width), and is not clamped)
+  const std::vector< FloatVector8 > *importanceSampleTable;
+  int     inputMipOffset;
+  // 0: uncompressed output, 1: BC1 or BC6H, 2: BC7 or BC6H
+  unsigned char blockCompression;
+  unsigned char compressionQuality;
+  // spherical harmonics coefficients of the last image converted
+  FloatVector4  shCoefficients[9];
+  const std::atomic< bool > *cancelFlag;
  public:
   static inline FloatVector4 convertCoord(int x, int y, int w, int n);
  protected:
@@ -38,22 +60,36 @@ class SFCubeMapFilter
   void processImage_ImportanceSample(unsigned char *outBufP, int w,
                                      int y0, int y1);
   void processImage_Copy(unsigned char *outBufP, int w, int y0, int y1);
+  // diffuse filter using the spherical harmonics coefficients
+  void processImage_Diffuse(unsigned char *outBufP, int w, int y0, int y1);
   static void pixelStore_R8G8B8A8(unsigned char *p, FloatVector4 c);
   static void pixelStore_R9G9B9E5(unsigned char *p, FloatVector4 c);
   // endPos - startPos must be even if the filter is enabled
-  // roughness = 1.0 simulates diffuse filter
+  // roughness = 1.0 uses the diffuse filter
   static void threadFunction(SFCubeMapFilter *p, unsigned char *outBufP,
                              int w, int y0, int y1, float roughness,
                              bool enableFilter);
+  // importance sample table for GGX roughness and sample count n
+  static TablePtr getImportanceSampleTable(float roughness, std::uint32_t n);
+  // width * width * 3 * 4 floats, the X, Y, Z, W part of cubeFilterTable
+  static TablePtr getDirectionTable(int w);
+  // maximum importance sample count for mip level m of mipCnt,
+  // the convolution filter is used at higher sample counts
+  static std::uint32_t getImportanceSampleLimit(int m, int mipCnt);
   void createFilterTable(int w);
+  // compress the uncompressed output in buf, returns the new buffer size
+  size_t compressOutput(unsigned char *buf, bool outFmtFloat);
  public:
   SFCubeMapFilter(size_t outputWidth = 256);
   ~SFCubeMapFilter();
   // Returns the new buffer size. If outFmtFloat is true, the output format is
-  // DXGI_FORMAT_R9G9B9E5_SHAREDEXP instead of DXGI_FORMAT_R8G8B8A8_UNORM_SRGB.
+  // DXGI_FORMAT_R9G9B9E5_SHAREDEXP instead of DXGI_FORMAT_R8G8B8A8_UNORM_SRGB,
+  // or BC6H_UF16 instead of BC1 or BC7 if block compression is enabled.
   // The buffer must have sufficient capacity for width * width * 8 * 4 + 148
   // bytes.
   // On error, 0 is returned and no changes are made to the contents of buf.
+  // If the conversion is cancelled (see setCancelFlag()), 0 is returned and
+  // the contents of buf are undefined.
   size_t convertImage(unsigned char *buf, size_t bufSize,
                       bool outFmtFloat = false, size_t bufCapacity = 0);
   void setRoughnessTable(const float *p, size_t n);
@@ -63,6 +99,10 @@ class SFCubeMapFilter
   {
     normalizeLevel = 1.0f / ((n > 0.0f ? n : 65536.0f) * 6.0f);
   }
+  inline size_t getOutputWidth() const
+  {
+    return width;
+  }
   void setOutputWidth(size_t w)
   {
     if (w < minWidth || w > 2048 || (w & (w - 1)))
@@ -74,6 +114,57 @@ class SFCubeMapFilter
   {
     importanceSampleCnt = std::uint32_t(n);
   }
+  // Compress the output to DXGI_FORMAT_BC1_UNORM_SRGB (n = 1) or
+  // DXGI_FORMAT_BC7_UNORM_SRGB (n = 2), or to DXGI_FORMAT_BC6H_UF16 if
+  // outFmtFloat is true (n = 1 or 2). The default (n = 0) is uncompressed
+  // output. 'quality' is one of BCnEncoder::qualityFast, qualityNormal or
+  // qualityHigh.
+  inline void setBlockCompression(int n,
+                                  int quality = BCnEncoder::qualityNormal)
+  {
+    blockCompression = (unsigned char) std::min< int >(std::max< int >(n, 0),
+                                                       2);
+    compressionQuality =
+        (unsigned char) std::min< int >(std::max< int >(quality, 0), 2);
+  }
+  // Use mip level n of the input texture as the source image if it is stored
+  // in the file. The default (-1) is to load mip level 0 only, and generate
+  // all mipmaps from it.
+  inline void setInputMipOffset(int n)
+  {
+    inputMipOffset = n;
+  }
+  // convertImage() stops and returns 0 if *p is true (nullptr: disabled),
+  // the flag is checked by all threads after each block of rows
+  inline void setCancelFlag(const std::atomic< bool > *p)
+  {
+    cancelFlag = p;
+  }
+  // Project cube map t onto 3rd order (bands 0 to 2) spherical harmonics.
+  // The 9 RGB radiance coefficients are stored in sh[0] to sh[8] in the
+  // order L00, L1-1, L10, L11, L2-2, L2-1, L20, L21, L22 (sh[i][3] = 0.0).
+  static void calculateSphericalHarmonics(FloatVector4 *sh,
+                                          const DDSTexture16& t);
+  // returns irradiance / π for unit vector n (the average of the radiance
+  // weighted by N·L) from the coefficients of calculateSphericalHarmonics()
+  static FloatVector4 evaluateSHIrradiance(const FloatVector4 *sh,
+                                           FloatVector4 n);
+  // Create the cached tables needed by convertImage() with the specified
+  // output width, roughness table (nullptr: default) and importance sample
+  // count, so that they are not created by the first conversion. This is
+  // optional, the tables are also added to the cache when first used.
+  static void precomputeTables(size_t outputWidth,
+                               const float *roughnessTable = nullptr,
+                               size_t roughnessTableSize = 7,
+                               std::int32_t importanceSampleCnt = -1);
+  // free the memory used by the table cache
+  static void clearTableCache();
+  // coefficients of the last image converted with convertImage(), scaled
+  // by the same normalization as the output
+  inline const FloatVector4 *getSHCoefficients() const
+  {
+    return shCoefficients;
+  }
 };
 
 // face 0: E,      -X = up,   +X = down, -Y = N,    +Y = S
@@ -124,12 +215,79 @@ inline FloatVector4 SFCubeMapFilter::convertCoord(int x, int y, int w, int n)
 
 class SFCubeMapCache : public SFCubeMapFilter
 {
+ public:
+  // filtered images are shared with the caller, and remain valid after the
+  // cache is cleared or destroyed
+  typedef std::shared_ptr< const std::vector< unsigned char > > CachedImage;
+  // called from the background thread of getFilteredImageProgressive() with
+  // the full quality image, or an empty pointer on error or cancellation
+  typedef void (*ProgressiveCallback)(void *p, const CachedImage& img);
  protected:
-  std::map< std::uint64_t, std::vector< unsigned char > > cachedTextures;
+  struct DiskCacheFile
+  {
+    std::int64_t  modTime;
+    std::uint64_t fileSize;
+    std::string   fileName;
+    inline bool operator<(const DiskCacheFile& r) const
+    {
+      return (modTime < r.modTime ||
+              (modTime == r.modTime && fileName < r.fileName));
+    }
+  };
+  struct ProgressiveJob
+  {
+    std::thread *thread;
+    std::atomic< bool > cancelFlag;
+    std::atomic< bool > doneFlag;
+    // copy of the roughness table, which may not remain valid until the
+    // thread finishes
+    std::vector< float >  roughnessTable;
+  };
+  std::map< std::uint64_t, CachedImage >  cachedTextures;
+  // protects cachedTextures, which is also updated by background threads
+  std::mutex    cacheMutex;
+  // background filtering started by getFilteredImageProgressive(), only the
+  // last job is not cancelled
+  std::vector< ProgressiveJob * > progressiveJobs;
+  // background jobs use a smaller pool, so that they do not make parallel
+  // loops in the foreground run serially
+  ThreadPool    backgroundPool;
+  // empty if the disk cache is disabled
+  std::string   diskCachePath;
+  std::uint64_t diskCacheMaxBytes;
+  std::uint64_t calculateHash(const unsigned char *buf, size_t bufSize,
+                              bool outFmtFloat, int hdrToneMap) const;
+  std::string getDiskCacheFileName(std::uint64_t k) const;
+  CachedImage loadFromDiskCache(std::uint64_t k) const;
+  void storeInDiskCache(std::uint64_t k, const std::vector< unsigned char >& v);
+  // delete the least recently used files until the total size of the cache
+  // is at most diskCacheMaxBytes
+  void pruneDiskCache(const std::string& keepFileName);
+  // returns an empty pointer if k is not found in the memory or disk cache
+  CachedImage findCachedImage(std::uint64_t k);
+  void storeCachedImage(std::uint64_t k, const CachedImage& v);
+  // filter buf with the settings of f, HDR input is converted at a
+  // resolution of hdrCubeWidth
+  static CachedImage filterImage(
+      SFCubeMapFilter& f, const unsigned char *buf, size_t bufSize,
+      bool outFmtFloat, int hdrToneMap, int hdrCubeWidth,
+      const std::atomic< bool > *cancelFlag);
+  static void progressiveThreadFunction(
+      SFCubeMapCache *p, ProgressiveJob *job, SFCubeMapFilter f,
+      std::vector< unsigned char > buf, std::uint64_t k, bool outFmtFloat,
+      int hdrToneMap, ProgressiveCallback callback, void *callbackData);
+  // cancel all background jobs, and delete the ones that have finished,
+  // or all of them if waitForAll is true
+  void cancelProgressiveJobs(bool waitForAll);
   static void convertHDRToDDSThread(
       unsigned char *outBuf, size_t outPixelSize, int cubeWidth,
       int yStart, int yEnd,
       const FloatVector4 *hdrTexture, int w, int h, float maxLevel);
+  static bool convertHDRToDDS(std::vector< unsigned char >& outBuf,
+                              const unsigned char *inBufData, size_t inBufSize,
+                              int cubeWidth, bool invertCoord, float maxLevel,
+                              unsigned char outFmt,
+                              const std::atomic< bool > *cancelFlag);
  public:
   SFCubeMapCache();
   ~SFCubeMapCache();
@@ -137,6 +295,31 @@ class SFCubeMapCache : public SFCubeMapFilter
   size_t convertImage(unsigned char *buf, size_t bufSize,
                       bool outFmtFloat = false, size_t bufCapacity = 0,
                       int hdrToneMap = 0);
+  // Same as convertImage(), but returns the filtered image without copying
+  // it, the input buffer is not modified. On error, an empty pointer is
+  // returned.
+  CachedImage getFilteredImage(const unsigned char *buf, size_t bufSize,
+                               bool outFmtFloat = false, int hdrToneMap = 0);
+  // Progressive version of getFilteredImage() for interactive use. Returns a
+  // low quality preview filtered at previewWidth resolution (rounded down to
+  // a power of two, and limited to the range 16 to the output width) with
+  // previewSampleCnt importance samples per texel and a reduced resolution
+  // input, and continues filtering at full quality on a background thread
+  // using a separate thread pool with half the number of threads.
+  // When it is finished, the image is added to the cache, and callback is
+  // called with callbackData and the result. The final quality is defined
+  // by the settings of this object at the time of the call.
+  // If the full quality image is already cached, it is returned, and
+  // callback is not called. Any background filtering that is still running
+  // is cancelled without waiting for it to finish, its callback is called
+  // with an empty pointer. On error, an empty pointer is returned.
+  CachedImage getFilteredImageProgressive(
+      const unsigned char *buf, size_t bufSize,
+      ProgressiveCallback callback, void *callbackData,
+      bool outFmtFloat = false, int hdrToneMap = 0,
+      size_t previewWidth = 32, int previewSampleCnt = 32);
+  // cancel background filtering, and wait for all threads to finish
+  void cancelProgressive();
   // Convert Radiance HDR format image to DDS cube map.
   //   cubeWidth:       output resolution per face
   //   invertCoord:     invert Z axis if true
@@ -148,6 +331,20 @@ class SFCubeMapCache : public SFCubeMapFilter
                               const unsigned char *inBufData, size_t inBufSize,
                               int cubeWidth, bool invertCoord, float maxLevel,
                               unsigned char outFmt);
+  // Store filtered images persistently in the directory dirName, which is
+  // created if it does not exist. Entries are keyed by a hash of the input
+  // image and the output width, format, block compression, importance sample
+  // count, tone mapping, roughness table, normalize level and input mip
+  // offset settings. If the total size of the files exceeds maxBytes, the
+  // least recently used ones are deleted, temporary files left by writers
+  // that did not finish are deleted after an hour. Files are written
+  // atomically, so the directory can be shared by multiple processes.
+  // Background filtering started by getFilteredImageProgressive() is
+  // cancelled.
+  // If dirName is nullptr or empty, the disk cache is disabled.
+  void setDiskCache(const char *dirName,
+                    std::uint64_t maxBytes = 0x40000000ULL);
+  // clear the in-memory cache, the disk cache is not changed
   void clear();
 };
 
@@ -0,0 +1,135 @@
+
+#include "common.hpp"
+#include "simdfunc.hpp"
+#include "filebuf.hpp"
+#include "fp32vec4.hpp"
+#include "fp32vec8.hpp"
+
+#if defined(__GNUC__) && !defined(__clang__) && \
+    (defined(__x86_64__) || defined(__x86_64))
+#  define SIMDFUNC_ENABLE_RUNTIME_ISA   1
+#else
+#  define SIMDFUNC_ENABLE_RUNTIME_ISA   0
+#endif
+
+// the baseline functions use the global FloatVector4 and FloatVector8 classes
+namespace SIMDKernels_Baseline
+{
+#define SIMDKERN_ISA_LEVEL  0
+#include "simdkern.cpp"
+#undef SIMDKERN_ISA_LEVEL
+}
+
+#if SIMDFUNC_ENABLE_RUNTIME_ISA
+// Each of the other versions is compiled with the target options enabled,
+// and with its own copy of the vector classes, included in the namespace
+// with ENABLE_X86_64_SIMD redefined. Only code inside the namespaces may be
+// compiled with these options, any inline function or template instantiated
+// from them for the global namespace could be used by the linker for the
+// baseline code as well.
+#  pragma push_macro("ENABLE_X86_64_SIMD")
+#  undef ENABLE_X86_64_SIMD
+#  define ENABLE_X86_64_SIMD    4
+
+#  if !(defined(__AVX2__) && defined(__FMA__) && defined(__F16C__))
+#    pragma GCC push_options
+#    pragma GCC target("sse4.2,popcnt,avx,avx2,fma,f16c,bmi,bmi2,lzcnt")
+#    undef FP32VEC4_HPP_INCLUDED
+#    undef FP32VEC4_BASE_HPP_INCLUDED
+#    undef FP32VEC4_GCC_HPP_INCLUDED
+#    undef FP32VEC8_HPP_INCLUDED
+#    undef FP32VEC8_BASE_HPP_INCLUDED
+#    undef FP32VEC8_GCC_HPP_INCLUDED
+namespace SIMDKernels_AVX2
+{
+#    include "fp32vec8.hpp"
+#    define SIMDKERN_ISA_LEVEL  1
+#    include "simdkern.cpp"
+#    undef SIMDKERN_ISA_LEVEL
+}
+#    pragma GCC pop_options
+#    define SIMDFUNC_HAVE_AVX2_KERNELS  1
+#  endif
+
+#  pragma GCC push_options
+#  pragma GCC target("sse4.2,popcnt,avx,avx2,fma,f16c,bmi,bmi2,lzcnt")
+#  pragma GCC target("avx512f,avx512vl,avx512bw,avx512dq")
+#  undef FP32VEC4_HPP_INCLUDED
+#  undef FP32VEC4_BASE_HPP_INCLUDED
+#  undef FP32VEC4_GCC_HPP_INCLUDED
+#  undef FP32VEC8_HPP_INCLUDED
+#  undef FP32VEC8_BASE_HPP_INCLUDED
+#  undef FP32VEC8_GCC_HPP_INCLUDED
+namespace SIMDKernels_AVX512
+{
+#  include "fp32vec8.hpp"
+#  define SIMDKERN_ISA_LEVEL  2
+#  include "simdkern.cpp"
+#  undef SIMDKERN_ISA_LEVEL
+}
+#  pragma GCC pop_options
+
+#  pragma pop_macro("ENABLE_X86_64_SIMD")
+#endif
+
+std::atomic< const SIMDFunctions * >  SIMDFunctions::currentFunctions(nullptr);
+
+static const SIMDFunctions *getFunctionTable(int n)
+{
+#if SIMDFUNC_ENABLE_RUNTIME_ISA
+  if (n >= SIMDFunctions::isaAVX512)
+    return &SIMDKernels_AVX512::functionTable;
+  if (n >= SIMDFunctions::isaAVX2)
+  {
+#  ifdef SIMDFUNC_HAVE_AVX2_KERNELS
+    return &SIMDKernels_AVX2::functionTable;
+#  endif
+  }
+#else
+  (void) n;
+#endif
+  return &SIMDKernels_Baseline::functionTable;
+}
+
+int SIMDFunctions::getCPUISALevel()
+{
+#if SIMDFUNC_ENABLE_RUNTIME_ISA
+  // __builtin_cpu_supports() also checks if the OS saves the AVX registers
+  __builtin_cpu_init();
+  if (!(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") &&
+        __builtin_cpu_supports("f16c") && __builtin_cpu_supports("bmi") &&
+        __builtin_cpu_supports("bmi2") && __builtin_cpu_supports("popcnt")))
+  {
+    return isaBaseline;
+  }
+  if (!(__builtin_cpu_supports("avx512f") &&
+        __builtin_cpu_supports("avx512vl") &&
+        __builtin_cpu_supports("avx512bw") &&
+        __builtin_cpu_supports("avx512dq")))
+  {
+    return isaAVX2;
+  }
+  return isaAVX512;
+#else
+  return isaBaseline;
+#endif
+}
+
+const SIMDFunctions *SIMDFunctions::selectFunctions()
+{
+  const SIMDFunctions *p = getFunctionTable(getCPUISALevel());
+  currentFunctions.store(p, std::memory_order_relaxed);
+  return p;
+}
+
+void SIMDFunctions::setISALevel(int n)
+{
+  if (n < 0)
+  {
+    (void) selectFunctions();
+    return;
+  }
+  n = std::min(n, getCPUISALevel());
+  currentFunctions.store(getFunctionTable(n), std::memory_order_relaxed);
+}
+
@@ -0,0 +1,92 @@
+
+#ifndef SIMDFUNC_HPP_INCLUDED
+#define SIMDFUNC_HPP_INCLUDED
+
+#include "common.hpp"
+
+#include <atomic>
+
+// Table of functions with versions for multiple instruction sets, the one
+// used is selected at runtime according to the features of the CPU.
+// The code in simdkern.cpp is compiled once for the ENABLE_X86_64_SIMD level
+// of the build, and with GCC on x86_64 also for AVX2 and AVX-512, with the
+// FloatVector4 and FloatVector8 classes reconfigured for each target.
+struct SIMDFunctions
+{
+  enum
+  {
+    isaBaseline = 0,    // instruction set the library was compiled for
+    isaAVX2 = 1,        // Haswell: AVX2, FMA, F16C, BMI1, BMI2
+    isaAVX512 = 2       // AVX2 and AVX-512 F, VL, BW, DQ
+  };
+  typedef size_t (*DecodeLineFunction)(std::uint64_t *dst,
+                                       const unsigned char *src,
+                                       unsigned int w);
+  int     isaLevel;
+  const char  *isaName;
+  // memsetUInt32(), memsetUInt64() and memsetFloat() in common.hpp
+  void    (*memsetUInt32)(std::uint32_t *p, std::uint32_t c, size_t n);
+  void    (*memsetUInt64)(std::uint64_t *p, std::uint64_t c, size_t n);
+  void    (*memsetFloat)(float *p, float c, size_t n);
+  // downsample2xFilter_Line() and downsample4xFilter_Line() in downsamp.hpp
+  void    (*downsample2xFilter_Line)(
+      std::uint32_t *linePtr, const std::uint32_t *inBuf,
+      int imageWidth, int imageHeight, int y, unsigned char fmtFlags);
+  void    (*downsample4xFilter_Line)(
+      std::uint32_t *linePtr, const std::uint32_t *inBuf,
+      int imageWidth, int imageHeight, int y, unsigned char fmtFlags);
+  // DDSTexture16 decoders for uncompressed formats, converting w pixels
+  // to R16G16B16A16_FLOAT, and returning the number of bytes read from src
+  DecodeLineFunction  decodeLine_RGB;
+  DecodeLineFunction  decodeLine_BGR;
+  DecodeLineFunction  decodeLine_RGB32;
+  DecodeLineFunction  decodeLine_BGR32;
+  DecodeLineFunction  decodeLine_RGBA;
+  DecodeLineFunction  decodeLine_BGRA;
+  DecodeLineFunction  decodeLine_R8G8;
+  DecodeLineFunction  decodeLine_R8;
+  DecodeLineFunction  decodeLine_RGBA64F;
+  DecodeLineFunction  decodeLine_RGB9E5;
+  DecodeLineFunction  decodeLine_R10G10B10A2;
+  DecodeLineFunction  decodeLine_R8G8S;
+  DecodeLineFunction  decodeLine_RGBA32S;
+  DecodeLineFunction  decodeLine_RGBA64;
+  // sRGB to linear conversion of a w * h block of R16G16B16A16_FLOAT pixels,
+  // pitch is the number of pixels per line
+  void    (*srgbExpandBlock)(std::uint64_t *p, int w, int h, int pitch);
+  // calculate a line of a mipmap from two lines of the previous level,
+  // srcWidth is w * 2, or w if the previous level has a width of 1
+  void    (*downsampleLine_RGBA64F)(
+      std::uint64_t *dst, const std::uint64_t *src0,
+      const std::uint64_t *src1, unsigned int w, unsigned int srcWidth);
+  // SFCubeMapFilter specular convolution: for each of the n texels with
+  // direction vectors (X, Y, Z, unused) in v, add the sum of R, G, B * weight
+  // and weight to c, using groupCnt groups of 10 * 8 floats from the filter
+  // table. a2 = pow(roughness, 4.0)
+  void    (*cubeFilterSpecular)(
+      float *c, const float *v, size_t n,
+      const float *filterTable, size_t groupCnt, float a2);
+  // returns the functions for the highest instruction set level supported
+  // by the CPU, or for the level set with setISALevel()
+  static inline const SIMDFunctions& get();
+  // returns the highest level supported by the CPU and this build
+  static int getCPUISALevel();
+  // override the runtime selection for testing and benchmarking, the level is
+  // limited to getCPUISALevel(), n < 0 restores the default.
+  // This should not be called while other threads use the functions.
+  static void setISALevel(int n);
+ protected:
+  static std::atomic< const SIMDFunctions * > currentFunctions;
+  static const SIMDFunctions *selectFunctions();
+};
+
+inline const SIMDFunctions& SIMDFunctions::get()
+{
+  const SIMDFunctions *p = currentFunctions.load(std::memory_order_relaxed);
+  if (!p) [[unlikely]]
+    p = selectFunctions();
+  return *p;
+}
+
+#endif
+
@@ -0,0 +1,831 @@
+
+// Functions compiled for multiple instruction sets. This file is included by
+// simdfunc.cpp once for each target, in a separate namespace, with
+// SIMDKERN_ISA_LEVEL defined to the SIMDFunctions::isaBaseline, isaAVX2 or
+// isaAVX512 value that is being compiled. For the AVX2 and AVX-512 targets,
+// the FloatVector4 and FloatVector8 classes used here are local copies with
+// ENABLE_X86_64_SIMD = 4.
+
+#ifdef SIMDKERN_ISA_LEVEL
+
+// ----------------------------------------------------------------------------
+
+#if ENABLE_X86_64_SIMD >= 2
+template< typename T > static inline void memset_YMM(T *p, T c, size_t n)
+{
+  unsigned char *q = reinterpret_cast< unsigned char * >(p);
+  unsigned char *endPtr = q + (n * sizeof(T));
+  for ( ; reinterpret_cast< std::uintptr_t >(q) & 31U; q = q + sizeof(T))
+  {
+    if (q >= endPtr) [[unlikely]]
+      return;
+    *(reinterpret_cast< T * >(q)) = c;
+  }
+  T   tmp __attribute__ ((__vector_size__ (32)));
+#  if ENABLE_X86_64_SIMD >= 4
+  tmp[0] = c;
+  if (sizeof(T) == 8)
+    __asm__ ("vpbroadcastq %x0, %t0" : "+x" (tmp));
+  else
+    __asm__ ("vpbroadcastd %x0, %t0" : "+x" (tmp));
+#  else
+  for (size_t i = 0; i < (size_t(32) / sizeof(T)); i++)
+    tmp[i] = c;
+#  endif
+  n = size_t(endPtr - q) & 63;
+  unsigned char *r = endPtr - n;
+  for ( ; q < r; q = q + 64) [[likely]]
+  {
+    __asm__ ("vmovdqa %t1, %0" : "=m" (q[0]) : "x" (tmp));
+    __asm__ ("vmovdqa %t1, %0" : "=m" (q[32]) : "x" (tmp));
+  }
+  if (n & 32)
+  {
+    __asm__ ("vmovdqa %t1, %0" : "=m" (*q) : "x" (tmp));
+    q = q + 32;
+  }
+  if (n & 16)
+  {
+    __asm__ ("vmovdqa %x1, %0" : "=m" (*q) : "x" (tmp));
+    q = q + 16;
+  }
+  if (n & 8)
+  {
+    __asm__ ("vmovq %x1, %0" : "=m" (*q) : "x" (tmp));
+    q = q + 8;
+  }
+  if (sizeof(T) < 8 && (n & 4))
+    __asm__ ("vmovd %x1, %0" : "=m" (*q) : "x" (tmp));
+}
+#endif
+
+static void memsetUInt32(std::uint32_t *p, std::uint32_t c, size_t n)
+{
+#if ENABLE_X86_64_SIMD >= 2
+  memset_YMM< std::uint32_t >(p, c, n);
+#else
+  if (c == ((c & 0xFFU) * 0x01010101U))
+  {
+    std::memset(p, int(c & 0xFFU), n * sizeof(std::uint32_t));
+  }
+  else
+  {
+    for (size_t i = 0; i < n; i++)
+      p[i] = c;
+  }
+#endif
+}
+
+static void memsetUInt64(std::uint64_t *p, std::uint64_t c, size_t n)
+{
+#if ENABLE_X86_64_SIMD >= 2
+  memset_YMM< std::uint64_t >(p, c, n);
+#else
+  if (c == ((c & 0xFFU) * 0x0101010101010101ULL))
+  {
+    std::memset(p, int(c & 0xFFU), n * sizeof(std::uint64_t));
+  }
+  else
+  {
+    for (size_t i = 0; i < n; i++)
+      p[i] = c;
+  }
+#endif
+}
+
+static void memsetFloat(float *p, float c, size_t n)
+{
+#if ENABLE_X86_64_SIMD >= 2
+  memset_YMM< float >(p, c, n);
+#else
+  for (size_t i = 0; i < n; i++)
+    p[i] = c;
+#endif
+}
+
+// ----------------------------------------------------------------------------
+
+static const float  downsample2xFilterTable[5] =
+{
+  // x = 0, 1, 3, 5, 7
+  // pow(cos(x * PI / 18.0), 1.87795546) * sin(x * PI / 2.0) / (x * PI / 2.0)
+  1.00000000f, 0.61857799f, -0.16197358f, 0.05552255f, -0.01212696f
+};
+
+static inline FloatVector4 downsample2xFunc_R8G8B8A8(
+    const std::uint32_t * const *inBufPtrs, int x)
+{
+  FloatVector4  c, c1, c2;
+  c = FloatVector4(inBufPtrs[0] + x).srgbExpand();
+  c1 = FloatVector4(inBufPtrs[1] + x);
+  c2 = FloatVector4(inBufPtrs[2] + x);
+  c += ((c1.srgbExpand() + c2.srgbExpand()) * downsample2xFilterTable[1]);
+  c1 = FloatVector4(inBufPtrs[3] + x);
+  c2 = FloatVector4(inBufPtrs[4] + x);
+  c += ((c1.srgbExpand() + c2.srgbExpand()) * downsample2xFilterTable[2]);
+  c1 = FloatVector4(inBufPtrs[5] + x);
+  c2 = FloatVector4(inBufPtrs[6] + x);
+  c += ((c1.srgbExpand() + c2.srgbExpand()) * downsample2xFilterTable[3]);
+  c1 = FloatVector4(inBufPtrs[7] + x);
+  c2 = FloatVector4(inBufPtrs[8] + x);
+  c += ((c1.srgbExpand() + c2.srgbExpand()) * downsample2xFilterTable[4]);
+  return c;
+}
+
+static inline FloatVector4 downsample2xFunc_A2R10G10B10(
+    const std::uint32_t * const *inBufPtrs, int x)
+{
+  FloatVector4  c, c1, c2;
+  c = FloatVector4::convertA2R10G10B10(inBufPtrs[0][x], true);
+  c1 = FloatVector4::convertA2R10G10B10(inBufPtrs[1][x], true);
+  c2 = FloatVector4::convertA2R10G10B10(inBufPtrs[2][x], true);
+  c += ((c1 + c2) * downsample2xFilterTable[1]);
+  c1 = FloatVector4::convertA2R10G10B10(inBufPtrs[3][x], true);
+  c2 = FloatVector4::convertA2R10G10B10(inBufPtrs[4][x], true);
+  c += ((c1 + c2) * downsample2xFilterTable[2]);
+  c1 = FloatVector4::convertA2R10G10B10(inBufPtrs[5][x], true);
+  c2 = FloatVector4::convertA2R10G10B10(inBufPtrs[6][x], true);
+  c += ((c1 + c2) * downsample2xFilterTable[3]);
+  c1 = FloatVector4::convertA2R10G10B10(inBufPtrs[7][x], true);
+  c2 = FloatVector4::convertA2R10G10B10(inBufPtrs[8][x], true);
+  c += ((c1 + c2) * downsample2xFilterTable[4]);
+  return c;
+}
+
+static void downsample2xFilter_Line(
+    std::uint32_t *linePtr, const std::uint32_t *inBuf,
+    int imageWidth, int imageHeight, int y, unsigned char fmtFlags)
+{
+  // buffer for vertically filtered line data
+  FloatVector4  tmpBuf[15];
+  const std::uint32_t *inBufPtrs[9];
+  inBufPtrs[0] = inBuf + (size_t(y) * size_t(imageWidth));
+  for (int i = 0; i < 8; i = i + 2)
+  {
+    int     yc = y - (i + 1);
+    yc = (yc > 0 ? yc : 0);
+    inBufPtrs[i + 1] = inBuf + (size_t(yc) * size_t(imageWidth));
+    yc = y + (i + 1);
+    yc = (yc < (imageHeight - 1) ? yc : (imageHeight - 1));
+    inBufPtrs[i + 2] = inBuf + (size_t(yc) * size_t(imageWidth));
+  }
+  int     xc = 0;
+  for (int i = 7; i < 15; i++, xc += int(xc < (imageWidth - 1)))
+  {
+    if (!(fmtFlags & 1))
+      tmpBuf[i] = downsample2xFunc_R8G8B8A8(inBufPtrs, xc);
+    else
+      tmpBuf[i] = downsample2xFunc_A2R10G10B10(inBufPtrs, xc);
+  }
+  for (int i = 0; i < 7; i++)
+    tmpBuf[i] = tmpBuf[7];
+  for (int i = 0; i < imageWidth; i = i + 2, linePtr++)
+  {
+    FloatVector4  c(tmpBuf[7]);
+    c += ((tmpBuf[6] + tmpBuf[8]) * downsample2xFilterTable[1]);
+    c += ((tmpBuf[4] + tmpBuf[10]) * downsample2xFilterTable[2]);
+    c += ((tmpBuf[2] + tmpBuf[12]) * downsample2xFilterTable[3]);
+    c += ((tmpBuf[0] + tmpBuf[14]) * downsample2xFilterTable[4]);
+    c.maxValues(FloatVector4(1.0f / (float(1LL << 42) * float(1LL << 42))));
+    for (int j = 0; j < 12; j = j + 4)
+    {
+      tmpBuf[j] = tmpBuf[j + 2];
+      tmpBuf[j + 1] = tmpBuf[j + 3];
+      tmpBuf[j + 2] = tmpBuf[j + 4];
+      tmpBuf[j + 3] = tmpBuf[j + 5];
+    }
+    tmpBuf[12] = tmpBuf[14];
+    // convert to sRGB color space
+    FloatVector4  tmp1(c * (0.03876962f * (255.0f / 8.0f))
+                       + (1.15864660f * (255.0f / 2.0f)));
+    FloatVector4  tmp2(c);
+    tmp2.rsqrtFast();
+    c = c * (tmp1 * tmp2 - (0.19741622f * (255.0f / 4.0f)));
+    if (!(fmtFlags & 2))
+      *linePtr = std::uint32_t(c);
+    else
+      *linePtr = c.convertToA2R10G10B10();
+    if (!(fmtFlags & 1))
+    {
+      tmpBuf[13] = downsample2xFunc_R8G8B8A8(inBufPtrs, xc);
+      xc += int(xc < (imageWidth - 1));
+      tmpBuf[14] = downsample2xFunc_R8G8B8A8(inBufPtrs, xc);
+    }
+    else
+    {
+      tmpBuf[13] = downsample2xFunc_A2R10G10B10(inBufPtrs, xc);
+      xc += int(xc < (imageWidth - 1));
+      tmpBuf[14] = downsample2xFunc_A2R10G10B10(inBufPtrs, xc);
+    }
+    xc += int(xc < (imageWidth - 1));
+  }
+}
+
+static const float  downsample4xFilterTable[13] =
+{
+  // x = 0, 1, 2, 3, 5, 6, 7, 9, 10, 11, 13, 14, 15
+  // pow(cos(x * PI / 35.0), 1.67593545) * sin(x * PI / 4.0) / (x * PI / 4.0)
+  1.00000000f,  0.89425031f,  0.61956700f,  0.28220192f,
+               -0.15118950f, -0.16431169f, -0.09016543f,
+                0.05385105f,  0.05768426f,  0.03013375f,
+               -0.01447859f, -0.01270649f, -0.00483659f
+};
+
+static FloatVector4 downsample4xFunc_R8G8B8A8(
+    const std::uint32_t * const *inBufPtrs, int x)
+{
+  FloatVector4  c(inBufPtrs[0] + x);
+  c.srgbExpand();
+  int     i = 1;
+  for (int j = 1; j < 13; i = i + 6, j = j + 3)
+  {
+    FloatVector4  c1(inBufPtrs[i] + x);
+    FloatVector4  c2(inBufPtrs[i + 1] + x);
+    c += ((c1.srgbExpand() + c2.srgbExpand()) * downsample4xFilterTable[j]);
+    c1 = FloatVector4(inBufPtrs[i + 2] + x);
+    c2 = FloatVector4(inBufPtrs[i + 3] + x);
+    c += ((c1.srgbExpand() + c2.srgbExpand()) * downsample4xFilterTable[j + 1]);
+    c1 = FloatVector4(inBufPtrs[i + 4] + x);
+    c2 = FloatVector4(inBufPtrs[i + 5] + x);
+    c += ((c1.srgbExpand() + c2.srgbExpand()) * downsample4xFilterTable[j + 2]);
+  }
+  return c;
+}
+
+static FloatVector4 downsample4xFunc_A2R10G10B10(
+    const std::uint32_t * const *inBufPtrs, int x)
+{
+  FloatVector4  c(FloatVector4::convertA2R10G10B10(inBufPtrs[0][x], true));
+  int     i = 1;
+  for (int j = 1; j < 13; i = i + 6, j = j + 3)
+  {
+    FloatVector4  c1(FloatVector4::convertA2R10G10B10(inBufPtrs[i][x], true));
+    FloatVector4  c2(FloatVector4::convertA2R10G10B10(inBufPtrs[i + 1][x],
+                                                      true));
+    c += ((c1 + c2) * downsample4xFilterTable[j]);
+    c1 = FloatVector4::convertA2R10G10B10(inBufPtrs[i + 2][x], true);
+    c2 = FloatVector4::convertA2R10G10B10(inBufPtrs[i + 3][x], true);
+    c += ((c1 + c2) * downsample4xFilterTable[j + 1]);
+    c1 = FloatVector4::convertA2R10G10B10(inBufPtrs[i + 4][x], true);
+    c2 = FloatVector4::convertA2R10G10B10(inBufPtrs[i + 5][x], true);
+    c += ((c1 + c2) * downsample4xFilterTable[j + 2]);
+  }
+  return c;
+}
+
+static void downsample4xFilter_Line(
+    std::uint32_t *linePtr, const std::uint32_t *inBuf,
+    int imageWidth, int imageHeight, int y, unsigned char fmtFlags)
+{
+  // buffer for vertically filtered line data
+  FloatVector4  tmpBuf[31];
+  const std::uint32_t *inBufPtrs[25];
+  FloatVector4  (*downsample4xFuncPtr)(const std::uint32_t * const *, int) =
+      (!(fmtFlags & 1) ?
+       &downsample4xFunc_R8G8B8A8 : &downsample4xFunc_A2R10G10B10);
+  inBufPtrs[0] = inBuf + (size_t(y) * size_t(imageWidth));
+  for (int i = 1; i < 16; i++)
+  {
+    if (!(i & 3))
+      continue;
+    int     n = (i - (i >> 2)) << 1;
+    int     yc = y - i;
+    yc = (yc > 0 ? yc : 0);
+    inBufPtrs[n - 1] = inBuf + (size_t(yc) * size_t(imageWidth));
+    yc = y + i;
+    yc = (yc < (imageHeight - 1) ? yc : (imageHeight - 1));
+    inBufPtrs[n] = inBuf + (size_t(yc) * size_t(imageWidth));
+  }
+  int     xc = 0;
+  for (int i = 15; i < 31; i++, xc += int(xc < (imageWidth - 1)))
+    tmpBuf[i] = downsample4xFuncPtr(inBufPtrs, xc);
+  for (int i = 0; i < 15; i++)
+    tmpBuf[i] = tmpBuf[15];
+  for (int i = 0; i < imageWidth; i = i + 4, linePtr++)
+  {
+    FloatVector4  c(tmpBuf[15]);
+    c += ((tmpBuf[14] + tmpBuf[16]) * downsample4xFilterTable[1]);
+    c += ((tmpBuf[13] + tmpBuf[17]) * downsample4xFilterTable[2]);
+    c += ((tmpBuf[12] + tmpBuf[18]) * downsample4xFilterTable[3]);
+    c += ((tmpBuf[10] + tmpBuf[20]) * downsample4xFilterTable[4]);
+    c += ((tmpBuf[9] + tmpBuf[21]) * downsample4xFilterTable[5]);
+    c += ((tmpBuf[8] + tmpBuf[22]) * downsample4xFilterTable[6]);
+    c += ((tmpBuf[6] + tmpBuf[24]) * downsample4xFilterTable[7]);
+    c += ((tmpBuf[5] + tmpBuf[25]) * downsample4xFilterTable[8]);
+    c += ((tmpBuf[4] + tmpBuf[26]) * downsample4xFilterTable[9]);
+    c += ((tmpBuf[2] + tmpBuf[28]) * downsample4xFilterTable[10]);
+    c += ((tmpBuf[1] + tmpBuf[29]) * downsample4xFilterTable[11]);
+    c += ((tmpBuf[0] + tmpBuf[30]) * downsample4xFilterTable[12]);
+    c.maxValues(FloatVector4(1.0f / (float(1LL << 42) * float(1LL << 42))));
+    for (int j = 0; j < 24; j = j + 4)
+    {
+      tmpBuf[j] = tmpBuf[j + 4];
+      tmpBuf[j + 1] = tmpBuf[j + 5];
+      tmpBuf[j + 2] = tmpBuf[j + 6];
+      tmpBuf[j + 3] = tmpBuf[j + 7];
+    }
+    tmpBuf[24] = tmpBuf[28];
+    tmpBuf[25] = tmpBuf[29];
+    tmpBuf[26] = tmpBuf[30];
+    // convert to sRGB color space
+    FloatVector4  tmp1(c * (0.03876962f * (255.0f / 64.0f))
+                       + (1.15864660f * (255.0f / 4.0f)));
+    FloatVector4  tmp2(c);
+    tmp2.rsqrtFast();
+    c = c * (tmp1 * tmp2 - (0.19741622f * (255.0f / 16.0f)));
+    if (!(fmtFlags & 2))
+      *linePtr = std::uint32_t(c);
+    else
+      *linePtr = c.convertToA2R10G10B10();
+    tmpBuf[27] = downsample4xFuncPtr(inBufPtrs, xc);
+    xc += int(xc < (imageWidth - 1));
+    tmpBuf[28] = downsample4xFuncPtr(inBufPtrs, xc);
+    xc += int(xc < (imageWidth - 1));
+    tmpBuf[29] = downsample4xFuncPtr(inBufPtrs, xc);
+    xc += int(xc < (imageWidth - 1));
+    tmpBuf[30] = downsample4xFuncPtr(inBufPtrs, xc);
+    xc += int(xc < (imageWidth - 1));
+  }
+}
+
+// ----------------------------------------------------------------------------
+
+static inline FloatVector4 bgraToRGBA(FloatVector4 c)
+{
+  return FloatVector4(c[2], c[1], c[0], c[3]);
+}
+
+static size_t decodeLine_RGB(
+    std::uint64_t *dst, const unsigned char *src, unsigned int w)
+{
+  unsigned int  x = 0;
+  for ( ; (x + 1U) < w; x++, dst++, src = src + 3)
+  {
+    std::uint32_t b = FileBuffer::readUInt32Fast(src) | 0xFF000000U;
+    *dst = (FloatVector4(b) * (1.0f / 255.0f)).convertToFloat16();
+  }
+  if (x < w) [[likely]]
+  {
+    std::uint32_t r = src[0];
+    std::uint32_t g = src[1];
+    std::uint32_t b = src[2];
+    b = r | (g << 8) | (b << 16) | 0xFF000000U;
+    *dst = (FloatVector4(b) * (1.0f / 255.0f)).convertToFloat16();
+  }
+  return (size_t(w) * 3);
+}
+
+static size_t decodeLine_BGR(
+    std::uint64_t *dst, const unsigned char *src, unsigned int w)
+{
+  unsigned int  x = 0;
+  for ( ; (x + 1U) < w; x++, dst++, src = src + 3)
+  {
+    std::uint32_t b = FileBuffer::readUInt32Fast(src) | 0xFF000000U;
+    *dst = (bgraToRGBA(FloatVector4(b)) * (1.0f / 255.0f)).convertToFloat16();
+  }
+  if (x < w) [[likely]]
+  {
+    std::uint32_t b = src[0];
+    std::uint32_t g = src[1];
+    std::uint32_t r = src[2];
+    b = r | (g << 8) | (b << 16) | 0xFF000000U;
+    *dst = (FloatVector4(b) * (1.0f / 255.0f)).convertToFloat16();
+  }
+  return (size_t(w) * 3);
+}
+
+static size_t decodeLine_RGB32(
+    std::uint64_t *dst, const unsigned char *src, unsigned int w)
+{
+  for (unsigned int x = 0; x < w; x++, dst++, src = src + 4)
+  {
+    std::uint32_t b = FileBuffer::readUInt32Fast(src) | 0xFF000000U;
+    *dst = (FloatVector4(b) * (1.0f / 255.0f)).convertToFloat16();
+  }
+  return (size_t(w) << 2);
+}
+
+static size_t decodeLine_BGR32(
+    std::uint64_t *dst, const unsigned char *src, unsigned int w)
+{
+  for (unsigned int x = 0; x < w; x++, dst++, src = src + 4)
+  {
+    std::uint32_t b = FileBuffer::readUInt32Fast(src) | 0xFF000000U;
+    *dst = (bgraToRGBA(FloatVector4(b)) * (1.0f / 255.0f)).convertToFloat16();
+  }
+  return (size_t(w) << 2);
+}
+
+static size_t decodeLine_RGBA(
+    std::uint64_t *dst, const unsigned char *src, unsigned int w)
+{
+  for (unsigned int x = 0; x < w; x++, dst++, src = src + 4)
+  {
+    std::uint32_t b = FileBuffer::readUInt32Fast(src);
+    *dst = (FloatVector4(b) * (1.0f / 255.0f)).convertToFloat16();
+  }
+  return (size_t(w) << 2);
+}
+
+static size_t decodeLine_BGRA(
+    std::uint64_t *dst, const unsigned char *src, unsigned int w)
+{
+  for (unsigned int x = 0; x < w; x++, dst++, src = src + 4)
+  {
+    std::uint32_t b = FileBuffer::readUInt32Fast(src);
+    *dst = (bgraToRGBA(FloatVector4(b)) * (1.0f / 255.0f)).convertToFloat16();
+  }
+  return (size_t(w) << 2);
+}
+
+static size_t decodeLine_R8G8(
+    std::uint64_t *dst, const unsigned char *src, unsigned int w)
+{
+  unsigned int  x = 0;
+  for ( ; (x + 2U) <= w; x = x + 2U, dst = dst + 2, src = src + 4)
+  {
+    FloatVector4  c(FileBuffer::readUInt32Fast(src));
+    c *= (1.0f / 255.0f);
+    dst[0] = FloatVector4(c[0], c[1], 0.0f, 1.0f).convertToFloat16();
+    dst[1] = FloatVector4(c[2], c[3], 0.0f, 1.0f).convertToFloat16();
+  }
+  if (x < w)
+  {
+    std::uint32_t b = 0xFF000000U | FileBuffer::readUInt16Fast(src);
+    *dst = (FloatVector4(b) * (1.0f / 255.0f)).convertToFloat16();
+  }
+  return (size_t(w) << 1);
+}
+
+static size_t decodeLine_R8(
+    std::uint64_t *dst, const unsigned char *src, unsigned int w)
+{
+  unsigned int  x = 0;
+  for ( ; (x + 4U) <= w; x = x + 4U, dst = dst + 4, src = src + 4)
+  {
+    FloatVector4  c(FileBuffer::readUInt32Fast(src));
+    c *= (1.0f / 255.0f);
+    FloatVector4  c0(c[0]);
+    FloatVector4  c1(c[1]);
+    FloatVector4  c2(c[2]);
+    FloatVector4  c3(c[3]);
+    c0[3] = 1.0f;
+    c1[3] = 1.0f;
+    c2[3] = 1.0f;
+    c3[3] = 1.0f;
+    dst[0] = c0.convertToFloat16();
+    dst[1] = c1.convertToFloat16();
+    dst[2] = c2.convertToFloat16();
+    dst[3] = c3.convertToFloat16();
+  }
+  for ( ; x < w; x++, dst++, src++)
+  {
+    std::uint32_t b = (std::uint32_t(*src) * 0x00010101U) | 0xFF000000U;
+    *dst = (FloatVector4(b) * (1.0f / 255.0f)).convertToFloat16();
+  }
+  return size_t(w);
+}
+
+static size_t decodeLine_RGBA64F(
+    std::uint64_t *dst, const unsigned char *src, unsigned int w)
+{
+  for (unsigned int x = 0; x < w; x++, dst++, src = src + 8)
+  {
+    std::uint64_t b = FileBuffer::readUInt64Fast(src);
+    FloatVector4  c(FloatVector4::convertFloat16(b));
+    c.maxValues(FloatVector4(-65504.0f)).minValues(FloatVector4(65504.0f));
+    *dst = c.convertToFloat16();
+  }
+  return (size_t(w) << 3);
+}
+
+static size_t decodeLine_RGB9E5(
+    std::uint64_t *dst, const unsigned char *src, unsigned int w)
+{
+  for (unsigned int x = 0; x < w; x++, dst++, src = src + 4)
+  {
+    std::uint32_t b = FileBuffer::readUInt32Fast(src);
+    *dst = FloatVector4::convertR9G9B9E5(b).convertToFloat16();
+  }
+  return (size_t(w) << 2);
+}
+
+static size_t decodeLine_R10G10B10A2(
+    std::uint64_t *dst, const unsigned char *src, unsigned int w)
+{
+  for (unsigned int x = 0; x < w; x++, dst++, src = src + 4)
+  {
+    std::uint32_t b = FileBuffer::readUInt32Fast(src);
+    FloatVector4  c(FloatVector4::convertA2R10G10B10(b));
+    *dst = (c * (1.0f / 255.0f)).shuffleValues(0xC6).convertToFloat16();
+  }
+  return (size_t(w) << 2);
+}
+
+static size_t decodeLine_R8G8S(
+    std::uint64_t *dst, const unsigned char *src, unsigned int w)
+{
+  unsigned int  x = 0;
+  for ( ; (x + 2U) <= w; x = x + 2U, dst = dst + 2, src = src + 4)
+  {
+    std::uint32_t b = FileBuffer::readUInt32Fast(src) ^ 0x80808080U;
+    FloatVector4  c(b);
+    c = c * (1.0f / 127.5f) - 1.0f;
+    dst[0] = FloatVector4(c[0], c[1], 0.0f, 1.0f).convertToFloat16();
+    dst[1] = FloatVector4(c[2], c[3], 0.0f, 1.0f).convertToFloat16();
+  }
+  if (x < w)
+  {
+    std::uint32_t b = 0xFF808080U ^ FileBuffer::readUInt16Fast(src);
+    *dst = (FloatVector4(b) * (1.0f / 127.5f) - 1.0f).convertToFloat16();
+  }
+  return (size_t(w) << 1);
+}
+
+static size_t decodeLine_RGBA32S(
+    std::uint64_t *dst, const unsigned char *src, unsigned int w)
+{
+  for (unsigned int x = 0; x < w; x++, dst++, src = src + 4)
+  {
+    std::uint32_t b = FileBuffer::readUInt32Fast(src) ^ 0x80808080U;
+    *dst = (FloatVector4(b) * (1.0f / 127.5f) - 1.0f).convertToFloat16();
+  }
+  return (size_t(w) << 2);
+}
+
+static size_t decodeLine_RGBA64(
+    std::uint64_t *dst, const unsigned char *src, unsigned int w)
+{
+  for (unsigned int x = 0; x < w; x++, dst++, src = src + 8)
+  {
+    std::uint64_t b = FileBuffer::readUInt64Fast(src) ^ 0x8000800080008000ULL;
+    FloatVector4  c(FloatVector4::convertInt16(b));
+    *dst = ((c + 32768.0f) * float(1.0 / 65535.0)).convertToFloat16();
+  }
+  return (size_t(w) << 3);
+}
+
+// same as DDSTexture16::srgbExpand()
+
+static inline FloatVector4 srgbExpand(FloatVector4 c)
+{
+  const FloatVector4  a4(-0.13984761f, -0.13984761f, -0.13984761f, 0.0f);
+  const FloatVector4  a3(0.58740202f, 0.58740202f, 0.58740202f, 0.0f);
+  const FloatVector4  a2(0.50849240f, 0.50849240f, 0.50849240f, 0.0f);
+  const FloatVector4  a1(0.04395319f, 0.04395319f, 0.04395319f, 1.0f);
+  FloatVector4  c2(c * c);
+  return (c2 * a4 + (c * a3 + a2)) * c2 + (c * a1);
+}
+
+static inline FloatVector8 srgbExpand(FloatVector8 c)
+{
+  const FloatVector8  a4(-0.13984761f, -0.13984761f, -0.13984761f, 0.0f,
+                         -0.13984761f, -0.13984761f, -0.13984761f, 0.0f);
+  const FloatVector8  a3(0.58740202f, 0.58740202f, 0.58740202f, 0.0f,
+                         0.58740202f, 0.58740202f, 0.58740202f, 0.0f);
+  const FloatVector8  a2(0.50849240f, 0.50849240f, 0.50849240f, 0.0f,
+                         0.50849240f, 0.50849240f, 0.50849240f, 0.0f);
+  const FloatVector8  a1(0.04395319f, 0.04395319f, 0.04395319f, 1.0f,
+                         0.04395319f, 0.04395319f, 0.04395319f, 1.0f);
+  FloatVector8  c2(c * c);
+  return (c2 * a4 + (c * a3 + a2)) * c2 + (c * a1);
+}
+
+static void srgbExpandBlock(std::uint64_t *buf, int w, int h, int pitch)
+{
+#if ENABLE_X86_64_SIMD >= 3
+  if (!(w & 1)) [[likely]]
+  {
+    std::uint16_t *p = reinterpret_cast< std::uint16_t * >(buf);
+    for ( ; h > 0; h--, p = p + (pitch << 2))
+    {
+      for (int x = 0; (x + 2) <= w; x = x + 2)
+      {
+        FloatVector8  c(p + (x << 2), false);
+        srgbExpand(c).convertToFloat16(p + (x << 2));
+      }
+    }
+    return;
+  }
+#endif
+  for (std::uint64_t *p = buf; h > 0; h--, p = p + pitch)
+  {
+    for (int x = 0; x < w; x++)
+    {
+      FloatVector4  c(FloatVector4::convertFloat16(p[x]));
+      p[x] = srgbExpand(c).convertToFloat16();
+    }
+  }
+}
+
+static void downsampleLine_RGBA64F(
+    std::uint64_t *dst, const std::uint64_t *src0, const std::uint64_t *src1,
+    unsigned int w, unsigned int srcWidth)
+{
+  for (unsigned int x = 0; x < w; x++)
+  {
+    size_t  offsX2 = x << 1;
+    size_t  offsX2p1 = offsX2 + size_t(srcWidth > w);
+    FloatVector4  c(FloatVector4::convertFloat16(src0[offsX2]));
+    c += FloatVector4::convertFloat16(src0[offsX2p1]);
+    c += FloatVector4::convertFloat16(src1[offsX2]);
+    c += FloatVector4::convertFloat16(src1[offsX2p1]);
+    dst[x] = (c * 0.25f).convertToFloat16();
+  }
+}
+
+// ----------------------------------------------------------------------------
+
+static void cubeFilterSpecular_8(
+    float *c, const float *v, size_t n,
+    const float *filterTable, size_t groupCnt, float a2)
+{
+  FloatVector8  a2m1(a2 - 1.0f);
+  FloatVector8  a2p1(a2 + 1.0f);
+  for ( ; n > 0; n--, c = c + 4, v = v + 4)
+  {
+    // v1 = reflected view vector (R), assume V = N = R
+    FloatVector8  v1x(v[0]);
+    FloatVector8  v1y(v[1]);
+    FloatVector8  v1z(v[2]);
+    FloatVector8  c_r(0.0f);
+    FloatVector8  c_g(0.0f);
+    FloatVector8  c_b(0.0f);
+    FloatVector8  totalWeight(0.0f);
+    // the table may be less aligned than FloatVector8 of this ISA level
+    const float *j = filterTable;
+    const float *endPtr = j + (groupCnt * 80);
+    for ( ; j < endPtr; j += 80)
+    {
+      // v2 = light vector
+      FloatVector8  v2x(j);
+      FloatVector8  v2y(j + 8);
+      FloatVector8  v2z(j + 16);
+      // d = N·L = R·L = 2.0 * N·H * N·H - 1.0
+      FloatVector8  lDotR = (v1x * v2x) + (v1y * v2y) + (v1z * v2z);
+      std::uint32_t signMask = lDotR.getSignMask();
+      FloatVector8  v2w(j + 24);
+      if (signMask != 255U)
+      {
+        FloatVector8  d(lDotR);         // face +X, +Y or +Z
+        d.maxValues(FloatVector8(0.0f));
+        FloatVector8  weight(d * v2w);
+        // D denominator = (N·H * N·H * (a2 - 1.0) + 1.0)² * 4.0
+        //               = ((R·L + 1.0) * (a2 - 1.0) + 2.0)²
+        weight *= (d * a2m1 + a2p1).rcpSqr();
+        c_r += (FloatVector8(j + 32) * weight);
+        c_g += (FloatVector8(j + 40) * weight);
+        c_b += (FloatVector8(j + 48) * weight);
+        totalWeight += weight;
+        if (signMask == 0U) [[likely]]
+          continue;
+      }
+      {
+        FloatVector8  d(lDotR);         // face -X, -Y or -Z: invert dot product
+        d.minValues(FloatVector8(0.0f));
+        FloatVector8  weight(d * v2w);
+        weight *= (a2p1 - (d * a2m1)).rcpSqr();
+        c_r -= (FloatVector8(j + 56) * weight);
+        c_g -= (FloatVector8(j + 64) * weight);
+        c_b -= (FloatVector8(j + 72) * weight);
+        totalWeight -= weight;
+      }
+    }
+    FloatVector4  tmp(c_r.dotProduct(FloatVector8(1.0f)),
+                      c_g.dotProduct(FloatVector8(1.0f)),
+                      c_b.dotProduct(FloatVector8(1.0f)),
+                      totalWeight.dotProduct(FloatVector8(1.0f)));
+    (tmp + FloatVector4(c)).convertToFloats(c);
+  }
+}
+
+#if SIMDKERN_ISA_LEVEL < 2
+static inline void cubeFilterSpecular(
+    float *c, const float *v, size_t n,
+    const float *filterTable, size_t groupCnt, float a2)
+{
+  cubeFilterSpecular_8(c, v, n, filterTable, groupCnt, a2);
+}
+#else
+typedef float ZMM_Float __attribute__ ((__vector_size__ (64)));
+
+// returns a vector with 8 copies of a and 8 copies of b
+static inline ZMM_Float zmmFloat2(float a, float b)
+{
+  ZMM_Float r = { a, a, a, a, a, a, a, a, b, b, b, b, b, b, b, b };
+  return r;
+}
+
+// load 8 floats from p (no alignment required) to both 256-bit halves
+// of the result
+static inline ZMM_Float zmmBroadcast8(const float *p)
+{
+  typedef float YMM_FloatU __attribute__ ((__vector_size__ (32),
+                                           __aligned__ (4)));
+  ZMM_Float tmp = { 0.0f };
+  return __builtin_ia32_broadcastf32x8_512_mask(
+             *(reinterpret_cast< const YMM_FloatU * >(p)), tmp, 0xFFFF);
+}
+
+static inline ZMM_Float zmmRcpSqr(ZMM_Float a)
+{
+  ZMM_Float tmp1 = a * a;
+  ZMM_Float tmp2 = __builtin_ia32_rcp14ps512_mask(tmp1, tmp1, 0xFFFF);
+  return (2.0f - tmp1 * tmp2) * tmp2;
+}
+
+// returns the sum of the elements of each half of a
+static inline void zmmHorizontalSum(float& s0, float& s1, ZMM_Float a)
+{
+  float   tmp[16];
+  std::memcpy(tmp, &a, sizeof(ZMM_Float));
+  s0 = FloatVector8(tmp).dotProduct(FloatVector8(1.0f));
+  s1 = FloatVector8(tmp + 8).dotProduct(FloatVector8(1.0f));
+}
+
+// 16-wide version: two texels are processed at a time, one in each 256-bit
+// half of the vectors, so that the filter table is read only once per pair
+static void cubeFilterSpecular(
+    float *c, const float *v, size_t n,
+    const float *filterTable, size_t groupCnt, float a2)
+{
+  ZMM_Float zero = { 0.0f };
+  for ( ; n >= 2; n = n - 2, c = c + 8, v = v + 8)
+  {
+    ZMM_Float v1x = zmmFloat2(v[0], v[4]);
+    ZMM_Float v1y = zmmFloat2(v[1], v[5]);
+    ZMM_Float v1z = zmmFloat2(v[2], v[6]);
+    ZMM_Float c_r = zero;
+    ZMM_Float c_g = zero;
+    ZMM_Float c_b = zero;
+    ZMM_Float totalWeight = zero;
+    const float *j = filterTable;
+    const float *endPtr = j + (groupCnt * 80);
+    for ( ; j < endPtr; j += 80)
+    {
+      ZMM_Float lDotR = (v1x * zmmBroadcast8(j))
+                        + (v1y * zmmBroadcast8(j + 8))
+                        + (v1z * zmmBroadcast8(j + 16));
+      // _CMP_LT_OS
+      std::uint32_t signMask =
+          __builtin_ia32_cmpps512_mask(lDotR, zero, 0x01, 0xFFFF, 0x04);
+      ZMM_Float v2w = zmmBroadcast8(j + 24);
+      if (signMask != 0xFFFFU)
+      {
+        ZMM_Float d = __builtin_ia32_maxps512_mask(lDotR, zero, zero, 0xFFFF,
+                                                   0x04);
+        ZMM_Float weight = d * v2w * zmmRcpSqr(d * (a2 - 1.0f) + (a2 + 1.0f));
+        c_r += (zmmBroadcast8(j + 32) * weight);
+        c_g += (zmmBroadcast8(j + 40) * weight);
+        c_b += (zmmBroadcast8(j + 48) * weight);
+        totalWeight += weight;
+        if (signMask == 0U) [[likely]]
+          continue;
+      }
+      {
+        ZMM_Float d = __builtin_ia32_minps512_mask(lDotR, zero, zero, 0xFFFF,
+                                                   0x04);
+        ZMM_Float weight = d * v2w * zmmRcpSqr((a2 + 1.0f) - d * (a2 - 1.0f));
+        c_r -= (zmmBroadcast8(j + 56) * weight);
+        c_g -= (zmmBroadcast8(j + 64) * weight);
+        c_b -= (zmmBroadcast8(j + 72) * weight);
+        totalWeight -= weight;
+      }
+    }
+    FloatVector4  tmp0, tmp1;
+    zmmHorizontalSum(tmp0[0], tmp1[0], c_r);
+    zmmHorizontalSum(tmp0[1], tmp1[1], c_g);
+    zmmHorizontalSum(tmp0[2], tmp1[2], c_b);
+    zmmHorizontalSum(tmp0[3], tmp1[3], totalWeight);
+    (tmp0 + FloatVector4(c)).convertToFloats(c);
+    (tmp1 + FloatVector4(c + 4)).convertToFloats(c + 4);
+  }
+  if (n)
+    cubeFilterSpecular_8(c, v, n, filterTable, groupCnt, a2);
+}
+#endif
+
+// ----------------------------------------------------------------------------
+
+static const SIMDFunctions  functionTable =
+{
+  SIMDKERN_ISA_LEVEL,
+#if SIMDKERN_ISA_LEVEL == 0
+  "baseline",
+#elif SIMDKERN_ISA_LEVEL == 1
+  "AVX2",
+#else
+  "AVX-512",
+#endif
+  &memsetUInt32, &memsetUInt64, &memsetFloat,
+  &downsample2xFilter_Line, &downsample4xFilter_Line,
+  &decodeLine_RGB, &decodeLine_BGR, &decodeLine_RGB32, &decodeLine_BGR32,
+  &decodeLine_RGBA, &decodeLine_BGRA, &decodeLine_R8G8, &decodeLine_R8,
+  &decodeLine_RGBA64F, &decodeLine_RGB9E5, &decodeLine_R10G10B10A2,
+  &decodeLine_R8G8S, &decodeLine_RGBA32S, &decodeLine_RGBA64,
+  &srgbExpandBlock, &downsampleLine_RGBA64F, &cubeFilterSpecular
+};
+
+#endif
+
@@ -0,0 +1,270 @@
+
+#include "common.hpp"
+#include "threadpool.hpp"
+
+thread_local bool ThreadPool::isWorkerThread = false;
+thread_local ThreadPool *ThreadPool::threadDefaultPool = nullptr;
+thread_local const ThreadPool::CallerLoop *ThreadPool::callerLoops = nullptr;
+
+bool ThreadPool::isCallerOfLoop() const
+{
+  for (const CallerLoop *p = callerLoops; p; p = p->prv)
+  {
+    if (p->pool == this)
+      return true;
+  }
+  return false;
+}
+
+bool ThreadPool::stealRange(int threadNum)
+{
+  // take the upper half of the largest remaining range of another thread
+  while (true)
+  {
+    int     victim = -1;
+    std::uint64_t r = 0;
+    std::uint32_t maxSize = 0U;
+    for (int i = 0; i < loopThreadCnt; i++)
+    {
+      if (i == threadNum)
+        continue;
+      std::uint64_t tmp = ranges[i].r.load(std::memory_order_acquire);
+      std::uint32_t n = std::uint32_t(tmp >> 32) - std::uint32_t(tmp);
+      if (n > maxSize && n < 0x80000000U)
+      {
+        victim = i;
+        r = tmp;
+        maxSize = n;
+      }
+    }
+    if (victim < 0)
+      return false;
+    std::uint32_t b = std::uint32_t(r);
+    std::uint32_t e = std::uint32_t(r >> 32);
+    std::uint32_t n = std::max(maxSize >> 1, std::uint32_t(loopBlockSize));
+    std::uint32_t m = e - std::min(n, maxSize);
+    if (ranges[victim].r.compare_exchange_weak(
+            r, (std::uint64_t(m) << 32) | b,
+            std::memory_order_acq_rel, std::memory_order_relaxed))
+    {
+      // only the owner thread can extend its own empty range
+      ranges[threadNum].r.store((std::uint64_t(e) << 32) | m,
+                                std::memory_order_release);
+      return true;
+    }
+  }
+}
+
+void ThreadPool::runLoop(int threadNum)
+{
+  std::atomic< std::uint64_t >& r = ranges[threadNum].r;
+  while (true)
+  {
+    std::uint64_t tmp = r.load(std::memory_order_acquire);
+    std::uint32_t b = std::uint32_t(tmp);
+    std::uint32_t e = std::uint32_t(tmp >> 32);
+    if (b >= e)
+    {
+      if (!stealRange(threadNum))
+        break;
+      continue;
+    }
+    std::uint32_t n = std::min(e - b, std::uint32_t(loopBlockSize));
+    if (!r.compare_exchange_weak(tmp, (tmp & 0xFFFFFFFF00000000ULL) | (b + n),
+                                 std::memory_order_acq_rel,
+                                 std::memory_order_relaxed))
+    {
+      continue;
+    }
+    try
+    {
+      int     i0 = loopStart + int(b);
+      loopFunction(loopFunctionData, i0, i0 + int(n));
+    }
+    catch (...)
+    {
+      std::unique_lock< std::mutex >  lock(workerMutex);
+      if (!loopError)
+        loopError = std::current_exception();
+    }
+  }
+}
+
+void ThreadPool::workerThread(ThreadPool *p, int threadNum,
+                              std::uint64_t prvLoopNum)
+{
+  isWorkerThread = true;
+  // nested loops use the pool that this thread belongs to
+  threadDefaultPool = p;
+  while (true)
+  {
+    {
+      std::unique_lock< std::mutex >  lock(p->workerMutex);
+      while (!p->exitFlag && p->loopNum == prvLoopNum)
+        p->startCV.wait(lock);
+      if (p->exitFlag)
+        break;
+      prvLoopNum = p->loopNum;
+      if (threadNum >= p->loopThreadCnt)
+        continue;
+    }
+    p->runLoop(threadNum);
+    {
+      std::unique_lock< std::mutex >  lock(p->workerMutex);
+      if (--(p->activeThreads) == 0)
+        p->doneCV.notify_all();
+    }
+  }
+}
+
+void ThreadPool::startThreads()
+{
+  std::uint64_t n;
+  {
+    std::unique_lock< std::mutex >  lock(workerMutex);
+    exitFlag = false;
+    n = loopNum;
+  }
+  for ( ; workerCnt < (threadCnt - 1); workerCnt++)
+  {
+    try
+    {
+      threads[workerCnt + 1] =
+          new std::thread(workerThread, this, workerCnt + 1, n);
+    }
+    catch (...)
+    {
+      // continue with fewer threads
+      threadCnt = workerCnt + 1;
+      break;
+    }
+  }
+}
+
+void ThreadPool::stopThreads()
+{
+  {
+    std::unique_lock< std::mutex >  lock(workerMutex);
+    exitFlag = true;
+  }
+  startCV.notify_all();
+  for ( ; workerCnt > 0; workerCnt--)
+  {
+    threads[workerCnt]->join();
+    delete threads[workerCnt];
+    threads[workerCnt] = nullptr;
+  }
+}
+
+ThreadPool::ThreadPool(int n)
+  : threadCnt(1),
+    workerCnt(0),
+    loopNum(0),
+    activeThreads(0),
+    exitFlag(false),
+    loopFunction(nullptr),
+    loopFunctionData(nullptr),
+    loopStart(0),
+    loopBlockSize(1),
+    loopThreadCnt(0)
+{
+  for (int i = 0; i < 64; i++)
+  {
+    ranges[i].r.store(0, std::memory_order_relaxed);
+    threads[i] = nullptr;
+  }
+  setThreadCount(n);
+}
+
+ThreadPool::~ThreadPool()
+{
+  stopThreads();
+}
+
+void ThreadPool::setThreadCount(int n)
+{
+  if (n <= 0)
+    n = int(std::thread::hardware_concurrency());
+  n = std::min(std::max(n, 1), 64);
+  std::unique_lock< std::mutex >  lock(loopMutex);
+  stopThreads();
+  threadCnt = n;
+}
+
+void ThreadPool::parallelFor(int startPos, int endPos, int blockSize,
+                             ParallelForFunction f, void *p)
+{
+  if (endPos <= startPos)
+    return;
+  blockSize = std::max(blockSize, 1);
+  // a nested call from the thread that holds loopMutex must not try to lock
+  // it again
+  if (isWorkerThread || isCallerOfLoop())
+  {
+    f(p, startPos, endPos);
+    return;
+  }
+  std::unique_lock< std::mutex >  lock(loopMutex, std::try_to_lock);
+  int     blockCnt = ((endPos - startPos) - 1) / blockSize + 1;
+  if (!lock.owns_lock() || threadCnt < 2 || blockCnt < 2)
+  {
+    f(p, startPos, endPos);
+    return;
+  }
+  if (workerCnt < (threadCnt - 1))
+    startThreads();
+  int     n = std::min(threadCnt, blockCnt);
+  // split the range at block boundaries
+  for (int i = 0; i < n; i++)
+  {
+    std::uint32_t b = std::uint32_t(std::int64_t(blockCnt) * i / n);
+    std::uint32_t e = std::uint32_t(std::int64_t(blockCnt) * (i + 1) / n);
+    b = b * std::uint32_t(blockSize);
+    e = std::min(e * std::uint32_t(blockSize),
+                 std::uint32_t(endPos - startPos));
+    ranges[i].r.store((std::uint64_t(e) << 32) | b, std::memory_order_relaxed);
+  }
+  loopFunction = f;
+  loopFunctionData = p;
+  loopStart = startPos;
+  loopBlockSize = blockSize;
+  {
+    std::unique_lock< std::mutex >  workerLock(workerMutex);
+    loopThreadCnt = n;
+    activeThreads = n - 1;
+    loopError = nullptr;
+    loopNum++;
+  }
+  if (n > 1)
+    startCV.notify_all();
+  CallerLoop  callerLoop{ this, callerLoops };
+  callerLoops = &callerLoop;
+  runLoop(0);
+  callerLoops = callerLoop.prv;
+  std::exception_ptr  err;
+  {
+    std::unique_lock< std::mutex >  workerLock(workerMutex);
+    while (activeThreads > 0)
+      doneCV.wait(workerLock);
+    err = loopError;
+    loopError = nullptr;
+  }
+  if (err)
+    std::rethrow_exception(err);
+}
+
+ThreadPool& ThreadPool::getDefaultPool()
+{
+  if (threadDefaultPool)
+    return *threadDefaultPool;
+  static ThreadPool defaultPool;
+  return defaultPool;
+}
+
+ThreadPool *ThreadPool::setThreadDefaultPool(ThreadPool *p)
+{
+  ThreadPool  *prv = threadDefaultPool;
+  threadDefaultPool = p;
+  return prv;
+}
+
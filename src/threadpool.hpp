@@ -0,0 +1,106 @@
+
+#ifndef THREADPOOL_HPP_INCLUDED
+#define THREADPOOL_HPP_INCLUDED
+
+#include "common.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+
+// Persistent pool of worker threads for data parallel loops. The range of a
+// parallelFor() call is split evenly between the threads, and each thread
+// processes its part in blocks of blockSize elements; threads that finish
+// early steal half of the remaining range of another thread.
+// Only one loop can run on a pool at a time. If parallelFor() is called while
+// the pool is busy, or from inside a loop, the range is processed serially on
+// the calling thread.
+class ThreadPool
+{
+ public:
+  // called with a non-empty range [i0, i1) of the loop
+  typedef void (*ParallelForFunction)(void *p, int i0, int i1);
+ protected:
+  struct alignas(64) WorkRange
+  {
+    // start offset in bits 0 to 31, end offset in bits 32 to 63
+    std::atomic< std::uint64_t >  r;
+  };
+  WorkRange   ranges[64];
+  std::thread *threads[64];
+  int         threadCnt;        // number of threads, including the caller
+  int         workerCnt;        // number of worker threads started
+  // held by the thread that is running a loop
+  std::mutex  loopMutex;
+  std::mutex  workerMutex;
+  std::condition_variable startCV;
+  std::condition_variable doneCV;
+  // the following variables are protected by workerMutex
+  std::uint64_t loopNum;
+  int         activeThreads;
+  bool        exitFlag;
+  std::exception_ptr  loopError;
+  // parameters of the current loop
+  ParallelForFunction loopFunction;
+  void        *loopFunctionData;
+  int         loopStart;
+  int         loopBlockSize;
+  int         loopThreadCnt;
+  static thread_local bool  isWorkerThread;
+  // loops run by this thread as the caller of parallelFor(), innermost first
+  struct CallerLoop
+  {
+    const ThreadPool  *pool;
+    const CallerLoop  *prv;
+  };
+  static thread_local const CallerLoop  *callerLoops;
+  bool isCallerOfLoop() const;
+  // pool returned by getDefaultPool() on this thread, nullptr: defaultPool
+  static thread_local ThreadPool  *threadDefaultPool;
+  bool stealRange(int threadNum);
+  void runLoop(int threadNum);
+  // prvLoopNum is the number of loops run before the thread was started
+  static void workerThread(ThreadPool *p, int threadNum,
+                           std::uint64_t prvLoopNum);
+  void startThreads();
+  void stopThreads();
+  template< typename T >
+  static void callFunction(void *p, int i0, int i1)
+  {
+    (*(reinterpret_cast< const T * >(p)))(i0, i1);
+  }
+ public:
+  // n <= 0: use std::thread::hardware_concurrency() threads (at most 64)
+  ThreadPool(int n = 0);
+  ~ThreadPool();
+  // waits for the current loop to finish, worker threads are restarted on
+  // the next call to parallelFor()
+  void setThreadCount(int n);
+  inline int getThreadCount() const
+  {
+    return threadCnt;
+  }
+  // Call f(p, i0, i1) for blocks of the range [startPos, endPos) in parallel.
+  // The caller thread also runs part of the loop. Exceptions thrown by f are
+  // rethrown after all threads have finished.
+  void parallelFor(int startPos, int endPos, int blockSize,
+                   ParallelForFunction f, void *p);
+  // f can be any callable object taking (int i0, int i1)
+  template< typename T >
+  inline void parallelFor(int startPos, int endPos, int blockSize, const T& f)
+  {
+    parallelFor(startPos, endPos, blockSize, &callFunction< T >,
+                const_cast< void * >(reinterpret_cast< const void * >(&f)));
+  }
+  // pool shared by all functions of the library, or the one set with
+  // setThreadDefaultPool() on the calling thread
+  static ThreadPool& getDefaultPool();
+  // Redirect getDefaultPool() on the calling thread to p, so that background
+  // work does not occupy the shared pool. nullptr restores the default.
+  // Returns the previous setting.
+  static ThreadPool *setThreadDefaultPool(ThreadPool *p);
+};
+
+#endif
+
@@ -0,0 +1,247 @@
+
+#include "common.hpp"
+#include "txtcache.hpp"
+
+void TextureCache::lruUnlink(CachedTexture *p)
+{
+  if (p->prv)
+    p->prv->nxt = p->nxt;
+  else
+    lruFirst = p->nxt;
+  if (p->nxt)
+    p->nxt->prv = p->prv;
+  else
+    lruLast = p->prv;
+  p->prv = nullptr;
+  p->nxt = nullptr;
+}
+
+void TextureCache::lruInsert(CachedTexture *p)
+{
+  p->prv = nullptr;
+  p->nxt = lruFirst;
+  if (lruFirst)
+    lruFirst->prv = p;
+  else
+    lruLast = p;
+  lruFirst = p;
+}
+
+void TextureCache::deleteTexture(CachedTexture *p)
+{
+  if (p->texture || p->texture16)
+  {
+    if (!p->refCnt)
+      lruUnlink(p);
+    if (p->texture)
+      textureAddrMap.erase(p->texture);
+    else
+      textureAddrMap.erase(p->texture16);
+    stats.residentBytes = stats.residentBytes - p->dataSize;
+    stats.textureCnt--;
+  }
+  textureMap.erase(p->key);
+  delete p->texture;
+  delete p->texture16;
+  delete p;
+}
+
+void TextureCache::evictTextures()
+{
+  while (stats.residentBytes > memoryLimit && lruLast)
+  {
+    deleteTexture(lruLast);
+    stats.evictionCnt++;
+  }
+}
+
+TextureCache::CachedTexture * TextureCache::findOrLoadTexture(
+    const std::string_view& fileName, int mipOffset, int textureType)
+{
+  const BA2File::FileInfo *fd = ba2File.findFile(fileName);
+  if (!fd)
+    return nullptr;
+  TextureKey  k;
+  k.fileInfo = fd;
+  k.mipOffset = std::max(mipOffset, 0);
+  k.textureType = textureType;
+  CachedTexture *p;
+  {
+    std::unique_lock< std::mutex >  lock(cacheMutex);
+    while (true)
+    {
+      std::map< TextureKey, CachedTexture * >::iterator i = textureMap.find(k);
+      if (i == textureMap.end())
+        break;
+      p = i->second;
+      if (!(p->texture || p->texture16))
+      {
+        // another thread is loading the same texture
+        loadCompleteCV.wait(lock);
+        continue;
+      }
+      if (!p->refCnt)
+        lruUnlink(p);
+      p->refCnt++;
+      stats.hitCnt++;
+      return p;
+    }
+    p = new CachedTexture;
+    p->key = k;
+    p->texture = nullptr;
+    p->texture16 = nullptr;
+    p->dataSize = 0;
+    p->refCnt = 1;
+    p->prv = nullptr;
+    p->nxt = nullptr;
+    try
+    {
+      textureMap.insert(std::pair< TextureKey, CachedTexture * >(k, p));
+    }
+    catch (...)
+    {
+      delete p;
+      throw;
+    }
+    stats.missCnt++;
+  }
+  DDSTexture    *t = nullptr;
+  DDSTexture16  *t16 = nullptr;
+  try
+  {
+    BA2File::UCharArray fileBuf;
+    int     n = ba2File.extractTexture(fileBuf, fd->fileName, k.mipOffset);
+    switch (textureType)
+    {
+      case textureTypeDDS:
+      case textureTypeDDSTiled:
+      case textureTypeDDSCompressed:
+        t = new DDSTexture(fileBuf.data, fileBuf.size, n,
+                           (textureType == textureTypeDDSTiled),
+                           (textureType == textureTypeDDSCompressed));
+        break;
+      default:
+        t16 = new DDSTexture16(fileBuf.data, fileBuf.size, n,
+                               (textureType == textureTypeDDS16NoSRGBExpand));
+        break;
+    }
+  }
+  catch (...)
+  {
+    {
+      std::unique_lock< std::mutex >  lock(cacheMutex);
+      deleteTexture(p);
+    }
+    loadCompleteCV.notify_all();
+    throw;
+  }
+  {
+    std::unique_lock< std::mutex >  lock(cacheMutex);
+    p->texture = t;
+    p->texture16 = t16;
+    if (t)
+    {
+      p->dataSize = t->size() * sizeof(std::uint32_t) + sizeof(DDSTexture);
+      textureAddrMap[t] = p;
+    }
+    else
+    {
+      p->dataSize =
+          t16->size() * sizeof(std::uint64_t) + sizeof(DDSTexture16);
+      textureAddrMap[t16] = p;
+    }
+    stats.residentBytes = stats.residentBytes + p->dataSize;
+    stats.textureCnt++;
+    evictTextures();
+  }
+  loadCompleteCV.notify_all();
+  return p;
+}
+
+void TextureCache::releaseTexture(const void *t)
+{
+  if (!t)
+    return;
+  std::unique_lock< std::mutex >  lock(cacheMutex);
+  std::map< const void *, CachedTexture * >::iterator i =
+      textureAddrMap.find(t);
+  if (i == textureAddrMap.end()) [[unlikely]]
+    errorMessage("TextureCache: releasing invalid texture");
+  CachedTexture *p = i->second;
+  if (p->refCnt > 0 && --(p->refCnt) == 0)
+  {
+    lruInsert(p);
+    evictTextures();
+  }
+}
+
+TextureCache::TextureCache(const BA2File& archive, size_t maxBytes)
+  : ba2File(archive),
+    memoryLimit(maxBytes),
+    lruFirst(nullptr),
+    lruLast(nullptr)
+{
+  stats.hitCnt = 0;
+  stats.missCnt = 0;
+  stats.evictionCnt = 0;
+  stats.residentBytes = 0;
+  stats.textureCnt = 0;
+}
+
+TextureCache::~TextureCache()
+{
+  while (!textureMap.empty())
+    deleteTexture(textureMap.begin()->second);
+}
+
+const DDSTexture * TextureCache::loadTexture(
+    const std::string_view& fileName, int mipOffset, bool tiledLayout,
+    bool keepCompressed)
+{
+  int     textureType = textureTypeDDS;
+  if (keepCompressed)
+    textureType = textureTypeDDSCompressed;
+  else if (tiledLayout)
+    textureType = textureTypeDDSTiled;
+  CachedTexture *p = findOrLoadTexture(fileName, mipOffset, textureType);
+  return (p ? p->texture : nullptr);
+}
+
+const DDSTexture16 * TextureCache::loadTexture16(
+    const std::string_view& fileName, int mipOffset, bool noSRGBExpand)
+{
+  CachedTexture *p =
+      findOrLoadTexture(fileName, mipOffset,
+                        (!noSRGBExpand ?
+                         textureTypeDDS16 : textureTypeDDS16NoSRGBExpand));
+  return (p ? p->texture16 : nullptr);
+}
+
+void TextureCache::setMemoryLimit(size_t maxBytes)
+{
+  std::unique_lock< std::mutex >  lock(cacheMutex);
+  memoryLimit = maxBytes;
+  evictTextures();
+}
+
+void TextureCache::clear()
+{
+  std::unique_lock< std::mutex >  lock(cacheMutex);
+  while (lruLast)
+    deleteTexture(lruLast);
+}
+
+TextureCache::Statistics TextureCache::getStatistics()
+{
+  std::unique_lock< std::mutex >  lock(cacheMutex);
+  return stats;
+}
+
+void TextureCache::resetStatistics()
+{
+  std::unique_lock< std::mutex >  lock(cacheMutex);
+  stats.hitCnt = 0;
+  stats.missCnt = 0;
+  stats.evictionCnt = 0;
+}
+
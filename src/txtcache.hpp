@@ -0,0 +1,119 @@
+
+#ifndef TXTCACHE_HPP_INCLUDED
+#define TXTCACHE_HPP_INCLUDED
+
+#include "common.hpp"
+#include "ba2file.hpp"
+#include "ddstxt.hpp"
+#include "ddstxt16.hpp"
+
+#include <mutex>
+#include <condition_variable>
+
+// Thread-safe cache of textures loaded from a BA2File. Textures returned by
+// loadTexture() and loadTexture16() remain valid until they are released
+// with releaseTexture(). Textures that are not in use are deleted in least
+// recently used order when the total decoded size exceeds the memory limit.
+class TextureCache
+{
+ public:
+  struct Statistics
+  {
+    std::uint64_t hitCnt;
+    std::uint64_t missCnt;
+    std::uint64_t evictionCnt;
+    size_t  residentBytes;              // total data size of all textures
+    size_t  textureCnt;                 // number of textures currently loaded
+    inline double getHitRate() const
+    {
+      std::uint64_t n = hitCnt + missCnt;
+      return (n ? (double(hitCnt) / double(n)) : 0.0);
+    }
+  };
+ protected:
+  enum
+  {
+    textureTypeDDS = 0,
+    textureTypeDDSTiled = 1,
+    textureTypeDDS16 = 2,
+    textureTypeDDS16NoSRGBExpand = 3,
+    textureTypeDDSCompressed = 4
+  };
+  struct TextureKey
+  {
+    const BA2File::FileInfo *fileInfo;
+    int     mipOffset;
+    int     textureType;
+    inline bool operator<(const TextureKey& r) const
+    {
+      if (fileInfo != r.fileInfo)
+        return (std::uintptr_t(fileInfo) < std::uintptr_t(r.fileInfo));
+      if (mipOffset != r.mipOffset)
+        return (mipOffset < r.mipOffset);
+      return (textureType < r.textureType);
+    }
+  };
+  struct CachedTexture
+  {
+    TextureKey  key;
+    // both are nullptr while the texture is being loaded
+    DDSTexture    *texture;
+    DDSTexture16  *texture16;
+    size_t  dataSize;
+    size_t  refCnt;
+    // list of textures with refCnt == 0, in most recently used first order
+    CachedTexture *prv;
+    CachedTexture *nxt;
+  };
+  const BA2File&  ba2File;
+  size_t  memoryLimit;
+  std::mutex  cacheMutex;
+  std::condition_variable loadCompleteCV;
+  std::map< TextureKey, CachedTexture * > textureMap;
+  std::map< const void *, CachedTexture * > textureAddrMap;
+  CachedTexture *lruFirst;
+  CachedTexture *lruLast;
+  Statistics  stats;
+  // the following four functions require cacheMutex to be locked
+  void lruUnlink(CachedTexture *p);
+  void lruInsert(CachedTexture *p);
+  void deleteTexture(CachedTexture *p);
+  void evictTextures();
+  CachedTexture *findOrLoadTexture(const std::string_view& fileName,
+                                   int mipOffset, int textureType);
+  void releaseTexture(const void *t);
+ public:
+  // maxBytes is the memory limit for the decoded texture data
+  TextureCache(const BA2File& archive, size_t maxBytes = 0x40000000);
+  // all textures are deleted, including the ones not released yet
+  virtual ~TextureCache();
+  // fileName is passed to BA2File::findFile(), and should be in the same
+  // format (lower case, with '/' as path separator).
+  // Returns nullptr if the file is not found, and throws FO76UtilsError
+  // if the texture cannot be loaded. If multiple threads request the same
+  // texture at the same time, it is loaded only once.
+  // If keepCompressed is true, BCn textures are stored in compressed format
+  // where possible (see DDSTexture), and tiledLayout is ignored.
+  const DDSTexture *loadTexture(const std::string_view& fileName,
+                                int mipOffset = 0, bool tiledLayout = false,
+                                bool keepCompressed = false);
+  const DDSTexture16 *loadTexture16(const std::string_view& fileName,
+                                    int mipOffset = 0,
+                                    bool noSRGBExpand = false);
+  inline void releaseTexture(const DDSTexture *t)
+  {
+    releaseTexture(static_cast< const void * >(t));
+  }
+  inline void releaseTexture(const DDSTexture16 *t)
+  {
+    releaseTexture(static_cast< const void * >(t));
+  }
+  void setMemoryLimit(size_t maxBytes);
+  // delete all textures that are not in use
+  void clear();
+  Statistics getStatistics();
+  void resetStatistics();
+};
+
+#endif
+